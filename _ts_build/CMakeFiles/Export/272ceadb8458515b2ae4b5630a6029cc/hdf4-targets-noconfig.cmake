@@ -0,0 +1,121 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "hdf-static" for configuration ""
+set_property(TARGET hdf-static APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libhdf.a"
+  )
+
+list(APPEND _cmake_import_check_targets hdf-static )
+list(APPEND _cmake_import_check_files_for_hdf-static "${_IMPORT_PREFIX}/lib/libhdf.a" )
+
+# Import target "hdf-shared" for configuration ""
+set_property(TARGET hdf-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libhdf.so.4.0.3"
+  IMPORTED_SONAME_NOCONFIG "libhdf.so.4"
+  )
+
+list(APPEND _cmake_import_check_targets hdf-shared )
+list(APPEND _cmake_import_check_files_for_hdf-shared "${_IMPORT_PREFIX}/lib/libhdf.so.4.0.3" )
+
+# Import target "mfhdf-static" for configuration ""
+set_property(TARGET mfhdf-static APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(mfhdf-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libmfhdf.a"
+  )
+
+list(APPEND _cmake_import_check_targets mfhdf-static )
+list(APPEND _cmake_import_check_files_for_mfhdf-static "${_IMPORT_PREFIX}/lib/libmfhdf.a" )
+
+# Import target "mfhdf-shared" for configuration ""
+set_property(TARGET mfhdf-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(mfhdf-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libmfhdf.so.4.0.3"
+  IMPORTED_SONAME_NOCONFIG "libmfhdf.so.4"
+  )
+
+list(APPEND _cmake_import_check_targets mfhdf-shared )
+list(APPEND _cmake_import_check_files_for_mfhdf-shared "${_IMPORT_PREFIX}/lib/libmfhdf.so.4.0.3" )
+
+# Import target "hdp" for configuration ""
+set_property(TARGET hdp APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdp PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/hdp"
+  )
+
+list(APPEND _cmake_import_check_targets hdp )
+list(APPEND _cmake_import_check_files_for_hdp "${_IMPORT_PREFIX}/bin/hdp" )
+
+# Import target "hdp-shared" for configuration ""
+set_property(TARGET hdp-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdp-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/hdp-shared"
+  )
+
+list(APPEND _cmake_import_check_targets hdp-shared )
+list(APPEND _cmake_import_check_files_for_hdp-shared "${_IMPORT_PREFIX}/bin/hdp-shared" )
+
+# Import target "hdfimport" for configuration ""
+set_property(TARGET hdfimport APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdfimport PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/hdfimport"
+  )
+
+list(APPEND _cmake_import_check_targets hdfimport )
+list(APPEND _cmake_import_check_files_for_hdfimport "${_IMPORT_PREFIX}/bin/hdfimport" )
+
+# Import target "hdfimport-shared" for configuration ""
+set_property(TARGET hdfimport-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdfimport-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/hdfimport-shared"
+  )
+
+list(APPEND _cmake_import_check_targets hdfimport-shared )
+list(APPEND _cmake_import_check_files_for_hdfimport-shared "${_IMPORT_PREFIX}/bin/hdfimport-shared" )
+
+# Import target "hdiff" for configuration ""
+set_property(TARGET hdiff APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdiff PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/hdiff"
+  )
+
+list(APPEND _cmake_import_check_targets hdiff )
+list(APPEND _cmake_import_check_files_for_hdiff "${_IMPORT_PREFIX}/bin/hdiff" )
+
+# Import target "hdiff-shared" for configuration ""
+set_property(TARGET hdiff-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdiff-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/hdiff-shared"
+  )
+
+list(APPEND _cmake_import_check_targets hdiff-shared )
+list(APPEND _cmake_import_check_files_for_hdiff-shared "${_IMPORT_PREFIX}/bin/hdiff-shared" )
+
+# Import target "hrepack" for configuration ""
+set_property(TARGET hrepack APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hrepack PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/hrepack"
+  )
+
+list(APPEND _cmake_import_check_targets hrepack )
+list(APPEND _cmake_import_check_files_for_hrepack "${_IMPORT_PREFIX}/bin/hrepack" )
+
+# Import target "hrepack-shared" for configuration ""
+set_property(TARGET hrepack-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hrepack-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/hrepack-shared"
+  )
+
+list(APPEND _cmake_import_check_targets hrepack-shared )
+list(APPEND _cmake_import_check_files_for_hrepack-shared "${_IMPORT_PREFIX}/bin/hrepack-shared" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,284 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeFilters.cmake"
+  "/root/repo/CMakeInstallation.cmake"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "/root/repo/HDF4Examples/C/AN/CMakeLists.txt"
+  "/root/repo/HDF4Examples/C/AN/C_sourcefiles.cmake"
+  "/root/repo/HDF4Examples/C/CMakeLists.txt"
+  "/root/repo/HDF4Examples/C/GR/CMakeLists.txt"
+  "/root/repo/HDF4Examples/C/GR/C_sourcefiles.cmake"
+  "/root/repo/HDF4Examples/C/SD/CMakeLists.txt"
+  "/root/repo/HDF4Examples/C/SD/C_sourcefiles.cmake"
+  "/root/repo/HDF4Examples/C/VD/CMakeLists.txt"
+  "/root/repo/HDF4Examples/C/VD/C_sourcefiles.cmake"
+  "/root/repo/HDF4Examples/C/VG/CMakeLists.txt"
+  "/root/repo/HDF4Examples/C/VG/C_sourcefiles.cmake"
+  "/root/repo/HDF4Examples/CMakeLists.txt"
+  "/root/repo/HDF4Examples/CTestConfig.cmake"
+  "/root/repo/UserMacros.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/config/cmake/CTestCustom.cmake"
+  "/root/repo/config/cmake/ConfigureChecks.cmake"
+  "/root/repo/config/cmake/HDF4ExampleCache.cmake"
+  "/root/repo/config/cmake/HDF4Macros.cmake"
+  "/root/repo/config/cmake/HDFCompilerFlags.cmake"
+  "/root/repo/config/cmake/HDFLibMacros.cmake"
+  "/root/repo/config/cmake/HDFMacros.cmake"
+  "/root/repo/config/cmake/README.txt.cmake.in"
+  "/root/repo/config/cmake/h4config.h.in"
+  "/root/repo/config/cmake/hdf4-config-version.cmake.in"
+  "/root/repo/config/cmake/hdf4-config.cmake.in"
+  "/root/repo/config/cmake/libh4cc.in"
+  "/root/repo/config/cmake/libhdf4.pc.in"
+  "/root/repo/config/cmake/libhdf4.settings.cmake.in"
+  "/root/repo/hdf/CMakeLists.txt"
+  "/root/repo/hdf/src/CMakeLists.txt"
+  "/root/repo/hdf/test/CMakeLists.txt"
+  "/root/repo/hdf/test/CMakeTests.cmake"
+  "/root/repo/hdf/test/srcdir_str.h.in"
+  "/root/repo/hdf/util/CMakeLists.txt"
+  "/root/repo/mfhdf/CMakeLists.txt"
+  "/root/repo/mfhdf/dumper/CMakeLists.txt"
+  "/root/repo/mfhdf/dumper/CMakeTests.cmake"
+  "/root/repo/mfhdf/hdfimport/CMakeLists.txt"
+  "/root/repo/mfhdf/hdfimport/CMakeTests.cmake"
+  "/root/repo/mfhdf/hdiff/CMakeLists.txt"
+  "/root/repo/mfhdf/hdiff/CMakeTests.cmake"
+  "/root/repo/mfhdf/hrepack/CMakeLists.txt"
+  "/root/repo/mfhdf/hrepack/CMakeTests.cmake"
+  "/root/repo/mfhdf/libsrc/CMakeLists.txt"
+  "/root/repo/mfhdf/libsrc/netcdf.h.in"
+  "/root/repo/mfhdf/ncdump/CMakeLists.txt"
+  "/root/repo/mfhdf/ncdump/CMakeTests.cmake"
+  "/root/repo/mfhdf/ncgen/CMakeLists.txt"
+  "/root/repo/mfhdf/ncgen/CMakeTests.cmake"
+  "/root/repo/mfhdf/nctest/CMakeLists.txt"
+  "/root/repo/mfhdf/nctest/CMakeTests.cmake"
+  "/root/repo/mfhdf/test/CMakeLists.txt"
+  "/root/repo/mfhdf/test/CMakeTests.cmake"
+  "/root/repo/mfhdf/test/srcdir_str.h.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckVariableExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindJPEG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "h4config.h"
+  "hdf4-config.cmake"
+  "CMakeFiles/hdf4-config.cmake"
+  "CMakeFiles/hdf4-config-version.cmake"
+  "libhdf4.settings"
+  "README.txt"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hdf/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "netcdf.h"
+  "CMakeFiles/hdf.pc"
+  "CMakeFiles/h4cc"
+  "mfhdf/libsrc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hdf/test/srcdir_str.h"
+  "hdf/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/test/srcdir_str.h"
+  "mfhdf/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hdf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hdf/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/dumper/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/hdfimport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/hdiff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/hrepack/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/ncgen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/ncdump/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mfhdf/nctest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "HDF4Examples/DartConfiguration.tcl"
+  "HDF4Examples/CTestCustom.ctest"
+  "HDF4Examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "HDF4Examples/C/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "HDF4Examples/C/AN/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "HDF4Examples/C/VG/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "hdf/src/CMakeFiles/hdf-static.dir/DependInfo.cmake"
+  "hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/DependInfo.cmake"
+  "mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "hdf/test/CMakeFiles/testhdf.dir/DependInfo.cmake"
+  "hdf/test/CMakeFiles/buffer.dir/DependInfo.cmake"
+  "hdf/test/CMakeFiles/openbench.dir/DependInfo.cmake"
+  "hdf/test/CMakeFiles/atombench.dir/DependInfo.cmake"
+  "hdf/test/CMakeFiles/treebench.dir/DependInfo.cmake"
+  "hdf/test/CMakeFiles/hdf_test_files.dir/DependInfo.cmake"
+  "mfhdf/test/CMakeFiles/hdftest.dir/DependInfo.cmake"
+  "mfhdf/test/CMakeFiles/cdftest.dir/DependInfo.cmake"
+  "mfhdf/test/CMakeFiles/hdfnctest.dir/DependInfo.cmake"
+  "mfhdf/test/CMakeFiles/tthreads.dir/DependInfo.cmake"
+  "mfhdf/test/CMakeFiles/mfhdf_test_files.dir/DependInfo.cmake"
+  "hdf/util/CMakeFiles/hdfls.dir/DependInfo.cmake"
+  "hdf/util/CMakeFiles/hdfls-shared.dir/DependInfo.cmake"
+  "hdf/util/CMakeFiles/hdfed.dir/DependInfo.cmake"
+  "hdf/util/CMakeFiles/hdfed-shared.dir/DependInfo.cmake"
+  "mfhdf/dumper/CMakeFiles/hdp.dir/DependInfo.cmake"
+  "mfhdf/dumper/CMakeFiles/hdp-shared.dir/DependInfo.cmake"
+  "mfhdf/dumper/CMakeFiles/dumper_files.dir/DependInfo.cmake"
+  "mfhdf/hdfimport/CMakeFiles/hdfimport.dir/DependInfo.cmake"
+  "mfhdf/hdfimport/CMakeFiles/hdfimport-shared.dir/DependInfo.cmake"
+  "mfhdf/hdfimport/CMakeFiles/hdfimport_files.dir/DependInfo.cmake"
+  "mfhdf/hdfimport/CMakeFiles/hdfimporttest.dir/DependInfo.cmake"
+  "mfhdf/hdfimport/CMakeFiles/gen_sds_floats.dir/DependInfo.cmake"
+  "mfhdf/hdiff/CMakeFiles/hdiff.dir/DependInfo.cmake"
+  "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/DependInfo.cmake"
+  "mfhdf/hdiff/CMakeFiles/hdiff_files.dir/DependInfo.cmake"
+  "mfhdf/hrepack/CMakeFiles/hrepack.dir/DependInfo.cmake"
+  "mfhdf/hrepack/CMakeFiles/hrepack_check.dir/DependInfo.cmake"
+  "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/DependInfo.cmake"
+  "mfhdf/hrepack/CMakeFiles/hrepack_check-shared.dir/DependInfo.cmake"
+  "mfhdf/hrepack/CMakeFiles/hrepack_files.dir/DependInfo.cmake"
+  "mfhdf/hrepack/CMakeFiles/test_hrepack.dir/DependInfo.cmake"
+  "mfhdf/ncgen/CMakeFiles/ncgen.dir/DependInfo.cmake"
+  "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/DependInfo.cmake"
+  "mfhdf/ncgen/CMakeFiles/ncgen_files.dir/DependInfo.cmake"
+  "mfhdf/ncdump/CMakeFiles/ncdump.dir/DependInfo.cmake"
+  "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/DependInfo.cmake"
+  "mfhdf/ncdump/CMakeFiles/ncdump_files.dir/DependInfo.cmake"
+  "mfhdf/nctest/CMakeFiles/nctest.dir/DependInfo.cmake"
+  "mfhdf/nctest/CMakeFiles/nc_test_files.dir/DependInfo.cmake"
+  "HDF4Examples/C/AN/CMakeFiles/hdf_h4ex_AN_create_annotation.dir/DependInfo.cmake"
+  "HDF4Examples/C/AN/CMakeFiles/hdf_h4ex_AN_get_annotation_info.dir/DependInfo.cmake"
+  "HDF4Examples/C/AN/CMakeFiles/hdf_h4ex_AN_read_annotation.dir/DependInfo.cmake"
+  "HDF4Examples/C/AN/CMakeFiles/HDF4Examples_HDF_AN-files.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_create_and_write_chunked_image.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_create_and_write_image.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_write_palette.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_get_attribute.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_image_info.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_modify_image.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_read_image.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_read_palette.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_set_attribute.dir/DependInfo.cmake"
+  "HDF4Examples/C/GR/CMakeFiles/HDF4Examples_HDF_GR-files.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/hdf_h4ex_VD_create_onefield_vdatas.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/hdf_h4ex_VD_create_vdatas.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/hdf_h4ex_VD_write_mixed_vdata_struct.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/hdf_h4ex_VD_write_mixed_vdata.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/hdf_h4ex_VD_get_vdata_info.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/hdf_h4ex_VD_locate_vdata.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/hdf_h4ex_VD_read_mixed_vdata.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/hdf_h4ex_VD_write_to_vdata.dir/DependInfo.cmake"
+  "HDF4Examples/C/VD/CMakeFiles/HDF4Examples_HDF_VD-files.dir/DependInfo.cmake"
+  "HDF4Examples/C/VG/CMakeFiles/hdf_h4ex_VG_create_vgroup.dir/DependInfo.cmake"
+  "HDF4Examples/C/VG/CMakeFiles/hdf_h4ex_VG_get_vgroup_info.dir/DependInfo.cmake"
+  "HDF4Examples/C/VG/CMakeFiles/hdf_h4ex_VG_insert_vdatas_to_vgroup.dir/DependInfo.cmake"
+  "HDF4Examples/C/VG/CMakeFiles/hdf_h4ex_VG_vgroup_contents.dir/DependInfo.cmake"
+  "HDF4Examples/C/VG/CMakeFiles/mf_h4ex_VG_add_sds_to_vgroup.dir/DependInfo.cmake"
+  "HDF4Examples/C/VG/CMakeFiles/HDF4Examples_HDF_VG-files.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_create_sds.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_write_to_sds.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_write_slab.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_alter_sds_values.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_unlimited_sds.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_compress_sds.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_mv_sds_to_external.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_read_from_sds.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_read_subsets.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_get_info.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_find_sds_by_name.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_set_get_dim_info.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_dimscale_vs_sds.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_set_attr.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_get_attr.dir/DependInfo.cmake"
+  "HDF4Examples/C/SD/CMakeFiles/mf_SD_chunking_example.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,137 @@
+# This file will be configured to contain variables for CPack. These variables
+# should be set in the CMake list file of the project before CPack module is
+# included. The list of available CPACK_xxx variables and their associated
+# documentation may be obtained using
+#  cpack --help-variable-list
+#
+# Some variables are common to all generators (e.g. CPACK_PACKAGE_NAME)
+# and some are specific to a generator
+# (e.g. CPACK_NSIS_EXTRA_INSTALL_COMMANDS). The generator specific variables
+# usually begin with CPACK_<GENNAME>_xxxx.
+
+
+set(CPACK_BUILD_SOURCE_DIRS "/root/repo;/root/repo/_ts_build")
+set(CPACK_CMAKE_GENERATOR "Unix Makefiles")
+set(CPACK_COMPONENTS_ALL "configinstall;hdfdocuments;headers;libraries;toolsapplications")
+set(CPACK_COMPONENTS_ALL_IN_ONE_PACKAGE "ON")
+set(CPACK_COMPONENT_UNSPECIFIED_HIDDEN "TRUE")
+set(CPACK_COMPONENT_UNSPECIFIED_REQUIRED "TRUE")
+set(CPACK_DEBIAN_PACKAGE_MAINTAINER "help@hdfgroup.org")
+set(CPACK_DEBIAN_PACKAGE_SECTION "Libraries")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_SUMMARY "HDF4 built using CMake")
+set(CPACK_DMG_SLA_USE_RESOURCE_FILE_LICENSE "ON")
+set(CPACK_GENERATOR "TGZ;STGZ;DEB")
+set(CPACK_INSTALL_CMAKE_PROJECTS "/root/repo/_ts_build;HDF4;ALL;/")
+set(CPACK_INSTALL_PREFIX "/usr/local/HDF_Group/HDF/4.3.0")
+set(CPACK_MODULE_PATH "/root/repo/config/cmake;/root/repo/config/cmake")
+set(CPACK_NSIS_DISPLAY_NAME "HDF_Group/HDF/4.3.0-1")
+set(CPACK_NSIS_INSTALLER_ICON_CODE "")
+set(CPACK_NSIS_INSTALLER_MUI_ICON_CODE "")
+set(CPACK_NSIS_INSTALL_ROOT "$PROGRAMFILES")
+set(CPACK_NSIS_PACKAGE_NAME "HDF_Group/HDF/4.3.0-1")
+set(CPACK_NSIS_UNINSTALL_NAME "Uninstall")
+set(CPACK_OBJCOPY_EXECUTABLE "/usr/bin/objcopy")
+set(CPACK_OBJDUMP_EXECUTABLE "/usr/bin/objdump")
+set(CPACK_OUTPUT_CONFIG_FILE "/root/repo/_ts_build/CPackConfig.cmake")
+set(CPACK_PACKAGE_DEFAULT_LOCATION "/")
+set(CPACK_PACKAGE_DESCRIPTION_FILE "/root/repo/release_notes/RELEASE.txt")
+set(CPACK_PACKAGE_DESCRIPTION_SUMMARY "HDF4 built using CMake")
+set(CPACK_PACKAGE_FILE_NAME "HDF-4.3.0-1-Linux")
+set(CPACK_PACKAGE_ICON "/root/repo/config/cmake/hdf.bmp")
+set(CPACK_PACKAGE_INSTALL_DIRECTORY "HDF_Group/HDF/4.3.0-1")
+set(CPACK_PACKAGE_INSTALL_REGISTRY_KEY "HDF_Group/HDF/4.3.0-1")
+set(CPACK_PACKAGE_NAME "HDF")
+set(CPACK_PACKAGE_RELOCATABLE "true")
+set(CPACK_PACKAGE_VENDOR "HDF_Group")
+set(CPACK_PACKAGE_VERSION "4.3.0-1")
+set(CPACK_PACKAGE_VERSION_MAJOR "4.3")
+set(CPACK_PACKAGE_VERSION_MINOR "0")
+set(CPACK_PACKAGE_VERSION_PATCH "")
+set(CPACK_PACKAGING_INSTALL_PREFIX "/HDF_Group/HDF/4.3.0-1")
+set(CPACK_READELF_EXECUTABLE "/usr/bin/readelf")
+set(CPACK_RESOURCE_FILE_LICENSE "/root/repo/COPYING")
+set(CPACK_RESOURCE_FILE_README "/root/repo/release_notes/RELEASE.txt")
+set(CPACK_RESOURCE_FILE_WELCOME "/usr/share/cmake-3.25/Templates/CPack.GenericWelcome.txt")
+set(CPACK_SET_DESTDIR "OFF")
+set(CPACK_SOURCE_GENERATOR "TBZ2;TGZ;TXZ;TZ")
+set(CPACK_SOURCE_OUTPUT_CONFIG_FILE "/root/repo/_ts_build/CPackSourceConfig.cmake")
+set(CPACK_SOURCE_RPM "OFF")
+set(CPACK_SOURCE_TBZ2 "ON")
+set(CPACK_SOURCE_TGZ "ON")
+set(CPACK_SOURCE_TXZ "ON")
+set(CPACK_SOURCE_TZ "ON")
+set(CPACK_SOURCE_ZIP "OFF")
+set(CPACK_SYSTEM_NAME "Linux")
+set(CPACK_THREADS "1")
+set(CPACK_TOPLEVEL_TAG "Linux")
+set(CPACK_WIX_SIZEOF_VOID_P "8")
+
+if(NOT CPACK_PROPERTIES_FILE)
+  set(CPACK_PROPERTIES_FILE "/root/repo/_ts_build/CPackProperties.cmake")
+endif()
+
+if(EXISTS ${CPACK_PROPERTIES_FILE})
+  include(${CPACK_PROPERTIES_FILE})
+endif()
+
+# Configuration for installation type "Full"
+list(APPEND CPACK_ALL_INSTALL_TYPES Full)
+set(CPACK_INSTALL_TYPE_FULL_DISPLAY_NAME "Everything")
+
+# Configuration for installation type "Developer"
+list(APPEND CPACK_ALL_INSTALL_TYPES Developer)
+
+# Configuration for component group "Runtime"
+
+# Configuration for component group "Documents"
+set(CPACK_COMPONENT_GROUP_DOCUMENTS_DESCRIPTION "Release notes for developing HDF applications")
+set(CPACK_COMPONENT_GROUP_DOCUMENTS_EXPANDED TRUE)
+
+# Configuration for component group "Development"
+set(CPACK_COMPONENT_GROUP_DEVELOPMENT_DESCRIPTION "All of the tools you'll need to develop HDF applications")
+set(CPACK_COMPONENT_GROUP_DEVELOPMENT_EXPANDED TRUE)
+
+# Configuration for component group "Applications"
+set(CPACK_COMPONENT_GROUP_APPLICATIONS_DESCRIPTION "Tools for HDF4 files")
+set(CPACK_COMPONENT_GROUP_APPLICATIONS_EXPANDED TRUE)
+
+# Configuration for component "libraries"
+
+SET(CPACK_COMPONENTS_ALL configinstall hdfdocuments headers libraries toolsapplications)
+set(CPACK_COMPONENT_LIBRARIES_DISPLAY_NAME "HDF4 Libraries")
+set(CPACK_COMPONENT_LIBRARIES_GROUP Runtime)
+set(CPACK_COMPONENT_LIBRARIES_INSTALL_TYPES Full Developer User)
+set(CPACK_COMPONENT_LIBRARIES_REQUIRED TRUE)
+
+# Configuration for component "headers"
+
+SET(CPACK_COMPONENTS_ALL configinstall hdfdocuments headers libraries toolsapplications)
+set(CPACK_COMPONENT_HEADERS_DISPLAY_NAME "HDF4 Headers")
+set(CPACK_COMPONENT_HEADERS_GROUP Development)
+set(CPACK_COMPONENT_HEADERS_DEPENDS libraries)
+set(CPACK_COMPONENT_HEADERS_INSTALL_TYPES Full Developer)
+
+# Configuration for component "hdfdocuments"
+
+SET(CPACK_COMPONENTS_ALL configinstall hdfdocuments headers libraries toolsapplications)
+set(CPACK_COMPONENT_HDFDOCUMENTS_DISPLAY_NAME "HDF4 Documents")
+set(CPACK_COMPONENT_HDFDOCUMENTS_GROUP Documents)
+set(CPACK_COMPONENT_HDFDOCUMENTS_INSTALL_TYPES Full Developer)
+
+# Configuration for component "configinstall"
+
+SET(CPACK_COMPONENTS_ALL configinstall hdfdocuments headers libraries toolsapplications)
+set(CPACK_COMPONENT_CONFIGINSTALL_DISPLAY_NAME "HDF4 CMake files")
+set(CPACK_COMPONENT_CONFIGINSTALL_GROUP Development)
+set(CPACK_COMPONENT_CONFIGINSTALL_DEPENDS libraries)
+set(CPACK_COMPONENT_CONFIGINSTALL_INSTALL_TYPES Full Developer User)
+set(CPACK_COMPONENT_CONFIGINSTALL_HIDDEN TRUE)
+
+# Configuration for component "toolsapplications"
+
+SET(CPACK_COMPONENTS_ALL configinstall hdfdocuments headers libraries toolsapplications)
+set(CPACK_COMPONENT_TOOLSAPPLICATIONS_DISPLAY_NAME "HDF4 Tools Applications")
+set(CPACK_COMPONENT_TOOLSAPPLICATIONS_GROUP Applications)
+set(CPACK_COMPONENT_TOOLSAPPLICATIONS_DEPENDS libraries)
+set(CPACK_COMPONENT_TOOLSAPPLICATIONS_INSTALL_TYPES Full Developer User)
@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_ts_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("hdf/src")
+subdirs("mfhdf/libsrc")
+subdirs("hdf/test")
+subdirs("mfhdf/test")
+subdirs("hdf")
+subdirs("mfhdf")
+subdirs("HDF4Examples")
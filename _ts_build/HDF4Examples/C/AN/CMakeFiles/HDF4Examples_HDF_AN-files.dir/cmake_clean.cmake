@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HDF4Examples_HDF_AN-files"
+  "General_HDFobjects.hdf"
+  "h4ex_AN_create_annotation.ddl"
+  "h4ex_AN_create_annotation.tst"
+  "h4ex_AN_get_annotation_info.tst"
+  "h4ex_AN_read_annotation.tst"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HDF4Examples_HDF_AN-files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
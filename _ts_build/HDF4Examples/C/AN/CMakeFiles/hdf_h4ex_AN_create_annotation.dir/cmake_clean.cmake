@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_AN_create_annotation"
+  "../../../bin/hdf_h4ex_AN_create_annotation.pdb"
+  "CMakeFiles/hdf_h4ex_AN_create_annotation.dir/h4ex_AN_create_annotation.c.o"
+  "CMakeFiles/hdf_h4ex_AN_create_annotation.dir/h4ex_AN_create_annotation.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_AN_create_annotation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_AN_read_annotation"
+  "../../../bin/hdf_h4ex_AN_read_annotation.pdb"
+  "CMakeFiles/hdf_h4ex_AN_read_annotation.dir/h4ex_AN_read_annotation.c.o"
+  "CMakeFiles/hdf_h4ex_AN_read_annotation.dir/h4ex_AN_read_annotation.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_AN_read_annotation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/HDF4Examples/C/AN
+# Build directory: /root/repo/_ts_build/HDF4Examples/C/AN
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(hdf_h4ex_AN_create_annotation-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_AN_create_annotation.hdf")
+set_tests_properties(hdf_h4ex_AN_create_annotation-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/AN/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;0;")
+add_test(hdf_h4ex_AN_create_annotation "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_AN_create_annotation" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/AN" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_AN_create_annotation.out" "-D" "TEST_REFERENCE=h4ex_AN_create_annotation.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_AN_create_annotation PROPERTIES  DEPENDS "hdf_h4ex_AN_create_annotation-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/AN/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_AN_create_annotation "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_AN_create_annotation.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/AN" "-D" "TEST_OUTPUT=h4ex_AN_create_annotation.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=h4ex_AN_create_annotation.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_AN_create_annotation PROPERTIES  DEPENDS "hdf_h4ex_AN_create_annotation" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/AN/CMakeLists.txt;41;add_test;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;0;")
+add_test(hdf_h4ex_AN_get_annotation_info-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_AN_get_annotation_info.hdf")
+set_tests_properties(hdf_h4ex_AN_get_annotation_info-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/AN/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;0;")
+add_test(hdf_h4ex_AN_get_annotation_info "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_AN_get_annotation_info" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/AN" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_AN_get_annotation_info.out" "-D" "TEST_REFERENCE=h4ex_AN_get_annotation_info.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_AN_get_annotation_info PROPERTIES  DEPENDS "hdf_h4ex_AN_get_annotation_info-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/AN/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;0;")
+add_test(hdf_h4ex_AN_read_annotation-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_AN_read_annotation.hdf")
+set_tests_properties(hdf_h4ex_AN_read_annotation-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/AN/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;0;")
+add_test(hdf_h4ex_AN_read_annotation "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_AN_read_annotation" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/AN" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_AN_read_annotation.out" "-D" "TEST_REFERENCE=h4ex_AN_read_annotation.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_AN_read_annotation PROPERTIES  DEPENDS "hdf_h4ex_AN_read_annotation-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/AN/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/AN/CMakeLists.txt;0;")
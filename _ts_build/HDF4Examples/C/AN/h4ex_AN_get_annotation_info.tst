@@ -0,0 +1,7 @@
+List of annotations of type AN_DATA_DESC:
+Annotation index 0: tag = DFTAG_DIA (data description)
+reference number= 1
+
+Annotation type of DFTAG_FID (file label) is AN_FILE_LABEL
+
+Annotation tag of AN_DATA_LABEL is DFTAG_DIL (data label)
@@ -0,0 +1,2 @@
+Data label index: 0
+Data label contents: Common AN Vgroup
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/HDF4Examples/C
+# Build directory: /root/repo/_ts_build/HDF4Examples/C
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("AN")
+subdirs("GR")
+subdirs("VD")
+subdirs("VG")
+subdirs("SD")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HDF4Examples_HDF_GR-files"
+  "General_RImages.hdf"
+  "General_RImages2.hdf"
+  "General_RImages3.hdf"
+  "General_RImages4.hdf"
+  "Image_with_Palette.hdf"
+  "h4ex_GR_create_and_write_chunked_image.ddl"
+  "h4ex_GR_create_and_write_chunked_image.tst"
+  "h4ex_GR_create_and_write_image.ddl"
+  "h4ex_GR_create_and_write_image.tst"
+  "h4ex_GR_get_attribute.tst"
+  "h4ex_GR_image_info.tst"
+  "h4ex_GR_modify_image.tst"
+  "h4ex_GR_read_image.tst"
+  "h4ex_GR_read_palette.tst"
+  "h4ex_GR_set_attribute.tst"
+  "h4ex_GR_write_palette.ddl"
+  "h4ex_GR_write_palette.tst"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HDF4Examples_HDF_GR-files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
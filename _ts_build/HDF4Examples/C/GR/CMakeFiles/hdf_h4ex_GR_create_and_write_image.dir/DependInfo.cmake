@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/HDF4Examples/C/GR/h4ex_GR_create_and_write_image.c" "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_create_and_write_image.dir/h4ex_GR_create_and_write_image.c.o" "gcc" "HDF4Examples/C/GR/CMakeFiles/hdf_h4ex_GR_create_and_write_image.dir/h4ex_GR_create_and_write_image.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_GR_modify_image"
+  "../../../bin/hdf_h4ex_GR_modify_image.pdb"
+  "CMakeFiles/hdf_h4ex_GR_modify_image.dir/h4ex_GR_modify_image.c.o"
+  "CMakeFiles/hdf_h4ex_GR_modify_image.dir/h4ex_GR_modify_image.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_GR_modify_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_GR_read_palette"
+  "../../../bin/hdf_h4ex_GR_read_palette.pdb"
+  "CMakeFiles/hdf_h4ex_GR_read_palette.dir/h4ex_GR_read_palette.c.o"
+  "CMakeFiles/hdf_h4ex_GR_read_palette.dir/h4ex_GR_read_palette.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_GR_read_palette.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
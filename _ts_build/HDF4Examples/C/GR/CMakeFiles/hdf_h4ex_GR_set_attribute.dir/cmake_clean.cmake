@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_GR_set_attribute"
+  "../../../bin/hdf_h4ex_GR_set_attribute.pdb"
+  "CMakeFiles/hdf_h4ex_GR_set_attribute.dir/h4ex_GR_set_attribute.c.o"
+  "CMakeFiles/hdf_h4ex_GR_set_attribute.dir/h4ex_GR_set_attribute.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_GR_set_attribute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,48 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/HDF4Examples/C/GR
+# Build directory: /root/repo/_ts_build/HDF4Examples/C/GR
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(hdf_h4ex_GR_create_and_write_chunked_image-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_create_and_write_chunked_image.hdf")
+set_tests_properties(hdf_h4ex_GR_create_and_write_chunked_image-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_create_and_write_chunked_image "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_create_and_write_chunked_image" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_create_and_write_chunked_image.out" "-D" "TEST_REFERENCE=h4ex_GR_create_and_write_chunked_image.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_create_and_write_chunked_image PROPERTIES  DEPENDS "hdf_h4ex_GR_create_and_write_chunked_image-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_GR_create_and_write_chunked_image "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_GR_create_and_write_chunked_image.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_OUTPUT=h4ex_GR_create_and_write_chunked_image.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=h4ex_GR_create_and_write_chunked_image.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_GR_create_and_write_chunked_image PROPERTIES  DEPENDS "hdf_h4ex_GR_create_and_write_chunked_image" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;41;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_create_and_write_image-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_create_and_write_image.hdf")
+set_tests_properties(hdf_h4ex_GR_create_and_write_image-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_create_and_write_image "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_create_and_write_image" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_create_and_write_image.out" "-D" "TEST_REFERENCE=h4ex_GR_create_and_write_image.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_create_and_write_image PROPERTIES  DEPENDS "hdf_h4ex_GR_create_and_write_image-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_GR_create_and_write_image "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_GR_create_and_write_image.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_OUTPUT=h4ex_GR_create_and_write_image.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=h4ex_GR_create_and_write_image.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_GR_create_and_write_image PROPERTIES  DEPENDS "hdf_h4ex_GR_create_and_write_image" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;41;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_write_palette-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_write_palette.hdf")
+set_tests_properties(hdf_h4ex_GR_write_palette-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_write_palette "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_write_palette" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_write_palette.out" "-D" "TEST_REFERENCE=h4ex_GR_write_palette.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_write_palette PROPERTIES  DEPENDS "hdf_h4ex_GR_write_palette-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_GR_write_palette "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_GR_write_palette.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_OUTPUT=h4ex_GR_write_palette.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=h4ex_GR_write_palette.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_GR_write_palette PROPERTIES  DEPENDS "hdf_h4ex_GR_write_palette" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;41;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_get_attribute-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_get_attribute.hdf")
+set_tests_properties(hdf_h4ex_GR_get_attribute-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_get_attribute "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_get_attribute" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_get_attribute.out" "-D" "TEST_REFERENCE=h4ex_GR_get_attribute.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_get_attribute PROPERTIES  DEPENDS "hdf_h4ex_GR_get_attribute-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_image_info-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_image_info.hdf")
+set_tests_properties(hdf_h4ex_GR_image_info-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_image_info "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_image_info" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_image_info.out" "-D" "TEST_REFERENCE=h4ex_GR_image_info.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_image_info PROPERTIES  DEPENDS "hdf_h4ex_GR_image_info-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_modify_image-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_modify_image.hdf")
+set_tests_properties(hdf_h4ex_GR_modify_image-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_modify_image "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_modify_image" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_modify_image.out" "-D" "TEST_REFERENCE=h4ex_GR_modify_image.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_modify_image PROPERTIES  DEPENDS "hdf_h4ex_GR_modify_image-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_read_image-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_read_image.hdf")
+set_tests_properties(hdf_h4ex_GR_read_image-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_read_image "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_read_image" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_read_image.out" "-D" "TEST_REFERENCE=h4ex_GR_read_image.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_read_image PROPERTIES  DEPENDS "hdf_h4ex_GR_read_image-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_read_palette-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_read_palette.hdf")
+set_tests_properties(hdf_h4ex_GR_read_palette-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_read_palette "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_read_palette" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_read_palette.out" "-D" "TEST_REFERENCE=h4ex_GR_read_palette.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_read_palette PROPERTIES  DEPENDS "hdf_h4ex_GR_read_palette-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_set_attribute-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_GR_set_attribute.hdf")
+set_tests_properties(hdf_h4ex_GR_set_attribute-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
+add_test(hdf_h4ex_GR_set_attribute "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_GR_set_attribute" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/GR" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_GR_set_attribute.out" "-D" "TEST_REFERENCE=h4ex_GR_set_attribute.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_GR_set_attribute PROPERTIES  DEPENDS "hdf_h4ex_GR_set_attribute-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/GR/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/GR/CMakeLists.txt;0;")
@@ -0,0 +1,4 @@
+Attribute File Attribute 1: Contents of First FILE Attribute
+Attribute File Attribute 2: Contents of Second FILE Attribute
+
+Attribute Image Attribute 2: 1 2 3 4 5 6 
@@ -0,0 +1,4 @@
+RI#    Name       Components  Type         Interlace        Dimensions   Attributes
+
+0  Image Array 1       2      Int16   MFGR_INTERLACE_PIXEL     10, 5         0
+1  Image Array 2       3      Char8   MFGR_INTERLACE_PIXEL      6, 4         2
@@ -0,0 +1,16 @@
+First component of the entire image:
+0 0 0 0 0 6 7 8 9 10 
+0 0 0 0 0 7 8 9 10 11 
+3 4 5 6 7 8 9 10 11 12 
+4 5 6 7 8 9 10 11 12 13 
+5 6 7 8 9 10 11 12 13 14 
+
+Three rows & two cols at 2nd row and 4th column of the first component:
+0 0 
+6 7 
+7 8 
+
+All odd rows and even columns of the first component:
+0 0 6 8 10 
+4 6 8 10 12 
+6 8 10 12 14 
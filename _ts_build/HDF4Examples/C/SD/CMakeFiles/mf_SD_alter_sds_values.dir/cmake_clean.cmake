@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_alter_sds_values"
+  "../../../bin/mf_SD_alter_sds_values.pdb"
+  "CMakeFiles/mf_SD_alter_sds_values.dir/h4ex_SD_alter_sds_values.c.o"
+  "CMakeFiles/mf_SD_alter_sds_values.dir/h4ex_SD_alter_sds_values.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_alter_sds_values.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_chunking_example"
+  "../../../bin/mf_SD_chunking_example.pdb"
+  "CMakeFiles/mf_SD_chunking_example.dir/h4ex_SD_chunking_example.c.o"
+  "CMakeFiles/mf_SD_chunking_example.dir/h4ex_SD_chunking_example.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_chunking_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_dimscale_vs_sds"
+  "../../../bin/mf_SD_dimscale_vs_sds.pdb"
+  "CMakeFiles/mf_SD_dimscale_vs_sds.dir/h4ex_SD_dimscale_vs_sds.c.o"
+  "CMakeFiles/mf_SD_dimscale_vs_sds.dir/h4ex_SD_dimscale_vs_sds.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_dimscale_vs_sds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_find_sds_by_name"
+  "../../../bin/mf_SD_find_sds_by_name.pdb"
+  "CMakeFiles/mf_SD_find_sds_by_name.dir/h4ex_SD_find_sds_by_name.c.o"
+  "CMakeFiles/mf_SD_find_sds_by_name.dir/h4ex_SD_find_sds_by_name.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_find_sds_by_name.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
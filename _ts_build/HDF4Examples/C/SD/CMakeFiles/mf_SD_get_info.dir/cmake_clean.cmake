@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_get_info"
+  "../../../bin/mf_SD_get_info.pdb"
+  "CMakeFiles/mf_SD_get_info.dir/h4ex_SD_get_info.c.o"
+  "CMakeFiles/mf_SD_get_info.dir/h4ex_SD_get_info.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_get_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_mv_sds_to_external"
+  "../../../bin/mf_SD_mv_sds_to_external.pdb"
+  "CMakeFiles/mf_SD_mv_sds_to_external.dir/h4ex_SD_mv_sds_to_external.c.o"
+  "CMakeFiles/mf_SD_mv_sds_to_external.dir/h4ex_SD_mv_sds_to_external.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_mv_sds_to_external.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_read_subsets"
+  "../../../bin/mf_SD_read_subsets.pdb"
+  "CMakeFiles/mf_SD_read_subsets.dir/h4ex_SD_read_subsets.c.o"
+  "CMakeFiles/mf_SD_read_subsets.dir/h4ex_SD_read_subsets.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_read_subsets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
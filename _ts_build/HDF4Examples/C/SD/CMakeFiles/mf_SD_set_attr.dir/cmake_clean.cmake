@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_set_attr"
+  "../../../bin/mf_SD_set_attr.pdb"
+  "CMakeFiles/mf_SD_set_attr.dir/h4ex_SD_set_attr.c.o"
+  "CMakeFiles/mf_SD_set_attr.dir/h4ex_SD_set_attr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_set_attr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_set_get_dim_info"
+  "../../../bin/mf_SD_set_get_dim_info.pdb"
+  "CMakeFiles/mf_SD_set_get_dim_info.dir/h4ex_SD_set_get_dim_info.c.o"
+  "CMakeFiles/mf_SD_set_get_dim_info.dir/h4ex_SD_set_get_dim_info.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_set_get_dim_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
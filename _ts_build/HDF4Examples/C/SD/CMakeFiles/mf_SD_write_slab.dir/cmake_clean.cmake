@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_SD_write_slab"
+  "../../../bin/mf_SD_write_slab.pdb"
+  "CMakeFiles/mf_SD_write_slab.dir/h4ex_SD_write_slab.c.o"
+  "CMakeFiles/mf_SD_write_slab.dir/h4ex_SD_write_slab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_SD_write_slab.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
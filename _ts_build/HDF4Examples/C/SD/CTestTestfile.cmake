@@ -0,0 +1,40 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/HDF4Examples/C/SD
+# Build directory: /root/repo/_ts_build/HDF4Examples/C/SD
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(MFHDF_EXAMPLES-clearall-objects "/usr/bin/cmake" "-E" "remove" "SDS.hdf" "SDSchunked.hdf" "SDScompressed.hdf" "SDSUNLIMITED.hdf" "SLABS.hdf" "ExternalSDS")
+set_tests_properties(MFHDF_EXAMPLES-clearall-objects PROPERTIES  LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;11;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_create_sds "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_create_sds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_create_sds.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_create_sds PROPERTIES  DEPENDS "MFHDF_EXAMPLES-clearall-objects" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_write_to_sds "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_write_to_sds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_write_to_sds.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_write_to_sds PROPERTIES  DEPENDS "mftest_SD_create_sds" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_write_slab "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_write_slab" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_write_slab.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_write_slab PROPERTIES  DEPENDS "mftest_SD_write_to_sds" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_alter_sds_values "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_alter_sds_values" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_alter_sds_values.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_alter_sds_values PROPERTIES  DEPENDS "mftest_SD_write_slab" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_unlimited_sds "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_unlimited_sds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_unlimited_sds.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_unlimited_sds PROPERTIES  DEPENDS "mftest_SD_alter_sds_values" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_compress_sds "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_compress_sds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_compress_sds.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_compress_sds PROPERTIES  DEPENDS "mftest_SD_unlimited_sds" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_mv_sds_to_external "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_mv_sds_to_external" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_mv_sds_to_external.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_mv_sds_to_external PROPERTIES  DEPENDS "mftest_SD_compress_sds" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_read_from_sds "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_read_from_sds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_read_from_sds.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_read_from_sds PROPERTIES  DEPENDS "mftest_SD_mv_sds_to_external" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_read_subsets "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_read_subsets" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_read_subsets.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_read_subsets PROPERTIES  DEPENDS "mftest_SD_read_from_sds" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_get_info "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_get_info" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_get_info.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_get_info PROPERTIES  DEPENDS "mftest_SD_read_subsets" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_find_sds_by_name "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_find_sds_by_name" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_find_sds_by_name.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_find_sds_by_name PROPERTIES  DEPENDS "mftest_SD_get_info" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_set_get_dim_info "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_set_get_dim_info" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_set_get_dim_info.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_set_get_dim_info PROPERTIES  DEPENDS "mftest_SD_find_sds_by_name" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_dimscale_vs_sds "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_dimscale_vs_sds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_dimscale_vs_sds.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_dimscale_vs_sds PROPERTIES  DEPENDS "mftest_SD_set_get_dim_info" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_set_attr "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_set_attr" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_set_attr.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_set_attr PROPERTIES  DEPENDS "mftest_SD_dimscale_vs_sds" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_get_attr "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_get_attr" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_get_attr.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_get_attr PROPERTIES  DEPENDS "mftest_SD_set_attr" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
+add_test(mftest_SD_chunking_example "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_SD_chunking_example" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/SD" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=SD_chunking_example.out" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mftest_SD_chunking_example PROPERTIES  DEPENDS "mftest_SD_get_attr" LABELS "HDF4Examples_SD" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/SD/CMakeLists.txt;34;add_test;/root/repo/HDF4Examples/C/SD/CMakeLists.txt;0;")
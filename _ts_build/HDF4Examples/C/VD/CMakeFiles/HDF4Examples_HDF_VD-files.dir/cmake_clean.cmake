@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HDF4Examples_HDF_VD-files"
+  "General_Vdatas.hdf"
+  "General_Vdatas2.hdf"
+  "General_Vdatas3.hdf"
+  "Packed_Vdata.hdf"
+  "Two_Vdatas.hdf"
+  "h4ex_VD_create_onefield_vdatas.ddl"
+  "h4ex_VD_create_onefield_vdatas.tst"
+  "h4ex_VD_create_vdatas.ddl"
+  "h4ex_VD_create_vdatas.tst"
+  "h4ex_VD_get_vdata_info.tst"
+  "h4ex_VD_locate_vdata.tst"
+  "h4ex_VD_read_mixed_vdata.tst"
+  "h4ex_VD_write_mixed_vdata.ddl"
+  "h4ex_VD_write_mixed_vdata.tst"
+  "h4ex_VD_write_mixed_vdata_struct.ddl"
+  "h4ex_VD_write_mixed_vdata_struct.tst"
+  "h4ex_VD_write_to_vdata.tst"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HDF4Examples_HDF_VD-files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
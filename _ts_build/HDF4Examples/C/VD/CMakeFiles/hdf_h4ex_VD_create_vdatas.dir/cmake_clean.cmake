@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_VD_create_vdatas"
+  "../../../bin/hdf_h4ex_VD_create_vdatas.pdb"
+  "CMakeFiles/hdf_h4ex_VD_create_vdatas.dir/h4ex_VD_create_vdatas.c.o"
+  "CMakeFiles/hdf_h4ex_VD_create_vdatas.dir/h4ex_VD_create_vdatas.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_VD_create_vdatas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
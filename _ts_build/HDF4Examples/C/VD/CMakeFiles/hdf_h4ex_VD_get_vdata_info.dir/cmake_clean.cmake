@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_VD_get_vdata_info"
+  "../../../bin/hdf_h4ex_VD_get_vdata_info.pdb"
+  "CMakeFiles/hdf_h4ex_VD_get_vdata_info.dir/h4ex_VD_get_vdata_info.c.o"
+  "CMakeFiles/hdf_h4ex_VD_get_vdata_info.dir/h4ex_VD_get_vdata_info.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_VD_get_vdata_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_VD_write_mixed_vdata"
+  "../../../bin/hdf_h4ex_VD_write_mixed_vdata.pdb"
+  "CMakeFiles/hdf_h4ex_VD_write_mixed_vdata.dir/h4ex_VD_write_mixed_vdata.c.o"
+  "CMakeFiles/hdf_h4ex_VD_write_mixed_vdata.dir/h4ex_VD_write_mixed_vdata.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_VD_write_mixed_vdata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_VD_write_mixed_vdata_struct"
+  "../../../bin/hdf_h4ex_VD_write_mixed_vdata_struct.pdb"
+  "CMakeFiles/hdf_h4ex_VD_write_mixed_vdata_struct.dir/h4ex_VD_write_mixed_vdata_struct.c.o"
+  "CMakeFiles/hdf_h4ex_VD_write_mixed_vdata_struct.dir/h4ex_VD_write_mixed_vdata_struct.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_VD_write_mixed_vdata_struct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,46 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/HDF4Examples/C/VD
+# Build directory: /root/repo/_ts_build/HDF4Examples/C/VD
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(hdf_h4ex_VD_create_onefield_vdatas-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VD_create_onefield_vdatas.hdf")
+set_tests_properties(hdf_h4ex_VD_create_onefield_vdatas-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_create_onefield_vdatas "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VD_create_onefield_vdatas" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_VD_create_onefield_vdatas.out" "-D" "TEST_REFERENCE=h4ex_VD_create_onefield_vdatas.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VD_create_onefield_vdatas PROPERTIES  DEPENDS "hdf_h4ex_VD_create_onefield_vdatas-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_VD_create_onefield_vdatas "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_VD_create_onefield_vdatas.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_OUTPUT=h4ex_VD_create_onefield_vdatas.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=h4ex_VD_create_onefield_vdatas.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_VD_create_onefield_vdatas PROPERTIES  DEPENDS "hdf_h4ex_VD_create_onefield_vdatas" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;41;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_create_vdatas-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VD_create_vdatas.hdf")
+set_tests_properties(hdf_h4ex_VD_create_vdatas-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_create_vdatas "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VD_create_vdatas" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_VD_create_vdatas.out" "-D" "TEST_REFERENCE=h4ex_VD_create_vdatas.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VD_create_vdatas PROPERTIES  DEPENDS "hdf_h4ex_VD_create_vdatas-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_VD_create_vdatas "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_VD_create_vdatas.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_OUTPUT=h4ex_VD_create_vdatas.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=h4ex_VD_create_vdatas.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_VD_create_vdatas PROPERTIES  DEPENDS "hdf_h4ex_VD_create_vdatas" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;41;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_write_mixed_vdata_struct-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VD_write_mixed_vdata_struct.hdf")
+set_tests_properties(hdf_h4ex_VD_write_mixed_vdata_struct-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_write_mixed_vdata_struct "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VD_write_mixed_vdata_struct" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_VD_write_mixed_vdata_struct.out" "-D" "TEST_REFERENCE=h4ex_VD_write_mixed_vdata_struct.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VD_write_mixed_vdata_struct PROPERTIES  DEPENDS "hdf_h4ex_VD_write_mixed_vdata_struct-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_VD_write_mixed_vdata_struct "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_VD_write_mixed_vdata_struct.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_OUTPUT=h4ex_VD_write_mixed_vdata_struct.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=h4ex_VD_write_mixed_vdata_struct.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_VD_write_mixed_vdata_struct PROPERTIES  DEPENDS "hdf_h4ex_VD_write_mixed_vdata_struct" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;41;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_write_mixed_vdata-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VD_write_mixed_vdata.hdf")
+set_tests_properties(hdf_h4ex_VD_write_mixed_vdata-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_write_mixed_vdata "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VD_write_mixed_vdata" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_VD_write_mixed_vdata.out" "-D" "TEST_REFERENCE=h4ex_VD_write_mixed_vdata.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VD_write_mixed_vdata PROPERTIES  DEPENDS "hdf_h4ex_VD_write_mixed_vdata-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_VD_write_mixed_vdata "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_VD_write_mixed_vdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_OUTPUT=h4ex_VD_write_mixed_vdata.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=h4ex_VD_write_mixed_vdata.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_VD_write_mixed_vdata PROPERTIES  DEPENDS "hdf_h4ex_VD_write_mixed_vdata" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;41;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;106;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_get_vdata_info-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VD_get_vdata_info.hdf")
+set_tests_properties(hdf_h4ex_VD_get_vdata_info-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_get_vdata_info "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VD_get_vdata_info" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_VD_get_vdata_info.out" "-D" "TEST_REFERENCE=h4ex_VD_get_vdata_info.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VD_get_vdata_info PROPERTIES  DEPENDS "hdf_h4ex_VD_get_vdata_info-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_locate_vdata-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VD_locate_vdata.hdf")
+set_tests_properties(hdf_h4ex_VD_locate_vdata-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_locate_vdata "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VD_locate_vdata" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_VD_locate_vdata.out" "-D" "TEST_REFERENCE=h4ex_VD_locate_vdata.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VD_locate_vdata PROPERTIES  DEPENDS "hdf_h4ex_VD_locate_vdata-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_read_mixed_vdata-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VD_read_mixed_vdata.hdf")
+set_tests_properties(hdf_h4ex_VD_read_mixed_vdata-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_read_mixed_vdata "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VD_read_mixed_vdata" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_VD_read_mixed_vdata.out" "-D" "TEST_REFERENCE=h4ex_VD_read_mixed_vdata.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VD_read_mixed_vdata PROPERTIES  DEPENDS "hdf_h4ex_VD_read_mixed_vdata-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_write_to_vdata-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VD_write_to_vdata.hdf")
+set_tests_properties(hdf_h4ex_VD_write_to_vdata-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;21;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VD_write_to_vdata "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VD_write_to_vdata" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VD" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=h4ex_VD_write_to_vdata.out" "-D" "TEST_REFERENCE=h4ex_VD_write_to_vdata.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VD_write_to_vdata PROPERTIES  DEPENDS "hdf_h4ex_VD_write_to_vdata-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VD/CMakeLists.txt;27;add_test;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;110;ADD_H4_TEST;/root/repo/HDF4Examples/C/VD/CMakeLists.txt;0;")
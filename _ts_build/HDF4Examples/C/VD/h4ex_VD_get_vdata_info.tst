@@ -0,0 +1,8 @@
+Vdata First Vdata: - contains 5 records
+	Interlace mode: FULL                  
+	Fields: Single-component Field - 1 bytes
+	
+Vdata Second Vdata: - contains 6 records
+	Interlace mode: FULL                  
+	Fields: Multi-component Field - 16 bytes
+	
@@ -0,0 +1 @@
+Fields Position and Temperature were not found.
@@ -0,0 +1,22 @@
+
+     Temp      Ident
+     1.11        A
+     2.22        B
+     3.33        C
+     4.44        D
+     5.55        E
+     6.66        F
+     7.77        G
+     8.88        H
+     9.99        I
+    11.10        J
+    12.21        K
+    13.32        L
+    14.43        M
+    15.54        N
+    16.65        O
+    17.76        P
+    18.87        Q
+    19.98        R
+    21.09        S
+    22.20        T
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HDF4Examples_HDF_VG-files"
+  "General_Vgroups.hdf"
+  "General_Vgroups2.hdf"
+  "General_Vgroups3.hdf"
+  "General_Vgroups4.hdf"
+  "h4ex_VG_add_sds_to_vgroup.ddl"
+  "h4ex_VG_add_sds_to_vgroup.tst"
+  "h4ex_VG_create_vgroup.ddl"
+  "h4ex_VG_create_vgroup.tst"
+  "h4ex_VG_get_vgroup_info.tst"
+  "h4ex_VG_insert_vdatas_to_vgroup.tst"
+  "h4ex_VG_vgroup_contents.tst"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HDF4Examples_HDF_VG-files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_VG_create_vgroup"
+  "../../../bin/hdf_h4ex_VG_create_vgroup.pdb"
+  "CMakeFiles/hdf_h4ex_VG_create_vgroup.dir/h4ex_VG_create_vgroup.c.o"
+  "CMakeFiles/hdf_h4ex_VG_create_vgroup.dir/h4ex_VG_create_vgroup.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_VG_create_vgroup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
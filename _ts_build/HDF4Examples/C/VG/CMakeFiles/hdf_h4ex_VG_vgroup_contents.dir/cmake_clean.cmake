@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/hdf_h4ex_VG_vgroup_contents"
+  "../../../bin/hdf_h4ex_VG_vgroup_contents.pdb"
+  "CMakeFiles/hdf_h4ex_VG_vgroup_contents.dir/h4ex_VG_vgroup_contents.c.o"
+  "CMakeFiles/hdf_h4ex_VG_vgroup_contents.dir/h4ex_VG_vgroup_contents.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf_h4ex_VG_vgroup_contents.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mf_h4ex_VG_add_sds_to_vgroup"
+  "../../../bin/mf_h4ex_VG_add_sds_to_vgroup.pdb"
+  "CMakeFiles/mf_h4ex_VG_add_sds_to_vgroup.dir/h4ex_VG_add_sds_to_vgroup.c.o"
+  "CMakeFiles/mf_h4ex_VG_add_sds_to_vgroup.dir/h4ex_VG_add_sds_to_vgroup.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf_h4ex_VG_add_sds_to_vgroup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/HDF4Examples/C/VG
+# Build directory: /root/repo/_ts_build/HDF4Examples/C/VG
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(hdf_h4ex_VG_create_vgroup-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VG_create_vgroup.hdf")
+set_tests_properties(hdf_h4ex_VG_create_vgroup-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;26;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;132;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VG_create_vgroup "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VG_create_vgroup" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VG" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=hdf_h4ex_VG_create_vgroup.out" "-D" "TEST_REFERENCE=hdf_h4ex_VG_create_vgroup.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VG_create_vgroup PROPERTIES  DEPENDS "hdf_h4ex_VG_create_vgroup-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;32;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;132;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(hdf_HDP-h4ex_VG_create_vgroup "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_VG_create_vgroup.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VG" "-D" "TEST_OUTPUT=hdf_h4ex_VG_create_vgroup.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=hdf_h4ex_VG_create_vgroup.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_HDP-h4ex_VG_create_vgroup PROPERTIES  DEPENDS "hdf_h4ex_VG_create_vgroup" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;46;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;132;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VG_get_vgroup_info-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VG_get_vgroup_info.hdf")
+set_tests_properties(hdf_h4ex_VG_get_vgroup_info-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;26;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;136;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VG_get_vgroup_info "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VG_get_vgroup_info" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VG" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=hdf_h4ex_VG_get_vgroup_info.out" "-D" "TEST_REFERENCE=hdf_h4ex_VG_get_vgroup_info.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VG_get_vgroup_info PROPERTIES  DEPENDS "hdf_h4ex_VG_get_vgroup_info-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;32;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;136;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VG_insert_vdatas_to_vgroup-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VG_insert_vdatas_to_vgroup.hdf")
+set_tests_properties(hdf_h4ex_VG_insert_vdatas_to_vgroup-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;26;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;136;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VG_insert_vdatas_to_vgroup "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VG_insert_vdatas_to_vgroup" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VG" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=hdf_h4ex_VG_insert_vdatas_to_vgroup.out" "-D" "TEST_REFERENCE=hdf_h4ex_VG_insert_vdatas_to_vgroup.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VG_insert_vdatas_to_vgroup PROPERTIES  DEPENDS "hdf_h4ex_VG_insert_vdatas_to_vgroup-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;32;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;136;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VG_vgroup_contents-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VG_vgroup_contents.hdf")
+set_tests_properties(hdf_h4ex_VG_vgroup_contents-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;26;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;136;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(hdf_h4ex_VG_vgroup_contents "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdf_h4ex_VG_vgroup_contents" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VG" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=hdf_h4ex_VG_vgroup_contents.out" "-D" "TEST_REFERENCE=hdf_h4ex_VG_vgroup_contents.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(hdf_h4ex_VG_vgroup_contents PROPERTIES  DEPENDS "hdf_h4ex_VG_vgroup_contents-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;32;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;136;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(mf_h4ex_VG_add_sds_to_vgroup-clearall "/usr/bin/cmake" "-E" "remove" "h4ex_VG_add_sds_to_vgroup.hdf")
+set_tests_properties(mf_h4ex_VG_add_sds_to_vgroup-clearall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;26;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;140;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(mf_h4ex_VG_add_sds_to_vgroup "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/mf_h4ex_VG_add_sds_to_vgroup" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VG" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=mf_h4ex_VG_add_sds_to_vgroup.out" "-D" "TEST_REFERENCE=mf_h4ex_VG_add_sds_to_vgroup.tst" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mf_h4ex_VG_add_sds_to_vgroup PROPERTIES  DEPENDS "mf_h4ex_VG_add_sds_to_vgroup-clearall" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;32;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;140;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
+add_test(mf_HDP-h4ex_VG_add_sds_to_vgroup "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;h4ex_VG_add_sds_to_vgroup.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/HDF4Examples/C/VG" "-D" "TEST_OUTPUT=mf_h4ex_VG_add_sds_to_vgroup.ddl.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=mf_h4ex_VG_add_sds_to_vgroup.ddl" "-D" "TEST_LIBRARY_DIRECTORY=" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(mf_HDP-h4ex_VG_add_sds_to_vgroup PROPERTIES  DEPENDS "mf_h4ex_VG_add_sds_to_vgroup" _BACKTRACE_TRIPLES "/root/repo/HDF4Examples/C/VG/CMakeLists.txt;46;add_test;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;140;ADD_H4_TEST;/root/repo/HDF4Examples/C/VG/CMakeLists.txt;0;")
@@ -0,0 +1,3 @@
+Lone vgroups in this file are:
+   Vgroup name SD Vgroup and class Common Vgroups
+   Vgroup name h4ex_VG_add_sds_to_vgroup.hdf and class CDF0.0
@@ -0,0 +1,17 @@
+
+Vgroup #0 contains:
+tag = 720, ref = 2  <-- neither vdata nor vgroup
+
+Vgroup #1 contains:
+tag = 1962, ref = 4  <-- is a vdata
+
+Vgroup #2 contains:
+tag = 1965, ref = 5  <-- is a vgroup
+tag = 1962, ref = 6  <-- is a vdata
+tag = 106, ref = 7  <-- neither vdata nor vgroup
+tag = 701, ref = 7  <-- neither vdata nor vgroup
+tag = 720, ref = 2  <-- neither vdata nor vgroup
+
+Vgroup #3 contains:
+tag = 1965, ref = 5  <-- is a vgroup
+tag = 1965, ref = 8  <-- is a vgroup
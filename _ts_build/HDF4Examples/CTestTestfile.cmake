@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/HDF4Examples
+# Build directory: /root/repo/_ts_build/HDF4Examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("C")
@@ -0,0 +1,223 @@
+/* hdf/src/h4config.h  Generated By CMake during the configuration  */
+
+#ifndef H4_CONFIG_H_
+#define H4_CONFIG_H_
+
+/* Define to dummy `main' function (if any) required to link to the Fortran
+   libraries. */
+/* #undef H4_F77_DUMMY_MAIN */
+
+/* Define to a macro mangling the given C identifier (in lower and upper
+   case), which must not contain underscores, for linking with Fortran. */
+#define H4_F77_FUNC(name,NAME) name ## _
+
+/* As F77_FUNC, but for C identifiers containing underscores. */
+#define H4_F77_FUNC_(name,NAME) name ## __
+
+/* Define to 1 if your Fortran compiler doesn't accept -c and -o together. */
+/* #undef H4_F77_NO_MINUS_C_MINUS_O */
+
+/* Define if F77 and FC dummy `main' functions are identical. */
+/* #undef H4_FC_DUMMY_MAIN_EQ_F77 */
+
+/* Define to 1 if you have the <arpa/inet.h> header file. */
+/* #undef H4_HAVE_ARPA_INET_H */
+
+/* Define to 1 if you have the <arpa/nameser.h> header file. */
+/* #undef H4_HAVE_ARPA_NAMESER_H */
+
+/* Define to 1 if you have the `clock_gettime' function. */
+#define H4_HAVE_CLOCK_GETTIME 1
+
+/* Define to 1 if you have the <dlfcn.h> header file. */
+#define H4_HAVE_DLFCN_H 1
+
+/* Define to 1 if you have the <fcntl.h> header file. */
+#define H4_HAVE_FCNTL_H 1
+
+/* Define to 1 if you have the `fork' function. */
+#define H4_HAVE_FORK 1
+
+/* Define to 1 if you have the `getrusage' function. */
+#define H4_HAVE_GETRUSAGE 1
+
+/* Define to 1 if you have the <winsock2.h> header file. */
+/* #undef H4_HAVE_WINSOCK2_H */
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define H4_HAVE_INTTYPES_H 1
+
+/* Define if io_uring is used for batched reads */
+#define H4_HAVE_IO_URING 1
+
+/* Define to 1 if you have the <io.h> header file. */
+/* #undef H4_HAVE_IO_H */
+
+/* Define to 1 if you have the <jpeglib.h> header file. */
+#define H4_HAVE_JPEGLIB_H 1
+
+/* Define to 1 if you have the `jpeg' library (-ljpeg). */
+#define H4_HAVE_LIBJPEG 1
+
+/* Define to 1 if you have the `sz' library (-lsz). */
+/* #undef H4_HAVE_LIBSZ */
+
+/* Define to 1 if you have the `z' library (-lz). */
+#define H4_HAVE_LIBZ 1
+
+/* Define to 1 if you have the <memory.h> header file. */
+#define H4_HAVE_MEMORY_H 1
+
+/* Define to 1 if you have the `mmap' function. */
+#define H4_HAVE_MMAP 1
+
+/* Define if we export HDF4-built unmangled netCDF 2.3.2 API calls */
+#define H4_HAVE_NETCDF 1
+
+/* Define to 1 if you have the <netdb.h> header file. */
+/* #undef H4_HAVE_NETDB_H */
+
+/* Define to 1 if you have the <netinet/in.h> header file. */
+#define H4_HAVE_NETINET_IN_H 1
+
+/* Define to 1 if you have the `pread' function. */
+#define H4_HAVE_PREAD 1
+
+/* Define to 1 if you have the `preadv' function. */
+#define H4_HAVE_PREADV 1
+
+/* Define to 1 if you have the `pwrite' function. */
+#define H4_HAVE_PWRITE 1
+
+/* Define if sequentially read files are read ahead in a background thread */
+#define H4_HAVE_READAHEAD 1
+
+/* Define if the library is built threadsafe */
+#define H4_HAVE_THREADSAFE 1
+
+/* Define if chunks are decompressed on a pool of worker threads */
+#define H4_HAVE_WORKER_THREADS 1
+
+/* Define to 1 if you have the <resolv.h> header file. */
+/* #undef H4_HAVE_RESOLV_H */
+
+/* Define to 1 if you have the <stddef.h> header file. */
+#define H4_HAVE_STDDEF_H 1
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define H4_HAVE_STDINT_H 1
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define H4_HAVE_STDLIB_H 1
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define H4_HAVE_STRINGS_H 1
+
+/* Define to 1 if you have the <string.h> header file. */
+#define H4_HAVE_STRING_H 1
+
+/* Define to 1 if you have the `system' function. */
+#define H4_HAVE_SYSTEM 1
+
+/* Define to 1 if you have the <sys/file.h> header file. */
+#define H4_HAVE_SYS_FILE_H 1
+
+/* Define to 1 if you have the <sys/mman.h> header file. */
+#define H4_HAVE_SYS_MMAN_H 1
+
+/* Define to 1 if you have the <sys/resource.h> header file. */
+#define H4_HAVE_SYS_RESOURCE_H 1
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define H4_HAVE_SYS_STAT_H 1
+
+/* Define to 1 if you have the <sys/time.h> header file. */
+#define H4_HAVE_SYS_TIME_H 1
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define H4_HAVE_SYS_TYPES_H 1
+
+/* Define to 1 if you have the <sys/uio.h> header file. */
+#define H4_HAVE_SYS_UIO_H 1
+
+/* Define to 1 if you have the <sys/wait.h> header file. */
+#define H4_HAVE_SYS_WAIT_H 1
+
+/* Define if szip has encoder */
+/* #undef H4_HAVE_SZIP_ENCODER */
+
+/* Define to 1 if you have the <szlib.h> header file. */
+/* #undef H4_HAVE_SZLIB_H */
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define H4_HAVE_UNISTD_H 1
+
+/* Define to 1 if you have the `wait' function. */
+/* #undef H4_HAVE_WAIT */
+
+/* Define to 1 if you use the WIN32_API. */
+/* #undef H4_HAVE_WIN32_API */
+
+/* Define to 1 if you have the <zlib.h> header file. */
+#define H4_HAVE_ZLIB_H 1
+
+/* Define to 1 if you have the `__builtin_bswap16' function. */
+/* #undef H4_HAVE___BUILTIN_BSWAP16 */
+
+/* Define to 1 if you have the `__builtin_bswap32' function. */
+/* #undef H4_HAVE___BUILTIN_BSWAP32 */
+
+/* Define to 1 if you have the `__builtin_bswap64' function. */
+/* #undef H4_HAVE___BUILTIN_BSWAP64 */
+
+/* Define to the sub-directory in which libtool stores uninstalled libraries.
+   */
+#define H4_LT_OBJDIR ""
+
+/* Define to 1 if your C compiler doesn't accept -c and -o together. */
+/* #undef H4_NO_MINUS_C_MINUS_O */
+
+/* Name of package */
+#define H4_PACKAGE "hdf4"
+
+/* Define to the address where bug reports for this package should be sent. */
+#define H4_PACKAGE_BUGREPORT "help@hdfgroup.org"
+
+/* Define to the full name of this package. */
+#define H4_PACKAGE_NAME "HDF"
+
+/* Define to the full name and version of this package. */
+#define H4_PACKAGE_STRING "HDF 4.3.0-1"
+
+/* Define to the one symbol short name of this package. */
+#define H4_PACKAGE_TARNAME "hdf4"
+
+/* Define to the home page for this package. */
+#define H4_PACKAGE_URL "http://www.hdfgroup.org"
+
+/* Define to the version of this package. */
+#define H4_PACKAGE_VERSION "4.3.0-1"
+
+/* The size of `long', as computed by sizeof. */
+#define H4_SIZEOF_LONG 8
+
+/* Define to 1 if all of the C90 standard headers exist (not just the ones
+   required in a freestanding environment). This macro is provided for
+   backward compatibility; new code need not use it. */
+#define H4_STDC_HEADERS 1
+
+/* Version number of package */
+#define H4_VERSION "4.3.0-1"
+
+/* Define WORDS_BIGENDIAN to 1 if your processor stores words with the most
+   significant byte first (like Motorola and SPARC, unlike Intel). */
+/* #undef H4_WORDS_BIGENDIAN */
+
+/* Define to 1 if `lex' declares `yytext' as a `char *' by default, not a
+   `char[]'. */
+/* #undef H4_YYTEXT_POINTER */
+
+/* Define to 1 if you don't have `vprintf' but do have `_doprnt.' */
+/* #undef H4_HAVE_DOPRNT */
+
+#endif
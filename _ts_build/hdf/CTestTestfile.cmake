@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hdf
+# Build directory: /root/repo/_ts_build/hdf
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("util")
+set_directory_properties(PROPERTIES LABELS "“HDF”")
@@ -0,0 +1,88 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hdf/src/arena.c" "hdf/src/CMakeFiles/hdf-shared.dir/arena.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/arena.c.o.d"
+  "/root/repo/hdf/src/atom.c" "hdf/src/CMakeFiles/hdf-shared.dir/atom.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/atom.c.o.d"
+  "/root/repo/hdf/src/bitvect.c" "hdf/src/CMakeFiles/hdf-shared.dir/bitvect.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/bitvect.c.o.d"
+  "/root/repo/hdf/src/cdeflate.c" "hdf/src/CMakeFiles/hdf-shared.dir/cdeflate.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/cdeflate.c.o.d"
+  "/root/repo/hdf/src/cnbit.c" "hdf/src/CMakeFiles/hdf-shared.dir/cnbit.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/cnbit.c.o.d"
+  "/root/repo/hdf/src/cnone.c" "hdf/src/CMakeFiles/hdf-shared.dir/cnone.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/cnone.c.o.d"
+  "/root/repo/hdf/src/crle.c" "hdf/src/CMakeFiles/hdf-shared.dir/crle.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/crle.c.o.d"
+  "/root/repo/hdf/src/cskphuff.c" "hdf/src/CMakeFiles/hdf-shared.dir/cskphuff.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/cskphuff.c.o.d"
+  "/root/repo/hdf/src/cszip.c" "hdf/src/CMakeFiles/hdf-shared.dir/cszip.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/cszip.c.o.d"
+  "/root/repo/hdf/src/df24.c" "hdf/src/CMakeFiles/hdf-shared.dir/df24.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/df24.c.o.d"
+  "/root/repo/hdf/src/dfan.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfan.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfan.c.o.d"
+  "/root/repo/hdf/src/dfcomp.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfcomp.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfcomp.c.o.d"
+  "/root/repo/hdf/src/dfconv.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfconv.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfconv.c.o.d"
+  "/root/repo/hdf/src/dfgr.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfgr.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfgr.c.o.d"
+  "/root/repo/hdf/src/dfgroup.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfgroup.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfgroup.c.o.d"
+  "/root/repo/hdf/src/dfimcomp.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfimcomp.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfimcomp.c.o.d"
+  "/root/repo/hdf/src/dfjpeg.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfjpeg.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfjpeg.c.o.d"
+  "/root/repo/hdf/src/dfknat.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfknat.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfknat.c.o.d"
+  "/root/repo/hdf/src/dfkswap.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfkswap.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfkswap.c.o.d"
+  "/root/repo/hdf/src/dfp.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfp.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfp.c.o.d"
+  "/root/repo/hdf/src/dfr8.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfr8.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfr8.c.o.d"
+  "/root/repo/hdf/src/dfrle.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfrle.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfrle.c.o.d"
+  "/root/repo/hdf/src/dfsd.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfsd.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfsd.c.o.d"
+  "/root/repo/hdf/src/dfstubs.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfstubs.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfstubs.c.o.d"
+  "/root/repo/hdf/src/dfufp2i.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfufp2i.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfufp2i.c.o.d"
+  "/root/repo/hdf/src/dfunjpeg.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfunjpeg.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfunjpeg.c.o.d"
+  "/root/repo/hdf/src/dfutil.c" "hdf/src/CMakeFiles/hdf-shared.dir/dfutil.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dfutil.c.o.d"
+  "/root/repo/hdf/src/dynarray.c" "hdf/src/CMakeFiles/hdf-shared.dir/dynarray.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/dynarray.c.o.d"
+  "/root/repo/hdf/src/glist.c" "hdf/src/CMakeFiles/hdf-shared.dir/glist.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/glist.c.o.d"
+  "/root/repo/hdf/src/hbitio.c" "hdf/src/CMakeFiles/hdf-shared.dir/hbitio.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hbitio.c.o.d"
+  "/root/repo/hdf/src/hblocks.c" "hdf/src/CMakeFiles/hdf-shared.dir/hblocks.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hblocks.c.o.d"
+  "/root/repo/hdf/src/hbuffer.c" "hdf/src/CMakeFiles/hdf-shared.dir/hbuffer.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hbuffer.c.o.d"
+  "/root/repo/hdf/src/hchunks.c" "hdf/src/CMakeFiles/hdf-shared.dir/hchunks.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hchunks.c.o.d"
+  "/root/repo/hdf/src/hcomp.c" "hdf/src/CMakeFiles/hdf-shared.dir/hcomp.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hcomp.c.o.d"
+  "/root/repo/hdf/src/hcompri.c" "hdf/src/CMakeFiles/hdf-shared.dir/hcompri.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hcompri.c.o.d"
+  "/root/repo/hdf/src/hdatainfo.c" "hdf/src/CMakeFiles/hdf-shared.dir/hdatainfo.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hdatainfo.c.o.d"
+  "/root/repo/hdf/src/hdfalloc.c" "hdf/src/CMakeFiles/hdf-shared.dir/hdfalloc.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hdfalloc.c.o.d"
+  "/root/repo/hdf/src/herr.c" "hdf/src/CMakeFiles/hdf-shared.dir/herr.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/herr.c.o.d"
+  "/root/repo/hdf/src/hextelt.c" "hdf/src/CMakeFiles/hdf-shared.dir/hextelt.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hextelt.c.o.d"
+  "/root/repo/hdf/src/hfile.c" "hdf/src/CMakeFiles/hdf-shared.dir/hfile.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hfile.c.o.d"
+  "/root/repo/hdf/src/hfiledd.c" "hdf/src/CMakeFiles/hdf-shared.dir/hfiledd.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hfiledd.c.o.d"
+  "/root/repo/hdf/src/hfiledrv.c" "hdf/src/CMakeFiles/hdf-shared.dir/hfiledrv.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hfiledrv.c.o.d"
+  "/root/repo/hdf/src/hfileidx.c" "hdf/src/CMakeFiles/hdf-shared.dir/hfileidx.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hfileidx.c.o.d"
+  "/root/repo/hdf/src/hfilera.c" "hdf/src/CMakeFiles/hdf-shared.dir/hfilera.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hfilera.c.o.d"
+  "/root/repo/hdf/src/hfilespace.c" "hdf/src/CMakeFiles/hdf-shared.dir/hfilespace.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hfilespace.c.o.d"
+  "/root/repo/hdf/src/hkit.c" "hdf/src/CMakeFiles/hdf-shared.dir/hkit.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hkit.c.o.d"
+  "/root/repo/hdf/src/hthread.c" "hdf/src/CMakeFiles/hdf-shared.dir/hthread.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hthread.c.o.d"
+  "/root/repo/hdf/src/hwpool.c" "hdf/src/CMakeFiles/hdf-shared.dir/hwpool.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/hwpool.c.o.d"
+  "/root/repo/hdf/src/linklist.c" "hdf/src/CMakeFiles/hdf-shared.dir/linklist.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/linklist.c.o.d"
+  "/root/repo/hdf/src/mcache.c" "hdf/src/CMakeFiles/hdf-shared.dir/mcache.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/mcache.c.o.d"
+  "/root/repo/hdf/src/mfan.c" "hdf/src/CMakeFiles/hdf-shared.dir/mfan.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/mfan.c.o.d"
+  "/root/repo/hdf/src/mfgr.c" "hdf/src/CMakeFiles/hdf-shared.dir/mfgr.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/mfgr.c.o.d"
+  "/root/repo/hdf/src/mstdio.c" "hdf/src/CMakeFiles/hdf-shared.dir/mstdio.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/mstdio.c.o.d"
+  "/root/repo/hdf/src/tbbt.c" "hdf/src/CMakeFiles/hdf-shared.dir/tbbt.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/tbbt.c.o.d"
+  "/root/repo/hdf/src/vattr.c" "hdf/src/CMakeFiles/hdf-shared.dir/vattr.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vattr.c.o.d"
+  "/root/repo/hdf/src/vconv.c" "hdf/src/CMakeFiles/hdf-shared.dir/vconv.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vconv.c.o.d"
+  "/root/repo/hdf/src/vg.c" "hdf/src/CMakeFiles/hdf-shared.dir/vg.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vg.c.o.d"
+  "/root/repo/hdf/src/vgp.c" "hdf/src/CMakeFiles/hdf-shared.dir/vgp.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vgp.c.o.d"
+  "/root/repo/hdf/src/vhi.c" "hdf/src/CMakeFiles/hdf-shared.dir/vhi.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vhi.c.o.d"
+  "/root/repo/hdf/src/vio.c" "hdf/src/CMakeFiles/hdf-shared.dir/vio.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vio.c.o.d"
+  "/root/repo/hdf/src/vparse.c" "hdf/src/CMakeFiles/hdf-shared.dir/vparse.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vparse.c.o.d"
+  "/root/repo/hdf/src/vrw.c" "hdf/src/CMakeFiles/hdf-shared.dir/vrw.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vrw.c.o.d"
+  "/root/repo/hdf/src/vsfld.c" "hdf/src/CMakeFiles/hdf-shared.dir/vsfld.c.o" "gcc" "hdf/src/CMakeFiles/hdf-shared.dir/vsfld.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ts_build/bin/libhdf.so" "/root/repo/_ts_build/bin/libhdf.so.4.0.3"
+  "/root/repo/_ts_build/bin/libhdf.so.4" "/root/repo/_ts_build/bin/libhdf.so.4.0.3"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,137 @@
+file(REMOVE_RECURSE
+  "../../bin/libhdf.pdb"
+  "../../bin/libhdf.so"
+  "../../bin/libhdf.so.4"
+  "../../bin/libhdf.so.4.0.3"
+  "CMakeFiles/hdf-shared.dir/arena.c.o"
+  "CMakeFiles/hdf-shared.dir/arena.c.o.d"
+  "CMakeFiles/hdf-shared.dir/atom.c.o"
+  "CMakeFiles/hdf-shared.dir/atom.c.o.d"
+  "CMakeFiles/hdf-shared.dir/bitvect.c.o"
+  "CMakeFiles/hdf-shared.dir/bitvect.c.o.d"
+  "CMakeFiles/hdf-shared.dir/cdeflate.c.o"
+  "CMakeFiles/hdf-shared.dir/cdeflate.c.o.d"
+  "CMakeFiles/hdf-shared.dir/cnbit.c.o"
+  "CMakeFiles/hdf-shared.dir/cnbit.c.o.d"
+  "CMakeFiles/hdf-shared.dir/cnone.c.o"
+  "CMakeFiles/hdf-shared.dir/cnone.c.o.d"
+  "CMakeFiles/hdf-shared.dir/crle.c.o"
+  "CMakeFiles/hdf-shared.dir/crle.c.o.d"
+  "CMakeFiles/hdf-shared.dir/cskphuff.c.o"
+  "CMakeFiles/hdf-shared.dir/cskphuff.c.o.d"
+  "CMakeFiles/hdf-shared.dir/cszip.c.o"
+  "CMakeFiles/hdf-shared.dir/cszip.c.o.d"
+  "CMakeFiles/hdf-shared.dir/df24.c.o"
+  "CMakeFiles/hdf-shared.dir/df24.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfan.c.o"
+  "CMakeFiles/hdf-shared.dir/dfan.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfcomp.c.o"
+  "CMakeFiles/hdf-shared.dir/dfcomp.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfconv.c.o"
+  "CMakeFiles/hdf-shared.dir/dfconv.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfgr.c.o"
+  "CMakeFiles/hdf-shared.dir/dfgr.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfgroup.c.o"
+  "CMakeFiles/hdf-shared.dir/dfgroup.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfimcomp.c.o"
+  "CMakeFiles/hdf-shared.dir/dfimcomp.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfjpeg.c.o"
+  "CMakeFiles/hdf-shared.dir/dfjpeg.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfknat.c.o"
+  "CMakeFiles/hdf-shared.dir/dfknat.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfkswap.c.o"
+  "CMakeFiles/hdf-shared.dir/dfkswap.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfp.c.o"
+  "CMakeFiles/hdf-shared.dir/dfp.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfr8.c.o"
+  "CMakeFiles/hdf-shared.dir/dfr8.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfrle.c.o"
+  "CMakeFiles/hdf-shared.dir/dfrle.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfsd.c.o"
+  "CMakeFiles/hdf-shared.dir/dfsd.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfstubs.c.o"
+  "CMakeFiles/hdf-shared.dir/dfstubs.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfufp2i.c.o"
+  "CMakeFiles/hdf-shared.dir/dfufp2i.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfunjpeg.c.o"
+  "CMakeFiles/hdf-shared.dir/dfunjpeg.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dfutil.c.o"
+  "CMakeFiles/hdf-shared.dir/dfutil.c.o.d"
+  "CMakeFiles/hdf-shared.dir/dynarray.c.o"
+  "CMakeFiles/hdf-shared.dir/dynarray.c.o.d"
+  "CMakeFiles/hdf-shared.dir/glist.c.o"
+  "CMakeFiles/hdf-shared.dir/glist.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hbitio.c.o"
+  "CMakeFiles/hdf-shared.dir/hbitio.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hblocks.c.o"
+  "CMakeFiles/hdf-shared.dir/hblocks.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hbuffer.c.o"
+  "CMakeFiles/hdf-shared.dir/hbuffer.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hchunks.c.o"
+  "CMakeFiles/hdf-shared.dir/hchunks.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hcomp.c.o"
+  "CMakeFiles/hdf-shared.dir/hcomp.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hcompri.c.o"
+  "CMakeFiles/hdf-shared.dir/hcompri.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hdatainfo.c.o"
+  "CMakeFiles/hdf-shared.dir/hdatainfo.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hdfalloc.c.o"
+  "CMakeFiles/hdf-shared.dir/hdfalloc.c.o.d"
+  "CMakeFiles/hdf-shared.dir/herr.c.o"
+  "CMakeFiles/hdf-shared.dir/herr.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hextelt.c.o"
+  "CMakeFiles/hdf-shared.dir/hextelt.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hfile.c.o"
+  "CMakeFiles/hdf-shared.dir/hfile.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hfiledd.c.o"
+  "CMakeFiles/hdf-shared.dir/hfiledd.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hfiledrv.c.o"
+  "CMakeFiles/hdf-shared.dir/hfiledrv.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hfileidx.c.o"
+  "CMakeFiles/hdf-shared.dir/hfileidx.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hfilera.c.o"
+  "CMakeFiles/hdf-shared.dir/hfilera.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hfilespace.c.o"
+  "CMakeFiles/hdf-shared.dir/hfilespace.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hkit.c.o"
+  "CMakeFiles/hdf-shared.dir/hkit.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hthread.c.o"
+  "CMakeFiles/hdf-shared.dir/hthread.c.o.d"
+  "CMakeFiles/hdf-shared.dir/hwpool.c.o"
+  "CMakeFiles/hdf-shared.dir/hwpool.c.o.d"
+  "CMakeFiles/hdf-shared.dir/linklist.c.o"
+  "CMakeFiles/hdf-shared.dir/linklist.c.o.d"
+  "CMakeFiles/hdf-shared.dir/mcache.c.o"
+  "CMakeFiles/hdf-shared.dir/mcache.c.o.d"
+  "CMakeFiles/hdf-shared.dir/mfan.c.o"
+  "CMakeFiles/hdf-shared.dir/mfan.c.o.d"
+  "CMakeFiles/hdf-shared.dir/mfgr.c.o"
+  "CMakeFiles/hdf-shared.dir/mfgr.c.o.d"
+  "CMakeFiles/hdf-shared.dir/mstdio.c.o"
+  "CMakeFiles/hdf-shared.dir/mstdio.c.o.d"
+  "CMakeFiles/hdf-shared.dir/tbbt.c.o"
+  "CMakeFiles/hdf-shared.dir/tbbt.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vattr.c.o"
+  "CMakeFiles/hdf-shared.dir/vattr.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vconv.c.o"
+  "CMakeFiles/hdf-shared.dir/vconv.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vg.c.o"
+  "CMakeFiles/hdf-shared.dir/vg.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vgp.c.o"
+  "CMakeFiles/hdf-shared.dir/vgp.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vhi.c.o"
+  "CMakeFiles/hdf-shared.dir/vhi.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vio.c.o"
+  "CMakeFiles/hdf-shared.dir/vio.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vparse.c.o"
+  "CMakeFiles/hdf-shared.dir/vparse.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vrw.c.o"
+  "CMakeFiles/hdf-shared.dir/vrw.c.o.d"
+  "CMakeFiles/hdf-shared.dir/vsfld.c.o"
+  "CMakeFiles/hdf-shared.dir/vsfld.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
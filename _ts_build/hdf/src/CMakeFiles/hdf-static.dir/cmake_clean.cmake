@@ -0,0 +1,135 @@
+file(REMOVE_RECURSE
+  "../../bin/libhdf.a"
+  "../../bin/libhdf.pdb"
+  "CMakeFiles/hdf-static.dir/arena.c.o"
+  "CMakeFiles/hdf-static.dir/arena.c.o.d"
+  "CMakeFiles/hdf-static.dir/atom.c.o"
+  "CMakeFiles/hdf-static.dir/atom.c.o.d"
+  "CMakeFiles/hdf-static.dir/bitvect.c.o"
+  "CMakeFiles/hdf-static.dir/bitvect.c.o.d"
+  "CMakeFiles/hdf-static.dir/cdeflate.c.o"
+  "CMakeFiles/hdf-static.dir/cdeflate.c.o.d"
+  "CMakeFiles/hdf-static.dir/cnbit.c.o"
+  "CMakeFiles/hdf-static.dir/cnbit.c.o.d"
+  "CMakeFiles/hdf-static.dir/cnone.c.o"
+  "CMakeFiles/hdf-static.dir/cnone.c.o.d"
+  "CMakeFiles/hdf-static.dir/crle.c.o"
+  "CMakeFiles/hdf-static.dir/crle.c.o.d"
+  "CMakeFiles/hdf-static.dir/cskphuff.c.o"
+  "CMakeFiles/hdf-static.dir/cskphuff.c.o.d"
+  "CMakeFiles/hdf-static.dir/cszip.c.o"
+  "CMakeFiles/hdf-static.dir/cszip.c.o.d"
+  "CMakeFiles/hdf-static.dir/df24.c.o"
+  "CMakeFiles/hdf-static.dir/df24.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfan.c.o"
+  "CMakeFiles/hdf-static.dir/dfan.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfcomp.c.o"
+  "CMakeFiles/hdf-static.dir/dfcomp.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfconv.c.o"
+  "CMakeFiles/hdf-static.dir/dfconv.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfgr.c.o"
+  "CMakeFiles/hdf-static.dir/dfgr.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfgroup.c.o"
+  "CMakeFiles/hdf-static.dir/dfgroup.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfimcomp.c.o"
+  "CMakeFiles/hdf-static.dir/dfimcomp.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfjpeg.c.o"
+  "CMakeFiles/hdf-static.dir/dfjpeg.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfknat.c.o"
+  "CMakeFiles/hdf-static.dir/dfknat.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfkswap.c.o"
+  "CMakeFiles/hdf-static.dir/dfkswap.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfp.c.o"
+  "CMakeFiles/hdf-static.dir/dfp.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfr8.c.o"
+  "CMakeFiles/hdf-static.dir/dfr8.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfrle.c.o"
+  "CMakeFiles/hdf-static.dir/dfrle.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfsd.c.o"
+  "CMakeFiles/hdf-static.dir/dfsd.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfstubs.c.o"
+  "CMakeFiles/hdf-static.dir/dfstubs.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfufp2i.c.o"
+  "CMakeFiles/hdf-static.dir/dfufp2i.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfunjpeg.c.o"
+  "CMakeFiles/hdf-static.dir/dfunjpeg.c.o.d"
+  "CMakeFiles/hdf-static.dir/dfutil.c.o"
+  "CMakeFiles/hdf-static.dir/dfutil.c.o.d"
+  "CMakeFiles/hdf-static.dir/dynarray.c.o"
+  "CMakeFiles/hdf-static.dir/dynarray.c.o.d"
+  "CMakeFiles/hdf-static.dir/glist.c.o"
+  "CMakeFiles/hdf-static.dir/glist.c.o.d"
+  "CMakeFiles/hdf-static.dir/hbitio.c.o"
+  "CMakeFiles/hdf-static.dir/hbitio.c.o.d"
+  "CMakeFiles/hdf-static.dir/hblocks.c.o"
+  "CMakeFiles/hdf-static.dir/hblocks.c.o.d"
+  "CMakeFiles/hdf-static.dir/hbuffer.c.o"
+  "CMakeFiles/hdf-static.dir/hbuffer.c.o.d"
+  "CMakeFiles/hdf-static.dir/hchunks.c.o"
+  "CMakeFiles/hdf-static.dir/hchunks.c.o.d"
+  "CMakeFiles/hdf-static.dir/hcomp.c.o"
+  "CMakeFiles/hdf-static.dir/hcomp.c.o.d"
+  "CMakeFiles/hdf-static.dir/hcompri.c.o"
+  "CMakeFiles/hdf-static.dir/hcompri.c.o.d"
+  "CMakeFiles/hdf-static.dir/hdatainfo.c.o"
+  "CMakeFiles/hdf-static.dir/hdatainfo.c.o.d"
+  "CMakeFiles/hdf-static.dir/hdfalloc.c.o"
+  "CMakeFiles/hdf-static.dir/hdfalloc.c.o.d"
+  "CMakeFiles/hdf-static.dir/herr.c.o"
+  "CMakeFiles/hdf-static.dir/herr.c.o.d"
+  "CMakeFiles/hdf-static.dir/hextelt.c.o"
+  "CMakeFiles/hdf-static.dir/hextelt.c.o.d"
+  "CMakeFiles/hdf-static.dir/hfile.c.o"
+  "CMakeFiles/hdf-static.dir/hfile.c.o.d"
+  "CMakeFiles/hdf-static.dir/hfiledd.c.o"
+  "CMakeFiles/hdf-static.dir/hfiledd.c.o.d"
+  "CMakeFiles/hdf-static.dir/hfiledrv.c.o"
+  "CMakeFiles/hdf-static.dir/hfiledrv.c.o.d"
+  "CMakeFiles/hdf-static.dir/hfileidx.c.o"
+  "CMakeFiles/hdf-static.dir/hfileidx.c.o.d"
+  "CMakeFiles/hdf-static.dir/hfilera.c.o"
+  "CMakeFiles/hdf-static.dir/hfilera.c.o.d"
+  "CMakeFiles/hdf-static.dir/hfilespace.c.o"
+  "CMakeFiles/hdf-static.dir/hfilespace.c.o.d"
+  "CMakeFiles/hdf-static.dir/hkit.c.o"
+  "CMakeFiles/hdf-static.dir/hkit.c.o.d"
+  "CMakeFiles/hdf-static.dir/hthread.c.o"
+  "CMakeFiles/hdf-static.dir/hthread.c.o.d"
+  "CMakeFiles/hdf-static.dir/hwpool.c.o"
+  "CMakeFiles/hdf-static.dir/hwpool.c.o.d"
+  "CMakeFiles/hdf-static.dir/linklist.c.o"
+  "CMakeFiles/hdf-static.dir/linklist.c.o.d"
+  "CMakeFiles/hdf-static.dir/mcache.c.o"
+  "CMakeFiles/hdf-static.dir/mcache.c.o.d"
+  "CMakeFiles/hdf-static.dir/mfan.c.o"
+  "CMakeFiles/hdf-static.dir/mfan.c.o.d"
+  "CMakeFiles/hdf-static.dir/mfgr.c.o"
+  "CMakeFiles/hdf-static.dir/mfgr.c.o.d"
+  "CMakeFiles/hdf-static.dir/mstdio.c.o"
+  "CMakeFiles/hdf-static.dir/mstdio.c.o.d"
+  "CMakeFiles/hdf-static.dir/tbbt.c.o"
+  "CMakeFiles/hdf-static.dir/tbbt.c.o.d"
+  "CMakeFiles/hdf-static.dir/vattr.c.o"
+  "CMakeFiles/hdf-static.dir/vattr.c.o.d"
+  "CMakeFiles/hdf-static.dir/vconv.c.o"
+  "CMakeFiles/hdf-static.dir/vconv.c.o.d"
+  "CMakeFiles/hdf-static.dir/vg.c.o"
+  "CMakeFiles/hdf-static.dir/vg.c.o.d"
+  "CMakeFiles/hdf-static.dir/vgp.c.o"
+  "CMakeFiles/hdf-static.dir/vgp.c.o.d"
+  "CMakeFiles/hdf-static.dir/vhi.c.o"
+  "CMakeFiles/hdf-static.dir/vhi.c.o.d"
+  "CMakeFiles/hdf-static.dir/vio.c.o"
+  "CMakeFiles/hdf-static.dir/vio.c.o.d"
+  "CMakeFiles/hdf-static.dir/vparse.c.o"
+  "CMakeFiles/hdf-static.dir/vparse.c.o.d"
+  "CMakeFiles/hdf-static.dir/vrw.c.o"
+  "CMakeFiles/hdf-static.dir/vrw.c.o.d"
+  "CMakeFiles/hdf-static.dir/vsfld.c.o"
+  "CMakeFiles/hdf-static.dir/vsfld.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/atombench"
+  "../../bin/atombench.pdb"
+  "CMakeFiles/atombench.dir/atombench.c.o"
+  "CMakeFiles/atombench.dir/atombench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/atombench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
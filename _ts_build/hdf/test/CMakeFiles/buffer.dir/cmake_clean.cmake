@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/buffer"
+  "../../bin/buffer.pdb"
+  "CMakeFiles/buffer.dir/buffer.c.o"
+  "CMakeFiles/buffer.dir/buffer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
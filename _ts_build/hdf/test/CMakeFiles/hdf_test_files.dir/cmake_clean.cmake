@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdf_test_files"
+  "TEST/test_files/8bit.dat"
+  "TEST/test_files/bitio.dat"
+  "TEST/test_files/gr_r24.dat"
+  "TEST/test_files/greyjpeg.dat"
+  "TEST/test_files/grtdfui83.hdf"
+  "TEST/test_files/jpeg.dat"
+  "TEST/test_files/litend.dat"
+  "TEST/test_files/nbit.dat"
+  "TEST/test_files/tmgr.dat"
+  "TEST/test_files/tvattr.dat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/hdf_test_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/openbench"
+  "../../bin/openbench.pdb"
+  "CMakeFiles/openbench.dir/openbench.c.o"
+  "CMakeFiles/openbench.dir/openbench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/openbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
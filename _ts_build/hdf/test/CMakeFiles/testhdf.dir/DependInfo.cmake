@@ -0,0 +1,57 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hdf/test/an.c" "hdf/test/CMakeFiles/testhdf.dir/an.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/an.c.o.d"
+  "/root/repo/hdf/test/anfile.c" "hdf/test/CMakeFiles/testhdf.dir/anfile.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/anfile.c.o.d"
+  "/root/repo/hdf/test/bitio.c" "hdf/test/CMakeFiles/testhdf.dir/bitio.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/bitio.c.o.d"
+  "/root/repo/hdf/test/blocks.c" "hdf/test/CMakeFiles/testhdf.dir/blocks.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/blocks.c.o.d"
+  "/root/repo/hdf/test/chunks.c" "hdf/test/CMakeFiles/testhdf.dir/chunks.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/chunks.c.o.d"
+  "/root/repo/hdf/test/comp.c" "hdf/test/CMakeFiles/testhdf.dir/comp.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/comp.c.o.d"
+  "/root/repo/hdf/test/conv.c" "hdf/test/CMakeFiles/testhdf.dir/conv.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/conv.c.o.d"
+  "/root/repo/hdf/test/extelt.c" "hdf/test/CMakeFiles/testhdf.dir/extelt.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/extelt.c.o.d"
+  "/root/repo/hdf/test/file.c" "hdf/test/CMakeFiles/testhdf.dir/file.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/file.c.o.d"
+  "/root/repo/hdf/test/file1.c" "hdf/test/CMakeFiles/testhdf.dir/file1.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/file1.c.o.d"
+  "/root/repo/hdf/test/litend.c" "hdf/test/CMakeFiles/testhdf.dir/litend.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/litend.c.o.d"
+  "/root/repo/hdf/test/macros.c" "hdf/test/CMakeFiles/testhdf.dir/macros.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/macros.c.o.d"
+  "/root/repo/hdf/test/man.c" "hdf/test/CMakeFiles/testhdf.dir/man.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/man.c.o.d"
+  "/root/repo/hdf/test/mgr.c" "hdf/test/CMakeFiles/testhdf.dir/mgr.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/mgr.c.o.d"
+  "/root/repo/hdf/test/nbit.c" "hdf/test/CMakeFiles/testhdf.dir/nbit.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/nbit.c.o.d"
+  "/root/repo/hdf/test/rig.c" "hdf/test/CMakeFiles/testhdf.dir/rig.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/rig.c.o.d"
+  "/root/repo/hdf/test/sdmms.c" "hdf/test/CMakeFiles/testhdf.dir/sdmms.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/sdmms.c.o.d"
+  "/root/repo/hdf/test/sdnmms.c" "hdf/test/CMakeFiles/testhdf.dir/sdnmms.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/sdnmms.c.o.d"
+  "/root/repo/hdf/test/sdstr.c" "hdf/test/CMakeFiles/testhdf.dir/sdstr.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/sdstr.c.o.d"
+  "/root/repo/hdf/test/slab.c" "hdf/test/CMakeFiles/testhdf.dir/slab.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/slab.c.o.d"
+  "/root/repo/hdf/test/tattdatainfo.c" "hdf/test/CMakeFiles/testhdf.dir/tattdatainfo.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tattdatainfo.c.o.d"
+  "/root/repo/hdf/test/tbv.c" "hdf/test/CMakeFiles/testhdf.dir/tbv.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tbv.c.o.d"
+  "/root/repo/hdf/test/tdatainfo.c" "hdf/test/CMakeFiles/testhdf.dir/tdatainfo.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tdatainfo.c.o.d"
+  "/root/repo/hdf/test/tdfr8.c" "hdf/test/CMakeFiles/testhdf.dir/tdfr8.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tdfr8.c.o.d"
+  "/root/repo/hdf/test/tdupimgs.c" "hdf/test/CMakeFiles/testhdf.dir/tdupimgs.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tdupimgs.c.o.d"
+  "/root/repo/hdf/test/testhdf.c" "hdf/test/CMakeFiles/testhdf.dir/testhdf.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/testhdf.c.o.d"
+  "/root/repo/hdf/test/tfiledrv.c" "hdf/test/CMakeFiles/testhdf.dir/tfiledrv.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tfiledrv.c.o.d"
+  "/root/repo/hdf/test/tmgrattr.c" "hdf/test/CMakeFiles/testhdf.dir/tmgrattr.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tmgrattr.c.o.d"
+  "/root/repo/hdf/test/tmgrcomp.c" "hdf/test/CMakeFiles/testhdf.dir/tmgrcomp.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tmgrcomp.c.o.d"
+  "/root/repo/hdf/test/tree.c" "hdf/test/CMakeFiles/testhdf.dir/tree.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tree.c.o.d"
+  "/root/repo/hdf/test/tszip.c" "hdf/test/CMakeFiles/testhdf.dir/tszip.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tszip.c.o.d"
+  "/root/repo/hdf/test/tusejpegfuncs.c" "hdf/test/CMakeFiles/testhdf.dir/tusejpegfuncs.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tusejpegfuncs.c.o.d"
+  "/root/repo/hdf/test/tutils.c" "hdf/test/CMakeFiles/testhdf.dir/tutils.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tutils.c.o.d"
+  "/root/repo/hdf/test/tvattr.c" "hdf/test/CMakeFiles/testhdf.dir/tvattr.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tvattr.c.o.d"
+  "/root/repo/hdf/test/tvnameclass.c" "hdf/test/CMakeFiles/testhdf.dir/tvnameclass.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tvnameclass.c.o.d"
+  "/root/repo/hdf/test/tvset.c" "hdf/test/CMakeFiles/testhdf.dir/tvset.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tvset.c.o.d"
+  "/root/repo/hdf/test/tvsfpack.c" "hdf/test/CMakeFiles/testhdf.dir/tvsfpack.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/tvsfpack.c.o.d"
+  "/root/repo/hdf/test/vers.c" "hdf/test/CMakeFiles/testhdf.dir/vers.c.o" "gcc" "hdf/test/CMakeFiles/testhdf.dir/vers.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,85 @@
+file(REMOVE_RECURSE
+  "../../bin/testhdf"
+  "../../bin/testhdf.pdb"
+  "CMakeFiles/testhdf.dir/an.c.o"
+  "CMakeFiles/testhdf.dir/an.c.o.d"
+  "CMakeFiles/testhdf.dir/anfile.c.o"
+  "CMakeFiles/testhdf.dir/anfile.c.o.d"
+  "CMakeFiles/testhdf.dir/bitio.c.o"
+  "CMakeFiles/testhdf.dir/bitio.c.o.d"
+  "CMakeFiles/testhdf.dir/blocks.c.o"
+  "CMakeFiles/testhdf.dir/blocks.c.o.d"
+  "CMakeFiles/testhdf.dir/chunks.c.o"
+  "CMakeFiles/testhdf.dir/chunks.c.o.d"
+  "CMakeFiles/testhdf.dir/comp.c.o"
+  "CMakeFiles/testhdf.dir/comp.c.o.d"
+  "CMakeFiles/testhdf.dir/conv.c.o"
+  "CMakeFiles/testhdf.dir/conv.c.o.d"
+  "CMakeFiles/testhdf.dir/extelt.c.o"
+  "CMakeFiles/testhdf.dir/extelt.c.o.d"
+  "CMakeFiles/testhdf.dir/file.c.o"
+  "CMakeFiles/testhdf.dir/file.c.o.d"
+  "CMakeFiles/testhdf.dir/file1.c.o"
+  "CMakeFiles/testhdf.dir/file1.c.o.d"
+  "CMakeFiles/testhdf.dir/litend.c.o"
+  "CMakeFiles/testhdf.dir/litend.c.o.d"
+  "CMakeFiles/testhdf.dir/macros.c.o"
+  "CMakeFiles/testhdf.dir/macros.c.o.d"
+  "CMakeFiles/testhdf.dir/man.c.o"
+  "CMakeFiles/testhdf.dir/man.c.o.d"
+  "CMakeFiles/testhdf.dir/mgr.c.o"
+  "CMakeFiles/testhdf.dir/mgr.c.o.d"
+  "CMakeFiles/testhdf.dir/nbit.c.o"
+  "CMakeFiles/testhdf.dir/nbit.c.o.d"
+  "CMakeFiles/testhdf.dir/rig.c.o"
+  "CMakeFiles/testhdf.dir/rig.c.o.d"
+  "CMakeFiles/testhdf.dir/sdmms.c.o"
+  "CMakeFiles/testhdf.dir/sdmms.c.o.d"
+  "CMakeFiles/testhdf.dir/sdnmms.c.o"
+  "CMakeFiles/testhdf.dir/sdnmms.c.o.d"
+  "CMakeFiles/testhdf.dir/sdstr.c.o"
+  "CMakeFiles/testhdf.dir/sdstr.c.o.d"
+  "CMakeFiles/testhdf.dir/slab.c.o"
+  "CMakeFiles/testhdf.dir/slab.c.o.d"
+  "CMakeFiles/testhdf.dir/tattdatainfo.c.o"
+  "CMakeFiles/testhdf.dir/tattdatainfo.c.o.d"
+  "CMakeFiles/testhdf.dir/tbv.c.o"
+  "CMakeFiles/testhdf.dir/tbv.c.o.d"
+  "CMakeFiles/testhdf.dir/tdatainfo.c.o"
+  "CMakeFiles/testhdf.dir/tdatainfo.c.o.d"
+  "CMakeFiles/testhdf.dir/tdfr8.c.o"
+  "CMakeFiles/testhdf.dir/tdfr8.c.o.d"
+  "CMakeFiles/testhdf.dir/tdupimgs.c.o"
+  "CMakeFiles/testhdf.dir/tdupimgs.c.o.d"
+  "CMakeFiles/testhdf.dir/testhdf.c.o"
+  "CMakeFiles/testhdf.dir/testhdf.c.o.d"
+  "CMakeFiles/testhdf.dir/tfiledrv.c.o"
+  "CMakeFiles/testhdf.dir/tfiledrv.c.o.d"
+  "CMakeFiles/testhdf.dir/tmgrattr.c.o"
+  "CMakeFiles/testhdf.dir/tmgrattr.c.o.d"
+  "CMakeFiles/testhdf.dir/tmgrcomp.c.o"
+  "CMakeFiles/testhdf.dir/tmgrcomp.c.o.d"
+  "CMakeFiles/testhdf.dir/tree.c.o"
+  "CMakeFiles/testhdf.dir/tree.c.o.d"
+  "CMakeFiles/testhdf.dir/tszip.c.o"
+  "CMakeFiles/testhdf.dir/tszip.c.o.d"
+  "CMakeFiles/testhdf.dir/tusejpegfuncs.c.o"
+  "CMakeFiles/testhdf.dir/tusejpegfuncs.c.o.d"
+  "CMakeFiles/testhdf.dir/tutils.c.o"
+  "CMakeFiles/testhdf.dir/tutils.c.o.d"
+  "CMakeFiles/testhdf.dir/tvattr.c.o"
+  "CMakeFiles/testhdf.dir/tvattr.c.o.d"
+  "CMakeFiles/testhdf.dir/tvnameclass.c.o"
+  "CMakeFiles/testhdf.dir/tvnameclass.c.o.d"
+  "CMakeFiles/testhdf.dir/tvset.c.o"
+  "CMakeFiles/testhdf.dir/tvset.c.o.d"
+  "CMakeFiles/testhdf.dir/tvsfpack.c.o"
+  "CMakeFiles/testhdf.dir/tvsfpack.c.o.d"
+  "CMakeFiles/testhdf.dir/vers.c.o"
+  "CMakeFiles/testhdf.dir/vers.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testhdf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/treebench"
+  "../../bin/treebench.pdb"
+  "CMakeFiles/treebench.dir/treebench.c.o"
+  "CMakeFiles/treebench.dir/treebench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/treebench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,140 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hdf/test
+# Build directory: /root/repo/_ts_build/hdf/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HDF_TEST-testhdf-clearall-objects "/usr/bin/cmake" "-E" "remove" "Block_info.hdf" "ChunkedGR.hdf" "ChunkedGR_DF.hdf" "ChunkedGR_NO.hdf" "ChunkedGR_RL.hdf" "ChunkedGR_SK.hdf" "datainfo_annot.hdf" "datainfo_dfri.hdf" "datainfo_images.hdf" "datainfo_linkblock.hdf" "datainfo_simple.hdf" "gr2.hdf" "gr_chunkcomp.hdf" "gr_comp.hdf" "gr_double_test.hdf" "gr_gzip.hdf" "gr_jpeg.hdf" "gr_r8.hdf" "nntcheck.hdf" "ntcheck.hdf" "RI_8.hdf" "RI_16.hdf" "RI_32.hdf" "RI_fl32.hdf" "RI_fl64.hdf" "RIchunkedziped.hdf" "s1w.hdf" "s3w.hdf" "s4w.hdf" "sdstrings.hdf" "swf32.hdf" "swf64.hdf" "swi8.hdf" "swi16.hdf" "swi32.hdf" "swin.hdf" "swui8.hdf" "swui16.hdf" "swui32.hdf" "swuin.hdf" "t.hdf" "t1.hdf" "t2.hdf" "t3.hdf" "t4.hdf" "tbitio.hdf" "tblocks.hdf" "tchunks.hdf" "tcomp.hdf" "tdf24.hdf" "tdfan.hdf" "tfiledrv.hdf" "tfind.hdf" "tcompact.hdf" "tspace.hdf" "tsync.hdf" "temp.hdf" "thf.hdf" "tjpeg.hdf" "tlongnames.hdf" "tman.hdf" "tmgr.hdf" "tmgratt.hdf" "tmgrchk.hdf" "tnbit.hdf" "tnewref.hdf" "tref.hdf" "tuservds.hdf" "tuservgs.hdf" "tvattr.hdf" "tvpack.hdf" "tvsempty.hdf" "tvset.hdf" "tvsetext.hdf" "tx.hdf" "Tables_External_File")
+set_tests_properties(HDF_TEST-testhdf-clearall-objects PROPERTIES  FIXTURES_SETUP "clear_HDF_TEST" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;110;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf0-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf0.hdf" "thf1.hdf" "thf2.hdf" "thf3.hdf" "thf4.hdf" "thf5.hdf" "thf6.hdf" "thf7.hdf" "thf8.hdf" "thf9.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf0-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf-clearall-objects" FIXTURES_REQUIRED "clear_HDF_TEST" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;136;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf1-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf10.hdf" "thf11.hdf" "thf12.hdf" "thf13.hdf" "thf14.hdf" "thf15.hdf" "thf16.hdf" "thf17.hdf" "thf18.hdf" "thf19.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf1-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf0-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf2-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf20.hdf" "thf21.hdf" "thf22.hdf" "thf23.hdf" "thf24.hdf" "thf25.hdf" "thf26.hdf" "thf27.hdf" "thf28.hdf" "thf29.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf2-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf1-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf3-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf30.hdf" "thf31.hdf" "thf32.hdf" "thf33.hdf" "thf34.hdf" "thf35.hdf" "thf36.hdf" "thf37.hdf" "thf38.hdf" "thf39.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf3-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf2-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf4-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf40.hdf" "thf41.hdf" "thf42.hdf" "thf43.hdf" "thf44.hdf" "thf45.hdf" "thf46.hdf" "thf47.hdf" "thf48.hdf" "thf49.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf4-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf3-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf5-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf50.hdf" "thf51.hdf" "thf52.hdf" "thf53.hdf" "thf54.hdf" "thf55.hdf" "thf56.hdf" "thf57.hdf" "thf58.hdf" "thf59.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf5-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf4-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf6-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf60.hdf" "thf61.hdf" "thf62.hdf" "thf63.hdf" "thf64.hdf" "thf65.hdf" "thf66.hdf" "thf67.hdf" "thf68.hdf" "thf69.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf6-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf5-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf7-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf70.hdf" "thf71.hdf" "thf72.hdf" "thf73.hdf" "thf74.hdf" "thf75.hdf" "thf76.hdf" "thf77.hdf" "thf78.hdf" "thf79.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf7-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf6-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf8-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf80.hdf" "thf81.hdf" "thf82.hdf" "thf83.hdf" "thf84.hdf" "thf85.hdf" "thf86.hdf" "thf87.hdf" "thf88.hdf" "thf89.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf8-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf7-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf9-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf90.hdf" "thf91.hdf" "thf92.hdf" "thf93.hdf" "thf94.hdf" "thf95.hdf" "thf96.hdf" "thf97.hdf" "thf98.hdf" "thf99.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf9-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf8-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf10-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf100.hdf" "thf101.hdf" "thf102.hdf" "thf103.hdf" "thf104.hdf" "thf105.hdf" "thf106.hdf" "thf107.hdf" "thf108.hdf" "thf109.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf10-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf9-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf11-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf110.hdf" "thf111.hdf" "thf112.hdf" "thf113.hdf" "thf114.hdf" "thf115.hdf" "thf116.hdf" "thf117.hdf" "thf118.hdf" "thf119.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf11-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf10-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf12-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf120.hdf" "thf121.hdf" "thf122.hdf" "thf123.hdf" "thf124.hdf" "thf125.hdf" "thf126.hdf" "thf127.hdf" "thf128.hdf" "thf129.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf12-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf11-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf13-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf130.hdf" "thf131.hdf" "thf132.hdf" "thf133.hdf" "thf134.hdf" "thf135.hdf" "thf136.hdf" "thf137.hdf" "thf138.hdf" "thf139.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf13-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf12-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf14-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf140.hdf" "thf141.hdf" "thf142.hdf" "thf143.hdf" "thf144.hdf" "thf145.hdf" "thf146.hdf" "thf147.hdf" "thf148.hdf" "thf149.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf14-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf13-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf15-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf150.hdf" "thf151.hdf" "thf152.hdf" "thf153.hdf" "thf154.hdf" "thf155.hdf" "thf156.hdf" "thf157.hdf" "thf158.hdf" "thf159.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf15-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf14-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf16-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf160.hdf" "thf161.hdf" "thf162.hdf" "thf163.hdf" "thf164.hdf" "thf165.hdf" "thf166.hdf" "thf167.hdf" "thf168.hdf" "thf169.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf16-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf15-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf17-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf170.hdf" "thf171.hdf" "thf172.hdf" "thf173.hdf" "thf174.hdf" "thf175.hdf" "thf176.hdf" "thf177.hdf" "thf178.hdf" "thf179.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf17-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf16-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf18-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf180.hdf" "thf181.hdf" "thf182.hdf" "thf183.hdf" "thf184.hdf" "thf185.hdf" "thf186.hdf" "thf187.hdf" "thf188.hdf" "thf189.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf18-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf17-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf19-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf190.hdf" "thf191.hdf" "thf192.hdf" "thf193.hdf" "thf194.hdf" "thf195.hdf" "thf196.hdf" "thf197.hdf" "thf198.hdf" "thf199.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf19-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf18-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf20-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf200.hdf" "thf201.hdf" "thf202.hdf" "thf203.hdf" "thf204.hdf" "thf205.hdf" "thf206.hdf" "thf207.hdf" "thf208.hdf" "thf209.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf20-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf19-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf21-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf210.hdf" "thf211.hdf" "thf212.hdf" "thf213.hdf" "thf214.hdf" "thf215.hdf" "thf216.hdf" "thf217.hdf" "thf218.hdf" "thf219.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf21-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf20-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf22-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf220.hdf" "thf221.hdf" "thf222.hdf" "thf223.hdf" "thf224.hdf" "thf225.hdf" "thf226.hdf" "thf227.hdf" "thf228.hdf" "thf229.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf22-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf21-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf23-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf230.hdf" "thf231.hdf" "thf232.hdf" "thf233.hdf" "thf234.hdf" "thf235.hdf" "thf236.hdf" "thf237.hdf" "thf238.hdf" "thf239.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf23-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf22-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf24-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf240.hdf" "thf241.hdf" "thf242.hdf" "thf243.hdf" "thf244.hdf" "thf245.hdf" "thf246.hdf" "thf247.hdf" "thf248.hdf" "thf249.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf24-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf23-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf25-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf250.hdf" "thf251.hdf" "thf252.hdf" "thf253.hdf" "thf254.hdf" "thf255.hdf" "thf256.hdf" "thf257.hdf" "thf258.hdf" "thf259.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf25-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf24-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf26-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf260.hdf" "thf261.hdf" "thf262.hdf" "thf263.hdf" "thf264.hdf" "thf265.hdf" "thf266.hdf" "thf267.hdf" "thf268.hdf" "thf269.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf26-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf25-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf27-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf270.hdf" "thf271.hdf" "thf272.hdf" "thf273.hdf" "thf274.hdf" "thf275.hdf" "thf276.hdf" "thf277.hdf" "thf278.hdf" "thf279.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf27-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf26-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf28-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf280.hdf" "thf281.hdf" "thf282.hdf" "thf283.hdf" "thf284.hdf" "thf285.hdf" "thf286.hdf" "thf287.hdf" "thf288.hdf" "thf289.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf28-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf27-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf29-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf290.hdf" "thf291.hdf" "thf292.hdf" "thf293.hdf" "thf294.hdf" "thf295.hdf" "thf296.hdf" "thf297.hdf" "thf298.hdf" "thf299.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf29-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf28-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf30-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf300.hdf" "thf301.hdf" "thf302.hdf" "thf303.hdf" "thf304.hdf" "thf305.hdf" "thf306.hdf" "thf307.hdf" "thf308.hdf" "thf309.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf30-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf29-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf31-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf310.hdf" "thf311.hdf" "thf312.hdf" "thf313.hdf" "thf314.hdf" "thf315.hdf" "thf316.hdf" "thf317.hdf" "thf318.hdf" "thf319.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf31-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf30-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf32-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf320.hdf" "thf321.hdf" "thf322.hdf" "thf323.hdf" "thf324.hdf" "thf325.hdf" "thf326.hdf" "thf327.hdf" "thf328.hdf" "thf329.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf32-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf31-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf33-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf330.hdf" "thf331.hdf" "thf332.hdf" "thf333.hdf" "thf334.hdf" "thf335.hdf" "thf336.hdf" "thf337.hdf" "thf338.hdf" "thf339.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf33-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf32-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf34-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf340.hdf" "thf341.hdf" "thf342.hdf" "thf343.hdf" "thf344.hdf" "thf345.hdf" "thf346.hdf" "thf347.hdf" "thf348.hdf" "thf349.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf34-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf33-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf35-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf350.hdf" "thf351.hdf" "thf352.hdf" "thf353.hdf" "thf354.hdf" "thf355.hdf" "thf356.hdf" "thf357.hdf" "thf358.hdf" "thf359.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf35-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf34-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf36-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf360.hdf" "thf361.hdf" "thf362.hdf" "thf363.hdf" "thf364.hdf" "thf365.hdf" "thf366.hdf" "thf367.hdf" "thf368.hdf" "thf369.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf36-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf35-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf37-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf370.hdf" "thf371.hdf" "thf372.hdf" "thf373.hdf" "thf374.hdf" "thf375.hdf" "thf376.hdf" "thf377.hdf" "thf378.hdf" "thf379.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf37-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf36-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf38-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf380.hdf" "thf381.hdf" "thf382.hdf" "thf383.hdf" "thf384.hdf" "thf385.hdf" "thf386.hdf" "thf387.hdf" "thf388.hdf" "thf389.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf38-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf37-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf39-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf390.hdf" "thf391.hdf" "thf392.hdf" "thf393.hdf" "thf394.hdf" "thf395.hdf" "thf396.hdf" "thf397.hdf" "thf398.hdf" "thf399.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf39-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf38-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf40-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf400.hdf" "thf401.hdf" "thf402.hdf" "thf403.hdf" "thf404.hdf" "thf405.hdf" "thf406.hdf" "thf407.hdf" "thf408.hdf" "thf409.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf40-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf39-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf41-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf410.hdf" "thf411.hdf" "thf412.hdf" "thf413.hdf" "thf414.hdf" "thf415.hdf" "thf416.hdf" "thf417.hdf" "thf418.hdf" "thf419.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf41-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf40-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf42-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf420.hdf" "thf421.hdf" "thf422.hdf" "thf423.hdf" "thf424.hdf" "thf425.hdf" "thf426.hdf" "thf427.hdf" "thf428.hdf" "thf429.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf42-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf41-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf43-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf430.hdf" "thf431.hdf" "thf432.hdf" "thf433.hdf" "thf434.hdf" "thf435.hdf" "thf436.hdf" "thf437.hdf" "thf438.hdf" "thf439.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf43-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf42-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf44-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf440.hdf" "thf441.hdf" "thf442.hdf" "thf443.hdf" "thf444.hdf" "thf445.hdf" "thf446.hdf" "thf447.hdf" "thf448.hdf" "thf449.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf44-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf43-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf45-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf450.hdf" "thf451.hdf" "thf452.hdf" "thf453.hdf" "thf454.hdf" "thf455.hdf" "thf456.hdf" "thf457.hdf" "thf458.hdf" "thf459.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf45-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf44-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf46-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf460.hdf" "thf461.hdf" "thf462.hdf" "thf463.hdf" "thf464.hdf" "thf465.hdf" "thf466.hdf" "thf467.hdf" "thf468.hdf" "thf469.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf46-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf45-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf47-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf470.hdf" "thf471.hdf" "thf472.hdf" "thf473.hdf" "thf474.hdf" "thf475.hdf" "thf476.hdf" "thf477.hdf" "thf478.hdf" "thf479.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf47-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf46-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf48-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf480.hdf" "thf481.hdf" "thf482.hdf" "thf483.hdf" "thf484.hdf" "thf485.hdf" "thf486.hdf" "thf487.hdf" "thf488.hdf" "thf489.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf48-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf47-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf49-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf490.hdf" "thf491.hdf" "thf492.hdf" "thf493.hdf" "thf494.hdf" "thf495.hdf" "thf496.hdf" "thf497.hdf" "thf498.hdf" "thf499.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf49-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf48-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf50-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf500.hdf" "thf501.hdf" "thf502.hdf" "thf503.hdf" "thf504.hdf" "thf505.hdf" "thf506.hdf" "thf507.hdf" "thf508.hdf" "thf509.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf50-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf49-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf51-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf510.hdf" "thf511.hdf" "thf512.hdf" "thf513.hdf" "thf514.hdf" "thf515.hdf" "thf516.hdf" "thf517.hdf" "thf518.hdf" "thf519.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf51-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf50-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf52-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf520.hdf" "thf521.hdf" "thf522.hdf" "thf523.hdf" "thf524.hdf" "thf525.hdf" "thf526.hdf" "thf527.hdf" "thf528.hdf" "thf529.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf52-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf51-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf53-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf530.hdf" "thf531.hdf" "thf532.hdf" "thf533.hdf" "thf534.hdf" "thf535.hdf" "thf536.hdf" "thf537.hdf" "thf538.hdf" "thf539.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf53-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf52-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf54-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf540.hdf" "thf541.hdf" "thf542.hdf" "thf543.hdf" "thf544.hdf" "thf545.hdf" "thf546.hdf" "thf547.hdf" "thf548.hdf" "thf549.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf54-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf53-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf55-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf550.hdf" "thf551.hdf" "thf552.hdf" "thf553.hdf" "thf554.hdf" "thf555.hdf" "thf556.hdf" "thf557.hdf" "thf558.hdf" "thf559.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf55-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf54-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf56-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf560.hdf" "thf561.hdf" "thf562.hdf" "thf563.hdf" "thf564.hdf" "thf565.hdf" "thf566.hdf" "thf567.hdf" "thf568.hdf" "thf569.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf56-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf55-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf57-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf570.hdf" "thf571.hdf" "thf572.hdf" "thf573.hdf" "thf574.hdf" "thf575.hdf" "thf576.hdf" "thf577.hdf" "thf578.hdf" "thf579.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf57-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf56-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf58-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf580.hdf" "thf581.hdf" "thf582.hdf" "thf583.hdf" "thf584.hdf" "thf585.hdf" "thf586.hdf" "thf587.hdf" "thf588.hdf" "thf589.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf58-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf57-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf59-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf590.hdf" "thf591.hdf" "thf592.hdf" "thf593.hdf" "thf594.hdf" "thf595.hdf" "thf596.hdf" "thf597.hdf" "thf598.hdf" "thf599.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf59-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf58-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf_thf60-clearall-objects "/usr/bin/cmake" "-E" "remove" "thf600.hdf" "thf601.hdf" "thf602.hdf" "thf603.hdf" "thf604.hdf" "thf605.hdf" "thf606.hdf" "thf607.hdf" "thf608.hdf" "thf609.hdf")
+set_tests_properties(HDF_TEST-testhdf_thf60-clearall-objects PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf59-clearall-objects" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;159;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-testhdf "/root/repo/_ts_build/bin/testhdf")
+set_tests_properties(HDF_TEST-testhdf PROPERTIES  DEPENDS "HDF_TEST-testhdf_thf60-clearall-objects" LABELS "HDF4_HDF_TEST" PASS_REGULAR_EXPRESSION "All tests were successful" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;183;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-buffer "/root/repo/_ts_build/bin/buffer")
+set_tests_properties(HDF_TEST-buffer PROPERTIES  DEPENDS "HDF_TEST-testhdf" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;197;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-openbench "/root/repo/_ts_build/bin/openbench")
+set_tests_properties(HDF_TEST-openbench PROPERTIES  DEPENDS "HDF_TEST-buffer" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;210;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-atombench "/root/repo/_ts_build/bin/atombench")
+set_tests_properties(HDF_TEST-atombench PROPERTIES  DEPENDS "HDF_TEST-openbench" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;223;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
+add_test(HDF_TEST-treebench "/root/repo/_ts_build/bin/treebench")
+set_tests_properties(HDF_TEST-treebench PROPERTIES  DEPENDS "HDF_TEST-atombench" LABELS "HDF4_HDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/hdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/hdf/test/CMakeTests.cmake;236;add_test;/root/repo/hdf/test/CMakeTests.cmake;0;;/root/repo/hdf/test/CMakeLists.txt;124;include;/root/repo/hdf/test/CMakeLists.txt;0;")
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hdf/util/he_cntrl.c" "hdf/util/CMakeFiles/hdfed-shared.dir/he_cntrl.c.o" "gcc" "hdf/util/CMakeFiles/hdfed-shared.dir/he_cntrl.c.o.d"
+  "/root/repo/hdf/util/he_disp.c" "hdf/util/CMakeFiles/hdfed-shared.dir/he_disp.c.o" "gcc" "hdf/util/CMakeFiles/hdfed-shared.dir/he_disp.c.o.d"
+  "/root/repo/hdf/util/he_file.c" "hdf/util/CMakeFiles/hdfed-shared.dir/he_file.c.o" "gcc" "hdf/util/CMakeFiles/hdfed-shared.dir/he_file.c.o.d"
+  "/root/repo/hdf/util/he_main.c" "hdf/util/CMakeFiles/hdfed-shared.dir/he_main.c.o" "gcc" "hdf/util/CMakeFiles/hdfed-shared.dir/he_main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../bin/hdfed-shared"
+  "../../bin/hdfed-shared.pdb"
+  "CMakeFiles/hdfed-shared.dir/he_cntrl.c.o"
+  "CMakeFiles/hdfed-shared.dir/he_cntrl.c.o.d"
+  "CMakeFiles/hdfed-shared.dir/he_disp.c.o"
+  "CMakeFiles/hdfed-shared.dir/he_disp.c.o.d"
+  "CMakeFiles/hdfed-shared.dir/he_file.c.o"
+  "CMakeFiles/hdfed-shared.dir/he_file.c.o.d"
+  "CMakeFiles/hdfed-shared.dir/he_main.c.o"
+  "CMakeFiles/hdfed-shared.dir/he_main.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfed-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
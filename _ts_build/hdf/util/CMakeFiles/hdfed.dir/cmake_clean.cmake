@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../bin/hdfed"
+  "../../bin/hdfed.pdb"
+  "CMakeFiles/hdfed.dir/he_cntrl.c.o"
+  "CMakeFiles/hdfed.dir/he_cntrl.c.o.d"
+  "CMakeFiles/hdfed.dir/he_disp.c.o"
+  "CMakeFiles/hdfed.dir/he_disp.c.o.d"
+  "CMakeFiles/hdfed.dir/he_file.c.o"
+  "CMakeFiles/hdfed.dir/he_file.c.o.d"
+  "CMakeFiles/hdfed.dir/he_main.c.o"
+  "CMakeFiles/hdfed.dir/he_main.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
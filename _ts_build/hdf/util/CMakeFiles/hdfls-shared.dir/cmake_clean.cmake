@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hdfls-shared"
+  "../../bin/hdfls-shared.pdb"
+  "CMakeFiles/hdfls-shared.dir/hdfls.c.o"
+  "CMakeFiles/hdfls-shared.dir/hdfls.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfls-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hdfls"
+  "../../bin/hdfls.pdb"
+  "CMakeFiles/hdfls.dir/hdfls.c.o"
+  "CMakeFiles/hdfls.dir/hdfls.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/hdf/util
+# Build directory: /root/repo/_ts_build/hdf/util
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+set_directory_properties(PROPERTIES LABELS "“HDF”")
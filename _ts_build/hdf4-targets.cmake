@@ -0,0 +1,189 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS hdf-static hdf-shared mfhdf-static mfhdf-shared hdp hdp-shared hdfimport hdfimport-shared hdiff hdiff-shared hrepack hrepack-shared)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target hdf-static
+add_library(hdf-static STATIC IMPORTED)
+
+set_target_properties(hdf-static PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "_POSIX_C_SOURCE=200809L;_GNU_SOURCE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_ts_build/hdf/src;/root/repo/hdf/src"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:m>;\$<LINK_ONLY:dl>;/usr/lib/x86_64-linux-gnu/libjpeg.so;/usr/lib/x86_64-linux-gnu/libz.so"
+)
+
+# Create imported target hdf-shared
+add_library(hdf-shared SHARED IMPORTED)
+
+set_target_properties(hdf-shared PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "H4_BUILT_AS_DYNAMIC_LIB=1"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_ts_build/hdf/src;/root/repo/hdf/src"
+)
+
+# Create imported target mfhdf-static
+add_library(mfhdf-static STATIC IMPORTED)
+
+set_target_properties(mfhdf-static PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "_POSIX_C_SOURCE=200809L;_GNU_SOURCE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_ts_build/mfhdf/libsrc;/root/repo/mfhdf/libsrc"
+  INTERFACE_LINK_LIBRARIES "\$<\$<OR:\$<PLATFORM_ID:Windows>,\$<PLATFORM_ID:MinGW>>:ws2_32.lib>;hdf-static"
+)
+
+# Create imported target mfhdf-shared
+add_library(mfhdf-shared SHARED IMPORTED)
+
+set_target_properties(mfhdf-shared PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "H4_BUILT_AS_DYNAMIC_LIB=1"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_ts_build/mfhdf/libsrc;/root/repo/mfhdf/libsrc"
+  INTERFACE_LINK_LIBRARIES "\$<\$<OR:\$<PLATFORM_ID:Windows>,\$<PLATFORM_ID:MinGW>>:ws2_32.lib>;hdf-shared"
+)
+
+# Create imported target hdp
+add_executable(hdp IMPORTED)
+
+# Create imported target hdp-shared
+add_executable(hdp-shared IMPORTED)
+
+# Create imported target hdfimport
+add_executable(hdfimport IMPORTED)
+
+# Create imported target hdfimport-shared
+add_executable(hdfimport-shared IMPORTED)
+
+# Create imported target hdiff
+add_executable(hdiff IMPORTED)
+
+# Create imported target hdiff-shared
+add_executable(hdiff-shared IMPORTED)
+
+# Create imported target hrepack
+add_executable(hrepack IMPORTED)
+
+# Create imported target hrepack-shared
+add_executable(hrepack-shared IMPORTED)
+
+# Import target "hdf-static" for configuration ""
+set_property(TARGET hdf-static APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/libhdf.a"
+  )
+
+# Import target "hdf-shared" for configuration ""
+set_property(TARGET hdf-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/libhdf.so.4.0.3"
+  IMPORTED_SONAME_NOCONFIG "libhdf.so.4"
+  )
+
+# Import target "mfhdf-static" for configuration ""
+set_property(TARGET mfhdf-static APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(mfhdf-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/libmfhdf.a"
+  )
+
+# Import target "mfhdf-shared" for configuration ""
+set_property(TARGET mfhdf-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(mfhdf-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/libmfhdf.so.4.0.3"
+  IMPORTED_SONAME_NOCONFIG "libmfhdf.so.4"
+  )
+
+# Import target "hdp" for configuration ""
+set_property(TARGET hdp APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdp PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/hdp"
+  )
+
+# Import target "hdp-shared" for configuration ""
+set_property(TARGET hdp-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdp-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/hdp-shared"
+  )
+
+# Import target "hdfimport" for configuration ""
+set_property(TARGET hdfimport APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdfimport PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/hdfimport"
+  )
+
+# Import target "hdfimport-shared" for configuration ""
+set_property(TARGET hdfimport-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdfimport-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/hdfimport-shared"
+  )
+
+# Import target "hdiff" for configuration ""
+set_property(TARGET hdiff APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdiff PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/hdiff"
+  )
+
+# Import target "hdiff-shared" for configuration ""
+set_property(TARGET hdiff-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdiff-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/hdiff-shared"
+  )
+
+# Import target "hrepack" for configuration ""
+set_property(TARGET hrepack APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hrepack PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/hrepack"
+  )
+
+# Import target "hrepack-shared" for configuration ""
+set_property(TARGET hrepack-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hrepack-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_ts_build/bin/hrepack-shared"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
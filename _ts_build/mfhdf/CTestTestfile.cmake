@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf
+# Build directory: /root/repo/_ts_build/mfhdf
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("dumper")
+subdirs("hdfimport")
+subdirs("hdiff")
+subdirs("hrepack")
+subdirs("ncgen")
+subdirs("ncdump")
+subdirs("nctest")
+set_directory_properties(PROPERTIES LABELS "“MFHDF”")
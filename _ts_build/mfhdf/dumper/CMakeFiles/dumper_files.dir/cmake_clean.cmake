@@ -0,0 +1,125 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dumper_files"
+  "Example6.hdf"
+  "IMCOMP.hdf"
+  "Image_with_Palette.hdf"
+  "LongDataset.hdf"
+  "Roy.nc"
+  "SDSlongname.hdf"
+  "Tables.hdf"
+  "Tables_External_File"
+  "VGlongname.hdf"
+  "ctxtr2r.hdf"
+  "dumpgr-1.out"
+  "dumpgr-10.out"
+  "dumpgr-11.out"
+  "dumpgr-12.out"
+  "dumpgr-13.out"
+  "dumpgr-14.out"
+  "dumpgr-15.out"
+  "dumpgr-16.out"
+  "dumpgr-17.out"
+  "dumpgr-18.out"
+  "dumpgr-19.out"
+  "dumpgr-2.out"
+  "dumpgr-20.out"
+  "dumpgr-3.out"
+  "dumpgr-4.out"
+  "dumpgr-5.out"
+  "dumpgr-6.out"
+  "dumpgr-7.out"
+  "dumpgr-8.out"
+  "dumpgr-9.out"
+  "dumprig-1.out"
+  "dumprig-2.out"
+  "dumprig-3.out"
+  "dumprig-4.out"
+  "dumprig-5.out"
+  "dumprig-6.out"
+  "dumpsds-1.out"
+  "dumpsds-10.out"
+  "dumpsds-11.out"
+  "dumpsds-12.out"
+  "dumpsds-13.out"
+  "dumpsds-14.out"
+  "dumpsds-15.out"
+  "dumpsds-15szip.out"
+  "dumpsds-16.out"
+  "dumpsds-17.out"
+  "dumpsds-18.out"
+  "dumpsds-2.out"
+  "dumpsds-3.out"
+  "dumpsds-4.out"
+  "dumpsds-5.out"
+  "dumpsds-6.out"
+  "dumpsds-7.out"
+  "dumpsds-8.out"
+  "dumpsds-9.out"
+  "dumpvd-1.out"
+  "dumpvd-10.out"
+  "dumpvd-11.out"
+  "dumpvd-12.out"
+  "dumpvd-13.out"
+  "dumpvd-14.out"
+  "dumpvd-2.out"
+  "dumpvd-3.out"
+  "dumpvd-4.out"
+  "dumpvd-5.out"
+  "dumpvd-6.out"
+  "dumpvd-7.out"
+  "dumpvd-8.out"
+  "dumpvd-9.out"
+  "dumpvg-1.out"
+  "dumpvg-10.out"
+  "dumpvg-11.out"
+  "dumpvg-12.out"
+  "dumpvg-13.out"
+  "dumpvg-14.out"
+  "dumpvg-15.out"
+  "dumpvg-16.out"
+  "dumpvg-17.out"
+  "dumpvg-2.out"
+  "dumpvg-3.out"
+  "dumpvg-4.out"
+  "dumpvg-5.out"
+  "dumpvg-6.out"
+  "dumpvg-7.out"
+  "dumpvg-8.out"
+  "dumpvg-9.out"
+  "grtdfi322.hdf"
+  "grtdfui162.hdf"
+  "grtdfui82.hdf"
+  "grtdfui83.hdf"
+  "grtdfui84.hdf"
+  "list-1.out"
+  "list-10.out"
+  "list-2.out"
+  "list-3.out"
+  "list-4.out"
+  "list-5.out"
+  "list-6.out"
+  "list-7.out"
+  "list-8.out"
+  "list-9.out"
+  "sds1_dim1_samename.hdf"
+  "sds2_dim1_samename.hdf"
+  "sds_compressed.hdf"
+  "sds_empty_many.hdf"
+  "star.hdf"
+  "swf32.hdf"
+  "swf32_fileattr.hdf"
+  "swi16.hdf"
+  "swi8.hdf"
+  "tdata.hdf"
+  "tdf24.hdf"
+  "tdfr8f.hdf"
+  "test.hdf"
+  "tvattr.hdf"
+  "tvset.hdf"
+  "vslongname.hdf"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/dumper_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
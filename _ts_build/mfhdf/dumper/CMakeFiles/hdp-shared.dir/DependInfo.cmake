@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/dumper/hdp.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp.c.o.d"
+  "/root/repo/mfhdf/dumper/hdp_dump.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_dump.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_dump.c.o.d"
+  "/root/repo/mfhdf/dumper/hdp_gr.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_gr.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_gr.c.o.d"
+  "/root/repo/mfhdf/dumper/hdp_list.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_list.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_list.c.o.d"
+  "/root/repo/mfhdf/dumper/hdp_rig.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_rig.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_rig.c.o.d"
+  "/root/repo/mfhdf/dumper/hdp_sds.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_sds.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_sds.c.o.d"
+  "/root/repo/mfhdf/dumper/hdp_util.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_util.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_util.c.o.d"
+  "/root/repo/mfhdf/dumper/hdp_vd.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_vd.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_vd.c.o.d"
+  "/root/repo/mfhdf/dumper/hdp_vg.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_vg.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/hdp_vg.c.o.d"
+  "/root/repo/mfhdf/dumper/show.c" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/show.c.o" "gcc" "mfhdf/dumper/CMakeFiles/hdp-shared.dir/show.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../bin/hdp-shared"
+  "../../bin/hdp-shared.pdb"
+  "CMakeFiles/hdp-shared.dir/hdp.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp.c.o.d"
+  "CMakeFiles/hdp-shared.dir/hdp_dump.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp_dump.c.o.d"
+  "CMakeFiles/hdp-shared.dir/hdp_gr.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp_gr.c.o.d"
+  "CMakeFiles/hdp-shared.dir/hdp_list.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp_list.c.o.d"
+  "CMakeFiles/hdp-shared.dir/hdp_rig.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp_rig.c.o.d"
+  "CMakeFiles/hdp-shared.dir/hdp_sds.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp_sds.c.o.d"
+  "CMakeFiles/hdp-shared.dir/hdp_util.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp_util.c.o.d"
+  "CMakeFiles/hdp-shared.dir/hdp_vd.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp_vd.c.o.d"
+  "CMakeFiles/hdp-shared.dir/hdp_vg.c.o"
+  "CMakeFiles/hdp-shared.dir/hdp_vg.c.o.d"
+  "CMakeFiles/hdp-shared.dir/show.c.o"
+  "CMakeFiles/hdp-shared.dir/show.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdp-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,351 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf/dumper
+# Build directory: /root/repo/_ts_build/mfhdf/dumper
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HDP-list-1-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-1.tst" "list-1.tst.err")
+set_tests_properties(HDP-list-1-clearall-objects PROPERTIES  LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;187;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-1.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-1.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-1 PROPERTIES  DEPENDS "HDP-list-1-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;187;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-2-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-2.tst" "list-2.tst.err")
+set_tests_properties(HDP-list-2-clearall-objects PROPERTIES  DEPENDS "HDP-list-1" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;188;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-l;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-2.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-2.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-2 PROPERTIES  DEPENDS "HDP-list-2-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;188;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-3-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-3.tst" "list-3.tst.err")
+set_tests_properties(HDP-list-3-clearall-objects PROPERTIES  DEPENDS "HDP-list-2" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;189;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-d;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-3.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-3.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-3 PROPERTIES  DEPENDS "HDP-list-3-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;189;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-4-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-4.tst" "list-4.tst.err")
+set_tests_properties(HDP-list-4-clearall-objects PROPERTIES  DEPENDS "HDP-list-3" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;190;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-4 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-e;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-4.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-4.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-4 PROPERTIES  DEPENDS "HDP-list-4-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;190;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-5-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-5.tst" "list-5.tst.err")
+set_tests_properties(HDP-list-5-clearall-objects PROPERTIES  DEPENDS "HDP-list-4" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;191;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-5 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-t;720;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-5.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-5.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-5 PROPERTIES  DEPENDS "HDP-list-5-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;191;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-6-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-6.tst" "list-6.tst.err")
+set_tests_properties(HDP-list-6-clearall-objects PROPERTIES  DEPENDS "HDP-list-5" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;192;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-6 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-d;-t;Numeric Data Group;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-6.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-6.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-6 PROPERTIES  DEPENDS "HDP-list-6-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;192;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-7-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-7.tst" "list-7.tst.err")
+set_tests_properties(HDP-list-7-clearall-objects PROPERTIES  DEPENDS "HDP-list-6" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;193;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-7 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-g;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-7.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-7.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-7 PROPERTIES  DEPENDS "HDP-list-7-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;193;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-8-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-8.tst" "list-8.tst.err")
+set_tests_properties(HDP-list-8-clearall-objects PROPERTIES  DEPENDS "HDP-list-7" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;194;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-8 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-a;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-8.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-8.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-8 PROPERTIES  DEPENDS "HDP-list-8-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;194;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-9-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-9.tst" "list-9.tst.err")
+set_tests_properties(HDP-list-9-clearall-objects PROPERTIES  DEPENDS "HDP-list-8" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;195;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-9 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-a;Example6.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-9.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-9.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-9 PROPERTIES  DEPENDS "HDP-list-9-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;195;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-10-clearall-objects "/usr/bin/cmake" "-E" "remove" "list-10.tst" "list-10.tst.err")
+set_tests_properties(HDP-list-10-clearall-objects PROPERTIES  DEPENDS "HDP-list-9" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;196;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-list-10 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=list;-n;Example6.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=list-10.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=list-10.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-list-10 PROPERTIES  DEPENDS "HDP-list-10-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;196;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-1-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-1.tst" "dumpsds-1.tst.err")
+set_tests_properties(HDP-dumpsds-1-clearall-objects PROPERTIES  DEPENDS "HDP-list-10" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;199;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;swf32.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-1.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-1.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-1 PROPERTIES  DEPENDS "HDP-dumpsds-1-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;199;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-2-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-2.tst" "dumpsds-2.tst.err")
+set_tests_properties(HDP-dumpsds-2-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-1" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;202;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-i;2;swf32.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-2.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-2.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-2 PROPERTIES  DEPENDS "HDP-dumpsds-2-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;202;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-3-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-3.tst" "dumpsds-3.tst.err")
+set_tests_properties(HDP-dumpsds-3-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-2" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;203;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-i;1,3;swf32.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-3.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-3.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-3 PROPERTIES  DEPENDS "HDP-dumpsds-3-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;203;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-4-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-4.tst" "dumpsds-4.tst.err")
+set_tests_properties(HDP-dumpsds-4-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-3" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;206;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-4 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-n;Time;swf32.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-4.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-4.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-4 PROPERTIES  DEPENDS "HDP-dumpsds-4-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;206;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-5-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-5.tst" "dumpsds-5.tst.err")
+set_tests_properties(HDP-dumpsds-5-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-4" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;209;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-5 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-n;fakeDim0,Data-Set-2;swf32.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-5.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-5.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-5 PROPERTIES  DEPENDS "HDP-dumpsds-5-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;209;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-6-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-6.tst" "dumpsds-6.tst.err")
+set_tests_properties(HDP-dumpsds-6-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-5" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;212;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-6 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-r;3,2;swf32.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-6.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-6.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-6 PROPERTIES  DEPENDS "HDP-dumpsds-6-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;212;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-7-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-7.tst" "dumpsds-7.tst.err")
+set_tests_properties(HDP-dumpsds-7-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-6" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;215;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-7 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-r;3,2;-d;swf32.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-7.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-7.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-7 PROPERTIES  DEPENDS "HDP-dumpsds-7-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;215;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-8-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-8.tst" "dumpsds-8.tst.err")
+set_tests_properties(HDP-dumpsds-8-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-7" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;218;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-8 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-h;swf32_fileattr.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-8.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-8.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-8 PROPERTIES  DEPENDS "HDP-dumpsds-8-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;218;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-9-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-9.tst" "dumpsds-9.tst.err")
+set_tests_properties(HDP-dumpsds-9-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-8" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;221;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-9 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-c;swf32_fileattr.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-9.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-9.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-9 PROPERTIES  DEPENDS "HDP-dumpsds-9-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;221;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-10-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-10.tst" "dumpsds-10.tst.err")
+set_tests_properties(HDP-dumpsds-10-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-9" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;224;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-10 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-g;swf32_fileattr.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-10.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-10.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-10 PROPERTIES  DEPENDS "HDP-dumpsds-10-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;224;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-11-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-11.tst" "dumpsds-11.tst.err")
+set_tests_properties(HDP-dumpsds-11-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-10" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;227;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-11 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-l;swf32_fileattr.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-11.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-11.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-11 PROPERTIES  DEPENDS "HDP-dumpsds-11-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;227;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-12-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-12.tst" "dumpsds-12.tst.err")
+set_tests_properties(HDP-dumpsds-12-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-11" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;230;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-12 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-h;-n;The name of this dataset is long and it is used to test the new variable length name feature.;SDSlongname.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-12.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-12.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-12 PROPERTIES  DEPENDS "HDP-dumpsds-12-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;230;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-13-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-13.tst" "dumpsds-13.tst.err")
+set_tests_properties(HDP-dumpsds-13-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-12" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;233;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-13 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;sds1_dim1_samename.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-13.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-13.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-13 PROPERTIES  DEPENDS "HDP-dumpsds-13-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;233;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-14-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-14.tst" "dumpsds-14.tst.err")
+set_tests_properties(HDP-dumpsds-14-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-13" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;237;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-14 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;sds2_dim1_samename.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-14.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-14.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-14 PROPERTIES  DEPENDS "HDP-dumpsds-14-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;237;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-15-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-15.tst" "dumpsds-15.tst.err")
+set_tests_properties(HDP-dumpsds-15-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-14" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;245;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-15 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;sds_compressed.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-15.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-15.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-15 PROPERTIES  DEPENDS "HDP-dumpsds-15-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;245;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-16-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-16.tst" "dumpsds-16.tst.err")
+set_tests_properties(HDP-dumpsds-16-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-15" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;249;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-16 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-h;-i;39,36;-n;data34,data27;-r;36,37;-i;0,1;-n;data6,data9,data4,data3;-r;16,17,15;-i;23,22,21;sds_empty_many.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-16.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-16.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-16 PROPERTIES  DEPENDS "HDP-dumpsds-16-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;249;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-17-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-17.tst" "dumpsds-17.tst.err")
+set_tests_properties(HDP-dumpsds-17-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-16" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;253;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-17 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-k;-h;-i;39,36;-n;data34,data27;-r;36,37;-i;0,1;-n;data6,data9,data4,data3;-r;16,17,15;-i;23,22,21;sds_empty_many.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-17.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-17.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-17 PROPERTIES  DEPENDS "HDP-dumpsds-17-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;253;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-18-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpsds-18.tst" "dumpsds-18.tst.err")
+set_tests_properties(HDP-dumpsds-18-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-17" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;256;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpsds-18 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpsds;-i;0,1,2;Roy.nc" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpsds-18.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpsds-18.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpsds-18 PROPERTIES  DEPENDS "HDP-dumpsds-18-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;256;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-1-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumprig-1.tst" "dumprig-1.tst.err")
+set_tests_properties(HDP-dumprig-1-clearall-objects PROPERTIES  DEPENDS "HDP-dumpsds-18" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;258;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumprig;tdf24.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumprig-1.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumprig-1.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumprig-1 PROPERTIES  DEPENDS "HDP-dumprig-1-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;258;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-2-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumprig-2.tst" "dumprig-2.tst.err")
+set_tests_properties(HDP-dumprig-2-clearall-objects PROPERTIES  DEPENDS "HDP-dumprig-1" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;259;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumprig;-i;1,2;tdf24.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumprig-2.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumprig-2.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumprig-2 PROPERTIES  DEPENDS "HDP-dumprig-2-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;259;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-3-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumprig-3.tst" "dumprig-3.tst.err")
+set_tests_properties(HDP-dumprig-3-clearall-objects PROPERTIES  DEPENDS "HDP-dumprig-2" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;260;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumprig;-i;1,3;tdf24.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumprig-3.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumprig-3.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumprig-3 PROPERTIES  DEPENDS "HDP-dumprig-3-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;260;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-4-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumprig-4.tst" "dumprig-4.tst.err")
+set_tests_properties(HDP-dumprig-4-clearall-objects PROPERTIES  DEPENDS "HDP-dumprig-3" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;261;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-4 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumprig;-m;24;tdf24.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumprig-4.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumprig-4.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumprig-4 PROPERTIES  DEPENDS "HDP-dumprig-4-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;261;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-5-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumprig-5.tst" "dumprig-5.tst.err")
+set_tests_properties(HDP-dumprig-5-clearall-objects PROPERTIES  DEPENDS "HDP-dumprig-4" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;262;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-5 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumprig;-r;3,4;tdf24.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumprig-5.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumprig-5.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumprig-5 PROPERTIES  DEPENDS "HDP-dumprig-5-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;262;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-6-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumprig-6.tst" "dumprig-6.tst.err")
+set_tests_properties(HDP-dumprig-6-clearall-objects PROPERTIES  DEPENDS "HDP-dumprig-5" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;263;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumprig-6 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumprig;-r;3,4;-d;tdf24.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumprig-6.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumprig-6.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumprig-6 PROPERTIES  DEPENDS "HDP-dumprig-6-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;263;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-1-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-1.tst" "dumpvd-1.tst.err")
+set_tests_properties(HDP-dumpvd-1-clearall-objects PROPERTIES  DEPENDS "HDP-dumprig-6" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;266;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-1.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-1.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-1 PROPERTIES  DEPENDS "HDP-dumpvd-1-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;266;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-2-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-2.tst" "dumpvd-2.tst.err")
+set_tests_properties(HDP-dumpvd-2-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-1" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;267;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-i;1,3,5;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-2.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-2.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-2 PROPERTIES  DEPENDS "HDP-dumpvd-2-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;267;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-3-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-3.tst" "dumpvd-3.tst.err")
+set_tests_properties(HDP-dumpvd-3-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-2" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;268;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-r;1238,1239,1251,1252;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-3.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-3.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-3 PROPERTIES  DEPENDS "HDP-dumpvd-3-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;268;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-4-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-4.tst" "dumpvd-4.tst.err")
+set_tests_properties(HDP-dumpvd-4-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-3" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;269;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-4 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-n;Multi-Order Vdata;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-4.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-4.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-4 PROPERTIES  DEPENDS "HDP-dumpvd-4-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;269;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-5-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-5.tst" "dumpvd-5.tst.err")
+set_tests_properties(HDP-dumpvd-5-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-4" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;270;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-5 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-n;Mixed Vdata,Integer Vdata;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-5.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-5.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-5 PROPERTIES  DEPENDS "HDP-dumpvd-5-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;270;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-6-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-6.tst" "dumpvd-6.tst.err")
+set_tests_properties(HDP-dumpvd-6-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-5" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;271;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-6 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-c;Test object,No class specified;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-6.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-6.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-6 PROPERTIES  DEPENDS "HDP-dumpvd-6-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;271;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-7-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-7.tst" "dumpvd-7.tst.err")
+set_tests_properties(HDP-dumpvd-7-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-6" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;272;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-7 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-f;B;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-7.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-7.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-7 PROPERTIES  DEPENDS "HDP-dumpvd-7-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;272;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-8-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-8.tst" "dumpvd-8.tst.err")
+set_tests_properties(HDP-dumpvd-8-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-7" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;273;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-8 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-f;STATION_NAME,FLOATS;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-8.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-8.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-8 PROPERTIES  DEPENDS "HDP-dumpvd-8-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;273;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-9-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-9.tst" "dumpvd-9.tst.err")
+set_tests_properties(HDP-dumpvd-9-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-8" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;274;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-9 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-f;STATION_NAME,FLOATS;-d;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-9.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-9.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-9 PROPERTIES  DEPENDS "HDP-dumpvd-9-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;274;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-10-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-10.tst" "dumpvd-10.tst.err")
+set_tests_properties(HDP-dumpvd-10-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-9" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;275;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-10 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;tvattr.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-10.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-10.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-10 PROPERTIES  DEPENDS "HDP-dumpvd-10-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;275;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-11-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-11.tst" "dumpvd-11.tst.err")
+set_tests_properties(HDP-dumpvd-11-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-10" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;280;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-11 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-c;SDSVar;sds1_dim1_samename.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-11.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-11.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-11 PROPERTIES  DEPENDS "HDP-dumpvd-11-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;280;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-12-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-12.tst" "dumpvd-12.tst.err")
+set_tests_properties(HDP-dumpvd-12-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-11" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;281;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-12 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;-c;CoordVar;sds1_dim1_samename.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-12.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-12.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-12 PROPERTIES  DEPENDS "HDP-dumpvd-12-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;281;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-13-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-13.tst" "dumpvd-13.tst.err")
+set_tests_properties(HDP-dumpvd-13-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-12" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;284;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-13 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;vslongname.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-13.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-13.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-13 PROPERTIES  DEPENDS "HDP-dumpvd-13-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;284;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-14-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvd-14.tst" "dumpvd-14.tst.err")
+set_tests_properties(HDP-dumpvd-14-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-13" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;290;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvd-14 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvd;Tables.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvd-14.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvd-14.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvd-14 PROPERTIES  DEPENDS "HDP-dumpvd-14-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;290;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-1-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-1.tst" "dumpvg-1.tst.err")
+set_tests_properties(HDP-dumpvg-1-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvd-14" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;293;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-1.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-1.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-1 PROPERTIES  DEPENDS "HDP-dumpvg-1-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;293;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-2-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-2.tst" "dumpvg-2.tst.err")
+set_tests_properties(HDP-dumpvg-2-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-1" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;294;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-i;0,1;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-2.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-2.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-2 PROPERTIES  DEPENDS "HDP-dumpvg-2-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;294;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-3-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-3.tst" "dumpvg-3.tst.err")
+set_tests_properties(HDP-dumpvg-3-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-2" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;295;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-r;3;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-3.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-3.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-3 PROPERTIES  DEPENDS "HDP-dumpvg-3-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;295;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-4-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-4.tst" "dumpvg-4.tst.err")
+set_tests_properties(HDP-dumpvg-4-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-3" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;296;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-4 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-n;Simple Vgroup;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-4.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-4.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-4 PROPERTIES  DEPENDS "HDP-dumpvg-4-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;296;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-5-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-5.tst" "dumpvg-5.tst.err")
+set_tests_properties(HDP-dumpvg-5-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-4" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;297;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-5 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-c;Test object;tvset.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-5.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-5.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-5 PROPERTIES  DEPENDS "HDP-dumpvg-5-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;297;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-6-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-6.tst" "dumpvg-6.tst.err")
+set_tests_properties(HDP-dumpvg-6-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-5" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;298;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-6 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-i;1,3,5;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-6.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-6.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-6 PROPERTIES  DEPENDS "HDP-dumpvg-6-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;298;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-7-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-7.tst" "dumpvg-7.tst.err")
+set_tests_properties(HDP-dumpvg-7-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-6" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;299;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-7 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-r;32,39;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-7.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-7.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-7 PROPERTIES  DEPENDS "HDP-dumpvg-7-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;299;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-8-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-8.tst" "dumpvg-8.tst.err")
+set_tests_properties(HDP-dumpvg-8-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-7" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;300;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-8 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-n;nsamp,tdata.hdf;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-8.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-8.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-8 PROPERTIES  DEPENDS "HDP-dumpvg-8-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;300;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-9-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-9.tst" "dumpvg-9.tst.err")
+set_tests_properties(HDP-dumpvg-9-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-8" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;301;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-9 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-c;CDF0.0;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-9.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-9.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-9 PROPERTIES  DEPENDS "HDP-dumpvg-9-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;301;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-10-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-10.tst" "dumpvg-10.tst.err")
+set_tests_properties(HDP-dumpvg-10-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-9" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;305;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-10 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-h;-c;Dim0.0,Var0.0;tdata.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-10.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-10.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-10 PROPERTIES  DEPENDS "HDP-dumpvg-10-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;305;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-11-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-11.tst" "dumpvg-11.tst.err")
+set_tests_properties(HDP-dumpvg-11-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-10" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;311;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-11 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;tvattr.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-11.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-11.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-11 PROPERTIES  DEPENDS "HDP-dumpvg-11-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;311;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-12-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-12.tst" "dumpvg-12.tst.err")
+set_tests_properties(HDP-dumpvg-12-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-11" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;316;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-12 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;VGlongname.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-12.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-12.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-12 PROPERTIES  DEPENDS "HDP-dumpvg-12-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;316;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-13-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-13.tst" "dumpvg-13.tst.err")
+set_tests_properties(HDP-dumpvg-13-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-12" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;317;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-13 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-n;SD Vgroup - this vgroup has an sds as a member and it is actually meant to test long vgroup name;VGlongname.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-13.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-13.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-13 PROPERTIES  DEPENDS "HDP-dumpvg-13-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;317;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-14-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-14.tst" "dumpvg-14.tst.err")
+set_tests_properties(HDP-dumpvg-14-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-13" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;320;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-14 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;sds1_dim1_samename.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-14.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-14.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-14 PROPERTIES  DEPENDS "HDP-dumpvg-14-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;320;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-15-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-15.tst" "dumpvg-15.tst.err")
+set_tests_properties(HDP-dumpvg-15-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-14" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;324;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-15 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;sds2_dim1_samename.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-15.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-15.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-15 PROPERTIES  DEPENDS "HDP-dumpvg-15-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;324;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-16-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-16.tst" "dumpvg-16.tst.err")
+set_tests_properties(HDP-dumpvg-16-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-15" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;327;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-16 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;-h;grtdfi322.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-16.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-16.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-16 PROPERTIES  DEPENDS "HDP-dumpvg-16-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;327;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-17-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpvg-17.tst" "dumpvg-17.tst.err")
+set_tests_properties(HDP-dumpvg-17-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-16" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;328;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpvg-17 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpvg;grtdfi322.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpvg-17.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpvg-17.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpvg-17 PROPERTIES  DEPENDS "HDP-dumpvg-17-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;328;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-1-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-1.tst" "dumpgr-1.tst.err")
+set_tests_properties(HDP-dumpgr-1-clearall-objects PROPERTIES  DEPENDS "HDP-dumpvg-17" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;331;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-1 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-1.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-1.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-1 PROPERTIES  DEPENDS "HDP-dumpgr-1-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;331;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-2-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-2.tst" "dumpgr-2.tst.err")
+set_tests_properties(HDP-dumpgr-2-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-1" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;332;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-i;0,1,3;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-2.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-2.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-2 PROPERTIES  DEPENDS "HDP-dumpgr-2-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;332;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-3-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-3.tst" "dumpgr-3.tst.err")
+set_tests_properties(HDP-dumpgr-3-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-2" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;333;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-i;0;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-3.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-3.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-3 PROPERTIES  DEPENDS "HDP-dumpgr-3-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;333;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-4-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-4.tst" "dumpgr-4.tst.err")
+set_tests_properties(HDP-dumpgr-4-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-3" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;334;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-4 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-n;Image_array_5;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-4.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-4.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-4 PROPERTIES  DEPENDS "HDP-dumpgr-4-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;334;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-5-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-5.tst" "dumpgr-5.tst.err")
+set_tests_properties(HDP-dumpgr-5-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-4" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;335;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-5 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-r;6,2,3;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-5.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-5.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-5 PROPERTIES  DEPENDS "HDP-dumpgr-5-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;335;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-6-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-6.tst" "dumpgr-6.tst.err")
+set_tests_properties(HDP-dumpgr-6-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-5" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;336;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-6 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-r;6;-d;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-6.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-6.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-6 PROPERTIES  DEPENDS "HDP-dumpgr-6-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;336;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-7-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-7.tst" "dumpgr-7.tst.err")
+set_tests_properties(HDP-dumpgr-7-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-6" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;337;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-7 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-o;my.dat;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-7.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-7.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-7 PROPERTIES  DEPENDS "HDP-dumpgr-7-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;337;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-clear-my.dat "/usr/bin/cmake" "-E" "remove" "my.dat")
+set_tests_properties(HDP-clear-my.dat PROPERTIES  DEPENDS "HDP-dumpgr-7" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;338;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-8-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-8.tst" "dumpgr-8.tst.err")
+set_tests_properties(HDP-dumpgr-8-clearall-objects PROPERTIES  DEPENDS "HDP-clear-my.dat" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;348;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-8 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-o;mybin.dat;-b;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-8.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-8.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-8 PROPERTIES  DEPENDS "HDP-dumpgr-8-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;348;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-clear-mybin.dat "/usr/bin/cmake" "-E" "remove" "mybin.dat")
+set_tests_properties(HDP-clear-mybin.dat PROPERTIES  DEPENDS "HDP-dumpgr-8" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;349;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-9-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-9.tst" "dumpgr-9.tst.err")
+set_tests_properties(HDP-dumpgr-9-clearall-objects PROPERTIES  DEPENDS "HDP-clear-mybin.dat" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;359;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-9 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;grtdfui83.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-9.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-9.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-9 PROPERTIES  DEPENDS "HDP-dumpgr-9-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;359;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-10-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-10.tst" "dumpgr-10.tst.err")
+set_tests_properties(HDP-dumpgr-10-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-9" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;360;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-10 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;grtdfui84.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-10.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-10.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-10 PROPERTIES  DEPENDS "HDP-dumpgr-10-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;360;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-11-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-11.tst" "dumpgr-11.tst.err")
+set_tests_properties(HDP-dumpgr-11-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-10" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;361;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-11 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;grtdfui162.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-11.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-11.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-11 PROPERTIES  DEPENDS "HDP-dumpgr-11-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;361;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-12-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-12.tst" "dumpgr-12.tst.err")
+set_tests_properties(HDP-dumpgr-12-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-11" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;364;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-12 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;grtdfi322.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-12.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-12.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-12 PROPERTIES  DEPENDS "HDP-dumpgr-12-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;364;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-13-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-13.tst" "dumpgr-13.tst.err")
+set_tests_properties(HDP-dumpgr-13-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-12" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;369;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-13 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-p;Image_with_Palette.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-13.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-13.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-13 PROPERTIES  DEPENDS "HDP-dumpgr-13-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;369;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-14-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-14.tst" "dumpgr-14.tst.err")
+set_tests_properties(HDP-dumpgr-14-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-13" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;370;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-14 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-h;Image_with_Palette.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-14.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-14.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-14 PROPERTIES  DEPENDS "HDP-dumpgr-14-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;370;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-15-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-15.tst" "dumpgr-15.tst.err")
+set_tests_properties(HDP-dumpgr-15-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-14" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;371;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-15 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-r;2,4;-pd;Image_with_Palette.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-15.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-15.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-15 PROPERTIES  DEPENDS "HDP-dumpgr-15-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;371;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-16-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-16.tst" "dumpgr-16.tst.err")
+set_tests_properties(HDP-dumpgr-16-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-15" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;374;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-16 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-r;6;-d;-s;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-16.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-16.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-16 PROPERTIES  DEPENDS "HDP-dumpgr-16-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;374;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-17-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-17.tst" "dumpgr-17.tst.err")
+set_tests_properties(HDP-dumpgr-17-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-16" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;377;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-17 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-r;6;-m;1;grtdfui82.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-17.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-17.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-17 PROPERTIES  DEPENDS "HDP-dumpgr-17-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;377;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-18-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-18.tst" "dumpgr-18.tst.err")
+set_tests_properties(HDP-dumpgr-18-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-17" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;380;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-18 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-c;grtdfi322.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-18.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-18.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-18 PROPERTIES  DEPENDS "HDP-dumpgr-18-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;380;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-19-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-19.tst" "dumpgr-19.tst.err")
+set_tests_properties(HDP-dumpgr-19-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-18" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;383;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-19 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;-g;-l;grtdfi322.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-19.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-19.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-19 PROPERTIES  DEPENDS "HDP-dumpgr-19-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;383;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-20-clearall-objects "/usr/bin/cmake" "-E" "remove" "dumpgr-20.tst" "dumpgr-20.tst.err")
+set_tests_properties(HDP-dumpgr-20-clearall-objects PROPERTIES  DEPENDS "HDP-dumpgr-19" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;151;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;386;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+add_test(HDP-dumpgr-20 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdp-shared" "-D" "TEST_ARGS:STRING=dumpgr;IMCOMP.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/dumper" "-D" "TEST_OUTPUT=dumpgr-20.tst" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=dumpgr-20.out" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDP-dumpgr-20 PROPERTIES  DEPENDS "HDP-dumpgr-20-clearall-objects" LABELS "HDF4_MFHDF_DUMPER" _BACKTRACE_TRIPLES "/root/repo/mfhdf/dumper/CMakeTests.cmake;164;add_test;/root/repo/mfhdf/dumper/CMakeTests.cmake;386;ADD_H4_TEST;/root/repo/mfhdf/dumper/CMakeTests.cmake;0;;/root/repo/mfhdf/dumper/CMakeLists.txt;38;include;/root/repo/mfhdf/dumper/CMakeLists.txt;0;")
+set_directory_properties(PROPERTIES LABELS "“MFHDF”")
@@ -0,0 +1,150 @@
+File name: grtdfui84.hdf 
+
+	 Image  Name = Image_array_5
+	 Index = 0
+	 Type= 8-bit unsigned integer
+	 width=10; height=5
+	 Ref. = 5
+	 ncomps = 4
+	 Interlace mode= PIXEL
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                0 0 0 0 1 1 1 1 2 2 2 2 3 3 3 3 4 4 4 4 5 5 5 5 6 
+                6 6 6 7 7 7 7 8 8 8 8 9 9 9 9 10 10 10 10 11 11 11 
+                11 12 12 12 12 13 13 13 13 14 14 14 14 15 15 15 15 
+                16 16 16 16 17 17 17 17 18 18 18 18 19 19 19 19 20 
+                20 20 20 21 21 21 21 22 22 22 22 23 23 23 23 24 24 
+                24 24 25 25 25 25 26 26 26 26 27 27 27 27 28 28 28 
+                28 29 29 29 29 30 30 30 30 31 31 31 31 32 32 32 32 
+                33 33 33 33 34 34 34 34 35 35 35 35 36 36 36 36 37 
+                37 37 37 38 38 38 38 39 39 39 39 40 40 40 40 41 41 
+                41 41 42 42 42 42 43 43 43 43 44 44 44 44 45 45 45 
+                45 46 46 46 46 47 47 47 47 48 48 48 48 49 49 49 49 
+
+	 Image  Name = Raster Image #1
+	 Index = 1
+	 Type= 8-bit unsigned char
+	 width=13; height=15
+	 Ref. = 2
+	 ncomps = 3
+	 Interlace mode= PIXEL
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                0 0 0 1 1 1 2 2 2 3 3 3 4 4 4 5 5 5 6 6 6 7 7 7 8 
+                8 8 9 9 9 10 10 10 11 11 11 12 12 12 1 1 1 2 2 2 3 
+                3 3 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 10 10 11 
+                11 11 12 12 12 13 13 13 2 2 2 3 3 3 4 4 4 5 5 5 6 
+                6 6 7 7 7 8 8 8 9 9 9 10 10 10 11 11 11 12 12 12 13 
+                13 13 14 14 14 3 3 3 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 
+                9 9 9 10 10 10 11 11 11 12 12 12 13 13 13 14 14 14 
+                15 15 15 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 10 
+                10 11 11 11 12 12 12 13 13 13 14 14 14 15 15 15 16 
+                16 16 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 10 10 11 11 
+                11 12 12 12 13 13 13 14 14 14 15 15 15 16 16 16 17 
+                17 17 6 6 6 7 7 7 8 8 8 9 9 9 10 10 10 11 11 11 12 
+                12 12 13 13 13 14 14 14 15 15 15 16 16 16 17 17 17 
+                18 18 18 7 7 7 8 8 8 9 9 9 10 10 10 11 11 11 12 12 
+                12 13 13 13 14 14 14 15 15 15 16 16 16 17 17 17 18 
+                18 18 19 19 19 8 8 8 9 9 9 10 10 10 11 11 11 12 12 
+                12 13 13 13 14 14 14 15 15 15 16 16 16 17 17 17 18 
+                18 18 19 19 19 20 20 20 9 9 9 10 10 10 11 11 11 12 
+                12 12 13 13 13 14 14 14 15 15 15 16 16 16 17 17 17 
+                18 18 18 19 19 19 20 20 20 21 21 21 10 10 10 11 11 
+                11 12 12 12 13 13 13 14 14 14 15 15 15 16 16 16 17 
+                17 17 18 18 18 19 19 19 20 20 20 21 21 21 22 22 22 
+                11 11 11 12 12 12 13 13 13 14 14 14 15 15 15 16 16 
+                16 17 17 17 18 18 18 19 19 19 20 20 20 21 21 21 22 
+                22 22 23 23 23 12 12 12 13 13 13 14 14 14 15 15 15 
+                16 16 16 17 17 17 18 18 18 19 19 19 20 20 20 21 21 
+                21 22 22 22 23 23 23 24 24 24 13 13 13 14 14 14 15 
+                15 15 16 16 16 17 17 17 18 18 18 19 19 19 20 20 20 
+                21 21 21 22 22 22 23 23 23 24 24 24 25 25 25 14 14 
+                14 15 15 15 16 16 16 17 17 17 18 18 18 19 19 19 20 
+                20 20 21 21 21 22 22 22 23 23 23 24 24 24 25 25 25 
+                26 26 26 
+
+	 Image  Name = Raster Image #2
+	 Index = 2
+	 Type= 8-bit unsigned char
+	 width=13; height=15
+	 Ref. = 3
+	 ncomps = 3
+	 Interlace mode= LINE
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                0 1 2 3 4 5 6 7 8 9 10 11 12 0 1 2 3 4 5 6 7 8 9 10 
+                11 12 0 1 2 3 4 5 6 7 8 9 10 11 12 1 1 3 3 5 5 7 7 
+                9 9 11 11 13 1 1 3 3 5 5 7 7 9 9 11 11 13 1 1 3 3 
+                5 5 7 7 9 9 11 11 13 2 3 2 3 6 7 6 7 10 11 10 11 14 
+                2 3 2 3 6 7 6 7 10 11 10 11 14 2 3 2 3 6 7 6 7 10 
+                11 10 11 14 3 3 3 3 7 7 7 7 11 11 11 11 15 3 3 3 3 
+                7 7 7 7 11 11 11 11 15 3 3 3 3 7 7 7 7 11 11 11 11 
+                15 4 5 6 7 4 5 6 7 12 13 14 15 12 4 5 6 7 4 5 6 7 
+                12 13 14 15 12 4 5 6 7 4 5 6 7 12 13 14 15 12 5 5 
+                7 7 5 5 7 7 13 13 15 15 13 5 5 7 7 5 5 7 7 13 13 15 
+                15 13 5 5 7 7 5 5 7 7 13 13 15 15 13 6 7 6 7 6 7 6 
+                7 14 15 14 15 14 6 7 6 7 6 7 6 7 14 15 14 15 14 6 
+                7 6 7 6 7 6 7 14 15 14 15 14 7 7 7 7 7 7 7 7 15 15 
+                15 15 15 7 7 7 7 7 7 7 7 15 15 15 15 15 7 7 7 7 7 
+                7 7 7 15 15 15 15 15 8 9 10 11 12 13 14 15 8 9 10 
+                11 12 8 9 10 11 12 13 14 15 8 9 10 11 12 8 9 10 11 
+                12 13 14 15 8 9 10 11 12 9 9 11 11 13 13 15 15 9 9 
+                11 11 13 9 9 11 11 13 13 15 15 9 9 11 11 13 9 9 11 
+                11 13 13 15 15 9 9 11 11 13 10 11 10 11 14 15 14 15 
+                10 11 10 11 14 10 11 10 11 14 15 14 15 10 11 10 11 
+                14 10 11 10 11 14 15 14 15 10 11 10 11 14 11 11 11 
+                11 15 15 15 15 11 11 11 11 15 11 11 11 11 15 15 15 
+                15 11 11 11 11 15 11 11 11 11 15 15 15 15 11 11 11 
+                11 15 12 13 14 15 12 13 14 15 12 13 14 15 12 12 13 
+                14 15 12 13 14 15 12 13 14 15 12 12 13 14 15 12 13 
+                14 15 12 13 14 15 12 13 13 15 15 13 13 15 15 13 13 
+                15 15 13 13 13 15 15 13 13 15 15 13 13 15 15 13 13 
+                13 15 15 13 13 15 15 13 13 15 15 13 14 15 14 15 14 
+                15 14 15 14 15 14 15 14 14 15 14 15 14 15 14 15 14 
+                15 14 15 14 14 15 14 15 14 15 14 15 14 15 14 15 14 
+
+	 Image  Name = Raster Image #3
+	 Index = 3
+	 Type= 8-bit unsigned char
+	 width=13; height=15
+	 Ref. = 4
+	 ncomps = 3
+	 Interlace mode= COMPONENT
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                0 1 2 3 4 5 6 7 8 9 10 11 12 1 0 3 2 5 4 7 6 9 8 11 
+                10 13 2 3 0 1 6 7 4 5 10 11 8 9 14 3 2 1 0 7 6 5 4 
+                11 10 9 8 15 4 5 6 7 0 1 2 3 12 13 14 15 8 5 4 7 6 
+                1 0 3 2 13 12 15 14 9 6 7 4 5 2 3 0 1 14 15 12 13 
+                10 7 6 5 4 3 2 1 0 15 14 13 12 11 8 9 10 11 12 13 
+                14 15 0 1 2 3 4 9 8 11 10 13 12 15 14 1 0 3 2 5 10 
+                11 8 9 14 15 12 13 2 3 0 1 6 11 10 9 8 15 14 13 12 
+                3 2 1 0 7 12 13 14 15 8 9 10 11 4 5 6 7 0 13 12 15 
+                14 9 8 11 10 5 4 7 6 1 14 15 12 13 10 11 8 9 6 7 4 
+                5 2 0 1 2 3 4 5 6 7 8 9 10 11 12 1 0 3 2 5 4 7 6 9 
+                8 11 10 13 2 3 0 1 6 7 4 5 10 11 8 9 14 3 2 1 0 7 
+                6 5 4 11 10 9 8 15 4 5 6 7 0 1 2 3 12 13 14 15 8 5 
+                4 7 6 1 0 3 2 13 12 15 14 9 6 7 4 5 2 3 0 1 14 15 
+                12 13 10 7 6 5 4 3 2 1 0 15 14 13 12 11 8 9 10 11 
+                12 13 14 15 0 1 2 3 4 9 8 11 10 13 12 15 14 1 0 3 
+                2 5 10 11 8 9 14 15 12 13 2 3 0 1 6 11 10 9 8 15 14 
+                13 12 3 2 1 0 7 12 13 14 15 8 9 10 11 4 5 6 7 0 13 
+                12 15 14 9 8 11 10 5 4 7 6 1 14 15 12 13 10 11 8 9 
+                6 7 4 5 2 0 1 2 3 4 5 6 7 8 9 10 11 12 1 0 3 2 5 4 
+                7 6 9 8 11 10 13 2 3 0 1 6 7 4 5 10 11 8 9 14 3 2 
+                1 0 7 6 5 4 11 10 9 8 15 4 5 6 7 0 1 2 3 12 13 14 
+                15 8 5 4 7 6 1 0 3 2 13 12 15 14 9 6 7 4 5 2 3 0 1 
+                14 15 12 13 10 7 6 5 4 3 2 1 0 15 14 13 12 11 8 9 
+                10 11 12 13 14 15 0 1 2 3 4 9 8 11 10 13 12 15 14 
+                1 0 3 2 5 10 11 8 9 14 15 12 13 2 3 0 1 6 11 10 9 
+                8 15 14 13 12 3 2 1 0 7 12 13 14 15 8 9 10 11 4 5 
+                6 7 0 13 12 15 14 9 8 11 10 5 4 7 6 1 14 15 12 13 
+                10 11 8 9 6 7 4 5 2 
@@ -0,0 +1,97 @@
+File name: grtdfi322.hdf 
+
+    File attributes:
+	 Attr0: Name = File contents
+		 Type = 8-bit signed char 
+		 Count= 16
+		 Value =  image data \000\000\000\000
+
+	 Image  Name = Raster Image #0
+	 Index = 0
+	 Type= 8-bit unsigned char
+	 width=5; height=6
+	 Ref. = 7
+	 ncomps = 1
+	 Interlace mode= PIXEL
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 1
+	 Attr0: Name = Value range
+		 Type = 32-bit signed integer 
+		 Count= 2
+		 Value = 0 60 
+	 Data : 
+                1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 
+                21 22 23 24 25 26 27 28 29 30 
+
+	 Image  Name = Image_array_5
+	 Index = 1
+	 Type= 32-bit signed integer
+	 width=10; height=5
+	 Ref. = 5
+	 ncomps = 2
+	 Interlace mode= PIXEL
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                0 5 0 5 1 6 1 6 2 7 2 7 3 8 3 8 4 9 4 9 10 15 10 15 
+                11 16 11 16 12 17 12 17 13 18 13 18 14 19 14 19 20 
+                25 20 25 21 26 21 26 22 27 22 27 23 28 23 28 24 29 
+                24 29 30 35 30 35 31 36 31 36 32 37 32 37 33 38 33 
+                38 34 39 34 39 40 45 40 45 41 46 41 46 42 47 42 47 
+                43 48 43 48 44 49 44 49 
+
+	 Image  Name = Raster Image #3
+	 Index = 2
+	 Type= 8-bit unsigned char
+	 width=5; height=6
+	 Ref. = 1
+	 ncomps = 3
+	 Interlace mode= PIXEL
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 
+                21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 
+                38 39 40 41 42 43 44 45 46 47 48 49 50 51 52 53 54 
+                55 56 57 58 59 60 61 62 63 64 65 66 67 68 69 70 71 
+                72 73 74 75 76 77 78 79 80 81 82 83 84 85 86 87 88 
+                89 90 
+
+	 Image  Name = Raster Image #4
+	 Index = 3
+	 Type= 8-bit unsigned char
+	 width=5; height=6
+	 Ref. = 3
+	 ncomps = 3
+	 Interlace mode= LINE
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 
+                21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 
+                38 39 40 41 42 43 44 45 46 47 48 49 50 51 52 53 54 
+                55 56 57 58 59 60 61 62 63 64 65 66 67 68 69 70 71 
+                72 73 74 75 76 77 78 79 80 81 82 83 84 85 86 87 88 
+                89 90 
+
+	 Image  Name = Raster Image #5
+	 Index = 4
+	 Type= 8-bit unsigned char
+	 width=5; height=6
+	 Ref. = 4
+	 ncomps = 3
+	 Interlace mode= COMPONENT
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 
+                21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 
+                38 39 40 41 42 43 44 45 46 47 48 49 50 51 52 53 54 
+                55 56 57 58 59 60 61 62 63 64 65 66 67 68 69 70 71 
+                72 73 74 75 76 77 78 79 80 81 82 83 84 85 86 87 88 
+                89 90 
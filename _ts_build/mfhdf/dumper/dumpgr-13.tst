@@ -0,0 +1,82 @@
+File name: Image_with_Palette.hdf 
+
+	 Raster Image Ref. = 2
+	 Palette: 3 components; 256 entries
+	 Palette Data: 
+                0 0 8 1 0 8 2 0 8 3 0 8 4 0 8 5 0 8 6 0 8 7 0 8 8 
+                0 8 9 0 8 10 0 8 11 0 8 12 0 8 13 0 8 14 0 8 15 0 
+                8 16 0 8 17 0 8 18 0 8 19 0 8 20 0 8 21 0 8 22 0 8 
+                23 0 8 24 0 8 25 0 8 26 0 8 27 0 8 28 0 8 29 0 8 30 
+                0 8 31 0 8 32 0 8 33 0 8 34 0 8 35 0 8 36 0 8 37 0 
+                8 38 0 8 39 0 8 40 0 8 41 0 8 42 0 8 43 0 8 44 0 8 
+                45 0 8 46 0 8 47 0 8 48 0 8 49 0 8 50 0 8 51 0 8 52 
+                0 8 53 0 8 54 0 8 55 0 8 56 0 8 57 0 8 58 0 8 59 0 
+                8 60 0 8 61 0 8 62 0 8 63 0 8 64 0 8 65 0 8 66 0 8 
+                67 0 8 68 0 8 69 0 8 70 0 8 71 0 8 72 0 8 73 0 8 74 
+                0 8 75 0 8 76 0 8 77 0 8 78 0 8 79 0 8 80 0 8 81 0 
+                8 82 0 8 83 0 8 84 0 8 85 0 8 86 0 8 87 0 8 88 0 8 
+                89 0 8 90 0 8 91 0 8 92 0 8 93 0 8 94 0 8 95 0 8 96 
+                0 8 97 0 8 98 0 8 99 0 8 100 0 8 101 0 8 102 0 8 103 
+                0 8 104 0 8 105 0 8 106 0 8 107 0 8 108 0 8 109 0 
+                8 110 0 8 111 0 8 112 0 8 113 0 8 114 0 8 115 0 8 
+                116 0 8 117 0 8 118 0 8 119 0 8 120 0 8 121 0 8 122 
+                0 8 123 0 8 124 0 8 125 0 8 126 0 8 127 0 8 128 0 
+                8 129 0 8 130 0 8 131 0 8 132 0 8 133 0 8 134 0 8 
+                135 0 8 136 0 8 137 0 8 138 0 8 139 0 8 140 0 8 141 
+                0 8 142 0 8 143 0 8 144 0 8 145 0 8 146 0 8 147 0 
+                8 148 0 8 149 0 8 150 0 8 151 0 8 152 0 8 153 0 8 
+                154 0 8 155 0 8 156 0 8 157 0 8 158 0 8 159 0 8 160 
+                0 8 161 0 8 162 0 8 163 0 8 164 0 8 165 0 8 166 0 
+                8 167 0 8 168 0 8 169 0 8 170 0 8 171 0 8 172 0 8 
+                173 0 8 174 0 8 175 0 8 176 0 8 177 0 8 178 0 8 179 
+                0 8 180 0 8 181 0 8 182 0 8 183 0 8 184 0 8 185 0 
+                8 186 0 8 187 0 8 188 0 8 189 0 8 190 0 8 191 0 8 
+                192 0 8 193 0 8 194 0 8 195 0 8 196 0 8 197 0 8 198 
+                0 8 199 0 8 200 0 8 201 0 8 202 0 8 203 0 8 204 0 
+                8 205 0 8 206 0 8 207 0 8 208 0 8 209 0 8 210 0 8 
+                211 0 8 212 0 8 213 0 8 214 0 8 215 0 8 216 0 8 217 
+                0 8 218 0 8 219 0 8 220 0 8 221 0 8 222 0 8 223 0 
+                8 224 0 8 225 0 8 226 0 8 227 0 8 228 0 8 229 0 8 
+                230 0 8 231 0 8 232 0 8 233 0 8 234 0 8 235 0 8 236 
+                0 8 237 0 8 238 0 8 239 0 8 240 0 8 241 0 8 242 0 
+                8 243 0 8 244 0 8 245 0 8 246 0 8 247 0 8 248 0 8 
+                249 0 8 250 0 8 251 0 8 252 0 8 253 0 8 254 0 8 255 
+                0 8 
+
+	 Raster Image Ref. = 3
+	 Palette: 3 components; 256 entries
+	 Palette Data: 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 
+                4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 
+                8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+                2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 2 4 8 
+
+	 Raster Image Ref. = 4
+	 No palette data
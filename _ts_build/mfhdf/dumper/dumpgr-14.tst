@@ -0,0 +1,34 @@
+File name: Image_with_Palette.hdf 
+
+	 Image  Name = Image with Palette
+	 Index = 0
+	 Type= 8-bit unsigned integer
+	 width=5; height=5
+	 Ref. = 2
+	 ncomps = 2
+	 Interlace mode= PIXEL
+	 Palette: 3 components; 256 entries
+	 Compression method = NONE
+	 Number of attributes = 0
+
+	 Image  Name = Second Image w/pal
+	 Index = 1
+	 Type= 8-bit unsigned integer
+	 width=5; height=5
+	 Ref. = 3
+	 ncomps = 2
+	 Interlace mode= PIXEL
+	 Palette: 3 components; 256 entries
+	 Compression method = NONE
+	 Number of attributes = 0
+
+	 Image  Name = Last Image: no pal
+	 Index = 2
+	 Type= 8-bit unsigned integer
+	 width=5; height=5
+	 Ref. = 4
+	 ncomps = 2
+	 Interlace mode= PIXEL
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
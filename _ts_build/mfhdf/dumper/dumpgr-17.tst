@@ -0,0 +1,19 @@
+File name: grtdfui82.hdf 
+
+	 Image  Name = Image_array_5
+	 Index = 0
+	 Type= 8-bit unsigned integer
+	 width=10; height=5
+	 Ref. = 6
+	 ncomps = 2
+	 Interlace mode= PIXEL
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 10 11 12 13 
+                14 15 16 17 18 19 10 11 12 13 14 15 16 17 18 19 20 
+                21 22 23 24 25 26 27 28 29 20 21 22 23 24 25 26 27 
+                28 29 30 31 32 33 34 35 36 37 38 39 30 31 32 33 34 
+                35 36 37 38 39 40 41 42 43 44 45 46 47 48 49 40 41 
+                42 43 44 45 46 47 48 49 
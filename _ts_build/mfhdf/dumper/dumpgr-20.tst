@@ -0,0 +1,27 @@
+File name: IMCOMP.hdf 
+
+	 Image  Name = Raster Image #0
+	 Index = 0
+	 Type= 8-bit unsigned char
+	 width=4; height=4
+	 Ref. = 2
+	 ncomps = 1
+	 Interlace mode= PIXEL
+	 No palette
+	 Compression method = NONE
+	 Number of attributes = 0
+	 Data : 
+                0 1 2 3 10 11 12 13 20 21 22 23 30 31 32 33 
+
+	 Image  Name = Raster Image #1
+	 Index = 1
+	 Type= 8-bit unsigned char
+	 width=4; height=4
+	 Ref. = 3
+	 ncomps = 1
+	 Interlace mode= PIXEL
+	 Palette: 3 components; 256 entries
+	 Compression method = IMCOMP
+	 Number of attributes = 0
+	 Data : 
+                1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 
@@ -0,0 +1,32 @@
+File name: tdf24.hdf 
+
+Data model: 24-bit raster image without palette.
+	width=13;  height=15
+	reference=3
+	*data is not compressed.
+	Data : 
+     0 0 0 1 1 1 2 2 2 3 3 3 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 
+     10 10 11 11 11 12 12 12 1 1 1 1 1 1 3 3 3 3 3 3 5 5 5 5 5 5 7 
+     7 7 7 7 7 9 9 9 9 9 9 11 11 11 11 11 11 13 13 13 2 2 2 3 3 3 
+     2 2 2 3 3 3 6 6 6 7 7 7 6 6 6 7 7 7 10 10 10 11 11 11 10 10 10 
+     11 11 11 14 14 14 3 3 3 3 3 3 3 3 3 3 3 3 7 7 7 7 7 7 7 7 7 7 
+     7 7 11 11 11 11 11 11 11 11 11 11 11 11 15 15 15 4 4 4 5 5 5 
+     6 6 6 7 7 7 4 4 4 5 5 5 6 6 6 7 7 7 12 12 12 13 13 13 14 14 14 
+     15 15 15 12 12 12 5 5 5 5 5 5 7 7 7 7 7 7 5 5 5 5 5 5 7 7 7 7 
+     7 7 13 13 13 13 13 13 15 15 15 15 15 15 13 13 13 6 6 6 7 7 7 
+     6 6 6 7 7 7 6 6 6 7 7 7 6 6 6 7 7 7 14 14 14 15 15 15 14 14 14 
+     15 15 15 14 14 14 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 
+     7 7 15 15 15 15 15 15 15 15 15 15 15 15 15 15 15 8 8 8 9 9 9 
+     10 10 10 11 11 11 12 12 12 13 13 13 14 14 14 15 15 15 8 8 8 9 
+     9 9 10 10 10 11 11 11 12 12 12 9 9 9 9 9 9 11 11 11 11 11 11 
+     13 13 13 13 13 13 15 15 15 15 15 15 9 9 9 9 9 9 11 11 11 11 11 
+     11 13 13 13 10 10 10 11 11 11 10 10 10 11 11 11 14 14 14 15 15 
+     15 14 14 14 15 15 15 10 10 10 11 11 11 10 10 10 11 11 11 14 14 
+     14 11 11 11 11 11 11 11 11 11 11 11 11 15 15 15 15 15 15 15 15 
+     15 15 15 15 11 11 11 11 11 11 11 11 11 11 11 11 15 15 15 12 12 
+     12 13 13 13 14 14 14 15 15 15 12 12 12 13 13 13 14 14 14 15 15 
+     15 12 12 12 13 13 13 14 14 14 15 15 15 12 12 12 13 13 13 13 13 
+     13 15 15 15 15 15 15 13 13 13 13 13 13 15 15 15 15 15 15 13 13 
+     13 13 13 13 15 15 15 15 15 15 13 13 13 14 14 14 15 15 15 14 14 
+     14 15 15 15 14 14 14 15 15 15 14 14 14 15 15 15 14 14 14 15 15 
+     15 14 14 14 15 15 15 14 14 14 
@@ -0,0 +1,91 @@
+File name: tdf24.hdf 
+
+Data model: 24-bit raster image without palette.
+	width=13;  height=15
+	reference=2
+	*data is not compressed.
+	Data : 
+     0 0 0 1 1 1 2 2 2 3 3 3 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 
+     10 10 11 11 11 12 12 12 1 1 1 2 2 2 3 3 3 4 4 4 5 5 5 6 6 6 7 
+     7 7 8 8 8 9 9 9 10 10 10 11 11 11 12 12 12 13 13 13 2 2 2 3 3 
+     3 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 10 10 11 11 11 12 12 
+     12 13 13 13 14 14 14 3 3 3 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 9 9 
+     9 10 10 10 11 11 11 12 12 12 13 13 13 14 14 14 15 15 15 4 4 4 
+     5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 10 10 11 11 11 12 12 12 13 13 
+     13 14 14 14 15 15 15 16 16 16 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 
+     10 10 11 11 11 12 12 12 13 13 13 14 14 14 15 15 15 16 16 16 17 
+     17 17 6 6 6 7 7 7 8 8 8 9 9 9 10 10 10 11 11 11 12 12 12 13 13 
+     13 14 14 14 15 15 15 16 16 16 17 17 17 18 18 18 7 7 7 8 8 8 9 
+     9 9 10 10 10 11 11 11 12 12 12 13 13 13 14 14 14 15 15 15 16 
+     16 16 17 17 17 18 18 18 19 19 19 8 8 8 9 9 9 10 10 10 11 11 11 
+     12 12 12 13 13 13 14 14 14 15 15 15 16 16 16 17 17 17 18 18 18 
+     19 19 19 20 20 20 9 9 9 10 10 10 11 11 11 12 12 12 13 13 13 14 
+     14 14 15 15 15 16 16 16 17 17 17 18 18 18 19 19 19 20 20 20 21 
+     21 21 10 10 10 11 11 11 12 12 12 13 13 13 14 14 14 15 15 15 16 
+     16 16 17 17 17 18 18 18 19 19 19 20 20 20 21 21 21 22 22 22 11 
+     11 11 12 12 12 13 13 13 14 14 14 15 15 15 16 16 16 17 17 17 18 
+     18 18 19 19 19 20 20 20 21 21 21 22 22 22 23 23 23 12 12 12 13 
+     13 13 14 14 14 15 15 15 16 16 16 17 17 17 18 18 18 19 19 19 20 
+     20 20 21 21 21 22 22 22 23 23 23 24 24 24 13 13 13 14 14 14 15 
+     15 15 16 16 16 17 17 17 18 18 18 19 19 19 20 20 20 21 21 21 22 
+     22 22 23 23 23 24 24 24 25 25 25 14 14 14 15 15 15 16 16 16 17 
+     17 17 18 18 18 19 19 19 20 20 20 21 21 21 22 22 22 23 23 23 24 
+     24 24 25 25 25 26 26 26 
+Data model: 24-bit raster image without palette.
+	width=13;  height=15
+	reference=3
+	*data is not compressed.
+	Data : 
+     0 0 0 1 1 1 2 2 2 3 3 3 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 
+     10 10 11 11 11 12 12 12 1 1 1 1 1 1 3 3 3 3 3 3 5 5 5 5 5 5 7 
+     7 7 7 7 7 9 9 9 9 9 9 11 11 11 11 11 11 13 13 13 2 2 2 3 3 3 
+     2 2 2 3 3 3 6 6 6 7 7 7 6 6 6 7 7 7 10 10 10 11 11 11 10 10 10 
+     11 11 11 14 14 14 3 3 3 3 3 3 3 3 3 3 3 3 7 7 7 7 7 7 7 7 7 7 
+     7 7 11 11 11 11 11 11 11 11 11 11 11 11 15 15 15 4 4 4 5 5 5 
+     6 6 6 7 7 7 4 4 4 5 5 5 6 6 6 7 7 7 12 12 12 13 13 13 14 14 14 
+     15 15 15 12 12 12 5 5 5 5 5 5 7 7 7 7 7 7 5 5 5 5 5 5 7 7 7 7 
+     7 7 13 13 13 13 13 13 15 15 15 15 15 15 13 13 13 6 6 6 7 7 7 
+     6 6 6 7 7 7 6 6 6 7 7 7 6 6 6 7 7 7 14 14 14 15 15 15 14 14 14 
+     15 15 15 14 14 14 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 7 
+     7 7 15 15 15 15 15 15 15 15 15 15 15 15 15 15 15 8 8 8 9 9 9 
+     10 10 10 11 11 11 12 12 12 13 13 13 14 14 14 15 15 15 8 8 8 9 
+     9 9 10 10 10 11 11 11 12 12 12 9 9 9 9 9 9 11 11 11 11 11 11 
+     13 13 13 13 13 13 15 15 15 15 15 15 9 9 9 9 9 9 11 11 11 11 11 
+     11 13 13 13 10 10 10 11 11 11 10 10 10 11 11 11 14 14 14 15 15 
+     15 14 14 14 15 15 15 10 10 10 11 11 11 10 10 10 11 11 11 14 14 
+     14 11 11 11 11 11 11 11 11 11 11 11 11 15 15 15 15 15 15 15 15 
+     15 15 15 15 11 11 11 11 11 11 11 11 11 11 11 11 15 15 15 12 12 
+     12 13 13 13 14 14 14 15 15 15 12 12 12 13 13 13 14 14 14 15 15 
+     15 12 12 12 13 13 13 14 14 14 15 15 15 12 12 12 13 13 13 13 13 
+     13 15 15 15 15 15 15 13 13 13 13 13 13 15 15 15 15 15 15 13 13 
+     13 13 13 13 15 15 15 15 15 15 13 13 13 14 14 14 15 15 15 14 14 
+     14 15 15 15 14 14 14 15 15 15 14 14 14 15 15 15 14 14 14 15 15 
+     15 14 14 14 15 15 15 14 14 14 
+Data model: 24-bit raster image without palette.
+	width=13;  height=15
+	reference=4
+	*data is not compressed.
+	Data : 
+     0 0 0 1 1 1 2 2 2 3 3 3 4 4 4 5 5 5 6 6 6 7 7 7 8 8 8 9 9 9 10 
+     10 10 11 11 11 12 12 12 1 1 1 0 0 0 3 3 3 2 2 2 5 5 5 4 4 4 7 
+     7 7 6 6 6 9 9 9 8 8 8 11 11 11 10 10 10 13 13 13 2 2 2 3 3 3 
+     0 0 0 1 1 1 6 6 6 7 7 7 4 4 4 5 5 5 10 10 10 11 11 11 8 8 8 9 
+     9 9 14 14 14 3 3 3 2 2 2 1 1 1 0 0 0 7 7 7 6 6 6 5 5 5 4 4 4 
+     11 11 11 10 10 10 9 9 9 8 8 8 15 15 15 4 4 4 5 5 5 6 6 6 7 7 
+     7 0 0 0 1 1 1 2 2 2 3 3 3 12 12 12 13 13 13 14 14 14 15 15 15 
+     8 8 8 5 5 5 4 4 4 7 7 7 6 6 6 1 1 1 0 0 0 3 3 3 2 2 2 13 13 13 
+     12 12 12 15 15 15 14 14 14 9 9 9 6 6 6 7 7 7 4 4 4 5 5 5 2 2 
+     2 3 3 3 0 0 0 1 1 1 14 14 14 15 15 15 12 12 12 13 13 13 10 10 
+     10 7 7 7 6 6 6 5 5 5 4 4 4 3 3 3 2 2 2 1 1 1 0 0 0 15 15 15 14 
+     14 14 13 13 13 12 12 12 11 11 11 8 8 8 9 9 9 10 10 10 11 11 11 
+     12 12 12 13 13 13 14 14 14 15 15 15 0 0 0 1 1 1 2 2 2 3 3 3 4 
+     4 4 9 9 9 8 8 8 11 11 11 10 10 10 13 13 13 12 12 12 15 15 15 
+     14 14 14 1 1 1 0 0 0 3 3 3 2 2 2 5 5 5 10 10 10 11 11 11 8 8 
+     8 9 9 9 14 14 14 15 15 15 12 12 12 13 13 13 2 2 2 3 3 3 0 0 0 
+     1 1 1 6 6 6 11 11 11 10 10 10 9 9 9 8 8 8 15 15 15 14 14 14 13 
+     13 13 12 12 12 3 3 3 2 2 2 1 1 1 0 0 0 7 7 7 12 12 12 13 13 13 
+     14 14 14 15 15 15 8 8 8 9 9 9 10 10 10 11 11 11 4 4 4 5 5 5 6 
+     6 6 7 7 7 0 0 0 13 13 13 12 12 12 15 15 15 14 14 14 9 9 9 8 8 
+     8 11 11 11 10 10 10 5 5 5 4 4 4 7 7 7 6 6 6 1 1 1 14 14 14 15 
+     15 15 12 12 12 13 13 13 10 10 10 11 11 11 8 8 8 9 9 9 6 6 6 7 
+     7 7 4 4 4 5 5 5 2 2 2 
@@ -0,0 +1,96 @@
+File name: sds_compressed.hdf 
+
+Variable Name = SDSgzip
+	 Index = 0
+	 Type= 32-bit signed integer
+	 Ref. = 2
+	 Compression method = DEFLATE
+		 Deflate level = 6
+	 Compression ratio (original:compressed) = 5.42:1
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim0
+		 Size = 16
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim1
+		 Size = 5
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Data : 
+                1 2 3 4 5 
+                2 3 4 5 6 
+                3 4 5 6 7 
+                4 5 6 7 8 
+                5 6 7 8 9 
+                6 7 8 9 10 
+                7 8 9 10 11 
+                8 9 10 11 12 
+                9 10 11 12 13 
+                10 11 12 13 14 
+                11 12 13 14 15 
+                12 13 14 15 16 
+                13 14 15 16 17 
+                14 15 16 17 18 
+                15 16 17 18 19 
+                16 17 18 19 20 
+
+
+
+Variable Name = SDSskiphuff
+	 Index = 1
+	 Type= 32-bit signed integer
+	 Ref. = 4
+	 Compression method = SKPHUFF
+		 Skipping unit size = 4
+	 Compression ratio (original:compressed) = 4.16:1
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim2
+		 Size = 16
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim3
+		 Size = 5
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Data : 
+                1 2 3 4 5 
+                2 3 4 5 6 
+                3 4 5 6 7 
+                4 5 6 7 8 
+                5 6 7 8 9 
+                6 7 8 9 10 
+                7 8 9 10 11 
+                8 9 10 11 12 
+                9 10 11 12 13 
+                10 11 12 13 14 
+                11 12 13 14 15 
+                12 13 14 15 16 
+                13 14 15 16 17 
+                14 15 16 17 18 
+                15 16 17 18 19 
+                16 17 18 19 20 
+
+
+
+Variable Name = SDSszip
+	 Index = 2
+	 Type= 32-bit signed integer
+	 Ref. = 6
+	 Compression method = SZIP
+		 Compression information is unavailable (no SZIP library)
+	 Compression ratio (original:compressed) = 2.67:1
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim4
+		 Size = 16
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim5
+		 Size = 5
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Data : 
+		 <SZIP library is not available>
+		 <Unable to read SZIP compressed data>
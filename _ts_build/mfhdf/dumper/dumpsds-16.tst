@@ -0,0 +1,297 @@
+File name: sds_empty_many.hdf 
+
+File attributes:
+	 Attr0: Name = file_contents
+		 Type = 8-bit signed char 
+		 Count= 116
+		 Value = This file was generated by the program ma
+                         nySDSs.c in hdf4/mfhdf/dumper/testfiles t
+                         o test the flag -k in hdp dumpsds\000
+
+Variable Name = data1
+	 Index = 0
+	 Type= 16-bit signed integer
+	 Ref. = 2
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim0
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim1
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data2
+	 Index = 1
+	 Type= 16-bit signed integer
+	 Ref. = 3
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim2
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim3
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data3
+	 Index = 2
+	 Type= 16-bit signed integer
+	 Ref. = 4
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim4
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim5
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data4
+	 Index = 3
+	 Type= 16-bit signed integer
+	 Ref. = 5
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim6
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim7
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data6
+	 Index = 5
+	 Type= 16-bit signed integer
+	 Ref. = 7
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim10
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim11
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data9
+	 Index = 8
+	 Type= 16-bit signed integer
+	 Ref. = 10
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim16
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim17
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data14
+	 Index = 13
+	 Type= 16-bit signed integer
+	 Ref. = 15
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim26
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim27
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data15
+	 Index = 14
+	 Type= 16-bit signed integer
+	 Ref. = 16
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim28
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim29
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data16
+	 Index = 15
+	 Type= 16-bit signed integer
+	 Ref. = 17
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim30
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim31
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data22
+	 Index = 21
+	 Type= 16-bit signed integer
+	 Ref. = 23
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim42
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim43
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data23
+	 Index = 22
+	 Type= 16-bit signed integer
+	 Ref. = 24
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim44
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim45
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data24
+	 Index = 23
+	 Type= 16-bit signed integer
+	 Ref. = 25
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim46
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim47
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data27
+	 Index = 26
+	 Type= 16-bit signed integer
+	 Ref. = 28
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim52
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim53
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data34
+	 Index = 33
+	 Type= 16-bit signed integer
+	 Ref. = 35
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim66
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim67
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data35
+	 Index = 34
+	 Type= 16-bit signed integer
+	 Ref. = 36
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim68
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim69
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data36
+	 Index = 35
+	 Type= 16-bit signed integer
+	 Ref. = 37
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim70
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim71
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data37
+	 Index = 36
+	 Type= 16-bit signed integer
+	 Ref. = 38
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim72
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim73
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+
+Variable Name = data40
+	 Index = 39
+	 Type= 16-bit signed integer
+	 Ref. = 41
+	 Compression method = NONE
+	 Rank = 2
+	 Number of attributes = 0
+	 Dim0: Name=fakeDim78
+		 Size = UNLIMITED (currently 0)
+		 Scale Type = number-type not set
+		 Number of attributes = 0
+	 Dim1: Name=fakeDim79
+		 Size = 10
+		 Scale Type = number-type not set
+		 Number of attributes = 0
@@ -0,0 +1,108 @@
+File name: Roy.nc 
+
+File attributes:
+	 Attr0: Name = source
+		 Type = 8-bit signed char 
+		 Count= 18
+		 Value = COADS CMR5 DATASET
+	 Attr1: Name = DATA_TYPE
+		 Type = 8-bit signed char 
+		 Count= 13
+		 Value = MONTHLY MEANS
+	 Attr2: Name = COORD_SYSTEM
+		 Type = 8-bit signed char 
+		 Count= 12
+		 Value = GEOGRAPHICAL
+	 Attr3: Name = COMMENT
+		 Type = 8-bit signed char 
+		 Count= 81
+		 Value = month since 1980-1-1 00:00:00, Latitudes:
+                            32.0,  36.0 Longitudes: -140.0,-136.0
+	 Attr4: Name = Platform_Types
+		 Type = 8-bit signed char 
+		 Count= 13
+		 Value = All Platforms
+
+Variable Name = lon
+	 Index = 0
+	 Type= 32-bit floating point
+	 Rank = 1
+	 Number of attributes = 3
+	 Dim0: Name=lon
+		 Size = 2
+		 Scale Type = 32-bit floating point
+		 Number of attributes = 3
+	 Attr0: Name = long_name
+		 Type = 8-bit signed char 
+		 Count= 9
+		 Value = longitude
+	 Attr1: Name = FORTRAN_format
+		 Type = 8-bit signed char 
+		 Count= 4
+		 Value = f6.1
+	 Attr2: Name = units
+		 Type = 8-bit signed char 
+		 Count= 12
+		 Value = degrees_east
+	 Data : 
+                -140.000000 -138.000000 
+
+
+Variable Name = lat
+	 Index = 1
+	 Type= 32-bit floating point
+	 Rank = 1
+	 Number of attributes = 3
+	 Dim0: Name=lat
+		 Size = 2
+		 Scale Type = 32-bit floating point
+		 Number of attributes = 3
+	 Attr0: Name = long_name
+		 Type = 8-bit signed char 
+		 Count= 8
+		 Value = latitude
+	 Attr1: Name = FORTRAN_format
+		 Type = 8-bit signed char 
+		 Count= 4
+		 Value = f6.1
+	 Attr2: Name = units
+		 Type = 8-bit signed char 
+		 Count= 13
+		 Value = degrees_north
+	 Data : 
+                34.000000 32.000000 
+
+
+Variable Name = ref_time
+	 Index = 2
+	 Type= 32-bit floating point
+	 Rank = 1
+	 Number of attributes = 3
+	 Dim0: Name=ref_time
+		 Size = UNLIMITED (currently 48)
+		 Scale Type = 32-bit floating point
+		 Number of attributes = 3
+	 Attr0: Name = long_name
+		 Type = 8-bit signed char 
+		 Count= 14
+		 Value = reference time
+	 Attr1: Name = FORTRAN_format
+		 Type = 8-bit signed char 
+		 Count= 3
+		 Value = i10
+	 Attr2: Name = units
+		 Type = 8-bit signed char 
+		 Count= 6
+		 Value = months
+	 Data : 
+                0.000000 1.000000 2.000000 3.000000 4.000000 5.000000 
+                6.000000 7.000000 8.000000 9.000000 10.000000 11.000000 
+                12.000000 13.000000 14.000000 15.000000 16.000000 
+                17.000000 18.000000 19.000000 20.000000 21.000000 
+                22.000000 23.000000 24.000000 25.000000 26.000000 
+                27.000000 28.000000 29.000000 30.000000 31.000000 
+                32.000000 33.000000 34.000000 35.000000 36.000000 
+                37.000000 38.000000 39.000000 40.000000 41.000000 
+                42.000000 43.000000 44.000000 45.000000 46.000000 
+                47.000000 
+
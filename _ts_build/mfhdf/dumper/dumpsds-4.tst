@@ -0,0 +1 @@
+SDS with name 'Time': not found
@@ -0,0 +1,11 @@
+0.000000 100.000000 
+
+0.000000 1.000000 2.000000 3.000000 
+10.000000 11.000000 12.000000 13.000000 
+20.000000 21.000000 22.000000 23.000000 
+
+100.000000 101.000000 102.000000 103.000000 
+110.000000 111.000000 112.000000 113.000000 
+120.000000 121.000000 122.000000 123.000000 
+
+
@@ -0,0 +1,12144 @@
+File name: tvset.hdf 
+
+Vdata: 0
+   tag = 1962; reference = 1235;
+   number of records = 100; interlace = FULL_INTERLACE (0);
+   fields = [FIELD_name_HERE];
+   record size (in bytes) = 4;
+   name = Float Vdata; class = Test object;
+   number of attributes = 0 
+- field index 0: [FIELD_name_HERE], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+00       0.000000  ; 1.000000  ; 2.000000  ; 3.000000  ; 
+04       4.000000  ; 5.000000  ; 6.000000  ; 7.000000  ; 
+08       8.000000  ; 9.000000  ; 10.000000  ; 11.000000  ; 
+12       12.000000  ; 13.000000  ; 14.000000  ; 15.000000  ; 
+16       16.000000  ; 17.000000  ; 18.000000  ; 19.000000  ; 
+20       20.000000  ; 21.000000  ; 22.000000  ; 23.000000  ; 
+24       24.000000  ; 25.000000  ; 26.000000  ; 27.000000  ; 
+28       28.000000  ; 29.000000  ; 30.000000  ; 31.000000  ; 
+32       32.000000  ; 33.000000  ; 34.000000  ; 35.000000  ; 
+36       36.000000  ; 37.000000  ; 38.000000  ; 39.000000  ; 
+40       40.000000  ; 41.000000  ; 42.000000  ; 43.000000  ; 
+44       44.000000  ; 45.000000  ; 46.000000  ; 47.000000  ; 
+48       48.000000  ; 49.000000  ; 50.000000  ; 51.000000  ; 
+52       52.000000  ; 53.000000  ; 54.000000  ; 55.000000  ; 
+56       56.000000  ; 57.000000  ; 58.000000  ; 59.000000  ; 
+60       60.000000  ; 61.000000  ; 62.000000  ; 63.000000  ; 
+64       64.000000  ; 65.000000  ; 66.000000  ; 67.000000  ; 
+68       68.000000  ; 69.000000  ; 70.000000  ; 71.000000  ; 
+72       72.000000  ; 73.000000  ; 74.000000  ; 75.000000  ; 
+76       76.000000  ; 77.000000  ; 78.000000  ; 79.000000  ; 
+80       80.000000  ; 81.000000  ; 82.000000  ; 83.000000  ; 
+84       84.000000  ; 85.000000  ; 86.000000  ; 87.000000  ; 
+88       88.000000  ; 89.000000  ; 90.000000  ; 91.000000  ; 
+92       92.000000  ; 93.000000  ; 94.000000  ; 95.000000  ; 
+96       96.000000  ; 97.000000  ; 98.000000  ; 99.000000  ; 
+
+
+Vdata: 1
+   tag = 1962; reference = 1236;
+   number of records = 100; interlace = FULL_INTERLACE (0);
+   fields = [DIFFERENT_FIELD_NAME];
+   record size (in bytes) = 8;
+   name = Integer Vdata; class = Test object;
+   number of attributes = 0 
+- field index 0: [DIFFERENT_FIELD_NAME], type=24, order=2
+   number of attributes = 0 
+Loc.     Data
+00       0 1  ; 2 3  ; 4 5  ; 6 7  ; 
+04       8 9  ; 10 11  ; 12 13  ; 14 15  ; 
+08       16 17  ; 18 19  ; 20 21  ; 22 23  ; 
+12       24 25  ; 26 27  ; 28 29  ; 30 31  ; 
+16       32 33  ; 34 35  ; 36 37  ; 38 39  ; 
+20       40 41  ; 42 43  ; 44 45  ; 46 47  ; 
+24       48 49  ; 50 51  ; 52 53  ; 54 55  ; 
+28       56 57  ; 58 59  ; 60 61  ; 62 63  ; 
+32       64 65  ; 66 67  ; 68 69  ; 70 71  ; 
+36       72 73  ; 74 75  ; 76 77  ; 78 79  ; 
+40       80 81  ; 82 83  ; 84 85  ; 86 87  ; 
+44       88 89  ; 90 91  ; 92 93  ; 94 95  ; 
+48       96 97  ; 98 99  ; 100 101  ; 102 103  ; 
+52       104 105  ; 106 107  ; 108 109  ; 110 111  ; 
+56       112 113  ; 114 115  ; 116 117  ; 118 119  ; 
+60       120 121  ; 122 123  ; 124 125  ; 126 127  ; 
+64       128 129  ; 130 131  ; 132 133  ; 134 135  ; 
+68       136 137  ; 138 139  ; 140 141  ; 142 143  ; 
+72       144 145  ; 146 147  ; 148 149  ; 150 151  ; 
+76       152 153  ; 154 155  ; 156 157  ; 158 159  ; 
+80       160 161  ; 162 163  ; 164 165  ; 166 167  ; 
+84       168 169  ; 170 171  ; 172 173  ; 174 175  ; 
+88       176 177  ; 178 179  ; 180 181  ; 182 183  ; 
+92       184 185  ; 186 187  ; 188 189  ; 190 191  ; 
+96       192 193  ; 194 195  ; 196 197  ; 198 199  ; 
+
+
+Vdata: 2
+   tag = 1962; reference = 1237;
+   number of records = 100; interlace = FULL_INTERLACE (0);
+   fields = [A, B];
+   record size (in bytes) = 8;
+   name = Mixed Vdata; class = No class specified;
+   number of attributes = 0 
+- field index 0: [A], type=5, order=1
+   number of attributes = 0 
+- field index 1: [B], type=24, order=1
+   number of attributes = 0 
+Loc.     Data
+00       0.000000  0  ; 2.000000  1  ; 4.000000  2  ; 
+03       6.000000  3  ; 8.000000  4  ; 10.000000  5  ; 
+06       12.000000  6  ; 14.000000  7  ; 16.000000  8  ; 
+09       18.000000  9  ; 20.000000  10  ; 22.000000  11  ; 
+12       24.000000  12  ; 26.000000  13  ; 28.000000  14  ; 
+15       30.000000  15  ; 32.000000  16  ; 34.000000  17  ; 
+18       36.000000  18  ; 38.000000  19  ; 40.000000  20  ; 
+21       42.000000  21  ; 44.000000  22  ; 46.000000  23  ; 
+24       48.000000  24  ; 50.000000  25  ; 52.000000  26  ; 
+27       54.000000  27  ; 56.000000  28  ; 58.000000  29  ; 
+30       60.000000  30  ; 62.000000  31  ; 64.000000  32  ; 
+33       66.000000  33  ; 68.000000  34  ; 70.000000  35  ; 
+36       72.000000  36  ; 74.000000  37  ; 76.000000  38  ; 
+39       78.000000  39  ; 80.000000  40  ; 82.000000  41  ; 
+42       84.000000  42  ; 86.000000  43  ; 88.000000  44  ; 
+45       90.000000  45  ; 92.000000  46  ; 94.000000  47  ; 
+48       96.000000  48  ; 98.000000  49  ; 100.000000  50  ; 
+51       102.000000  51  ; 104.000000  52  ; 106.000000  53  ; 
+54       108.000000  54  ; 110.000000  55  ; 112.000000  56  ; 
+57       114.000000  57  ; 116.000000  58  ; 118.000000  59  ; 
+60       120.000000  60  ; 122.000000  61  ; 124.000000  62  ; 
+63       126.000000  63  ; 128.000000  64  ; 130.000000  65  ; 
+66       132.000000  66  ; 134.000000  67  ; 136.000000  68  ; 
+69       138.000000  69  ; 140.000000  70  ; 142.000000  71  ; 
+72       144.000000  72  ; 146.000000  73  ; 148.000000  74  ; 
+75       150.000000  75  ; 152.000000  76  ; 154.000000  77  ; 
+78       156.000000  78  ; 158.000000  79  ; 160.000000  80  ; 
+81       162.000000  81  ; 164.000000  82  ; 166.000000  83  ; 
+84       168.000000  84  ; 170.000000  85  ; 172.000000  86  ; 
+87       174.000000  87  ; 176.000000  88  ; 178.000000  89  ; 
+90       180.000000  90  ; 182.000000  91  ; 184.000000  92  ; 
+93       186.000000  93  ; 188.000000  94  ; 190.000000  95  ; 
+96       192.000000  96  ; 194.000000  97  ; 196.000000  98  ; 
+99       198.000000  99  ; 
+
+Vdata: 3
+   tag = 1962; reference = 1238;
+   number of records = 10; interlace = FULL_INTERLACE (0);
+   fields = [STATION_NAME, VALUES, FLOATS];
+   record size (in bytes) = 18;
+   name = Multi-Order Vdata; class = No class specified;
+   number of attributes = 0 
+- field index 0: [STATION_NAME], type=4, order=2
+   number of attributes = 0 
+- field index 1: [VALUES], type=24, order=3
+   number of attributes = 0 
+- field index 2: [FLOATS], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        a b  0 1 2  15.500000  ; c d  3 4 5  16.000000  ; 
+2        e f  6 7 8  16.500000  ; g h  9 10 11  17.000000  ; 
+4        i j  12 13 14  17.500000  ; k l  15 16 17  18.000000  ; 
+6        m n  18 19 20  18.500000  ; o p  21 22 23  19.000000  ; 
+8        q r  24 25 26  19.500000  ; s t  27 28 29  20.000000  ; 
+
+
+Vdata: 4
+   tag = 1962; reference = 1239;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-0; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 5
+   tag = 1962; reference = 1240;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-1; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 6
+   tag = 1962; reference = 1241;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-2; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 7
+   tag = 1962; reference = 1242;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-3; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 8
+   tag = 1962; reference = 1243;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-4; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 9
+   tag = 1962; reference = 1244;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-5; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 10
+   tag = 1962; reference = 1245;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-6; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 11
+   tag = 1962; reference = 1246;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-7; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 12
+   tag = 1962; reference = 1247;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-8; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 13
+   tag = 1962; reference = 1248;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-9; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 14
+   tag = 1962; reference = 1249;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-10; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 15
+   tag = 1962; reference = 1250;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-11; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 16
+   tag = 1962; reference = 1251;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-12; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 17
+   tag = 1962; reference = 1252;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-13; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 18
+   tag = 1962; reference = 1253;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-14; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 19
+   tag = 1962; reference = 1254;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-15; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 20
+   tag = 1962; reference = 1255;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-16; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 21
+   tag = 1962; reference = 1256;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-17; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 22
+   tag = 1962; reference = 1257;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-18; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 23
+   tag = 1962; reference = 1258;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-19; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 24
+   tag = 1962; reference = 1259;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-20; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 25
+   tag = 1962; reference = 1260;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-21; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 26
+   tag = 1962; reference = 1261;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-22; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 27
+   tag = 1962; reference = 1262;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-23; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 28
+   tag = 1962; reference = 1263;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-24; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 29
+   tag = 1962; reference = 1264;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-25; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 30
+   tag = 1962; reference = 1265;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-26; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 31
+   tag = 1962; reference = 1266;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-27; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 32
+   tag = 1962; reference = 1267;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-28; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 33
+   tag = 1962; reference = 1268;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-29; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 34
+   tag = 1962; reference = 1269;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-30; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 35
+   tag = 1962; reference = 1270;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-31; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 36
+   tag = 1962; reference = 1271;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-32; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 37
+   tag = 1962; reference = 1272;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-33; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 38
+   tag = 1962; reference = 1273;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-34; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 39
+   tag = 1962; reference = 1274;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-35; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 40
+   tag = 1962; reference = 1275;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-36; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 41
+   tag = 1962; reference = 1276;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-37; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 42
+   tag = 1962; reference = 1277;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-38; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 43
+   tag = 1962; reference = 1278;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-39; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 44
+   tag = 1962; reference = 1279;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-40; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 45
+   tag = 1962; reference = 1280;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-41; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 46
+   tag = 1962; reference = 1281;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-42; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 47
+   tag = 1962; reference = 1282;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-43; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 48
+   tag = 1962; reference = 1283;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-44; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 49
+   tag = 1962; reference = 1284;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-45; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 50
+   tag = 1962; reference = 1285;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-46; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 51
+   tag = 1962; reference = 1286;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-47; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 52
+   tag = 1962; reference = 1287;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-48; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 53
+   tag = 1962; reference = 1288;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-49; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 54
+   tag = 1962; reference = 1289;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-50; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 55
+   tag = 1962; reference = 1290;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-51; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 56
+   tag = 1962; reference = 1291;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-52; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 57
+   tag = 1962; reference = 1292;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-53; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 58
+   tag = 1962; reference = 1293;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-54; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 59
+   tag = 1962; reference = 1294;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-55; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 60
+   tag = 1962; reference = 1295;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-56; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 61
+   tag = 1962; reference = 1296;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-57; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 62
+   tag = 1962; reference = 1297;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-58; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 63
+   tag = 1962; reference = 1298;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-59; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 64
+   tag = 1962; reference = 1299;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-60; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 65
+   tag = 1962; reference = 1300;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-61; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 66
+   tag = 1962; reference = 1301;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-62; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 67
+   tag = 1962; reference = 1302;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-63; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 68
+   tag = 1962; reference = 1303;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-64; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 69
+   tag = 1962; reference = 1304;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-65; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 70
+   tag = 1962; reference = 1305;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-66; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 71
+   tag = 1962; reference = 1306;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-67; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 72
+   tag = 1962; reference = 1307;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-68; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 73
+   tag = 1962; reference = 1308;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-69; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 74
+   tag = 1962; reference = 1309;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-70; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 75
+   tag = 1962; reference = 1310;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-71; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 76
+   tag = 1962; reference = 1311;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-72; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 77
+   tag = 1962; reference = 1312;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-73; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 78
+   tag = 1962; reference = 1313;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-74; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 79
+   tag = 1962; reference = 1314;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-75; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 80
+   tag = 1962; reference = 1315;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-76; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 81
+   tag = 1962; reference = 1316;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-77; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 82
+   tag = 1962; reference = 1317;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-78; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 83
+   tag = 1962; reference = 1318;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-79; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 84
+   tag = 1962; reference = 1319;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-80; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 85
+   tag = 1962; reference = 1320;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-81; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 86
+   tag = 1962; reference = 1321;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-82; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 87
+   tag = 1962; reference = 1322;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-83; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 88
+   tag = 1962; reference = 1323;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-84; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 89
+   tag = 1962; reference = 1324;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-85; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 90
+   tag = 1962; reference = 1325;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-86; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 91
+   tag = 1962; reference = 1326;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-87; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 92
+   tag = 1962; reference = 1327;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-88; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 93
+   tag = 1962; reference = 1328;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-89; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 94
+   tag = 1962; reference = 1329;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-90; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 95
+   tag = 1962; reference = 1330;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-91; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 96
+   tag = 1962; reference = 1331;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-92; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 97
+   tag = 1962; reference = 1332;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-93; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 98
+   tag = 1962; reference = 1333;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-94; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 99
+   tag = 1962; reference = 1334;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-95; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 100
+   tag = 1962; reference = 1335;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-96; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 101
+   tag = 1962; reference = 1336;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-97; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 102
+   tag = 1962; reference = 1337;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-98; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 103
+   tag = 1962; reference = 1338;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-99; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 104
+   tag = 1962; reference = 1339;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-100; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 105
+   tag = 1962; reference = 1340;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-101; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 106
+   tag = 1962; reference = 1341;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-102; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 107
+   tag = 1962; reference = 1342;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-103; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 108
+   tag = 1962; reference = 1343;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-104; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 109
+   tag = 1962; reference = 1344;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-105; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 110
+   tag = 1962; reference = 1345;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-106; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 111
+   tag = 1962; reference = 1346;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-107; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 112
+   tag = 1962; reference = 1347;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-108; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 113
+   tag = 1962; reference = 1348;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-109; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 114
+   tag = 1962; reference = 1349;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-110; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 115
+   tag = 1962; reference = 1350;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-111; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 116
+   tag = 1962; reference = 1351;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-112; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 117
+   tag = 1962; reference = 1352;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-113; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 118
+   tag = 1962; reference = 1353;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-114; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 119
+   tag = 1962; reference = 1354;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-115; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 120
+   tag = 1962; reference = 1355;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-116; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 121
+   tag = 1962; reference = 1356;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-117; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 122
+   tag = 1962; reference = 1357;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-118; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 123
+   tag = 1962; reference = 1358;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-119; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 124
+   tag = 1962; reference = 1359;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-120; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 125
+   tag = 1962; reference = 1360;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-121; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 126
+   tag = 1962; reference = 1361;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-122; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 127
+   tag = 1962; reference = 1362;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-123; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 128
+   tag = 1962; reference = 1363;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-124; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 129
+   tag = 1962; reference = 1364;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-125; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 130
+   tag = 1962; reference = 1365;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-126; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 131
+   tag = 1962; reference = 1366;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-127; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 132
+   tag = 1962; reference = 1367;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-128; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 133
+   tag = 1962; reference = 1368;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-129; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 134
+   tag = 1962; reference = 1369;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-130; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 135
+   tag = 1962; reference = 1370;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-131; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 136
+   tag = 1962; reference = 1371;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-132; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 137
+   tag = 1962; reference = 1372;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-133; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 138
+   tag = 1962; reference = 1373;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-134; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 139
+   tag = 1962; reference = 1374;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-135; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 140
+   tag = 1962; reference = 1375;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-136; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 141
+   tag = 1962; reference = 1376;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-137; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 142
+   tag = 1962; reference = 1377;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-138; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 143
+   tag = 1962; reference = 1378;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-139; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 144
+   tag = 1962; reference = 1379;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-140; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 145
+   tag = 1962; reference = 1380;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-141; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 146
+   tag = 1962; reference = 1381;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-142; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 147
+   tag = 1962; reference = 1382;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-143; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 148
+   tag = 1962; reference = 1383;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-144; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 149
+   tag = 1962; reference = 1384;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-145; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 150
+   tag = 1962; reference = 1385;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-146; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 151
+   tag = 1962; reference = 1386;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-147; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 152
+   tag = 1962; reference = 1387;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-148; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 153
+   tag = 1962; reference = 1388;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-149; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 154
+   tag = 1962; reference = 1389;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-150; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 155
+   tag = 1962; reference = 1390;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-151; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 156
+   tag = 1962; reference = 1391;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-152; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 157
+   tag = 1962; reference = 1392;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-153; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 158
+   tag = 1962; reference = 1393;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-154; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 159
+   tag = 1962; reference = 1394;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-155; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 160
+   tag = 1962; reference = 1395;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-156; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 161
+   tag = 1962; reference = 1396;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-157; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 162
+   tag = 1962; reference = 1397;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-158; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 163
+   tag = 1962; reference = 1398;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-159; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 164
+   tag = 1962; reference = 1399;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-160; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 165
+   tag = 1962; reference = 1400;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-161; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 166
+   tag = 1962; reference = 1401;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-162; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 167
+   tag = 1962; reference = 1402;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-163; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 168
+   tag = 1962; reference = 1403;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-164; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 169
+   tag = 1962; reference = 1404;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-165; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 170
+   tag = 1962; reference = 1405;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-166; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 171
+   tag = 1962; reference = 1406;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-167; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 172
+   tag = 1962; reference = 1407;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-168; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 173
+   tag = 1962; reference = 1408;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-169; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 174
+   tag = 1962; reference = 1409;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-170; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 175
+   tag = 1962; reference = 1410;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-171; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 176
+   tag = 1962; reference = 1411;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-172; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 177
+   tag = 1962; reference = 1412;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-173; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 178
+   tag = 1962; reference = 1413;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-174; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 179
+   tag = 1962; reference = 1414;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-175; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 180
+   tag = 1962; reference = 1415;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-176; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 181
+   tag = 1962; reference = 1416;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-177; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 182
+   tag = 1962; reference = 1417;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-178; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 183
+   tag = 1962; reference = 1418;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-179; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 184
+   tag = 1962; reference = 1419;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-180; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 185
+   tag = 1962; reference = 1420;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-181; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 186
+   tag = 1962; reference = 1421;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-182; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 187
+   tag = 1962; reference = 1422;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-183; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 188
+   tag = 1962; reference = 1423;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-184; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 189
+   tag = 1962; reference = 1424;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-185; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 190
+   tag = 1962; reference = 1425;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-186; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 191
+   tag = 1962; reference = 1426;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-187; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 192
+   tag = 1962; reference = 1427;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-188; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 193
+   tag = 1962; reference = 1428;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-189; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 194
+   tag = 1962; reference = 1429;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-190; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 195
+   tag = 1962; reference = 1430;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-191; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 196
+   tag = 1962; reference = 1431;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-192; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 197
+   tag = 1962; reference = 1432;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-193; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 198
+   tag = 1962; reference = 1433;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-194; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 199
+   tag = 1962; reference = 1434;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-195; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 200
+   tag = 1962; reference = 1435;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-196; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 201
+   tag = 1962; reference = 1436;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-197; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 202
+   tag = 1962; reference = 1437;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-198; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 203
+   tag = 1962; reference = 1438;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-199; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 204
+   tag = 1962; reference = 1439;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-200; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 205
+   tag = 1962; reference = 1440;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-201; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 206
+   tag = 1962; reference = 1441;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-202; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 207
+   tag = 1962; reference = 1442;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-203; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 208
+   tag = 1962; reference = 1443;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-204; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 209
+   tag = 1962; reference = 1444;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-205; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 210
+   tag = 1962; reference = 1445;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-206; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 211
+   tag = 1962; reference = 1446;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-207; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 212
+   tag = 1962; reference = 1447;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-208; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 213
+   tag = 1962; reference = 1448;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-209; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 214
+   tag = 1962; reference = 1449;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-210; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 215
+   tag = 1962; reference = 1450;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-211; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 216
+   tag = 1962; reference = 1451;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-212; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 217
+   tag = 1962; reference = 1452;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-213; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 218
+   tag = 1962; reference = 1453;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-214; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 219
+   tag = 1962; reference = 1454;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-215; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 220
+   tag = 1962; reference = 1455;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-216; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 221
+   tag = 1962; reference = 1456;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-217; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 222
+   tag = 1962; reference = 1457;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-218; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 223
+   tag = 1962; reference = 1458;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-219; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 224
+   tag = 1962; reference = 1459;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-220; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 225
+   tag = 1962; reference = 1460;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-221; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 226
+   tag = 1962; reference = 1461;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-222; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 227
+   tag = 1962; reference = 1462;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-223; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 228
+   tag = 1962; reference = 1463;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-224; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 229
+   tag = 1962; reference = 1464;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-225; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 230
+   tag = 1962; reference = 1465;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-226; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 231
+   tag = 1962; reference = 1466;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-227; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 232
+   tag = 1962; reference = 1467;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-228; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 233
+   tag = 1962; reference = 1468;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-229; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 234
+   tag = 1962; reference = 1469;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-230; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 235
+   tag = 1962; reference = 1470;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-231; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 236
+   tag = 1962; reference = 1471;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-232; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 237
+   tag = 1962; reference = 1472;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-233; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 238
+   tag = 1962; reference = 1473;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-234; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 239
+   tag = 1962; reference = 1474;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-235; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 240
+   tag = 1962; reference = 1475;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-236; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 241
+   tag = 1962; reference = 1476;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-237; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 242
+   tag = 1962; reference = 1477;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-238; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 243
+   tag = 1962; reference = 1478;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-239; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 244
+   tag = 1962; reference = 1479;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-240; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 245
+   tag = 1962; reference = 1480;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-241; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 246
+   tag = 1962; reference = 1481;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-242; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 247
+   tag = 1962; reference = 1482;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-243; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 248
+   tag = 1962; reference = 1483;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-244; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 249
+   tag = 1962; reference = 1484;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-245; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 250
+   tag = 1962; reference = 1485;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-246; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 251
+   tag = 1962; reference = 1486;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-247; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 252
+   tag = 1962; reference = 1487;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-248; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 253
+   tag = 1962; reference = 1488;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-249; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 254
+   tag = 1962; reference = 1489;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-250; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 255
+   tag = 1962; reference = 1490;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-251; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 256
+   tag = 1962; reference = 1491;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-252; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 257
+   tag = 1962; reference = 1492;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-253; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 258
+   tag = 1962; reference = 1493;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-254; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 259
+   tag = 1962; reference = 1494;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-255; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 260
+   tag = 1962; reference = 1495;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-256; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 261
+   tag = 1962; reference = 1496;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-257; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 262
+   tag = 1962; reference = 1497;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-258; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 263
+   tag = 1962; reference = 1498;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-259; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 264
+   tag = 1962; reference = 1499;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-260; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 265
+   tag = 1962; reference = 1500;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-261; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 266
+   tag = 1962; reference = 1501;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-262; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 267
+   tag = 1962; reference = 1502;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-263; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 268
+   tag = 1962; reference = 1503;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-264; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 269
+   tag = 1962; reference = 1504;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-265; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 270
+   tag = 1962; reference = 1505;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-266; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 271
+   tag = 1962; reference = 1506;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-267; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 272
+   tag = 1962; reference = 1507;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-268; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 273
+   tag = 1962; reference = 1508;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-269; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 274
+   tag = 1962; reference = 1509;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-270; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 275
+   tag = 1962; reference = 1510;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-271; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 276
+   tag = 1962; reference = 1511;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-272; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 277
+   tag = 1962; reference = 1512;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-273; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 278
+   tag = 1962; reference = 1513;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-274; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 279
+   tag = 1962; reference = 1514;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-275; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 280
+   tag = 1962; reference = 1515;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-276; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 281
+   tag = 1962; reference = 1516;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-277; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 282
+   tag = 1962; reference = 1517;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-278; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 283
+   tag = 1962; reference = 1518;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-279; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 284
+   tag = 1962; reference = 1519;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-280; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 285
+   tag = 1962; reference = 1520;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-281; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 286
+   tag = 1962; reference = 1521;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-282; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 287
+   tag = 1962; reference = 1522;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-283; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 288
+   tag = 1962; reference = 1523;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-284; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 289
+   tag = 1962; reference = 1524;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-285; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 290
+   tag = 1962; reference = 1525;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-286; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 291
+   tag = 1962; reference = 1526;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-287; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 292
+   tag = 1962; reference = 1527;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-288; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 293
+   tag = 1962; reference = 1528;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-289; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 294
+   tag = 1962; reference = 1529;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-290; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 295
+   tag = 1962; reference = 1530;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-291; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 296
+   tag = 1962; reference = 1531;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-292; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 297
+   tag = 1962; reference = 1532;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-293; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 298
+   tag = 1962; reference = 1533;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-294; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 299
+   tag = 1962; reference = 1534;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-295; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 300
+   tag = 1962; reference = 1535;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-296; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 301
+   tag = 1962; reference = 1536;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-297; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 302
+   tag = 1962; reference = 1537;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-298; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 303
+   tag = 1962; reference = 1538;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-299; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 304
+   tag = 1962; reference = 1539;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-300; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 305
+   tag = 1962; reference = 1540;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-301; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 306
+   tag = 1962; reference = 1541;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-302; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 307
+   tag = 1962; reference = 1542;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-303; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 308
+   tag = 1962; reference = 1543;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-304; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 309
+   tag = 1962; reference = 1544;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-305; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 310
+   tag = 1962; reference = 1545;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-306; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 311
+   tag = 1962; reference = 1546;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-307; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 312
+   tag = 1962; reference = 1547;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-308; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 313
+   tag = 1962; reference = 1548;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-309; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 314
+   tag = 1962; reference = 1549;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-310; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 315
+   tag = 1962; reference = 1550;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-311; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 316
+   tag = 1962; reference = 1551;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-312; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 317
+   tag = 1962; reference = 1552;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-313; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 318
+   tag = 1962; reference = 1553;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-314; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 319
+   tag = 1962; reference = 1554;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-315; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 320
+   tag = 1962; reference = 1555;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-316; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 321
+   tag = 1962; reference = 1556;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-317; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 322
+   tag = 1962; reference = 1557;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-318; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 323
+   tag = 1962; reference = 1558;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-319; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 324
+   tag = 1962; reference = 1559;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-320; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 325
+   tag = 1962; reference = 1560;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-321; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 326
+   tag = 1962; reference = 1561;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-322; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 327
+   tag = 1962; reference = 1562;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-323; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 328
+   tag = 1962; reference = 1563;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-324; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 329
+   tag = 1962; reference = 1564;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-325; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 330
+   tag = 1962; reference = 1565;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-326; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 331
+   tag = 1962; reference = 1566;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-327; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 332
+   tag = 1962; reference = 1567;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-328; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 333
+   tag = 1962; reference = 1568;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-329; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 334
+   tag = 1962; reference = 1569;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-330; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 335
+   tag = 1962; reference = 1570;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-331; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 336
+   tag = 1962; reference = 1571;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-332; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 337
+   tag = 1962; reference = 1572;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-333; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 338
+   tag = 1962; reference = 1573;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-334; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 339
+   tag = 1962; reference = 1574;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-335; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 340
+   tag = 1962; reference = 1575;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-336; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 341
+   tag = 1962; reference = 1576;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-337; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 342
+   tag = 1962; reference = 1577;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-338; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 343
+   tag = 1962; reference = 1578;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-339; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 344
+   tag = 1962; reference = 1579;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-340; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 345
+   tag = 1962; reference = 1580;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-341; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 346
+   tag = 1962; reference = 1581;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-342; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 347
+   tag = 1962; reference = 1582;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-343; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 348
+   tag = 1962; reference = 1583;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-344; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 349
+   tag = 1962; reference = 1584;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-345; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 350
+   tag = 1962; reference = 1585;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-346; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 351
+   tag = 1962; reference = 1586;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-347; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 352
+   tag = 1962; reference = 1587;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-348; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 353
+   tag = 1962; reference = 1588;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-349; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 354
+   tag = 1962; reference = 1589;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-350; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 355
+   tag = 1962; reference = 1590;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-351; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 356
+   tag = 1962; reference = 1591;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-352; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 357
+   tag = 1962; reference = 1592;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-353; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 358
+   tag = 1962; reference = 1593;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-354; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 359
+   tag = 1962; reference = 1594;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-355; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 360
+   tag = 1962; reference = 1595;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-356; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 361
+   tag = 1962; reference = 1596;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-357; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 362
+   tag = 1962; reference = 1597;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-358; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 363
+   tag = 1962; reference = 1598;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-359; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 364
+   tag = 1962; reference = 1599;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-360; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 365
+   tag = 1962; reference = 1600;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-361; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 366
+   tag = 1962; reference = 1601;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-362; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 367
+   tag = 1962; reference = 1602;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-363; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 368
+   tag = 1962; reference = 1603;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-364; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 369
+   tag = 1962; reference = 1604;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-365; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 370
+   tag = 1962; reference = 1605;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-366; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 371
+   tag = 1962; reference = 1606;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-367; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 372
+   tag = 1962; reference = 1607;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-368; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 373
+   tag = 1962; reference = 1608;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-369; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 374
+   tag = 1962; reference = 1609;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-370; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 375
+   tag = 1962; reference = 1610;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-371; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 376
+   tag = 1962; reference = 1611;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-372; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 377
+   tag = 1962; reference = 1612;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-373; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 378
+   tag = 1962; reference = 1613;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-374; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 379
+   tag = 1962; reference = 1614;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-375; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 380
+   tag = 1962; reference = 1615;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-376; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 381
+   tag = 1962; reference = 1616;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-377; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 382
+   tag = 1962; reference = 1617;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-378; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 383
+   tag = 1962; reference = 1618;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-379; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 384
+   tag = 1962; reference = 1619;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-380; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 385
+   tag = 1962; reference = 1620;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-381; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 386
+   tag = 1962; reference = 1621;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-382; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 387
+   tag = 1962; reference = 1622;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-383; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 388
+   tag = 1962; reference = 1623;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-384; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 389
+   tag = 1962; reference = 1624;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-385; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 390
+   tag = 1962; reference = 1625;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-386; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 391
+   tag = 1962; reference = 1626;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-387; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 392
+   tag = 1962; reference = 1627;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-388; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 393
+   tag = 1962; reference = 1628;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-389; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 394
+   tag = 1962; reference = 1629;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-390; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 395
+   tag = 1962; reference = 1630;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-391; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 396
+   tag = 1962; reference = 1631;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-392; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 397
+   tag = 1962; reference = 1632;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-393; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 398
+   tag = 1962; reference = 1633;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-394; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 399
+   tag = 1962; reference = 1634;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-395; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 400
+   tag = 1962; reference = 1635;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-396; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 401
+   tag = 1962; reference = 1636;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-397; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 402
+   tag = 1962; reference = 1637;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-398; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 403
+   tag = 1962; reference = 1638;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-399; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 404
+   tag = 1962; reference = 1639;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-400; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 405
+   tag = 1962; reference = 1640;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-401; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 406
+   tag = 1962; reference = 1641;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-402; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 407
+   tag = 1962; reference = 1642;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-403; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 408
+   tag = 1962; reference = 1643;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-404; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 409
+   tag = 1962; reference = 1644;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-405; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 410
+   tag = 1962; reference = 1645;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-406; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 411
+   tag = 1962; reference = 1646;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-407; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 412
+   tag = 1962; reference = 1647;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-408; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 413
+   tag = 1962; reference = 1648;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-409; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 414
+   tag = 1962; reference = 1649;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-410; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 415
+   tag = 1962; reference = 1650;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-411; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 416
+   tag = 1962; reference = 1651;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-412; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 417
+   tag = 1962; reference = 1652;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-413; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 418
+   tag = 1962; reference = 1653;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-414; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 419
+   tag = 1962; reference = 1654;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-415; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 420
+   tag = 1962; reference = 1655;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-416; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 421
+   tag = 1962; reference = 1656;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-417; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 422
+   tag = 1962; reference = 1657;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-418; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 423
+   tag = 1962; reference = 1658;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-419; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 424
+   tag = 1962; reference = 1659;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-420; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 425
+   tag = 1962; reference = 1660;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-421; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 426
+   tag = 1962; reference = 1661;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-422; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 427
+   tag = 1962; reference = 1662;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-423; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 428
+   tag = 1962; reference = 1663;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-424; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 429
+   tag = 1962; reference = 1664;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-425; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 430
+   tag = 1962; reference = 1665;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-426; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 431
+   tag = 1962; reference = 1666;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-427; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 432
+   tag = 1962; reference = 1667;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-428; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 433
+   tag = 1962; reference = 1668;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-429; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 434
+   tag = 1962; reference = 1669;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-430; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 435
+   tag = 1962; reference = 1670;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-431; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 436
+   tag = 1962; reference = 1671;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-432; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 437
+   tag = 1962; reference = 1672;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-433; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 438
+   tag = 1962; reference = 1673;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-434; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 439
+   tag = 1962; reference = 1674;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-435; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 440
+   tag = 1962; reference = 1675;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-436; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 441
+   tag = 1962; reference = 1676;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-437; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 442
+   tag = 1962; reference = 1677;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-438; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 443
+   tag = 1962; reference = 1678;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-439; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 444
+   tag = 1962; reference = 1679;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-440; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 445
+   tag = 1962; reference = 1680;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-441; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 446
+   tag = 1962; reference = 1681;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-442; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 447
+   tag = 1962; reference = 1682;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-443; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 448
+   tag = 1962; reference = 1683;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-444; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 449
+   tag = 1962; reference = 1684;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-445; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 450
+   tag = 1962; reference = 1685;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-446; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 451
+   tag = 1962; reference = 1686;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-447; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 452
+   tag = 1962; reference = 1687;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-448; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 453
+   tag = 1962; reference = 1688;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-449; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 454
+   tag = 1962; reference = 1689;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-450; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 455
+   tag = 1962; reference = 1690;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-451; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 456
+   tag = 1962; reference = 1691;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-452; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 457
+   tag = 1962; reference = 1692;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-453; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 458
+   tag = 1962; reference = 1693;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-454; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 459
+   tag = 1962; reference = 1694;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-455; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 460
+   tag = 1962; reference = 1695;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-456; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 461
+   tag = 1962; reference = 1696;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-457; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 462
+   tag = 1962; reference = 1697;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-458; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 463
+   tag = 1962; reference = 1698;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-459; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 464
+   tag = 1962; reference = 1699;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-460; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 465
+   tag = 1962; reference = 1700;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-461; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 466
+   tag = 1962; reference = 1701;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-462; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 467
+   tag = 1962; reference = 1702;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-463; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 468
+   tag = 1962; reference = 1703;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-464; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 469
+   tag = 1962; reference = 1704;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-465; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 470
+   tag = 1962; reference = 1705;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-466; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 471
+   tag = 1962; reference = 1706;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-467; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 472
+   tag = 1962; reference = 1707;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-468; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 473
+   tag = 1962; reference = 1708;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-469; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 474
+   tag = 1962; reference = 1709;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-470; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 475
+   tag = 1962; reference = 1710;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-471; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 476
+   tag = 1962; reference = 1711;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-472; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 477
+   tag = 1962; reference = 1712;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-473; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 478
+   tag = 1962; reference = 1713;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-474; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 479
+   tag = 1962; reference = 1714;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-475; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 480
+   tag = 1962; reference = 1715;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-476; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 481
+   tag = 1962; reference = 1716;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-477; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 482
+   tag = 1962; reference = 1717;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-478; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 483
+   tag = 1962; reference = 1718;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-479; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 484
+   tag = 1962; reference = 1719;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-480; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 485
+   tag = 1962; reference = 1720;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-481; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 486
+   tag = 1962; reference = 1721;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-482; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 487
+   tag = 1962; reference = 1722;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-483; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 488
+   tag = 1962; reference = 1723;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-484; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 489
+   tag = 1962; reference = 1724;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-485; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 490
+   tag = 1962; reference = 1725;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-486; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 491
+   tag = 1962; reference = 1726;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-487; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 492
+   tag = 1962; reference = 1727;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-488; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 493
+   tag = 1962; reference = 1728;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-489; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 494
+   tag = 1962; reference = 1729;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-490; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 495
+   tag = 1962; reference = 1730;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-491; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 496
+   tag = 1962; reference = 1731;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-492; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 497
+   tag = 1962; reference = 1732;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-493; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 498
+   tag = 1962; reference = 1733;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-494; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 499
+   tag = 1962; reference = 1734;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-495; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 500
+   tag = 1962; reference = 1735;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-496; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 501
+   tag = 1962; reference = 1736;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-497; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 502
+   tag = 1962; reference = 1737;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-498; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 503
+   tag = 1962; reference = 1738;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-499; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 504
+   tag = 1962; reference = 1739;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-500; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 505
+   tag = 1962; reference = 1740;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-501; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 506
+   tag = 1962; reference = 1741;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-502; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 507
+   tag = 1962; reference = 1742;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-503; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 508
+   tag = 1962; reference = 1743;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-504; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 509
+   tag = 1962; reference = 1744;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-505; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 510
+   tag = 1962; reference = 1745;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-506; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 511
+   tag = 1962; reference = 1746;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-507; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 512
+   tag = 1962; reference = 1747;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-508; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 513
+   tag = 1962; reference = 1748;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-509; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 514
+   tag = 1962; reference = 1749;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-510; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 515
+   tag = 1962; reference = 1750;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-511; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 516
+   tag = 1962; reference = 1751;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-512; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 517
+   tag = 1962; reference = 1752;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-513; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 518
+   tag = 1962; reference = 1753;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-514; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 519
+   tag = 1962; reference = 1754;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-515; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 520
+   tag = 1962; reference = 1755;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-516; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 521
+   tag = 1962; reference = 1756;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-517; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 522
+   tag = 1962; reference = 1757;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-518; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 523
+   tag = 1962; reference = 1758;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-519; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 524
+   tag = 1962; reference = 1759;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-520; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 525
+   tag = 1962; reference = 1760;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-521; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 526
+   tag = 1962; reference = 1761;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-522; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 527
+   tag = 1962; reference = 1762;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-523; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 528
+   tag = 1962; reference = 1763;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-524; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 529
+   tag = 1962; reference = 1764;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-525; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 530
+   tag = 1962; reference = 1765;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-526; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 531
+   tag = 1962; reference = 1766;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-527; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 532
+   tag = 1962; reference = 1767;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-528; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 533
+   tag = 1962; reference = 1768;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-529; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 534
+   tag = 1962; reference = 1769;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-530; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 535
+   tag = 1962; reference = 1770;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-531; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 536
+   tag = 1962; reference = 1771;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-532; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 537
+   tag = 1962; reference = 1772;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-533; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 538
+   tag = 1962; reference = 1773;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-534; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 539
+   tag = 1962; reference = 1774;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-535; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 540
+   tag = 1962; reference = 1775;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-536; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 541
+   tag = 1962; reference = 1776;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-537; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 542
+   tag = 1962; reference = 1777;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-538; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 543
+   tag = 1962; reference = 1778;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-539; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 544
+   tag = 1962; reference = 1779;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-540; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 545
+   tag = 1962; reference = 1780;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-541; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 546
+   tag = 1962; reference = 1781;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-542; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 547
+   tag = 1962; reference = 1782;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-543; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 548
+   tag = 1962; reference = 1783;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-544; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 549
+   tag = 1962; reference = 1784;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-545; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 550
+   tag = 1962; reference = 1785;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-546; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 551
+   tag = 1962; reference = 1786;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-547; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 552
+   tag = 1962; reference = 1787;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-548; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 553
+   tag = 1962; reference = 1788;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-549; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 554
+   tag = 1962; reference = 1789;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-550; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 555
+   tag = 1962; reference = 1790;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-551; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 556
+   tag = 1962; reference = 1791;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-552; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 557
+   tag = 1962; reference = 1792;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-553; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 558
+   tag = 1962; reference = 1793;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-554; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 559
+   tag = 1962; reference = 1794;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-555; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 560
+   tag = 1962; reference = 1795;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-556; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 561
+   tag = 1962; reference = 1796;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-557; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 562
+   tag = 1962; reference = 1797;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-558; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 563
+   tag = 1962; reference = 1798;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-559; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 564
+   tag = 1962; reference = 1799;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-560; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 565
+   tag = 1962; reference = 1800;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-561; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 566
+   tag = 1962; reference = 1801;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-562; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 567
+   tag = 1962; reference = 1802;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-563; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 568
+   tag = 1962; reference = 1803;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-564; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 569
+   tag = 1962; reference = 1804;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-565; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 570
+   tag = 1962; reference = 1805;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-566; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 571
+   tag = 1962; reference = 1806;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-567; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 572
+   tag = 1962; reference = 1807;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-568; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 573
+   tag = 1962; reference = 1808;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-569; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 574
+   tag = 1962; reference = 1809;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-570; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 575
+   tag = 1962; reference = 1810;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-571; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 576
+   tag = 1962; reference = 1811;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-572; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 577
+   tag = 1962; reference = 1812;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-573; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 578
+   tag = 1962; reference = 1813;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-574; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 579
+   tag = 1962; reference = 1814;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-575; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 580
+   tag = 1962; reference = 1815;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-576; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 581
+   tag = 1962; reference = 1816;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-577; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 582
+   tag = 1962; reference = 1817;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-578; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 583
+   tag = 1962; reference = 1818;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-579; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 584
+   tag = 1962; reference = 1819;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-580; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 585
+   tag = 1962; reference = 1820;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-581; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 586
+   tag = 1962; reference = 1821;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-582; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 587
+   tag = 1962; reference = 1822;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-583; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 588
+   tag = 1962; reference = 1823;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-584; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 589
+   tag = 1962; reference = 1824;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-585; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 590
+   tag = 1962; reference = 1825;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-586; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 591
+   tag = 1962; reference = 1826;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-587; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 592
+   tag = 1962; reference = 1827;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-588; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 593
+   tag = 1962; reference = 1828;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-589; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 594
+   tag = 1962; reference = 1829;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-590; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 595
+   tag = 1962; reference = 1830;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-591; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 596
+   tag = 1962; reference = 1831;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-592; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 597
+   tag = 1962; reference = 1832;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-593; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 598
+   tag = 1962; reference = 1833;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-594; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 599
+   tag = 1962; reference = 1834;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-595; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 600
+   tag = 1962; reference = 1835;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-596; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 601
+   tag = 1962; reference = 1836;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-597; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 602
+   tag = 1962; reference = 1837;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-598; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 603
+   tag = 1962; reference = 1838;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-599; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 604
+   tag = 1962; reference = 1839;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-600; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 605
+   tag = 1962; reference = 1840;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-601; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 606
+   tag = 1962; reference = 1841;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-602; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 607
+   tag = 1962; reference = 1842;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-603; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 608
+   tag = 1962; reference = 1843;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-604; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 609
+   tag = 1962; reference = 1844;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-605; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 610
+   tag = 1962; reference = 1845;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-606; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 611
+   tag = 1962; reference = 1846;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-607; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 612
+   tag = 1962; reference = 1847;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-608; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 613
+   tag = 1962; reference = 1848;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-609; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 614
+   tag = 1962; reference = 1849;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-610; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 615
+   tag = 1962; reference = 1850;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-611; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 616
+   tag = 1962; reference = 1851;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-612; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 617
+   tag = 1962; reference = 1852;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-613; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 618
+   tag = 1962; reference = 1853;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-614; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 619
+   tag = 1962; reference = 1854;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-615; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 620
+   tag = 1962; reference = 1855;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-616; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 621
+   tag = 1962; reference = 1856;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-617; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 622
+   tag = 1962; reference = 1857;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-618; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 623
+   tag = 1962; reference = 1858;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-619; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 624
+   tag = 1962; reference = 1859;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-620; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 625
+   tag = 1962; reference = 1860;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-621; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 626
+   tag = 1962; reference = 1861;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-622; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 627
+   tag = 1962; reference = 1862;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-623; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 628
+   tag = 1962; reference = 1863;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-624; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 629
+   tag = 1962; reference = 1864;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-625; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 630
+   tag = 1962; reference = 1865;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-626; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 631
+   tag = 1962; reference = 1866;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-627; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 632
+   tag = 1962; reference = 1867;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-628; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 633
+   tag = 1962; reference = 1868;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-629; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 634
+   tag = 1962; reference = 1869;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-630; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 635
+   tag = 1962; reference = 1870;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-631; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 636
+   tag = 1962; reference = 1871;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-632; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 637
+   tag = 1962; reference = 1872;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-633; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 638
+   tag = 1962; reference = 1873;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-634; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 639
+   tag = 1962; reference = 1874;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-635; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 640
+   tag = 1962; reference = 1875;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-636; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 641
+   tag = 1962; reference = 1876;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-637; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 642
+   tag = 1962; reference = 1877;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-638; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 643
+   tag = 1962; reference = 1878;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-639; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 644
+   tag = 1962; reference = 1879;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-640; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 645
+   tag = 1962; reference = 1880;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-641; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 646
+   tag = 1962; reference = 1881;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-642; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 647
+   tag = 1962; reference = 1882;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-643; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 648
+   tag = 1962; reference = 1883;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-644; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 649
+   tag = 1962; reference = 1884;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-645; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 650
+   tag = 1962; reference = 1885;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-646; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 651
+   tag = 1962; reference = 1886;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-647; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 652
+   tag = 1962; reference = 1887;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-648; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 653
+   tag = 1962; reference = 1888;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-649; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 654
+   tag = 1962; reference = 1889;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-650; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 655
+   tag = 1962; reference = 1890;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-651; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 656
+   tag = 1962; reference = 1891;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-652; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 657
+   tag = 1962; reference = 1892;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-653; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 658
+   tag = 1962; reference = 1893;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-654; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 659
+   tag = 1962; reference = 1894;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-655; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 660
+   tag = 1962; reference = 1895;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-656; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 661
+   tag = 1962; reference = 1896;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-657; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 662
+   tag = 1962; reference = 1897;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-658; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 663
+   tag = 1962; reference = 1898;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-659; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 664
+   tag = 1962; reference = 1899;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-660; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 665
+   tag = 1962; reference = 1900;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-661; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 666
+   tag = 1962; reference = 1901;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-662; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 667
+   tag = 1962; reference = 1902;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-663; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 668
+   tag = 1962; reference = 1903;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-664; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 669
+   tag = 1962; reference = 1904;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-665; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 670
+   tag = 1962; reference = 1905;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-666; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 671
+   tag = 1962; reference = 1906;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-667; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 672
+   tag = 1962; reference = 1907;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-668; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 673
+   tag = 1962; reference = 1908;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-669; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 674
+   tag = 1962; reference = 1909;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-670; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 675
+   tag = 1962; reference = 1910;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-671; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 676
+   tag = 1962; reference = 1911;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-672; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 677
+   tag = 1962; reference = 1912;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-673; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 678
+   tag = 1962; reference = 1913;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-674; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 679
+   tag = 1962; reference = 1914;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-675; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 680
+   tag = 1962; reference = 1915;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-676; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 681
+   tag = 1962; reference = 1916;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-677; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 682
+   tag = 1962; reference = 1917;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-678; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 683
+   tag = 1962; reference = 1918;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-679; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 684
+   tag = 1962; reference = 1919;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-680; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 685
+   tag = 1962; reference = 1920;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-681; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 686
+   tag = 1962; reference = 1921;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-682; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 687
+   tag = 1962; reference = 1922;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-683; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 688
+   tag = 1962; reference = 1923;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-684; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 689
+   tag = 1962; reference = 1924;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-685; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 690
+   tag = 1962; reference = 1925;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-686; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 691
+   tag = 1962; reference = 1926;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-687; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 692
+   tag = 1962; reference = 1927;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-688; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 693
+   tag = 1962; reference = 1928;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-689; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 694
+   tag = 1962; reference = 1929;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-690; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 695
+   tag = 1962; reference = 1930;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-691; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 696
+   tag = 1962; reference = 1931;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-692; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 697
+   tag = 1962; reference = 1932;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-693; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 698
+   tag = 1962; reference = 1933;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-694; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 699
+   tag = 1962; reference = 1934;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-695; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 700
+   tag = 1962; reference = 1935;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-696; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 701
+   tag = 1962; reference = 1936;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-697; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 702
+   tag = 1962; reference = 1937;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-698; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 703
+   tag = 1962; reference = 1938;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-699; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 704
+   tag = 1962; reference = 1939;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-700; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 705
+   tag = 1962; reference = 1940;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-701; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 706
+   tag = 1962; reference = 1941;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-702; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 707
+   tag = 1962; reference = 1942;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-703; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 708
+   tag = 1962; reference = 1943;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-704; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 709
+   tag = 1962; reference = 1944;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-705; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 710
+   tag = 1962; reference = 1945;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-706; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 711
+   tag = 1962; reference = 1946;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-707; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 712
+   tag = 1962; reference = 1947;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-708; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 713
+   tag = 1962; reference = 1948;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-709; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 714
+   tag = 1962; reference = 1949;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-710; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 715
+   tag = 1962; reference = 1950;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-711; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 716
+   tag = 1962; reference = 1951;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-712; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 717
+   tag = 1962; reference = 1952;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-713; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 718
+   tag = 1962; reference = 1953;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-714; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 719
+   tag = 1962; reference = 1954;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-715; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 720
+   tag = 1962; reference = 1955;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-716; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 721
+   tag = 1962; reference = 1956;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-717; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 722
+   tag = 1962; reference = 1957;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-718; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 723
+   tag = 1962; reference = 1958;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-719; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 724
+   tag = 1962; reference = 1959;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-720; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 725
+   tag = 1962; reference = 1960;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-721; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 726
+   tag = 1962; reference = 1961;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-722; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 727
+   tag = 1962; reference = 1962;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-723; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 728
+   tag = 1962; reference = 1963;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-724; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 729
+   tag = 1962; reference = 1964;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-725; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 730
+   tag = 1962; reference = 1965;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-726; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 731
+   tag = 1962; reference = 1966;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-727; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 732
+   tag = 1962; reference = 1967;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-728; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 733
+   tag = 1962; reference = 1968;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-729; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 734
+   tag = 1962; reference = 1969;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-730; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 735
+   tag = 1962; reference = 1970;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-731; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 736
+   tag = 1962; reference = 1971;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-732; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 737
+   tag = 1962; reference = 1972;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-733; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 738
+   tag = 1962; reference = 1973;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-734; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 739
+   tag = 1962; reference = 1974;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-735; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 740
+   tag = 1962; reference = 1975;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-736; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 741
+   tag = 1962; reference = 1976;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-737; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 742
+   tag = 1962; reference = 1977;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-738; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 743
+   tag = 1962; reference = 1978;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-739; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 744
+   tag = 1962; reference = 1979;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-740; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 745
+   tag = 1962; reference = 1980;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-741; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 746
+   tag = 1962; reference = 1981;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-742; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 747
+   tag = 1962; reference = 1982;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-743; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 748
+   tag = 1962; reference = 1983;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-744; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 749
+   tag = 1962; reference = 1984;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-745; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 750
+   tag = 1962; reference = 1985;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-746; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 751
+   tag = 1962; reference = 1986;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-747; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 752
+   tag = 1962; reference = 1987;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-748; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 753
+   tag = 1962; reference = 1988;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-749; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 754
+   tag = 1962; reference = 1989;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-750; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 755
+   tag = 1962; reference = 1990;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-751; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 756
+   tag = 1962; reference = 1991;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-752; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 757
+   tag = 1962; reference = 1992;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-753; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 758
+   tag = 1962; reference = 1993;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-754; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 759
+   tag = 1962; reference = 1994;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-755; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 760
+   tag = 1962; reference = 1995;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-756; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 761
+   tag = 1962; reference = 1996;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-757; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 762
+   tag = 1962; reference = 1997;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-758; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 763
+   tag = 1962; reference = 1998;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-759; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 764
+   tag = 1962; reference = 1999;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-760; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 765
+   tag = 1962; reference = 2000;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-761; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 766
+   tag = 1962; reference = 2001;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-762; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 767
+   tag = 1962; reference = 2002;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-763; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 768
+   tag = 1962; reference = 2003;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-764; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 769
+   tag = 1962; reference = 2004;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-765; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 770
+   tag = 1962; reference = 2005;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-766; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 771
+   tag = 1962; reference = 2006;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-767; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 772
+   tag = 1962; reference = 2007;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-768; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 773
+   tag = 1962; reference = 2008;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-769; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 774
+   tag = 1962; reference = 2009;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-770; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 775
+   tag = 1962; reference = 2010;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-771; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 776
+   tag = 1962; reference = 2011;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-772; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 777
+   tag = 1962; reference = 2012;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-773; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 778
+   tag = 1962; reference = 2013;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-774; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 779
+   tag = 1962; reference = 2014;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-775; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 780
+   tag = 1962; reference = 2015;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-776; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 781
+   tag = 1962; reference = 2016;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-777; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 782
+   tag = 1962; reference = 2017;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-778; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 783
+   tag = 1962; reference = 2018;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-779; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 784
+   tag = 1962; reference = 2019;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-780; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 785
+   tag = 1962; reference = 2020;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-781; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 786
+   tag = 1962; reference = 2021;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-782; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 787
+   tag = 1962; reference = 2022;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-783; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 788
+   tag = 1962; reference = 2023;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-784; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 789
+   tag = 1962; reference = 2024;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-785; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 790
+   tag = 1962; reference = 2025;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-786; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 791
+   tag = 1962; reference = 2026;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-787; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 792
+   tag = 1962; reference = 2027;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-788; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 793
+   tag = 1962; reference = 2028;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-789; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 794
+   tag = 1962; reference = 2029;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-790; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 795
+   tag = 1962; reference = 2030;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-791; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 796
+   tag = 1962; reference = 2031;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-792; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 797
+   tag = 1962; reference = 2032;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-793; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 798
+   tag = 1962; reference = 2033;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-794; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 799
+   tag = 1962; reference = 2034;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-795; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 800
+   tag = 1962; reference = 2035;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-796; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 801
+   tag = 1962; reference = 2036;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-797; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 802
+   tag = 1962; reference = 2037;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-798; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 803
+   tag = 1962; reference = 2038;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-799; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 804
+   tag = 1962; reference = 2039;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-800; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 805
+   tag = 1962; reference = 2040;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-801; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 806
+   tag = 1962; reference = 2041;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-802; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 807
+   tag = 1962; reference = 2042;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-803; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 808
+   tag = 1962; reference = 2043;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-804; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 809
+   tag = 1962; reference = 2044;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-805; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 810
+   tag = 1962; reference = 2045;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-806; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 811
+   tag = 1962; reference = 2046;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-807; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 812
+   tag = 1962; reference = 2047;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-808; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 813
+   tag = 1962; reference = 2048;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-809; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 814
+   tag = 1962; reference = 2049;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-810; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 815
+   tag = 1962; reference = 2050;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-811; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 816
+   tag = 1962; reference = 2051;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-812; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 817
+   tag = 1962; reference = 2052;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-813; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 818
+   tag = 1962; reference = 2053;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-814; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 819
+   tag = 1962; reference = 2054;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-815; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 820
+   tag = 1962; reference = 2055;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-816; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 821
+   tag = 1962; reference = 2056;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-817; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 822
+   tag = 1962; reference = 2057;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-818; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 823
+   tag = 1962; reference = 2058;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-819; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 824
+   tag = 1962; reference = 2059;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-820; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 825
+   tag = 1962; reference = 2060;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-821; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 826
+   tag = 1962; reference = 2061;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-822; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 827
+   tag = 1962; reference = 2062;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-823; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 828
+   tag = 1962; reference = 2063;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-824; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 829
+   tag = 1962; reference = 2064;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-825; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 830
+   tag = 1962; reference = 2065;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-826; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 831
+   tag = 1962; reference = 2066;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-827; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 832
+   tag = 1962; reference = 2067;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-828; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 833
+   tag = 1962; reference = 2068;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-829; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 834
+   tag = 1962; reference = 2069;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-830; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 835
+   tag = 1962; reference = 2070;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-831; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 836
+   tag = 1962; reference = 2071;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-832; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 837
+   tag = 1962; reference = 2072;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-833; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 838
+   tag = 1962; reference = 2073;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-834; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 839
+   tag = 1962; reference = 2074;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-835; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 840
+   tag = 1962; reference = 2075;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-836; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 841
+   tag = 1962; reference = 2076;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-837; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 842
+   tag = 1962; reference = 2077;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-838; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 843
+   tag = 1962; reference = 2078;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-839; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 844
+   tag = 1962; reference = 2079;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-840; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 845
+   tag = 1962; reference = 2080;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-841; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 846
+   tag = 1962; reference = 2081;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-842; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 847
+   tag = 1962; reference = 2082;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-843; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 848
+   tag = 1962; reference = 2083;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-844; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 849
+   tag = 1962; reference = 2084;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-845; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 850
+   tag = 1962; reference = 2085;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-846; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 851
+   tag = 1962; reference = 2086;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-847; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 852
+   tag = 1962; reference = 2087;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-848; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 853
+   tag = 1962; reference = 2088;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-849; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 854
+   tag = 1962; reference = 2089;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-850; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 855
+   tag = 1962; reference = 2090;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-851; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 856
+   tag = 1962; reference = 2091;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-852; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 857
+   tag = 1962; reference = 2092;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-853; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 858
+   tag = 1962; reference = 2093;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-854; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 859
+   tag = 1962; reference = 2094;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-855; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 860
+   tag = 1962; reference = 2095;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-856; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 861
+   tag = 1962; reference = 2096;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-857; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 862
+   tag = 1962; reference = 2097;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-858; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 863
+   tag = 1962; reference = 2098;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-859; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 864
+   tag = 1962; reference = 2099;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-860; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 865
+   tag = 1962; reference = 2100;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-861; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 866
+   tag = 1962; reference = 2101;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-862; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 867
+   tag = 1962; reference = 2102;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-863; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 868
+   tag = 1962; reference = 2103;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-864; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 869
+   tag = 1962; reference = 2104;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-865; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 870
+   tag = 1962; reference = 2105;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-866; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 871
+   tag = 1962; reference = 2106;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-867; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 872
+   tag = 1962; reference = 2107;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-868; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 873
+   tag = 1962; reference = 2108;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-869; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 874
+   tag = 1962; reference = 2109;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-870; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 875
+   tag = 1962; reference = 2110;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-871; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 876
+   tag = 1962; reference = 2111;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-872; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 877
+   tag = 1962; reference = 2112;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-873; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 878
+   tag = 1962; reference = 2113;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-874; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 879
+   tag = 1962; reference = 2114;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-875; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 880
+   tag = 1962; reference = 2115;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-876; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 881
+   tag = 1962; reference = 2116;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-877; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 882
+   tag = 1962; reference = 2117;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-878; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 883
+   tag = 1962; reference = 2118;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-879; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 884
+   tag = 1962; reference = 2119;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-880; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 885
+   tag = 1962; reference = 2120;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-881; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 886
+   tag = 1962; reference = 2121;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-882; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 887
+   tag = 1962; reference = 2122;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-883; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 888
+   tag = 1962; reference = 2123;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-884; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 889
+   tag = 1962; reference = 2124;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-885; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 890
+   tag = 1962; reference = 2125;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-886; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 891
+   tag = 1962; reference = 2126;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-887; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 892
+   tag = 1962; reference = 2127;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-888; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 893
+   tag = 1962; reference = 2128;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-889; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 894
+   tag = 1962; reference = 2129;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-890; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 895
+   tag = 1962; reference = 2130;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-891; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 896
+   tag = 1962; reference = 2131;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-892; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 897
+   tag = 1962; reference = 2132;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-893; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 898
+   tag = 1962; reference = 2133;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-894; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 899
+   tag = 1962; reference = 2134;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-895; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 900
+   tag = 1962; reference = 2135;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-896; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 901
+   tag = 1962; reference = 2136;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-897; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 902
+   tag = 1962; reference = 2137;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-898; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 903
+   tag = 1962; reference = 2138;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-899; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 904
+   tag = 1962; reference = 2139;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-900; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 905
+   tag = 1962; reference = 2140;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-901; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 906
+   tag = 1962; reference = 2141;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-902; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 907
+   tag = 1962; reference = 2142;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-903; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 908
+   tag = 1962; reference = 2143;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-904; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 909
+   tag = 1962; reference = 2144;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-905; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 910
+   tag = 1962; reference = 2145;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-906; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 911
+   tag = 1962; reference = 2146;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-907; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 912
+   tag = 1962; reference = 2147;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-908; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 913
+   tag = 1962; reference = 2148;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-909; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 914
+   tag = 1962; reference = 2149;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-910; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 915
+   tag = 1962; reference = 2150;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-911; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 916
+   tag = 1962; reference = 2151;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-912; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 917
+   tag = 1962; reference = 2152;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-913; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 918
+   tag = 1962; reference = 2153;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-914; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 919
+   tag = 1962; reference = 2154;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-915; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 920
+   tag = 1962; reference = 2155;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-916; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 921
+   tag = 1962; reference = 2156;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-917; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 922
+   tag = 1962; reference = 2157;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-918; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 923
+   tag = 1962; reference = 2158;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-919; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 924
+   tag = 1962; reference = 2159;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-920; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 925
+   tag = 1962; reference = 2160;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-921; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 926
+   tag = 1962; reference = 2161;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-922; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 927
+   tag = 1962; reference = 2162;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-923; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 928
+   tag = 1962; reference = 2163;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-924; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 929
+   tag = 1962; reference = 2164;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-925; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 930
+   tag = 1962; reference = 2165;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-926; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 931
+   tag = 1962; reference = 2166;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-927; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 932
+   tag = 1962; reference = 2167;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-928; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 933
+   tag = 1962; reference = 2168;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-929; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 934
+   tag = 1962; reference = 2169;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-930; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 935
+   tag = 1962; reference = 2170;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-931; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 936
+   tag = 1962; reference = 2171;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-932; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 937
+   tag = 1962; reference = 2172;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-933; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 938
+   tag = 1962; reference = 2173;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-934; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 939
+   tag = 1962; reference = 2174;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-935; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 940
+   tag = 1962; reference = 2175;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-936; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 941
+   tag = 1962; reference = 2176;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-937; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 942
+   tag = 1962; reference = 2177;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-938; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 943
+   tag = 1962; reference = 2178;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-939; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 944
+   tag = 1962; reference = 2179;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-940; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 945
+   tag = 1962; reference = 2180;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-941; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 946
+   tag = 1962; reference = 2181;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-942; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 947
+   tag = 1962; reference = 2182;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-943; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 948
+   tag = 1962; reference = 2183;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-944; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 949
+   tag = 1962; reference = 2184;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-945; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 950
+   tag = 1962; reference = 2185;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-946; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 951
+   tag = 1962; reference = 2186;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-947; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 952
+   tag = 1962; reference = 2187;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-948; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 953
+   tag = 1962; reference = 2188;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-949; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 954
+   tag = 1962; reference = 2189;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-950; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 955
+   tag = 1962; reference = 2190;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-951; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 956
+   tag = 1962; reference = 2191;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-952; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 957
+   tag = 1962; reference = 2192;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-953; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 958
+   tag = 1962; reference = 2193;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-954; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 959
+   tag = 1962; reference = 2194;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-955; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 960
+   tag = 1962; reference = 2195;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-956; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 961
+   tag = 1962; reference = 2196;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-957; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 962
+   tag = 1962; reference = 2197;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-958; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 963
+   tag = 1962; reference = 2198;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-959; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 964
+   tag = 1962; reference = 2199;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-960; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 965
+   tag = 1962; reference = 2200;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-961; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 966
+   tag = 1962; reference = 2201;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-962; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 967
+   tag = 1962; reference = 2202;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-963; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 968
+   tag = 1962; reference = 2203;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-964; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 969
+   tag = 1962; reference = 2204;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-965; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 970
+   tag = 1962; reference = 2205;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-966; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 971
+   tag = 1962; reference = 2206;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-967; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 972
+   tag = 1962; reference = 2207;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-968; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 973
+   tag = 1962; reference = 2208;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-969; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 974
+   tag = 1962; reference = 2209;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-970; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 975
+   tag = 1962; reference = 2210;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-971; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 976
+   tag = 1962; reference = 2211;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-972; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 977
+   tag = 1962; reference = 2212;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-973; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 978
+   tag = 1962; reference = 2213;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-974; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 979
+   tag = 1962; reference = 2214;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-975; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 980
+   tag = 1962; reference = 2215;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-976; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 981
+   tag = 1962; reference = 2216;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-977; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 982
+   tag = 1962; reference = 2217;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-978; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 983
+   tag = 1962; reference = 2218;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-979; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 984
+   tag = 1962; reference = 2219;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-980; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 985
+   tag = 1962; reference = 2220;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-981; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 986
+   tag = 1962; reference = 2221;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-982; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 987
+   tag = 1962; reference = 2222;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-983; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 988
+   tag = 1962; reference = 2223;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-984; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 989
+   tag = 1962; reference = 2224;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-985; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 990
+   tag = 1962; reference = 2225;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-986; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 991
+   tag = 1962; reference = 2226;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-987; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 992
+   tag = 1962; reference = 2227;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-988; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 993
+   tag = 1962; reference = 2228;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-989; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 994
+   tag = 1962; reference = 2229;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-990; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 995
+   tag = 1962; reference = 2230;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-991; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 996
+   tag = 1962; reference = 2231;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-992; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 997
+   tag = 1962; reference = 2232;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-993; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 998
+   tag = 1962; reference = 2233;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-994; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 999
+   tag = 1962; reference = 2234;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-995; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 1000
+   tag = 1962; reference = 2235;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-996; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 1001
+   tag = 1962; reference = 2236;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-997; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 1002
+   tag = 1962; reference = 2237;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-998; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 1003
+   tag = 1962; reference = 2238;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-999; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
@@ -0,0 +1,234 @@
+File name: tvattr.hdf 
+
+Vdata: 0
+   tag = 1962; reference = 4;
+   number of records = 3; interlace = FULL_INTERLACE (0);
+   fields = [fldname1, fldname2];
+   record size (in bytes) = 2;
+   name = vsname1; class = <Undefined>;
+   number of attributes = 2 
+    attr0: name=attname3 type=4 count=3 size=3
+	m N p 
+    attr1: name=attname4 type=5 count=1 size=4
+	32.000999 
+- field index 0: [fldname1], type=4, order=1
+   number of attributes = 3 
+    attr0: name=attname4 type=5 count=1 size=4
+	32.000999 
+    attr1: name=attname5 type=6 count=1 size=8
+	-64.123450 
+    attr2: name=vsname1 type=6 count=1 size=8
+	64.123450 
+- field index 1: [fldname2], type=4, order=1
+   number of attributes = 1 
+    attr0: name=attname5 type=5 count=1 size=4
+	32.000999 
+Loc.     Data
+0        A  B  ; C  D  ; E  F  ; 
+
+
+Vdata: 1
+   tag = 1962; reference = 5;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 8;
+   name = attname1; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=25, order=2
+   number of attributes = 0 
+Loc.     Data
+0        10032 10064  ; 
+
+Vdata: 2
+   tag = 1962; reference = 6;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname2; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=23, order=2
+   number of attributes = 0 
+Loc.     Data
+0        16 32  ; 
+
+Vdata: 3
+   tag = 1962; reference = 7;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 3;
+   name = attname3; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=4, order=3
+   number of attributes = 0 
+Loc.     Data
+0        m N p  ; 
+
+Vdata: 4
+   tag = 1962; reference = 8;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname4; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        32.000999  ; 
+
+Vdata: 5
+   tag = 1962; reference = 9;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname5; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        32.000999  ; 
+
+Vdata: 6
+   tag = 1962; reference = 10;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname4; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        32.000999  ; 
+
+Vdata: 7
+   tag = 1962; reference = 11;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 8;
+   name = attname5; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=6, order=1
+   number of attributes = 0 
+Loc.     Data
+0        -64.123450  ; 
+
+Vdata: 8
+   tag = 1962; reference = 12;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 8;
+   name = vsname1; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=6, order=1
+   number of attributes = 0 
+Loc.     Data
+0        64.123450  ; 
+
+Vdata: 9
+   tag = 1962; reference = 13;
+   number of records = 3; interlace = FULL_INTERLACE (0);
+   fields = [fldname0, fldname1];
+   record size (in bytes) = 8;
+   name = vsname0; class = vsclass0;
+   number of attributes = 1 
+    attr0: name=attname7 type=4 count=3 size=3
+	m N p 
+- field index 0: [fldname0], type=24, order=1
+   number of attributes = 3 
+    attr0: name=attname6 type=5 count=1 size=4
+	32.000999 
+    attr1: name=attname8 type=5 count=1 size=4
+	32.000999 
+    attr2: name=attname9 type=4 count=5 size=5
+	m N p S t 
+- field index 1: [fldname1], type=24, order=1
+   number of attributes = 1 
+    attr0: name=attname8 type=5 count=1 size=4
+	-34.001999 
+Loc.     Data
+0        0  -1  ; 10  11  ; 20  21  ; 
+
+
+Vdata: 10
+   tag = 1962; reference = 14;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname6; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        32.000999  ; 
+
+Vdata: 11
+   tag = 1962; reference = 15;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 3;
+   name = attname7; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=4, order=3
+   number of attributes = 0 
+Loc.     Data
+0        m N p  ; 
+
+Vdata: 12
+   tag = 1962; reference = 16;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname8; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        32.000999  ; 
+
+Vdata: 13
+   tag = 1962; reference = 17;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname8; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        -34.001999  ; 
+
+Vdata: 14
+   tag = 1962; reference = 18;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 5;
+   name = attname9; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=4, order=5
+   number of attributes = 0 
+Loc.     Data
+0        m N p S t  ; 
+
+Vdata: 15
+   tag = 1962; reference = 20;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname9; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=25, order=1
+   number of attributes = 0 
+Loc.     Data
+0        100  ; 
+
+Vdata: 16
+   tag = 1962; reference = 21;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [VALUES];
+   record size (in bytes) = 4;
+   name = attname10; class = Attr0.0;
+   number of attributes = 0 
+- field index 0: [VALUES], type=23, order=2
+   number of attributes = 0 
+Loc.     Data
+0        16 32  ; 
+
@@ -0,0 +1,20 @@
+File name: vslongname.hdf 
+
+Vdata: 0
+   tag = 1962; reference = 2;
+   number of records = 0; interlace = FULL_INTERLACE (0);
+   fields = [field 1];
+   record size (in bytes) = 4;
+   name = Vdata 1 91123456789212345678931234567894123456789512345678961234; class = Long Name Vdatas789212345678931234567894123456789512345678961234;
+   number of attributes = 0 
+   No data written
+
+Vdata: 1
+   tag = 1962; reference = 3;
+   number of records = 0; interlace = FULL_INTERLACE (0);
+   fields = [field 1];
+   record size (in bytes) = 4;
+   name = Vdata 2 91123456789212345678931234567894123456789512345678961234; class = Long Name Vdatas789212345678931234567894123456789512345678961234;
+   number of attributes = 0 
+   No data written
+
@@ -0,0 +1,72 @@
+File name: tvset.hdf 
+
+Vdata: 1
+   tag = 1962; reference = 1236;
+   number of records = 100; interlace = FULL_INTERLACE (0);
+   fields = [DIFFERENT_FIELD_NAME];
+   record size (in bytes) = 8;
+   name = Integer Vdata; class = Test object;
+   number of attributes = 0 
+- field index 0: [DIFFERENT_FIELD_NAME], type=24, order=2
+   number of attributes = 0 
+Loc.     Data
+00       0 1  ; 2 3  ; 4 5  ; 6 7  ; 
+04       8 9  ; 10 11  ; 12 13  ; 14 15  ; 
+08       16 17  ; 18 19  ; 20 21  ; 22 23  ; 
+12       24 25  ; 26 27  ; 28 29  ; 30 31  ; 
+16       32 33  ; 34 35  ; 36 37  ; 38 39  ; 
+20       40 41  ; 42 43  ; 44 45  ; 46 47  ; 
+24       48 49  ; 50 51  ; 52 53  ; 54 55  ; 
+28       56 57  ; 58 59  ; 60 61  ; 62 63  ; 
+32       64 65  ; 66 67  ; 68 69  ; 70 71  ; 
+36       72 73  ; 74 75  ; 76 77  ; 78 79  ; 
+40       80 81  ; 82 83  ; 84 85  ; 86 87  ; 
+44       88 89  ; 90 91  ; 92 93  ; 94 95  ; 
+48       96 97  ; 98 99  ; 100 101  ; 102 103  ; 
+52       104 105  ; 106 107  ; 108 109  ; 110 111  ; 
+56       112 113  ; 114 115  ; 116 117  ; 118 119  ; 
+60       120 121  ; 122 123  ; 124 125  ; 126 127  ; 
+64       128 129  ; 130 131  ; 132 133  ; 134 135  ; 
+68       136 137  ; 138 139  ; 140 141  ; 142 143  ; 
+72       144 145  ; 146 147  ; 148 149  ; 150 151  ; 
+76       152 153  ; 154 155  ; 156 157  ; 158 159  ; 
+80       160 161  ; 162 163  ; 164 165  ; 166 167  ; 
+84       168 169  ; 170 171  ; 172 173  ; 174 175  ; 
+88       176 177  ; 178 179  ; 180 181  ; 182 183  ; 
+92       184 185  ; 186 187  ; 188 189  ; 190 191  ; 
+96       192 193  ; 194 195  ; 196 197  ; 198 199  ; 
+
+
+Vdata: 3
+   tag = 1962; reference = 1238;
+   number of records = 10; interlace = FULL_INTERLACE (0);
+   fields = [STATION_NAME, VALUES, FLOATS];
+   record size (in bytes) = 18;
+   name = Multi-Order Vdata; class = No class specified;
+   number of attributes = 0 
+- field index 0: [STATION_NAME], type=4, order=2
+   number of attributes = 0 
+- field index 1: [VALUES], type=24, order=3
+   number of attributes = 0 
+- field index 2: [FLOATS], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        a b  0 1 2  15.500000  ; c d  3 4 5  16.000000  ; 
+2        e f  6 7 8  16.500000  ; g h  9 10 11  17.000000  ; 
+4        i j  12 13 14  17.500000  ; k l  15 16 17  18.000000  ; 
+6        m n  18 19 20  18.500000  ; o p  21 22 23  19.000000  ; 
+8        q r  24 25 26  19.500000  ; s t  27 28 29  20.000000  ; 
+
+
+Vdata: 5
+   tag = 1962; reference = 1240;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-1; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
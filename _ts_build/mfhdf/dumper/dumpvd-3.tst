@@ -0,0 +1,59 @@
+File name: tvset.hdf 
+
+Vdata: 3
+   tag = 1962; reference = 1238;
+   number of records = 10; interlace = FULL_INTERLACE (0);
+   fields = [STATION_NAME, VALUES, FLOATS];
+   record size (in bytes) = 18;
+   name = Multi-Order Vdata; class = No class specified;
+   number of attributes = 0 
+- field index 0: [STATION_NAME], type=4, order=2
+   number of attributes = 0 
+- field index 1: [VALUES], type=24, order=3
+   number of attributes = 0 
+- field index 2: [FLOATS], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        a b  0 1 2  15.500000  ; c d  3 4 5  16.000000  ; 
+2        e f  6 7 8  16.500000  ; g h  9 10 11  17.000000  ; 
+4        i j  12 13 14  17.500000  ; k l  15 16 17  18.000000  ; 
+6        m n  18 19 20  18.500000  ; o p  21 22 23  19.000000  ; 
+8        q r  24 25 26  19.500000  ; s t  27 28 29  20.000000  ; 
+
+
+Vdata: 4
+   tag = 1962; reference = 1239;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-0; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 16
+   tag = 1962; reference = 1251;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-12; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
+Vdata: 17
+   tag = 1962; reference = 1252;
+   number of records = 1; interlace = FULL_INTERLACE (0);
+   fields = [A];
+   record size (in bytes) = 1;
+   name = VdataLoop-13; class = <Undefined>;
+   number of attributes = 0 
+- field index 0: [A], type=4, order=1
+   number of attributes = 0 
+Loc.     Data
+0        V  ; 
+
@@ -0,0 +1,144 @@
+File name: tvset.hdf 
+
+Vdata: 0
+   tag = 1962; reference = 1235;
+   number of records = 100; interlace = FULL_INTERLACE (0);
+   fields = [FIELD_name_HERE];
+   record size (in bytes) = 4;
+   name = Float Vdata; class = Test object;
+   number of attributes = 0 
+- field index 0: [FIELD_name_HERE], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+00       0.000000  ; 1.000000  ; 2.000000  ; 3.000000  ; 
+04       4.000000  ; 5.000000  ; 6.000000  ; 7.000000  ; 
+08       8.000000  ; 9.000000  ; 10.000000  ; 11.000000  ; 
+12       12.000000  ; 13.000000  ; 14.000000  ; 15.000000  ; 
+16       16.000000  ; 17.000000  ; 18.000000  ; 19.000000  ; 
+20       20.000000  ; 21.000000  ; 22.000000  ; 23.000000  ; 
+24       24.000000  ; 25.000000  ; 26.000000  ; 27.000000  ; 
+28       28.000000  ; 29.000000  ; 30.000000  ; 31.000000  ; 
+32       32.000000  ; 33.000000  ; 34.000000  ; 35.000000  ; 
+36       36.000000  ; 37.000000  ; 38.000000  ; 39.000000  ; 
+40       40.000000  ; 41.000000  ; 42.000000  ; 43.000000  ; 
+44       44.000000  ; 45.000000  ; 46.000000  ; 47.000000  ; 
+48       48.000000  ; 49.000000  ; 50.000000  ; 51.000000  ; 
+52       52.000000  ; 53.000000  ; 54.000000  ; 55.000000  ; 
+56       56.000000  ; 57.000000  ; 58.000000  ; 59.000000  ; 
+60       60.000000  ; 61.000000  ; 62.000000  ; 63.000000  ; 
+64       64.000000  ; 65.000000  ; 66.000000  ; 67.000000  ; 
+68       68.000000  ; 69.000000  ; 70.000000  ; 71.000000  ; 
+72       72.000000  ; 73.000000  ; 74.000000  ; 75.000000  ; 
+76       76.000000  ; 77.000000  ; 78.000000  ; 79.000000  ; 
+80       80.000000  ; 81.000000  ; 82.000000  ; 83.000000  ; 
+84       84.000000  ; 85.000000  ; 86.000000  ; 87.000000  ; 
+88       88.000000  ; 89.000000  ; 90.000000  ; 91.000000  ; 
+92       92.000000  ; 93.000000  ; 94.000000  ; 95.000000  ; 
+96       96.000000  ; 97.000000  ; 98.000000  ; 99.000000  ; 
+
+
+Vdata: 1
+   tag = 1962; reference = 1236;
+   number of records = 100; interlace = FULL_INTERLACE (0);
+   fields = [DIFFERENT_FIELD_NAME];
+   record size (in bytes) = 8;
+   name = Integer Vdata; class = Test object;
+   number of attributes = 0 
+- field index 0: [DIFFERENT_FIELD_NAME], type=24, order=2
+   number of attributes = 0 
+Loc.     Data
+00       0 1  ; 2 3  ; 4 5  ; 6 7  ; 
+04       8 9  ; 10 11  ; 12 13  ; 14 15  ; 
+08       16 17  ; 18 19  ; 20 21  ; 22 23  ; 
+12       24 25  ; 26 27  ; 28 29  ; 30 31  ; 
+16       32 33  ; 34 35  ; 36 37  ; 38 39  ; 
+20       40 41  ; 42 43  ; 44 45  ; 46 47  ; 
+24       48 49  ; 50 51  ; 52 53  ; 54 55  ; 
+28       56 57  ; 58 59  ; 60 61  ; 62 63  ; 
+32       64 65  ; 66 67  ; 68 69  ; 70 71  ; 
+36       72 73  ; 74 75  ; 76 77  ; 78 79  ; 
+40       80 81  ; 82 83  ; 84 85  ; 86 87  ; 
+44       88 89  ; 90 91  ; 92 93  ; 94 95  ; 
+48       96 97  ; 98 99  ; 100 101  ; 102 103  ; 
+52       104 105  ; 106 107  ; 108 109  ; 110 111  ; 
+56       112 113  ; 114 115  ; 116 117  ; 118 119  ; 
+60       120 121  ; 122 123  ; 124 125  ; 126 127  ; 
+64       128 129  ; 130 131  ; 132 133  ; 134 135  ; 
+68       136 137  ; 138 139  ; 140 141  ; 142 143  ; 
+72       144 145  ; 146 147  ; 148 149  ; 150 151  ; 
+76       152 153  ; 154 155  ; 156 157  ; 158 159  ; 
+80       160 161  ; 162 163  ; 164 165  ; 166 167  ; 
+84       168 169  ; 170 171  ; 172 173  ; 174 175  ; 
+88       176 177  ; 178 179  ; 180 181  ; 182 183  ; 
+92       184 185  ; 186 187  ; 188 189  ; 190 191  ; 
+96       192 193  ; 194 195  ; 196 197  ; 198 199  ; 
+
+
+Vdata: 2
+   tag = 1962; reference = 1237;
+   number of records = 100; interlace = FULL_INTERLACE (0);
+   fields = [A, B];
+   record size (in bytes) = 8;
+   name = Mixed Vdata; class = No class specified;
+   number of attributes = 0 
+- field index 0: [A], type=5, order=1
+   number of attributes = 0 
+- field index 1: [B], type=24, order=1
+   number of attributes = 0 
+Loc.     Data
+00       0.000000  0  ; 2.000000  1  ; 4.000000  2  ; 
+03       6.000000  3  ; 8.000000  4  ; 10.000000  5  ; 
+06       12.000000  6  ; 14.000000  7  ; 16.000000  8  ; 
+09       18.000000  9  ; 20.000000  10  ; 22.000000  11  ; 
+12       24.000000  12  ; 26.000000  13  ; 28.000000  14  ; 
+15       30.000000  15  ; 32.000000  16  ; 34.000000  17  ; 
+18       36.000000  18  ; 38.000000  19  ; 40.000000  20  ; 
+21       42.000000  21  ; 44.000000  22  ; 46.000000  23  ; 
+24       48.000000  24  ; 50.000000  25  ; 52.000000  26  ; 
+27       54.000000  27  ; 56.000000  28  ; 58.000000  29  ; 
+30       60.000000  30  ; 62.000000  31  ; 64.000000  32  ; 
+33       66.000000  33  ; 68.000000  34  ; 70.000000  35  ; 
+36       72.000000  36  ; 74.000000  37  ; 76.000000  38  ; 
+39       78.000000  39  ; 80.000000  40  ; 82.000000  41  ; 
+42       84.000000  42  ; 86.000000  43  ; 88.000000  44  ; 
+45       90.000000  45  ; 92.000000  46  ; 94.000000  47  ; 
+48       96.000000  48  ; 98.000000  49  ; 100.000000  50  ; 
+51       102.000000  51  ; 104.000000  52  ; 106.000000  53  ; 
+54       108.000000  54  ; 110.000000  55  ; 112.000000  56  ; 
+57       114.000000  57  ; 116.000000  58  ; 118.000000  59  ; 
+60       120.000000  60  ; 122.000000  61  ; 124.000000  62  ; 
+63       126.000000  63  ; 128.000000  64  ; 130.000000  65  ; 
+66       132.000000  66  ; 134.000000  67  ; 136.000000  68  ; 
+69       138.000000  69  ; 140.000000  70  ; 142.000000  71  ; 
+72       144.000000  72  ; 146.000000  73  ; 148.000000  74  ; 
+75       150.000000  75  ; 152.000000  76  ; 154.000000  77  ; 
+78       156.000000  78  ; 158.000000  79  ; 160.000000  80  ; 
+81       162.000000  81  ; 164.000000  82  ; 166.000000  83  ; 
+84       168.000000  84  ; 170.000000  85  ; 172.000000  86  ; 
+87       174.000000  87  ; 176.000000  88  ; 178.000000  89  ; 
+90       180.000000  90  ; 182.000000  91  ; 184.000000  92  ; 
+93       186.000000  93  ; 188.000000  94  ; 190.000000  95  ; 
+96       192.000000  96  ; 194.000000  97  ; 196.000000  98  ; 
+99       198.000000  99  ; 
+
+Vdata: 3
+   tag = 1962; reference = 1238;
+   number of records = 10; interlace = FULL_INTERLACE (0);
+   fields = [STATION_NAME, VALUES, FLOATS];
+   record size (in bytes) = 18;
+   name = Multi-Order Vdata; class = No class specified;
+   number of attributes = 0 
+- field index 0: [STATION_NAME], type=4, order=2
+   number of attributes = 0 
+- field index 1: [VALUES], type=24, order=3
+   number of attributes = 0 
+- field index 2: [FLOATS], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        a b  0 1 2  15.500000  ; c d  3 4 5  16.000000  ; 
+2        e f  6 7 8  16.500000  ; g h  9 10 11  17.000000  ; 
+4        i j  12 13 14  17.500000  ; k l  15 16 17  18.000000  ; 
+6        m n  18 19 20  18.500000  ; o p  21 22 23  19.000000  ; 
+8        q r  24 25 26  19.500000  ; s t  27 28 29  20.000000  ; 
+
+
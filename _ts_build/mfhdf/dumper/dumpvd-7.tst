@@ -0,0 +1,40 @@
+File name: tvset.hdf 
+
+Vdata: 2
+   tag = 1962; reference = 1237;
+   number of records = 100; interlace = FULL_INTERLACE (0);
+   fields = [A, B];
+   record size (in bytes) = 8;
+   name = Mixed Vdata; class = No class specified;
+   number of attributes = 0 
+   number of attributes = 0 
+- field index 1: [B], type=24, order=1
+   number of attributes = 0 
+Loc.     Data
+00       0  ; 1  ; 2  ; 3  ; 
+04       4  ; 5  ; 6  ; 7  ; 
+08       8  ; 9  ; 10  ; 11  ; 
+12       12  ; 13  ; 14  ; 15  ; 
+16       16  ; 17  ; 18  ; 19  ; 
+20       20  ; 21  ; 22  ; 23  ; 
+24       24  ; 25  ; 26  ; 27  ; 
+28       28  ; 29  ; 30  ; 31  ; 
+32       32  ; 33  ; 34  ; 35  ; 
+36       36  ; 37  ; 38  ; 39  ; 
+40       40  ; 41  ; 42  ; 43  ; 
+44       44  ; 45  ; 46  ; 47  ; 
+48       48  ; 49  ; 50  ; 51  ; 
+52       52  ; 53  ; 54  ; 55  ; 
+56       56  ; 57  ; 58  ; 59  ; 
+60       60  ; 61  ; 62  ; 63  ; 
+64       64  ; 65  ; 66  ; 67  ; 
+68       68  ; 69  ; 70  ; 71  ; 
+72       72  ; 73  ; 74  ; 75  ; 
+76       76  ; 77  ; 78  ; 79  ; 
+80       80  ; 81  ; 82  ; 83  ; 
+84       84  ; 85  ; 86  ; 87  ; 
+88       88  ; 89  ; 90  ; 91  ; 
+92       92  ; 93  ; 94  ; 95  ; 
+96       96  ; 97  ; 98  ; 99  ; 
+
+
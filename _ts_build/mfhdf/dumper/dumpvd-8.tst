@@ -0,0 +1,20 @@
+File name: tvset.hdf 
+
+Vdata: 3
+   tag = 1962; reference = 1238;
+   number of records = 10; interlace = FULL_INTERLACE (0);
+   fields = [STATION_NAME, VALUES, FLOATS];
+   record size (in bytes) = 18;
+   name = Multi-Order Vdata; class = No class specified;
+   number of attributes = 0 
+- field index 0: [STATION_NAME], type=4, order=2
+   number of attributes = 0 
+   number of attributes = 0 
+- field index 2: [FLOATS], type=5, order=1
+   number of attributes = 0 
+Loc.     Data
+0        a b  15.500000  ; c d  16.000000  ; e f  16.500000  ; 
+3        g h  17.000000  ; i j  17.500000  ; k l  18.000000  ; 
+6        m n  18.500000  ; o p  19.000000  ; q r  19.500000  ; 
+9        s t  20.000000  ; 
+
@@ -0,0 +1,12 @@
+a b  15.500000   
+c d  16.000000   
+e f  16.500000   
+g h  17.000000   
+i j  17.500000   
+k l  18.000000   
+m n  18.500000   
+o p  19.000000   
+q r  19.500000   
+s t  20.000000   
+
+
@@ -0,0 +1,59 @@
+File name: tvattr.hdf 
+
+
+Vgroup:0
+     tag = 1965; reference = 2;
+     name = vgname0; class = <Undefined>;
+     number of entries = 0;
+   number of attributes = 2 
+    attr0: name=attname1 type=25 count=2 size=8
+	10032 10064 
+    attr1: name=attname2 type=23 count=2 size=4
+	16 32 
+Entries:-
+     None.
+
+
+Vgroup:1
+     tag = 1965; reference = 3;
+     name = vgname1; class = <Undefined>;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 4; 
+	number of records = 3; interlace = 0;
+	fields = [fldname1, fldname2];
+	record size (in bytes) = 2;
+	name = vsname1; class = <Undefined>;
+	total number of attributes = 6.
+
+
+Vgroup:2
+     tag = 1965; reference = 19;
+     name = vgname2; class = vgclass2;
+     number of entries = 1;
+   number of attributes = 2 
+    attr0: name=attname9 type=25 count=1 size=4
+	100 
+    attr1: name=attname10 type=23 count=2 size=4
+	16 32 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 13; 
+	number of records = 3; interlace = 0;
+	fields = [fldname0, fldname1];
+	record size (in bytes) = 8;
+	name = vsname0; class = vsclass0;
+	total number of attributes = 5.
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 
+
+   vg1 	-- vd  
+
+   vg2 	-- vd  
+
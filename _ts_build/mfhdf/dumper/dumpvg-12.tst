@@ -0,0 +1,83 @@
+File name: VGlongname.hdf 
+
+
+Vgroup:0
+     tag = 1965; reference = 3;
+     name = SD Vgroup - this vgroup has an sds as a member and it is actually meant to test long vgroup name; class = Common Vgroups;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Numeric Data Group)
+	tag = 720; reference = 2;
+
+
+Vgroup:1
+     tag = 1965; reference = 5;
+     name = fakeDim0; class = Dim0.0;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 4; 
+	number of records = 1; interlace = 0;
+	fields = [Values];
+	record size (in bytes) = 4;
+	name = fakeDim0; class = DimVal0.1;
+	total number of attributes = 0.
+
+
+Vgroup:2
+     tag = 1965; reference = 7;
+     name = SDS belongs to VG_LONGNAME, which has a very long name that is used to test the new feature of variable length vgroup name; class = Var0.0;
+     number of entries = 4;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 5;
+	number of entries = 1;
+	name = fakeDim0; class = Dim0.0
+   number of attributes = 0 
+     #1 (Number type)
+	tag = 106; reference = 6;
+     #2 (SciData dimension record)
+	tag = 701; reference = 6;
+     #3 (Numeric Data Group)
+	tag = 720; reference = 2;
+
+
+Vgroup:3
+     tag = 1965; reference = 8;
+     name = VGlongname.hdf; class = CDF0.0;
+     number of entries = 2;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 5;
+	number of entries = 1;
+	name = fakeDim0; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vgroup)
+	tag = 1965; reference = 7;
+	number of entries = 4;
+	name = SDS belongs to VG_LONGNAME, which has a very long name that is used to test the new feature of variable length vgroup name; class = Var0.0
+   number of attributes = 0 
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 	-- Numeric Data Group  
+
+   vg1 	-- vd  
+
+   vg2 	-- vg1 	-- vd  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg3 	-- vg1 	-- vd  
+	-- vg2 	-- vg1 	-- vd  
+		-- Number type  
+		-- SciData dimension record  
+		-- Numeric Data Group  
+
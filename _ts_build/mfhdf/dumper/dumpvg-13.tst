@@ -0,0 +1,18 @@
+File name: VGlongname.hdf 
+
+
+Vgroup:0
+     tag = 1965; reference = 3;
+     name = SD Vgroup - this vgroup has an sds as a member and it is actually meant to test long vgroup name; class = Common Vgroups;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Numeric Data Group)
+	tag = 720; reference = 2;
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 	-- Numeric Data Group  
+
@@ -0,0 +1,138 @@
+File name: sds1_dim1_samename.hdf 
+
+
+Vgroup:0
+     tag = 1965; reference = 5;
+     name = Variable 1; class = Dim0.0;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 4; 
+	number of records = 1; interlace = 0;
+	fields = [Values];
+	record size (in bytes) = 4;
+	name = Variable 1; class = DimVal0.1;
+	total number of attributes = 0.
+
+
+Vgroup:1
+     tag = 1965; reference = 9;
+     name = Variable 1; class = Var0.0;
+     number of entries = 6;
+   number of attributes = 1 
+    attr0: name=Attribute SDS 1 type=4 count=23 size=23
+	T h i s   i s   n o t   a   c o o r d   v a r 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 5;
+	number of entries = 1;
+	name = Variable 1; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vdata)
+	tag = 1962; reference = 6; 
+	number of records = 1; interlace = 0;
+	fields = [VALUES];
+	record size (in bytes) = 23;
+	name = Attribute SDS 1; class = Attr0.0;
+	total number of attributes = 0.
+     #2 (Vdata)
+	tag = 1962; reference = 7; 
+	number of records = 0; interlace = 0;
+	fields = [SDS variable];
+	record size (in bytes) = 4;
+	name = <Undefined>; class = SDSVar;
+	total number of attributes = 0.
+     #3 (Number type)
+	tag = 106; reference = 8;
+     #4 (SciData dimension record)
+	tag = 701; reference = 8;
+     #5 (Numeric Data Group)
+	tag = 720; reference = 2;
+
+
+Vgroup:2
+     tag = 1965; reference = 13;
+     name = Variable 1; class = Var0.0;
+     number of entries = 6;
+   number of attributes = 1 
+    attr0: name=Attribute Dimension 1 type=4 count=19 size=19
+	T h i s   i s   a   c o o r d   v a r 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 5;
+	number of entries = 1;
+	name = Variable 1; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vdata)
+	tag = 1962; reference = 10; 
+	number of records = 1; interlace = 0;
+	fields = [VALUES];
+	record size (in bytes) = 19;
+	name = Attribute Dimension 1; class = Attr0.0;
+	total number of attributes = 0.
+     #2 (Vdata)
+	tag = 1962; reference = 11; 
+	number of records = 0; interlace = 0;
+	fields = [Coordinate variable];
+	record size (in bytes) = 4;
+	name = <Undefined>; class = CoordVar;
+	total number of attributes = 0.
+     #3 (Number type)
+	tag = 106; reference = 12;
+     #4 (SciData dimension record)
+	tag = 701; reference = 12;
+     #5 (Numeric Data Group)
+	tag = 720; reference = 3;
+
+
+Vgroup:3
+     tag = 1965; reference = 14;
+     name = sds1_dim1_samename.hdf; class = CDF0.0;
+     number of entries = 3;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 5;
+	number of entries = 1;
+	name = Variable 1; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vgroup)
+	tag = 1965; reference = 9;
+	number of entries = 6;
+	name = Variable 1; class = Var0.0
+   number of attributes = 1 
+    attr0: name=Attribute SDS 1 type=4 count=23 size=23
+	T h i s   i s   n o t   a   c o o r d   v a r 
+     #2 (Vgroup)
+	tag = 1965; reference = 13;
+	number of entries = 6;
+	name = Variable 1; class = Var0.0
+   number of attributes = 1 
+    attr0: name=Attribute Dimension 1 type=4 count=19 size=19
+	T h i s   i s   a   c o o r d   v a r 
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 	-- vd  
+
+   vg1 	-- vg0 	-- vd  
+	-- vd  
+	-- vd  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg2 	-- vg0 	-- vd  
+	-- vd  
+	-- vd  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg3 	-- vg0 	-- vd  
+	-- vg0 	-- vd  
+	-- vg0 	-- vd  
+
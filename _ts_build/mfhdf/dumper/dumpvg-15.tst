@@ -0,0 +1,214 @@
+File name: sds2_dim1_samename.hdf 
+
+
+Vgroup:0
+     tag = 1965; reference = 8;
+     name = Variable 2; class = Dim0.0;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 7; 
+	number of records = 1; interlace = 0;
+	fields = [Values];
+	record size (in bytes) = 4;
+	name = Variable 2; class = DimVal0.1;
+	total number of attributes = 0.
+
+
+Vgroup:1
+     tag = 1965; reference = 10;
+     name = fakeDim1; class = Dim0.0;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 9; 
+	number of records = 1; interlace = 0;
+	fields = [Values];
+	record size (in bytes) = 4;
+	name = fakeDim1; class = DimVal0.1;
+	total number of attributes = 0.
+
+
+Vgroup:2
+     tag = 1965; reference = 12;
+     name = fakeDim2; class = Dim0.0;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 11; 
+	number of records = 1; interlace = 0;
+	fields = [Values];
+	record size (in bytes) = 4;
+	name = fakeDim2; class = DimVal0.1;
+	total number of attributes = 0.
+
+
+Vgroup:3
+     tag = 1965; reference = 15;
+     name = Variable 1; class = Var0.0;
+     number of entries = 5;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 8;
+	number of entries = 1;
+	name = Variable 2; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vdata)
+	tag = 1962; reference = 13; 
+	number of records = 0; interlace = 0;
+	fields = [SDS variable];
+	record size (in bytes) = 4;
+	name = <Undefined>; class = SDSVar;
+	total number of attributes = 0.
+     #2 (Number type)
+	tag = 106; reference = 14;
+     #3 (SciData dimension record)
+	tag = 701; reference = 14;
+     #4 (Numeric Data Group)
+	tag = 720; reference = 2;
+
+
+Vgroup:4
+     tag = 1965; reference = 18;
+     name = Variable 2; class = Var0.0;
+     number of entries = 7;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 10;
+	number of entries = 1;
+	name = fakeDim1; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vgroup)
+	tag = 1965; reference = 12;
+	number of entries = 1;
+	name = fakeDim2; class = Dim0.0
+   number of attributes = 0 
+     #2 (Vdata)
+	tag = 1962; reference = 16; 
+	number of records = 0; interlace = 0;
+	fields = [SDS variable];
+	record size (in bytes) = 4;
+	name = <Undefined>; class = SDSVar;
+	total number of attributes = 0.
+     #3 (Scientific Data)
+	tag = 702; reference = 4;
+     #4 (Number type)
+	tag = 106; reference = 17;
+     #5 (SciData dimension record)
+	tag = 701; reference = 17;
+     #6 (Numeric Data Group)
+	tag = 720; reference = 3;
+
+
+Vgroup:5
+     tag = 1965; reference = 21;
+     name = Variable 2; class = Var0.0;
+     number of entries = 6;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 8;
+	number of entries = 1;
+	name = Variable 2; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vdata)
+	tag = 1962; reference = 19; 
+	number of records = 0; interlace = 0;
+	fields = [Coordinate variable];
+	record size (in bytes) = 4;
+	name = <Undefined>; class = CoordVar;
+	total number of attributes = 0.
+     #2 (Scientific Data)
+	tag = 702; reference = 6;
+     #3 (Number type)
+	tag = 106; reference = 20;
+     #4 (SciData dimension record)
+	tag = 701; reference = 20;
+     #5 (Numeric Data Group)
+	tag = 720; reference = 5;
+
+
+Vgroup:6
+     tag = 1965; reference = 22;
+     name = sds2_dim1_samename.hdf; class = CDF0.0;
+     number of entries = 6;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 8;
+	number of entries = 1;
+	name = Variable 2; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vgroup)
+	tag = 1965; reference = 10;
+	number of entries = 1;
+	name = fakeDim1; class = Dim0.0
+   number of attributes = 0 
+     #2 (Vgroup)
+	tag = 1965; reference = 12;
+	number of entries = 1;
+	name = fakeDim2; class = Dim0.0
+   number of attributes = 0 
+     #3 (Vgroup)
+	tag = 1965; reference = 15;
+	number of entries = 5;
+	name = Variable 1; class = Var0.0
+   number of attributes = 0 
+     #4 (Vgroup)
+	tag = 1965; reference = 18;
+	number of entries = 7;
+	name = Variable 2; class = Var0.0
+   number of attributes = 0 
+     #5 (Vgroup)
+	tag = 1965; reference = 21;
+	number of entries = 6;
+	name = Variable 2; class = Var0.0
+   number of attributes = 0 
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 	-- vd  
+
+   vg1 	-- vd  
+
+   vg2 	-- vd  
+
+   vg3 	-- vg0 	-- vd  
+	-- vd  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg4 	-- vg1 	-- vd  
+	-- vg2 	-- vd  
+	-- vd  
+	-- Scientific Data  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg5 	-- vg0 	-- vd  
+	-- vd  
+	-- Scientific Data  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg6 	-- vg0 	-- vd  
+	-- vg1 	-- vd  
+	-- vg2 	-- vd  
+	-- vg3 	-- vg0 	-- vd  
+		-- vd  
+		-- Number type  
+		-- SciData dimension record  
+		-- Numeric Data Group  
+	-- vg0 	-- vd  
+	-- vg0 	-- vd  
+
@@ -0,0 +1,42 @@
+File name: grtdfi322.hdf 
+
+
+Vgroup:0
+     tag = 1965; reference = 5;
+     name = Image_array_5; class = RI0.0;
+     number of entries = 2;
+   number of attributes = 0 
+
+
+Vgroup:1
+     tag = 1965; reference = 6;
+     name = RIG0.0; class = <Undefined>;
+     number of entries = 4;
+   number of attributes = 0 
+
+
+Vgroup:2
+     tag = 1965; reference = 7;
+     name = Raster Image #0; class = RI0.0;
+     number of entries = 3;
+   number of attributes = 0 
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 	-- Image Dimensions  
+	-- Raster Image Data  
+
+   vg1 	-- vg2 	-- Image Dimensions  
+		-- Raster Image Data  
+		-- vd  
+	-- <vg/ref=0>  
+	-- vg0 	-- Image Dimensions  
+		-- Raster Image Data  
+	-- vd  
+
+   vg2 	-- Image Dimensions  
+	-- Raster Image Data  
+	-- vd  
+
@@ -0,0 +1,79 @@
+File name: grtdfi322.hdf 
+
+
+Vgroup:0
+     tag = 1965; reference = 5;
+     name = Image_array_5; class = RI0.0;
+     number of entries = 2;
+   number of attributes = 0 
+Entries:-
+     #0 (Image Dimensions)
+	tag = 300; reference = 5;
+     #1 (Raster Image Data)
+	tag = 302; reference = 5;
+
+
+Vgroup:1
+     tag = 1965; reference = 6;
+     name = RIG0.0; class = <Undefined>;
+     number of entries = 4;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 7;
+	number of entries = 3;
+	name = Raster Image #0; class = RI0.0
+   number of attributes = 0 
+     #1 (Vgroup)
+	tag = 1965;reference = 0;
+     #2 (Vgroup)
+	tag = 1965; reference = 5;
+	number of entries = 2;
+	name = Image_array_5; class = RI0.0
+   number of attributes = 0 
+     #3 (Vdata)
+	tag = 1962; reference = 9; 
+	number of records = 16; interlace = 0;
+	fields = [File contents];
+	record size (in bytes) = 1;
+	name = RIATTR0.0N; class = RIATTR0.0C;
+	total number of attributes = 0.
+
+
+Vgroup:2
+     tag = 1965; reference = 7;
+     name = Raster Image #0; class = RI0.0;
+     number of entries = 3;
+   number of attributes = 0 
+Entries:-
+     #0 (Image Dimensions)
+	tag = 300; reference = 2;
+     #1 (Raster Image Data)
+	tag = 302; reference = 2;
+     #2 (Vdata)
+	tag = 1962; reference = 8; 
+	number of records = 2; interlace = 0;
+	fields = [Value range];
+	record size (in bytes) = 4;
+	name = RIATTR0.0N; class = RIATTR0.0C;
+	total number of attributes = 0.
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 	-- Image Dimensions  
+	-- Raster Image Data  
+
+   vg1 	-- vg2 	-- Image Dimensions  
+		-- Raster Image Data  
+		-- vd  
+	-- <vg/ref=0>  
+	-- vg0 	-- Image Dimensions  
+		-- Raster Image Data  
+	-- vd  
+
+   vg2 	-- Image Dimensions  
+	-- Raster Image Data  
+	-- vd  
+
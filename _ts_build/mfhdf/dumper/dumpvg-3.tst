@@ -0,0 +1,29 @@
+File name: tvset.hdf 
+
+
+Vgroup:1
+     tag = 1965; reference = 3;
+     name = Second Vgroup; class = Test object;
+     number of entries = 3;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 2;
+	number of entries = 0;
+	name = Simple Vgroup; class = Test object
+   number of attributes = 0 
+     #1 (Unknown Tag)
+	tag = 1000; reference = 12345;
+     #2 (Unknown Tag)
+	tag = 123; reference = 1234;
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 
+
+   vg1 	-- vg0 
+	-- Unknown Object  
+	-- Unknown Object  
+
@@ -0,0 +1,17 @@
+File name: tvset.hdf 
+
+
+Vgroup:0
+     tag = 1965; reference = 2;
+     name = Simple Vgroup; class = Test object;
+     number of entries = 0;
+   number of attributes = 0 
+Entries:-
+     None.
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 
+
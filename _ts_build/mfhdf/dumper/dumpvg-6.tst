@@ -0,0 +1,100 @@
+File name: tdata.hdf 
+
+
+Vgroup:1
+     tag = 1965; reference = 30;
+     name = bands; class = Dim0.0;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 29; 
+	number of records = 3; interlace = 0;
+	fields = [Values];
+	record size (in bytes) = 4;
+	name = bands; class = DimVal0.0;
+	total number of attributes = 0.
+
+
+Vgroup:3
+     tag = 1965; reference = 34;
+     name = a; class = Var0.0;
+     number of entries = 7;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 32;
+	number of entries = 1;
+	name = rec; class = UDim0.0
+   number of attributes = 0 
+     #1 (Vgroup)
+	tag = 1965; reference = 28;
+	number of entries = 1;
+	name = nsamp; class = Dim0.0
+   number of attributes = 0 
+     #2 (Vgroup)
+	tag = 1965; reference = 30;
+	number of entries = 1;
+	name = bands; class = Dim0.0
+   number of attributes = 0 
+     #3 (Scientific Data)
+	tag = 702; reference = 18;
+     #4 (Number type)
+	tag = 106; reference = 33;
+     #5 (SciData dimension record)
+	tag = 701; reference = 33;
+     #6 (Numeric Data Group)
+	tag = 720; reference = 2;
+
+
+Vgroup:5
+     tag = 1965; reference = 38;
+     name = c; class = Var0.0;
+     number of entries = 5;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 32;
+	number of entries = 1;
+	name = rec; class = UDim0.0
+   number of attributes = 0 
+     #1 (Scientific Data)
+	tag = 702; reference = 24;
+     #2 (Number type)
+	tag = 106; reference = 37;
+     #3 (SciData dimension record)
+	tag = 701; reference = 37;
+     #4 (Numeric Data Group)
+	tag = 720; reference = 4;
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 	-- vd  
+
+   vg1 	-- vd  
+
+   vg2 	-- vd  
+
+   vg3 	-- vg2 	-- vd  
+	-- vg0 	-- vd  
+	-- vg1 	-- vd  
+	-- Scientific Data  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg4 	-- vg2 	-- vd  
+	-- vg1 	-- vd  
+	-- Scientific Data  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg5 	-- vg2 	-- vd  
+	-- Scientific Data  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
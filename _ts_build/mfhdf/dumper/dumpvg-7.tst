@@ -0,0 +1,108 @@
+File name: tdata.hdf 
+
+
+Vgroup:2
+     tag = 1965; reference = 32;
+     name = rec; class = UDim0.0;
+     number of entries = 1;
+   number of attributes = 0 
+Entries:-
+     #0 (Vdata)
+	tag = 1962; reference = 31; 
+	number of records = 1; interlace = 0;
+	fields = [Values];
+	record size (in bytes) = 4;
+	name = rec; class = DimVal0.0;
+	total number of attributes = 0.
+
+
+Vgroup:6
+     tag = 1965; reference = 39;
+     name = tdata.hdf; class = CDF0.0;
+     number of entries = 6;
+   number of attributes = 0 
+Entries:-
+     #0 (Vgroup)
+	tag = 1965; reference = 28;
+	number of entries = 1;
+	name = nsamp; class = Dim0.0
+   number of attributes = 0 
+     #1 (Vgroup)
+	tag = 1965; reference = 30;
+	number of entries = 1;
+	name = bands; class = Dim0.0
+   number of attributes = 0 
+     #2 (Vgroup)
+	tag = 1965; reference = 32;
+	number of entries = 1;
+	name = rec; class = UDim0.0
+   number of attributes = 0 
+     #3 (Vgroup)
+	tag = 1965; reference = 34;
+	number of entries = 7;
+	name = a; class = Var0.0
+   number of attributes = 0 
+     #4 (Vgroup)
+	tag = 1965; reference = 36;
+	number of entries = 6;
+	name = b; class = Var0.0
+   number of attributes = 0 
+     #5 (Vgroup)
+	tag = 1965; reference = 38;
+	number of entries = 5;
+	name = c; class = Var0.0
+   number of attributes = 0 
+
+
+Graphical representation of the file:-
+(vg#: vgroup;   vd: vdata)
+
+   vg0 	-- vd  
+
+   vg1 	-- vd  
+
+   vg2 	-- vd  
+
+   vg3 	-- vg2 	-- vd  
+	-- vg0 	-- vd  
+	-- vg1 	-- vd  
+	-- Scientific Data  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg4 	-- vg2 	-- vd  
+	-- vg1 	-- vd  
+	-- Scientific Data  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg5 	-- vg2 	-- vd  
+	-- Scientific Data  
+	-- Number type  
+	-- SciData dimension record  
+	-- Numeric Data Group  
+
+   vg6 	-- vg0 	-- vd  
+	-- vg1 	-- vd  
+	-- vg2 	-- vd  
+	-- vg3 	-- vg2 	-- vd  
+		-- vg0 	-- vd  
+		-- vg1 	-- vd  
+		-- Scientific Data  
+		-- Number type  
+		-- SciData dimension record  
+		-- Numeric Data Group  
+	-- vg4 	-- vg2 	-- vd  
+		-- vg1 	-- vd  
+		-- Scientific Data  
+		-- Number type  
+		-- SciData dimension record  
+		-- Numeric Data Group  
+	-- vg5 	-- vg2 	-- vd  
+		-- Scientific Data  
+		-- Number type  
+		-- SciData dimension record  
+		-- Numeric Data Group  
+
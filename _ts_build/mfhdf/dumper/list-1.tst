@@ -0,0 +1,21 @@
+File: tdata.hdf
+Last modified with NCSA HDF Version 3.3 Release 4, October 1994
+
+Linked Blocks Indicator: (tag 20)
+	Ref nos: 18 19 20 21 22 23 24 25 26 
+Version Descriptor  : (tag 30)
+	Ref nos: 1 
+Number type         : (tag 106)
+	Ref nos: 33 35 37 
+SciData dimension record: (tag 701)
+	Ref nos: 33 35 37 
+Numeric Data Group  : (tag 720)
+	Ref nos: 2 3 4 
+Vdata               : (tag 1962)
+	Ref nos: 27 29 31 
+Vdata Storage       : (tag 1963)
+	Ref nos: 27 29 31 
+Vgroup              : (tag 1965)
+	Ref nos: 28 30 32 34 36 38 39 
+Special Scientific Data: (tag 17086)
+	Ref nos: 18 21 24 
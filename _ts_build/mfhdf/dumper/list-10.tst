@@ -0,0 +1,54 @@
+File: Example6.hdf
+Last modified with NCSA HDF Version 4.0 Release 1, Jan. 19, 1996
+
+File Label #0: This is a file label for AN 
+File Label #1: This is a file label for AN 
+   no             tagname     tag     ref  index_by_tag
+    0  Version Descriptor      30       1           0
+    1     File Identifier     100       1           0
+    2     File Identifier     100       2           1
+    3    File Description     101       1           0
+    4    File Description     101       2           1
+    5       Data Id Label     104       1           0
+    6       Data Id Label     104       2           1
+    7       Data Id Label     104       3           2
+    8       Data Id Label     104       4           3
+    9       Data Id Label     104       5           4
+   10       Data Id Label     104       6           5
+   11  Data Id Annotation     105       1           0
+   12  Data Id Annotation     105       2           1
+   13  Data Id Annotation     105       3           2
+   14  Data Id Annotation     105       4           3
+   15         Number type     106      25           0
+   16         Number type     106      27           1
+   17SciData dimension record     701      25           0
+   18SciData dimension record     701      27           1
+   19  Numeric Data Group     720       2           0
+    Name/Label=Data label for AN 
+   20  Numeric Data Group     720      12           1
+    Name/Label=Data label for AN 
+   21               Vdata    1962      13           0
+    Name/Label=This is a data label for Vdata
+   22               Vdata    1962      14           1
+   23               Vdata    1962      16           2
+   24               Vdata    1962      17           3
+   25               Vdata    1962      19           4
+   26               Vdata    1962      20           5
+   27               Vdata    1962      22           6
+   28               Vdata    1962      23           7
+   29       Vdata Storage    1963      13           0
+   30       Vdata Storage    1963      14           1
+   31       Vdata Storage    1963      16           2
+   32       Vdata Storage    1963      17           3
+   33       Vdata Storage    1963      19           4
+   34       Vdata Storage    1963      20           5
+   35       Vdata Storage    1963      22           6
+   36       Vdata Storage    1963      23           7
+   37              Vgroup    1965      15           0
+    Name/Label=This is a data label for Vgroup
+   38              Vgroup    1965      18           1
+   39              Vgroup    1965      21           2
+   40              Vgroup    1965      24           3
+   41              Vgroup    1965      26           4
+   42              Vgroup    1965      28           5
+   43              Vgroup    1965      29           6
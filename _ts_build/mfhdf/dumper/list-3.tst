@@ -0,0 +1,39 @@
+File: tdata.hdf
+Last modified with NCSA HDF Version 3.3 Release 4, October 1994
+
+   no             tagname     tag     ref  index_by_tag      offset      length
+    0Linked Blocks Indicator      20      18           0        3054          24
+    1Linked Blocks Indicator      20      19           1        3094         258
+    2Linked Blocks Indicator      20      20           2        3402        1536
+    3Linked Blocks Indicator      20      21           3        4938          12
+    4Linked Blocks Indicator      20      22           4        4966         258
+    5Linked Blocks Indicator      20      23           5        5270         768
+    6Linked Blocks Indicator      20      24           6        6038           4
+    7Linked Blocks Indicator      20      25           7        6058         258
+    8Linked Blocks Indicator      20      26           8        6358         256
+    9  Version Descriptor      30       1           0        2410          92
+   10         Number type     106      33           0        6884           4
+   11         Number type     106      35           1        6980           4
+   12         Number type     106      37           2        7064           4
+   13SciData dimension record     701      33           0        6888          30
+   14SciData dimension record     701      35           1        6984          22
+   15SciData dimension record     701      37           2        7068          14
+   16  Numeric Data Group     720       2           0        6918          12
+   17  Numeric Data Group     720       3           1        7006          12
+   18  Numeric Data Group     720       4           2        7082          12
+   19               Vdata    1962      27           0        6622          53
+   20               Vdata    1962      29           1        6717          53
+   21               Vdata    1962      31           2        6804          51
+   22       Vdata Storage    1963      27           0        6614           8
+   23       Vdata Storage    1963      29           1        6705          12
+   24       Vdata Storage    1963      31           2        6800           4
+   25              Vgroup    1965      28           0        6675          30
+   26              Vgroup    1965      30           1        6770          30
+   27              Vgroup    1965      32           2        6855          29
+   28              Vgroup    1965      34           3        6930          50
+   29              Vgroup    1965      36           4        7018          46
+   30              Vgroup    1965      38           5        7094          42
+   31              Vgroup    1965      39           6        7136          54
+   32Special Scientific Data   17086      18           0           0         120
+   33Special Scientific Data   17086      21           1           0          60
+   34Special Scientific Data   17086      24           2           0          20
@@ -0,0 +1,42 @@
+File: tdata.hdf
+Last modified with NCSA HDF Version 3.3 Release 4, October 1994
+
+   no             tagname     tag     ref  index_by_tag
+    0Linked Blocks Indicator      20      18           0
+    1Linked Blocks Indicator      20      19           1
+    2Linked Blocks Indicator      20      20           2
+    3Linked Blocks Indicator      20      21           3
+    4Linked Blocks Indicator      20      22           4
+    5Linked Blocks Indicator      20      23           5
+    6Linked Blocks Indicator      20      24           6
+    7Linked Blocks Indicator      20      25           7
+    8Linked Blocks Indicator      20      26           8
+    9  Version Descriptor      30       1           0
+   10         Number type     106      33           0
+   11         Number type     106      35           1
+   12         Number type     106      37           2
+   13SciData dimension record     701      33           0
+   14SciData dimension record     701      35           1
+   15SciData dimension record     701      37           2
+   16  Numeric Data Group     720       2           0
+   17  Numeric Data Group     720       3           1
+   18  Numeric Data Group     720       4           2
+   19               Vdata    1962      27           0
+   20               Vdata    1962      29           1
+   21               Vdata    1962      31           2
+   22       Vdata Storage    1963      27           0
+   23       Vdata Storage    1963      29           1
+   24       Vdata Storage    1963      31           2
+   25              Vgroup    1965      28           0
+   26              Vgroup    1965      30           1
+   27              Vgroup    1965      32           2
+   28              Vgroup    1965      34           3
+   29              Vgroup    1965      36           4
+   30              Vgroup    1965      38           5
+   31              Vgroup    1965      39           6
+   32Special Scientific Data   17086      18           0
+	Linked Block: first 24 standard 1536 per unit 128
+   33Special Scientific Data   17086      21           1
+	Linked Block: first 12 standard 768 per unit 128
+   34Special Scientific Data   17086      24           2
+	Linked Block: first 4 standard 256 per unit 128
@@ -0,0 +1,5 @@
+File: tdata.hdf
+Last modified with NCSA HDF Version 3.3 Release 4, October 1994
+
+Numeric Data Group  : (tag 720)
+	Ref nos: 2 3 4 
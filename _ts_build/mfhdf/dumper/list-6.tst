@@ -0,0 +1,7 @@
+File: tdata.hdf
+Last modified with NCSA HDF Version 3.3 Release 4, October 1994
+
+   no             tagname     tag     ref  index_by_tag      offset      length
+   16  Numeric Data Group     720       2           0        6918          12
+   17  Numeric Data Group     720       3           1        7006          12
+   18  Numeric Data Group     720       4           2        7082          12
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/gen_sds_floats"
+  "../../bin/gen_sds_floats.pdb"
+  "CMakeFiles/gen_sds_floats.dir/gen_sds_floats.c.o"
+  "CMakeFiles/gen_sds_floats.dir/gen_sds_floats.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gen_sds_floats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hdfimport-shared"
+  "../../bin/hdfimport-shared.pdb"
+  "CMakeFiles/hdfimport-shared.dir/hdfimport.c.o"
+  "CMakeFiles/hdfimport-shared.dir/hdfimport.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfimport-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hdfimport"
+  "../../bin/hdfimport.pdb"
+  "CMakeFiles/hdfimport.dir/hdfimport.c.o"
+  "CMakeFiles/hdfimport.dir/hdfimport.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfimport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdfimport_files"
+  "SDSfloat2.hdf"
+  "SDSfloat2.tst"
+  "SDSfloat3.hdf"
+  "SDSfloat3.tst"
+  "cb16i2.tst"
+  "cb16i3.tst"
+  "cb32i2.tst"
+  "cb32i3.tst"
+  "cb32r2.tst"
+  "cb32r3.tst"
+  "cb64r2-n.tst"
+  "cb64r2.tst"
+  "cb64r2_ris.tst"
+  "cb64r3-n.tst"
+  "cb64r3.tst"
+  "ctxtr2.tst"
+  "ctxtr2_ris.tst"
+  "ctxtr3.tst"
+  "hdfimport.input1"
+  "hdfimport.out1"
+  "hdfimport.out2"
+  "hdfimport.out3"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/hdfimport_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hdfimporttest"
+  "../../bin/hdfimporttest.pdb"
+  "CMakeFiles/hdfimporttest.dir/hdfimporttest.c.o"
+  "CMakeFiles/hdfimporttest.dir/hdfimporttest.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfimporttest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,109 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf/hdfimport
+# Build directory: /root/repo/_ts_build/mfhdf/hdfimport
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(hdfimport-clear-refs "/usr/bin/cmake" "-E" "remove" "ctxtr2" "ctxtr3" "cb32i2" "cb32i3" "cb16i2" "cb16i3" "cb32r2" "cb32r3" "cb64r2" "cb64r3" "cb64r2-n" "cb64r3-n" "ctxtr2_ris" "cb64r2_ris" "ctxtr2.hdf" "ctxtr3.hdf" "cb32i2.hdf" "cb32i3.hdf" "cb16i2.hdf" "cb16i3.hdf" "cb32r2.hdf" "cb32r3.hdf" "cb64r2.hdf" "cb64r3.hdf" "cb64r2-n.hdf" "cb64r3-n.hdf" "ctxtr2_ris.hdf" "cb64r2_ris.hdf" "ctxtr2.tmp" "ctxtr3.tmp" "cb32i2.tmp" "cb32i3.tmp" "cb16i2.tmp" "cb16i3.tmp" "cb32r2.tmp" "cb32r3.tmp" "cb64r2.tmp" "cb64r3.tmp" "cb64r2-n.tmp" "cb64r3-n.tmp" "ctxtr2_ris.tmp" "cb64r2_ris.tmp" "SDSfloat2.tmp" "SDSfloat3.tmp" "ctxtr2.tmp.err" "ctxtr3.tmp.err" "cb32i2.tmp.err" "cb32i3.tmp.err" "cb16i2.tmp.err" "cb16i3.tmp.err" "cb32r2.tmp.err" "cb32r3.tmp.err" "cb64r2.tmp.err" "cb64r3.tmp.err" "cb64r2-n.tmp.err" "cb64r3-n.tmp.err" "ctxtr2_ris.tmp.err" "cb64r2_ris.tmp.err" "SDSfloat2.tmp.err" "SDSfloat3.tmp.err")
+set_tests_properties(hdfimport-clear-refs PROPERTIES  LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;195;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTtest "/root/repo/_ts_build/bin/hdfimporttest")
+set_tests_properties(HIMPORTtest PROPERTIES  DEPENDS "hdfimport-clear-refs" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;266;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-ctxtr2 "/root/repo/_ts_build/bin/hdfimport-shared" "ctxtr2" "-o" "ctxtr2.hdf")
+set_tests_properties(HIMPORT-ctxtr2 PROPERTIES  DEPENDS "HIMPORTtest" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;275;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-ctxtr2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;ctxtr2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=ctxtr2.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=ctxtr2.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-ctxtr2 PROPERTIES  DEPENDS "HIMPORT-ctxtr2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;275;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-ctxtr3 "/root/repo/_ts_build/bin/hdfimport-shared" "ctxtr3" "-o" "ctxtr3.hdf")
+set_tests_properties(HIMPORT-ctxtr3 PROPERTIES  DEPENDS "HIMPORTLS-ctxtr2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;277;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-ctxtr3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;ctxtr3.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=ctxtr3.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=ctxtr3.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-ctxtr3 PROPERTIES  DEPENDS "HIMPORT-ctxtr3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;277;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb32i2 "/root/repo/_ts_build/bin/hdfimport-shared" "cb32i2" "-o" "cb32i2.hdf")
+set_tests_properties(HIMPORT-cb32i2 PROPERTIES  DEPENDS "HIMPORTLS-ctxtr3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;279;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb32i2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb32i2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb32i2.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb32i2.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb32i2 PROPERTIES  DEPENDS "HIMPORT-cb32i2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;279;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb32i3 "/root/repo/_ts_build/bin/hdfimport-shared" "cb32i3" "-o" "cb32i3.hdf")
+set_tests_properties(HIMPORT-cb32i3 PROPERTIES  DEPENDS "HIMPORTLS-cb32i2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;281;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb32i3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb32i3.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb32i3.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb32i3.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb32i3 PROPERTIES  DEPENDS "HIMPORT-cb32i3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;281;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb16i2 "/root/repo/_ts_build/bin/hdfimport-shared" "cb16i2" "-o" "cb16i2.hdf")
+set_tests_properties(HIMPORT-cb16i2 PROPERTIES  DEPENDS "HIMPORTLS-cb32i3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;283;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb16i2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb16i2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb16i2.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb16i2.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb16i2 PROPERTIES  DEPENDS "HIMPORT-cb16i2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;283;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb16i3 "/root/repo/_ts_build/bin/hdfimport-shared" "cb16i3" "-o" "cb16i3.hdf")
+set_tests_properties(HIMPORT-cb16i3 PROPERTIES  DEPENDS "HIMPORTLS-cb16i2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;285;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb16i3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb16i3.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb16i3.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb16i3.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb16i3 PROPERTIES  DEPENDS "HIMPORT-cb16i3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;285;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb32r2 "/root/repo/_ts_build/bin/hdfimport-shared" "cb32r2" "-o" "cb32r2.hdf")
+set_tests_properties(HIMPORT-cb32r2 PROPERTIES  DEPENDS "HIMPORTLS-cb16i3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;287;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb32r2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb32r2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb32r2.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb32r2.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb32r2 PROPERTIES  DEPENDS "HIMPORT-cb32r2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;287;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb32r3 "/root/repo/_ts_build/bin/hdfimport-shared" "cb32r3" "-o" "cb32r3.hdf")
+set_tests_properties(HIMPORT-cb32r3 PROPERTIES  DEPENDS "HIMPORTLS-cb32r2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;289;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb32r3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb32r3.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb32r3.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb32r3.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb32r3 PROPERTIES  DEPENDS "HIMPORT-cb32r3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;289;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb64r2 "/root/repo/_ts_build/bin/hdfimport-shared" "cb64r2" "-o" "cb64r2.hdf")
+set_tests_properties(HIMPORT-cb64r2 PROPERTIES  DEPENDS "HIMPORTLS-cb32r3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;291;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb64r2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb64r2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb64r2.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb64r2.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb64r2 PROPERTIES  DEPENDS "HIMPORT-cb64r2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;291;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb64r3 "/root/repo/_ts_build/bin/hdfimport-shared" "cb64r3" "-o" "cb64r3.hdf")
+set_tests_properties(HIMPORT-cb64r3 PROPERTIES  DEPENDS "HIMPORTLS-cb64r2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;104;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;293;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb64r3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb64r3.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb64r3.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb64r3.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb64r3 PROPERTIES  DEPENDS "HIMPORT-cb64r3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;293;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb64r2-n "/root/repo/_ts_build/bin/hdfimport-shared" "cb64r2" "-n" "-o" "cb64r2-n.hdf")
+set_tests_properties(HIMPORT-cb64r2-n PROPERTIES  DEPENDS "HIMPORTLS-cb64r3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;98;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;295;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb64r2-n "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb64r2-n.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb64r2-n.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb64r2-n.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb64r2-n PROPERTIES  DEPENDS "HIMPORT-cb64r2-n" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;295;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb64r3-n "/root/repo/_ts_build/bin/hdfimport-shared" "cb64r3" "-n" "-o" "cb64r3-n.hdf")
+set_tests_properties(HIMPORT-cb64r3-n PROPERTIES  DEPENDS "HIMPORTLS-cb64r2-n" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;98;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;297;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb64r3-n "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb64r3-n.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb64r3-n.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb64r3-n.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb64r3-n PROPERTIES  DEPENDS "HIMPORT-cb64r3-n" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;297;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-ctxtr2_ris "/root/repo/_ts_build/bin/hdfimport-shared" "ctxtr2" "-o" "ctxtr2_ris.hdf" "-raster" "-e" "50" "50")
+set_tests_properties(HIMPORT-ctxtr2_ris PROPERTIES  DEPENDS "HIMPORTLS-cb64r3-n" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;101;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;299;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-ctxtr2_ris "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;ctxtr2_ris.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=ctxtr2_ris.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=ctxtr2_ris.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-ctxtr2_ris PROPERTIES  DEPENDS "HIMPORT-ctxtr2_ris" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;299;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-cb64r2_ris "/root/repo/_ts_build/bin/hdfimport-shared" "cb64r2" "-o" "cb64r2_ris.hdf" "-raster" "-i" "50" "50" "-f")
+set_tests_properties(HIMPORT-cb64r2_ris PROPERTIES  DEPENDS "HIMPORTLS-ctxtr2_ris" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;101;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;300;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-cb64r2_ris "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=-l;cb64r2_ris.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=cb64r2_ris.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=cb64r2_ris.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-cb64r2_ris PROPERTIES  DEPENDS "HIMPORT-cb64r2_ris" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;300;ADD_H4_TEST;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-OUT-SDSfloat2 "/root/repo/_ts_build/bin/hdfimport-shared" "SDSfloat2.hdf" "-o" "SDSfloat2.out")
+set_tests_properties(HIMPORT-OUT-SDSfloat2 PROPERTIES  DEPENDS "HIMPORTLS-cb64r2_ris" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;134;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;304;ADD_H4_TEST_OUT;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-OUT-SDSfloat2 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=SDSfloat2.out" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=SDSfloat2.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=SDSfloat2.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-OUT-SDSfloat2 PROPERTIES  DEPENDS "HIMPORT-OUT-SDSfloat2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;144;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;304;ADD_H4_TEST_OUT;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-OUT-SDSfloat3 "/root/repo/_ts_build/bin/hdfimport-shared" "SDSfloat3.hdf" "-o" "SDSfloat3.out")
+set_tests_properties(HIMPORT-OUT-SDSfloat3 PROPERTIES  DEPENDS "HIMPORTLS-OUT-SDSfloat2" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;134;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;305;ADD_H4_TEST_OUT;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORTLS-OUT-SDSfloat3 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfls-shared" "-D" "TEST_ARGS:STRING=SDSfloat3.out" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_OUTPUT=SDSfloat3.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_FILTER:STRING=(File library|String)[^
+]+
+" "-D" "TEST_REFERENCE=SDSfloat3.tst" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORTLS-OUT-SDSfloat3 PROPERTIES  DEPENDS "HIMPORT-OUT-SDSfloat3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;144;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;305;ADD_H4_TEST_OUT;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+add_test(HIMPORT-EDIT "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdfed-shared" "-D" "TEST_ARGS:STRING=-batch" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdfimport" "-D" "TEST_INPUT=hdfimport.input1" "-D" "TEST_OUTPUT=hdfimport.input1.tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=hdfimport.out2" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HIMPORT-EDIT PROPERTIES  DEPENDS "HIMPORTLS-OUT-SDSfloat3" LABELS "HDF4_MFHDF_HDFIMPORT" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdfimport/CMakeTests.cmake;166;add_test;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;307;ADD_H4_TEST_ED;/root/repo/mfhdf/hdfimport/CMakeTests.cmake;0;;/root/repo/mfhdf/hdfimport/CMakeLists.txt;35;include;/root/repo/mfhdf/hdfimport/CMakeLists.txt;0;")
+set_directory_properties(PROPERTIES LABELS "“MFHDF”")
@@ -0,0 +1,49 @@
+cb32r2.hdf:
+
+Version Descriptor            : (tag 30)
+	Ref no      1	      92 bytes
+
+Number type                   : (tag 106)
+	Ref no     14	       4 bytes
+	Ref no     17	       4 bytes
+	Ref no     20	       4 bytes
+
+SciData dimension record      : (tag 701)
+	Ref no     14	      22 bytes
+	Ref no     17	      14 bytes
+	Ref no     20	      14 bytes
+
+Scientific Data               : (tag 702)
+	Ref no      4	      12 bytes
+	Ref no      6	      16 bytes
+	Ref no      7	      48 bytes
+
+Numeric Data Group            : (tag 720)
+	Ref no      2	      16 bytes
+	Ref no      3	      16 bytes
+	Ref no      5	      16 bytes
+
+Vdata                         : (tag 1962)
+	Ref no      8	      60 bytes
+	Ref no     10	      60 bytes
+	Ref no     12	      61 bytes
+	Ref no     13	      55 bytes
+	Ref no     16	      64 bytes
+	Ref no     19	      64 bytes
+
+Vdata Storage                 : (tag 1963)
+	Ref no      8	       4 bytes
+	Ref no     10	       4 bytes
+	Ref no     12	       8 bytes
+	Ref no     13	      -1 bytes
+	Ref no     16	      -1 bytes
+	Ref no     19	      -1 bytes
+
+Vgroup                        : (tag 1965)
+	Ref no      9	      33 bytes
+	Ref no     11	      33 bytes
+	Ref no     15	      60 bytes
+	Ref no     18	      53 bytes
+	Ref no     21	      53 bytes
+	Ref no     22	      51 bytes
+
@@ -0,0 +1,59 @@
+cb32r3.hdf:
+
+Version Descriptor            : (tag 30)
+	Ref no      1	      92 bytes
+
+Number type                   : (tag 106)
+	Ref no     18	       4 bytes
+	Ref no     21	       4 bytes
+	Ref no     24	       4 bytes
+	Ref no     27	       4 bytes
+
+SciData dimension record      : (tag 701)
+	Ref no     18	      30 bytes
+	Ref no     21	      14 bytes
+	Ref no     24	      14 bytes
+	Ref no     27	      14 bytes
+
+Scientific Data               : (tag 702)
+	Ref no      4	      20 bytes
+	Ref no      6	      12 bytes
+	Ref no      8	      16 bytes
+	Ref no      9	     240 bytes
+
+Numeric Data Group            : (tag 720)
+	Ref no      2	      16 bytes
+	Ref no      3	      16 bytes
+	Ref no      5	      16 bytes
+	Ref no      7	      16 bytes
+
+Vdata                         : (tag 1962)
+	Ref no     10	      60 bytes
+	Ref no     12	      60 bytes
+	Ref no     14	      60 bytes
+	Ref no     16	      61 bytes
+	Ref no     17	      55 bytes
+	Ref no     20	      64 bytes
+	Ref no     23	      64 bytes
+	Ref no     26	      64 bytes
+
+Vdata Storage                 : (tag 1963)
+	Ref no     10	       4 bytes
+	Ref no     12	       4 bytes
+	Ref no     14	       4 bytes
+	Ref no     16	       8 bytes
+	Ref no     17	      -1 bytes
+	Ref no     20	      -1 bytes
+	Ref no     23	      -1 bytes
+	Ref no     26	      -1 bytes
+
+Vgroup                        : (tag 1965)
+	Ref no     11	      33 bytes
+	Ref no     13	      33 bytes
+	Ref no     15	      33 bytes
+	Ref no     19	      64 bytes
+	Ref no     22	      53 bytes
+	Ref no     25	      53 bytes
+	Ref no     28	      53 bytes
+	Ref no     29	      59 bytes
+
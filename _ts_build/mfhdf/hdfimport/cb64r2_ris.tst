@@ -0,0 +1,65 @@
+cb64r2_ris.hdf:
+
+Version Descriptor            : (tag 30)
+	Ref no      1	      92 bytes
+
+Number type                   : (tag 106)
+	Ref no      8	       4 bytes
+	Ref no     15	       4 bytes
+	Ref no     18	       4 bytes
+	Ref no     21	       4 bytes
+
+Image Dimensions-8            : (tag 200)
+	Ref no      8	       4 bytes
+
+RLE Compressed Image-8        : (tag 203)
+	Ref no      8	    2550 bytes
+
+Image Dimensions              : (tag 300)
+	Ref no      8	      20 bytes
+
+Compressed Image              : (tag 303)
+	Ref no      8	    2550 bytes
+
+Raster Image Group            : (tag 306)
+	Ref no      8	       8 bytes
+
+SciData dimension record      : (tag 701)
+	Ref no     15	      22 bytes
+	Ref no     18	      14 bytes
+	Ref no     21	      14 bytes
+
+Scientific Data               : (tag 702)
+	Ref no      4	      12 bytes
+	Ref no      6	      16 bytes
+	Ref no      7	      48 bytes
+
+Numeric Data Group            : (tag 720)
+	Ref no      2	      16 bytes
+	Ref no      3	      16 bytes
+	Ref no      5	      16 bytes
+
+Vdata                         : (tag 1962)
+	Ref no      9	      60 bytes
+	Ref no     11	      60 bytes
+	Ref no     13	      61 bytes
+	Ref no     14	      55 bytes
+	Ref no     17	      64 bytes
+	Ref no     20	      64 bytes
+
+Vdata Storage                 : (tag 1963)
+	Ref no      9	       4 bytes
+	Ref no     11	       4 bytes
+	Ref no     13	       8 bytes
+	Ref no     14	      -1 bytes
+	Ref no     17	      -1 bytes
+	Ref no     20	      -1 bytes
+
+Vgroup                        : (tag 1965)
+	Ref no     10	      33 bytes
+	Ref no     12	      33 bytes
+	Ref no     16	      60 bytes
+	Ref no     19	      53 bytes
+	Ref no     22	      53 bytes
+	Ref no     23	      55 bytes
+
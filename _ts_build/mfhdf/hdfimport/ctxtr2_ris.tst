@@ -0,0 +1,23 @@
+ctxtr2_ris.hdf:
+
+Version Descriptor            : (tag 30)
+	Ref no      1	      92 bytes
+
+Number type                   : (tag 106)
+	Ref no      2	       4 bytes
+
+Image Dimensions-8            : (tag 200)
+	Ref no      2	       4 bytes
+
+RLE Compressed Image-8        : (tag 203)
+	Ref no      2	     400 bytes
+
+Image Dimensions              : (tag 300)
+	Ref no      2	      20 bytes
+
+Compressed Image              : (tag 303)
+	Ref no      2	     400 bytes
+
+Raster Image Group            : (tag 306)
+	Ref no      2	       8 bytes
+
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/util/h4getopt.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/__/util/h4getopt.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/__/util/h4getopt.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_array.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_array.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_array.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_dim.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_dim.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_dim.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_gattr.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_gattr.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_gattr.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_gr.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_gr.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_gr.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_list.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_list.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_list.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_main.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_main.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_main.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_mattbl.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_mattbl.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_mattbl.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_misc.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_misc.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_misc.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_sds.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_sds.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_sds.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_table.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_table.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_table.c.o.d"
+  "/root/repo/mfhdf/hdiff/hdiff_vs.c" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_vs.c.o" "gcc" "mfhdf/hdiff/CMakeFiles/hdiff-shared.dir/hdiff_vs.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
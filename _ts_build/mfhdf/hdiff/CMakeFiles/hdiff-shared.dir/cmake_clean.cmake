@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../bin/hdiff-shared"
+  "../../bin/hdiff-shared.pdb"
+  "CMakeFiles/hdiff-shared.dir/__/util/h4getopt.c.o"
+  "CMakeFiles/hdiff-shared.dir/__/util/h4getopt.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_array.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_array.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_dim.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_dim.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_gattr.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_gattr.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_gr.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_gr.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_list.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_list.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_main.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_main.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_mattbl.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_mattbl.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_misc.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_misc.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_sds.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_sds.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_table.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_table.c.o.d"
+  "CMakeFiles/hdiff-shared.dir/hdiff_vs.c.o"
+  "CMakeFiles/hdiff-shared.dir/hdiff_vs.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdiff-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
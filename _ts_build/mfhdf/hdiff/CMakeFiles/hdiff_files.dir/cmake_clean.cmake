@@ -0,0 +1,30 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdiff_files"
+  "testfiles/hdiff_01.txt"
+  "testfiles/hdiff_02.txt"
+  "testfiles/hdiff_03.txt"
+  "testfiles/hdiff_04.txt"
+  "testfiles/hdiff_05.txt"
+  "testfiles/hdiff_06.txt"
+  "testfiles/hdiff_07.txt"
+  "testfiles/hdiff_08.txt"
+  "testfiles/hdiff_09.txt"
+  "testfiles/hdiff_10.txt"
+  "testfiles/hdiff_11.txt"
+  "testfiles/hdiff_12.txt"
+  "testfiles/hdiff_13.txt"
+  "testfiles/hdiff_14.txt"
+  "testfiles/hdiff_15.txt"
+  "testfiles/hdifftst1.hdf"
+  "testfiles/hdifftst2.hdf"
+  "testfiles/hdifftst3.hdf"
+  "testfiles/hdifftst4.hdf"
+  "testfiles/hdifftst5.hdf"
+  "testfiles/hdifftst6.hdf"
+  "testfiles/hdifftst7.hdf"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/hdiff_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
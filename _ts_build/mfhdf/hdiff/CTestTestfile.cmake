@@ -0,0 +1,39 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf/hdiff
+# Build directory: /root/repo/_ts_build/mfhdf/hdiff
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HDIFF-clearall-objects "/usr/bin/cmake" "-E" "remove" "hdiff_01.out" "hdiff_02.out" "hdiff_03.out" "hdiff_04.out" "hdiff_05.out" "hdiff_06.out" "hdiff_07.out" "hdiff_08.out" "hdiff_09.out" "hdiff_10.out" "hdiff_11.out" "hdiff_12.out" "hdiff_13.out" "hdiff_14.out" "hdiff_15.out" "hdiff_01.out.err" "hdiff_02.out.err" "hdiff_03.out.err" "hdiff_04.out.err" "hdiff_05.out.err" "hdiff_06.out.err" "hdiff_07.out.err" "hdiff_08.out.err" "hdiff_09.out.err" "hdiff_10.out.err" "hdiff_11.out.err" "hdiff_12.out.err" "hdiff_13.out.err" "hdiff_14.out.err" "hdiff_15.out.err")
+set_tests_properties(HDIFF-clearall-objects PROPERTIES  LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;128;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_01 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_01.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_01.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_01 PROPERTIES  DEPENDS "HDIFF-clearall-objects" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;170;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_02 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-g;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_02.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_02.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_02 PROPERTIES  DEPENDS "HDIFF-hdiff_01" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;173;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_03 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-s;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_03.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_03.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_03 PROPERTIES  DEPENDS "HDIFF-hdiff_02" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;176;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_04 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-d;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_04.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_04.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_04 PROPERTIES  DEPENDS "HDIFF-hdiff_03" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;179;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_05 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-D;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_05.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_05.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_05 PROPERTIES  DEPENDS "HDIFF-hdiff_04" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;182;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_06 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-d;-S;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_06.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_06.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_06 PROPERTIES  DEPENDS "HDIFF-hdiff_05" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;185;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_07 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-d;-v;dset1;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_07.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_07.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_07 PROPERTIES  DEPENDS "HDIFF-hdiff_06" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;188;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_08 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-D;-u;vdata1;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_08.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_08.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_08 PROPERTIES  DEPENDS "HDIFF-hdiff_07" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;191;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_09 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-d;-e;2;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_09.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_09.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_09 PROPERTIES  DEPENDS "HDIFF-hdiff_08" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;194;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_10 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-d;-t;2;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_10.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_10.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_10 PROPERTIES  DEPENDS "HDIFF-hdiff_09" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;197;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_11 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_11.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_11.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_11 PROPERTIES  DEPENDS "HDIFF-hdiff_10" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;200;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_12 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-d;-p;0.05;-v;dset3;hdifftst1.hdf;hdifftst2.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_12.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_12.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_12 PROPERTIES  DEPENDS "HDIFF-hdiff_11" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;203;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_13 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=hdifftst3.hdf;hdifftst4.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_13.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=hdiff_13.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_13 PROPERTIES  DEPENDS "HDIFF-hdiff_12" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;206;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_14 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=hdifftst5.hdf;hdifftst6.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_14.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hdiff_14.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_14 PROPERTIES  DEPENDS "HDIFF-hdiff_13" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;209;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+add_test(HDIFF-hdiff_15 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hdiff-shared" "-D" "TEST_ARGS:STRING=-b;hdifftst7.hdf;hdifftst7.hdf" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hdiff/testfiles" "-D" "TEST_OUTPUT=hdiff_15.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=hdiff_15.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HDIFF-hdiff_15 PROPERTIES  DEPENDS "HDIFF-hdiff_14" LABELS "HDF4_MFHDF_HDIFF" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hdiff/CMakeTests.cmake;61;add_test;/root/repo/mfhdf/hdiff/CMakeTests.cmake;212;ADD_H4_TEST;/root/repo/mfhdf/hdiff/CMakeTests.cmake;0;;/root/repo/mfhdf/hdiff/CMakeLists.txt;45;include;/root/repo/mfhdf/hdiff/CMakeLists.txt;0;")
+set_directory_properties(PROPERTIES LABELS "“MFHDF”")
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/hrepack/hrepack.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_an.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_an.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_an.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_dim.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_dim.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_dim.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_gr.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_gr.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_gr.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_list.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_list.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_list.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_lsttable.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_lsttable.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_lsttable.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_main.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_main.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_main.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_opttable.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_opttable.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_opttable.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_parse.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_parse.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_parse.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_sds.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_sds.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_sds.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_utils.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_utils.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_utils.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_vg.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_vg.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_vg.c.o.d"
+  "/root/repo/mfhdf/hrepack/hrepack_vs.c" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_vs.c.o" "gcc" "mfhdf/hrepack/CMakeFiles/hrepack-shared.dir/hrepack_vs.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
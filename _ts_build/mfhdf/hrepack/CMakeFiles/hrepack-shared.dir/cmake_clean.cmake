@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../bin/hrepack-shared"
+  "../../bin/hrepack-shared.pdb"
+  "CMakeFiles/hrepack-shared.dir/hrepack.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_an.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_an.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_dim.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_dim.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_gr.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_gr.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_list.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_list.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_lsttable.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_lsttable.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_main.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_main.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_opttable.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_opttable.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_parse.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_parse.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_sds.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_sds.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_utils.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_utils.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_vg.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_vg.c.o.d"
+  "CMakeFiles/hrepack-shared.dir/hrepack_vs.c.o"
+  "CMakeFiles/hrepack-shared.dir/hrepack_vs.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hrepack-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
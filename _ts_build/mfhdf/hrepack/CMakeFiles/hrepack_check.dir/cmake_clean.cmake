@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hrepack_check"
+  "../../bin/hrepack_check.pdb"
+  "CMakeFiles/hrepack_check.dir/hrepack_check.c.o"
+  "CMakeFiles/hrepack_check.dir/hrepack_check.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hrepack_check.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hrepack_files"
+  "hrepack_check_help.txt"
+  "hrepack_help.txt"
+  "image24pixel.txt"
+  "image24plane.txt"
+  "image8.txt"
+  "info.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/hrepack_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
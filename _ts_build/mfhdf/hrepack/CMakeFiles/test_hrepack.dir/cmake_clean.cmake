@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_hrepack"
+  "../../bin/test_hrepack.pdb"
+  "CMakeFiles/test_hrepack.dir/hrepacktst.c.o"
+  "CMakeFiles/test_hrepack.dir/hrepacktst.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_hrepack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,89 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf/hrepack
+# Build directory: /root/repo/_ts_build/mfhdf/hrepack
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(HREPACK-hrepack-clearall-objects "/usr/bin/cmake" "-E" "remove" "hrepack_help.out" "hrepack_check_help.out" "hrepacktst1.hdf" "hrepacktst2.hdf" "hrepacktst3.hdf")
+set_tests_properties(HREPACK-hrepack-clearall-objects PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;73;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-hrepack_check "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hrepack_check-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hrepack" "-D" "TEST_OUTPUT=hrepack_check_help.out" "-D" "TEST_EXPECT=1" "-D" "TEST_REFERENCE=hrepack_check_help.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HREPACK-hrepack_check PROPERTIES  DEPENDS "HREPACK-hrepack-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;84;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-hrepack_help "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/hrepack-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/hrepack" "-D" "TEST_OUTPUT=hrepack_help.out" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=hrepack_help.txt" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(HREPACK-hrepack_help PROPERTIES  DEPENDS "HREPACK-hrepack-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;100;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-test_hrepack "/root/repo/_ts_build/bin/test_hrepack")
+set_tests_properties(HREPACK-test_hrepack PROPERTIES  DEPENDS "HREPACK-hrepack-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;115;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-HUFF-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-HUFF.hrepacktst1.hdf")
+set_tests_properties(HREPACK-HUFF-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;126;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-HUFF "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-HUFF.hrepacktst1.hdf" "-t" "dset7:HUFF 1" "-c" "dset7:10x8x6")
+set_tests_properties(HREPACK-HUFF PROPERTIES  DEPENDS "HREPACK-HUFF-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;126;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-HUFF_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-HUFF.hrepacktst1.hdf")
+set_tests_properties(HREPACK-HUFF_DFF PROPERTIES  DEPENDS "HREPACK-HUFF" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;126;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-RLE-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-RLE.hrepacktst1.hdf")
+set_tests_properties(HREPACK-RLE-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;139;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-RLE "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-RLE.hrepacktst1.hdf" "-t" "dset4:RLE" "-c" "dset4:10x8")
+set_tests_properties(HREPACK-RLE PROPERTIES  DEPENDS "HREPACK-RLE-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;139;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-RLE_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-RLE.hrepacktst1.hdf")
+set_tests_properties(HREPACK-RLE_DFF PROPERTIES  DEPENDS "HREPACK-RLE" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;139;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDSGZIP_CHUNK-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-SDSGZIP_CHUNK.hrepacktst1.hdf")
+set_tests_properties(HREPACK-SDSGZIP_CHUNK-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;151;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDSGZIP_CHUNK "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-SDSGZIP_CHUNK.hrepacktst1.hdf" "-t" "dset4:GZIP 6" "-c" "dset4:10x8")
+set_tests_properties(HREPACK-SDSGZIP_CHUNK PROPERTIES  DEPENDS "HREPACK-SDSGZIP_CHUNK-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;151;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDSGZIP_CHUNK_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-SDSGZIP_CHUNK.hrepacktst1.hdf")
+set_tests_properties(HREPACK-SDSGZIP_CHUNK_DFF PROPERTIES  DEPENDS "HREPACK-SDSGZIP_CHUNK" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;151;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDSSZIP_CHUNK-SKIPPED "/usr/bin/cmake" "-E" "echo" "SKIP  -v -i /root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf -o /root/repo/_ts_build/mfhdf/hrepack/out-SDSSZIP_CHUNK.hrepacktst1.hdf -c;dset4:10x8")
+set_tests_properties(HREPACK-SDSSZIP_CHUNK-SKIPPED PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;43;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;167;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDSNONE_CHUNKNONE-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-SDSNONE_CHUNKNONE.hrepacktst1.hdf")
+set_tests_properties(HREPACK-SDSNONE_CHUNKNONE-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;183;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDSNONE_CHUNKNONE "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-SDSNONE_CHUNKNONE.hrepacktst1.hdf" "-t" "dset_chunk_comp:NONE" "-t" "dset_chunk:NONE" "-c" "dset_chunk_comp:NONE" "-c" "dset_chunk:NONE")
+set_tests_properties(HREPACK-SDSNONE_CHUNKNONE PROPERTIES  DEPENDS "HREPACK-SDSNONE_CHUNKNONE-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;183;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDSNONE_CHUNKNONE_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-SDSNONE_CHUNKNONE.hrepacktst1.hdf")
+set_tests_properties(HREPACK-SDSNONE_CHUNKNONE_DFF PROPERTIES  DEPENDS "HREPACK-SDSNONE_CHUNKNONE" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;183;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDS_CHUNK-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-SDS_CHUNK.hrepacktst1.hdf")
+set_tests_properties(HREPACK-SDS_CHUNK-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;203;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDS_CHUNK "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-SDS_CHUNK.hrepacktst1.hdf" "-t" "dset4:GZIP 9" "-t" "dset5:RLE" "-t" "dset6:HUFF 2" "-c" "dset4:10x8" "-c" "dset5:10x8" "-c" "dset6:10x8")
+set_tests_properties(HREPACK-SDS_CHUNK PROPERTIES  DEPENDS "HREPACK-SDS_CHUNK-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;203;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SDS_CHUNK_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-SDS_CHUNK.hrepacktst1.hdf")
+set_tests_properties(HREPACK-SDS_CHUNK_DFF PROPERTIES  DEPENDS "HREPACK-SDS_CHUNK" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;203;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SEL_NOCHUNK-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-SEL_NOCHUNK.hrepacktst1.hdf")
+set_tests_properties(HREPACK-SEL_NOCHUNK-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;234;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SEL_NOCHUNK "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-SEL_NOCHUNK.hrepacktst1.hdf" "-t" "dset4:GZIP 9" "-t" "dset5:RLE" "-t" "dset6:HUFF 2")
+set_tests_properties(HREPACK-SEL_NOCHUNK PROPERTIES  DEPENDS "HREPACK-SEL_NOCHUNK-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;234;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-SEL_NOCHUNK_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-SEL_NOCHUNK.hrepacktst1.hdf")
+set_tests_properties(HREPACK-SEL_NOCHUNK_DFF PROPERTIES  DEPENDS "HREPACK-SEL_NOCHUNK" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;234;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-COMPALL_CHUNKNONE-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-COMPALL_CHUNKNONE.hrepacktst1.hdf")
+set_tests_properties(HREPACK-COMPALL_CHUNKNONE-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;256;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-COMPALL_CHUNKNONE "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-COMPALL_CHUNKNONE.hrepacktst1.hdf" "-t" "*:GZIP 1" "-c" "dset_chunk_comp:NONE" "-c" "dset_chunk:NONE")
+set_tests_properties(HREPACK-COMPALL_CHUNKNONE PROPERTIES  DEPENDS "HREPACK-COMPALL_CHUNKNONE-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;256;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-COMPALL_CHUNKNONE_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-COMPALL_CHUNKNONE.hrepacktst1.hdf")
+set_tests_properties(HREPACK-COMPALL_CHUNKNONE_DFF PROPERTIES  DEPENDS "HREPACK-COMPALL_CHUNKNONE" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;256;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-NOCOMP_CHUNKALL-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-NOCOMP_CHUNKALL.hrepacktst1.hdf")
+set_tests_properties(HREPACK-NOCOMP_CHUNKALL-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;270;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-NOCOMP_CHUNKALL "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-NOCOMP_CHUNKALL.hrepacktst1.hdf" "-c" "*:10x8")
+set_tests_properties(HREPACK-NOCOMP_CHUNKALL PROPERTIES  DEPENDS "HREPACK-NOCOMP_CHUNKALL-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;270;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-NOCOMP_CHUNKALL_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-NOCOMP_CHUNKALL.hrepacktst1.hdf")
+set_tests_properties(HREPACK-NOCOMP_CHUNKALL_DFF PROPERTIES  DEPENDS "HREPACK-NOCOMP_CHUNKALL" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;270;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-GZIP-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-GZIP.hrepacktst1.hdf")
+set_tests_properties(HREPACK-GZIP-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;281;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-GZIP "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-GZIP.hrepacktst1.hdf" "-t" "*:GZIP 1")
+set_tests_properties(HREPACK-GZIP PROPERTIES  DEPENDS "HREPACK-GZIP-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;281;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-GZIP_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst1.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-GZIP.hrepacktst1.hdf")
+set_tests_properties(HREPACK-GZIP_DFF PROPERTIES  DEPENDS "HREPACK-GZIP" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;281;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-HYPERSLAB-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-HYPERSLAB.hrepacktst2.hdf")
+set_tests_properties(HREPACK-HYPERSLAB-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;292;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-HYPERSLAB "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst2.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-HYPERSLAB.hrepacktst2.hdf")
+set_tests_properties(HREPACK-HYPERSLAB PROPERTIES  DEPENDS "HREPACK-HYPERSLAB-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;292;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-HYPERSLAB_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst2.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-HYPERSLAB.hrepacktst2.hdf")
+set_tests_properties(HREPACK-HYPERSLAB_DFF PROPERTIES  DEPENDS "HREPACK-HYPERSLAB" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;292;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-VGROUP-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-VGROUP.hrepacktst3.hdf")
+set_tests_properties(HREPACK-VGROUP-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;299;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-VGROUP "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst3.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-VGROUP.hrepacktst3.hdf")
+set_tests_properties(HREPACK-VGROUP PROPERTIES  DEPENDS "HREPACK-VGROUP-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;299;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-VGROUP_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst3.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-VGROUP.hrepacktst3.hdf")
+set_tests_properties(HREPACK-VGROUP_DFF PROPERTIES  DEPENDS "HREPACK-VGROUP" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;299;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-COMPACT-clearall-objects "/usr/bin/cmake" "-E" "remove" "out-COMPACT.hrepacktst3.hdf")
+set_tests_properties(HREPACK-COMPACT-clearall-objects PROPERTIES  DEPENDS "HREPACK-test_hrepack" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;49;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;306;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-COMPACT "/root/repo/_ts_build/bin/hrepack-shared" "-v" "-i" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst3.hdf" "-o" "/root/repo/_ts_build/mfhdf/hrepack/out-COMPACT.hrepacktst3.hdf" "-k")
+set_tests_properties(HREPACK-COMPACT PROPERTIES  DEPENDS "HREPACK-COMPACT-clearall-objects" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;54;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;306;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+add_test(HREPACK-COMPACT_DFF "/root/repo/_ts_build/bin/hdiff-shared" "/root/repo/_ts_build/mfhdf/hrepack/hrepacktst3.hdf" "/root/repo/_ts_build/mfhdf/hrepack/out-COMPACT.hrepacktst3.hdf")
+set_tests_properties(HREPACK-COMPACT_DFF PROPERTIES  DEPENDS "HREPACK-COMPACT" LABELS "HDF4_MFHDF_HREPACK" _BACKTRACE_TRIPLES "/root/repo/mfhdf/hrepack/CMakeTests.cmake;59;add_test;/root/repo/mfhdf/hrepack/CMakeTests.cmake;306;ADD_H4_TEST;/root/repo/mfhdf/hrepack/CMakeTests.cmake;0;;/root/repo/mfhdf/hrepack/CMakeLists.txt;57;include;/root/repo/mfhdf/hrepack/CMakeLists.txt;0;")
+set_directory_properties(PROPERTIES LABELS "“MFHDF”")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../bin/libmfhdf.pdb"
+  "../../bin/libmfhdf.so"
+  "../../bin/libmfhdf.so.4"
+  "../../bin/libmfhdf.so.4.0.3"
+  "CMakeFiles/mfhdf-shared.dir/array.c.o"
+  "CMakeFiles/mfhdf-shared.dir/array.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/attr.c.o"
+  "CMakeFiles/mfhdf-shared.dir/attr.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/cdf.c.o"
+  "CMakeFiles/mfhdf-shared.dir/cdf.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/dim.c.o"
+  "CMakeFiles/mfhdf-shared.dir/dim.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/error.c.o"
+  "CMakeFiles/mfhdf-shared.dir/error.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/file.c.o"
+  "CMakeFiles/mfhdf-shared.dir/file.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/globdef.c.o"
+  "CMakeFiles/mfhdf-shared.dir/globdef.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/h4_xdr.c.o"
+  "CMakeFiles/mfhdf-shared.dir/h4_xdr.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/hdfsds.c.o"
+  "CMakeFiles/mfhdf-shared.dir/hdfsds.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/iarray.c.o"
+  "CMakeFiles/mfhdf-shared.dir/iarray.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/mfdatainfo.c.o"
+  "CMakeFiles/mfhdf-shared.dir/mfdatainfo.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/mfsd.c.o"
+  "CMakeFiles/mfhdf-shared.dir/mfsd.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/nssdc.c.o"
+  "CMakeFiles/mfhdf-shared.dir/nssdc.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/putget.c.o"
+  "CMakeFiles/mfhdf-shared.dir/putget.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/putgetg.c.o"
+  "CMakeFiles/mfhdf-shared.dir/putgetg.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/sharray.c.o"
+  "CMakeFiles/mfhdf-shared.dir/sharray.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/string.c.o"
+  "CMakeFiles/mfhdf-shared.dir/string.c.o.d"
+  "CMakeFiles/mfhdf-shared.dir/var.c.o"
+  "CMakeFiles/mfhdf-shared.dir/var.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mfhdf-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/libsrc/array.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/array.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/array.c.o.d"
+  "/root/repo/mfhdf/libsrc/attr.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/attr.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/attr.c.o.d"
+  "/root/repo/mfhdf/libsrc/cdf.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/cdf.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/cdf.c.o.d"
+  "/root/repo/mfhdf/libsrc/dim.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/dim.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/dim.c.o.d"
+  "/root/repo/mfhdf/libsrc/error.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/error.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/error.c.o.d"
+  "/root/repo/mfhdf/libsrc/file.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/file.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/file.c.o.d"
+  "/root/repo/mfhdf/libsrc/globdef.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/globdef.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/globdef.c.o.d"
+  "/root/repo/mfhdf/libsrc/h4_xdr.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/h4_xdr.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/h4_xdr.c.o.d"
+  "/root/repo/mfhdf/libsrc/hdfsds.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/hdfsds.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/hdfsds.c.o.d"
+  "/root/repo/mfhdf/libsrc/iarray.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/iarray.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/iarray.c.o.d"
+  "/root/repo/mfhdf/libsrc/mfdatainfo.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/mfdatainfo.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/mfdatainfo.c.o.d"
+  "/root/repo/mfhdf/libsrc/mfsd.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/mfsd.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/mfsd.c.o.d"
+  "/root/repo/mfhdf/libsrc/nssdc.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/nssdc.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/nssdc.c.o.d"
+  "/root/repo/mfhdf/libsrc/putget.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/putget.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/putget.c.o.d"
+  "/root/repo/mfhdf/libsrc/putgetg.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/putgetg.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/putgetg.c.o.d"
+  "/root/repo/mfhdf/libsrc/sharray.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/sharray.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/sharray.c.o.d"
+  "/root/repo/mfhdf/libsrc/string.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/string.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/string.c.o.d"
+  "/root/repo/mfhdf/libsrc/var.c" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/var.c.o" "gcc" "mfhdf/libsrc/CMakeFiles/mfhdf-static.dir/var.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
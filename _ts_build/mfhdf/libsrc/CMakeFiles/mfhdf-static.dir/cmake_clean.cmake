@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../bin/libmfhdf.a"
+  "../../bin/libmfhdf.pdb"
+  "CMakeFiles/mfhdf-static.dir/array.c.o"
+  "CMakeFiles/mfhdf-static.dir/array.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/attr.c.o"
+  "CMakeFiles/mfhdf-static.dir/attr.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/cdf.c.o"
+  "CMakeFiles/mfhdf-static.dir/cdf.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/dim.c.o"
+  "CMakeFiles/mfhdf-static.dir/dim.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/error.c.o"
+  "CMakeFiles/mfhdf-static.dir/error.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/file.c.o"
+  "CMakeFiles/mfhdf-static.dir/file.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/globdef.c.o"
+  "CMakeFiles/mfhdf-static.dir/globdef.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/h4_xdr.c.o"
+  "CMakeFiles/mfhdf-static.dir/h4_xdr.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/hdfsds.c.o"
+  "CMakeFiles/mfhdf-static.dir/hdfsds.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/iarray.c.o"
+  "CMakeFiles/mfhdf-static.dir/iarray.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/mfdatainfo.c.o"
+  "CMakeFiles/mfhdf-static.dir/mfdatainfo.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/mfsd.c.o"
+  "CMakeFiles/mfhdf-static.dir/mfsd.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/nssdc.c.o"
+  "CMakeFiles/mfhdf-static.dir/nssdc.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/putget.c.o"
+  "CMakeFiles/mfhdf-static.dir/putget.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/putgetg.c.o"
+  "CMakeFiles/mfhdf-static.dir/putgetg.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/sharray.c.o"
+  "CMakeFiles/mfhdf-static.dir/sharray.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/string.c.o"
+  "CMakeFiles/mfhdf-static.dir/string.c.o.d"
+  "CMakeFiles/mfhdf-static.dir/var.c.o"
+  "CMakeFiles/mfhdf-static.dir/var.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mfhdf-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/util/h4getopt.c" "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/__/util/h4getopt.c.o" "gcc" "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/__/util/h4getopt.c.o.d"
+  "/root/repo/mfhdf/ncdump/dumplib.c" "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/dumplib.c.o" "gcc" "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/dumplib.c.o.d"
+  "/root/repo/mfhdf/ncdump/ncdump.c" "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/ncdump.c.o" "gcc" "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/ncdump.c.o.d"
+  "/root/repo/mfhdf/ncdump/vardata.c" "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/vardata.c.o" "gcc" "mfhdf/ncdump/CMakeFiles/ncdump-shared.dir/vardata.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../bin/ncdump-shared"
+  "../../bin/ncdump-shared.pdb"
+  "CMakeFiles/ncdump-shared.dir/__/util/h4getopt.c.o"
+  "CMakeFiles/ncdump-shared.dir/__/util/h4getopt.c.o.d"
+  "CMakeFiles/ncdump-shared.dir/dumplib.c.o"
+  "CMakeFiles/ncdump-shared.dir/dumplib.c.o.d"
+  "CMakeFiles/ncdump-shared.dir/ncdump.c.o"
+  "CMakeFiles/ncdump-shared.dir/ncdump.c.o.d"
+  "CMakeFiles/ncdump-shared.dir/vardata.c.o"
+  "CMakeFiles/ncdump-shared.dir/vardata.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdump-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
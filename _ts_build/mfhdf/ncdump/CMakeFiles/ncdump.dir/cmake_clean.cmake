@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../bin/ncdump"
+  "../../bin/ncdump.pdb"
+  "CMakeFiles/ncdump.dir/__/util/h4getopt.c.o"
+  "CMakeFiles/ncdump.dir/__/util/h4getopt.c.o.d"
+  "CMakeFiles/ncdump.dir/dumplib.c.o"
+  "CMakeFiles/ncdump.dir/dumplib.c.o.d"
+  "CMakeFiles/ncdump.dir/ncdump.c.o"
+  "CMakeFiles/ncdump.dir/ncdump.c.o.d"
+  "CMakeFiles/ncdump.dir/vardata.c.o"
+  "CMakeFiles/ncdump.dir/vardata.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncdump_files"
+  "test0.cdl"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ncdump_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf/ncdump
+# Build directory: /root/repo/_ts_build/mfhdf/ncdump
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(NCDUMP-clearall-objects "/usr/bin/cmake" "-E" "remove" "test0.nc" "test1.nc" "test1.cdl" "test2.cdl")
+set_tests_properties(NCDUMP-clearall-objects PROPERTIES  LABELS "HDF4_MFHDF_NCDUMP" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncdump/CMakeTests.cmake;15;add_test;/root/repo/mfhdf/ncdump/CMakeTests.cmake;0;;/root/repo/mfhdf/ncdump/CMakeLists.txt;32;include;/root/repo/mfhdf/ncdump/CMakeLists.txt;0;")
+add_test(NCDUMP-test0.nc "/root/repo/_ts_build/bin/ncgen-shared" "-o" "test0.nc" "-n" "test0.cdl")
+set_tests_properties(NCDUMP-test0.nc PROPERTIES  DEPENDS "NCDUMP-clearall-objects" LABELS "HDF4_MFHDF_NCDUMP" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncdump/CMakeTests.cmake;34;add_test;/root/repo/mfhdf/ncdump/CMakeTests.cmake;0;;/root/repo/mfhdf/ncdump/CMakeLists.txt;32;include;/root/repo/mfhdf/ncdump/CMakeLists.txt;0;")
+add_test(NCDUMP-test1.cdl "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/ncdump-shared" "-D" "TEST_ARGS:STRING=test0.nc" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/ncdump" "-D" "TEST_OUTPUT=test1.cdl" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(NCDUMP-test1.cdl PROPERTIES  DEPENDS "NCDUMP-test0.nc" LABELS "HDF4_MFHDF_NCDUMP" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncdump/CMakeTests.cmake;41;add_test;/root/repo/mfhdf/ncdump/CMakeTests.cmake;0;;/root/repo/mfhdf/ncdump/CMakeLists.txt;32;include;/root/repo/mfhdf/ncdump/CMakeLists.txt;0;")
+add_test(NCDUMP-test1.nc "/root/repo/_ts_build/bin/ncgen-shared" "-o" "test1.nc" "-n" "test1.cdl")
+set_tests_properties(NCDUMP-test1.nc PROPERTIES  DEPENDS "NCDUMP-test1.cdl" LABELS "HDF4_MFHDF_NCDUMP" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncdump/CMakeTests.cmake;56;add_test;/root/repo/mfhdf/ncdump/CMakeTests.cmake;0;;/root/repo/mfhdf/ncdump/CMakeLists.txt;32;include;/root/repo/mfhdf/ncdump/CMakeLists.txt;0;")
+add_test(NCDUMP-test2.cdl "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/ncdump-shared" "-D" "TEST_ARGS:STRING=-n;test0;test1.nc" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/ncdump" "-D" "TEST_OUTPUT=test2.cdl" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=test1.cdl" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(NCDUMP-test2.cdl PROPERTIES  DEPENDS "NCDUMP-test1.nc" LABELS "HDF4_MFHDF_NCDUMP" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncdump/CMakeTests.cmake;63;add_test;/root/repo/mfhdf/ncdump/CMakeTests.cmake;0;;/root/repo/mfhdf/ncdump/CMakeLists.txt;32;include;/root/repo/mfhdf/ncdump/CMakeLists.txt;0;")
+set_directory_properties(PROPERTIES LABELS "“MFHDF”")
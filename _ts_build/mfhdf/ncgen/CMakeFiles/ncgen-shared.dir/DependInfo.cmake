@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/util/h4getopt.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/__/util/h4getopt.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/__/util/h4getopt.c.o.d"
+  "/root/repo/mfhdf/ncgen/close.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/close.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/close.c.o.d"
+  "/root/repo/mfhdf/ncgen/escapes.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/escapes.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/escapes.c.o.d"
+  "/root/repo/mfhdf/ncgen/generate.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/generate.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/generate.c.o.d"
+  "/root/repo/mfhdf/ncgen/genlib.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/genlib.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/genlib.c.o.d"
+  "/root/repo/mfhdf/ncgen/getfill.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/getfill.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/getfill.c.o.d"
+  "/root/repo/mfhdf/ncgen/init.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/init.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/init.c.o.d"
+  "/root/repo/mfhdf/ncgen/load.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/load.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/load.c.o.d"
+  "/root/repo/mfhdf/ncgen/main.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/main.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/main.c.o.d"
+  "/root/repo/mfhdf/ncgen/ncgentab.c" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/ncgentab.c.o" "gcc" "mfhdf/ncgen/CMakeFiles/ncgen-shared.dir/ncgentab.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
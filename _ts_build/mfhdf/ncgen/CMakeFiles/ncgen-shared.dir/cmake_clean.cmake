@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../bin/ncgen-shared"
+  "../../bin/ncgen-shared.pdb"
+  "CMakeFiles/ncgen-shared.dir/__/util/h4getopt.c.o"
+  "CMakeFiles/ncgen-shared.dir/__/util/h4getopt.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/close.c.o"
+  "CMakeFiles/ncgen-shared.dir/close.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/escapes.c.o"
+  "CMakeFiles/ncgen-shared.dir/escapes.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/generate.c.o"
+  "CMakeFiles/ncgen-shared.dir/generate.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/genlib.c.o"
+  "CMakeFiles/ncgen-shared.dir/genlib.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/getfill.c.o"
+  "CMakeFiles/ncgen-shared.dir/getfill.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/init.c.o"
+  "CMakeFiles/ncgen-shared.dir/init.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/load.c.o"
+  "CMakeFiles/ncgen-shared.dir/load.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/main.c.o"
+  "CMakeFiles/ncgen-shared.dir/main.c.o.d"
+  "CMakeFiles/ncgen-shared.dir/ncgentab.c.o"
+  "CMakeFiles/ncgen-shared.dir/ncgentab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncgen-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../bin/ncgen"
+  "../../bin/ncgen.pdb"
+  "CMakeFiles/ncgen.dir/__/util/h4getopt.c.o"
+  "CMakeFiles/ncgen.dir/__/util/h4getopt.c.o.d"
+  "CMakeFiles/ncgen.dir/close.c.o"
+  "CMakeFiles/ncgen.dir/close.c.o.d"
+  "CMakeFiles/ncgen.dir/escapes.c.o"
+  "CMakeFiles/ncgen.dir/escapes.c.o.d"
+  "CMakeFiles/ncgen.dir/generate.c.o"
+  "CMakeFiles/ncgen.dir/generate.c.o.d"
+  "CMakeFiles/ncgen.dir/genlib.c.o"
+  "CMakeFiles/ncgen.dir/genlib.c.o.d"
+  "CMakeFiles/ncgen.dir/getfill.c.o"
+  "CMakeFiles/ncgen.dir/getfill.c.o.d"
+  "CMakeFiles/ncgen.dir/init.c.o"
+  "CMakeFiles/ncgen.dir/init.c.o.d"
+  "CMakeFiles/ncgen.dir/load.c.o"
+  "CMakeFiles/ncgen.dir/load.c.o.d"
+  "CMakeFiles/ncgen.dir/main.c.o"
+  "CMakeFiles/ncgen.dir/main.c.o.d"
+  "CMakeFiles/ncgen.dir/ncgentab.c.o"
+  "CMakeFiles/ncgen.dir/ncgentab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
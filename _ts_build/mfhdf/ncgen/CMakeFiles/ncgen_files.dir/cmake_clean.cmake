@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncgen_files"
+  "test0.cdl"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ncgen_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf/ncgen
+# Build directory: /root/repo/_ts_build/mfhdf/ncgen
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(NCGEN-clearall-objects "/usr/bin/cmake" "-E" "remove" "ctest0.nc" "ctest1.cdl" "ftest0.nc" "ftest1.cdl" "ncgentab.c" "ncgentab.h" "ncgenyy.c" "netcdf.inc" "test0.c" "test0.f" "test0.nc" "test1.cdl" "test1.nc" "test2.cdl")
+set_tests_properties(NCGEN-clearall-objects PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncgen/CMakeTests.cmake;15;add_test;/root/repo/mfhdf/ncgen/CMakeTests.cmake;0;;/root/repo/mfhdf/ncgen/CMakeLists.txt;44;include;/root/repo/mfhdf/ncgen/CMakeLists.txt;0;")
+add_test(NCGEN-test0.nc "/root/repo/_ts_build/bin/ncgen-shared" "-b" "-o" "test0.nc" "test0.cdl")
+set_tests_properties(NCGEN-test0.nc PROPERTIES  DEPENDS "NCGEN-clearall-objects" LABELS "HDF4_MFHDF_NCGEN" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncgen/CMakeTests.cmake;38;add_test;/root/repo/mfhdf/ncgen/CMakeTests.cmake;0;;/root/repo/mfhdf/ncgen/CMakeLists.txt;44;include;/root/repo/mfhdf/ncgen/CMakeLists.txt;0;")
+add_test(NCGEN-test1.cdl "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/ncdump-shared" "-D" "TEST_ARGS:STRING=-n;test1;test0.nc" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/ncgen" "-D" "TEST_OUTPUT=test1.cdl" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(NCGEN-test1.cdl PROPERTIES  DEPENDS "NCGEN-test0.nc" LABELS "HDF4_MFHDF_NCGEN" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncgen/CMakeTests.cmake;44;add_test;/root/repo/mfhdf/ncgen/CMakeTests.cmake;0;;/root/repo/mfhdf/ncgen/CMakeLists.txt;44;include;/root/repo/mfhdf/ncgen/CMakeLists.txt;0;")
+add_test(NCGEN-test1.nc "/root/repo/_ts_build/bin/ncgen-shared" "-b" "test1.cdl")
+set_tests_properties(NCGEN-test1.nc PROPERTIES  DEPENDS "NCGEN-test1.cdl" LABELS "HDF4_MFHDF_NCGEN" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncgen/CMakeTests.cmake;58;add_test;/root/repo/mfhdf/ncgen/CMakeTests.cmake;0;;/root/repo/mfhdf/ncgen/CMakeLists.txt;44;include;/root/repo/mfhdf/ncgen/CMakeLists.txt;0;")
+add_test(NCGEN-test2.cdl "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/ncdump-shared" "-D" "TEST_ARGS:STRING=test1.nc" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/ncgen" "-D" "TEST_OUTPUT=test2.cdl" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=test1.cdl" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(NCGEN-test2.cdl PROPERTIES  DEPENDS "NCGEN-test1.nc" LABELS "HDF4_MFHDF_NCGEN" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncgen/CMakeTests.cmake;64;add_test;/root/repo/mfhdf/ncgen/CMakeTests.cmake;0;;/root/repo/mfhdf/ncgen/CMakeLists.txt;44;include;/root/repo/mfhdf/ncgen/CMakeLists.txt;0;")
+add_test(NCGEN-ctest0 "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/ncgen-shared" "-D" "TEST_ARGS:STRING=-c;-o;ctest0.nc;test0.cdl" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/ncgen" "-D" "TEST_OUTPUT=test0.c" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(NCGEN-ctest0 PROPERTIES  DEPENDS "NCGEN-test2.cdl" LABELS "HDF4_MFHDF_NCGEN" _BACKTRACE_TRIPLES "/root/repo/mfhdf/ncgen/CMakeTests.cmake;84;add_test;/root/repo/mfhdf/ncgen/CMakeTests.cmake;0;;/root/repo/mfhdf/ncgen/CMakeLists.txt;44;include;/root/repo/mfhdf/ncgen/CMakeLists.txt;0;")
+set_directory_properties(PROPERTIES LABELS "“MFHDF”")
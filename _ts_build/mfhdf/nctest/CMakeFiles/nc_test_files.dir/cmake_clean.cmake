@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_files"
+  "test_unlim.cdl"
+  "test_unlim.nc"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/nc_test_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/nctest/add.c" "mfhdf/nctest/CMakeFiles/nctest.dir/add.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/add.c.o.d"
+  "/root/repo/mfhdf/nctest/atttests.c" "mfhdf/nctest/CMakeFiles/nctest.dir/atttests.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/atttests.c.o.d"
+  "/root/repo/mfhdf/nctest/cdftests.c" "mfhdf/nctest/CMakeFiles/nctest.dir/cdftests.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/cdftests.c.o.d"
+  "/root/repo/mfhdf/nctest/dimtests.c" "mfhdf/nctest/CMakeFiles/nctest.dir/dimtests.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/dimtests.c.o.d"
+  "/root/repo/mfhdf/nctest/driver.c" "mfhdf/nctest/CMakeFiles/nctest.dir/driver.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/driver.c.o.d"
+  "/root/repo/mfhdf/nctest/emalloc.c" "mfhdf/nctest/CMakeFiles/nctest.dir/emalloc.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/emalloc.c.o.d"
+  "/root/repo/mfhdf/nctest/error.c" "mfhdf/nctest/CMakeFiles/nctest.dir/error.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/error.c.o.d"
+  "/root/repo/mfhdf/nctest/misctest.c" "mfhdf/nctest/CMakeFiles/nctest.dir/misctest.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/misctest.c.o.d"
+  "/root/repo/mfhdf/nctest/rec.c" "mfhdf/nctest/CMakeFiles/nctest.dir/rec.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/rec.c.o.d"
+  "/root/repo/mfhdf/nctest/slabs.c" "mfhdf/nctest/CMakeFiles/nctest.dir/slabs.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/slabs.c.o.d"
+  "/root/repo/mfhdf/nctest/val.c" "mfhdf/nctest/CMakeFiles/nctest.dir/val.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/val.c.o.d"
+  "/root/repo/mfhdf/nctest/vardef.c" "mfhdf/nctest/CMakeFiles/nctest.dir/vardef.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/vardef.c.o.d"
+  "/root/repo/mfhdf/nctest/varget.c" "mfhdf/nctest/CMakeFiles/nctest.dir/varget.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/varget.c.o.d"
+  "/root/repo/mfhdf/nctest/varget_unlim.c" "mfhdf/nctest/CMakeFiles/nctest.dir/varget_unlim.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/varget_unlim.c.o.d"
+  "/root/repo/mfhdf/nctest/vargetg.c" "mfhdf/nctest/CMakeFiles/nctest.dir/vargetg.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/vargetg.c.o.d"
+  "/root/repo/mfhdf/nctest/varput.c" "mfhdf/nctest/CMakeFiles/nctest.dir/varput.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/varput.c.o.d"
+  "/root/repo/mfhdf/nctest/varputg.c" "mfhdf/nctest/CMakeFiles/nctest.dir/varputg.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/varputg.c.o.d"
+  "/root/repo/mfhdf/nctest/vartests.c" "mfhdf/nctest/CMakeFiles/nctest.dir/vartests.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/vartests.c.o.d"
+  "/root/repo/mfhdf/nctest/vputget.c" "mfhdf/nctest/CMakeFiles/nctest.dir/vputget.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/vputget.c.o.d"
+  "/root/repo/mfhdf/nctest/vputgetg.c" "mfhdf/nctest/CMakeFiles/nctest.dir/vputgetg.c.o" "gcc" "mfhdf/nctest/CMakeFiles/nctest.dir/vputgetg.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf/nctest
+# Build directory: /root/repo/_ts_build/mfhdf/nctest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(NC_TEST-clearall-objects "/usr/bin/cmake" "-E" "remove" "test.nc" "test2.nc")
+set_tests_properties(NC_TEST-clearall-objects PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/mfhdf/nctest/CMakeTests.cmake;19;add_test;/root/repo/mfhdf/nctest/CMakeTests.cmake;0;;/root/repo/mfhdf/nctest/CMakeLists.txt;38;include;/root/repo/mfhdf/nctest/CMakeLists.txt;0;")
+add_test(NC_TEST-nctest "/root/repo/_ts_build/bin/nctest")
+set_tests_properties(NC_TEST-nctest PROPERTIES  DEPENDS "NC_TEST-clearall-objects" LABELS "HDF4_MFHDF_NCTEST" _BACKTRACE_TRIPLES "/root/repo/mfhdf/nctest/CMakeTests.cmake;27;add_test;/root/repo/mfhdf/nctest/CMakeTests.cmake;0;;/root/repo/mfhdf/nctest/CMakeLists.txt;38;include;/root/repo/mfhdf/nctest/CMakeLists.txt;0;")
+set_directory_properties(PROPERTIES LABELS "“MFHDF”")
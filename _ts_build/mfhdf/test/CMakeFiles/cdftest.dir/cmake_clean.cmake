@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cdftest"
+  "../../bin/cdftest.pdb"
+  "CMakeFiles/cdftest.dir/cdftest.c.o"
+  "CMakeFiles/cdftest.dir/cdftest.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cdftest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
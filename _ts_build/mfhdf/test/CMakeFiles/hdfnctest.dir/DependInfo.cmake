@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/test/hdfnctest.c" "mfhdf/test/CMakeFiles/hdfnctest.dir/hdfnctest.c.o" "gcc" "mfhdf/test/CMakeFiles/hdfnctest.dir/hdfnctest.c.o.d"
+  "/root/repo/mfhdf/test/tncunlim.c" "mfhdf/test/CMakeFiles/hdfnctest.dir/tncunlim.c.o" "gcc" "mfhdf/test/CMakeFiles/hdfnctest.dir/tncunlim.c.o.d"
+  "/root/repo/mfhdf/test/tncvargetfill.c" "mfhdf/test/CMakeFiles/hdfnctest.dir/tncvargetfill.c.o" "gcc" "mfhdf/test/CMakeFiles/hdfnctest.dir/tncvargetfill.c.o.d"
+  "/root/repo/mfhdf/test/tunlim.c" "mfhdf/test/CMakeFiles/hdfnctest.dir/tunlim.c.o" "gcc" "mfhdf/test/CMakeFiles/hdfnctest.dir/tunlim.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
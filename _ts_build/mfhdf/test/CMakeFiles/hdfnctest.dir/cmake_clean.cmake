@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../bin/hdfnctest"
+  "../../bin/hdfnctest.pdb"
+  "CMakeFiles/hdfnctest.dir/hdfnctest.c.o"
+  "CMakeFiles/hdfnctest.dir/hdfnctest.c.o.d"
+  "CMakeFiles/hdfnctest.dir/tncunlim.c.o"
+  "CMakeFiles/hdfnctest.dir/tncunlim.c.o.d"
+  "CMakeFiles/hdfnctest.dir/tncvargetfill.c.o"
+  "CMakeFiles/hdfnctest.dir/tncvargetfill.c.o.d"
+  "CMakeFiles/hdfnctest.dir/tunlim.c.o"
+  "CMakeFiles/hdfnctest.dir/tunlim.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdfnctest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
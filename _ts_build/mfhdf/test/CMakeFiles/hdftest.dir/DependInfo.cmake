@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mfhdf/test/hdftest.c" "mfhdf/test/CMakeFiles/hdftest.dir/hdftest.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/hdftest.c.o.d"
+  "/root/repo/mfhdf/test/tattdatainfo.c" "mfhdf/test/CMakeFiles/hdftest.dir/tattdatainfo.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tattdatainfo.c.o.d"
+  "/root/repo/mfhdf/test/tattributes.c" "mfhdf/test/CMakeFiles/hdftest.dir/tattributes.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tattributes.c.o.d"
+  "/root/repo/mfhdf/test/tchunk.c" "mfhdf/test/CMakeFiles/hdftest.dir/tchunk.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tchunk.c.o.d"
+  "/root/repo/mfhdf/test/tcomp.c" "mfhdf/test/CMakeFiles/hdftest.dir/tcomp.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tcomp.c.o.d"
+  "/root/repo/mfhdf/test/tcoordvar.c" "mfhdf/test/CMakeFiles/hdftest.dir/tcoordvar.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tcoordvar.c.o.d"
+  "/root/repo/mfhdf/test/tdatainfo.c" "mfhdf/test/CMakeFiles/hdftest.dir/tdatainfo.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tdatainfo.c.o.d"
+  "/root/repo/mfhdf/test/tdatasizes.c" "mfhdf/test/CMakeFiles/hdftest.dir/tdatasizes.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tdatasizes.c.o.d"
+  "/root/repo/mfhdf/test/tdim.c" "mfhdf/test/CMakeFiles/hdftest.dir/tdim.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tdim.c.o.d"
+  "/root/repo/mfhdf/test/temptySDSs.c" "mfhdf/test/CMakeFiles/hdftest.dir/temptySDSs.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/temptySDSs.c.o.d"
+  "/root/repo/mfhdf/test/texternal.c" "mfhdf/test/CMakeFiles/hdftest.dir/texternal.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/texternal.c.o.d"
+  "/root/repo/mfhdf/test/tfile.c" "mfhdf/test/CMakeFiles/hdftest.dir/tfile.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tfile.c.o.d"
+  "/root/repo/mfhdf/test/tmixed_apis.c" "mfhdf/test/CMakeFiles/hdftest.dir/tmixed_apis.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tmixed_apis.c.o.d"
+  "/root/repo/mfhdf/test/tnetcdf.c" "mfhdf/test/CMakeFiles/hdftest.dir/tnetcdf.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tnetcdf.c.o.d"
+  "/root/repo/mfhdf/test/trank0.c" "mfhdf/test/CMakeFiles/hdftest.dir/trank0.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/trank0.c.o.d"
+  "/root/repo/mfhdf/test/tsd.c" "mfhdf/test/CMakeFiles/hdftest.dir/tsd.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tsd.c.o.d"
+  "/root/repo/mfhdf/test/tsdsprops.c" "mfhdf/test/CMakeFiles/hdftest.dir/tsdsprops.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tsdsprops.c.o.d"
+  "/root/repo/mfhdf/test/tszip.c" "mfhdf/test/CMakeFiles/hdftest.dir/tszip.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tszip.c.o.d"
+  "/root/repo/mfhdf/test/tutils.c" "mfhdf/test/CMakeFiles/hdftest.dir/tutils.c.o" "gcc" "mfhdf/test/CMakeFiles/hdftest.dir/tutils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/mfhdf/libsrc/CMakeFiles/mfhdf-shared.dir/DependInfo.cmake"
+  "/root/repo/_ts_build/hdf/src/CMakeFiles/hdf-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
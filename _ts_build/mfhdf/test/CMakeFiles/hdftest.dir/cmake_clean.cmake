@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../bin/hdftest"
+  "../../bin/hdftest.pdb"
+  "CMakeFiles/hdftest.dir/hdftest.c.o"
+  "CMakeFiles/hdftest.dir/hdftest.c.o.d"
+  "CMakeFiles/hdftest.dir/tattdatainfo.c.o"
+  "CMakeFiles/hdftest.dir/tattdatainfo.c.o.d"
+  "CMakeFiles/hdftest.dir/tattributes.c.o"
+  "CMakeFiles/hdftest.dir/tattributes.c.o.d"
+  "CMakeFiles/hdftest.dir/tchunk.c.o"
+  "CMakeFiles/hdftest.dir/tchunk.c.o.d"
+  "CMakeFiles/hdftest.dir/tcomp.c.o"
+  "CMakeFiles/hdftest.dir/tcomp.c.o.d"
+  "CMakeFiles/hdftest.dir/tcoordvar.c.o"
+  "CMakeFiles/hdftest.dir/tcoordvar.c.o.d"
+  "CMakeFiles/hdftest.dir/tdatainfo.c.o"
+  "CMakeFiles/hdftest.dir/tdatainfo.c.o.d"
+  "CMakeFiles/hdftest.dir/tdatasizes.c.o"
+  "CMakeFiles/hdftest.dir/tdatasizes.c.o.d"
+  "CMakeFiles/hdftest.dir/tdim.c.o"
+  "CMakeFiles/hdftest.dir/tdim.c.o.d"
+  "CMakeFiles/hdftest.dir/temptySDSs.c.o"
+  "CMakeFiles/hdftest.dir/temptySDSs.c.o.d"
+  "CMakeFiles/hdftest.dir/texternal.c.o"
+  "CMakeFiles/hdftest.dir/texternal.c.o.d"
+  "CMakeFiles/hdftest.dir/tfile.c.o"
+  "CMakeFiles/hdftest.dir/tfile.c.o.d"
+  "CMakeFiles/hdftest.dir/tmixed_apis.c.o"
+  "CMakeFiles/hdftest.dir/tmixed_apis.c.o.d"
+  "CMakeFiles/hdftest.dir/tnetcdf.c.o"
+  "CMakeFiles/hdftest.dir/tnetcdf.c.o.d"
+  "CMakeFiles/hdftest.dir/trank0.c.o"
+  "CMakeFiles/hdftest.dir/trank0.c.o.d"
+  "CMakeFiles/hdftest.dir/tsd.c.o"
+  "CMakeFiles/hdftest.dir/tsd.c.o.d"
+  "CMakeFiles/hdftest.dir/tsdsprops.c.o"
+  "CMakeFiles/hdftest.dir/tsdsprops.c.o.d"
+  "CMakeFiles/hdftest.dir/tszip.c.o"
+  "CMakeFiles/hdftest.dir/tszip.c.o.d"
+  "CMakeFiles/hdftest.dir/tutils.c.o"
+  "CMakeFiles/hdftest.dir/tutils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdftest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mfhdf_test_files"
+  "TEST/Roy-64.nc"
+  "TEST/Roy.nc"
+  "TEST/sds_szipped.dat"
+  "TEST/smallslice.0000.nc"
+  "TEST/test1.nc"
+  "TEST/testout.sav"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mfhdf_test_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/tthreads"
+  "../../bin/tthreads.pdb"
+  "CMakeFiles/tthreads.dir/tthreads.c.o"
+  "CMakeFiles/tthreads.dir/tthreads.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tthreads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
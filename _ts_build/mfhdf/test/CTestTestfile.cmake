@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/mfhdf/test
+# Build directory: /root/repo/_ts_build/mfhdf/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(MFHDF_TEST-clearall-objects "/usr/bin/cmake" "-E" "remove" "b150.hdf" "bug376.hdf" "cdfout.new" "cdfout.new.err" "chkbit.hdf" "chkcache.hdf" "chkthrd.hdf" "chktst.hdf" "comptst1.hdf" "comptst2.hdf" "comptst3.hdf" "comptst4.hdf" "comptst5.hdf" "comptst6.hdf" "comptst7.hdf" "datainfo_chk.hdf" "datainfo_chkcmp.hdf" "datainfo_cmp.hdf" "datainfo_extend.hdf" "datainfo_nodata.hdf" "datainfo_simple.hdf" "datasizes.hdf" "dim.hdf" "emptySDSs.hdf" "extfile.hdf" "exttst.hdf" "idtypes.hdf" "multidimvar.nc" "nbit.hdf" "onedimmultivars.nc" "onedimonevar.nc" "scaletst.hdf" "sds1_dim1_samename.hdf" "sds2_dim1_samename.hdf" "SDS_8_sziped.hdf" "SDS_16_sziped.hdf" "SDS_32_sziped.hdf" "sds_compressed.hdf" "SD_externals" "SDS_fl32_sziped.hdf" "SDS_fl64_sziped.hdf" "sds_szipped.hdf" "SDSchunkedsziped.hdf" "SDSchunkedsziped3d.hdf" "SDSlongname.hdf" "SDSunlimitedsziped.hdf" "test.cdf" "test1.hdf" "test2.hdf" "test_arguments.hdf" "'This" "file" "name" "has" "quite" "a" "few" "characters" "because" "it" "is" "used" "to" "test" "the" "fix" "of" "bugzilla" "1331." "It" "has" "to" "be" "at" "least" "this" "long" "to" "see.'" "Unlim_dim.hdf" "Unlim_inloop.hdf" "vars_samename.hdf" "tdfanndg.hdf" "tdfansdg.hdf" "tthreads.hdf" "tthreads0.hdf" "tthreads1.hdf" "tthreads2.hdf" "tthreads3.hdf" "tthreads4.hdf" "tthreads5.hdf" "tthreads6.hdf" "tthreads7.hdf" "tthreads8.hdf" "tthreads9.hdf" "tthreads10.hdf" "tthreads11.hdf" "tthreads12.hdf" "tthreads13.hdf" "tthreads14.hdf" "tthreads15.hdf")
+set_tests_properties(MFHDF_TEST-clearall-objects PROPERTIES  FIXTURES_SETUP "clear_MFHDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/mfhdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/mfhdf/test/CMakeTests.cmake;96;add_test;/root/repo/mfhdf/test/CMakeTests.cmake;0;;/root/repo/mfhdf/test/CMakeLists.txt;89;include;/root/repo/mfhdf/test/CMakeLists.txt;0;")
+add_test(MFHDF_TEST-hdftest "/root/repo/_ts_build/bin/hdftest")
+set_tests_properties(MFHDF_TEST-hdftest PROPERTIES  FIXTURES_REQUIRED "clear_MFHDF_TEST" LABELS "HDF4_MFHDF_TEST" PASS_REGULAR_EXPRESSION "HDF-SD test passes" WORKING_DIRECTORY "/root/repo/_ts_build/mfhdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/mfhdf/test/CMakeTests.cmake;103;add_test;/root/repo/mfhdf/test/CMakeTests.cmake;0;;/root/repo/mfhdf/test/CMakeLists.txt;89;include;/root/repo/mfhdf/test/CMakeLists.txt;0;")
+add_test(MFHDF_TEST-cdftest "/usr/bin/cmake" "-D" "TEST_EMULATOR=" "-D" "TEST_PROGRAM=/root/repo/_ts_build/bin/cdftest" "-D" "TEST_ARGS:STRING=" "-D" "TEST_FOLDER=/root/repo/_ts_build/mfhdf/test/TEST" "-D" "TEST_OUTPUT=cdfout.new" "-D" "TEST_EXPECT=0" "-D" "TEST_REFERENCE=testout.sav" "-P" "/root/repo/config/cmake/runTest.cmake")
+set_tests_properties(MFHDF_TEST-cdftest PROPERTIES  DEPENDS "MFHDF_TEST-hdftest" FIXTURES_REQUIRED "clear_MFHDF_TEST" LABELS "HDF4_MFHDF_TEST" WORKING_DIRECTORY "/root/repo/_ts_build/mfhdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/mfhdf/test/CMakeTests.cmake;112;add_test;/root/repo/mfhdf/test/CMakeTests.cmake;0;;/root/repo/mfhdf/test/CMakeLists.txt;89;include;/root/repo/mfhdf/test/CMakeLists.txt;0;")
+add_test(MFHDF_TEST-hdfnctest "/root/repo/_ts_build/bin/hdfnctest")
+set_tests_properties(MFHDF_TEST-hdfnctest PROPERTIES  DEPENDS "MFHDF_TEST-cdftest" FIXTURES_REQUIRED "clear_MFHDF_TEST" LABELS "HDF4_MFHDF_TEST" PASS_REGULAR_EXPRESSION "HDF-nc test passes" _BACKTRACE_TRIPLES "/root/repo/mfhdf/test/CMakeTests.cmake;131;add_test;/root/repo/mfhdf/test/CMakeTests.cmake;0;;/root/repo/mfhdf/test/CMakeLists.txt;89;include;/root/repo/mfhdf/test/CMakeLists.txt;0;")
+add_test(MFHDF_TEST-tthreads "/root/repo/_ts_build/bin/tthreads")
+set_tests_properties(MFHDF_TEST-tthreads PROPERTIES  DEPENDS "MFHDF_TEST-hdfnctest" FIXTURES_REQUIRED "clear_MFHDF_TEST" LABELS "HDF4_MFHDF_TEST" PASS_REGULAR_EXPRESSION "HDF threadsafe test passes" WORKING_DIRECTORY "/root/repo/_ts_build/mfhdf/test/TEST" _BACKTRACE_TRIPLES "/root/repo/mfhdf/test/CMakeTests.cmake;141;add_test;/root/repo/mfhdf/test/CMakeTests.cmake;0;;/root/repo/mfhdf/test/CMakeLists.txt;89;include;/root/repo/mfhdf/test/CMakeLists.txt;0;")
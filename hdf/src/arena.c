@@ -0,0 +1,306 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+FILE
+    arena.c - Internal storage routines for allocating objects in "arenas"
+
+REMARKS
+    An arena holds many small objects which all go away at the same time,
+    such as the DD blocks, tag nodes and tree nodes of an open file.  The
+    objects are packed in a few large chunks instead of being malloc'd one
+    at a time, and destroying the arena releases them all at once, without
+    visiting them.
+
+DESIGN
+    The arena structure sits at the start of its first chunk; the other
+    chunks are linked behind it.  Objects are carved off the end of the
+    current chunk, in multiples of AR_GRANULE bytes.  A freed object is
+    put in a free list according to its size, and reused by the next
+    object of that size; the caller gives the size back when freeing, so
+    the objects need no header.  Objects larger than AR_MAX_SMALL bytes get
+    space of their own from malloc, with a header linking them into the
+    arena so that they are released with it.
+
+BUGS/LIMITATIONS
+    Space freed in the chunks is only reused for objects of the same size,
+    and is not given back to the system before the arena is destroyed.
+
+    An arena has no lock of its own; it belongs to whoever holds the
+    structure it is kept in (e.g. the lock of the file, in the threadsafe
+    build).
+
+LOCAL ROUTINES
+  None
+EXPORTED ROUTINES
+    ARcreate_arena  - Create an arena
+    ARdestroy_arena - Destroy an arena and all its objects
+    ARalloc         - Allocate an object from an arena
+    ARcalloc        - Allocate a cleared object from an arena
+    ARfree          - Free an object allocated from an arena
+*/
+
+#include "hdfi.h"
+#include "arena.h"
+
+/* Objects are allocated in multiples of AR_GRANULE bytes, which is enough
+   to align any of the library's types; freed objects of up to AR_MAX_SMALL
+   bytes are kept in AR_NCLASSES free lists, one per size */
+#define AR_GRANULE        16
+#define AR_NCLASSES       64
+#define AR_MAX_SMALL      (AR_GRANULE * AR_NCLASSES)
+#define AR_MIN_CHUNK_SIZE (4 * AR_MAX_SMALL)
+#define AR_ROUND(s)       (((s) + (AR_GRANULE - 1)) & ~(size_t)(AR_GRANULE - 1))
+#define AR_CLASS(s)       ((s) / AR_GRANULE - 1)
+
+/* Header of the chunks after the first one, and of the large objects */
+typedef union ar_block_t {
+    struct {
+        union ar_block_t *next; /* next chunk or large object */
+        union ar_block_t *prev; /* previous large object */
+    } link;
+    char pad[AR_GRANULE]; /* keep the objects behind it aligned */
+} ar_block_t;
+
+#define AR_HDR_SIZE AR_ROUND(sizeof(ar_block_t))
+
+/* A freed object, in the free list of its size */
+typedef struct ar_free_t {
+    struct ar_free_t *next;
+} ar_free_t;
+
+typedef struct arena_tag {
+    size_t      chunk_size;             /* size of the chunks */
+    uint8      *next;                   /* first unused byte of the current chunk */
+    uint8      *end;                    /* end of the current chunk */
+    ar_block_t *chunks;                 /* chunks after the first one */
+    ar_block_t *large;                  /* objects too large for the free lists */
+    ar_free_t  *free_list[AR_NCLASSES]; /* freed objects, by size */
+} arena_t;
+
+/******************************************************************************
+ NAME
+     ARcreate_arena - Create an arena
+
+ DESCRIPTION
+    Create an arena to allocate small objects from.  The objects are carved
+    out of chunks of chunk_size bytes, the first of which also holds the
+    arena itself.  A chunk_size of 0 means AR_DEF_CHUNK_SIZE.
+
+ RETURNS
+    Returns pointer to the arena created if successful and NULL otherwise
+
+*******************************************************************************/
+arena_p
+ARcreate_arena(size_t chunk_size /* IN: size of the chunks of the arena */
+)
+{
+    arena_t *new_arena = NULL; /* ptr to the new arena */
+    arena_p  ret_value = NULL;
+
+    if (chunk_size == 0)
+        chunk_size = AR_DEF_CHUNK_SIZE;
+    else if (chunk_size < AR_MIN_CHUNK_SIZE)
+        chunk_size = AR_MIN_CHUNK_SIZE;
+    chunk_size = AR_ROUND(chunk_size);
+
+    if ((new_arena = (arena_t *)malloc(chunk_size)) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, NULL);
+    memset(new_arena, 0, sizeof(arena_t));
+
+    new_arena->chunk_size = chunk_size;
+    new_arena->next       = (uint8 *)new_arena + AR_ROUND(sizeof(arena_t));
+    new_arena->end        = (uint8 *)new_arena + chunk_size;
+
+    ret_value = (arena_p)new_arena;
+
+done:
+    return ret_value;
+} /* end ARcreate_arena() */
+
+/******************************************************************************
+ NAME
+     ARdestroy_arena - Destroy an arena
+
+ DESCRIPTION
+    Release an arena, and all the objects allocated from it at once,
+    whether they were freed or not.  Nothing which points into the arena
+    may be used afterwards.
+
+ RETURNS
+    Returns SUCCEED if successful and FAIL otherwise
+
+*******************************************************************************/
+intn
+ARdestroy_arena(arena_p arena /* IN: Arena to destroy */
+)
+{
+    arena_t    *dest_arena = (arena_t *)arena; /* ptr to the arena to destroy */
+    ar_block_t *block, *next;
+    intn        ret_value = SUCCEED;
+
+    if (dest_arena == NULL)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    for (block = dest_arena->chunks; block != NULL; block = next) {
+        next = block->link.next;
+        free(block);
+    }
+    for (block = dest_arena->large; block != NULL; block = next) {
+        next = block->link.next;
+        free(block);
+    }
+    free(dest_arena);
+
+done:
+    return ret_value;
+} /* end ARdestroy_arena() */
+
+/******************************************************************************
+ NAME
+     ARalloc - Allocate an object from an arena
+
+ DESCRIPTION
+    Allocate size bytes from an arena, reusing the space of an object of
+    the same size freed before if there is one.  The space is aligned for
+    any of the library's types.
+
+ RETURNS
+    Returns a pointer to the space if successful and NULL otherwise
+
+*******************************************************************************/
+void *
+ARalloc(arena_p arena, /* IN: Arena to allocate from */
+        size_t  size   /* IN: # of bytes to allocate */
+)
+{
+    arena_t    *ar = (arena_t *)arena;
+    ar_block_t *block;
+    size_t      left;
+    void       *ret_value = NULL;
+
+    if (ar == NULL || size == 0)
+        HGOTO_ERROR(DFE_ARGS, NULL);
+    size = AR_ROUND(size);
+
+    /* Large objects get space of their own, linked into the arena */
+    if (size > AR_MAX_SMALL) {
+        if ((block = (ar_block_t *)malloc(AR_HDR_SIZE + size)) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, NULL);
+        block->link.prev = NULL;
+        block->link.next = ar->large;
+        if (ar->large != NULL)
+            ar->large->link.prev = block;
+        ar->large = block;
+        HGOTO_DONE((uint8 *)block + AR_HDR_SIZE);
+    } /* end if */
+
+    /* Reuse a freed object of the same size */
+    if (ar->free_list[AR_CLASS(size)] != NULL) {
+        ret_value                     = ar->free_list[AR_CLASS(size)];
+        ar->free_list[AR_CLASS(size)] = ar->free_list[AR_CLASS(size)]->next;
+        HGOTO_DONE(ret_value);
+    } /* end if */
+
+    /* Start a new chunk when the current one is full, leaving the end of
+       the old one in the free lists */
+    if ((left = (size_t)(ar->end - ar->next)) < size) {
+        if (left > 0) {
+            ar_free_t *rest = (ar_free_t *)(void *)ar->next;
+
+            rest->next                    = ar->free_list[AR_CLASS(left)];
+            ar->free_list[AR_CLASS(left)] = rest;
+        } /* end if */
+
+        if ((block = (ar_block_t *)malloc(ar->chunk_size)) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, NULL);
+        block->link.next = ar->chunks;
+        ar->chunks       = block;
+        ar->next         = (uint8 *)block + AR_HDR_SIZE;
+        ar->end          = (uint8 *)block + ar->chunk_size;
+    } /* end if */
+
+    ret_value = ar->next;
+    ar->next += size;
+
+done:
+    return ret_value;
+} /* end ARalloc() */
+
+/******************************************************************************
+ NAME
+     ARcalloc - Allocate a cleared object from an arena
+
+ DESCRIPTION
+    Like ARalloc, but the space is filled with zeros.
+
+ RETURNS
+    Returns a pointer to the space if successful and NULL otherwise
+
+*******************************************************************************/
+void *
+ARcalloc(arena_p arena, /* IN: Arena to allocate from */
+         size_t  size   /* IN: # of bytes to allocate */
+)
+{
+    void *ret_value = NULL;
+
+    if ((ret_value = ARalloc(arena, size)) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, NULL);
+    memset(ret_value, 0, size);
+
+done:
+    return ret_value;
+} /* end ARcalloc() */
+
+/******************************************************************************
+ NAME
+     ARfree - Free an object allocated from an arena
+
+ DESCRIPTION
+    Give the space of an object back to its arena, for later objects of the
+    same size.  The size must be the one the object was allocated with.
+    NULL pointers are ignored.
+
+ RETURNS
+    No return value
+
+*******************************************************************************/
+void
+ARfree(arena_p arena, /* IN: Arena the object comes from */
+       void   *ptr,   /* IN: Object to free */
+       size_t  size   /* IN: # of bytes it was allocated with */
+)
+{
+    arena_t    *ar = (arena_t *)arena;
+    ar_block_t *block;
+
+    if (ar == NULL || ptr == NULL || size == 0)
+        return;
+    size = AR_ROUND(size);
+
+    if (size > AR_MAX_SMALL) { /* unlink the large object and give it back */
+        block = (ar_block_t *)(void *)((uint8 *)ptr - AR_HDR_SIZE);
+        if (block->link.prev != NULL)
+            block->link.prev->link.next = block->link.next;
+        else
+            ar->large = block->link.next;
+        if (block->link.next != NULL)
+            block->link.next->link.prev = block->link.prev;
+        free(block);
+    } /* end if */
+    else {
+        ((ar_free_t *)ptr)->next      = ar->free_list[AR_CLASS(size)];
+        ar->free_list[AR_CLASS(size)] = (ar_free_t *)ptr;
+    } /* end else */
+} /* end ARfree() */
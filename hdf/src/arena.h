@@ -0,0 +1,123 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-----------------------------------------------------------------------------
+ * File:    arena.h
+ * Purpose: header file for the arena allocator API
+ *---------------------------------------------------------------------------*/
+
+#ifndef H4_ARENA_H
+#define H4_ARENA_H
+
+#include "hdfi.h"
+
+/* Size of the chunks an arena gets from the system, unless told otherwise */
+#define AR_DEF_CHUNK_SIZE 16384
+
+/*
+    Define the pointer to the arena without giving outside routines access
+    to the internal workings of the structure.
+*/
+typedef struct arena_tag *arena_p;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ NAME
+     ARcreate_arena - Create an arena
+
+ DESCRIPTION
+    Create an arena to allocate small objects from.  The objects are carved
+    out of chunks of chunk_size bytes, the first of which also holds the
+    arena itself.  A chunk_size of 0 means AR_DEF_CHUNK_SIZE.
+
+ RETURNS
+    Returns pointer to the arena created if successful and NULL otherwise
+
+*******************************************************************************/
+HDFLIBAPI arena_p ARcreate_arena(size_t chunk_size /* IN: size of the chunks of the arena */
+);
+
+/******************************************************************************
+ NAME
+     ARdestroy_arena - Destroy an arena
+
+ DESCRIPTION
+    Release an arena, and all the objects allocated from it at once,
+    whether they were freed or not.  Nothing which points into the arena
+    may be used afterwards.
+
+ RETURNS
+    Returns SUCCEED if successful and FAIL otherwise
+
+*******************************************************************************/
+HDFLIBAPI intn ARdestroy_arena(arena_p arena /* IN: Arena to destroy */
+);
+
+/******************************************************************************
+ NAME
+     ARalloc - Allocate an object from an arena
+
+ DESCRIPTION
+    Allocate size bytes from an arena, reusing the space of an object of
+    the same size freed before if there is one.  The space is aligned for
+    any of the library's types.
+
+ RETURNS
+    Returns a pointer to the space if successful and NULL otherwise
+
+*******************************************************************************/
+HDFLIBAPI void *ARalloc(arena_p arena, /* IN: Arena to allocate from */
+                        size_t  size   /* IN: # of bytes to allocate */
+);
+
+/******************************************************************************
+ NAME
+     ARcalloc - Allocate a cleared object from an arena
+
+ DESCRIPTION
+    Like ARalloc, but the space is filled with zeros.
+
+ RETURNS
+    Returns a pointer to the space if successful and NULL otherwise
+
+*******************************************************************************/
+HDFLIBAPI void *ARcalloc(arena_p arena, /* IN: Arena to allocate from */
+                         size_t  size   /* IN: # of bytes to allocate */
+);
+
+/******************************************************************************
+ NAME
+     ARfree - Free an object allocated from an arena
+
+ DESCRIPTION
+    Give the space of an object back to its arena, for later objects of the
+    same size.  The size must be the one the object was allocated with.
+    NULL pointers are ignored.
+
+ RETURNS
+    No return value
+
+*******************************************************************************/
+HDFLIBAPI void ARfree(arena_p arena, /* IN: Arena the object comes from */
+                      void   *ptr,   /* IN: Object to free */
+                      size_t  size   /* IN: # of bytes it was allocated with */
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H4_ARENA_H */
@@ -21,17 +21,36 @@ REMARKS
 
 DESIGN
     The groups are stored in an array of pointers to store each group in an
-    element. Each "atomic group" node contains a link to a hash table to
-    manage the atoms in each group.  The allowed "atomic groups" are stored
-    in an enum (called group_t) in atom.h.
+    element. Each "atomic group" node contains a table of slots which hold
+    the atoms of the group.  The allowed "atomic groups" are stored in an
+    enum (called group_t) in atom.h.
+
+    An atom is made of the group number, the index of the slot the object is
+    kept in and the generation of that slot.  Looking up an atom is then just
+    a bounds check and a load from the slot table, whatever the number of
+    atoms in the group.  The generation of a slot is bumped each time its atom
+    is removed, so an atom which was removed no longer matches its slot when
+    the slot is reused.  Freed slots are reused oldest first, and only once
+    the table holds ATOM_REUSE_MIN slots, so that a few atoms registered and
+    removed over and over are spread over many slots.  A slot whose
+    generations have all been used is retired rather than wrapped around,
+    until the table can't grow any more.
+
+    In a threadsafe build, each group has its own mutex, so that threads
+    working with atoms of different groups don't wait for each other.  The
+    search function given to HAsearch_atom is called with the mutex held
+    and must not use the atoms of the group.
 
 BUGS/LIMITATIONS
     Can't iterate over the atoms in a group.
+    A group holds at most 2^ATOM_SLOT_BITS atoms at once.  A stale atom is
+    always caught until 2^ATOM_BITS atoms have been removed from its group,
+    as with the former atom counter.
 
 LOCAL ROUTINES
   HAIfind_atom      - Returns a pointer to an atom_info_t from a atom ID
-  HAIget_atom_node  - Gets an atom node (uses the atom free list)
-  HAIrelease_atom_node - Releases an atom node (uses the atom free list)
+  HAIget_atom_slot  - Gets a free slot in a group for a new atom
+  HAIfree_atom_slot - Puts a slot on the free list of a group
 EXPORTED ROUTINES
  Atom Functions:
   HAregister_atom   - Register an object in a group and get an atom for it
@@ -49,6 +68,15 @@ EXPORTED ROUTINES
 #include "hdfi.h"
 #include "atom.h"
 
+#ifdef H4_HAVE_THREADSAFE
+#include <pthread.h>
+#define HAI_LOCK(g)   pthread_mutex_lock(&(g)->lock)
+#define HAI_UNLOCK(g) pthread_mutex_unlock(&(g)->lock)
+#else
+#define HAI_LOCK(g)   ((void)0)
+#define HAI_UNLOCK(g) ((void)0)
+#endif
+
 /* # of bits to use for Group ID in each atom (change if MAXGROUP>16) */
 #define GROUP_BITS 4
 #define GROUP_MASK 0x0F
@@ -57,51 +85,69 @@ EXPORTED ROUTINES
 #define ATOM_BITS 28
 #define ATOM_MASK 0x0FFFFFFF
 
-/* # of previous atoms cached, change inline caching macros (HAatom_object & HAIswap_cache) if this changes */
-#define ATOM_CACHE_SIZE 4
+/* The atom index is made of the generation and the index of a slot */
+#define ATOM_SLOT_BITS 20
+#define ATOM_SLOT_MASK 0x000FFFFF
+#define ATOM_GEN_BITS  (ATOM_BITS - ATOM_SLOT_BITS)
+#define ATOM_GEN_MASK  ((1U << ATOM_GEN_BITS) - 1)
+
+/* Most slots in a group */
+#define ATOM_MAX_SLOTS (ATOM_SLOT_MASK + 1)
+
+/* # of slots in a group before freed slots are reused */
+#define ATOM_REUSE_MIN 1024
+
+/* End of the list of free slots of a group */
+#define NO_SLOT ((uintn)(-1))
+
+/* Marks a slot which has used all its generations */
+#define RETIRED_SLOT ((uintn)(-2))
 
 /* Map an atom to a Group number */
 #define ATOM_TO_GROUP(a) ((group_t)((((atom_t)(a)) >> ((sizeof(atom_t) * 8) - GROUP_BITS)) & GROUP_MASK))
 
-/* Map an atom to a hash location (assumes s is a power of 2 and smaller than the ATOM_MASK constant) */
-#define ATOM_TO_LOC(a, s) ((atom_t)(a) & ((s)-1))
+/* Map an atom to the index of its slot */
+#define ATOM_TO_SLOT(a) ((uintn)(a)&ATOM_SLOT_MASK)
 
 /* Combine a Group number and an atom index into an atom */
 #define MAKE_ATOM(g, i)                                                                                      \
     ((((atom_t)(g)&GROUP_MASK) << ((sizeof(atom_t) * 8) - GROUP_BITS)) | ((atom_t)(i)&ATOM_MASK))
 
+/* Combine the generation and the index of a slot into an atom index */
+#define MAKE_INDEX(gen, slot) ((((gen)&ATOM_GEN_MASK) << ATOM_SLOT_BITS) | ((slot)&ATOM_SLOT_MASK))
+
 /* Atom information structure used */
 typedef struct atom_info_struct_tag {
-    atom_t                       id;      /* atom ID for this info */
-    void                       **obj_ptr; /* pointer associated with the atom */
-    struct atom_info_struct_tag *next;    /* link to next atom (in case of hash-clash) */
+    atom_t id;      /* atom ID for this info, FAIL if the slot is free */
+    void  *obj_ptr; /* pointer associated with the atom */
+    uintn  gen;     /* generation of the slot */
+    uintn  next;    /* next free slot if the slot is free, RETIRED_SLOT if retired */
 } atom_info_t;
 
 /* Atom group structure used */
 typedef struct atom_group_struct_tag {
-    uintn         count;     /* # of times this group has been initialized */
-    intn          hash_size; /* size of the hash table to store the atoms in */
-    uintn         atoms;     /* current number of atoms held */
-    uintn         nextid;    /* atom ID to use for the next atom */
-    atom_info_t **atom_list; /* pointer to an array of ptrs to atoms */
+    uintn        count;     /* # of times this group has been initialized */
+    uintn        atoms;     /* current number of atoms held */
+    uintn        nslots;    /* # of slots ever used */
+    uintn        size;      /* # of slots allocated */
+    uintn        free_head; /* oldest free slot, NO_SLOT if none */
+    uintn        free_tail; /* newest free slot, NO_SLOT if none */
+    uintn        retired;   /* # of retired slots */
+    atom_info_t *slots;     /* the table of slots */
+#ifdef H4_HAVE_THREADSAFE
+    pthread_mutex_t lock; /* protects the group in a threadsafe build */
+#endif
 } atom_group_t;
 
 /* Array of pointers to atomic groups */
 static atom_group_t *atom_group_list[MAXGROUP] = {NULL};
 
-/* Pointer to the atom node free list */
-static atom_info_t *atom_free_list = NULL;
-
-/* Array of pointers to atomic groups */
-atom_t atom_id_cache[ATOM_CACHE_SIZE]  = {-1, -1, -1, -1};
-void  *atom_obj_cache[ATOM_CACHE_SIZE] = {NULL};
-
 /* Private function prototypes */
 static atom_info_t *HAIfind_atom(atom_t atm);
 
-static atom_info_t *HAIget_atom_node(void);
+static atom_info_t *HAIget_atom_slot(atom_group_t *grp_ptr);
 
-static void HAIrelease_atom_node(atom_info_t *atm);
+static void HAIfree_atom_slot(atom_group_t *grp_ptr, uintn slot);
 
 /******************************************************************************
  NAME
@@ -110,8 +156,9 @@ static void HAIrelease_atom_node(atom_info_t *atm);
  DESCRIPTION
     Creates a global atomic group to store atoms in.  If the group has already
     been initialized, this routine just increments the count of # of
-    initializations and returns without trying to change the size of the hash
-    table.
+    initializations and returns without trying to change the size of the slot
+    table.  The table starts with room for hash_size atoms and grows as
+    needed.
 
     NOTE: The hash size MUST be a power of 2 (checked in code)
 
@@ -121,7 +168,7 @@ static void HAIrelease_atom_node(atom_info_t *atm);
 *******************************************************************************/
 intn
 HAinit_group(group_t grp,      /* IN: Group to initialize */
-             intn    hash_size /* IN: Minimum hash table size to use for group */
+             intn    hash_size /* IN: Initial slot table size to use for group */
 )
 {
     atom_group_t *grp_ptr   = NULL; /* ptr to the atomic group */
@@ -131,9 +178,6 @@ HAinit_group(group_t grp,      /* IN: Group to initialize */
     if ((grp <= BADGROUP || grp >= MAXGROUP) && hash_size > 0)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
-    /* Assertion necessary for faster pointer swapping */
-    assert(sizeof(hdf_pint_t) == sizeof(void *));
-
     /* Ensure hash_size is not zero and a power of two */
     if (hash_size == 0)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -144,16 +188,21 @@ HAinit_group(group_t grp,      /* IN: Group to initialize */
         grp_ptr = (atom_group_t *)calloc(1, sizeof(atom_group_t));
         if (grp_ptr == NULL)
             HGOTO_ERROR(DFE_NOSPACE, FAIL);
+#ifdef H4_HAVE_THREADSAFE
+        pthread_mutex_init(&grp_ptr->lock, NULL);
+#endif
         atom_group_list[grp] = grp_ptr;
     }    /* end if */
     else /* Get the pointer to the existing group */
         grp_ptr = atom_group_list[grp];
 
     if (grp_ptr->count == 0) { /* Initialize the atom group structure */
-        grp_ptr->hash_size = hash_size;
         grp_ptr->atoms     = 0;
-        grp_ptr->nextid    = 0;
-        if ((grp_ptr->atom_list = (atom_info_t **)calloc(hash_size, sizeof(atom_info_t *))) == NULL)
+        grp_ptr->nslots    = 0;
+        grp_ptr->size      = MIN((uintn)hash_size, ATOM_MAX_SLOTS);
+        grp_ptr->free_head = grp_ptr->free_tail = NO_SLOT;
+        grp_ptr->retired   = 0;
+        if ((grp_ptr->slots = (atom_info_t *)malloc(grp_ptr->size * sizeof(atom_info_t))) == NULL)
             HGOTO_ERROR(DFE_NOSPACE, FAIL);
     } /* end if */
 
@@ -163,7 +212,7 @@ HAinit_group(group_t grp,      /* IN: Group to initialize */
 done:
     if (ret_value == FAIL) { /* Error condition cleanup */
         if (grp_ptr != NULL) {
-            free(grp_ptr->atom_list);
+            free(grp_ptr->slots);
             free(grp_ptr);
         }
     }
@@ -202,15 +251,8 @@ HAdestroy_group(group_t grp /* IN: Group to destroy */
 
     /* Decrement the number of users of the atomic group */
     if ((--(grp_ptr->count)) == 0) {
-        uintn i;
-
-        for (i = 0; i < ATOM_CACHE_SIZE; i++)
-            if (ATOM_TO_GROUP(atom_id_cache[i]) == grp) {
-                atom_id_cache[i]  = (-1);
-                atom_obj_cache[i] = NULL;
-            } /* end if */
-        free(grp_ptr->atom_list);
-        grp_ptr->atom_list = NULL;
+        free(grp_ptr->slots);
+        grp_ptr->slots = NULL;
     } /* end if */
 
 done:
@@ -241,7 +283,6 @@ HAregister_atom(group_t grp,   /* IN: Group to register the object in */
     atom_group_t *grp_ptr = NULL; /* ptr to the atomic group */
     atom_info_t  *atm_ptr = NULL; /* ptr to the new atom */
     atom_t        atm_id;         /* new atom ID */
-    uintn         hash_loc;       /* new item's hash table location */
     atom_t        ret_value = SUCCEED;
 
     HEclear();
@@ -252,24 +293,18 @@ HAregister_atom(group_t grp,   /* IN: Group to register the object in */
     if (grp_ptr == NULL || grp_ptr->count <= 0)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
-    if ((atm_ptr = HAIget_atom_node()) == NULL)
+    HAI_LOCK(grp_ptr);
+    if ((atm_ptr = HAIget_atom_slot(grp_ptr)) == NULL) {
+        HAI_UNLOCK(grp_ptr);
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    }
 
     /* Create the atom & it's ID */
-    atm_id           = MAKE_ATOM(grp, grp_ptr->nextid);
+    atm_id           = MAKE_ATOM(grp, MAKE_INDEX(atm_ptr->gen, (uintn)(atm_ptr - grp_ptr->slots)));
     atm_ptr->id      = atm_id;
     atm_ptr->obj_ptr = object;
-    atm_ptr->next    = NULL;
-
-    /* hash bucket already full, prepend to front of chain */
-    hash_loc = grp_ptr->nextid % (uintn)grp_ptr->hash_size;
-    if (grp_ptr->atom_list[hash_loc] != NULL)
-        atm_ptr->next = grp_ptr->atom_list[hash_loc];
-
-    /* Insert into the group */
-    grp_ptr->atom_list[hash_loc] = atm_ptr;
     grp_ptr->atoms++;
-    grp_ptr->nextid++;
+    HAI_UNLOCK(grp_ptr);
 
     ret_value = atm_id;
 
@@ -295,15 +330,12 @@ HAPatom_object(atom_t atm /* IN: Atom to retrieve object for */
     atom_info_t *atm_ptr   = NULL; /* ptr to the new atom */
     void        *ret_value = NULL;
 
-    HEclear();
-
     /* General lookup of the atom */
     if ((atm_ptr = HAIfind_atom(atm)) == NULL)
         HGOTO_ERROR(DFE_INTERNAL, NULL);
 
-    /* Check if we've found the correct atom */
-    if (atm_ptr != NULL)
-        ret_value = atm_ptr->obj_ptr;
+    ret_value = atm_ptr->obj_ptr;
+    HAI_UNLOCK(atom_group_list[ATOM_TO_GROUP(atm)]);
 
 done:
     return ret_value;
@@ -351,57 +383,32 @@ HAremove_atom(atom_t atm /* IN: Atom to remove */
 )
 {
     atom_group_t *grp_ptr = NULL; /* ptr to the atomic group */
-    atom_info_t  *curr_atm,       /* ptr to the current atom */
-        *last_atm;                /* ptr to the last atom */
-    group_t grp;                  /* atom's atomic group */
-    uintn   hash_loc;             /* atom's hash table location */
-    uintn   i;                    /* local counting variable */
-    void   *ret_value = NULL;
+    atom_info_t  *atm_ptr = NULL; /* ptr to the atom */
+    uintn         slot;           /* atom's slot in the group */
+    void         *ret_value = NULL;
 
     HEclear();
-    grp = ATOM_TO_GROUP(atm);
-    if (grp <= BADGROUP || grp >= MAXGROUP)
-        HGOTO_ERROR(DFE_ARGS, NULL);
-
-    grp_ptr = atom_group_list[grp];
-    if (grp_ptr == NULL || grp_ptr->count <= 0)
-        HGOTO_ERROR(DFE_INTERNAL, NULL);
-
-    /* Get the location in which the atom is located */
-    hash_loc = (uintn)ATOM_TO_LOC(atm, grp_ptr->hash_size);
-    curr_atm = grp_ptr->atom_list[hash_loc];
-    if (curr_atm == NULL)
-        HGOTO_ERROR(DFE_INTERNAL, NULL);
-
-    last_atm = NULL;
-    while (curr_atm != NULL) {
-        if (curr_atm->id == atm)
-            break;
-        last_atm = curr_atm;
-        curr_atm = curr_atm->next;
-    } /* end while */
-
-    if (curr_atm != NULL) {
-        if (last_atm == NULL) /* atom is the first the chain */
-            grp_ptr->atom_list[hash_loc] = curr_atm->next;
-        else
-            last_atm->next = curr_atm->next;
-        ret_value = curr_atm->obj_ptr;
-        HAIrelease_atom_node(curr_atm);
-    }    /* end if */
-    else /* couldn't find the atom in the proper place */
+    if ((atm_ptr = HAIfind_atom(atm)) == NULL)
         HGOTO_ERROR(DFE_INTERNAL, NULL);
-
-    /* Delete object from cache */
-    for (i = 0; i < ATOM_CACHE_SIZE; i++)
-        if (atom_id_cache[i] == atm) {
-            atom_id_cache[i]  = (-1);
-            atom_obj_cache[i] = NULL;
-            break; /* we assume there is only one instance in the cache */
-        }
+    grp_ptr = atom_group_list[ATOM_TO_GROUP(atm)];
+    slot    = ATOM_TO_SLOT(atm);
+
+    ret_value = atm_ptr->obj_ptr;
+
+    /* Free the slot, with a new generation, unless it has used them all */
+    atm_ptr->id      = FAIL;
+    atm_ptr->obj_ptr = NULL;
+    atm_ptr->gen     = (atm_ptr->gen + 1) & ATOM_GEN_MASK;
+    if (atm_ptr->gen == 0 && grp_ptr->nslots < ATOM_MAX_SLOTS) {
+        atm_ptr->next = RETIRED_SLOT;
+        grp_ptr->retired++;
+    }
+    else
+        HAIfree_atom_slot(grp_ptr, slot);
 
     /* Decrement the number of atoms in the group */
     (grp_ptr->atoms)--;
+    HAI_UNLOCK(grp_ptr);
 
 done:
     return ret_value;
@@ -429,7 +436,7 @@ HAsearch_atom(group_t         grp,  /* IN: Group to search for the object in */
 {
     atom_group_t *grp_ptr = NULL; /* ptr to the atomic group */
     atom_info_t  *atm_ptr = NULL; /* ptr to the new atom */
-    intn          i;              /* local counting variable */
+    uintn         i;              /* local counting variable */
     void         *ret_value = NULL;
 
     HEclear();
@@ -441,14 +448,13 @@ HAsearch_atom(group_t         grp,  /* IN: Group to search for the object in */
         HGOTO_ERROR(DFE_INTERNAL, NULL);
 
     /* Start at the beginning of the array */
-    for (i = 0; i < grp_ptr->hash_size; i++) {
-        atm_ptr = grp_ptr->atom_list[i];
-        while (atm_ptr != NULL) {
-            if ((*func)(atm_ptr->obj_ptr, key))
-                HGOTO_DONE(atm_ptr->obj_ptr); /* found the item we are looking for */
-            atm_ptr = atm_ptr->next;
-        } /* end while */
-    }     /* end for */
+    HAI_LOCK(grp_ptr);
+    for (i = 0, atm_ptr = grp_ptr->slots; i < grp_ptr->nslots; i++, atm_ptr++)
+        if (atm_ptr->id != FAIL && (*func)(atm_ptr->obj_ptr, key)) {
+            ret_value = atm_ptr->obj_ptr; /* found the item we are looking for */
+            break;
+        }
+    HAI_UNLOCK(grp_ptr);
 
 done:
     return ret_value;
@@ -459,7 +465,9 @@ done:
      HAIfind_atom - Finds a atom in a group
 
  DESCRIPTION
-    Retrieves the atom ptr which is associated with the atom.
+    Retrieves the atom ptr which is associated with the atom.  When the atom
+    is found, its group is left locked for the caller to unlock once done
+    with the atom ptr.
 
  RETURNS
     Returns atom ptr if successful and NULL otherwise
@@ -470,12 +478,11 @@ HAIfind_atom(atom_t atm /* IN: Atom to retrieve atom for */
 )
 {
     atom_group_t *grp_ptr = NULL; /* ptr to the atomic group */
-    atom_info_t  *atm_ptr = NULL; /* ptr to the new atom */
+    atom_info_t  *atm_ptr = NULL; /* ptr to the atom */
     group_t       grp;            /* atom's atomic group */
-    uintn         hash_loc;       /* atom's hash table location */
+    uintn         slot;           /* atom's slot in the group */
     atom_info_t  *ret_value = NULL;
 
-    HEclear();
     grp = ATOM_TO_GROUP(atm);
     if (grp <= BADGROUP || grp >= MAXGROUP)
         HGOTO_ERROR(DFE_ARGS, NULL);
@@ -484,23 +491,14 @@ HAIfind_atom(atom_t atm /* IN: Atom to retrieve atom for */
     if (grp_ptr == NULL || grp_ptr->count <= 0)
         HGOTO_ERROR(DFE_INTERNAL, NULL);
 
-    /* Get the location in which the atom is located */
-    hash_loc = (uintn)ATOM_TO_LOC(atm, grp_ptr->hash_size);
-    atm_ptr  = grp_ptr->atom_list[hash_loc];
-    if (atm_ptr == NULL)
-        HGOTO_ERROR(DFE_INTERNAL, NULL);
-
-    while (atm_ptr != NULL) {
-        if (atm_ptr->id == atm)
-            break;
-        atm_ptr = atm_ptr->next;
-    } /* end while */
-
-    if (atm_ptr) {
-        /* if found, add it to the end of the cached list */
-        atom_id_cache[ATOM_CACHE_SIZE - 1]  = atm;
-        atom_obj_cache[ATOM_CACHE_SIZE - 1] = atm_ptr->obj_ptr;
+    /* The slot must be in use by this very atom, not an older one */
+    slot = ATOM_TO_SLOT(atm);
+    HAI_LOCK(grp_ptr);
+    if (slot >= grp_ptr->nslots || grp_ptr->slots[slot].id != atm) {
+        HAI_UNLOCK(grp_ptr);
+        HGOTO_ERROR(DFE_ARGS, NULL);
     }
+    atm_ptr = &grp_ptr->slots[slot];
 
     ret_value = atm_ptr;
 
@@ -510,53 +508,82 @@ done:
 
 /******************************************************************************
  NAME
-     HAIget_atom_node - Gets an atom node
+     HAIget_atom_slot - Gets a free slot in a group
 
  DESCRIPTION
-    Either gets an atom node from the free list (if there is one available)
-    or allocate a node.
+    Takes the oldest slot on the free list of the group once the table holds
+    ATOM_REUSE_MIN slots, or else a new slot at the end of the table, which
+    is grown if it is full.  When the table can't grow any more, the retired
+    slots go back on the free list.
 
  RETURNS
-    Returns atom ptr if successful and NULL otherwise
+    Returns slot ptr if successful and NULL otherwise
 
 *******************************************************************************/
 static atom_info_t *
-HAIget_atom_node(void)
+HAIget_atom_slot(atom_group_t *grp_ptr)
 {
     atom_info_t *ret_value = NULL;
 
-    HEclear();
-    if (atom_free_list != NULL) {
-        ret_value      = atom_free_list;
-        atom_free_list = atom_free_list->next;
+    /* Out of room for new slots: put the retired slots back in use */
+    if (grp_ptr->nslots >= ATOM_MAX_SLOTS && grp_ptr->free_head == NO_SLOT && grp_ptr->retired > 0) {
+        uintn i;
+
+        for (i = 0; i < grp_ptr->nslots; i++)
+            if (grp_ptr->slots[i].next == RETIRED_SLOT)
+                HAIfree_atom_slot(grp_ptr, i);
+        grp_ptr->retired = 0;
+    } /* end if */
+
+    if (grp_ptr->free_head != NO_SLOT && grp_ptr->nslots >= ATOM_REUSE_MIN) {
+        ret_value          = &grp_ptr->slots[grp_ptr->free_head];
+        grp_ptr->free_head = ret_value->next;
+        if (grp_ptr->free_head == NO_SLOT)
+            grp_ptr->free_tail = NO_SLOT;
     } /* end if */
     else {
-        if ((ret_value = (atom_info_t *)malloc(sizeof(atom_info_t))) == NULL)
-            HGOTO_ERROR(DFE_NOSPACE, NULL);
+        if (grp_ptr->nslots == grp_ptr->size) {
+            atom_info_t *new_slots;
+            uintn        new_size;
+
+            if (grp_ptr->size >= ATOM_MAX_SLOTS)
+                HGOTO_ERROR(DFE_NOSPACE, NULL);
+            new_size = MIN(2 * grp_ptr->size, ATOM_MAX_SLOTS);
+            if ((new_slots = (atom_info_t *)realloc(grp_ptr->slots, new_size * sizeof(atom_info_t))) == NULL)
+                HGOTO_ERROR(DFE_NOSPACE, NULL);
+            grp_ptr->slots = new_slots;
+            grp_ptr->size  = new_size;
+        } /* end if */
+        ret_value      = &grp_ptr->slots[grp_ptr->nslots++];
+        ret_value->gen = 0;
     } /* end else */
+    ret_value->next = NO_SLOT;
 
 done:
     return ret_value;
-} /* end HAIget_atom_node() */
+} /* end HAIget_atom_slot() */
 
 /******************************************************************************
  NAME
-     HAIrelease_atom_node - Releases an atom node
+     HAIfree_atom_slot - Puts a slot on the free list of a group
 
  DESCRIPTION
-    Puts an atom node into the free list
+    Appends the slot to the free list, so the slots are reused oldest first.
 
  RETURNS
-    No return value
+    none
 
 *******************************************************************************/
 static void
-HAIrelease_atom_node(atom_info_t *atm)
+HAIfree_atom_slot(atom_group_t *grp_ptr, uintn slot)
 {
-    /* Insert the atom at the beginning of the free list */
-    atm->next      = atom_free_list;
-    atom_free_list = atm;
-} /* end HAIrelease_atom_node() */
+    grp_ptr->slots[slot].next = NO_SLOT;
+    if (grp_ptr->free_tail == NO_SLOT)
+        grp_ptr->free_head = slot;
+    else
+        grp_ptr->slots[grp_ptr->free_tail].next = slot;
+    grp_ptr->free_tail = slot;
+} /* end HAIfree_atom_slot() */
 
 /*--------------------------------------------------------------------------
  NAME
@@ -578,21 +605,14 @@ HAIrelease_atom_node(atom_info_t *atm)
 intn
 HAshutdown(void)
 {
-    atom_info_t *curr;
-    intn         i;
-
-    /* Release the free-list if it exists */
-    if (atom_free_list != NULL) {
-        while (atom_free_list != NULL) {
-            curr           = atom_free_list;
-            atom_free_list = atom_free_list->next;
-            free(curr);
-        } /* end while */
-    }     /* end if */
+    intn i;
 
     for (i = 0; i < (intn)MAXGROUP; i++)
         if (atom_group_list[i] != NULL) {
-            free(atom_group_list[i]->atom_list);
+#ifdef H4_HAVE_THREADSAFE
+            pthread_mutex_destroy(&atom_group_list[i]->lock);
+#endif
+            free(atom_group_list[i]->slots);
             free(atom_group_list[i]);
             atom_group_list[i] = NULL;
         } /* end if */
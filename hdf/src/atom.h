@@ -26,22 +26,8 @@
 
 #include "hdfi.h"
 
-/* Do swap using XOR operator. Ugly but fast... -QAK */
-#define HAIswap_cache(i, j)                                                                                  \
-    atom_id_cache[i] ^= atom_id_cache[j],                                                                    \
-        atom_obj_cache[i] = (void *)((hdf_pint_t)atom_obj_cache[j] ^ (hdf_pint_t)atom_obj_cache[i]),         \
-        atom_id_cache[j] ^= atom_id_cache[i],                                                                \
-        atom_obj_cache[j] = (void *)((hdf_pint_t)atom_obj_cache[i] ^ (hdf_pint_t)atom_obj_cache[j]),         \
-        atom_id_cache[i] ^= atom_id_cache[j],                                                                \
-        atom_obj_cache[i] = (void *)((hdf_pint_t)atom_obj_cache[i] ^ (hdf_pint_t)atom_obj_cache[j])
-
-/* Note! This is hardwired to the atom cache value being 4 */
-#define HAatom_object(atm)                                                                                   \
-    (atom_id_cache[0] == atm   ? atom_obj_cache[0]                                                           \
-     : atom_id_cache[1] == atm ? (HAIswap_cache(0, 1), atom_obj_cache[0])                                    \
-     : atom_id_cache[2] == atm ? (HAIswap_cache(1, 2), atom_obj_cache[1])                                    \
-     : atom_id_cache[3] == atm ? (HAIswap_cache(2, 3), atom_obj_cache[2])                                    \
-                               : HAPatom_object(atm))
+/* Atoms are looked up directly in the slot table of their group */
+#define HAatom_object(atm) HAPatom_object(atm)
 
 #include "hdf.h"
 
@@ -70,10 +56,6 @@ typedef intn (*HAsearch_func_t)(const void *obj, const void *key);
 extern "C" {
 #endif
 
-/* Global variables exposed by HAatom_object */
-HDFLIBAPI atom_t atom_id_cache[];
-HDFLIBAPI void  *atom_obj_cache[];
-
 /******************************************************************************
  NAME
      HAinit_group - Initialize an atomic group
@@ -81,7 +63,7 @@ HDFLIBAPI void  *atom_obj_cache[];
  DESCRIPTION
     Creates an atomic group to store atoms in.  If the group has already been
     initialized, this routine just increments the count of # of initializations
-    and returns without trying to change the size of the hash table.
+    and returns without trying to change the size of the slot table.
 
     NOTE: The hash size MUST be a power of 2 (checked in code)
 
@@ -90,7 +72,7 @@ HDFLIBAPI void  *atom_obj_cache[];
 
 *******************************************************************************/
 HDFLIBAPI intn HAinit_group(group_t grp,      /* IN: Group to initialize */
-                            intn    hash_size /* IN: Minimum hash table size to use for group */
+                            intn    hash_size /* IN: Initial slot table size to use for group */
 );
 
 /******************************************************************************
@@ -22,28 +22,41 @@ REMARKS
     These function manipulate ordered sets of "bits".
 
 DESIGN
-    Each bit-vector is stored in memory as an array of unsigned 8-bit
-    integers (uint8's in HDF types), which can grow as additional bits are
+    Each bit-vector is stored in memory as an array of unsigned 32-bit
+    integers (uint32's in HDF types), which can grow as additional bits are
     flagged in the bit-vector.
 
     Each bit-vector is stored with the lowest bits in location 0 in the
-    array of base type (uint8s currently) and the bits in "standard" C order
-    (i.e. bit 0 is the lowest bit in the byte) in each byte.  This does make
+    array of base type (uint32s currently) and the bits in "standard" C order
+    (i.e. bit 0 is the lowest bit in the word) in each word.  This does make
     for a slightly strange "bit-swapped" storage, but is the most efficient.
 
     The data structure is optimized for finding the next zero bit an array
-    and caches this location when appropriate. It is NOT similarly optimized
-    for finding 1 bits as that is not a use case in the HDF4 library.
+    and caches the first word which may hold one.  Full words are skipped a
+    whole word at a time and the zero bit in the first word which is not
+    full is found with a count-trailing-zeros instruction, where the compiler
+    has one, so handing out many thousands of refs stays linear.  It is NOT
+    similarly optimized for finding 1 bits as that is not a use case in the
+    HDF4 library.
+
+    Bits beyond the bits in use are always zero.
  */
 
 #include "hdfi.h"
 #include "bitvect.h"
 
+#ifdef _MSC_VER
+#include <intrin.h> /* _BitScanForward */
+#endif
+
 /* Base type of the array used to store the bits */
-typedef uint8 bv_base;
+typedef uint32 bv_base;
 
 /* # of bits in the base type of the array used to store the bits */
-#define BV_BASE_BITS 8
+#define BV_BASE_BITS 32
+
+/* Value of a base element with all its bits set */
+#define BV_BASE_FULL ((bv_base)0xFFFFFFFF)
 
 /* bit-vector structure used
  *
@@ -54,169 +67,33 @@ typedef uint8 bv_base;
 typedef struct bv_struct_tag {
     int32    bits_used;  /* The actual number of bits current in use */
     int32    array_size; /* The number of bv_base elements in the bit-vector */
-    int32    last_zero;  /* The last location we know had a zero bit */
+    int32    last_zero;  /* The first element which may have a zero bit */
     bv_base *buffer;     /* Pointer to the buffer used to store the bits */
 } bv_struct;
 
-/* Table of bits for each bit position */
-/*  (This will need to be changed/expanded if another base type is used) */
-static const uint8 bv_bit_value[8] = {
-    1,  /* bit 0's value is 1 */
-    2,  /* bit 1's value is 2 */
-    4,  /* bit 2's value is 4 */
-    8,  /* bit 3's value is 8 */
-    16, /* bit 4's value is 16 */
-    32, /* bit 5's value is 32 */
-    64, /* bit 6's value is 64 */
-    128 /* bit 7's value is 128 */
-};
-
-/* Table of bit-masks for each number of bits in a byte */
-/*  (This will need to be changed/expanded if another base type is used) */
-static const uint8 bv_bit_mask[9] = {
-    0x00, /* 0 bits is a mask of 0x00 */
-    0x01, /* 1 bits is a mask of 0x01 */
-    0x03, /* 2 bits is a mask of 0x03 */
-    0x07, /* 3 bits is a mask of 0x07 */
-    0x0F, /* 4 bits is a mask of 0x0F */
-    0x1F, /* 5 bits is a mask of 0x1F */
-    0x3F, /* 6 bits is a mask of 0x3F */
-    0x7F, /* 7 bits is a mask of 0x7F */
-    0xFF  /* 8 bits is a mask of 0xFF */
-};
-
-/* Table of "first zero bit" for each byte value */
-/*  (This will need to be changed/expanded if another base type is used) */
-static const int8 bv_first_zero[256] = {
-    0, /* "0" - bit 0 is lowest zero */ 1,   /* "1" - bit 1 is lowest zero */
-    0, /* "2" - bit 0 is lowest zero */ 2,   /* "3" - bit 2 is lowest zero */
-    0, /* "4" - bit 0 is lowest zero */ 1,   /* "5" - bit 1 is lowest zero */
-    0, /* "6" - bit 0 is lowest zero */ 3,   /* "7" - bit 3 is lowest zero */
-    0, /* "8" - bit 0 is lowest zero */ 1,   /* "9" - bit 1 is lowest zero */
-    0, /* "10" - bit 0 is lowest zero */ 2,  /* "11" - bit 2 is lowest zero */
-    0, /* "12" - bit 0 is lowest zero */ 1,  /* "13" - bit 1 is lowest zero */
-    0, /* "14" - bit 0 is lowest zero */ 4,  /* "15" - bit 4 is lowest zero */
-    0, /* "16" - bit 0 is lowest zero */ 1,  /* "17" - bit 1 is lowest zero */
-    0, /* "18" - bit 0 is lowest zero */ 2,  /* "19" - bit 2 is lowest zero */
-    0, /* "20" - bit 0 is lowest zero */ 1,  /* "21" - bit 1 is lowest zero */
-    0, /* "22" - bit 0 is lowest zero */ 3,  /* "23" - bit 3 is lowest zero */
-    0, /* "24" - bit 0 is lowest zero */ 1,  /* "25" - bit 1 is lowest zero */
-    0, /* "26" - bit 0 is lowest zero */ 2,  /* "27" - bit 2 is lowest zero */
-    0, /* "28" - bit 0 is lowest zero */ 1,  /* "29" - bit 1 is lowest zero */
-    0, /* "30" - bit 0 is lowest zero */ 5,  /* "31" - bit 5 is lowest zero */
-    0, /* "32" - bit 0 is lowest zero */ 1,  /* "33" - bit 1 is lowest zero */
-    0, /* "34" - bit 0 is lowest zero */ 2,  /* "35" - bit 2 is lowest zero */
-    0, /* "36" - bit 0 is lowest zero */ 1,  /* "37" - bit 1 is lowest zero */
-    0, /* "38" - bit 0 is lowest zero */ 3,  /* "39" - bit 3 is lowest zero */
-    0, /* "40" - bit 0 is lowest zero */ 1,  /* "41" - bit 1 is lowest zero */
-    0, /* "42" - bit 0 is lowest zero */ 2,  /* "43" - bit 2 is lowest zero */
-    0, /* "44" - bit 0 is lowest zero */ 1,  /* "45" - bit 1 is lowest zero */
-    0, /* "46" - bit 0 is lowest zero */ 4,  /* "47" - bit 4 is lowest zero */
-    0, /* "48" - bit 0 is lowest zero */ 1,  /* "49" - bit 1 is lowest zero */
-    0, /* "50" - bit 0 is lowest zero */ 2,  /* "51" - bit 2 is lowest zero */
-    0, /* "52" - bit 0 is lowest zero */ 1,  /* "53" - bit 1 is lowest zero */
-    0, /* "54" - bit 0 is lowest zero */ 3,  /* "55" - bit 3 is lowest zero */
-    0, /* "56" - bit 0 is lowest zero */ 1,  /* "57" - bit 1 is lowest zero */
-    0, /* "58" - bit 0 is lowest zero */ 2,  /* "59" - bit 2 is lowest zero */
-    0, /* "60" - bit 0 is lowest zero */ 1,  /* "61" - bit 1 is lowest zero */
-    0, /* "62" - bit 0 is lowest zero */ 6,  /* "63" - bit 6 is lowest zero */
-    0, /* "64" - bit 0 is lowest zero */ 1,  /* "65" - bit 1 is lowest zero */
-    0, /* "66" - bit 0 is lowest zero */ 2,  /* "67" - bit 2 is lowest zero */
-    0, /* "68" - bit 0 is lowest zero */ 1,  /* "69" - bit 1 is lowest zero */
-    0, /* "70" - bit 0 is lowest zero */ 3,  /* "71" - bit 3 is lowest zero */
-    0, /* "72" - bit 0 is lowest zero */ 1,  /* "73" - bit 1 is lowest zero */
-    0, /* "74" - bit 0 is lowest zero */ 2,  /* "75" - bit 2 is lowest zero */
-    0, /* "76" - bit 0 is lowest zero */ 1,  /* "77" - bit 1 is lowest zero */
-    0, /* "78" - bit 0 is lowest zero */ 4,  /* "79" - bit 4 is lowest zero */
-    0, /* "80" - bit 0 is lowest zero */ 1,  /* "81" - bit 1 is lowest zero */
-    0, /* "82" - bit 0 is lowest zero */ 2,  /* "83" - bit 2 is lowest zero */
-    0, /* "84" - bit 0 is lowest zero */ 1,  /* "85" - bit 1 is lowest zero */
-    0, /* "86" - bit 0 is lowest zero */ 3,  /* "87" - bit 3 is lowest zero */
-    0, /* "88" - bit 0 is lowest zero */ 1,  /* "89" - bit 1 is lowest zero */
-    0, /* "90" - bit 0 is lowest zero */ 2,  /* "91" - bit 2 is lowest zero */
-    0, /* "92" - bit 0 is lowest zero */ 1,  /* "93" - bit 1 is lowest zero */
-    0, /* "94" - bit 0 is lowest zero */ 5,  /* "95" - bit 5 is lowest zero */
-    0, /* "96" - bit 0 is lowest zero */ 1,  /* "97" - bit 1 is lowest zero */
-    0, /* "98" - bit 0 is lowest zero */ 2,  /* "99" - bit 2 is lowest zero */
-    0, /* "100" - bit 0 is lowest zero */ 1, /* "101" - bit 1 is lowest zero */
-    0, /* "102" - bit 0 is lowest zero */ 3, /* "103" - bit 3 is lowest zero */
-    0, /* "104" - bit 0 is lowest zero */ 1, /* "105" - bit 1 is lowest zero */
-    0, /* "106" - bit 0 is lowest zero */ 2, /* "107" - bit 2 is lowest zero */
-    0, /* "108" - bit 0 is lowest zero */ 1, /* "109" - bit 1 is lowest zero */
-    0, /* "110" - bit 0 is lowest zero */ 4, /* "111" - bit 4 is lowest zero */
-    0, /* "112" - bit 0 is lowest zero */ 1, /* "113" - bit 1 is lowest zero */
-    0, /* "114" - bit 0 is lowest zero */ 2, /* "115" - bit 2 is lowest zero */
-    0, /* "116" - bit 0 is lowest zero */ 1, /* "117" - bit 1 is lowest zero */
-    0, /* "118" - bit 0 is lowest zero */ 3, /* "119" - bit 3 is lowest zero */
-    0, /* "120" - bit 0 is lowest zero */ 1, /* "121" - bit 1 is lowest zero */
-    0, /* "122" - bit 0 is lowest zero */ 2, /* "123" - bit 2 is lowest zero */
-    0, /* "124" - bit 0 is lowest zero */ 1, /* "125" - bit 1 is lowest zero */
-    0, /* "126" - bit 0 is lowest zero */ 7, /* "127" - bit 7 is lowest zero */
-    0, /* "128" - bit 0 is lowest zero */ 1, /* "129" - bit 1 is lowest zero */
-    0, /* "130" - bit 0 is lowest zero */ 2, /* "131" - bit 2 is lowest zero */
-    0, /* "132" - bit 0 is lowest zero */ 1, /* "133" - bit 1 is lowest zero */
-    0, /* "134" - bit 0 is lowest zero */ 3, /* "135" - bit 3 is lowest zero */
-    0, /* "136" - bit 0 is lowest zero */ 1, /* "137" - bit 1 is lowest zero */
-    0, /* "138" - bit 0 is lowest zero */ 2, /* "139" - bit 2 is lowest zero */
-    0, /* "140" - bit 0 is lowest zero */ 1, /* "141" - bit 1 is lowest zero */
-    0, /* "142" - bit 0 is lowest zero */ 4, /* "143" - bit 4 is lowest zero */
-    0, /* "144" - bit 0 is lowest zero */ 1, /* "145" - bit 1 is lowest zero */
-    0, /* "146" - bit 0 is lowest zero */ 2, /* "147" - bit 2 is lowest zero */
-    0, /* "148" - bit 0 is lowest zero */ 1, /* "149" - bit 1 is lowest zero */
-    0, /* "150" - bit 0 is lowest zero */ 3, /* "151" - bit 3 is lowest zero */
-    0, /* "152" - bit 0 is lowest zero */ 1, /* "153" - bit 1 is lowest zero */
-    0, /* "154" - bit 0 is lowest zero */ 2, /* "155" - bit 2 is lowest zero */
-    0, /* "156" - bit 0 is lowest zero */ 1, /* "157" - bit 1 is lowest zero */
-    0, /* "158" - bit 0 is lowest zero */ 5, /* "159" - bit 5 is lowest zero */
-    0, /* "160" - bit 0 is lowest zero */ 1, /* "161" - bit 1 is lowest zero */
-    0, /* "162" - bit 0 is lowest zero */ 2, /* "163" - bit 2 is lowest zero */
-    0, /* "164" - bit 0 is lowest zero */ 1, /* "165" - bit 1 is lowest zero */
-    0, /* "166" - bit 0 is lowest zero */ 3, /* "167" - bit 3 is lowest zero */
-    0, /* "168" - bit 0 is lowest zero */ 1, /* "169" - bit 1 is lowest zero */
-    0, /* "170" - bit 0 is lowest zero */ 2, /* "171" - bit 2 is lowest zero */
-    0, /* "172" - bit 0 is lowest zero */ 1, /* "173" - bit 1 is lowest zero */
-    0, /* "174" - bit 0 is lowest zero */ 4, /* "175" - bit 4 is lowest zero */
-    0, /* "176" - bit 0 is lowest zero */ 1, /* "177" - bit 1 is lowest zero */
-    0, /* "178" - bit 0 is lowest zero */ 2, /* "179" - bit 2 is lowest zero */
-    0, /* "180" - bit 0 is lowest zero */ 1, /* "181" - bit 1 is lowest zero */
-    0, /* "182" - bit 0 is lowest zero */ 3, /* "183" - bit 3 is lowest zero */
-    0, /* "184" - bit 0 is lowest zero */ 1, /* "185" - bit 1 is lowest zero */
-    0, /* "186" - bit 0 is lowest zero */ 2, /* "187" - bit 2 is lowest zero */
-    0, /* "188" - bit 0 is lowest zero */ 1, /* "189" - bit 1 is lowest zero */
-    0, /* "190" - bit 0 is lowest zero */ 6, /* "191" - bit 6 is lowest zero */
-    0, /* "192" - bit 0 is lowest zero */ 1, /* "193" - bit 1 is lowest zero */
-    0, /* "194" - bit 0 is lowest zero */ 2, /* "195" - bit 2 is lowest zero */
-    0, /* "196" - bit 0 is lowest zero */ 1, /* "197" - bit 1 is lowest zero */
-    0, /* "198" - bit 0 is lowest zero */ 3, /* "199" - bit 3 is lowest zero */
-    0, /* "200" - bit 0 is lowest zero */ 1, /* "201" - bit 1 is lowest zero */
-    0, /* "202" - bit 0 is lowest zero */ 2, /* "203" - bit 2 is lowest zero */
-    0, /* "204" - bit 0 is lowest zero */ 1, /* "205" - bit 1 is lowest zero */
-    0, /* "206" - bit 0 is lowest zero */ 4, /* "207" - bit 4 is lowest zero */
-    0, /* "208" - bit 0 is lowest zero */ 1, /* "209" - bit 1 is lowest zero */
-    0, /* "210" - bit 0 is lowest zero */ 2, /* "211" - bit 2 is lowest zero */
-    0, /* "212" - bit 0 is lowest zero */ 1, /* "213" - bit 1 is lowest zero */
-    0, /* "214" - bit 0 is lowest zero */ 3, /* "215" - bit 3 is lowest zero */
-    0, /* "216" - bit 0 is lowest zero */ 1, /* "217" - bit 1 is lowest zero */
-    0, /* "218" - bit 0 is lowest zero */ 2, /* "219" - bit 2 is lowest zero */
-    0, /* "220" - bit 0 is lowest zero */ 1, /* "221" - bit 1 is lowest zero */
-    0, /* "222" - bit 0 is lowest zero */ 5, /* "223" - bit 5 is lowest zero */
-    0, /* "224" - bit 0 is lowest zero */ 1, /* "225" - bit 1 is lowest zero */
-    0, /* "226" - bit 0 is lowest zero */ 2, /* "227" - bit 2 is lowest zero */
-    0, /* "228" - bit 0 is lowest zero */ 1, /* "229" - bit 1 is lowest zero */
-    0, /* "230" - bit 0 is lowest zero */ 3, /* "231" - bit 3 is lowest zero */
-    0, /* "232" - bit 0 is lowest zero */ 1, /* "233" - bit 1 is lowest zero */
-    0, /* "234" - bit 0 is lowest zero */ 2, /* "235" - bit 2 is lowest zero */
-    0, /* "236" - bit 0 is lowest zero */ 1, /* "237" - bit 1 is lowest zero */
-    0, /* "238" - bit 0 is lowest zero */ 4, /* "239" - bit 4 is lowest zero */
-    0, /* "240" - bit 0 is lowest zero */ 1, /* "241" - bit 1 is lowest zero */
-    0, /* "242" - bit 0 is lowest zero */ 2, /* "243" - bit 2 is lowest zero */
-    0, /* "244" - bit 0 is lowest zero */ 1, /* "245" - bit 1 is lowest zero */
-    0, /* "246" - bit 0 is lowest zero */ 3, /* "247" - bit 3 is lowest zero */
-    0, /* "248" - bit 0 is lowest zero */ 1, /* "249" - bit 1 is lowest zero */
-    0, /* "250" - bit 0 is lowest zero */ 2, /* "251" - bit 2 is lowest zero */
-    0, /* "252" - bit 0 is lowest zero */ 1, /* "253" - bit 1 is lowest zero */
-    0, /* "254" - bit 0 is lowest zero */ 8  /* "255" - bit 8 is lowest zero */
-};
+#if !(defined(__GNUC__) || defined(_MSC_VER))
+/* Position of the single bit set in x, indexed by (x * 0x077CB531) >> 27,
+   for the compilers without a count-trailing-zeros builtin */
+static const int8 bv_debruijn_pos[32] = {0,  1,  28, 2,  29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4,  8,
+                                         31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6,  11, 5,  10, 9};
+#endif
+
+/* Returns the position of the lowest zero bit of a base element which is not full */
+static int32
+bv_first_zero(bv_base x)
+{
+#if defined(__GNUC__)
+    return (int32)__builtin_ctz(~x);
+#elif defined(_MSC_VER)
+    unsigned long pos;
+
+    _BitScanForward(&pos, ~x);
+    return (int32)pos;
+#else
+    /* isolate the lowest zero bit, then look its position up */
+    return (int32)bv_debruijn_pos[(uint32)((~x & (x + 1)) * 0x077CB531U) >> 27];
+#endif
+} /* bv_first_zero() */
 
 /*--------------------------------------------------------------------------
  NAME
@@ -346,15 +223,17 @@ bv_set(bv_ptr b, int32 bit_num, bv_bool value)
             size_t   extra_size;
 
             num_chunks = ((((bit_num / BV_BASE_BITS) + 1) - b->array_size) / BV_CHUNK_SIZE) + 1;
+            if (num_chunks < b->array_size / BV_CHUNK_SIZE)
+                num_chunks = b->array_size / BV_CHUNK_SIZE; /* at least double, to keep growing linear */
             new_size   = (size_t)(b->array_size + num_chunks * BV_CHUNK_SIZE);
-            if ((b->buffer = realloc(b->buffer, new_size)) == NULL) {
+            if ((b->buffer = realloc(b->buffer, new_size * sizeof(bv_base))) == NULL) {
                 b->buffer = old_buf;
                 /* Could not allocate a larger bit buffer */
                 return FAIL;
             }
 
             /* Zero the bits, for the new bits */
-            extra_size = (size_t)(num_chunks * BV_CHUNK_SIZE);
+            extra_size = (size_t)(num_chunks * BV_CHUNK_SIZE) * sizeof(bv_base);
             memset(&b->buffer[b->array_size], 0, extra_size);
 
             b->array_size += num_chunks * BV_CHUNK_SIZE;
@@ -363,12 +242,12 @@ bv_set(bv_ptr b, int32 bit_num, bv_bool value)
     }
 
     if (value == BV_FALSE) {
-        b->buffer[base_elem] &= ~bv_bit_value[bit_elem];
+        b->buffer[base_elem] &= ~((bv_base)1 << bit_elem);
         if (base_elem < b->last_zero)
             b->last_zero = base_elem;
     }
     else
-        b->buffer[base_elem] |= bv_bit_value[bit_elem];
+        b->buffer[base_elem] |= (bv_base)1 << bit_elem;
 
     return SUCCEED;
 } /* bv_set() */
@@ -405,8 +284,7 @@ bv_get(bv_ptr b, int32 bit_num)
     base_elem = bit_num / BV_BASE_BITS;
     bit_elem  = bit_num % BV_BASE_BITS;
 
-    ret_value = b->buffer[base_elem] & bv_bit_value[bit_elem];
-    ret_value >>= bit_elem;
+    ret_value = (intn)((b->buffer[base_elem] >> bit_elem) & 1);
 
     return ret_value;
 } /* bv_get() */
@@ -452,42 +330,31 @@ int32
 bv_find_next_zero(bv_ptr b)
 {
     int32    old_bits_used; /* the last number of bits used */
-    int32    bytes_used;    /* number of full bytes used */
-    bv_base  slush_bits;    /* extra bits which don't fit into a byte */
+    int32    elems_used;    /* number of base elements with bits in use */
+    int32    bit_num;       /* the zero bit found */
     int32    i;             /* local counting variable */
     bv_base *tmp_buf;
 
     if (b == NULL || b->buffer == NULL)
         return FAIL;
 
-    bytes_used = b->bits_used / BV_BASE_BITS;
-
-    /* looking for first '0' in the bit-vector */
-
-    if (b->last_zero >= 0)
-        i = b->last_zero;
-    else
-        i = 0;
+    elems_used = (b->bits_used + (BV_BASE_BITS - 1)) / BV_BASE_BITS;
 
+    /* looking for first '0' in the bit-vector, skipping full elements */
+    i       = (b->last_zero >= 0) ? b->last_zero : 0;
     tmp_buf = &b->buffer[i];
-
-    while (i < bytes_used && *tmp_buf == 255) {
+    while (i < elems_used && *tmp_buf == BV_BASE_FULL) {
         i++;
         tmp_buf++;
     }
-
-    if (i < bytes_used) {
-        b->last_zero = i;
-        return (i * BV_BASE_BITS) + bv_first_zero[*tmp_buf];
-    }
-
-    /* Any extra bits left over? */
-    if ((bytes_used * BV_BASE_BITS) < b->bits_used) {
-        slush_bits = (bv_base)(b->buffer[i] & bv_bit_mask[b->bits_used - (bytes_used * BV_BASE_BITS)]);
-        if (slush_bits != 255) {
-            b->last_zero = i;
-            return (i * BV_BASE_BITS) + bv_first_zero[slush_bits];
-        }
+    b->last_zero = i;
+
+    /* The bits after the ones in use are zero, so a zero found past the end
+       is the first bit after it */
+    if (i < elems_used) {
+        bit_num = (i * BV_BASE_BITS) + bv_first_zero(*tmp_buf);
+        if (bit_num < b->bits_used)
+            return bit_num;
     }
 
     /* Beyond the current end of the bit-vector, extend the bit-vector */
@@ -496,4 +363,40 @@ bv_find_next_zero(bv_ptr b)
         return FAIL;
 
     return old_bits_used;
-} /* bv_find() */
+} /* bv_find_next_zero() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    bv_union
+ PURPOSE
+    Set the bits of one bit-vector in another
+ USAGE
+    intn bv_union(dst,src)
+        bv_ptr dst;                 IN/OUT: Bit-vector to set the bits in
+        bv_ptr src;                 IN: Bit-vector to take the bits from
+ RETURNS
+    Returns SUCCEED/FAIL
+ DESCRIPTION
+    Sets every bit which is set in src in dst as well, a whole element at a
+    time, extending dst if src is longer.
+ COMMENTS, BUGS, ASSUMPTIONS
+--------------------------------------------------------------------------*/
+intn
+bv_union(bv_ptr dst, bv_ptr src)
+{
+    int32 elems_used; /* number of base elements with bits in use in src */
+    int32 i;          /* local counting variable */
+
+    if (dst == NULL || dst->buffer == NULL || src == NULL || src->buffer == NULL)
+        return FAIL;
+
+    if (src->bits_used > dst->bits_used)
+        if (bv_set(dst, src->bits_used - 1, BV_FALSE) == FAIL)
+            return FAIL;
+
+    elems_used = (src->bits_used + (BV_BASE_BITS - 1)) / BV_BASE_BITS;
+    for (i = 0; i < elems_used; i++)
+        dst->buffer[i] |= src->buffer[i];
+
+    return SUCCEED;
+} /* bv_union() */
@@ -27,8 +27,8 @@ typedef enum { BV_FALSE = 0, BV_TRUE = 1 } bv_bool;
 /* Default size of a bit-vector */
 #define BV_DEFAULT_BITS 128
 
-/* Define the size of the chunks bits are allocated in */
-#define BV_CHUNK_SIZE 64
+/* Define the size of the chunks bits are allocated in (in 32-bit words) */
+#define BV_CHUNK_SIZE 16
 
 /* Create the external interface data structures needed */
 typedef struct bv_struct_tag *bv_ptr;
@@ -51,6 +51,8 @@ HDFLIBAPI int32 bv_size(bv_ptr b);
 
 HDFLIBAPI int32 bv_find_next_zero(bv_ptr b);
 
+HDFLIBAPI intn bv_union(bv_ptr dst, bv_ptr src);
+
 #ifdef __cplusplus
 }
 #endif
@@ -733,3 +733,102 @@ HCPcdeflate_endaccess(accrec_t *access_rec)
 
     return SUCCEED;
 } /* HCPcdeflate_endaccess() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HCPcdeflate_decode_buffer -- Decode gzip 'deflated' data held in memory
+
+ USAGE
+    int32 HCPcdeflate_decode_buffer(src,src_len,dst,dst_len)
+    uint8 *src;         IN: the compressed data, as stored in the file
+    int32 src_len;      IN: number of bytes of compressed data
+    uint8 *dst;         OUT: buffer for the decompressed data
+    int32 dst_len;      IN: number of bytes to decompress
+
+ RETURNS
+    Returns # of bytes decompressed or FAIL
+
+ DESCRIPTION
+    Decodes the whole of the data of a compressed element, read into
+    memory beforehand, the way HCIcdeflate_decode() would through the
+    element.  Uses no state of the library and reports no errors, so that
+    it can run on a worker thread (see HWPrun).
+
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+int32
+HCPcdeflate_decode_buffer(uint8 *src, int32 src_len, uint8 *dst, int32 dst_len)
+{
+    z_stream zs; /* inflation context */
+    int      zstat;
+
+    memset(&zs, 0, sizeof(zs));
+    if (inflateInit(&zs) != Z_OK)
+        return FAIL;
+
+    zs.next_in   = src;
+    zs.avail_in  = (uInt)src_len;
+    zs.next_out  = dst;
+    zs.avail_out = (uInt)dst_len;
+    zstat        = inflate(&zs, Z_FINISH);
+    inflateEnd(&zs);
+
+    /* Like HCIcdeflate_decode(), stop at the end of the buffer or of the data */
+    if (zstat != Z_STREAM_END && !(zstat == Z_BUF_ERROR && zs.avail_out == 0))
+        return FAIL;
+
+    return dst_len - (int32)zs.avail_out;
+} /* HCPcdeflate_decode_buffer() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HCPcdeflate_encode_buffer -- Encode data held in memory with gzip 'deflate'
+
+ USAGE
+    int32 HCPcdeflate_encode_buffer(level,src,src_len,dst,dst_len)
+    intn level;         IN: the level of compression, 0-9
+    uint8 *src;         IN: the data to compress
+    int32 src_len;      IN: number of bytes of data
+    uint8 *dst;         OUT: buffer for the compressed data
+    int32 dst_len;      IN: size of the buffer
+
+ RETURNS
+    Returns # of bytes of compressed data or FAIL
+
+ DESCRIPTION
+    Encodes the whole of the data of an element at once, into the data to
+    store in the file, the way HCIcdeflate_encode() and HCIcdeflate_term()
+    would through the element.  Uses no state of the library and reports
+    no errors, so that it can run on a worker thread (see HWPrun).  FAILs
+    if the compressed data doesn't fit in 'dst'.
+
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+int32
+HCPcdeflate_encode_buffer(intn level, uint8 *src, int32 src_len, uint8 *dst, int32 dst_len)
+{
+    z_stream zs; /* deflation context */
+    int      zstat;
+
+    memset(&zs, 0, sizeof(zs));
+    if (deflateInit(&zs, level) != Z_OK)
+        return FAIL;
+
+    zs.next_in   = src;
+    zs.avail_in  = (uInt)src_len;
+    zs.next_out  = dst;
+    zs.avail_out = (uInt)dst_len;
+    zstat        = deflate(&zs, Z_FINISH);
+    deflateEnd(&zs);
+
+    if (zstat != Z_STREAM_END)
+        return FAIL;
+
+    return dst_len - (int32)zs.avail_out;
+} /* HCPcdeflate_encode_buffer() */
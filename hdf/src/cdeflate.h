@@ -63,6 +63,10 @@ HDFLIBAPI int32 HCPcdeflate_write(accrec_t *access_rec, int32 length, const void
 
 HDFLIBAPI intn HCPcdeflate_endaccess(accrec_t *access_rec);
 
+HDFLIBAPI int32 HCPcdeflate_decode_buffer(uint8 *src, int32 src_len, uint8 *dst, int32 dst_len);
+
+HDFLIBAPI int32 HCPcdeflate_encode_buffer(intn level, uint8 *src, int32 src_len, uint8 *dst, int32 dst_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -37,6 +37,7 @@
 
 #include "hdfi.h"
 #include "dfgr.h"
+#include "hthread.h"
 
 static intn  Newdata   = 0; /* does Readrig contain fresh data? */
 static intn  dimsset   = 0; /* have dimensions been set? */
@@ -70,6 +71,8 @@ DF24getdims(const char *filename, int32 *pxdim, int32 *pydim, intn *pil)
     intn ncomps;
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     do {
         if (DFGRIgetdims(filename, pxdim, pydim, &ncomps, pil, IMAGE) < 0)
             HGOTO_ERROR(DFE_NODIM, FAIL);
@@ -80,6 +83,7 @@ DF24getdims(const char *filename, int32 *pxdim, int32 *pydim, intn *pil)
     Newdata   = 1;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24getdims() */
 
@@ -103,8 +107,11 @@ DF24reqil(intn il)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFGRIreqil(il, IMAGE));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24reqil() */
 
@@ -138,6 +145,8 @@ DF24getimage(const char *filename, void *image, int32 xdim, int32 ydim)
     uint16 compr_type;
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     if (!filename || !*filename || !image || (xdim <= 0) || (ydim <= 0))
@@ -159,6 +168,7 @@ DF24getimage(const char *filename, void *image, int32 xdim, int32 ydim)
     Newdata = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24getimage() */
 
@@ -183,9 +193,12 @@ DF24setdims(int32 xdim, int32 ydim)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     dimsset   = 1;
     ret_value = (DFGRIsetdims(xdim, ydim, 3, IMAGE));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24setdims() */
 
@@ -209,8 +222,11 @@ DF24setil(intn il)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFGRIsetil(il, IMAGE));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24setil() */
 
@@ -239,8 +255,11 @@ DF24setcompress(int32 type, comp_info *cinfo)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFGRsetcompress(type, cinfo));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24setcompress() */
 
@@ -264,8 +283,11 @@ DF24restart(void)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFGRIrestart());
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24restart() */
 
@@ -294,6 +316,8 @@ DF24addimage(const char *filename, const void *image, int32 xdim, int32 ydim)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* 0 == C */
     if (!dimsset && DFGRIsetdims(xdim, ydim, 3, IMAGE) == FAIL)
         HGOTO_ERROR(DFE_BADDIM, FAIL);
@@ -302,6 +326,7 @@ DF24addimage(const char *filename, const void *image, int32 xdim, int32 ydim)
     ret_value = (DFGRIaddimlut(filename, image, xdim, ydim, IMAGE, 0, 0));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24addimage() */
 
@@ -330,6 +355,8 @@ DF24putimage(const char *filename, const void *image, int32 xdim, int32 ydim)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* 0 == C */
     if (!dimsset && DFGRIsetdims(xdim, ydim, 3, IMAGE) == FAIL)
         HGOTO_ERROR(DFE_BADDIM, FAIL);
@@ -338,6 +365,7 @@ DF24putimage(const char *filename, const void *image, int32 xdim, int32 ydim)
     ret_value = (DFGRIaddimlut(filename, image, xdim, ydim, IMAGE, 0, 1));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24putimage() */
 
@@ -368,6 +396,8 @@ DF24nimages(const char *filename)
     uint8  GRtbuf[64];         /* local buffer to read the ID element into */
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* should use reopen if same file as last time - more efficient */
@@ -413,6 +443,7 @@ DF24nimages(const char *filename)
     ret_value = nimages;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24nimages() */
 
@@ -437,8 +468,11 @@ DF24readref(const char *filename, uint16 ref)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFGRreadref(filename, ref));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24readref() */
 
@@ -461,7 +495,10 @@ DF24lastref(void)
 {
     uint16 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFGRIlastref());
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DF24lastref() */
@@ -53,6 +53,7 @@
 
 #include "hdfi.h"
 #include "dfan.h"
+#include "hthread.h"
 
 static uint16 Lastref        = 0; /* Last ref read/written */
 static uint16 Next_label_ref = 0; /* Next file label ref to read/write */
@@ -105,8 +106,11 @@ DFANgetlablen(const char *filename, uint16 tag, uint16 ref)
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIgetannlen(filename, tag, ref, DFAN_LABEL));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -137,8 +141,11 @@ DFANgetlabel(const char *filename, uint16 tag, uint16 ref, char *label, int32 ma
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIgetann(filename, tag, ref, (uint8 *)label, maxlen, DFAN_LABEL, 0));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -166,8 +173,11 @@ DFANgetdesclen(const char *filename, uint16 tag, uint16 ref)
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIgetannlen(filename, tag, ref, DFAN_DESC));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -200,8 +210,11 @@ DFANgetdesc(const char *filename, uint16 tag, uint16 ref, char *desc, int32 maxl
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIgetann(filename, tag, ref, (uint8 *)desc, maxlen, DFAN_DESC, 0));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -236,8 +249,11 @@ DFANgetfidlen(int32 file_id, int isfirst)
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIgetfannlen(file_id, DFAN_LABEL, isfirst));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -267,8 +283,11 @@ DFANgetfid(int32 file_id, char *label, int32 maxlen, intn isfirst)
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIgetfann(file_id, label, maxlen, DFAN_LABEL, isfirst));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -299,8 +318,11 @@ DFANgetfdslen(int32 file_id, intn isfirst)
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIgetfannlen(file_id, DFAN_DESC, isfirst));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -330,8 +352,11 @@ DFANgetfds(int32 file_id, char *desc, int32 maxlen, intn isfirst)
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIgetfann(file_id, desc, maxlen, DFAN_DESC, isfirst));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -364,8 +389,11 @@ DFANputlabel(const char *filename, uint16 tag, uint16 ref, char *label)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIputann(filename, tag, ref, (uint8 *)label, (int32)strlen(label), DFAN_LABEL));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -397,8 +425,11 @@ DFANputdesc(const char *filename, uint16 tag, uint16 ref, char *desc, int32 desc
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIputann(filename, tag, ref, (uint8 *)desc, desclen, DFAN_DESC));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -427,8 +458,11 @@ DFANaddfid(int32 file_id, char *id)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIaddfann(file_id, id, (int32)strlen(id), DFAN_LABEL));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -456,8 +490,11 @@ DFANaddfds(int32 file_id, char *desc, int32 desclen)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIaddfann(file_id, desc, desclen, DFAN_DESC));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -485,8 +522,11 @@ DFANlastref(void)
 {
     uint16 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (Lastref);
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -526,7 +566,10 @@ DFANlablist(const char *filename, uint16 tag, uint16 reflist[], char *labellist,
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFANIlablist(filename, tag, reflist, (uint8 *)labellist, listsize, maxlen, startpos, 0));
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -552,8 +595,11 @@ DFANclear(void)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = DFANIclear();
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -585,6 +631,8 @@ DFANIclear(void)
     DFANdirhead *p, *q;
     intn         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -613,6 +661,7 @@ DFANIclear(void)
     Lastref = 0; /* 0 is invalid ref */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -733,6 +782,8 @@ DFANIlocate(int32 file_id, int type, uint16 tag, uint16 ref)
     uint8       *ptr;
     uint16       ret_value = 0; /* FAIL ? */
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -798,6 +849,7 @@ DFANIlocate(int32 file_id, int type, uint16 tag, uint16 ref)
     HERROR(DFE_NOMATCH);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -826,6 +878,8 @@ DFANIaddentry(int type, uint16 annref, uint16 datatag, uint16 dataref)
     DFANdirhead *p, *q;
     int          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -871,6 +925,7 @@ DFANIaddentry(int type, uint16 annref, uint16 datatag, uint16 dataref)
         q->entries[i].annref = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -900,6 +955,8 @@ DFANIgetannlen(const char *filename, uint16 tag, uint16 ref, int type)
     uint16 anntag, annref;
     int32  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -932,6 +989,7 @@ DFANIgetannlen(const char *filename, uint16 tag, uint16 ref, int type)
     ret_value = annlength;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -968,6 +1026,8 @@ DFANIgetann(const char *filename, uint16 tag, uint16 ref, uint8 *ann, int32 maxl
     uint8  datadi[4]; /* to read in and discard data/ref! */
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1039,6 +1099,7 @@ DFANIgetann(const char *filename, uint16 tag, uint16 ref, uint8 *ann, int32 maxl
     ret_value = (Hclose(file_id));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1076,6 +1137,8 @@ DFANIputann(const char *filename, uint16 tag, uint16 ref, uint8 *ann, int32 annl
     uint8 *ptr;
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1149,6 +1212,7 @@ DFANIputann(const char *filename, uint16 tag, uint16 ref, uint8 *ann, int32 annl
     ret_value = (Hclose(file_id));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1196,6 +1260,8 @@ DFANIlablist(const char *filename, uint16 tag, uint16 reflist[], uint8 *labellis
     uint8        labeldi[4]; /* to read in and discard data/ref */
     intn         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1297,6 +1363,7 @@ DFANIlablist(const char *filename, uint16 tag, uint16 reflist[], uint8 *labellis
         ret_value = nrefs;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1325,6 +1392,8 @@ DFANIaddfann(int32 file_id, char *ann, int32 annlen, int type)
     uint16 anntag, annref;
     int    ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1348,6 +1417,7 @@ DFANIaddfann(int32 file_id, char *ann, int32 annlen, int type)
     Lastref = annref; /* remember ref last accessed */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1380,6 +1450,8 @@ DFANIgetfannlen(int32 file_id, int type, int isfirst)
     int32  length;
     int32  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1418,6 +1490,7 @@ DFANIgetfannlen(int32 file_id, int type, int isfirst)
         HGOTO_ERROR(DFE_NOMATCH, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1453,6 +1526,8 @@ DFANIgetfann(int32 file_id, char *ann, int32 maxlen, int type, int isfirst)
     int32  length, aid;
     int32  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1520,6 +1595,7 @@ DFANIgetfann(int32 file_id, char *ann, int32 maxlen, int type, int isfirst)
     ret_value = length;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1575,9 +1651,12 @@ done:
 intn
 DFANPshutdown(void)
 {
+    H4_API_LOCK;
+
     DFANIclear(); /* frees the directory lists */
 
     free(Lastfile);
     Lastfile = NULL;
+    H4_API_UNLOCK;
     return SUCCEED;
 } /* end DFANPshutdown() */
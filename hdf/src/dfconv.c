@@ -63,6 +63,7 @@
 
 #include "hdfi.h"
 #include "hconv.h"
+#include "hthread.h"
 
 /*
  **  Static function prototypes
@@ -78,12 +79,13 @@ extern int   DFKsetcustom(int (*DFKcustin)(void *source, void *dest, uint32 num_
 extern int   DFconvert(uint8 *source, uint8 *dest, int ntype, int sourcetype, int desttype, int32 size);
 
 /*
- **  Conversion Routine Pointer Definitions
+ **  Conversion Routine Pointer Definitions, kept per thread in a threadsafe
+ **  build, like the number type below
  */
-static int (*DFKnumin)(void *source, void *dest, uint32 num_elm, uint32 source_stride,
-                       uint32 dest_stride)  = DFKInoset;
-static int (*DFKnumout)(void *source, void *dest, uint32 num_elm, uint32 source_stride,
-                        uint32 dest_stride) = DFKInoset;
+static H4_THREAD_LOCAL int (*DFKnumin)(void *source, void *dest, uint32 num_elm, uint32 source_stride,
+                                       uint32 dest_stride)  = DFKInoset;
+static H4_THREAD_LOCAL int (*DFKnumout)(void *source, void *dest, uint32 num_elm, uint32 source_stride,
+                                        uint32 dest_stride) = DFKInoset;
 
 /************************************************************
  * If the programmer forgot to call DFKsetntype, then let
@@ -109,8 +111,8 @@ DFKInoset(void *source, void *dest, uint32 num_elm, uint32 source_stride, uint32
  * Routines that depend on the above information
  *****************************************************************************/
 
-static int32 g_ntype = DFNT_NONE; /* Holds current number type. */
-                                  /* Initially not set.         */
+static H4_THREAD_LOCAL int32 g_ntype = DFNT_NONE; /* Holds current number type. */
+                                                  /* Initially not set.         */
 
 /************************************************************
  * DFKqueryNT()
@@ -45,6 +45,7 @@
 
 #include "hdfi.h"
 #include "dfgr.h"
+#include "hthread.h"
 
 static char     *Grlastfile = NULL;
 static uint8    *Grlutdata  = NULL; /* points to lut, if in memory */
@@ -156,7 +157,14 @@ static intn DFGRIstart(void);
 int
 DFGRgetlutdims(const char *filename, int32 *pxdim, int32 *pydim, int *pncomps, int *pil)
 {
-    return DFGRIgetdims(filename, pxdim, pydim, pncomps, pil, LUT);
+    int ret_value;
+
+    H4_API_LOCK;
+
+    ret_value = DFGRIgetdims(filename, pxdim, pydim, pncomps, pil, LUT);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -172,7 +180,14 @@ DFGRgetlutdims(const char *filename, int32 *pxdim, int32 *pydim, int *pncomps, i
 int
 DFGRreqlutil(int il)
 {
-    return DFGRIreqil(il, LUT);
+    int ret_value;
+
+    H4_API_LOCK;
+
+    ret_value = DFGRIreqil(il, LUT);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -192,8 +207,15 @@ DFGRgetlut(const char *filename, void *lut, int32 xdim, int32 ydim)
 {
     int    compressed, has_pal;
     uint16 compr_type;
+    int    ret_value;
+
+    H4_API_LOCK;
+
     /* 0 == C */
-    return DFGRIgetimlut(filename, lut, xdim, ydim, LUT, 0, &compressed, &compr_type, &has_pal);
+    ret_value = DFGRIgetimlut(filename, lut, xdim, ydim, LUT, 0, &compressed, &compr_type, &has_pal);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -213,7 +235,14 @@ DFGRgetlut(const char *filename, void *lut, int32 xdim, int32 ydim)
 int
 DFGRgetimdims(const char *filename, int32 *pxdim, int32 *pydim, int *pncomps, int *pil)
 {
-    return DFGRIgetdims(filename, pxdim, pydim, pncomps, pil, IMAGE);
+    int ret_value;
+
+    H4_API_LOCK;
+
+    ret_value = DFGRIgetdims(filename, pxdim, pydim, pncomps, pil, IMAGE);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -229,7 +258,14 @@ DFGRgetimdims(const char *filename, int32 *pxdim, int32 *pydim, int *pncomps, in
 int
 DFGRreqimil(int il)
 {
-    return DFGRIreqil(il, IMAGE);
+    int ret_value;
+
+    H4_API_LOCK;
+
+    ret_value = DFGRIreqil(il, IMAGE);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -249,8 +285,15 @@ DFGRgetimage(const char *filename, void *image, int32 xdim, int32 ydim)
 {
     int    compressed, has_pal;
     uint16 compr_type;
+    int    ret_value;
+
+    H4_API_LOCK;
+
     /* 0 == C */
-    return DFGRIgetimlut(filename, image, xdim, ydim, IMAGE, 0, &compressed, &compr_type, &has_pal);
+    ret_value = DFGRIgetimlut(filename, image, xdim, ydim, IMAGE, 0, &compressed, &compr_type, &has_pal);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -269,6 +312,8 @@ DFGRsetcompress(int32 scheme, comp_info *cinfo)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -292,6 +337,7 @@ DFGRsetcompress(int32 scheme, comp_info *cinfo)
     Grcinfo = (*cinfo); /* Set the compression parameters */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFGRsetcompress() */
 
@@ -310,9 +356,17 @@ done:
 int
 DFGRsetlutdims(int32 xdim, int32 ydim, int ncomps, int il)
 {
+    int ret_value;
+
+    H4_API_LOCK;
+
     if (DFGRIsetil(il, LUT) < 0)
-        return FAIL;
-    return DFGRIsetdims(xdim, ydim, ncomps, LUT);
+        HGOTO_DONE(FAIL);
+    ret_value = DFGRIsetdims(xdim, ydim, ncomps, LUT);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -329,8 +383,15 @@ DFGRsetlutdims(int32 xdim, int32 ydim, int ncomps, int il)
 int
 DFGRsetlut(void *lut, int32 xdim, int32 ydim)
 {
+    int ret_value;
+
+    H4_API_LOCK;
+
     /* 0 == C, 0 == no newfile */
-    return DFGRIaddimlut((const char *)NULL, lut, xdim, ydim, LUT, 0, 0);
+    ret_value = DFGRIaddimlut((const char *)NULL, lut, xdim, ydim, LUT, 0, 0);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -348,8 +409,15 @@ DFGRsetlut(void *lut, int32 xdim, int32 ydim)
 int
 DFGRaddlut(const char *filename, void *lut, int32 xdim, int32 ydim)
 {
+    int ret_value;
+
+    H4_API_LOCK;
+
     /* 0 == C, 0 == no new file */
-    return DFGRIaddimlut(filename, lut, xdim, ydim, LUT, 0, 0);
+    ret_value = DFGRIaddimlut(filename, lut, xdim, ydim, LUT, 0, 0);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -367,9 +435,17 @@ DFGRaddlut(const char *filename, void *lut, int32 xdim, int32 ydim)
 int
 DFGRsetimdims(int32 xdim, int32 ydim, int ncomps, int il)
 {
+    int ret_value;
+
+    H4_API_LOCK;
+
     if (DFGRIsetil(il, IMAGE) < 0)
-        return FAIL;
-    return DFGRIsetdims(xdim, ydim, ncomps, IMAGE);
+        HGOTO_DONE(FAIL);
+    ret_value = DFGRIsetdims(xdim, ydim, ncomps, IMAGE);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -387,15 +463,29 @@ DFGRsetimdims(int32 xdim, int32 ydim, int ncomps, int il)
 int
 DFGRaddimage(const char *filename, void *image, int32 xdim, int32 ydim)
 {
+    int ret_value;
+
+    H4_API_LOCK;
+
     /* 0 == C, 0 == not new file */
-    return DFGRIaddimlut(filename, image, xdim, ydim, IMAGE, 0, 0);
+    ret_value = DFGRIaddimlut(filename, image, xdim, ydim, IMAGE, 0, 0);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 int
 DFGRputimage(const char *filename, void *image, int32 xdim, int32 ydim)
 {
+    int ret_value;
+
+    H4_API_LOCK;
+
     /* 0 == C, 1 == new file */
-    return DFGRIaddimlut(filename, image, xdim, ydim, IMAGE, 0, 1);
+    ret_value = DFGRIaddimlut(filename, image, xdim, ydim, IMAGE, 0, 1);
+
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -415,6 +505,8 @@ DFGRreadref(const char *filename, uint16 ref)
     intn  ret_value = SUCCEED;
     int32 file_id   = (-1);
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -437,6 +529,7 @@ done:
             Hclose(file_id);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -858,6 +951,8 @@ DFGRIgetdims(const char *filename, int32 *pxdim, int32 *pydim, int *pncomps, int
     intn  ret_value = SUCCEED;
     int32 file_id   = (-1);
 
+    H4_API_LOCK;
+
     HEclear();
 
     if ((file_id = DFGRIopen(filename, DFACC_READ)) == FAIL)
@@ -890,6 +985,7 @@ done:
             Hclose(file_id);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -909,6 +1005,8 @@ DFGRIreqil(intn il, intn type)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -919,6 +1017,7 @@ DFGRIreqil(intn il, intn type)
     Grreqil[type] = il;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -950,6 +1049,8 @@ DFGRIgetimlut(const char *filename, void *imlut, int32 xdim, int32 ydim, int typ
     int32  aid;
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     (void)isfortran;
 
     HEclear();
@@ -1082,6 +1183,7 @@ done:
             Hclose(file_id);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1103,6 +1205,8 @@ DFGRIsetdims(int32 xdim, int32 ydim, intn ncomps, int type)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFGRIstart() == FAIL)
@@ -1118,6 +1222,7 @@ DFGRIsetdims(int32 xdim, int32 ydim, intn ncomps, int type)
     Ref.dims[type] = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1137,17 +1242,20 @@ DFGRIsetil(int il, int type)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFGRIstart() == FAIL)
             HGOTO_ERROR(DFE_CANTINIT, FAIL);
 
     if (il == FAIL)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     Grwrite.datadesc[type].interlace = il;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 /*-----------------------------------------------------------------------------
@@ -1164,6 +1272,8 @@ DFGRIrestart(void)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFGRIstart() == FAIL)
@@ -1174,6 +1284,7 @@ DFGRIrestart(void)
     Grrefset = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1202,6 +1313,9 @@ DFGRIaddimlut(const char *filename, const void *imlut, int32 xdim, int32 ydim, i
     uint8 *newlut  = NULL;
     int32  lutsize = 0;
     int    is8bit;
+
+    H4_API_LOCK;
+
     struct {
         uint16 xdim;
         uint16 ydim;
@@ -1343,6 +1457,7 @@ done:
     if (file_id != (-1))
         Hclose(file_id);
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1361,6 +1476,9 @@ done:
 uint16
 DFGRIlastref(void)
 {
+    H4_API_LOCK;
+
+    H4_API_UNLOCK;
     return (uint16)Grlastref;
 }
 
@@ -1416,8 +1534,11 @@ done:
 intn
 DFGRPshutdown(void)
 {
+    H4_API_LOCK;
+
     free(Grlastfile);
     Grlastfile = NULL;
 
+    H4_API_UNLOCK;
     return SUCCEED;
 } /* end DFGRPshutdown() */
@@ -28,6 +28,7 @@
 
 #include "hdfi.h"
 #include "hfile.h"
+#include "hthread.h"
 
 typedef struct DIlist_struct {
     uint8 *DIlist;
@@ -37,6 +38,17 @@ typedef struct DIlist_struct {
 
 static DIlist_ptr Group_list[MAX_GROUPS] = {NULL};
 
+/* SD writes its groups while holding the library lock shared */
+#ifdef H4_HAVE_THREADSAFE
+#include <pthread.h>
+static pthread_mutex_t Group_lock = PTHREAD_MUTEX_INITIALIZER;
+#define DFI_LOCK()   pthread_mutex_lock(&Group_lock)
+#define DFI_UNLOCK() pthread_mutex_unlock(&Group_lock)
+#else
+#define DFI_LOCK()   ((void)0)
+#define DFI_UNLOCK() ((void)0)
+#endif
+
 #define GSLOT2ID(s) ((((uint32)GROUPTYPE & 0xffff) << 16) | ((s)&0xffff))
 #define VALIDGID(i) (((((uint32)(i) >> 16) & 0xffff) == GROUPTYPE) && (((uint32)(i)&0xffff) < MAX_GROUPS))
 #define GID2REC(i)  ((VALIDGID(i) ? (Group_list[(uint32)(i)&0xffff]) : NULL))
@@ -55,11 +67,14 @@ setgroupREC(DIlist_ptr list_rec)
 {
     uintn i;
 
+    DFI_LOCK();
     for (i = 0; i < MAX_GROUPS; i++)
         if (Group_list[i] == NULL) {
             Group_list[i] = list_rec;
+            DFI_UNLOCK();
             return (int32)GSLOT2ID(i);
         }
+    DFI_UNLOCK();
 
     HRETURN_ERROR(DFE_INTERNAL, FAIL);
 } /* setgroupREC */
@@ -80,26 +95,29 @@ DFdiread(int32 file_id, uint16 tag, uint16 ref)
 {
     DIlist_ptr new_list;
     int32      length;
+    int32      ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     HEclear();
 
     if (!HDvalidfid(file_id))
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* Find the group. */
     length = Hlength(file_id, tag, ref);
     if (length == FAIL)
-        HRETURN_ERROR(DFE_INTERNAL, FAIL);
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
     /* allocate a new structure to hold the group */
     new_list = (DIlist_ptr)malloc((uint32)sizeof(DIlist));
     if (!new_list)
-        HRETURN_ERROR(DFE_NOSPACE, FAIL);
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
     new_list->DIlist = (uint8 *)malloc((uint32)length);
     if (!new_list->DIlist) {
         free(new_list);
-        HRETURN_ERROR(DFE_NOSPACE, FAIL);
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
     }
 
     new_list->num     = (intn)(length / 4);
@@ -109,9 +127,13 @@ DFdiread(int32 file_id, uint16 tag, uint16 ref)
     if (Hgetelement(file_id, tag, ref, (uint8 *)new_list->DIlist) < 0) {
         free(new_list->DIlist);
         free(new_list);
-        HRETURN_ERROR(DFE_READERROR, FAIL);
+        HGOTO_ERROR(DFE_READERROR, FAIL);
     }
-    return (int32)setgroupREC(new_list);
+    ret_value = (int32)setgroupREC(new_list);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -131,13 +153,16 @@ DFdiget(int32 list, uint16 *ptag, uint16 *pref)
 {
     uint8     *p;
     DIlist_ptr list_rec;
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     list_rec = GID2REC(list);
 
     if (!list_rec)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
     if (list_rec->current >= list_rec->num)
-        HRETURN_ERROR(DFE_INTERNAL, FAIL);
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
     /* compute address of Ndi'th di */
     p = (uint8 *)list_rec->DIlist + 4 * list_rec->current++;
@@ -147,9 +172,14 @@ DFdiget(int32 list, uint16 *ptag, uint16 *pref)
     if (list_rec->current == list_rec->num) {
         free(list_rec->DIlist); /*if all returned, free storage */
         free(list_rec);
+        DFI_LOCK();
         Group_list[list & 0xffff] = NULL; /* YUCK! BUG! */
+        DFI_UNLOCK();
     }
-    return SUCCEED;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -166,13 +196,20 @@ intn
 DFdinobj(int32 list)
 {
     DIlist_ptr list_rec;
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     list_rec = GID2REC(list);
 
     if (!list_rec)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    ret_value = list_rec->num;
 
-    return list_rec->num;
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* DFdinobj() */
 
 /*-----------------------------------------------------------------------------
@@ -191,22 +228,29 @@ int32
 DFdisetup(int maxsize)
 {
     DIlist_ptr new_list;
+    int32      ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     new_list = (DIlist_ptr)malloc((uint32)sizeof(DIlist));
 
     if (!new_list)
-        HRETURN_ERROR(DFE_NOSPACE, FAIL);
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
     new_list->DIlist = (uint8 *)malloc((uint32)(maxsize * 4));
     if (!new_list->DIlist) {
         free(new_list);
-        HRETURN_ERROR(DFE_NOSPACE, FAIL);
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
     }
 
     new_list->num     = maxsize;
     new_list->current = 0;
 
-    return setgroupREC(new_list);
+    ret_value = setgroupREC(new_list);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -224,20 +268,25 @@ DFdiput(int32 list, uint16 tag, uint16 ref)
 {
     uint8     *p;
     DIlist_ptr list_rec;
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     list_rec = GID2REC(list);
 
     if (!list_rec)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
     if (list_rec->current >= list_rec->num)
-        HRETURN_ERROR(DFE_INTERNAL, FAIL);
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
     /* compute address of Ndi'th di to put tag/ref in */
     p = (uint8 *)list_rec->DIlist + 4 * list_rec->current++;
     UINT16ENCODE(p, tag);
     UINT16ENCODE(p, ref);
 
-    return SUCCEED;
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -256,20 +305,29 @@ DFdiwrite(int32 file_id, int32 list, uint16 tag, uint16 ref)
 {
     int32      ret; /* return value */
     DIlist_ptr list_rec;
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     if (!HDvalidfid(file_id))
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     list_rec = GID2REC(list);
 
     if (!list_rec)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     ret = Hputelement(file_id, tag, ref, list_rec->DIlist, (int32)list_rec->current * 4);
     free(list_rec->DIlist);
     free(list_rec);
+    DFI_LOCK();
     Group_list[list & 0xffff] = NULL; /* YUCK! BUG! */
-    return (intn)ret;
+    DFI_UNLOCK();
+    ret_value = (intn)ret;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 }
 
 /*-----------------------------------------------------------------------------
@@ -300,11 +358,16 @@ DFdifree(int32 groupID)
 {
     DIlist_ptr list_rec;
 
+    H4_API_LOCK;
+
     list_rec = GID2REC(groupID);
-    if (list_rec == NULL)
-        return;
+    if (list_rec != NULL) {
+        free(list_rec->DIlist);
+        free(list_rec);
+        DFI_LOCK();
+        Group_list[groupID & 0xffff] = NULL;
+        DFI_UNLOCK();
+    }
 
-    free(list_rec->DIlist);
-    free(list_rec);
-    Group_list[groupID & 0xffff] = NULL;
+    H4_API_UNLOCK;
 }
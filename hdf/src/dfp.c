@@ -28,6 +28,7 @@
  *---------------------------------------------------------------------------*/
 
 #include "hdfi.h"
+#include "hthread.h"
 
 /* remember that '0' is invalid ref number */
 static uint16 Readref  = 0;
@@ -64,6 +65,8 @@ DFPgetpal(const char *filename, void *palette)
     int32 length;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     if (!palette)
@@ -122,6 +125,7 @@ DFPgetpal(const char *filename, void *palette)
     ret_value = Hclose(file_id);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFPgetpal() */
 
@@ -153,6 +157,8 @@ DFPputpal(const char *filename, const void *palette, intn overwrite, const char
     int32 file_id;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     if (!palette)
@@ -188,6 +194,7 @@ DFPputpal(const char *filename, const void *palette, intn overwrite, const char
     ret_value = (Hclose(file_id));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFPputpal() */
 
@@ -212,8 +219,11 @@ DFPaddpal(const char *filename, const void *palette)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFPputpal(filename, palette, 0, "a"));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFPaddpal() */
 
@@ -245,6 +255,8 @@ DFPnpals(const char *filename)
     intn   i, j;               /* local counting variable */
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* should use reopen if same file as last time - more efficient */
@@ -315,6 +327,7 @@ DFPnpals(const char *filename)
     ret_value = npals;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFPnpals() */
 
@@ -342,6 +355,8 @@ DFPreadref(const char *filename, uint16 ref)
     int32 aid;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     if ((file_id = DFPIopen(filename, DFACC_READ)) == FAIL)
@@ -362,6 +377,7 @@ DFPreadref(const char *filename, uint16 ref)
     ret_value = (Hclose(file_id));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFPreadref() */
 
@@ -387,10 +403,13 @@ DFPwriteref(const char *filename, uint16 ref)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     (void)filename;
 
     Writeref = ref;
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFPwriteref() */
 
@@ -414,8 +433,11 @@ DFPrestart(void)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     Lastfile[0] = '\0';
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFPrestart() */
 
@@ -439,8 +461,11 @@ DFPlastref(void)
 {
     uint16 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = Lastref;
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFPlastref() */
 
@@ -42,6 +42,7 @@
 
 #include "hdfi.h"
 #include "dfrig.h"
+#include "hthread.h"
 
 /* Private Variables */
 static uint8 *paletteBuf = NULL;
@@ -163,6 +164,8 @@ DFR8setcompress(int32 type, comp_info *cinfo)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFR8Istart() == FAIL)
@@ -186,6 +189,7 @@ DFR8setcompress(int32 type, comp_info *cinfo)
     CompInfo = (*cinfo);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8setcompress() */
 
@@ -217,6 +221,8 @@ DFR8getdims(const char *filename, int32 *pxdim, int32 *pydim, intn *pispal)
     int32 file_id   = (-1);
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     if (!filename || !*filename || !pxdim || !pydim)
@@ -243,6 +249,7 @@ done:
     if (file_id != (-1))
         Hclose(file_id);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8getdims() */
 
@@ -280,6 +287,8 @@ DFR8getimage(const char *filename, uint8 *image, int32 xdim, int32 ydim, uint8 *
     int32 file_id   = (-1);
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     if (!filename || !*filename || !image || (xdim <= 0) || (ydim <= 0))
@@ -341,6 +350,7 @@ done:
             Hclose(file_id);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8getimage() */
 
@@ -369,6 +379,8 @@ DFR8setpalette(uint8 *pal)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFR8Istart() == FAIL)
@@ -394,6 +406,7 @@ DFR8setpalette(uint8 *pal)
     } /* end else */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8setpalette() */
 
@@ -589,6 +602,8 @@ DFR8putimage(const char *filename, const void *image, int32 xdim, int32 ydim, ui
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFR8Istart() == FAIL)
@@ -597,6 +612,7 @@ DFR8putimage(const char *filename, const void *image, int32 xdim, int32 ydim, ui
     ret_value = (DFR8Iputimage(filename, image, xdim, ydim, compress, 0));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8putimage() */
 
@@ -628,6 +644,8 @@ DFR8addimage(const char *filename, const void *image, int32 xdim, int32 ydim, ui
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFR8Istart() == FAIL)
@@ -636,6 +654,7 @@ DFR8addimage(const char *filename, const void *image, int32 xdim, int32 ydim, ui
     ret_value = (DFR8Iputimage(filename, image, xdim, ydim, compress, 1));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8addimage() */
 
@@ -885,6 +904,8 @@ DFR8nimages(const char *filename)
     intn   i, j;               /* local counting variable */
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1005,6 +1026,7 @@ DFR8nimages(const char *filename)
     ret_value = nimages;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8nimages() */
 
@@ -1033,6 +1055,8 @@ DFR8readref(const char *filename, uint16 ref)
     int32 aid;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1059,6 +1083,7 @@ done:
             Hclose(file_id);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8readref() */
 
@@ -1084,6 +1109,8 @@ DFR8writeref(const char *filename, uint16 ref)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     (void)filename;
 
     HEclear();
@@ -1096,6 +1123,7 @@ DFR8writeref(const char *filename, uint16 ref)
     Writeref = ref;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8writeref() */
 
@@ -1119,6 +1147,8 @@ DFR8restart(void)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFR8Istart() == FAIL)
@@ -1127,6 +1157,7 @@ DFR8restart(void)
     Lastfile[0] = '\0';
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8restart() */
 
@@ -1150,6 +1181,8 @@ DFR8lastref(void)
 {
     uint16 ret_value;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFR8Istart() == FAIL)
@@ -1158,6 +1191,7 @@ DFR8lastref(void)
     ret_value = Lastref;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8lastref() */
 
@@ -1176,6 +1210,8 @@ DFR8getpalref(uint16 *pal_ref)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1186,6 +1222,7 @@ DFR8getpalref(uint16 *pal_ref)
     *pal_ref = Readrig.lut.ref; /* ref of palette */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end DFR8getpalref() */
 
@@ -1453,8 +1490,11 @@ done:
 intn
 DFR8Pshutdown(void)
 {
+    H4_API_LOCK;
+
     free(paletteBuf);
     paletteBuf = NULL;
 
+    H4_API_UNLOCK;
     return SUCCEED;
 } /* end DFR8Pshutdown() */
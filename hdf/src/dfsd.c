@@ -91,6 +91,7 @@ Fortran stub functions:
 
 #include "hdfi.h"
 #include "dfsd.h"
+#include "hthread.h"
 
 /* MMM: make this definition correct and move to hfile.h, or wherever. */
 #define DF_NOFILE 0
@@ -238,6 +239,8 @@ DFSDgetdims(const char *filename, intn *prank, int32 sizes[], intn maxrank)
     int32 file_id;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear(); /* Clear error stack */
 
     /* Perform global, one-time initialization */
@@ -271,6 +274,7 @@ DFSDgetdims(const char *filename, intn *prank, int32 sizes[], intn maxrank)
     ret_value = Hclose(file_id);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -300,6 +304,8 @@ DFSDgetdatastrs(char *label, char *unit, char *format, char *coordsys)
     char *lufp;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear(); /* Clear error stack */
 
     /* Perform global, one-time initialization */
@@ -333,6 +339,7 @@ DFSDgetdatastrs(char *label, char *unit, char *format, char *coordsys)
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -364,6 +371,8 @@ DFSDgetdimstrs(int dim, char *label, char *unit, char *format)
     char *lufp;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear(); /* Clear error stack */
 
     /* Perform global, one-time initialization */
@@ -398,6 +407,7 @@ DFSDgetdimstrs(int dim, char *label, char *unit, char *format)
     }     /* end for 'luf' */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -425,6 +435,8 @@ DFSDgetdatalen(intn *llabel, intn *lunit, intn *lformat, intn *lcoordsys)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear(); /* Clear error stack */
 
     /* Perform global, one-time initialization */
@@ -441,6 +453,7 @@ DFSDgetdatalen(intn *llabel, intn *lunit, intn *lformat, intn *lcoordsys)
     *lcoordsys = (intn)(Readsdg.coordsys ? strlen(Readsdg.coordsys) : 0);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -466,6 +479,8 @@ DFSDgetdimlen(intn dim, intn *llabel, intn *lunit, intn *lformat)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear(); /* Clear error stack */
 
     /* Perform global, one-time initialization */
@@ -484,6 +499,7 @@ DFSDgetdimlen(intn dim, intn *llabel, intn *lunit, intn *lformat)
     *lformat = (intn)(Readsdg.dimluf[FORMAT][dim - 1] ? strlen(Readsdg.dimluf[FORMAT][dim - 1]) : 0);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -514,6 +530,8 @@ DFSDgetdimscale(intn dim, int32 maxsize, void *scale)
     uint8 *p1, *p2;
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear(); /* Clear error stack */
 
     /* Perform global, one-time initialization */
@@ -550,6 +568,7 @@ DFSDgetdimscale(intn dim, int32 maxsize, void *scale)
     memcpy(p1, p2, dimsize);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -586,6 +605,8 @@ DFSDgetrange(void *pmax, void *pmin)
     uint8 *p1, *p2;
     int    ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear(); /* Clear error stack */
 
     /* Perform global, one-time initialization */
@@ -615,6 +636,7 @@ DFSDgetrange(void *pmax, void *pmin)
         HGOTO_ERROR(DFE_NOVALS, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -654,8 +676,11 @@ DFSDgetdata(const char *filename, intn rank, int32 maxsizes[], void *data)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFSDIgetdata(filename, rank, maxsizes, data, 0)); /* 0 == C */
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -683,6 +708,8 @@ DFSDsetlengths(intn maxlen_label, intn maxlen_unit, intn maxlen_format, intn max
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFSDIstart() == FAIL)
@@ -698,6 +725,7 @@ DFSDsetlengths(intn maxlen_label, intn maxlen_unit, intn maxlen_format, intn max
         Maxstrlen[COORDSYS] = maxlen_coordsys;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -725,6 +753,8 @@ DFSDsetdims(intn rank, int32 dimsizes[])
     intn i;
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -778,6 +808,7 @@ DFSDsetdims(intn rank, int32 dimsizes[])
     Writeref    = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -801,8 +832,11 @@ DFSDsetdatastrs(const char *label, const char *unit, const char *format, const c
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFSDIsetdatastrs(label, unit, format, coordsys));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -901,8 +935,11 @@ DFSDsetdimstrs(intn dim, const char *label, const char *unit, const char *format
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFSDIsetdimstrs(dim, label, unit, format));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* DFSDsetdimstrs */
 
@@ -1012,6 +1049,8 @@ DFSDsetdimscale(intn dim, int32 dimsize, void *scale)
     uint8 *p1, *p2;
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1086,6 +1125,7 @@ DFSDsetdimscale(intn dim, int32 dimsize, void *scale)
     Ref.scales = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1123,6 +1163,8 @@ DFSDsetrange(void *maxi, void *mini)
     uint8 *p1, *p2;
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1149,6 +1191,7 @@ DFSDsetrange(void *maxi, void *mini)
     Ref.maxmin = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1177,9 +1220,12 @@ DFSDputdata(const char *filename, intn rank, int32 dimsizes[], void *data)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     /* 0, 0 specify create mode, C style array (row major) */
     ret_value = (DFSDIputdata(filename, rank, dimsizes, data, 0, 0));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1212,9 +1258,12 @@ DFSDadddata(const char *filename, intn rank, int32 dimsizes[], void *data)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     /* 1, 0 specifies append mode, C style array (row major) */
     ret_value = (DFSDIputdata(filename, rank, dimsizes, data, 1, 0));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1234,6 +1283,8 @@ DFSDrestart(void)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFSDIstart() == FAIL)
@@ -1244,6 +1295,7 @@ DFSDrestart(void)
     Readref = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1269,6 +1321,8 @@ DFSDndatasets(char *filename)
     int32 nsdgs     = 0;
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1288,6 +1342,7 @@ DFSDndatasets(char *filename)
     ret_value = nsdgs;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1308,6 +1363,8 @@ DFSDclear(void)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFSDIstart() == FAIL)
@@ -1321,6 +1378,7 @@ DFSDclear(void)
     ret_value = DFSDIclear(&Writesdg);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1341,6 +1399,8 @@ DFSDlastref(void)
 {
     uint16 ret_value;
 
+    H4_API_LOCK;
+
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (DFSDIstart() == FAIL)
@@ -1349,6 +1409,7 @@ DFSDlastref(void)
     ret_value = (uint16)Lastref;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1379,6 +1440,8 @@ DFSDreadref(char *filename, uint16 ref)
     int32 aid;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1401,6 +1464,7 @@ DFSDreadref(char *filename, uint16 ref)
     ret_value = Hclose(file_id);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1445,8 +1509,11 @@ DFSDgetslice(const char *filename, int32 winst[], int32 windims[], void *data, i
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFSDIgetslice(filename, winst, windims, data, dims, 0));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1477,6 +1544,8 @@ DFSDstartslice(const char *filename)
     int32 size;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1520,6 +1589,7 @@ DFSDstartslice(const char *filename)
         Sddims[i] = 0; /* nothing written so far */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1558,8 +1628,11 @@ DFSDputslice(int32 winend[], void *data, int32 dims[])
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFSDIputslice(winend, data, dims, 0));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1587,8 +1660,11 @@ DFSDendslice(void)
 {
     intn ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (DFSDIendslice(0));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1624,6 +1700,8 @@ DFSDsetNT(int32 numbertype)
     uint8 outNT;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1649,6 +1727,7 @@ DFSDsetNT(int32 numbertype)
     ret_value = (DFKsetNT(numbertype));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1726,6 +1805,8 @@ DFSDgetNT(int32 *pnumbertype)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1738,6 +1819,7 @@ DFSDgetNT(int32 *pnumbertype)
         HGOTO_ERROR(DFE_BADNUMTYPE, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1771,6 +1853,8 @@ DFSDpre32sdg(char *filename, uint16 ref, intn *ispre32)
     DFnsdgle *ptr;
     intn      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -1806,6 +1890,7 @@ DFSDpre32sdg(char *filename, uint16 ref, intn *ispre32)
         ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end of DFSDpre32sdg   */
 
@@ -4175,6 +4260,8 @@ DFSDgetcal(float64 *pcal, float64 *pcal_err, float64 *pioff, float64 *pioff_err,
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -4197,6 +4284,7 @@ DFSDgetcal(float64 *pcal, float64 *pcal_err, float64 *pioff, float64 *pioff_err,
         HGOTO_ERROR(DFE_NOVALS, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* DFSDgetcal */
 
@@ -4243,6 +4331,8 @@ DFSDsetcal(float64 cal, float64 cal_err, float64 ioff, float64 ioff_err, int32 c
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Perform global, one-time initialization */
@@ -4259,6 +4349,7 @@ DFSDsetcal(float64 cal, float64 cal_err, float64 ioff, float64 ioff_err, int32 c
     Ref.cal = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -4284,6 +4375,8 @@ DFSDwriteref(const char *filename, uint16 ref)
     int32 aid;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -4323,6 +4416,7 @@ DFSDwriteref(const char *filename, uint16 ref)
     ret_value = Hclose(file_id);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -4353,6 +4447,8 @@ DFSDsetfillvalue(void *fill_value)
     uint32 localNTsize; /* size of this NT on as it is on this machine  */
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack  */
     HEclear();
 
@@ -4379,6 +4475,7 @@ DFSDsetfillvalue(void *fill_value)
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -4405,6 +4502,8 @@ DFSDgetfillvalue(void *fill_value)
     uint32 localNTsize; /* size of this NT on as it is on this machine  */
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack  */
     HEclear();
 
@@ -4428,6 +4527,7 @@ DFSDgetfillvalue(void *fill_value)
         ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -4470,10 +4570,13 @@ DFSDreadslab(const char *filename, int32 start[], int32 slab_size[], int32 strid
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     (void)stride;
 
     ret_value = (DFSDgetslice(filename, start, slab_size, buffer, buffer_size));
 
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -4507,6 +4610,8 @@ DFSDstartslab(const char *filename)
     uint8  outNT; /* file number type subclass */
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear errors */
     HEclear();
 
@@ -4616,6 +4721,7 @@ DFSDstartslab(const char *filename)
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -4680,6 +4786,8 @@ DFSDwriteslab(int32 start[], int32 stride[], int32 count[], void *data)
                             /*   of current block */
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     (void)stride;
 
     /* Clear error stack  */
@@ -4894,6 +5002,7 @@ DFSDwriteslab(int32 start[], int32 stride[], int32 count[], void *data)
         ret_value = SUCCEED;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -4916,6 +5025,8 @@ DFSDendslab(void)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -4966,6 +5077,7 @@ DFSDendslab(void)
     Writeref  = 0;                /* Reset Write ref */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -5021,6 +5133,8 @@ done:
 intn
 DFSDPshutdown(void)
 {
+    H4_API_LOCK;
+
     DFSDIclear(&Readsdg);
     DFSDIclear(&Writesdg);
 
@@ -5049,5 +5163,6 @@ DFSDPshutdown(void)
     free(Lastfile);
     Lastfile = NULL;
 
+    H4_API_UNLOCK;
     return SUCCEED;
 } /* end DFSDPshutdown() */
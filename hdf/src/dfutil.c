@@ -25,6 +25,7 @@
  *--------------------------------------------------------------------------*/
 
 #include "hdfi.h"
+#include "hthread.h"
 
 /*-----------------------------------------------------------------------------
  * Name:    DFfindnextref
@@ -44,25 +45,32 @@ DFfindnextref(int32 file_id, uint16 tag, uint16 lref)
 {
     uint16 newtag = DFTAG_NULL, newref = DFTAG_NULL;
     int32  aid;
+    uint16 ret_value = (uint16)FAIL;
+
+    H4_API_LOCK;
 
     HEclear();
 
     if (!HDvalidfid(file_id)) {
         HERROR(DFE_ARGS);
-        return (uint16)FAIL;
+        HGOTO_DONE((uint16)FAIL);
     }
 
     aid = Hstartread(file_id, tag, lref);
     if (aid == FAIL)
-        return (uint16)FAIL;
+        HGOTO_DONE((uint16)FAIL);
 
     if (lref != DFREF_WILDCARD)
         if (Hnextread(aid, tag, DFREF_WILDCARD, DF_CURRENT) == FAIL)
-            return (uint16)FAIL;
+            HGOTO_DONE((uint16)FAIL);
 
     if (HQuerytagref(aid, &newtag, &newref) == FAIL)
-        return (uint16)FAIL;
+        HGOTO_DONE((uint16)FAIL);
 
     Hendaccess(aid);
-    return newref;
+    ret_value = newref;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 }
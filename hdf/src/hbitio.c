@@ -38,6 +38,7 @@ LOCAL ROUTINES
 
 #include "hdfi.h"
 #include "hfile.h"
+#include "hthread.h"
 
 /* Local Variables */
 
@@ -89,27 +90,29 @@ Hstartbitread(int32 file_id, uint16 tag, uint16 ref)
     struct bitrec_t *bitfile_rec; /* Pointer to the bitfile record */
     int32            ret_value;   /* return bit ID */
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (HIbitstart() == FAIL)
-            HRETURN_ERROR(DFE_CANTINIT, FAIL);
+            HGOTO_ERROR(DFE_CANTINIT, FAIL);
 
     /* Try to get an AID */
     if ((aid = Hstartread(file_id, tag, ref)) == FAIL)
-        HRETURN_ERROR(DFE_BADAID, FAIL);
+        HGOTO_ERROR(DFE_BADAID, FAIL);
 
     /* get a slot in the access record array */
     if ((bitfile_rec = HIget_bitfile_rec()) == NULL)
-        HRETURN_ERROR(DFE_TOOMANY, FAIL);
+        HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
     bitfile_rec->acc_id = aid;
     ret_value           = HAregister_atom(BITIDGROUP, bitfile_rec);
     bitfile_rec->bit_id = ret_value;
     if (HQuerylength(aid, &bitfile_rec->max_offset) == FAIL)
-        HRETURN_ERROR(DFE_INTERNAL, FAIL);
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
     bitfile_rec->byte_offset = 0;
 
     bitfile_rec->access = 'r';
@@ -123,7 +126,7 @@ Hstartbitread(int32 file_id, uint16 tag, uint16 ref)
 
         read_size = MIN((bitfile_rec->max_offset - bitfile_rec->byte_offset), BITBUF_SIZE);
         if ((n = Hread(bitfile_rec->acc_id, read_size, bitfile_rec->bytea)) == FAIL)
-            return FAIL;                            /* EOF? somebody pulled the rug out from under us! */
+            HGOTO_DONE(FAIL);                       /* EOF? somebody pulled the rug out from under us! */
         bitfile_rec->buf_read = (intn)n;            /* keep track of the number of bytes in buffer */
         bitfile_rec->bytep    = bitfile_rec->bytea; /* set to the beginning of the buffer */
     }                                               /* end if */
@@ -134,6 +137,8 @@ Hstartbitread(int32 file_id, uint16 tag, uint16 ref)
     bitfile_rec->block_offset = 0;
     bitfile_rec->count        = 0;
 
+done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hstartbitread() */
 
@@ -166,23 +171,25 @@ Hstartbitwrite(int32 file_id, uint16 tag, uint16 ref, int32 length)
     intn      exists;      /* whether dataset exists already */
     int32     ret_value;   /* return bit ID */
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
 
     /* Perform global, one-time initialization */
     if (library_terminate == FALSE)
         if (HIbitstart() == FAIL)
-            HRETURN_ERROR(DFE_CANTINIT, FAIL);
+            HGOTO_ERROR(DFE_CANTINIT, FAIL);
 
     exists = (Hexist(file_id, tag, ref) == SUCCEED) ? TRUE : FALSE;
 
     /* Try to get an AID */
     if ((aid = Hstartwrite(file_id, tag, ref, length)) == FAIL)
-        HRETURN_ERROR(DFE_BADAID, FAIL);
+        HGOTO_ERROR(DFE_BADAID, FAIL);
 
     /* get empty slot in bit-access records */
     if ((bitfile_rec = HIget_bitfile_rec()) == NULL)
-        HRETURN_ERROR(DFE_TOOMANY, FAIL);
+        HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
     bitfile_rec->acc_id       = aid;
     ret_value                 = HAregister_atom(BITIDGROUP, bitfile_rec);
@@ -191,7 +198,7 @@ Hstartbitwrite(int32 file_id, uint16 tag, uint16 ref, int32 length)
     bitfile_rec->block_offset = 0;
     if (exists == TRUE) {
         if (HQuerylength(aid, &bitfile_rec->max_offset) == FAIL)
-            HRETURN_ERROR(DFE_INTERNAL, FAIL);
+            HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
         /* pre-read the first block into the buffer */
         if (bitfile_rec->max_offset > bitfile_rec->byte_offset) {
@@ -200,10 +207,10 @@ Hstartbitwrite(int32 file_id, uint16 tag, uint16 ref, int32 length)
 
             read_size = MIN((bitfile_rec->max_offset - bitfile_rec->byte_offset), BITBUF_SIZE);
             if ((n = Hread(bitfile_rec->acc_id, read_size, bitfile_rec->bytea)) == FAIL)
-                HRETURN_ERROR(DFE_READERROR, FAIL); /* EOF? somebody pulled the rug out from under us! */
+                HGOTO_ERROR(DFE_READERROR, FAIL);   /* EOF? somebody pulled the rug out from under us! */
             bitfile_rec->buf_read = (intn)n;        /* keep track of the number of bytes in buffer */
             if (Hseek(bitfile_rec->acc_id, bitfile_rec->block_offset, DF_START) == FAIL)
-                HRETURN_ERROR(DFE_SEEKERROR, FAIL);
+                HGOTO_ERROR(DFE_SEEKERROR, FAIL);
         } /* end if */
     }     /* end if */
     else {
@@ -217,6 +224,8 @@ Hstartbitwrite(int32 file_id, uint16 tag, uint16 ref, int32 length)
     bitfile_rec->count  = BITNUM;
     bitfile_rec->bits   = 0;
 
+done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hstartbitwrite() */
 
@@ -243,20 +252,26 @@ intn
 Hbitappendable(int32 bitid)
 {
     bitrec_t *bitfile_rec; /* access record */
+    intn     ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     /* clear error stack and check validity of file id */
     HEclear();
 
     if ((bitfile_rec = HAatom_object(bitid)) == NULL)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* Check for write access */
     if (bitfile_rec->access != 'w')
-        HRETURN_ERROR(DFE_BADACC, FAIL);
+        HGOTO_ERROR(DFE_BADACC, FAIL);
 
     if (Happendable(bitfile_rec->acc_id) == FAIL)
-        HRETURN_ERROR(DFE_NOTENOUGH, FAIL);
-    return SUCCEED;
+        HGOTO_ERROR(DFE_NOTENOUGH, FAIL);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* end Hbitappendable() */
 
 /*--------------------------------------------------------------------------
@@ -284,29 +299,32 @@ Hbitappendable(int32 bitid)
 intn
 Hbitwrite(int32 bitid, intn count, uint32 data)
 {
-    static int32     last_bit_id = (-1);  /* the bit ID of the last bitfile_record accessed */
-    static bitrec_t *bitfile_rec = NULL;  /* access record */
-    intn             orig_count  = count; /* keep track of orig, number of bits to output */
+    static H4_THREAD_LOCAL int32     last_bit_id = (-1);  /* the bit ID of the last bitfile_record accessed */
+    static H4_THREAD_LOCAL bitrec_t *bitfile_rec = NULL;  /* access record */
+    intn                             orig_count  = count; /* keep track of orig, number of bits to output */
+    intn                             ret_value   = SUCCEED;
+
+    H4_API_LOCK;
 
     /* clear error stack and check validity of file id */
     HEclear();
 
     if (count <= 0)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* cache the bitfile_record since this routine gets called so many times */
     if (bitid != last_bit_id) {
-        /* This needs a mutex semaphore when we go to a multi-threaded version of the library -QAK */
+        /* The cache is per thread, SD coders call in here under a shared lock */
         bitfile_rec = HAatom_object(bitid);
         last_bit_id = bitid;
     } /* end if */
 
     if (bitfile_rec == NULL)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* Check for write access */
     if (bitfile_rec->access != 'w')
-        HRETURN_ERROR(DFE_BADACC, FAIL);
+        HGOTO_ERROR(DFE_BADACC, FAIL);
 
     if (count > (intn)DATANUM)
         count = (intn)DATANUM;
@@ -321,7 +339,7 @@ Hbitwrite(int32 bitid, intn count, uint32 data)
     /* merge the new bits into the current bits buffer */
     if (count < bitfile_rec->count) {
         bitfile_rec->bits |= (uint8)(data << (bitfile_rec->count -= count));
-        return orig_count;
+        HGOTO_DONE(orig_count);
     } /* end if */
 
     /* fill up the current bits buffer and output the byte */
@@ -333,7 +351,7 @@ Hbitwrite(int32 bitid, intn count, uint32 data)
         write_size         = bitfile_rec->bytez - bitfile_rec->bytea;
         bitfile_rec->bytep = bitfile_rec->bytea;
         if (Hwrite(bitfile_rec->acc_id, write_size, bitfile_rec->bytea) == FAIL)
-            HRETURN_ERROR(DFE_WRITEERROR, FAIL);
+            HGOTO_ERROR(DFE_WRITEERROR, FAIL);
         bitfile_rec->block_offset += write_size;
 
         /* check if we should pre-read the next block into the buffer */
@@ -343,10 +361,10 @@ Hbitwrite(int32 bitid, intn count, uint32 data)
 
             read_size = MIN((bitfile_rec->max_offset - bitfile_rec->byte_offset), BITBUF_SIZE);
             if ((n = Hread(bitfile_rec->acc_id, read_size, bitfile_rec->bytea)) == FAIL)
-                HRETURN_ERROR(DFE_READERROR, FAIL); /* EOF? somebody pulled the rug out from under us! */
+                HGOTO_ERROR(DFE_READERROR, FAIL);   /* EOF? somebody pulled the rug out from under us! */
             bitfile_rec->buf_read = n;              /* keep track of the number of bytes in buffer */
             if (Hseek(bitfile_rec->acc_id, bitfile_rec->block_offset, DF_START) == FAIL)
-                HRETURN_ERROR(DFE_SEEKERROR, FAIL);
+                HGOTO_ERROR(DFE_SEEKERROR, FAIL);
         } /* end if */
     }     /* end if */
 
@@ -360,7 +378,7 @@ Hbitwrite(int32 bitid, intn count, uint32 data)
             write_size         = bitfile_rec->bytez - bitfile_rec->bytea;
             bitfile_rec->bytep = bitfile_rec->bytea;
             if (Hwrite(bitfile_rec->acc_id, write_size, bitfile_rec->bytea) == FAIL)
-                HRETURN_ERROR(DFE_WRITEERROR, FAIL);
+                HGOTO_ERROR(DFE_WRITEERROR, FAIL);
             bitfile_rec->block_offset += write_size;
 
             /* check if we should pre-read the next block into the buffer */
@@ -370,10 +388,10 @@ Hbitwrite(int32 bitid, intn count, uint32 data)
 
                 read_size = MIN((bitfile_rec->max_offset - bitfile_rec->byte_offset), BITBUF_SIZE);
                 if ((n = Hread(bitfile_rec->acc_id, read_size, bitfile_rec->bytea)) == FAIL)
-                    HRETURN_ERROR(DFE_READERROR, FAIL); /* EOF? somebody pulled the rug out from under us! */
+                    HGOTO_ERROR(DFE_READERROR, FAIL);   /* EOF? somebody pulled the rug out from under us! */
                 bitfile_rec->buf_read = n;              /* keep track of the number of bytes in buffer */
                 if (Hseek(bitfile_rec->acc_id, bitfile_rec->block_offset, DF_START) == FAIL)
-                    HRETURN_ERROR(DFE_SEEKERROR, FAIL);
+                    HGOTO_ERROR(DFE_SEEKERROR, FAIL);
             } /* end if */
         }     /* end if */
     }         /* end while */
@@ -386,7 +404,11 @@ Hbitwrite(int32 bitid, intn count, uint32 data)
     if (bitfile_rec->byte_offset > bitfile_rec->max_offset)
         bitfile_rec->max_offset = bitfile_rec->byte_offset;
 
-    return orig_count;
+    ret_value = orig_count;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* end Hbitwrite() */
 
 /*--------------------------------------------------------------------------
@@ -415,28 +437,31 @@ Hbitwrite(int32 bitid, intn count, uint32 data)
 intn
 Hbitread(int32 bitid, intn count, uint32 *data)
 {
-    static int32     last_bit_id = (-1); /* the bit ID of the last bitfile_record accessed */
-    static bitrec_t *bitfile_rec = NULL; /* access record */
-    uint32           l;
-    uint32           b = 0;      /* bits to return */
-    intn             orig_count; /* the original number of bits to read in */
-    int32            n;
+    static H4_THREAD_LOCAL int32     last_bit_id = (-1); /* the bit ID of the last bitfile_record accessed */
+    static H4_THREAD_LOCAL bitrec_t *bitfile_rec = NULL; /* access record */
+    uint32                           l;
+    uint32                           b = 0;      /* bits to return */
+    intn                             orig_count; /* the original number of bits to read in */
+    int32                            n;
+    intn                             ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     /* clear error stack and check validity of file id */
     HEclear();
 
     if (count <= 0)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* cache the bitfile_record since this routine gets called so many times */
     if (bitid != last_bit_id) {
-        /* This needs a mutex semaphore when we go to a multi-threaded version of the library -QAK */
+        /* The cache is per thread, SD coders call in here under a shared lock */
         bitfile_rec = HAatom_object(bitid);
         last_bit_id = bitid;
     } /* end if */
 
     if (bitfile_rec == NULL)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* Check for write access */
     /* change bitfile modes if necessary */
@@ -450,7 +475,7 @@ Hbitread(int32 bitid, intn count, uint32 *data)
     /* buffered bits then do the shift and return */
     if (count <= bitfile_rec->count) {
         *data = (uint32)((uintn)bitfile_rec->bits >> (bitfile_rec->count -= count)) & (uint32)maskc[count];
-        return count;
+        HGOTO_DONE(count);
     } /* end if */
 
     /* keep track of the original number of bits to read in */
@@ -470,7 +495,7 @@ Hbitread(int32 bitid, intn count, uint32 *data)
                 bitfile_rec->count =
                     0;     /* make certain that we don't try to access the file->bits information */
                 *data = b; /* assign the bits read in */
-                return orig_count - count; /* break out now */
+                HGOTO_DONE(orig_count - count); /* break out now */
             }                              /* end if */
             bitfile_rec->block_offset +=
                 bitfile_rec->buf_read; /* keep track of the number of bytes in buffer */
@@ -492,7 +517,7 @@ Hbitread(int32 bitid, intn count, uint32 *data)
                 bitfile_rec->count =
                     0;     /* make certain that we don't try to access the file->bits information */
                 *data = b; /* assign the bits read in */
-                return orig_count - count; /* return now */
+                HGOTO_DONE(orig_count - count); /* return now */
             }                              /* end if */
             bitfile_rec->block_offset +=
                 bitfile_rec->buf_read; /* keep track of the number of bytes in buffer */
@@ -510,7 +535,11 @@ Hbitread(int32 bitid, intn count, uint32 *data)
         bitfile_rec->count = 0;
 
     *data = b;
-    return orig_count;
+    ret_value = orig_count;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* end Hbitread() */
 
 /*--------------------------------------------------------------------------
@@ -545,13 +574,16 @@ Hbitseek(int32 bitid, int32 byte_offset, intn bit_offset)
     int32     read_size;   /* number of bytes to read into buffer */
     int32     n;           /* number of bytes actually read */
     intn      new_block;   /* whether to move to another block in the dataset */
+    intn      ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     /* clear error stack and check validity of file id */
     HEclear();
 
     if (byte_offset < 0 || bit_offset < 0 || bit_offset > ((intn)BITNUM - 1) ||
         (bitfile_rec = HAatom_object(bitid)) == NULL || byte_offset > bitfile_rec->max_offset)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* determine whether we need to seek to another block in the file */
     new_block =
@@ -560,22 +592,22 @@ Hbitseek(int32 bitid, int32 byte_offset, intn bit_offset)
             : FALSE;
     if (bitfile_rec->mode == 'w')
         if (HIbitflush(bitfile_rec, -1, new_block) == FAIL) /* flush, but merge */
-            HRETURN_ERROR(DFE_WRITEERROR, FAIL);
+            HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
     if (new_block == TRUE) {
         seek_pos = (byte_offset / BITBUF_SIZE) * BITBUF_SIZE;
         if (Hseek(bitfile_rec->acc_id, seek_pos, DF_START) == FAIL)
-            HRETURN_ERROR(DFE_SEEKERROR, FAIL);
+            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
 
         read_size = MIN((bitfile_rec->max_offset - seek_pos), BITBUF_SIZE);
         if ((n = Hread(bitfile_rec->acc_id, read_size, bitfile_rec->bytea)) == FAIL)
-            HRETURN_ERROR(DFE_READERROR, FAIL); /* EOF? somebody pulled the rug out from under us! */
+            HGOTO_ERROR(DFE_READERROR, FAIL);   /* EOF? somebody pulled the rug out from under us! */
         bitfile_rec->bytez        = n + (bitfile_rec->bytep = bitfile_rec->bytea);
         bitfile_rec->buf_read     = n; /* keep track of the number of bytes in buffer */
         bitfile_rec->block_offset = seek_pos;
         if (bitfile_rec->mode == 'w') /* if writing, return the file offset to it's original position */
             if (Hseek(bitfile_rec->acc_id, seek_pos, DF_START) == FAIL)
-                HRETURN_ERROR(DFE_SEEKERROR, FAIL);
+                HGOTO_ERROR(DFE_SEEKERROR, FAIL);
     } /* end if */
 
     bitfile_rec->byte_offset = byte_offset;
@@ -602,7 +634,9 @@ Hbitseek(int32 bitid, int32 byte_offset, intn bit_offset)
         } /* end else */
     }     /* end else */
 
-    return SUCCEED;
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* end Hbitseek() */
 
 /*--------------------------------------------------------------------------
@@ -626,10 +660,17 @@ intn
 Hgetbit(int32 bitid)
 {
     uint32 data;
+    intn   ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     if (Hbitread(bitid, 1, &data) == FAIL)
-        HRETURN_ERROR(DFE_BITREAD, FAIL);
-    return (intn)data;
+        HGOTO_ERROR(DFE_BITREAD, FAIL);
+    ret_value = (intn)data;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* end Hgetbit() */
 
 /*--------------------------------------------------------------------------
@@ -661,24 +702,29 @@ int32
 Hendbitaccess(int32 bitfile_id, intn flushbit)
 {
     bitrec_t *bitfile_rec; /* bitfile record */
+    int32    ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     /* check validity of access id */
     bitfile_rec = HAatom_object(bitfile_id);
     if (bitfile_rec == NULL)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     if (bitfile_rec->mode == 'w')
         if (HIbitflush(bitfile_rec, flushbit, TRUE) == FAIL)
-            HRETURN_ERROR(DFE_WRITEERROR, FAIL);
+            HGOTO_ERROR(DFE_WRITEERROR, FAIL);
     free(bitfile_rec->bytea); /* free the space for the buffer */
 
     if (HAremove_atom(bitfile_id) == NULL)
-        HRETURN_ERROR(DFE_WRITEERROR, FAIL);
+        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
     if (Hendaccess(bitfile_rec->acc_id) == FAIL)
-        HRETURN_ERROR(DFE_CANTENDACCESS, FAIL);
+        HGOTO_ERROR(DFE_CANTENDACCESS, FAIL);
     free(bitfile_rec);
 
-    return SUCCEED;
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* end Hendbitaccess() */
 
 /*--------------------------------------------------------------------------
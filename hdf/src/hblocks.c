@@ -120,6 +120,7 @@ LOCAL ROUTINES
 
 #include "hdfi.h"
 #include "hfile.h"
+#include "hthread.h"
 
 /* block_t - record of a linked block. contains the tag and ref of the
    data elt that forms the linked block */
@@ -207,6 +208,8 @@ HLcreate(int32 file_id, uint16 tag, uint16 ref, int32 block_length, int32 number
     uint8  local_ptbuf[16];
     int32  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and validate file record id */
     HEclear();
     file_rec = HAatom_object(file_id);
@@ -221,7 +224,7 @@ HLcreate(int32 file_id, uint16 tag, uint16 ref, int32 block_length, int32 number
         HGOTO_ERROR(DFE_DENIED, FAIL);
 
     /* get empty access record */
-    access_rec = HIget_access_rec();
+    access_rec = HIget_access_rec(file_rec);
     if (access_rec == NULL)
         HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
@@ -336,6 +339,7 @@ done:
             HIrelease_accrec_node(access_rec);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* HLcreate() */
 
@@ -395,6 +399,8 @@ HLconvert(int32 aid, int32 block_length, int32 number_blocks)
     int32  old_posn; /* position in the access element */
     intn   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -523,6 +529,7 @@ done:
         }
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end HLconvert() */
 
@@ -555,6 +562,8 @@ HDinqblockinfo(int32 aid, int32 *length, int32 *first_length, int32 *block_lengt
     accrec_t *arec;
     int       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
     if ((arec = HAatom_object(aid)) == (accrec_t *)NULL)
         HGOTO_ERROR(DFE_BADAID, FAIL);
@@ -572,6 +581,7 @@ HDinqblockinfo(int32 aid, int32 *length, int32 *first_length, int32 *block_lengt
         *number_blocks = ((linkinfo_t *)(arec->special_info))->number_blocks;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* HDinqblockinfo */
 
@@ -772,6 +782,8 @@ HLgetdatainfo(int32 file_id, uint8 *buf, /* IN: special header info */
     int  ii;
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     (void)start_block; /*not used */
     /* Clear error stack */
     HEclear();
@@ -883,6 +895,7 @@ done:
         free(link_info);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* HLgetdatainfo */
 
@@ -1716,6 +1729,8 @@ HLsetblockinfo(int32 aid,        /* access record id */
     accrec_t *access_rec; /* access record */
     intn      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1746,6 +1761,7 @@ HLsetblockinfo(int32 aid,        /* access record id */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end HLsetblockinfo */
 
@@ -1783,6 +1799,8 @@ HLgetblockinfo(int32  aid,        /* access record id */
     accrec_t *access_rec; /* access record */
     intn      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1797,5 +1815,6 @@ HLgetblockinfo(int32  aid,        /* access record id */
         *num_blocks = access_rec->num_blocks;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end HLgetblockinfo */
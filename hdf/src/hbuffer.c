@@ -47,6 +47,7 @@ EXPORTED ROUTINES
 
 #include "hdfi.h"
 #include "hfile.h"
+#include "hthread.h"
 
 /* extinfo_t -- external elt information structure */
 
@@ -97,13 +98,15 @@ HBconvert(int32 aid)
 {
     accrec_t  *access_rec = NULL;  /* access element record */
     accrec_t  *new_access_rec;     /* newly created access record */
-    accrec_t  *tmp_access_rec;     /* temp. access record */
+    filerec_t *file_rec;           /* file record */
     bufinfo_t *info;               /* information for the buffered element */
     uint16     data_tag, data_ref; /* tag/ref of the data we are checking */
     int32      data_off;           /* offset of the data we are checking */
     int32      data_len;           /* length of the data we are checking */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
     if ((access_rec = HAatom_object(aid)) == NULL) /* get the access_rec pointer */
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -156,7 +159,10 @@ HBconvert(int32 aid)
     } /* end if */
 
     /* get empty access record */
-    new_access_rec = HIget_access_rec();
+    file_rec = HAatom_object(access_rec->file_id);
+    if (BADFREC(file_rec))
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+    new_access_rec = HIget_access_rec(file_rec);
     if (new_access_rec == NULL)
         HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
@@ -167,9 +173,7 @@ HBconvert(int32 aid)
      * We "inherit" the appendable flag if it's set and ALLOW_BUFFER_GROW is
      * defined to support it.
      */
-    tmp_access_rec = new_access_rec->next; /* preserve free list pointer */
-    memcpy(new_access_rec, access_rec, sizeof(accrec_t));
-    new_access_rec->next = tmp_access_rec; /* restore free list pointer */
+    memcpy(new_access_rec, access_rec, sizeof(accrec_t)); /* same file, so same arena */
 
     /* Preserve the actual access record for the buffered element */
     info->buf_access_rec = new_access_rec; /* Access record of actual data on disk */
@@ -186,6 +190,7 @@ done:
     if (ret_value == FAIL) { /* Error condition cleanup */
     }                        /* end if */
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* HBconvert */
 
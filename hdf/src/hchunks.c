@@ -215,11 +215,17 @@ EXPORTED ROUTINES
    HMCPinfo        -- return info about a chunked element
    HMCPgetnumrecs  -- get the number of records in a chunked element
 
-   TBBT helper rotuines
-   -------------------
-   chkcompare      -- comprares 2 chunk records
-   chkfreekey      -- frees chunk key
-   chkdestroynode  -- destroys chunk record
+   Chunk table helper routines
+   ---------------------------
+   chkcompare       -- compares 2 chunk records
+   HMCIsort_table   -- switch the chunk table to a sorted one
+   HMCIsearch_table -- binary search the sorted chunk table
+   HMCIindex_table  -- index the chunk table by chunk number
+   HMCIread_table   -- read the whole chunk table into memory
+   HMCIfind_chunk   -- look a chunk up in the chunk table
+   HMCIadd_chunk    -- add a chunk to the chunk table
+   HMCIfree_table   -- free the chunk table
+   HMCIfile_pool    -- the chunk cache shared by the elements of a file
 
 LOCAL ROUTINES
 ==============
@@ -241,6 +247,15 @@ LOCAL ROUTINES
    Common Routine
    -------------
    HMCIstaccess -- set up AID to access a chunked element
+   HMCIprefetch -- read the chunks a read will need in one batch
+   HMCIprefetch_free -- drop the chunks read ahead
+   HMCIdecode   -- decompress a chunk read ahead, on a worker thread
+   HMCIwrite_record -- add the record of a new chunk to the chunk table
+   HMCIencode_queue -- keep a chunk paged out to be compressed later
+   HMCIencode_flush -- compress the chunks kept on worker threads and write them
+   HMCIencode   -- compress a chunk kept, on a worker thread
+   HMCIwhole_chunk -- tell whether a read covers the current chunk whole
+   HMCIread_whole -- copy a chunk covered whole by a read to the caller
 
    AUTHOR
    -------
@@ -258,9 +273,9 @@ LOCAL ROUTINES
 #include "mcache.h"
 #include "hchunks.h"
 
-#include "tbbt.h"
 #include "mcache.h"
 #include "hcomp.h"
+#include "hwpool.h"
 
 /* Define class, class version and name(partial) for chunk table i.e. Vdata */
 #define _HDF_CHK_TBL_NAME "_HDF_CHK_TBL_" /* 13 bytes */
@@ -296,10 +311,10 @@ typedef struct dim_rec_struct {
 /* Structure for each Chunk */
 typedef struct chunk_rec_struct {
     int32 chunk_number; /* chunk number from coordinates i.e. origin */
-    int32 chk_vnum;     /* chunk vdata record number i.e. position in table*/
+    int32 chk_vnum;     /* chunk record number i.e. position in table,
+                           also the index of its origin in 'chk_origins' */
 
     /* chunk record fields stored in Vdata Table */
-    int32 *origin;  /* origin -> position of chunk */
     uint16 chk_tag; /* DFTAG_CHUNK or another Chunked element? */
     uint16 chk_ref; /* reference number of this chunk */
 } CHUNK_REC, *CHUNK_REC_PTR;
@@ -339,21 +354,114 @@ typedef struct chunkinfo_t {
                                      to the other chunks */
     int32     *seek_pos_chunk;    /* position within the current chunk */
     int32     *seek_user_indices; /* user position within the element  */
-    TBBT_TREE *chk_tree;          /* TBBT tree of all accessed table entries
-                                     i.e. CHUNK_REC's read/written/modified */
     MCACHE *chk_cache;            /* chunk cache */
     int32   num_recs;             /* number of Table(Vdata) records */
+
+    /* chunk table of all accessed table entries i.e. CHUNK_REC's
+       read/written/modified, see HMCIfind_chunk() */
+    CHUNK_REC *chk_recs;    /* the chunk records */
+    int32     *chk_origins; /* their origins, 'ndims' for each record */
+    int32      nchunks;     /* number of chunk records */
+    int32      max_chunks;  /* number of chunk records there is room for */
+    int32     *chk_index;   /* position of each chunk number's record in
+                               'chk_recs', -1 if none, or NULL if 'chk_recs'
+                               is sorted by chunk number instead */
+    int32      index_size;  /* number of chunk numbers in 'chk_index' */
+
+    /* chunks read ahead of time by HMCPread, see HMCIprefetch() */
+    int32  pf_count;  /* number of chunks read ahead */
+    int32 *pf_chunks; /* their chunk numbers, -1 if the read failed */
+    uint8 *pf_data;   /* their data, one chunk after the other */
+
+    /* new chunks paged out by the cache to be compressed together, see
+       HMCIencode_queue() */
+    int32  enc_count;  /* number of chunks kept */
+    int32  enc_max;    /* most chunks to keep */
+    int32 *enc_chunks; /* their chunk numbers */
+    uint8 *enc_data;   /* their data, one chunk after the other */
 } chunkinfo_t;
 
+/* A chunk read ahead of time to be decompressed on a worker thread, see
+   HMCIprefetch() */
+typedef struct {
+    int32        chunk;      /* its index in the chunks read ahead */
+    int32        req;        /* the read of its compressed data */
+    comp_coder_t coder_type; /* its encoding */
+    uint8       *src;        /* its compressed data */
+    int32        src_len;    /* # of bytes of compressed data */
+    uint8       *dst;        /* buffer for the chunk */
+    int32        dst_len;    /* # of bytes in a chunk */
+} CHUNK_DECODE;
+
+/* A chunk paged out to be compressed on a worker thread, see
+   HMCIencode_flush() */
+typedef struct {
+    comp_coder_t coder_type; /* its encoding */
+    comp_info   *c_info;     /* information for the encoding */
+    uint8       *src;        /* its data */
+    int32        src_len;    /* # of bytes in a chunk */
+    uint8       *dst;        /* buffer for its compressed data */
+    int32        dst_len;    /* size of 'dst', then # of bytes of compressed data or FAIL */
+} CHUNK_ENCODE;
+
+/* The chunk numbers are looked up directly in the chunk index while they
+   are dense, i.e. below HMC_DENSE_MIN or HMC_DENSE_FACTOR times the number
+   of chunks; otherwise the chunk records are kept sorted and searched */
+#define HMC_DENSE_MIN    4096
+#define HMC_DENSE_FACTOR 4
+#define HMC_IS_DENSE(chunk_num, nchunks)                                                                   \
+    ((chunk_num) >= 0 &&                                                                                   \
+     ((chunk_num) < HMC_DENSE_MIN || ((chunk_num) - HMC_DENSE_MIN) / HMC_DENSE_FACTOR < (nchunks)))
+
+/* Most bytes of the chunk table read in one batch */
+#define HMC_TABLE_BATCH_BYTES (1024 * 1024)
+
+/* Most bytes and chunks HMCPread reads ahead in one batch */
+#define HMC_PREFETCH_BYTES  (8 * 1024 * 1024)
+#define HMC_PREFETCH_CHUNKS 256
+
+/* Most bytes and chunks paged out to be compressed together, unless more
+   are needed to keep all the threads busy */
+#define HMC_ENCODE_BYTES  (8 * 1024 * 1024)
+#define HMC_ENCODE_CHUNKS 256
+
 /* private functions */
 static int32 HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
                           int16     acc_mode /* IN: access mode */);
-/* tbbt.h helper routines */
-static intn chkcompare(void *k1, /* IN: first key */
-                       void *k2, /* IN: second key */
-                       intn  cmparg /* IN: not sure? */);
-static void chkfreekey(void *key /*IN: chunk key */);
-static void chkdestroynode(void *n /* IN: chunk record */);
+
+static int32 HMCIprefetch(accrec_t *access_rec, /* IN: access record of the read */
+                          int32     start,      /* IN: seek position of the whole read */
+                          int32     posn,       /* IN: seek position of the rest of the read */
+                          int32     length /* IN: number of bytes left to read */);
+static void  HMCIprefetch_free(chunkinfo_t *info /* IN: chunked element information record */);
+static intn  HMCIdecode(void *task /* IN: chunk to decompress */);
+static intn  HMCIwrite_record(accrec_t  *access_rec, /* IN: access record of the element */
+                             CHUNK_REC *chk_rec /* IN: record of the new chunk */);
+static intn  HMCIencode_queue(accrec_t   *access_rec, /* IN: access record of the element */
+                             int32       chunk_num,  /* IN: chunk number */
+                             const void *datap /* IN: data of the chunk */);
+static intn  HMCIencode_flush(accrec_t *access_rec /* IN: access record of the element */);
+static intn  HMCIencode(void *task /* IN: chunk to compress */);
+static intn  HMCIwhole_chunk(chunkinfo_t *info,  /* IN: chunked element information record */
+                            int32        start, /* IN: seek position of the read */
+                            int32        end,   /* IN: seek position of the end of the read */
+                            int32       *chunk_posn /* OUT: seek position of the chunk */);
+static intn  HMCIread_whole(accrec_t *access_rec, /* IN: access record of the read */
+                           int32     chunk_num,  /* IN: chunk number */
+                           intn      bypass,     /* IN: whether to keep the chunk out of the cache */
+                           uint8    *datap,      /* OUT: caller's buffer, at the chunk's first element */
+                           uint8   **scratch /* IN/OUT: buffer for a chunk kept out of the cache */);
+/* chunk table helper routines */
+static int        chkcompare(const void *k1, /* IN: first chunk record */
+                             const void *k2 /* IN: second chunk record */);
+static intn       HMCIread_table(chunkinfo_t *info, /* IN: chunked element information record */
+                                 int32        num_recs /* IN: number of table records */);
+static CHUNK_REC *HMCIfind_chunk(chunkinfo_t *info, /* IN: chunked element information record */
+                                 int32        chunk_num /* IN: chunk number */);
+static CHUNK_REC *HMCIadd_chunk(chunkinfo_t *info,     /* IN: chunked element information record */
+                                int32        chunk_num, /* IN: chunk number */
+                                const int32 *origin /* IN: origin of the chunk */);
+static void       HMCIfree_table(chunkinfo_t *info /* IN: chunked element information record */);
 
 static int32 HMCPstread(accrec_t *access_rec /* IN: access record to fill in */);
 
@@ -717,74 +825,326 @@ calculate_chunk_for_chunk(int32   *chunk_size,     /* OUT: chunk size for this c
 NAME
     chkcompare
 DESCRIPTION
-   Compares two chunk B-tree keys for equality.  Similar to memcmp.
+   Compares two chunk records by chunk number, then by record number, for
+   qsort()ing the chunk table.
+RETURNS
+   <0, 0 or >0, as for qsort()
+---------------------------------------------------------------------------*/
+static int
+chkcompare(const void *k1, /* IN: first chunk record */
+           const void *k2 /* IN: second chunk record */)
+{
+    const CHUNK_REC *c1 = (const CHUNK_REC *)k1;
+    const CHUNK_REC *c2 = (const CHUNK_REC *)k2;
+
+    if (c1->chunk_number != c2->chunk_number)
+        return (c1->chunk_number > c2->chunk_number) ? 1 : -1;
+    return (c1->chk_vnum > c2->chk_vnum) - (c1->chk_vnum < c2->chk_vnum);
+} /* chkcompare */
+
+/********* Helper fcns for dealing with the chunk table ***************/
+
+/* -------------------------------------------------------------------------
+NAME
+    HMCIsort_table -- switch the chunk table to a sorted one
+DESCRIPTION
+   Sorts the chunk records by chunk number and drops the direct index,
+   once the chunk numbers are too sparse for it.
+RETURNS
+   Nothing
+---------------------------------------------------------------------------*/
+static void
+HMCIsort_table(chunkinfo_t *info /* IN: chunked element information record */)
+{
+    qsort(info->chk_recs, (size_t)info->nchunks, sizeof(CHUNK_REC), chkcompare);
+    free(info->chk_index);
+    info->chk_index  = NULL;
+    info->index_size = 0;
+} /* HMCIsort_table */
 
-   *** Only called by B-tree routines, should _not_ be called externally ***
+/* -------------------------------------------------------------------------
+NAME
+    HMCIsearch_table -- binary search the sorted chunk table
+DESCRIPTION
+   Finds the position of the first record of the sorted chunk table whose
+   chunk number is not below 'chunk_num'.
 RETURNS
+   The position, 'nchunks' if all the chunk numbers are below it
+---------------------------------------------------------------------------*/
+static int32
+HMCIsearch_table(chunkinfo_t *info, /* IN: chunked element information record */
+                 int32        chunk_num /* IN: chunk number */)
+{
+    int32 lo = 0, hi = info->nchunks;
 
-AUTHOR
-   -GeorgeV - 9/3/96
+    while (lo < hi) {
+        int32 mid = lo + (hi - lo) / 2;
+
+        if (info->chk_recs[mid].chunk_number < chunk_num)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+} /* HMCIsearch_table */
+
+/* -------------------------------------------------------------------------
+NAME
+    HMCIindex_table -- index the chunk table by chunk number
+DESCRIPTION
+   Builds the direct index of the chunk table, covering chunk numbers up
+   to 'index_size', if the chunk numbers of the table are dense enough;
+   otherwise sorts the table.  If a chunk number is in the table more than
+   once, the first record is used, as it always was.
+RETURNS
+   SUCCEED/FAIL
 ---------------------------------------------------------------------------*/
 static intn
-chkcompare(void *k1, /* IN: first key */
-           void *k2, /* IN: second key */
-           intn  cmparg /* IN: not sure? */)
+HMCIindex_table(chunkinfo_t *info, /* IN: chunked element information record */
+                int32        index_size /* IN: number of chunk numbers to cover */)
 {
-    intn ret_value;
+    int32 *index;
+    int32  i;
+    intn   ret_value = SUCCEED;
 
-    (void)cmparg;
+    for (i = 0; i < info->nchunks; i++)
+        if (!HMC_IS_DENSE(info->chk_recs[i].chunk_number, info->nchunks))
+            break;
+    if (i < info->nchunks) {
+        HMCIsort_table(info);
+        HGOTO_DONE(SUCCEED);
+    }
 
-    /* valid for integer keys */
-    ret_value = ((intn)((*(int32 *)k1) - (*(int32 *)k2)));
+    for (i = 0; i < info->nchunks; i++)
+        if (info->chk_recs[i].chunk_number >= index_size)
+            index_size = info->chk_recs[i].chunk_number + 1;
 
-    return ret_value;
-} /* chkcompare */
+    if ((index = (int32 *)realloc(info->chk_index, (size_t)index_size * sizeof(int32))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    for (i = info->index_size; i < index_size; i++)
+        index[i] = -1;
+    info->chk_index  = index;
+    info->index_size = index_size;
 
-/********* Helper fcns for dealing with chunk table TBBT tree ***************/
+    for (i = info->nchunks - 1; i >= 0; i--) /* last to first, so the first record wins */
+        index[info->chk_recs[i].chunk_number] = i;
+
+done:
+    return ret_value;
+} /* HMCIindex_table */
 
 /* -------------------------------------------------------------------------
 NAME
-    chkfreekey
+    HMCIread_table -- read the whole chunk table into memory
 DESCRIPTION
-    Free key - used by tbbt routines
-    *** Only called by B-tree routines, should _not_ be called externally ***
+   Reads the records of the chunk table (Vdata) in large batches, decodes
+   them into the chunk records of the element and indexes them by chunk
+   number.  The fields to read must have been set already.
 
+   Note that chunk tag DTAG_CHUNK is not verified here.
+   It is checked in HMCPchunkread() before the chunk is read.
 RETURNS
-   Nothing
-AUTHOR
-   -GeorgeV - 9/3/96
+   SUCCEED/FAIL
 ---------------------------------------------------------------------------*/
-static void
-chkfreekey(void *key /*IN: chunk key */)
+static intn
+HMCIread_table(chunkinfo_t *info, /* IN: chunked element information record */
+               int32        num_recs /* IN: number of table records */)
 {
-    free(key);
-} /* chkfreekey() */
+    uint8 *v_data = NULL; /* batch of Vdata records */
+    int32  rec_size;      /* size of a record, as read */
+    int32  batch;         /* number of records to read at once */
+    int32  nread;         /* number of records read so far */
+    int32  n, j;
+    intn   ret_value = SUCCEED;
+
+    if ((info->chk_recs = (CHUNK_REC *)malloc((size_t)num_recs * sizeof(CHUNK_REC))) == NULL ||
+        (info->chk_origins = (int32 *)malloc((size_t)num_recs * (size_t)info->ndims * sizeof(int32))) ==
+            NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    info->max_chunks = num_recs;
+
+    rec_size = info->ndims * (int32)sizeof(int32) + 2 * (int32)sizeof(uint16);
+    batch    = MAX(1, MIN(num_recs, HMC_TABLE_BATCH_BYTES / rec_size));
+    if ((v_data = (uint8 *)malloc((size_t)batch * (size_t)rec_size)) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
+    for (nread = 0; nread < num_recs; nread += n) {
+        uint8 *pntr = v_data; /* pointer to the next record of the batch */
+
+        n = MIN(batch, num_recs - nread);
+        if (VSread(info->aid, v_data, n, FULL_INTERLACE) != n)
+            HGOTO_ERROR(DFE_VSREAD, FAIL);
+
+        for (j = 0; j < n; j++) {
+            CHUNK_REC *chkptr = &info->chk_recs[info->nchunks];
+            int32     *origin = &info->chk_origins[info->nchunks * info->ndims];
+
+            /* origin first, then tag, then ref */
+            memcpy(origin, pntr, (size_t)info->ndims * sizeof(int32));
+            pntr += (size_t)info->ndims * sizeof(int32);
+            memcpy(&chkptr->chk_tag, pntr, sizeof(uint16));
+            pntr += sizeof(uint16);
+            memcpy(&chkptr->chk_ref, pntr, sizeof(uint16));
+            pntr += sizeof(uint16);
+
+            /* now compute chunk number from origin */
+            calculate_chunk_num(&chkptr->chunk_number, info->ndims, origin, info->ddims);
+
+            /* set chunk number to record number */
+            chkptr->chk_vnum = info->nchunks++;
+            info->num_recs++;
+        }
+    }
+
+    if (HMCIindex_table(info, 0) == FAIL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
+done:
+    free(v_data);
+
+    return ret_value;
+} /* HMCIread_table */
 
 /* -------------------------------------------------------------------------
 NAME
-    chkdestroynode
+    HMCIfind_chunk -- look a chunk up in the chunk table
 DESCRIPTION
-   Frees chunk B-Tree nodes
-   *** Only called by B-tree routines, should _not_ be called externally ***
+   Finds the record of a chunk from its number, in the direct index of the
+   chunk table if it has one, else by binary search.
+RETURNS
+   The chunk record, or NULL if the chunk is not in the table.  It is only
+   valid until the next chunk is added to the table.
+---------------------------------------------------------------------------*/
+static CHUNK_REC *
+HMCIfind_chunk(chunkinfo_t *info, /* IN: chunked element information record */
+               int32        chunk_num /* IN: chunk number */)
+{
+    int32 pos;
+
+    if (info->chk_index != NULL) {
+        if (chunk_num < 0 || chunk_num >= info->index_size || info->chk_index[chunk_num] < 0)
+            return NULL;
+        return &info->chk_recs[info->chk_index[chunk_num]];
+    }
 
+    pos = HMCIsearch_table(info, chunk_num);
+    if (pos < info->nchunks && info->chk_recs[pos].chunk_number == chunk_num)
+        return &info->chk_recs[pos];
+    return NULL;
+} /* HMCIfind_chunk */
+
+/* -------------------------------------------------------------------------
+NAME
+    HMCIadd_chunk -- add a chunk to the chunk table
+DESCRIPTION
+   Adds a record for a chunk not in the chunk table yet, with no tag/ref
+   until the chunk is written out by HMCPchunkwrite().  The direct index
+   grows with the chunk numbers as long as they stay dense, then the table
+   switches to being sorted.
 RETURNS
-   Nothing
-AUTHOR
-   -GeorgeV - 9/3/96
+   The new chunk record, or NULL on failure.  It is only valid until the
+   next chunk is added to the table.
 ---------------------------------------------------------------------------*/
-static void
-chkdestroynode(void *n /* IN: chunk record */)
+static CHUNK_REC *
+HMCIadd_chunk(chunkinfo_t *info,      /* IN: chunked element information record */
+              int32        chunk_num, /* IN: chunk number */
+              const int32 *origin /* IN: origin of the chunk */)
 {
-    CHUNK_REC *t = (CHUNK_REC *)n;
+    CHUNK_REC *chkptr;
+    int32      pos;
+    CHUNK_REC *ret_value = NULL;
+
+    /* make room for one more record */
+    if (info->nchunks == info->max_chunks) {
+        int32      max_chunks = MAX(2 * info->max_chunks, 64);
+        CHUNK_REC *recs;
+        int32     *origins;
+
+        if ((recs = (CHUNK_REC *)realloc(info->chk_recs, (size_t)max_chunks * sizeof(CHUNK_REC))) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, NULL);
+        info->chk_recs = recs;
+        if ((origins = (int32 *)realloc(info->chk_origins, (size_t)max_chunks * (size_t)info->ndims *
+                                                               sizeof(int32))) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, NULL);
+        info->chk_origins = origins;
+        info->max_chunks  = max_chunks;
+    }
 
-    if (t != NULL) {
-        /* free origin first */
-        free(t->origin);
+    /* grow the direct index if the chunk numbers stay dense, else sort */
+    if ((info->chk_index != NULL || info->nchunks == 0) && (chunk_num < 0 || chunk_num >= info->index_size)) {
+        if (!HMC_IS_DENSE(chunk_num, info->nchunks + 1))
+            HMCIsort_table(info);
+        else if (HMCIindex_table(info, MAX(2 * info->index_size, chunk_num + 1)) == FAIL)
+            HGOTO_ERROR(DFE_NOSPACE, NULL);
+    }
 
-        /* free chunk record structure */
-        free(t);
+    if (info->chk_index != NULL) { /* append, and index it */
+        pos                        = info->nchunks;
+        info->chk_index[chunk_num] = pos;
     }
-} /* chkdestroynode */
+    else { /* insert in chunk number order */
+        pos = HMCIsearch_table(info, chunk_num);
+        memmove(&info->chk_recs[pos + 1], &info->chk_recs[pos],
+                (size_t)(info->nchunks - pos) * sizeof(CHUNK_REC));
+    }
+
+    chkptr               = &info->chk_recs[pos];
+    chkptr->chunk_number = chunk_num;
+    chkptr->chk_vnum     = info->nchunks;
+    chkptr->chk_tag      = DFTAG_NULL;
+    chkptr->chk_ref      = 0;
+    memcpy(&info->chk_origins[info->nchunks * info->ndims], origin, (size_t)info->ndims * sizeof(int32));
+    info->nchunks++;
+
+    /* it is written to the chunk table with the chunk */
+    info->num_recs++;
+
+    ret_value = chkptr;
+
+done:
+    return ret_value;
+} /* HMCIadd_chunk */
+
+/* -------------------------------------------------------------------------
+NAME
+    HMCIfree_table -- free the chunk table
+DESCRIPTION
+   Frees the chunk records of an element and their index.
+RETURNS
+   Nothing
+---------------------------------------------------------------------------*/
+static void
+HMCIfree_table(chunkinfo_t *info /* IN: chunked element information record */)
+{
+    free(info->chk_recs);
+    free(info->chk_origins);
+    free(info->chk_index);
+    info->chk_recs    = NULL;
+    info->chk_origins = NULL;
+    info->chk_index   = NULL;
+    info->nchunks     = 0;
+    info->max_chunks  = 0;
+    info->index_size  = 0;
+} /* HMCIfree_table */
+
+/* -------------------------------------------------------------------------
+NAME
+    HMCIfile_pool -- the chunk cache shared by the elements of a file
+DESCRIPTION
+   Gets the pool the chunk caches of the chunked elements of a file keep
+   their chunks in, making it the first time, if the file has a budget of
+   bytes for it (see Hsetchunkcache).
+RETURNS
+   The pool, NULL if each element keeps a cache of its own (which is also
+   what happens if the pool could not be made)
+---------------------------------------------------------------------------*/
+static MCACHE_POOL *
+HMCIfile_pool(filerec_t *file_rec /* IN: file record */)
+{
+    if (file_rec->chk_pool == NULL && file_rec->chk_cache_size > 0)
+        file_rec->chk_pool = mcache_pool_create((size_t)file_rec->chk_cache_size, file_rec->chk_cache_policy);
+    return file_rec->chk_pool;
+} /* HMCIfile_pool */
 
 /* ----------------------------- HMCIstaccess ------------------------------
 NAME
@@ -804,7 +1164,9 @@ DESCRIPTION
    the cache are dealt with by their number i.e. translation of
    'origin' of chunk to a unique number. The default maximum number
    of chunks is the cache is set the number of chunks along the
-   last dimension.
+   last dimension.  If the file has a chunk cache shared by its
+   elements (see Hsetchunkcache), the chunks are kept in it instead,
+   within its budget of bytes.
 
    NOTE: The cache itself could be used to cache any object into a number
    of fixed size chunks so long as the read/write(page-in/page-out) routines know
@@ -834,17 +1196,14 @@ HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
     int32      interlace;         /* type of interlace */
     int32      vdata_size;        /* size of Vdata */
     int32      num_recs;          /* number of Vdatas */
-    uint8     *v_data  = NULL;    /* Vdata record */
-    CHUNK_REC *chkptr  = NULL;    /* Chunk record */
-    int32     *chk_key = NULL;    /* chunk key */
-    int32      npages  = 1;       /* number of chunks */
+    int32      npages = 1;        /* number of chunks */
     int32      chunks_needed;     /* default chunk cache size  */
     int32      access_aid = FAIL; /* access id */
     int32      ret_value  = SUCCEED;
     char       name[VSNAMELENMAX + 1];   /* Vdata name */
     char class[VSNAMELENMAX + 1];        /* Vdata class */
     char v_class[VSNAMELENMAX + 1] = ""; /* Vdata class for comparison */
-    intn i, j, k;                        /* loop indices */
+    intn i, j;                           /* loop indices */
 
     /* Check args */
     if (access_rec == NULL)
@@ -873,8 +1232,10 @@ HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
         if (--(tmpinfo->attached) == 0) { /* the last one so now.. */
             /* free old info from Chunk tables ..etc*/
 
-            /* Sync chunk cache */
+            /* Sync chunk cache, and write out the chunks it paged out to
+               be compressed */
             mcache_sync(tmpinfo->chk_cache);
+            HMCIencode_flush(access_rec);
 
             /* close/free chunk cache */
             mcache_close(tmpinfo->chk_cache);
@@ -882,8 +1243,8 @@ HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
             /* Use Vxxx interface to free Vdata info */
             VSdetach(tmpinfo->aid);
 
-            /* free chunk tree */
-            tbbtdfree(tmpinfo->chk_tree, chkdestroynode, chkfreekey);
+            /* free chunk table */
+            HMCIfree_table(tmpinfo);
 
             /* free up stuff in special info */
             free(tmpinfo->ddims);
@@ -896,6 +1257,8 @@ HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
             free(tmpinfo->comp_sp_tag_header);
             free(tmpinfo->cinfo);
             free(tmpinfo->minfo);
+            free(tmpinfo->enc_chunks);
+            free(tmpinfo->enc_data);
 
             /* free info struct last */
             free(tmpinfo);
@@ -929,8 +1292,20 @@ HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
         info->seek_pos_chunk       = NULL;
         info->seek_user_indices    = NULL;
         info->ddims                = NULL;
-        info->chk_tree             = NULL;
+        info->chk_recs             = NULL;
+        info->chk_origins          = NULL;
+        info->nchunks              = 0;
+        info->max_chunks           = 0;
+        info->chk_index            = NULL;
+        info->index_size           = 0;
         info->chk_cache            = NULL;
+        info->pf_count             = 0;
+        info->pf_chunks            = NULL;
+        info->pf_data              = NULL;
+        info->enc_count            = 0;
+        info->enc_max              = 0;
+        info->enc_chunks           = NULL;
+        info->enc_data             = NULL;
         info->fill_val             = NULL;
         info->minfo                = NULL;
         info->cinfo                = NULL;
@@ -1089,12 +1464,8 @@ HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
         if (Hendaccess(dd_aid) == FAIL)
             HGOTO_ERROR(DFE_CANTENDACCESS, FAIL);
 
-        /* set up the chunk tables of the information */
-        /* initialize TBBT tree of CHUNK records*/
-        info->chk_tree = tbbtdmake(chkcompare, sizeof(int32), TBBT_FAST_INT32_COMPARE);
-
         /* Use Vdata interface to read in chunk table and
-           store per chunk-info in memory using TBBT trees  */
+           store per chunk-info in memory in the chunk table */
 
         /* Start access on Vdata */
         if (Vstart(access_rec->file_id) == FAIL)
@@ -1132,70 +1503,10 @@ HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
             if (VSsetfields(info->aid, _HDF_CHK_FIELD_NAMES) == FAIL)
                 HGOTO_ERROR(DFE_BADFIELDS, FAIL);
 
-            /* Allocate space for a single Vdata record */
-            if ((v_data = malloc((size_t)vdata_size)) == NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-            /* for each record read it in and put into TBBT tree
-               NOTE: Should change this to a single VSread() but then
-               would have to store all the v_data rec's somewhere
-               before inserting them into the TBBT tree...
-               ....for someone to do later if performance of VSread() is bad.
-               Technically a B+-Tree should have been used instead or
-               better yet the Vdata implementation should be re-written to use one.
-               Note that chunk tag DTAG_CHUNK is not verified here.
-               It is checked in HMCPchunkread() before the chunk is read. */
-            for (j = 0; j < num_recs; j++) {
-                uint8 *pntr = NULL;
-
-                /* read single record */
-                if (VSread(info->aid, v_data, 1, FULL_INTERLACE) == FAIL)
-                    HGOTO_ERROR(DFE_VSREAD, FAIL);
-
-                pntr = v_data; /* set pointer to vdata record */
-
-                /* Allocate space for a chunk record */
-                if ((chkptr = (CHUNK_REC *)malloc(sizeof(CHUNK_REC))) == NULL)
-                    HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-                /* Allocate space for a origin in chunk record */
-                if ((chkptr->origin = (int32 *)malloc((size_t)info->ndims * sizeof(int32))) == NULL)
-                    HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-                /* allocate space for key */
-                if ((chk_key = (int32 *)malloc(sizeof(int32))) == NULL)
-                    HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-                /* Copy origin first */
-                for (k = 0; k < info->ndims; k++) {
-                    memcpy(&chkptr->origin[k], pntr, sizeof(int32));
-                    pntr += sizeof(int32);
-                }
-
-                /* Copy tag next.
-                   Note: Verification of tag as DTAG_CHUNK is done in
-                   HMCPchunkread() before the chunk object is read.
-                   In the future the tag/ref pair could point to
-                   another chunk table...etc.
-                   */
-                memcpy(&chkptr->chk_tag, pntr, sizeof(uint16));
-                pntr += sizeof(uint16);
-
-                /* Copy ref last */
-                memcpy(&chkptr->chk_ref, pntr, sizeof(uint16));
-
-                /* now compute chunk number from origin */
-                calculate_chunk_num(chk_key, info->ndims, chkptr->origin, info->ddims);
-
-                chkptr->chunk_number = *chk_key;
-
-                /* set chunk number to record number */
-                chkptr->chk_vnum = info->num_recs++;
-
-                /* add to TBBT tree based on chunk number as the key */
-                tbbtdins(info->chk_tree, chkptr, chk_key);
-            } /* end for num_recs */
-        }     /* end if num_recs */
+            /* read the whole table in, in large batches */
+            if (HMCIread_table(info, num_recs) == FAIL)
+                HGOTO_ERROR(DFE_INTERNAL, FAIL);
+        } /* end if num_recs */
 
         /* set return value */
         access_aid = HAregister_atom(AIDGROUP, access_rec);
@@ -1206,7 +1517,7 @@ HMCIstaccess(accrec_t *access_rec, /* IN: access record to fill in */
         for (i = 1; i < info->ndims; i++) {
             chunks_needed *= info->ddims[i].num_chunks;
         }
-        if ((info->chk_cache = mcache_open(&access_rec->file_id,               /* cache key */
+        if ((info->chk_cache = mcache_open(HMCIfile_pool(file_rec),            /* shared cache */
                                            access_aid,                         /* object id */
                                            (info->chunk_size * info->nt_size), /* chunk size */
                                            chunks_needed,                      /* maxcache */
@@ -1250,9 +1561,8 @@ done:
             if (info->aid != FAIL)
                 VSdetach(info->aid);
 
-            /* free chunk tree */
-            if (info->chk_tree != NULL)
-                tbbtdfree(info->chk_tree, chkdestroynode, chkfreekey);
+            /* free chunk table */
+            HMCIfree_table(info);
 
             /* free up stuff in special info */
             free(info->ddims);
@@ -1276,12 +1586,645 @@ done:
     if (c_sp_header != NULL)
         free(c_sp_header);
 #endif
-    /* free allocated space for vdata record */
-    free(v_data);
 
     return ret_value;
 } /* HMCIstaccess */
 
+/* ----------------------------- HMCIprefetch ------------------------------
+NAME
+   HMCIprefetch -- read the chunks a read will need in one batch
+
+DESCRIPTION
+   Finds the chunks that the rest of a read, 'length' bytes from seek
+   position 'posn', touches and which are neither in the chunk cache nor
+   already copied whole since the read started at 'start' (see
+   HMCIwhole_chunk), and reads them all with a single Hreadv(), so that a
+   driver which can have many reads in flight (i.e. the posix driver with
+   io_uring) gets them all at once instead of one at a time as the cache
+   asks for them.  HMCPchunkread() and HMCIread_whole() then take the
+   chunks from the data read ahead, until HMCPread() moves past them and
+   calls HMCIprefetch_free().
+
+   When the file has threads to decode chunks (see Hsetchunkthreads), the
+   chunks compressed with gzip 'deflate' are read as they are stored and
+   decompressed on the worker threads (see HWPrun), instead of being
+   decompressed one after the other by HMCPchunkread().
+
+   Nothing is read ahead for drivers which can't batch reads unless there
+   are chunks to decode, for reads within a single chunk, and beyond
+   HMC_PREFETCH_BYTES or HMC_PREFETCH_CHUNKS chunks; HMCPread() calls
+   again for the rest of the read.
+
+RETURNS
+   The number of bytes of the read covered by the chunks read ahead;
+   chunks which couldn't be read ahead are read as usual.
+----------------------------------------------------------------------------*/
+static int32
+HMCIprefetch(accrec_t *access_rec, /* IN: access record of the read */
+             int32     start,      /* IN: seek position of the whole read */
+             int32     posn,       /* IN: seek position of the rest of the read */
+             int32     length /* IN: number of bytes left to read */)
+{
+    chunkinfo_t   *info        = (chunkinfo_t *)access_rec->special_info;
+    filerec_t     *file_rec    = NULL; /* file record */
+    intn           batch       = 0;    /* whether the driver can batch reads */
+    intn           nthreads    = 0;    /* # of threads to decode chunks on */
+    intn           decode      = 0;    /* whether to decode the chunks on them */
+    int32          chunk_bytes = 0;    /* number of bytes in a chunk */
+    int32          max_chunks  = 0;    /* most chunks to read ahead */
+    int32         *chunks      = NULL; /* numbers of the chunks to read */
+    int32          nchunks     = 0;    /* number of entries in 'chunks' */
+    hdf_readreq_t *reqs        = NULL; /* reads of the chunks */
+    uint8         *data        = NULL; /* buffer for the chunks */
+    CHUNK_DECODE  *decs        = NULL; /* chunks to decompress */
+    int32          ndecs       = 0;    /* number of entries in 'decs' */
+    uint8         *src         = NULL; /* buffer for their compressed data */
+    size_t         src_bytes   = 0;    /* size of 'src' */
+    int32          walk_posn   = 0;    /* seek position of the walk */
+    int32          bytes_read  = 0;    /* bytes walked so far */
+    int32          chunk_size  = 0;    /* bytes of the read in the current chunk */
+    int32          chunk_num   = 0;    /* current chunk */
+    int32          chunk_posn  = 0;    /* seek position of its first element */
+    int32          i, n;
+
+    file_rec = HAatom_object(access_rec->file_id);
+    if (BADFREC(file_rec))
+        return length;
+    batch    = file_rec->driver->pread_batch != NULL;
+    nthreads = file_rec->chk_threads;
+    decode   = nthreads > 1 && (info->flag & 0xff) == SPECIAL_COMP && info->comp_type == COMP_CODE_DEFLATE;
+    if (!batch && !decode)
+        return length;
+    chunk_bytes = info->chunk_size * info->nt_size;
+    if (chunk_bytes <= 0 || (max_chunks = HMC_PREFETCH_BYTES / chunk_bytes) < 2)
+        return length;
+    if (max_chunks > HMC_PREFETCH_CHUNKS)
+        max_chunks = HMC_PREFETCH_CHUNKS;
+    if ((chunks = (int32 *)malloc((size_t)max_chunks * sizeof(int32))) == NULL)
+        return length;
+
+    /* Walk the read the same way HMCPread() does, noting the chunks, up to
+       the first one there's no room for */
+    walk_posn = posn;
+    while (bytes_read < length) {
+        calculate_chunk_num(&chunk_num, info->ndims, info->seek_chunk_indices, info->ddims);
+        calculate_chunk_for_chunk(&chunk_size, info->ndims, info->nt_size, length, bytes_read,
+                                  info->seek_chunk_indices, info->seek_pos_chunk, info->ddims);
+
+        for (i = nchunks - 1; i >= 0 && chunks[i] != chunk_num; i--)
+            ;
+        /* a chunk covered whole by the read is already copied once past
+           its first element, see HMCPread() */
+        if (i < 0 && HMCIwhole_chunk(info, start, posn + length, &chunk_posn) && chunk_posn < posn)
+            i = 0;
+        if (i < 0 && !mcache_incore(info->chk_cache, chunk_num + 1)) {
+            if (nchunks == max_chunks)
+                break;
+            chunks[nchunks++] = chunk_num;
+        }
+
+        bytes_read += chunk_size;
+        walk_posn += chunk_size;
+        update_chunk_indices_seek(walk_posn, info->ndims, info->nt_size, info->seek_chunk_indices,
+                                  info->seek_pos_chunk, info->ddims);
+    }
+
+    /* Put the seek position back for HMCPread() */
+    update_chunk_indices_seek(posn, info->ndims, info->nt_size, info->seek_chunk_indices,
+                              info->seek_pos_chunk, info->ddims);
+
+    if (nchunks < 2)
+        goto done;
+    if ((reqs = (hdf_readreq_t *)malloc((size_t)nchunks * sizeof(hdf_readreq_t))) == NULL ||
+        (data = (uint8 *)malloc((size_t)nchunks * (size_t)chunk_bytes)) == NULL ||
+        (decs = (CHUNK_DECODE *)malloc((size_t)nchunks * sizeof(CHUNK_DECODE))) == NULL)
+        goto done;
+
+    /* Only chunks written to the file are read, the others are filled;
+       the compressed ones are read raw if they can be decoded here */
+    for (i = 0, n = 0; i < nchunks; i++) {
+        CHUNK_REC   *chk_rec    = HMCIfind_chunk(info, chunks[i]);
+        comp_coder_t coder_type = COMP_CODE_NONE;
+        int32        orig_size  = 0;
+        int32        comp_size  = 0;
+        uint16       comp_ref   = 0;
+
+        if (chk_rec == NULL)
+            continue;
+        if (chk_rec->chk_tag == DFTAG_NULL || BASETAG(chk_rec->chk_tag) != DFTAG_CHUNK)
+            continue;
+
+        if (decode &&
+            HCPgetencoded(access_rec->file_id, chk_rec->chk_tag, chk_rec->chk_ref, &coder_type, &orig_size,
+                          &comp_ref, &comp_size) == SUCCEED &&
+            coder_type == COMP_CODE_DEFLATE && orig_size == chunk_bytes) {
+            decs[ndecs].chunk      = n;
+            decs[ndecs].req        = n;
+            decs[ndecs].coder_type = coder_type;
+            decs[ndecs].src_len    = comp_size;
+            decs[ndecs].dst        = data + (size_t)n * (size_t)chunk_bytes;
+            decs[ndecs].dst_len    = chunk_bytes;
+            ndecs++;
+            src_bytes += (size_t)comp_size;
+
+            reqs[n].tag    = DFTAG_COMPRESSED;
+            reqs[n].ref    = comp_ref;
+            reqs[n].length = comp_size;
+            reqs[n].buf    = NULL; /* set below */
+        }
+        else if (batch) {
+            reqs[n].tag    = chk_rec->chk_tag;
+            reqs[n].ref    = chk_rec->chk_ref;
+            reqs[n].length = chunk_bytes;
+            reqs[n].buf    = data + (size_t)n * (size_t)chunk_bytes;
+        }
+        else
+            continue;
+
+        chunks[n]       = chunks[i];
+        reqs[n].file_id = access_rec->file_id;
+        reqs[n].offset  = 0;
+        n++;
+    }
+    if (n < 2)
+        goto done;
+
+    if (ndecs > 0) {
+        uint8 *p;
+
+        if ((src = (uint8 *)malloc(src_bytes)) == NULL)
+            goto done;
+        for (i = 0, p = src; i < ndecs; i++) {
+            decs[i].src            = p;
+            reqs[decs[i].req].buf  = p;
+            p += decs[i].src_len;
+        }
+    }
+
+    Hreadv(reqs, (intn)n);
+    for (i = 0; i < n; i++)
+        if (reqs[i].nread != reqs[i].length)
+            chunks[i] = -1;
+
+    /* Decompress the chunks whose data could be read */
+    if (ndecs > 0) {
+        int32 k;
+
+        for (i = 0, k = 0; i < ndecs; i++)
+            if (chunks[decs[i].chunk] != -1)
+                decs[k++] = decs[i];
+        ndecs = k;
+
+        HWPrun(nthreads, (intn)ndecs, HMCIdecode, decs, sizeof(CHUNK_DECODE));
+        for (i = 0; i < ndecs; i++)
+            if (decs[i].src_len != decs[i].dst_len)
+                chunks[decs[i].chunk] = -1;
+    }
+
+    info->pf_count  = n;
+    info->pf_chunks = chunks;
+    info->pf_data   = data;
+    chunks          = NULL;
+    data            = NULL;
+
+done:
+    free(chunks);
+    free(reqs);
+    free(data);
+    free(decs);
+    free(src);
+
+    return bytes_read;
+} /* HMCIprefetch */
+
+/* ----------------------------- HMCIprefetch_free -------------------------
+NAME
+   HMCIprefetch_free -- drop the chunks read ahead
+
+DESCRIPTION
+   Frees the chunks read ahead by HMCIprefetch().
+
+RETURNS
+   Nothing
+----------------------------------------------------------------------------*/
+static void
+HMCIprefetch_free(chunkinfo_t *info /* IN: chunked element information record */)
+{
+    free(info->pf_chunks);
+    free(info->pf_data);
+    info->pf_chunks = NULL;
+    info->pf_data   = NULL;
+    info->pf_count  = 0;
+} /* HMCIprefetch_free */
+
+/* ----------------------------- HMCIdecode --------------------------------
+NAME
+   HMCIdecode -- decompress a chunk read ahead, on a worker thread
+
+DESCRIPTION
+   Decodes the compressed data of a chunk read ahead by HMCIprefetch()
+   into its place in the data read ahead.  Runs on a worker thread (see
+   HWPrun), so only touches the memory of the chunk.  The size of the
+   data decoded is left in 'src_len'.
+
+RETURNS
+   SUCCEED if the whole chunk was decoded, FAIL otherwise
+----------------------------------------------------------------------------*/
+static intn
+HMCIdecode(void *task /* IN: chunk to decompress */)
+{
+    CHUNK_DECODE *dec = (CHUNK_DECODE *)task;
+
+    dec->src_len = HCPdecode_buffer(dec->coder_type, dec->src, dec->src_len, dec->dst, dec->dst_len);
+
+    return dec->src_len == dec->dst_len ? SUCCEED : FAIL;
+} /* HMCIdecode */
+
+/* ----------------------------- HMCIwrite_record --------------------------
+NAME
+   HMCIwrite_record -- add the record of a new chunk to the chunk table
+
+DESCRIPTION
+   Gives a chunk which isn't in the file yet its tag/ref, and writes its
+   record, i.e. its origin and tag/ref, to the chunk table Vdata.
+
+RETURNS
+   SUCCEED / FAIL
+----------------------------------------------------------------------------*/
+static intn
+HMCIwrite_record(accrec_t  *access_rec, /* IN: access record of the element */
+                 CHUNK_REC *chk_rec /* IN: record of the new chunk */)
+{
+    chunkinfo_t *info      = (chunkinfo_t *)access_rec->special_info;
+    uint8       *v_data    = NULL; /* chunk table record i.e Vdata record */
+    uint8       *pntr      = NULL;
+    intn         ret_value = SUCCEED;
+
+    /* Allocate space for a single Chunk record in Vdata */
+    if ((v_data = malloc(((size_t)info->ndims * sizeof(int32)) + (2 * sizeof(uint16)))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
+    /* Initialize chunk record */
+    chk_rec->chk_tag = DFTAG_CHUNK;
+    chk_rec->chk_ref = Htagnewref(access_rec->file_id, DFTAG_CHUNK);
+
+    if (chk_rec->chk_ref == 0) {
+        /* out of ref numbers -- extremely fatal  */
+        HGOTO_ERROR(DFE_NOREF, FAIL);
+    }
+    /* Copy origin first to vdata record*/
+    pntr = v_data;
+    memcpy(pntr, &info->chk_origins[chk_rec->chk_vnum * info->ndims], (size_t)info->ndims * sizeof(int32));
+    pntr += (size_t)info->ndims * sizeof(int32);
+
+    /* Copy tag next */
+    memcpy(pntr, &chk_rec->chk_tag, sizeof(uint16));
+    pntr += sizeof(uint16);
+
+    /* Copy ref last */
+    memcpy(pntr, &chk_rec->chk_ref, sizeof(uint16));
+
+    /* Add to Vdata i.e. chunk table */
+    if (VSwrite(info->aid, v_data, 1, FULL_INTERLACE) == FAIL)
+        HGOTO_ERROR(DFE_VSWRITE, FAIL);
+
+done:
+    free(v_data);
+
+    return ret_value;
+} /* HMCIwrite_record */
+
+/* ----------------------------- HMCIencode_queue --------------------------
+NAME
+   HMCIencode_queue -- keep a chunk paged out to be compressed later
+
+DESCRIPTION
+   When the file has threads to encode chunks (see Hsetchunkthreads), a
+   new chunk compressed with gzip 'deflate' which the cache pages out is
+   only copied here, instead of being compressed and written right away.
+   Once HMC_ENCODE_BYTES or HMC_ENCODE_CHUNKS chunks, or one per thread
+   if that's more, are kept, or when the element is closed,
+   HMCIencode_flush() compresses them all on the worker threads and
+   writes them out in the order they were paged out.  Until then
+   HMCPchunkread() takes the chunks kept from here.
+
+RETURNS
+   TRUE if the chunk is kept, FALSE if it must be written as usual, FAIL
+   if writing out the chunks kept before failed.
+----------------------------------------------------------------------------*/
+static intn
+HMCIencode_queue(accrec_t   *access_rec, /* IN: access record of the element */
+                 int32       chunk_num,  /* IN: chunk number */
+                 const void *datap /* IN: data of the chunk */)
+{
+    chunkinfo_t *info        = (chunkinfo_t *)access_rec->special_info;
+    filerec_t   *file_rec    = NULL;                             /* file record */
+    int32        chunk_bytes = info->chunk_size * info->nt_size; /* number of bytes in a chunk */
+    int32        max_chunks  = 0;                                /* most chunks to keep */
+    int32        i;
+    intn         ret_value = TRUE;
+
+    /* Already kept?  Then it only has new data */
+    for (i = 0; i < info->enc_count && info->enc_chunks[i] != chunk_num; i++)
+        ;
+    if (i < info->enc_count) {
+        memcpy(info->enc_data + (size_t)i * (size_t)chunk_bytes, datap, (size_t)chunk_bytes);
+        HGOTO_DONE(TRUE);
+    }
+
+    file_rec = HAatom_object(access_rec->file_id);
+    if (BADFREC(file_rec))
+        HGOTO_DONE(FALSE);
+    if (file_rec->chk_threads < 2 || (info->flag & 0xff) != SPECIAL_COMP ||
+        info->comp_type != COMP_CODE_DEFLATE)
+        HGOTO_DONE(FALSE);
+
+    if (info->enc_data == NULL) {
+        max_chunks = MAX(HMC_ENCODE_BYTES / chunk_bytes, file_rec->chk_threads);
+        if (max_chunks > HMC_ENCODE_CHUNKS)
+            max_chunks = HMC_ENCODE_CHUNKS;
+        if ((info->enc_chunks = (int32 *)malloc((size_t)max_chunks * sizeof(int32))) == NULL ||
+            (info->enc_data = (uint8 *)malloc((size_t)max_chunks * (size_t)chunk_bytes)) == NULL) {
+            free(info->enc_chunks);
+            info->enc_chunks = NULL;
+            HGOTO_DONE(FALSE);
+        }
+        info->enc_max = max_chunks;
+    }
+    else if (info->enc_count == info->enc_max && HMCIencode_flush(access_rec) == FAIL)
+        HGOTO_DONE(FAIL);
+
+    info->enc_chunks[info->enc_count] = chunk_num;
+    memcpy(info->enc_data + (size_t)info->enc_count * (size_t)chunk_bytes, datap, (size_t)chunk_bytes);
+    info->enc_count++;
+
+done:
+    return ret_value;
+} /* HMCIencode_queue */
+
+/* ----------------------------- HMCIencode_flush --------------------------
+NAME
+   HMCIencode_flush -- compress the chunks kept on worker threads and write them
+
+DESCRIPTION
+   Compresses the chunks kept by HMCIencode_queue() on the worker threads
+   of the file (see HWPrun), then writes them out one after the other, in
+   the order the cache paged them out: the record of each in the chunk
+   table, then its compressed data (see HCPwrite_encoded).  A chunk which
+   couldn't be compressed that way is written through the compression
+   layer, as HMCPchunkwrite() does.
+
+RETURNS
+   SUCCEED / FAIL
+----------------------------------------------------------------------------*/
+static intn
+HMCIencode_flush(accrec_t *access_rec /* IN: access record of the element */)
+{
+    chunkinfo_t  *info        = (chunkinfo_t *)access_rec->special_info;
+    filerec_t    *file_rec    = NULL;                             /* file record */
+    CHUNK_ENCODE *encs        = NULL;                             /* chunks to compress */
+    uint8        *dst         = NULL;                             /* buffer for their compressed data */
+    int32         chunk_bytes = info->chunk_size * info->nt_size; /* number of bytes in a chunk */
+    int32         dst_bytes   = 0;    /* room for the compressed data of a chunk */
+    int32         chk_id      = FAIL; /* chunk access id */
+    int32         i;
+    intn          ret_value = SUCCEED;
+
+    if (info->enc_count == 0)
+        HGOTO_DONE(SUCCEED);
+
+    file_rec = HAatom_object(access_rec->file_id);
+    if (BADFREC(file_rec))
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    /* Room for a little more than the data, for chunks which don't compress */
+    dst_bytes = chunk_bytes + chunk_bytes / 8 + 64;
+    if ((encs = (CHUNK_ENCODE *)malloc((size_t)info->enc_count * sizeof(CHUNK_ENCODE))) == NULL ||
+        (dst = (uint8 *)malloc((size_t)info->enc_count * (size_t)dst_bytes)) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
+    for (i = 0; i < info->enc_count; i++) {
+        encs[i].coder_type = info->comp_type;
+        encs[i].c_info     = info->cinfo;
+        encs[i].src        = info->enc_data + (size_t)i * (size_t)chunk_bytes;
+        encs[i].src_len    = chunk_bytes;
+        encs[i].dst        = dst + (size_t)i * (size_t)dst_bytes;
+        encs[i].dst_len    = dst_bytes;
+    }
+    HWPrun(file_rec->chk_threads, (intn)info->enc_count, HMCIencode, encs, sizeof(CHUNK_ENCODE));
+
+    for (i = 0; i < info->enc_count; i++) {
+        CHUNK_REC *chk_rec = HMCIfind_chunk(info, info->enc_chunks[i]);
+
+        if (chk_rec == NULL)
+            HE_REPORT_GOTO("failed to find chunk record", FAIL);
+        if (HMCIwrite_record(access_rec, chk_rec) == FAIL)
+            HGOTO_ERROR(DFE_VSWRITE, FAIL);
+
+        if (encs[i].dst_len != FAIL) {
+            if (HCPwrite_encoded(access_rec->file_id, chk_rec->chk_tag, chk_rec->chk_ref, info->model_type,
+                                 info->minfo, info->comp_type, info->cinfo, chunk_bytes, encs[i].dst,
+                                 encs[i].dst_len) == FAIL)
+                HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+        }
+        else {
+            if ((chk_id = HCcreate(access_rec->file_id, chk_rec->chk_tag, chk_rec->chk_ref, info->model_type,
+                                   info->minfo, info->comp_type, info->cinfo)) == FAIL)
+                HE_REPORT_GOTO("HCcreate failed to write chunk", FAIL);
+            if (Hwrite(chk_id, chunk_bytes, encs[i].src) == FAIL)
+                HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+            if (Hendaccess(chk_id) == FAIL) {
+                chk_id = FAIL;
+                HE_REPORT_GOTO("Hendaccess failed to end access to chunk", FAIL);
+            }
+            chk_id = FAIL;
+        }
+    }
+
+done:
+    if (chk_id != FAIL)
+        Hendaccess(chk_id);
+    info->enc_count = 0;
+    free(encs);
+    free(dst);
+
+    return ret_value;
+} /* HMCIencode_flush */
+
+/* ----------------------------- HMCIencode --------------------------------
+NAME
+   HMCIencode -- compress a chunk kept, on a worker thread
+
+DESCRIPTION
+   Encodes the data of a chunk kept by HMCIencode_queue().  Runs on a
+   worker thread (see HWPrun), so only touches the memory of the chunk.
+   The size of the compressed data, or FAIL, is left in 'dst_len'.
+
+RETURNS
+   SUCCEED if the chunk was compressed, FAIL otherwise
+----------------------------------------------------------------------------*/
+static intn
+HMCIencode(void *task /* IN: chunk to compress */)
+{
+    CHUNK_ENCODE *enc = (CHUNK_ENCODE *)task;
+
+    enc->dst_len =
+        HCPencode_buffer(enc->coder_type, enc->c_info, enc->src, enc->src_len, enc->dst, enc->dst_len);
+
+    return enc->dst_len != FAIL ? SUCCEED : FAIL;
+} /* HMCIencode */
+
+/* ----------------------------- HMCIwhole_chunk ---------------------------
+NAME
+   HMCIwhole_chunk -- tell whether a read covers the current chunk whole
+
+DESCRIPTION
+   Finds the seek position in the element of the first element of the
+   chunk the seek position is in (see update_chunk_indices_seek), and
+   whether all of the elements of the chunk lie between seek positions
+   'start' and 'end'.  The elements of a chunk on the last row of chunks
+   along a dimension stop at the end of the dimension.
+
+RETURNS
+   TRUE if the chunk is covered whole, FALSE otherwise
+----------------------------------------------------------------------------*/
+static intn
+HMCIwhole_chunk(chunkinfo_t *info,  /* IN: chunked element information record */
+                int32        start, /* IN: seek position of the read */
+                int32        end,   /* IN: seek position of the end of the read */
+                int32       *chunk_posn /* OUT: seek position of the chunk */)
+{
+    DIM_REC *ddims  = info->ddims;
+    int32   *sbi    = info->seek_chunk_indices;
+    int32    stride = info->nt_size; /* bytes between elements along the dimension */
+    int32    last   = 0;             /* offset of the last element of the chunk */
+    int32    j;
+
+    if (info->ndims > H4_MAX_VAR_DIMS)
+        return FALSE;
+
+    *chunk_posn = 0;
+    for (j = info->ndims - 1; j >= 0; j--) {
+        int32 extent =
+            (sbi[j] == ddims[j].num_chunks - 1) ? ddims[j].last_chunk_length : ddims[j].chunk_length;
+
+        *chunk_posn += sbi[j] * ddims[j].chunk_length * stride;
+        last += (extent - 1) * stride;
+        if (j > 0)
+            stride *= ddims[j].dim_length;
+    }
+
+    return *chunk_posn >= start && *chunk_posn + last + info->nt_size <= end;
+} /* HMCIwhole_chunk */
+
+/* ----------------------------- HMCIread_whole ----------------------------
+NAME
+   HMCIread_whole -- copy a chunk covered whole by a read to the caller
+
+DESCRIPTION
+   Copies all of a chunk which a read covers whole (see HMCIwhole_chunk)
+   to the caller's buffer, one row along the fastest changing dimension
+   after the other, rather than a row at a time as HMCPread() gets to
+   each.
+
+   A chunk in the cache is copied from there, as is any chunk unless
+   'bypass' is set.  Otherwise the chunk is not put in the cache: a chunk
+   laid out as in the caller's buffer, i.e. as wide as the element along
+   all but the slowest changing dimension, is read right into it; others
+   are copied from where HMCIprefetch() read them, or read into 'scratch'
+   first, which is allocated as needed and freed by the caller.
+
+RETURNS
+   SUCCEED / FAIL
+----------------------------------------------------------------------------*/
+static intn
+HMCIread_whole(accrec_t *access_rec, /* IN: access record of the read */
+               int32     chunk_num,  /* IN: chunk number */
+               intn      bypass,     /* IN: whether to keep the chunk out of the cache */
+               uint8    *datap,      /* OUT: caller's buffer, at the chunk's first element */
+               uint8   **scratch /* IN/OUT: buffer for a chunk kept out of the cache */)
+{
+    chunkinfo_t *info        = (chunkinfo_t *)access_rec->special_info;
+    DIM_REC     *ddims       = info->ddims;
+    int32       *sbi         = info->seek_chunk_indices;
+    int32        ndims       = info->ndims;
+    int32        chunk_bytes = info->chunk_size * info->nt_size; /* number of bytes in a chunk */
+    int32        extent[H4_MAX_VAR_DIMS];  /* elements of the chunk along each dimension */
+    int32        cstride[H4_MAX_VAR_DIMS]; /* bytes between its elements in the chunk */
+    int32        ustride[H4_MAX_VAR_DIMS]; /* and in the caller's buffer */
+    int32        idx[H4_MAX_VAR_DIMS];     /* current row of the chunk */
+    int32        cs, us;
+    intn         contiguous = TRUE; /* whether laid out as in the caller's buffer */
+    void        *chk_data   = NULL; /* the chunk in the cache */
+    uint8       *src        = NULL; /* the data of the chunk */
+    int32        i, j;
+    intn         ret_value = SUCCEED;
+
+    for (j = ndims - 1, cs = us = info->nt_size; j >= 0; j--) {
+        extent[j]  = (sbi[j] == ddims[j].num_chunks - 1) ? ddims[j].last_chunk_length : ddims[j].chunk_length;
+        cstride[j] = cs;
+        ustride[j] = us;
+        idx[j]     = 0;
+        cs *= ddims[j].chunk_length;
+        if (j > 0) {
+            us *= ddims[j].dim_length;
+            if (ddims[j].chunk_length != ddims[j].dim_length)
+                contiguous = FALSE;
+        }
+        else if (extent[j] != ddims[j].chunk_length)
+            contiguous = FALSE;
+    }
+
+    if (!bypass || mcache_incore(info->chk_cache, chunk_num + 1)) {
+        /* Note the cache deals with objects starting from 1 not 0 */
+        if ((chk_data = mcache_get(info->chk_cache, chunk_num + 1, 0)) == NULL)
+            HE_REPORT_GOTO("failed to find chunk record", FAIL);
+        src = (uint8 *)chk_data;
+    }
+    else if (contiguous) {
+        if (HMCPchunkread(access_rec, chunk_num, datap) == FAIL)
+            HGOTO_ERROR(DFE_READERROR, FAIL);
+        HGOTO_DONE(SUCCEED);
+    }
+    else {
+        /* Was it read ahead by HMCIprefetch()? */
+        for (i = 0; i < info->pf_count && info->pf_chunks[i] != chunk_num; i++)
+            ;
+
+        if (i < info->pf_count)
+            src = info->pf_data + (size_t)i * (size_t)chunk_bytes;
+        else {
+            if (*scratch == NULL && (*scratch = (uint8 *)malloc((size_t)chunk_bytes)) == NULL)
+                HGOTO_ERROR(DFE_NOSPACE, FAIL);
+            if (HMCPchunkread(access_rec, chunk_num, *scratch) == FAIL)
+                HGOTO_ERROR(DFE_READERROR, FAIL);
+            src = *scratch;
+        }
+    }
+
+    /* Copy it a row along the fastest changing dimension at a time */
+    do {
+        int32 coff = 0, uoff = 0;
+
+        for (j = 0; j < ndims - 1; j++) {
+            coff += idx[j] * cstride[j];
+            uoff += idx[j] * ustride[j];
+        }
+        memcpy(datap + uoff, src + coff, (size_t)(extent[ndims - 1] * info->nt_size));
+
+        for (j = ndims - 2; j >= 0 && ++idx[j] == extent[j]; j--)
+            idx[j] = 0;
+    } while (j >= 0);
+
+done:
+    if (chk_data != NULL && mcache_put(info->chk_cache, chk_data, 0) == FAIL) {
+        HEreport("failed to put chunk back in cache");
+        ret_value = FAIL;
+    }
+
+    return ret_value;
+} /* HMCIread_whole */
+
 /* ------------------------------------------------------------------------
 NAME
    HMCcreate -- create a chunked element
@@ -1310,7 +2253,9 @@ DESCRIPTION
    the cache are dealt with by their number i.e. translation of
    'origin' of chunk to a unique number. The default maximum number
    of chunks is the cache is set the number of chunks along the
-   last dimension.
+   last dimension.  If the file has a chunk cache shared by its
+   elements (see Hsetchunkcache), the chunks are kept in it instead,
+   within its budget of bytes.
 
    NOTE: The cache itself could be used to cache any object into a number
    of fixed size chunks so long as the read/write(page-in/page-out) routines know
@@ -1370,7 +2315,7 @@ HMCcreate(int32 file_id,       /* IN: file to put chunked element in */
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* get empty slot in access records */
-    access_rec = HIget_access_rec();
+    access_rec = HIget_access_rec(file_rec);
     if (access_rec == NULL)
         HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
@@ -1416,8 +2361,20 @@ HMCcreate(int32 file_id,       /* IN: file to put chunked element in */
     info->seek_pos_chunk       = NULL;
     info->seek_user_indices    = NULL;
     info->ddims                = NULL;
-    info->chk_tree             = NULL;
+    info->chk_recs             = NULL;
+    info->chk_origins          = NULL;
+    info->nchunks              = 0;
+    info->max_chunks           = 0;
+    info->chk_index            = NULL;
+    info->index_size           = 0;
     info->chk_cache            = NULL;
+    info->pf_count             = 0;
+    info->pf_chunks            = NULL;
+    info->pf_data              = NULL;
+    info->enc_count            = 0;
+    info->enc_max              = 0;
+    info->enc_chunks           = NULL;
+    info->enc_data             = NULL;
     info->num_recs             = 0;            /* zero Vdata records to start */
     info->fill_val_len         = fill_val_len; /* length of fill value */
     /* allocate space for fill value */
@@ -1678,9 +2635,6 @@ HMCcreate(int32 file_id,       /* IN: file to put chunked element in */
     if (Hendaccess(dd_aid) == FAIL)
         HGOTO_ERROR(DFE_CANTENDACCESS, FAIL);
 
-    /* initialize TBBT tree of CHUNK records*/
-    info->chk_tree = tbbtdmake(chkcompare, sizeof(int32), TBBT_FAST_INT32_COMPARE);
-
     /* Detach from the data DD ID */
     if (data_id != FAIL) {
         if (HTPendaccess(data_id) == FAIL)
@@ -1709,7 +2663,7 @@ HMCcreate(int32 file_id,       /* IN: file to put chunked element in */
         chunks_needed *= info->ddims[i].num_chunks;
     }
     /* create chunk cache */
-    if ((info->chk_cache = mcache_open(&access_rec->file_id,               /* cache key */
+    if ((info->chk_cache = mcache_open(HMCIfile_pool(file_rec),            /* shared cache */
                                        access_aid,                         /* object id */
                                        (info->chunk_size * info->nt_size), /* chunk size */
                                        chunks_needed,                      /* maxcache */
@@ -1743,9 +2697,8 @@ done:
             if (info->aid != FAIL)
                 VSdetach(info->aid); /* detach from chunk table */
 
-            /* free chunk tree */
-            if (info->chk_tree != NULL)
-                tbbtdfree(info->chk_tree, chkdestroynode, chkfreekey);
+            /* free chunk table */
+            HMCIfree_table(info);
 
             /* free up stuff in special info */
             free(info->ddims);
@@ -1971,7 +2924,6 @@ HMCgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, /* IN: c
     intn         count   = 0; /* number of blocks */
     int32        chk_num = 0;
     CHUNK_REC   *chk_rec = NULL; /* chunk record */
-    TBBT_NODE   *entry   = NULL; /* chunk node from TBBT */
     accrec_t    *access_rec;
     filerec_t   *file_rec;
     int32        new_aid   = FAIL;
@@ -2009,9 +2961,8 @@ HMCgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, /* IN: c
     /* Calculate chunk number from origin */
     calculate_chunk_num(&chk_num, chkinfo->ndims, chk_coord, chkinfo->ddims);
 
-    /* Find chunk record in TBBT */
-    if ((entry = (tbbtdfind(chkinfo->chk_tree, &chk_num, NULL))) ==
-        NULL) { /* chunk had not been written, no chunk record */
+    /* Find chunk record in the chunk table */
+    if ((chk_rec = HMCIfind_chunk(chkinfo, chk_num)) == NULL) { /* chunk had not been written, no chunk record */
         if (offsetarray != NULL && lengtharray != NULL) {
             offsetarray[0] = 0;
             lengtharray[0] = 0;
@@ -2019,9 +2970,6 @@ HMCgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, /* IN: c
         count = 0;
     }
     else { /* chunk record exists */
-        /* Get chunk record from node */
-        chk_rec = (CHUNK_REC *)entry->data;
-
         /* Check to see if it has been written to */
         if (chk_rec->chk_tag != DFTAG_NULL &&
             BASETAG(chk_rec->chk_tag) == DFTAG_CHUNK) { /* valid chunk in file */
@@ -2041,9 +2989,7 @@ HMCgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, /* IN: c
                 count = 1;
             }      /* end if */
             else { /* this chunk is special */
-                if (HPseek(file_rec, new_off) == FAIL)
-                    HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-                if (HP_read(file_rec, lbuf, (int)2) == FAIL)
+                if (HP_read(file_rec, lbuf, (int)2, new_off) == FAIL)
                     HGOTO_ERROR(DFE_READERROR, FAIL);
 
                 /* Use special code to determine if additional specialness is
@@ -2053,7 +2999,7 @@ HMCgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, /* IN: c
 
                 /* Chunk is compressed */
                 if (spec_code == SPECIAL_COMP) {
-                    if (HP_read(file_rec, lbuf, (int)14) == FAIL)
+                    if (HP_read(file_rec, lbuf, (int)14, new_off + 2) == FAIL)
                         HGOTO_ERROR(DFE_READERROR, FAIL);
 
                     p = &lbuf[0];
@@ -2077,9 +3023,7 @@ HMCgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, /* IN: c
                         count = 1;
                     }      /* end if */
                     else { /* this chunk is further special */
-                        if (HPseek(file_rec, new_off) == FAIL)
-                            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-                        if (HP_read(file_rec, lbuf, (int)2) == FAIL)
+                        if (HP_read(file_rec, lbuf, (int)2, new_off) == FAIL)
                             HGOTO_ERROR(DFE_READERROR, FAIL);
 
                         /* Get the special code */
@@ -2089,7 +3033,7 @@ HMCgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, /* IN: c
                         /* If the special storage is in linked-blocks, use
                            HLgetdatainfo to get data info */
                         if (spec_code == SPECIAL_LINKED) {
-                            if (HP_read(file_rec, lbuf, (int)14) == FAIL)
+                            if (HP_read(file_rec, lbuf, (int)14, new_off + 2) == FAIL)
                                 HGOTO_ERROR(DFE_READERROR, FAIL);
 
                             /* decode special information retrieved from file into info struct */
@@ -2564,13 +3508,13 @@ HMCPchunkread(void *cookie,    /* IN: access record to mess with */
     accrec_t    *access_rec = (accrec_t *)cookie; /* access record */
     chunkinfo_t *info       = NULL;               /* information record for this special data elt */
     CHUNK_REC   *chk_rec    = NULL;               /* chunk record */
-    TBBT_NODE   *entry      = NULL;               /* chunk node from TBBT */
     uint8       *bptr       = NULL;               /* pointer to data buffer */
     int32        chk_id     = FAIL;               /* chunk id */
     int32        bytes_read = 0;                  /* total # bytes read for this call of HMCIread */
     int32        read_len   = 0;                  /* length of bytes to read */
     int32        nitems     = 1;                  /* used in HDmemfill(), */
-    int32        ret_value  = SUCCEED;
+    int32        i;
+    int32        ret_value = SUCCEED;
 
     /* Check args */
     if (access_rec == NULL)
@@ -2582,8 +3526,16 @@ HMCPchunkread(void *cookie,    /* IN: access record to mess with */
     bytes_read = 0;
     read_len   = (info->chunk_size * info->nt_size);
 
-    /* find chunk record in TBBT */
-    if ((entry = (tbbtdfind(info->chk_tree, &chunk_num, NULL))) == NULL) { /* does not exist */
+    /* Is it waiting to be compressed, see HMCIencode_queue()? */
+    for (i = 0; i < info->enc_count && info->enc_chunks[i] != chunk_num; i++)
+        ;
+    if (i < info->enc_count) {
+        memcpy(bptr, info->enc_data + (size_t)i * (size_t)read_len, (size_t)read_len);
+        HGOTO_DONE(read_len);
+    }
+
+    /* find chunk record in the chunk table */
+    if ((chk_rec = HMCIfind_chunk(info, chunk_num)) == NULL) { /* does not exist */
         /* calculate number of fill value items to fill buffer with */
         nitems = (info->chunk_size * info->nt_size) / info->fill_val_len;
 
@@ -2591,29 +3543,36 @@ HMCPchunkread(void *cookie,    /* IN: access record to mess with */
         if (HDmemfill(datap, info->fill_val, (uint32)info->fill_val_len, (uint32)nitems) == NULL)
             HE_REPORT_GOTO("HDmemfill failed to fill read chunk", FAIL);
     }
-    else /* exists in TBBT */
+    else /* exists in the chunk table */
     {
-        /* get chunk record from node */
-        chk_rec = (CHUNK_REC *)entry->data;
-
         /* check to see if has been written to */
         if (chk_rec->chk_tag != DFTAG_NULL &&
             BASETAG(chk_rec->chk_tag) == DFTAG_CHUNK) { /* valid chunk in file */
-            /* Start read on chunk */
-            if ((chk_id = Hstartread(access_rec->file_id, chk_rec->chk_tag, chk_rec->chk_ref)) == FAIL) {
-                Hendaccess(chk_id);
-                HE_REPORT_GOTO("Hstartread failed to read chunk", FAIL);
+            /* Was it read ahead by HMCIprefetch()? */
+            for (i = 0; i < info->pf_count && info->pf_chunks[i] != chunk_num; i++)
+                ;
+
+            if (i < info->pf_count) {
+                memcpy(bptr, info->pf_data + (size_t)i * (size_t)read_len, (size_t)read_len);
+                bytes_read = read_len;
             }
+            else {
+                /* Start read on chunk */
+                if ((chk_id = Hstartread(access_rec->file_id, chk_rec->chk_tag, chk_rec->chk_ref)) == FAIL) {
+                    Hendaccess(chk_id);
+                    HE_REPORT_GOTO("Hstartread failed to read chunk", FAIL);
+                }
 
-            /* read data from chunk */
-            if (Hread(chk_id, read_len, bptr) == FAIL)
-                HGOTO_ERROR(DFE_READERROR, FAIL);
+                /* read data from chunk */
+                if (Hread(chk_id, read_len, bptr) == FAIL)
+                    HGOTO_ERROR(DFE_READERROR, FAIL);
 
-            bytes_read = read_len;
+                bytes_read = read_len;
 
-            /* end access to chunk */
-            if (Hendaccess(chk_id) == FAIL)
-                HE_REPORT_GOTO("Hendaccess failed to end access to chunk", FAIL);
+                /* end access to chunk */
+                if (Hendaccess(chk_id) == FAIL)
+                    HE_REPORT_GOTO("Hendaccess failed to end access to chunk", FAIL);
+            }
         }
         else if (chk_rec->chk_tag ==
                  DFTAG_NULL) { /* chunk has not been written, so return fill value buffer */
@@ -2631,7 +3590,7 @@ HMCPchunkread(void *cookie,    /* IN: access record to mess with */
             HE_REPORT_GOTO("Not a valid Chunk object, wrong tag for chunk", FAIL);
         }
 
-    } /* end else exists in TBBT tree */
+    } /* end else exists in the chunk table */
 
     ret_value = bytes_read; /* number of bytes read */
 
@@ -2767,7 +3726,15 @@ DESCRIPTION
    Read in some data from a chunked element.
 
    Data is obtained from the cache which takes care of reading
-   in the proper chunks to satisfy the request.
+   in the proper chunks to satisfy the request.  The chunks missing
+   from the cache are read ahead in batches, and decompressed on worker
+   threads if the file has some (see HMCIprefetch).
+
+   A chunk which the read covers whole is copied all at once, when the
+   read gets to its first element, rather than a row at a time.  When the
+   read covers more chunks than the cache holds, those chunks are not put
+   in the cache either, but read straight into the caller's buffer, or
+   scattered to it from where they were read (see HMCIread_whole).
 
 RETURNS
    The number of bytes read or FAIL on error
@@ -2789,6 +3756,10 @@ HMCPread(accrec_t *access_rec, /* IN: access record to mess with */
     int32        chunk_num     = 0;    /* next chunk number */
     void        *chk_data      = NULL; /* chunk data */
     uint8       *chk_dptr      = NULL; /* pointer to chunk data */
+    int32        pf_end        = 0;    /* bytes of the read covered by the chunks read ahead */
+    int32        chunk_posn    = 0;    /* seek position of the first element of a chunk */
+    intn         bypass        = 0;    /* whether to keep the chunks read whole out of the cache */
+    uint8       *scratch       = NULL; /* buffer for a chunk kept out of the cache */
     int32        ret_value     = SUCCEED;
 
     /* Check args */
@@ -2817,7 +3788,19 @@ HMCPread(accrec_t *access_rec, /* IN: access record to mess with */
     bptr       = datap;
     bytes_read = 0;
     read_len   = length;
+
+    /* the chunks covered whole would only push each other out of the cache */
+    bypass = read_len / (info->chunk_size * info->nt_size) > mcache_get_maxcache(info->chk_cache);
+
     while (bytes_read < read_len) {
+        /* get the chunks which are not in the cache in one go, for as
+           much of the rest of the read as they fit */
+        if (bytes_read >= pf_end) {
+            HMCIprefetch_free(info);
+            pf_end = bytes_read + HMCIprefetch(access_rec, access_rec->posn, relative_posn,
+                                               read_len - bytes_read);
+        }
+
         /* calculate chunk to retrieve on this pass */
         calculate_chunk_num(&chunk_num, info->ndims, info->seek_chunk_indices, info->ddims);
 
@@ -2826,35 +3809,45 @@ HMCPread(accrec_t *access_rec, /* IN: access record to mess with */
         calculate_chunk_for_chunk(&chunk_size, info->ndims, info->nt_size, read_len, bytes_read,
                                   info->seek_chunk_indices, info->seek_pos_chunk, info->ddims);
 
-        /* would be nice to get Chunk record from TBBT based on chunk number
-           and then get chunk data base on chunk vdata number but
-           currently the chunk calculations return chunk
-           numbers and not Vdata record numbers.
-           This would reduce some overhead in the number of chunks
-           dealt with in the cache */
-
-        /* currently get chunk data from cache based on chunk number
-           Note the cache deals with objects starting from 1 not 0 */
-        if ((chk_data = mcache_get(info->chk_cache, /* cache handle */
-                                   chunk_num + 1,   /* chunk number */
-                                   0 /* flag: unused */)) == NULL)
-            HE_REPORT_GOTO("failed to find chunk record", FAIL);
-
-        chk_dptr = chk_data; /* set chunk data ptr */
-
-        /* calculate position in chunk */
-        calculate_seek_in_chunk(&read_seek, info->ndims, info->nt_size, info->seek_pos_chunk, info->ddims);
-
-        chk_dptr += read_seek; /* move to correct position in chunk */
-
-        /* copy data from chunk to users buffer */
-        memcpy(bptr, chk_dptr, chunk_size);
-
-        /* put chunk back to cache */
-        if (mcache_put(info->chk_cache, /* cache handle */
-                       chk_data,        /* whole data chunk */
-                       0 /* flag: 0->not DIRTY */) == FAIL)
-            HE_REPORT_GOTO("failed to put chunk back in cache", FAIL);
+        /* A chunk covered whole by the read is copied all at once at its
+           first element; the rest of it is then already there */
+        if (HMCIwhole_chunk(info, access_rec->posn, access_rec->posn + read_len, &chunk_posn)) {
+            if (relative_posn == chunk_posn &&
+                HMCIread_whole(access_rec, chunk_num, bypass, bptr, &scratch) == FAIL)
+                HGOTO_ERROR(DFE_READERROR, FAIL);
+        }
+        else {
+            /* would be nice to get Chunk record from the table based on chunk number
+               and then get chunk data base on chunk vdata number but
+               currently the chunk calculations return chunk
+               numbers and not Vdata record numbers.
+               This would reduce some overhead in the number of chunks
+               dealt with in the cache */
+
+            /* currently get chunk data from cache based on chunk number
+               Note the cache deals with objects starting from 1 not 0 */
+            if ((chk_data = mcache_get(info->chk_cache, /* cache handle */
+                                       chunk_num + 1,   /* chunk number */
+                                       0 /* flag: unused */)) == NULL)
+                HE_REPORT_GOTO("failed to find chunk record", FAIL);
+
+            chk_dptr = chk_data; /* set chunk data ptr */
+
+            /* calculate position in chunk */
+            calculate_seek_in_chunk(&read_seek, info->ndims, info->nt_size, info->seek_pos_chunk,
+                                    info->ddims);
+
+            chk_dptr += read_seek; /* move to correct position in chunk */
+
+            /* copy data from chunk to users buffer */
+            memcpy(bptr, chk_dptr, chunk_size);
+
+            /* put chunk back to cache */
+            if (mcache_put(info->chk_cache, /* cache handle */
+                           chk_data,        /* whole data chunk */
+                           0 /* flag: 0->not DIRTY */) == FAIL)
+                HE_REPORT_GOTO("failed to put chunk back in cache", FAIL);
+        }
 
         /* increment buffer pointer */
         bptr += chunk_size;
@@ -2878,6 +3871,11 @@ HMCPread(accrec_t *access_rec, /* IN: access record to mess with */
     ret_value = bytes_read;
 
 done:
+    /* drop the chunks read ahead */
+    if (info != NULL)
+        HMCIprefetch_free(info);
+    free(scratch);
+
     return ret_value;
 } /* HMCPread  */
 
@@ -2891,6 +3889,10 @@ DESCRIPTION
    This is used as the 'page-out-chunk' routine for the cache.
    Only the cache should call this routine.
 
+   When the file has threads to encode chunks (see Hsetchunkthreads), new
+   chunks compressed with gzip 'deflate' are only kept here, to be
+   compressed together on the worker threads (see HMCIencode_queue).
+
 RETURNS
    The number of bytes written or FAIL on error
 AUTHOR
@@ -2904,15 +3906,12 @@ HMCPchunkwrite(void       *cookie,    /* IN: access record to mess with */
     accrec_t    *access_rec    = (accrec_t *)cookie; /* access record */
     chunkinfo_t *info          = NULL;               /* chunked element information record */
     CHUNK_REC   *chk_rec       = NULL;               /* current chunk */
-    TBBT_NODE   *entry         = NULL;               /* node off of  chunk tree */
-    uint8       *v_data        = NULL;               /* chunk table record i.e Vdata record */
-    CHUNK_REC   *chkptr        = NULL;               /* Chunk record to inserted in TBBT  */
     const void  *bptr          = NULL;               /* data buffer pointer */
     int32        chk_id        = FAIL;               /* chunkd access id */
     int32        bytes_written = 0;                  /* total #bytes written by HMCIwrite */
     int32        write_len     = 0;                  /* nbytes to write next */
+    intn         queued        = FALSE;              /* whether the chunk is kept to be compressed */
     int32        ret_value     = SUCCEED;
-    intn         k; /* loop index */
 
     /* Check args */
     if (access_rec == NULL)
@@ -2924,48 +3923,20 @@ HMCPchunkwrite(void       *cookie,    /* IN: access record to mess with */
     bytes_written = 0;
     bptr          = datap;
 
-    /* find chunk record in TBBT */
-    if ((entry = (tbbtdfind(info->chk_tree, &chunk_num, NULL))) == NULL)
+    /* find chunk record in the chunk table */
+    if ((chk_rec = HMCIfind_chunk(info, chunk_num)) == NULL)
         HE_REPORT_GOTO("failed to find chunk record", FAIL);
 
-    chk_rec = (CHUNK_REC *)entry->data; /* get file entry from node */
-
     /* Check to see if already created in chunk table */
-    if (chk_rec->chk_tag == DFTAG_NULL) { /* does not exists in Vdata table and in file but does in TBBT */
-        uint8 *pntr = NULL;
+    if (chk_rec->chk_tag == DFTAG_NULL) { /* not in Vdata table and in file yet, only in memory */
+        /* Keep it to be compressed on the worker threads? */
+        if ((queued = HMCIencode_queue(access_rec, chunk_num, datap)) == FAIL)
+            HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+        if (queued)
+            HGOTO_DONE(write_len);
 
-        chkptr = chk_rec;
         /* so create a new Vdata record */
-        /* Allocate space for a single Chunk record in Vdata */
-        if (v_data == NULL) {
-            if ((v_data = malloc(((size_t)info->ndims * sizeof(int32)) + (2 * sizeof(uint16)))) == NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-        }
-
-        /* Initialize chunk record */
-        chkptr->chk_tag = DFTAG_CHUNK;
-        chkptr->chk_ref = Htagnewref(access_rec->file_id, DFTAG_CHUNK);
-
-        if (chkptr->chk_ref == 0) {
-            /* out of ref numbers -- extremely fatal  */
-            HGOTO_ERROR(DFE_NOREF, FAIL);
-        }
-        /* Copy origin first to vdata record*/
-        pntr = v_data;
-        for (k = 0; k < info->ndims; k++) {
-            memcpy(pntr, &chkptr->origin[k], sizeof(int32));
-            pntr += sizeof(int32);
-        }
-
-        /* Copy tag next */
-        memcpy(pntr, &chkptr->chk_tag, sizeof(uint16));
-        pntr += sizeof(uint16);
-
-        /* Copy ref last */
-        memcpy(pntr, &chkptr->chk_ref, sizeof(uint16));
-
-        /* Add to Vdata i.e. chunk table */
-        if (VSwrite(info->aid, v_data, 1, FULL_INTERLACE) == FAIL)
+        if (HMCIwrite_record(access_rec, chk_rec) == FAIL)
             HGOTO_ERROR(DFE_VSWRITE, FAIL);
 
         /* Create compressed chunk if set
@@ -3010,8 +3981,6 @@ done:
             Hendaccess(chk_id);
     }
 
-    free(v_data);
-
     return ret_value;
 } /* HMCPchunkwrite() */
 
@@ -3039,8 +4008,6 @@ HMCwriteChunk(int32       access_id, /* IN: access aid to mess with */
     accrec_t    *access_rec = NULL;  /* access record */
     filerec_t   *file_rec   = NULL;  /* file record */
     chunkinfo_t *info       = NULL;  /* chunked element information record */
-    CHUNK_REC   *chkptr     = NULL;  /* Chunk record to inserted in TBBT  */
-    int32       *chk_key    = NULL;  /* Chunk record key for insertion in TBBT */
     const void  *bptr       = NULL;  /* data buffer pointer */
     void        *chk_data   = NULL;  /* chunk data */
     uint8       *chk_dptr   = NULL;  /* chunk data pointer */
@@ -3049,7 +4016,6 @@ HMCwriteChunk(int32       access_id, /* IN: access aid to mess with */
     int32        write_len     = 0;  /* bytes to write next */
     int32        chunk_num     = -1; /* chunk number */
     int32        ret_value     = SUCCEED;
-    intn         k; /* loop index */
     intn         i;
 
     /* Check args */
@@ -3089,45 +4055,12 @@ HMCwriteChunk(int32       access_id, /* IN: access aid to mess with */
         /* calculate chunk number from origin */
         calculate_chunk_num(&chunk_num, info->ndims, origin, info->ddims);
 
-        /* find chunk record in TBBT */
-        if (tbbtdfind(info->chk_tree, &chunk_num, NULL) == NULL) { /* not in tree */
-
-            /* so create a new chunk record */
-            /* Allocate space for a chunk record */
-            if ((chkptr = (CHUNK_REC *)malloc(sizeof(CHUNK_REC))) == NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-            /* Allocate space for a origin in chunk record */
-            if ((chkptr->origin = (int32 *)malloc((size_t)info->ndims * sizeof(int32))) == NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-            /* allocate space for key */
-            if ((chk_key = (int32 *)malloc(sizeof(int32))) == NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-            /* Initialize chunk record */
-            chkptr->chk_tag = DFTAG_NULL;
-            chkptr->chk_ref = 0;
-
-            /* Initialize chunk origins */
-            for (k = 0; k < info->ndims; k++) {
-                chkptr->origin[k] = origin[k];
-            }
-
-            /* set chunk record number to next Vdata record number */
-            chkptr->chk_vnum = info->num_recs++;
-
-            /* set key to chunk number */
-            chkptr->chunk_number = *chk_key = chunk_num;
-
-            /* add to TBBT tree based on chunk number as the key */
-            tbbtdins(info->chk_tree, chkptr, chk_key);
+        /* find chunk record in the chunk table, so create a new
+           chunk record if it is not there yet */
+        if (HMCIfind_chunk(info, chunk_num) == NULL && HMCIadd_chunk(info, chunk_num, origin) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
-            /* re-initialize ptrs to allow for error-failure check */
-            chkptr  = NULL;
-            chk_key = NULL;
-        }
-        /* would be nice to get Chunk record from TBBT based on chunk number
+        /* would be nice to get Chunk record from the table based on chunk number
            and then get chunk data base on chunk vdata number but
            currently the chunk calculations return chunk
            numbers and not Vdata record numbers.
@@ -3173,15 +4106,6 @@ HMCwriteChunk(int32       access_id, /* IN: access aid to mess with */
         ret_value = FAIL;
 
 done:
-    if (ret_value == FAIL) { /* Error condition cleanup */
-        /* check chunk ptrs */
-        if (chkptr != NULL) {
-            free(chkptr->origin);
-            free(chkptr);
-        }
-        free(chk_key);
-    }
-
     return ret_value;
 } /* HMCwriteChunk */
 
@@ -3209,8 +4133,6 @@ HMCPwrite(accrec_t   *access_rec, /* IN: access record to mess with */
 {
     filerec_t   *file_rec = NULL;   /* file record */
     chunkinfo_t *info     = NULL;   /* chunked element information record */
-    CHUNK_REC   *chkptr   = NULL;   /* Chunk record to inserted in TBBT  */
-    int32       *chk_key  = NULL;   /* Chunk record key for insertion in TBBT */
     const uint8 *bptr     = NULL;   /* data buffer pointer */
     void        *chk_data = NULL;   /* chunk data */
     uint8       *chk_dptr = NULL;   /* chunk data pointer */
@@ -3221,7 +4143,6 @@ HMCPwrite(accrec_t   *access_rec, /* IN: access record to mess with */
     int32        chunk_size    = 0; /* chunk size */
     int32        chunk_num     = 0; /* chunk number */
     int32        ret_value     = SUCCEED;
-    intn         k; /* loop index */
 
     /* Check args */
     if (access_rec == NULL)
@@ -3255,44 +4176,13 @@ HMCPwrite(accrec_t   *access_rec, /* IN: access record to mess with */
         calculate_chunk_for_chunk(&chunk_size, info->ndims, info->nt_size, write_len, bytes_written,
                                   info->seek_chunk_indices, info->seek_pos_chunk, info->ddims);
 
-        /* find chunk record in TBBT */
-        if (tbbtdfind(info->chk_tree, &chunk_num, NULL) == NULL) { /* not in tree */
-
-            /* so create a new chunk record */
-            /* Allocate space for a chunk record */
-            if ((chkptr = (CHUNK_REC *)malloc(sizeof(CHUNK_REC))) == NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-            /* Allocate space for a origin in chunk record */
-            if ((chkptr->origin = (int32 *)malloc((size_t)info->ndims * sizeof(int32))) == NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-            /* allocate space for key */
-            if ((chk_key = (int32 *)malloc(sizeof(int32))) == NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-
-            /* Initialize chunk record */
-            chkptr->chk_tag = DFTAG_NULL;
-            chkptr->chk_ref = 0;
-
-            /* Initialize chunk origins */
-            for (k = 0; k < info->ndims; k++)
-                chkptr->origin[k] = info->seek_chunk_indices[k];
-
-            /* set chunk record number to next Vdata record number */
-            chkptr->chk_vnum = info->num_recs++;
-
-            /* set key to chunk number */
-            chkptr->chunk_number = *chk_key = chunk_num;
-
-            /* add to TBBT tree based on chunk number as the key */
-            tbbtdins(info->chk_tree, chkptr, chk_key);
+        /* find chunk record in the chunk table, so create a new
+           chunk record if it is not there yet */
+        if (HMCIfind_chunk(info, chunk_num) == NULL &&
+            HMCIadd_chunk(info, chunk_num, info->seek_chunk_indices) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
-            /* re-initialize ptrs to allow for error-failure check */
-            chkptr  = NULL;
-            chk_key = NULL;
-        }
-        /* would be nice to get Chunk record from TBBT based on chunk number
+        /* would be nice to get Chunk record from the table based on chunk number
            and then get chunk data base on chunk vdata number but
            currently the chunk calculations return chunk
            numbers and not Vdata record numbers.
@@ -3344,15 +4234,6 @@ HMCPwrite(accrec_t   *access_rec, /* IN: access record to mess with */
     ret_value = bytes_written;
 
 done:
-    if (ret_value == FAIL) { /* Error condition cleanup */
-        /* check chunk ptrs */
-        if (chkptr != NULL) {
-            free(chkptr->origin);
-            free(chkptr);
-        }
-        free(chk_key);
-    }
-
     return ret_value;
 } /* HMCPwrite */
 
@@ -3396,6 +4277,12 @@ HMCPcloseAID(accrec_t *access_rec /* IN:  access record of file to close */)
         if (info->chk_cache != NULL) {
             /* Sync chunk cache */
             mcache_sync(info->chk_cache);
+
+            /* write out the chunks it paged out to be compressed */
+            if (HMCIencode_flush(access_rec) == FAIL) {
+                HERROR(DFE_WRITEERROR);
+                ret_value = FAIL;
+            }
 #ifdef STATISTICS
             /* cache statistics if 'mcache.c' complied with -DSTATISTICS */
             mcache_stat(info->chk_cache);
@@ -3416,8 +4303,8 @@ HMCPcloseAID(accrec_t *access_rec /* IN:  access record of file to close */)
         if (Vend(access_rec->file_id) == FAIL)
             HGOTO_ERROR(DFE_CANTFLUSH, FAIL);
 
-        /* clean up chunk tree */
-        tbbtdfree(info->chk_tree, chkdestroynode, chkfreekey);
+        /* clean up chunk table */
+        HMCIfree_table(info);
 
         /* free up stuff in special info */
         free(info->ddims);
@@ -3428,6 +4315,8 @@ HMCPcloseAID(accrec_t *access_rec /* IN:  access record of file to close */)
         free(info->comp_sp_tag_header);
         free(info->cinfo);
         free(info->minfo);
+        free(info->enc_chunks);
+        free(info->enc_data);
 
         free(info);
         access_rec->special_info = NULL;
@@ -64,6 +64,7 @@ EXPORTED ROUTINES
 
 /* General HDF includes */
 #include "hdfi.h"
+#include "hthread.h"
 
 #ifdef H4_HAVE_LIBSZ
 #include "szlib.h"
@@ -689,19 +690,21 @@ HCcreate(int32 file_id, uint16 tag, uint16 ref, comp_model_t model_type, model_i
     void       *buf       = NULL;  /* temporary buffer */
     int32       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and validate args */
     HEclear();
     file_rec = HAatom_object(file_id);
     if (BADFREC(file_rec) || SPECIALTAG(tag) || (special_tag = MKSPECIALTAG(tag)) == DFTAG_NULL)
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
     /* check for access permission */
     if (!(file_rec->access & DFACC_WRITE))
-        HRETURN_ERROR(DFE_DENIED, FAIL);
+        HGOTO_ERROR(DFE_DENIED, FAIL);
 
     /* get a slot in the access records table */
-    if (NULL == (access_rec = HIget_access_rec()))
-        HRETURN_ERROR(DFE_TOOMANY, FAIL);
+    if (NULL == (access_rec = HIget_access_rec(file_rec)))
+        HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
     /* search for identical dd */
     if ((data_id = HTPselect(file_rec, tag, ref)) != FAIL) {
@@ -778,14 +781,15 @@ HCcreate(int32 file_id, uint16 tag, uint16 ref, comp_model_t model_type, model_i
 
 done:
     if (ret_value == FAIL) { /* Error condition cleanup */
-        if (access_rec != NULL)
+        if (access_rec != NULL) {
+            access_rec->special_info = NULL;
             HIrelease_accrec_node(access_rec);
+        }
         free(info);
-
-        access_rec->special_info = NULL;
     }
     free(buf);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end HCcreate() */
 
@@ -820,6 +824,8 @@ HCPgetcompinfo(int32 file_id, uint16 data_tag, uint16 data_ref,
     model_info   m_info; /* modeling information - dummy */
     intn         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -887,6 +893,7 @@ done:
                 HERROR(DFE_CANTENDACCESS);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* HCPgetcompinfo */
 
@@ -1159,10 +1166,8 @@ HCPwrite(accrec_t *access_rec, int32 length, const void *data)
         info->length = access_rec->posn;
 
         INT32ENCODE(p, info->length);
-        if (HPseek(file_rec, data_off + 4) == FAIL)
-            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
         /* re-write un-comp. len */
-        if (HP_write(file_rec, local_ptbuf, 4) == FAIL)
+        if (HP_write(file_rec, local_ptbuf, 4, data_off + 4) == FAIL)
             HGOTO_ERROR(DFE_WRITEERROR, FAIL);
     } /* end if */
 
@@ -1469,6 +1474,8 @@ HCPgetcomptype(int32 file_id, uint16 data_tag, uint16 data_ref, /* IN: tag/ref o
     filerec_t *file_rec;           /* file record */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1557,6 +1564,7 @@ done:
     /* release allocated memory */
     free(local_ptbuf);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* HCPgetcomptype */
 
@@ -1601,6 +1609,8 @@ HCPgetdatasize(int32 file_id, uint16 data_tag, uint16 data_ref, /* IN: tag/ref o
     filerec_t *file_rec; /* file record */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1681,5 +1691,219 @@ HCPgetdatasize(int32 file_id, uint16 data_tag, uint16 data_ref, /* IN: tag/ref o
 done:
     free(local_ptbuf);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* HCPgetdatasize */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HCPgetencoded -- Find the encoded data of a compressed element
+ USAGE
+    intn HCPgetencoded(file_id, data_tag, data_ref, coder_type, orig_size,
+                       comp_ref, comp_size)
+        int32 file_id;            IN: file id
+        uint16 data_tag;          IN: tag of the element
+        uint16 data_ref;          IN: ref of element
+        comp_coder_t *coder_type; OUT: the type of encoding of the element
+        int32* orig_size;         OUT: size of non-compressed data
+        uint16* comp_ref;         OUT: ref of the DFTAG_COMPRESSED element
+        int32* comp_size;         OUT: size of compressed data
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    Decodes the special header of a compressed element, to tell where its
+    encoded data is (the DFTAG_COMPRESSED element 'comp_ref' of
+    'comp_size' bytes) and how it is encoded, so that the caller can read
+    it raw and decode it with HCPdecode_buffer.  'coder_type' is set to
+    COMP_CODE_NONE for an element which is not compressed, or has no data
+    yet.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+intn
+HCPgetencoded(int32 file_id, uint16 data_tag, uint16 data_ref, /* IN: tag/ref of element */
+              comp_coder_t *coder_type,                        /* OUT - type of encoding */
+              int32        *orig_size,                         /* OUT - size of non-compressed data */
+              uint16       *comp_ref,                          /* OUT - ref of compressed data */
+              int32        *comp_size)                         /* OUT - size of compressed data */
+{
+    uint8       *local_ptbuf = NULL, *p;
+    uint16       sp_tag;         /* special tag */
+    atom_t       data_id = FAIL; /* dd ID of the element */
+    comp_model_t model_type;     /* type of modeling of the data */
+    model_info   m_info;         /* modeling information - dummy */
+    comp_info    c_info;         /* encoding information - dummy */
+    filerec_t   *file_rec;       /* file record */
+    intn         ret_value = SUCCEED;
+
+    *coder_type = COMP_CODE_NONE;
+
+    /* convert file id to file rec and check for validity */
+    file_rec = HAatom_object(file_id);
+    if (BADFREC(file_rec))
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    if ((data_id = HTPselect(file_rec, data_tag, data_ref)) == FAIL)
+        HGOTO_ERROR(DFE_CANTACCESS, FAIL);
+    if (HTPis_special(data_id) == FALSE)
+        HGOTO_DONE(SUCCEED);
+
+    /* Get the compression header (description record) */
+    if (HPread_drec(file_id, data_id, &local_ptbuf) <= 0)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+    p = local_ptbuf;
+    INT16DECODE(p, sp_tag);
+    if (sp_tag != SPECIAL_COMP)
+        HGOTO_DONE(SUCCEED);
+
+    p = p + 2; /* skip 2byte header_version */
+    INT32DECODE(p, *orig_size);
+    UINT16DECODE(p, *comp_ref);
+    if (*orig_size == 0)
+        HGOTO_DONE(SUCCEED);
+    if (HCPdecode_header(p, &model_type, &m_info, coder_type, &c_info) == FAIL)
+        HGOTO_ERROR(DFE_COMPINFO, FAIL);
+    if ((*comp_size = Hlength(file_id, DFTAG_COMPRESSED, *comp_ref)) == FAIL)
+        HGOTO_ERROR(DFE_BADLEN, FAIL);
+
+done:
+    if (data_id != FAIL)
+        HTPendaccess(data_id);
+    free(local_ptbuf);
+
+    return ret_value;
+} /* HCPgetencoded */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HCPdecode_buffer -- Decode the encoded data of an element held in memory
+ USAGE
+    int32 HCPdecode_buffer(coder_type, src, src_len, dst, dst_len)
+        comp_coder_t coder_type; IN: the type of encoding of the data
+        uint8 *src;              IN: the encoded data (see HCPgetencoded)
+        int32 src_len;           IN: # of bytes of encoded data
+        uint8 *dst;              OUT: buffer for the decoded data
+        int32 dst_len;           IN: # of bytes to decode
+ RETURNS
+    # of bytes decoded, or FAIL
+ DESCRIPTION
+    Decodes the whole of the encoded data of an element, read into memory
+    beforehand.  Uses no state of the library and reports no errors, so
+    that it can run on a worker thread (see HWPrun).  Only the gzip
+    'deflate' coder can decode from memory so far; the other encodings
+    FAIL and must be read through the element.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+int32
+HCPdecode_buffer(comp_coder_t coder_type, uint8 *src, int32 src_len, uint8 *dst, int32 dst_len)
+{
+    switch (coder_type) {
+        case COMP_CODE_DEFLATE:
+            return HCPcdeflate_decode_buffer(src, src_len, dst, dst_len);
+
+        default:
+            return FAIL;
+    } /* end switch */
+} /* HCPdecode_buffer */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HCPencode_buffer -- Encode the data of an element held in memory
+ USAGE
+    int32 HCPencode_buffer(coder_type, c_info, src, src_len, dst, dst_len)
+        comp_coder_t coder_type; IN: the type of encoding to use
+        comp_info *c_info;       IN: information for the encoding
+        uint8 *src;              IN: the data to encode
+        int32 src_len;           IN: # of bytes of data
+        uint8 *dst;              OUT: buffer for the encoded data
+        int32 dst_len;           IN: size of 'dst'
+ RETURNS
+    # of bytes of encoded data, or FAIL
+ DESCRIPTION
+    Encodes the whole of the data of an element at once, so that it can be
+    stored with HCPwrite_encoded.  Uses no state of the library and reports
+    no errors, so that it can run on a worker thread (see HWPrun).  Only
+    the gzip 'deflate' coder can encode into memory so far; the other
+    encodings FAIL and must be written through the element, as must data
+    whose encoding doesn't fit in 'dst'.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+int32
+HCPencode_buffer(comp_coder_t coder_type, comp_info *c_info, uint8 *src, int32 src_len, uint8 *dst,
+                 int32 dst_len)
+{
+    switch (coder_type) {
+        case COMP_CODE_DEFLATE:
+            return HCPcdeflate_encode_buffer(c_info->deflate.level, src, src_len, dst, dst_len);
+
+        default:
+            return FAIL;
+    } /* end switch */
+} /* HCPencode_buffer */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HCPwrite_encoded -- Create a compressed element from encoded data
+ USAGE
+    intn HCPwrite_encoded(file_id, tag, ref, model_type, m_info, coder_type,
+                          c_info, orig_len, data, data_len)
+        int32 file_id;           IN: the file id to create the element in
+        uint16 tag, ref;         IN: the tag/ref of the new element
+        comp_model_t model_type; IN: the type of modeling used
+        model_info *m_info;      IN: information for the modeling
+        comp_coder_t coder_type; IN: the type of encoding used
+        comp_info *c_info;       IN: information for the encoding
+        int32 orig_len;          IN: # of bytes of data before encoding
+        const uint8 *data;       IN: the encoded data (see HCPencode_buffer)
+        int32 data_len;          IN: # of bytes of encoded data
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    Writes a new compressed element, the way HCcreate followed by an
+    Hwrite of all of its data would, from data encoded beforehand: the
+    special header, then the encoded data as a DFTAG_COMPRESSED element.
+    The element must not exist yet.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+intn
+HCPwrite_encoded(int32 file_id, uint16 tag, uint16 ref, comp_model_t model_type, model_info *m_info,
+                 comp_coder_t coder_type, comp_info *c_info, int32 orig_len, const uint8 *data,
+                 int32 data_len)
+{
+    filerec_t *file_rec;    /* file record */
+    compinfo_t info;        /* special element information */
+    uint16     special_tag; /* special version of tag */
+    intn       ret_value = SUCCEED;
+
+    file_rec = HAatom_object(file_id);
+    if (BADFREC(file_rec) || SPECIALTAG(tag) || (special_tag = MKSPECIALTAG(tag)) == DFTAG_NULL)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+    if (!(file_rec->access & DFACC_WRITE))
+        HGOTO_ERROR(DFE_DENIED, FAIL);
+
+    memset(&info, 0, sizeof(info));
+    info.length           = orig_len;
+    info.minfo.model_type = model_type;
+    info.cinfo.coder_type = coder_type;
+    if ((info.comp_ref = Htagnewref(file_id, DFTAG_COMPRESSED)) == 0)
+        HGOTO_ERROR(DFE_NOREF, FAIL);
+
+    if (HCIwrite_header(file_id, &info, special_tag, ref, c_info, m_info) == FAIL)
+        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+    if (Hputelement(file_id, DFTAG_COMPRESSED, info.comp_ref, data, data_len) == FAIL)
+        HGOTO_ERROR(DFE_PUTELEM, FAIL);
+
+done:
+    return ret_value;
+} /* HCPwrite_encoded */
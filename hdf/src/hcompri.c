@@ -122,7 +122,7 @@ HRPconvert(int32 fid, uint16 tag, uint16 ref, int32 xdim, int32 ydim, int16 sche
     memcpy(&(info->cinfo), cinfo, sizeof(comp_info));
 
     /* get empty access record */
-    access_rec = HIget_access_rec();
+    access_rec = HIget_access_rec(file_rec);
     if (access_rec == NULL)
         HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
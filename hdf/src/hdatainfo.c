@@ -50,6 +50,7 @@ LOW-LEVEL ROUTINES
 #include "mfani.h"
 #include "mfan.h"
 #include "mfgri.h"
+#include "hthread.h"
 
 #ifdef H4_HAVE_LIBSZ /* we have the szip library */
 #include "szlib.h"
@@ -117,6 +118,8 @@ HDgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, uintn sta
     int32      comp_aid  = -1;                      /* compressed element access id */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -168,9 +171,7 @@ HDgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, uintn sta
         /* If the element is special, get the special info header and decode
            for special tag to detect compression/chunking/linked blocks */
         else {
-            if (HPseek(file_rec, doff) == FAIL)
-                HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-            if (HP_read(file_rec, lbuf, (int)2) == FAIL)
+            if (HP_read(file_rec, lbuf, (int)2, doff) == FAIL)
                 HGOTO_ERROR(DFE_READERROR, FAIL);
 
             /* Decode the special tag */
@@ -180,7 +181,7 @@ HDgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, uintn sta
             /* This is a compressed element */
             if (sp_tag == SPECIAL_COMP) {
                 /* Read compression info header */
-                if (HP_read(file_rec, lbuf, (int)COMP_HEADER_LENGTH) == FAIL)
+                if (HP_read(file_rec, lbuf, (int)COMP_HEADER_LENGTH, doff + 2) == FAIL)
                     HGOTO_ERROR(DFE_READERROR, FAIL);
 
                 /* Decode header to get data length */
@@ -234,9 +235,7 @@ HDgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, uintn sta
                             HGOTO_ERROR(DFE_INTERNAL, FAIL);
                         }
                         /* Get to and read the special code from the header */
-                        if (HPseek(file_rec, doff) == FAIL)
-                            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-                        if (HP_read(file_rec, lbuf, (int)2) == FAIL)
+                        if (HP_read(file_rec, lbuf, (int)2, doff) == FAIL)
                             HGOTO_ERROR(DFE_READERROR, FAIL);
 
                         /* Decode special code */
@@ -246,7 +245,7 @@ HDgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, uintn sta
                         /* The element has linked-blocks */
                         if (spec_code == SPECIAL_LINKED) {
                             /* Read the rest of the linked-block info header */
-                            if (HP_read(file_rec, lbuf, (int)14) == FAIL)
+                            if (HP_read(file_rec, lbuf, (int)14, doff + 2) == FAIL)
                                 HGOTO_ERROR(DFE_READERROR, FAIL);
 
                             /* Pass the header info to the linked-block API
@@ -288,7 +287,7 @@ HDgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, uintn sta
                 of the link table then hand over to linked block layer */
             else if (sp_tag == SPECIAL_LINKED) {
                 /* Read the linked-block info header */
-                if (HP_read(file_rec, lbuf, (int)14) == FAIL)
+                if (HP_read(file_rec, lbuf, (int)14, doff + 2) == FAIL)
                     HGOTO_ERROR(DFE_READERROR, FAIL);
 
                 /* Pass the header info to the linked-block API to get the data
@@ -312,6 +311,7 @@ HDgetdatainfo(int32 file_id, uint16 tag, uint16 ref, int32 *chk_coord, uintn sta
     /* Return the number of data blocks */
     ret_value = count;
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* HDgetdatainfo */
 
@@ -346,6 +346,8 @@ VSgetdatainfo(int32 vsid, uintn start_block, uintn info_count, int32 *offsetarra
     intn          count;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -412,6 +414,7 @@ VSgetdatainfo(int32 vsid, uintn start_block, uintn info_count, int32 *offsetarra
     ret_value = count;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetdatainfo */
 
@@ -470,6 +473,8 @@ Vgetattdatainfo(int32 vgid, intn attrindex, int32 *offset, int32 *length)
     intn          status;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -527,6 +532,7 @@ Vgetattdatainfo(int32 vgid, intn attrindex, int32 *offset, int32 *length)
     /* Return the number of data blocks, which should be 1 */
     ret_value = status;
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetattdatainfo */
 
@@ -569,6 +575,8 @@ VSgetattdatainfo(int32 vsid, int32 findex, intn attrindex, int32 *offset, int32
     intn          status;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -637,6 +645,7 @@ VSgetattdatainfo(int32 vsid, int32 findex, intn attrindex, int32 *offset, int32
     ret_value = status;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetattdatainfo */
 
@@ -678,6 +687,8 @@ GRgetattdatainfo(int32 id, int32 attrindex, int32 *offset, int32 *length)
     intn       status    = 0;
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -763,6 +774,7 @@ GRgetattdatainfo(int32 id, int32 attrindex, int32 *offset, int32 *length)
     ret_value = status; /* should be 1 */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* GRgetattdatainfo */
 
@@ -796,6 +808,8 @@ GRgetdatainfo(int32 riid, uintn start_block, uintn info_count, int32 *offsetarra
     uintn      count;
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -858,6 +872,7 @@ GRgetdatainfo(int32 riid, uintn start_block, uintn info_count, int32 *offsetarra
     ret_value = count;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* GRgetdatainfo */
 
@@ -895,6 +910,8 @@ GRgetpalinfo(int32 gr_id, uintn pal_count, hdf_ddinfo_t *palinfo_array)
     intn       idx;
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -923,7 +940,7 @@ GRgetpalinfo(int32 gr_id, uintn pal_count, hdf_ddinfo_t *palinfo_array)
             HGOTO_ERROR(DFE_INTERNAL, FAIL);
         }
         else
-            return n_IP8s + n_LUTs;
+            HGOTO_DONE(n_IP8s + n_LUTs);
     }
 
     /* Application requests data info of palettes.  Start checking tags in
@@ -969,6 +986,7 @@ done:
             Hendaccess(aid);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* GRgetpalinfo */
 
@@ -1006,6 +1024,8 @@ ANgetdatainfo(int32  ann_id, /* IN: annotation id */
     uint16     ann_ref;
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -1084,5 +1104,6 @@ ANgetdatainfo(int32  ann_id, /* IN: annotation id */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANgetdatainfo */
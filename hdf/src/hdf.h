@@ -105,6 +105,21 @@ typedef enum {
 /* The magic cookie for Hcache to cache all files */
 #define CACHE_ALL_FILES (-2)
 
+/* Low-level file drivers, for Hsetdriver/Hgetdriver */
+#define HDF_DRIVER_STDIO  1 /* C buffered I/O (the default) */
+#define HDF_DRIVER_POSIX  2 /* unbuffered POSIX I/O with pread/pwrite */
+#define HDF_DRIVER_MEMORY 3 /* whole file held in memory */
+#define HDF_DRIVER_MMAP   4 /* read-only files memory-mapped */
+#define HDF_DRIVER_IMAGE  5 /* files opened with Hopen_image */
+
+/* Default size of the readahead window of sequentially read files, see Hreadahead */
+#define HDF_READAHEAD_SIZE (1024 * 1024)
+
+/* Eviction policies of the chunk cache of a file, see Hsetchunkcache */
+#define HDF_CHUNK_CACHE_LRU   0 /* least recently used chunk first */
+#define HDF_CHUNK_CACHE_CLOCK 1 /* second-chance clock */
+#define HDF_CHUNK_CACHE_ARC   2 /* adaptive replacement (recency and frequency) */
+
 /* File access modes */
 /* 001--007 for different serial modes */
 /* 011--017 for different parallel modes */
@@ -171,6 +186,32 @@ typedef int32 HFILEID;
 
 typedef intn (*hdf_termfunc_t)(void); /* termination function typedef */
 
+/* One read request for Hreadv */
+typedef struct hdf_readreq_t {
+    int32  file_id; /* IN: file containing the data element */
+    uint16 tag;     /* IN: tag of the data element */
+    uint16 ref;     /* IN: ref of the data element */
+    int32  offset;  /* IN: offset in the data element to start reading at */
+    int32  length;  /* IN: # of bytes to read, 0 to read to the end of the element */
+    void  *buf;     /* OUT: buffer to read the data into */
+    int32  nread;   /* OUT: # of bytes read, or FAIL if the request failed */
+} hdf_readreq_t;
+
+/* I/O statistics of an open file, see Hgetiostats */
+typedef struct hdf_iostats_t {
+    uint64_t reads;         /* # of reads handed to the file driver */
+    uint64_t writes;        /* # of writes handed to the file driver */
+    uint64_t batches;       /* # of batches of reads handed to the driver (Hreadv) */
+    uint64_t seeks;         /* # of seeks done by the driver */
+    uint64_t seeks_avoided; /* # of seeks the driver skipped, being in place already */
+    uint64_t bytes_read;    /* # of bytes read through the driver */
+    uint64_t bytes_written; /* # of bytes written through the driver */
+    uint64_t ra_bytes;      /* # of bytes read copied from the readahead window */
+    uint64_t idx_bytes;     /* # of bytes read copied from the metadata index */
+    uint64_t dd_blocks;     /* # of DD blocks read */
+    float64  io_time;       /* seconds spent waiting for reads and writes */
+} hdf_iostats_t;
+
 /* .................................................................. */
 
 /* API adapter header (defines HDFPUBLIC, etc.) */
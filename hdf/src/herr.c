@@ -15,8 +15,12 @@
 /*
    HDF error handling / reporting routines
 
+   In a threadsafe build every thread has an error stack of its own.
+
 LOCAL ROUTINES
-  None
+  HEIget_stack  -- get the error stack of the calling thread
+  HEIinit_key   -- create the key to the error stacks of the threads
+  HEIfree_stack -- free the error stack of a thread which exits
 EXPORTED ROUTINES
   HEstring -- return error description
   HEclear  -- clear the error stack
@@ -33,8 +37,9 @@ EXPORTED ROUTINES
  */
 #include <stdarg.h>
 
-/* always points to the next available slot; the last error record is in slot (top-1) */
-static int32 error_top = 0;
+#ifdef H4_HAVE_THREADSAFE
+#include <pthread.h>
+#endif
 
 /* We use a stack to hold the errors plus we keep track of the function,
    file and line where the error occurs. */
@@ -237,8 +242,23 @@ static const struct error_messages_t error_messages[] = {
 
 };
 
-/* pointer to the structure to hold error messages */
-static error_t *error_stack = NULL;
+/* An error stack */
+typedef struct error_stack_t {
+    int32    top;    /* always points to the next available slot; the last error record is in slot (top-1) */
+    error_t *errors; /* the error records, allocated on first use */
+} error_stack_t;
+
+#ifdef H4_HAVE_THREADSAFE
+/* Each thread has an error stack of its own, found through this key */
+static pthread_key_t  error_key;
+static pthread_once_t error_key_once = PTHREAD_ONCE_INIT;
+#else
+/* the error stack */
+static error_stack_t error_stack = {0, NULL};
+#endif
+
+/* Private routines */
+static error_stack_t *HEIget_stack(void);
 
 #ifndef DEFAULT_MESG
 #define DEFAULT_MESG "Unknown error"
@@ -291,14 +311,16 @@ DESCRIPTION
 void
 HEclear(void)
 {
-    if (!error_top)
+    error_stack_t *stack = HEIget_stack();
+
+    if (!stack->top)
         goto done;
 
-    /* error_top == 0 means no error in stack */
+    /* top == 0 means no error in stack */
     /* clean out old descriptions if they exist */
-    for (; error_top > 0; error_top--) {
-        free(error_stack[error_top - 1].desc);
-        error_stack[error_top - 1].desc = NULL;
+    for (; stack->top > 0; stack->top--) {
+        free(stack->errors[stack->top - 1].desc);
+        stack->errors[stack->top - 1].desc = NULL;
     }
 
 done:
@@ -328,30 +350,33 @@ DESCRIPTION
 void
 HEpush(hdf_err_code_t error_code, const char *function_name, const char *file_name, intn line)
 {
-    intn i;
+    error_stack_t *stack = HEIget_stack();
+    error_t       *error;
+    intn           i;
 
     /* if the stack is not allocated, then do it */
-    if (!error_stack) {
-        error_stack = (error_t *)malloc((uint32)sizeof(error_t) * ERR_STACK_SZ);
-        if (!error_stack) {
+    if (!stack->errors) {
+        stack->errors = (error_t *)malloc((uint32)sizeof(error_t) * ERR_STACK_SZ);
+        if (!stack->errors) {
             puts("HEpush cannot allocate space.  Unable to continue!!");
             exit(8);
         }
         for (i = 0; i < ERR_STACK_SZ; i++)
-            error_stack[i].desc = NULL;
+            stack->errors[i].desc = NULL;
     }
 
     /* if stack is full, discard error */
     /* otherwise, push error details onto stack */
 
-    if (error_top < ERR_STACK_SZ) {
-        strcpy(error_stack[error_top].function_name, function_name);
-        error_stack[error_top].file_name  = file_name;
-        error_stack[error_top].line       = line;
-        error_stack[error_top].error_code = error_code;
-        free(error_stack[error_top].desc);
-        error_stack[error_top].desc = NULL;
-        error_top++;
+    if (stack->top < ERR_STACK_SZ) {
+        error = &stack->errors[stack->top];
+        strcpy(error->function_name, function_name);
+        error->file_name  = file_name;
+        error->line       = line;
+        error->error_code = error_code;
+        free(error->desc);
+        error->desc = NULL;
+        stack->top++;
     }
 } /* HEpush */
 
@@ -372,20 +397,21 @@ DESCRIPTION
 void
 HEreport(const char *format, ...)
 {
-    va_list arg_ptr;
-    char   *tmp;
+    error_stack_t *stack = HEIget_stack();
+    va_list        arg_ptr;
+    char          *tmp;
 
     va_start(arg_ptr, format);
 
-    if ((error_top < ERR_STACK_SZ + 1) && (error_top > 0)) {
+    if ((stack->top < ERR_STACK_SZ + 1) && (stack->top > 0)) {
         tmp = (char *)malloc(ERR_STRING_SIZE);
         if (!tmp) {
             HERROR(DFE_NOSPACE);
             goto done;
         }
         vsprintf(tmp, format, arg_ptr);
-        free(error_stack[error_top - 1].desc);
-        error_stack[error_top - 1].desc = tmp;
+        free(stack->errors[stack->top - 1].desc);
+        stack->errors[stack->top - 1].desc = tmp;
     }
 
     va_end(arg_ptr);
@@ -412,17 +438,19 @@ DESCRIPTION
 void
 HEprint(FILE *stream, int32 print_levels)
 {
-    if (print_levels == 0 || print_levels > error_top) /* print all errors */
-        print_levels = error_top;
+    error_stack_t *stack = HEIget_stack();
+    error_t       *error;
+
+    if (print_levels == 0 || print_levels > stack->top) /* print all errors */
+        print_levels = stack->top;
 
     /* print the errors starting from most recent */
     for (print_levels--; print_levels >= 0; print_levels--) {
-        fprintf(stream, "HDF error: (%d) <%s>\n\tDetected in %s() [%s line %d]\n",
-                error_stack[print_levels].error_code, HEstring(error_stack[print_levels].error_code),
-                error_stack[print_levels].function_name, error_stack[print_levels].file_name,
-                error_stack[print_levels].line);
-        if (error_stack[print_levels].desc)
-            fprintf(stream, "\t%s\n", error_stack[print_levels].desc);
+        error = &stack->errors[print_levels];
+        fprintf(stream, "HDF error: (%d) <%s>\n\tDetected in %s() [%s line %d]\n", error->error_code,
+                HEstring(error->error_code), error->function_name, error->file_name, error->line);
+        if (error->desc)
+            fprintf(stream, "\t%s\n", error->desc);
     }
 } /* HEprint */
 
@@ -443,10 +471,11 @@ HEprint(FILE *stream, int32 print_levels)
 int16
 HEvalue(int32 level)
 {
-    int16 ret_value = DFE_NONE;
+    error_stack_t *stack     = HEIget_stack();
+    int16          ret_value = DFE_NONE;
 
-    if (level > 0 && level <= error_top)
-        ret_value = (int16)error_stack[error_top - level].error_code;
+    if (level > 0 && level <= stack->top)
+        ret_value = (int16)stack->errors[stack->top - level].error_code;
     else
         ret_value = DFE_NONE;
 
@@ -473,10 +502,74 @@ HEvalue(int32 level)
 intn
 HEshutdown(void)
 {
-    if (error_stack != NULL) {
-        free(error_stack);
-        error_stack = NULL;
-        error_top   = 0;
+    error_stack_t *stack = HEIget_stack();
+
+    if (stack->errors != NULL) {
+        HEclear();
+        free(stack->errors);
+        stack->errors = NULL;
+        stack->top    = 0;
     }
     return SUCCEED;
 } /* end HEshutdown() */
+
+#ifdef H4_HAVE_THREADSAFE
+/* Free the error stack of a thread which is exiting */
+static void
+HEIfree_stack(void *arg)
+{
+    error_stack_t *stack = (error_stack_t *)arg;
+    intn           i;
+
+    if (stack->errors != NULL) {
+        for (i = 0; i < stack->top; i++)
+            free(stack->errors[i].desc);
+        free(stack->errors);
+    }
+    free(stack);
+} /* end HEIfree_stack() */
+
+/* Create the key to the error stacks of the threads, through pthread_once() */
+static void
+HEIinit_key(void)
+{
+    if (pthread_key_create(&error_key, HEIfree_stack) != 0) {
+        puts("HEpush cannot allocate space.  Unable to continue!!");
+        exit(8);
+    }
+} /* end HEIinit_key() */
+#endif /* H4_HAVE_THREADSAFE */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HEIget_stack
+ PURPOSE
+    Get the error stack of the calling thread.
+ USAGE
+    error_stack_t *HEIget_stack()
+ RETURNS
+    Returns a pointer to the error stack
+ DESCRIPTION
+    In a threadsafe build each thread gets an error stack of its own the
+    first time it needs one, which is freed when the thread exits.
+    Otherwise there is a single error stack.
+--------------------------------------------------------------------------*/
+static error_stack_t *
+HEIget_stack(void)
+{
+#ifdef H4_HAVE_THREADSAFE
+    error_stack_t *stack;
+
+    pthread_once(&error_key_once, HEIinit_key);
+    if ((stack = (error_stack_t *)pthread_getspecific(error_key)) == NULL) {
+        if ((stack = (error_stack_t *)calloc(1, sizeof(error_stack_t))) == NULL ||
+            pthread_setspecific(error_key, stack) != 0) {
+            puts("HEpush cannot allocate space.  Unable to continue!!");
+            exit(8);
+        }
+    }
+    return stack;
+#else
+    return &error_stack;
+#endif
+} /* end HEIget_stack() */
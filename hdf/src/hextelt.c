@@ -76,6 +76,7 @@ EXPORTED ROUTINES
 
 #include "hdfi.h"
 #include "hfile.h"
+#include "hthread.h"
 
 /* Directory separator definitions relating to a path.
  * Note this does not provide a universal way to recognize
@@ -190,6 +191,8 @@ HXcreate(int32 file_id, uint16 tag, uint16 ref, const char *extern_file_name, in
     void      *buf       = NULL;               /* temporary buffer */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and validate args */
     HEclear();
     file_rec = HAatom_object(file_id);
@@ -224,7 +227,7 @@ HXcreate(int32 file_id, uint16 tag, uint16 ref, const char *extern_file_name, in
                 case SPECIAL_LINKED:
                     if (HDinqblockinfo(aid, &data_len, NULL, NULL, NULL) == FAIL) {
                         Hendaccess(aid);
-                        HRETURN_ERROR(DFE_INTERNAL, FAIL);
+                        HGOTO_ERROR(DFE_INTERNAL, FAIL);
                     }
                     break;
                 case SPECIAL_EXT:
@@ -267,7 +270,7 @@ HXcreate(int32 file_id, uint16 tag, uint16 ref, const char *extern_file_name, in
     extdir_changed = FALSE; /* set to TRUE when HXsetdir is called */
 
     /* Get a bare access record and special info structure */
-    access_rec = HIget_access_rec();
+    access_rec = HIget_access_rec(file_rec);
     if (access_rec == NULL)
         HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
@@ -361,6 +364,7 @@ done:
 
     free(buf);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* HXcreate */
 
@@ -471,9 +475,7 @@ HXIstaccess(accrec_t *access_rec, int16 acc_mode)
         ((extinfo_t *)access_rec->special_info)->attached++;
     }
     else { /* look for information in the file */
-        if (HPseek(file_rec, data_off + 2) == FAIL)
-            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-        if (HP_read(file_rec, local_ptbuf, 12) == FAIL)
+        if (HP_read(file_rec, local_ptbuf, 12, data_off + 2) == FAIL)
             HGOTO_ERROR(DFE_READERROR, FAIL);
 
         access_rec->special_info = malloc((uint32)sizeof(extinfo_t));
@@ -490,7 +492,7 @@ HXIstaccess(accrec_t *access_rec, int16 acc_mode)
         info->extern_file_name = (char *)malloc((uint32)info->length_file_name + 1);
         if (!info->extern_file_name)
             HGOTO_ERROR(DFE_NOSPACE, FAIL);
-        if (HP_read(file_rec, info->extern_file_name, info->length_file_name) == FAIL)
+        if (HP_read(file_rec, info->extern_file_name, info->length_file_name, data_off + 14) == FAIL)
             HGOTO_ERROR(DFE_READERROR, FAIL);
 
         info->extern_file_name[info->length_file_name] = '\0';
@@ -774,9 +776,7 @@ HXPwrite(accrec_t *access_rec, int32 length, const void *data)
         /* Get the data's offset & length */
         if (HTPinquire(access_rec->ddid, NULL, NULL, &data_off, NULL) == FAIL)
             HGOTO_ERROR(DFE_INTERNAL, FAIL);
-        if (HPseek(file_rec, data_off + 2) == FAIL)
-            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-        if (HP_write(file_rec, local_ptbuf, 4) == FAIL)
+        if (HP_write(file_rec, local_ptbuf, 4, data_off + 2) == FAIL)
             HGOTO_ERROR(DFE_WRITEERROR, FAIL);
     }
 
@@ -1032,7 +1032,7 @@ HXPreset(accrec_t *access_rec, sp_info_block_t *info_block)
      *  special element DD and writing it in a new place
      */
     new_len = 14 + info->length_file_name;
-    if ((new_off = HPgetdiskblock(file_rec, new_len, TRUE)) == FAIL)
+    if ((new_off = HPgetdiskblock(file_rec, new_len)) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
     /* write the new external file record */
@@ -1046,7 +1046,7 @@ HXPreset(accrec_t *access_rec, sp_info_block_t *info_block)
     }
 
     /* write out the new external file record */
-    if (HP_write(file_rec, local_ptbuf, new_len) == FAIL)
+    if (HP_write(file_rec, local_ptbuf, new_len, new_off) == FAIL)
         HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
     /* update the DD block in the file */
@@ -1088,6 +1088,8 @@ HXsetcreatedir(const char *dir)
     char *pt;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (dir) {
         if (!(pt = strdup(dir)))
             HGOTO_ERROR(DFE_NOSPACE, FAIL);
@@ -1100,6 +1102,7 @@ HXsetcreatedir(const char *dir)
     extcreatedir = pt;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* HXsetcreatedir */
 
@@ -1129,6 +1132,8 @@ HXsetdir(const char *newdir)
     char *pt        = NULL;
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (newdir == NULL) {
         if (extdir != NULL) {
             free(extdir);
@@ -1156,6 +1161,7 @@ HXsetdir(const char *newdir)
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* HXsetdir */
 
@@ -44,6 +44,8 @@
    EXPORTED ROUTINES
    Hopen       -- open or create a HDF file
    Hclose      -- close HDF file
+   Hopen_image -- open or create a HDF file held in memory
+   Hclose_image -- close a HDF file held in memory and get its image
    Hstartread  -- locate and position a read access elt on a tag/ref
    Hnextread   -- locate and position a read access elt on next tag/ref.
    Hexist      -- locate an object in an HDF file
@@ -52,6 +54,8 @@
    Happendable -- attempt make a dataset appendable
    Hseek       -- position an access element to an offset in data element
    Hread       -- read the next segment from data element
+   Hreadptr    -- get a pointer to the next segment of data element
+   Hreadv      -- read segments of many data elements in one call
    Hwrite      -- write next data segment to data element
    HDgetc      -- read a byte from data element
    HDputc      -- write a byte to data element
@@ -64,6 +68,16 @@
    Htrunc      -- truncate a dataset to a length
    Hsync       -- sync file with memory
    Hcache      -- set low-level caching for a file
+   Hdefersync  -- leave flushing the DD list of a file to Hclose
+   Hreadahead  -- set the size of the readahead window for a file
+   Hsetchunkcache -- size the chunk cache shared by the chunked elements of a file
+   Hgetchunkcache -- get the size and use of the chunk cache of a file
+   Hsetchunkthreads -- set the # of threads (de)coding the chunks of a file
+   Hgetiostats -- get the I/O statistics of a file
+   Hresetiostats -- reset the I/O statistics of a file
+   Hsetdriver  -- set the low-level file driver for files opened afterwards
+   Hgetdriver  -- get the low-level file driver of a file
+   Hsetmetaindex -- keep metadata index sidecars for files opened afterwards
    HDvalidfid  -- check if a file ID is valid
    HDerr       --  Closes a file and return FAIL.
    Hsetacceesstype -- set the I/O access type (serial, parallel, ...)
@@ -108,12 +122,24 @@
    HIget_access_rec     -- allocate a new access record
    HIupdate_version     -- determine whether new version tag should be written
    HIread_version       -- reads a version tag from a file
+   HIreadv_locate       -- find the part of the file a Hreadv request reads
+   HIreadv_special      -- service a Hreadv request on a special element
+   HIreadv_compare      -- order Hreadv requests by file and offset
+   HIappend_diskblock   -- get a block at the end of the file
    + */
 
 #include <errno.h>
+#ifdef H4_HAVE_CLOCK_GETTIME
+#include <time.h>
+#elif defined(H4_HAVE_SYS_TIME_H)
+#include <sys/time.h>
+#endif
 
 #include "hdfi.h"
 #include "hfile.h"
+#include "mcache.h" /* for the chunk cache shared by the chunked elements */
+#include "hthread.h"
+#include "hwpool.h" /* for the worker threads decoding chunks */
 #include "glist.h" /* for double-linked lists, stacks and queues */
 
 /*--------------------- Locally defined Globals -----------------------------*/
@@ -121,6 +147,20 @@
 /* The default state of the file DD caching */
 static intn default_cache = TRUE;
 
+/* The default for leaving the flushing of DD blocks to Hclose */
+static intn default_defer_sync = FALSE;
+
+/* The default size of the readahead window */
+static int32 default_readahead = HDF_READAHEAD_SIZE;
+
+/* The default budget and policy of the chunk cache shared by the chunked
+   elements of a file; no budget means a cache per element */
+static int32 default_chunk_cache_size   = 0;
+static intn  default_chunk_cache_policy = HDF_CHUNK_CACHE_LRU;
+
+/* The default # of threads decoding the chunks of a file */
+static intn default_chunk_threads = 0;
+
 /* Whether we've installed the library termination function yet for this interface */
 static intn          library_terminate = FALSE;
 static Generic_list *cleanup_list      = NULL;
@@ -128,8 +168,17 @@ static Generic_list *cleanup_list      = NULL;
 /* Whether to install the atexit routine */
 static intn install_atexit = TRUE;
 
-/* Pointer to the access record node free list */
-static accrec_t *accrec_free_list = NULL;
+/* Hreadv merges reads which are at most this many bytes apart into one
+   transfer; the bytes in between are read into a scratch buffer and dropped */
+#define HREADV_MAXGAP 4096
+
+/* A Hreadv request on a non-special element, as a range of the file */
+typedef struct {
+    filerec_t     *file_rec; /* file to read from */
+    int32          offset;   /* offset of the data in the file */
+    int32          length;   /* # of bytes to read */
+    hdf_readreq_t *req;      /* the request to fill */
+} hreadv_seg_t;
 
 #ifdef DISKBLOCK_DEBUG
 const uint8 diskblock_header[4] = {0xde, 0xad, 0xbe, 0xef};
@@ -187,7 +236,7 @@ static filerec_t *HIget_filerec_node(const char *path);
 
 static intn HIrelease_filerec_node(filerec_t *file_rec);
 
-static intn HIvalid_magic(hdf_file_t file);
+static intn HIvalid_magic(filerec_t *file_rec);
 
 static intn HIextend_file(filerec_t *file_rec);
 
@@ -203,6 +252,16 @@ static intn HIsync(filerec_t *file_rec);
 
 static intn HIstart(void);
 
+static intn HIreadv_locate(hdf_readreq_t *req, hreadv_seg_t *seg);
+
+static int32 HIreadv_special(hdf_readreq_t *req);
+
+static int HIreadv_compare(const void *a, const void *b);
+
+static float64 HIiotime(void);
+
+static int32 HIappend_diskblock(filerec_t *file_rec, int32 block_size);
+
 /*--------------------------------------------------------------------------
 NAME
    Hopen -- Opens or creates an HDF file.
@@ -249,6 +308,8 @@ Hopen(const char *path, intn acc_mode, int16 ndds)
     int32      fid       = FAIL; /* File ID */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear errors and check args and all the boring stuff. */
     HEclear();
     if (!path || ((acc_mode & DFACC_ALL) != acc_mode))
@@ -275,25 +336,39 @@ Hopen(const char *path, intn acc_mode, int16 ndds)
                provide for write, then try to reopen file for writing.
                This cannot be done on OS (such as the SXOS) where only one
                open is allowed per file at any time. */
-            hdf_file_t f;
+            void *old_info = file_rec->drv_info;
+            void *new_info;
+
+            /* Only read-only files are read ahead or indexed */
+            HRAPstop(file_rec);
+            HIXPfree(file_rec);
 
             /* Sync. the file before throwing away the old file handle */
             if (HIsync(file_rec) == FAIL)
                 HGOTO_ERROR(DFE_INTERNAL, FAIL);
+            if (file_rec->driver->flush(file_rec) == FAIL)
+                HGOTO_ERROR(DFE_CANTFLUSH, FAIL);
 
-            f = (hdf_file_t)HI_OPEN(file_rec->path, acc_mode);
-            if (OPENERR(f))
+            if (file_rec->driver->open(file_rec, acc_mode) == FAIL) {
+                file_rec->drv_info = old_info;
                 HGOTO_ERROR(DFE_DENIED, FAIL);
+            }
 
-            /* Replace file_rec->file with new file pointer and
+            /* Replace the driver's state with the new one and
                close old one. */
-            if (HI_CLOSE(file_rec->file) == FAIL) {
-                HI_CLOSE(f);
+            new_info           = file_rec->drv_info;
+            file_rec->drv_info = old_info;
+            if (file_rec->driver->close(file_rec) == FAIL) {
+                file_rec->drv_info = new_info;
+                file_rec->driver->close(file_rec);
+                file_rec->drv_info = old_info;
                 HGOTO_ERROR(DFE_CANTCLOSE, FAIL);
             }
-            file_rec->file      = f;
-            file_rec->f_cur_off = 0;
-            file_rec->last_op   = H4_OP_UNKNOWN;
+            file_rec->drv_info = new_info;
+
+            /* The file may now be written to */
+            file_rec->access |= DFACC_WRITE;
+            HIXPdrop(file_rec);
         }
 
         /* There is now one more open to this file. */
@@ -303,10 +378,12 @@ Hopen(const char *path, intn acc_mode, int16 ndds)
         /* Flag to see if file is new and needs to be set up. */
         intn new_file = FALSE;
 
+        /* Pick the low-level driver for the file */
+        file_rec->driver = HFPget_driver(path);
+
         /* Open the file, fill in the blanks and all the good stuff. */
         if (acc_mode != DFACC_CREATE) { /* try to open existing file */
-            file_rec->file = (hdf_file_t)HI_OPEN(file_rec->path, acc_mode);
-            if (OPENERR(file_rec->file)) {
+            if (file_rec->driver->open(file_rec, acc_mode) == FAIL) {
                 if (acc_mode & DFACC_WRITE) {
                     /* Seems like the file is not there, try to create it. */
                     new_file = TRUE;
@@ -318,17 +395,22 @@ Hopen(const char *path, intn acc_mode, int16 ndds)
                 /* Open existing file successfully. */
                 file_rec->access = acc_mode | DFACC_READ;
 
+                /* Load the metadata index, for the reads below to use, or
+                   remove it if the file is going to be written to */
+                if (acc_mode & DFACC_WRITE)
+                    HIXPdrop(file_rec);
+                else
+                    HIXPload(file_rec);
+
                 /* Check to see if file is a HDF file. */
-                if (!HIvalid_magic(file_rec->file)) {
-                    HI_CLOSE(file_rec->file);
+                if (!HIvalid_magic(file_rec)) {
+                    file_rec->driver->close(file_rec);
                     HGOTO_ERROR(DFE_NOTDFFILE, FAIL);
                 }
 
-                file_rec->f_cur_off = 0;
-                file_rec->last_op   = H4_OP_UNKNOWN;
                 /* Read in all the relevant data descriptor records. */
                 if (HTPstart(file_rec) == FAIL) {
-                    HI_CLOSE(file_rec->file);
+                    file_rec->driver->close(file_rec);
                     HGOTO_ERROR(DFE_BADOPEN, FAIL);
                 }
             }
@@ -338,8 +420,7 @@ Hopen(const char *path, intn acc_mode, int16 ndds)
                                                     /* make user we get a version tag */
             vtag = 1;
 
-            file_rec->file = (hdf_file_t)HI_CREATE(file_rec->path);
-            if (OPENERR(file_rec->file)) {
+            if (file_rec->driver->create(file_rec) == FAIL) {
                 /* check if the failure was due to "too many open files" */
                 if (errno == EMFILE) {
                     HGOTO_ERROR(DFE_TOOMANY, FAIL);
@@ -347,16 +428,14 @@ Hopen(const char *path, intn acc_mode, int16 ndds)
                 else
                     HGOTO_ERROR(DFE_BADOPEN, FAIL);
             }
-
-            file_rec->f_cur_off = 0;
-            file_rec->last_op   = H4_OP_UNKNOWN;
+            HIXPdrop(file_rec);
 
             /* set up the newly created (and empty) file with
                the magic cookie and initial data descriptor records */
-            if (HP_write(file_rec, HDFMAGIC, MAGICLEN) == FAIL)
+            if (HP_write(file_rec, HDFMAGIC, MAGICLEN, 0) == FAIL)
                 HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
-            if (HI_FLUSH(file_rec->file) == FAIL) /* flush the cookie */
+            if (file_rec->driver->flush(file_rec) == FAIL) /* flush the cookie */
                 HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
             if (HTPinit(file_rec, ndds) == FAIL)
@@ -369,8 +448,16 @@ Hopen(const char *path, intn acc_mode, int16 ndds)
         file_rec->attach   = 0;
 
         /* currently, default is caching OFF */
-        file_rec->cache = default_cache;
+        file_rec->cache      = default_cache;
+        file_rec->defer_sync = default_defer_sync;
+        if (file_rec->defer_sync)
+            file_rec->cache = TRUE; /* the DD list has to be cached to be deferred */
+        file_rec->ra_size    = default_readahead;
         file_rec->dirty = 0; /* mark all dirty flags off to start */
+
+        file_rec->chk_cache_size   = default_chunk_cache_size;
+        file_rec->chk_cache_policy = default_chunk_cache_policy;
+        file_rec->chk_threads      = default_chunk_threads;
     }                        /* end else */
 
     file_rec->version_set = FALSE;
@@ -399,6 +486,7 @@ done:
             HIrelease_filerec_node(file_rec);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hopen */
 
@@ -422,6 +510,8 @@ Hclose(int32 file_id)
     filerec_t *file_rec; /* file record pointer */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear errors and check args and all the boring stuff. */
     HEclear();
 
@@ -448,9 +538,14 @@ Hclose(int32 file_id)
         if (HIsync(file_rec) == FAIL)
             HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
+        /* Write a new metadata index if the file needs one, ignoring errors */
+        HIXPsave(file_rec);
+        HIXPfree(file_rec);
+
         /* otherwise, nothing should still be using this file, close it */
         /* ignore any close error */
-        HI_CLOSE(file_rec->file);
+        HRAPstop(file_rec);
+        file_rec->driver->close(file_rec);
 
         if (HTPend(file_rec) == FAIL)
             HGOTO_ERROR(DFE_INTERNAL, FAIL);
@@ -463,9 +558,119 @@ Hclose(int32 file_id)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hclose */
 
+/*--------------------------------------------------------------------------
+NAME
+   Hopen_image -- open or create a HDF file held in memory
+USAGE
+   int32 Hopen_image(image, size, acc_mode, ndds)
+   const void *image;      IN: the file image (may be NULL for create)
+   int32 size;             IN: # of bytes in the image
+   int acc_mode;           IN: access mode to open file with
+   int16 ndds;             IN: number of DDs in a block
+RETURNS
+   file id if successful and FAIL (-1) otherwise
+DESCRIPTION
+   Like Hopen(), but the "file" is the memory image of an HDF file
+   instead of a file on disk.  With DFACC_CREATE, the image is ignored
+   and a new file is built in memory.
+
+   A file opened read-only uses the image in place; it must stay valid
+   and unchanged until the file is closed.  When the file is opened for
+   write, the image is copied into a buffer owned by the library which
+   grows as the file does.  The caller's image is never modified.
+
+   The file ids returned may be used with any interface which takes a
+   file id, e.g. GRstart() or Vstart().  Close the file with
+   Hclose_image() to get the final image back.  See also SDstart_image().
+
+--------------------------------------------------------------------------*/
+int32
+Hopen_image(const void *image, int32 size, intn acc_mode, int16 ndds)
+{
+    char  name[HFILE_IMAGE_NAMELEN]; /* path name of the image */
+    int32 ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    /* Clear errors and check args and all the boring stuff. */
+    HEclear();
+    if (acc_mode == DFACC_CREATE) {
+        image = NULL;
+        size  = 0;
+    }
+    else if (image == NULL || size <= 0)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    /* Perform global, one-time initialization */
+    if (library_terminate == FALSE)
+        if (HIstart() == FAIL)
+            HGOTO_ERROR(DFE_CANTINIT, FAIL);
+
+    if (HFPimage_register(image, size, name) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+
+    if ((ret_value = Hopen(name, acc_mode, ndds)) == FAIL)
+        HFPimage_release(name, NULL, NULL);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hopen_image */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hclose_image -- close a HDF file held in memory and get its image
+USAGE
+   intn Hclose_image(file_id, image, size)
+   int32 file_id;          IN: id of a file opened with Hopen_image
+   void **image;           OUT: the final image of the file (may be NULL)
+   int32 *size;            OUT: # of bytes in the image (may be NULL)
+RETURNS
+   returns SUCCEED (0) if successful and FAIL (-1) if failed.
+DESCRIPTION
+   Closes a file opened with Hopen_image() and hands back its image.
+   This must be the last open of the file.  If the file was created or
+   opened for write, the image is a buffer allocated by the library
+   which the caller must free with free(); otherwise it is the image
+   given to Hopen_image().  If 'image' is NULL, the image is discarded.
+
+--------------------------------------------------------------------------*/
+intn
+Hclose_image(int32 file_id, void **image, int32 *size)
+{
+    filerec_t *file_rec; /* file record pointer */
+    char       name[HFILE_IMAGE_NAMELEN];
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    /* Clear errors and check args and all the boring stuff. */
+    HEclear();
+
+    /* convert file id to file rec and check for validity */
+    file_rec = HAatom_object(file_id);
+    if (BADFREC(file_rec) || file_rec->driver->type != HDF_DRIVER_IMAGE)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+    if (file_rec->refcount > 1)
+        HGOTO_ERROR(DFE_OPENAID, FAIL);
+
+    /* The file record goes away with the file */
+    strcpy(name, file_rec->path);
+    if (Hclose(file_id) == FAIL)
+        HGOTO_ERROR(DFE_CANTCLOSE, FAIL);
+
+    if (HFPimage_release(name, image, size) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hclose_image */
+
 /*--------------------------------------------------------------------------
 NAME
    Hexist -- locate an object in an HDF file
@@ -495,8 +700,11 @@ Hexist(int32 file_id, uint16 search_tag, uint16 search_ref)
     int32  find_offset, find_length;
     intn   ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (Hfind(file_id, search_tag, search_ref, &find_tag, &find_ref, &find_offset, &find_length,
                        DF_FORWARD));
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hexist() */
 
@@ -533,6 +741,8 @@ Hinquire(int32 access_id, int32 *pfile_id, uint16 *ptag, uint16 *pref, int32 *pl
     accrec_t *access_rec; /* access record */
     intn      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of access id */
     HEclear();
     access_rec = HAatom_object(access_id);
@@ -558,6 +768,7 @@ Hinquire(int32 access_id, int32 *pfile_id, uint16 *ptag, uint16 *pref, int32 *pl
         *pspecial = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hinquire */
 
@@ -582,6 +793,8 @@ Hfidinquire(int32 file_id, char **fname, intn *faccess, intn *attach)
     filerec_t *file_rec;
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     file_rec = HAatom_object(file_id);
@@ -593,6 +806,7 @@ Hfidinquire(int32 file_id, char **fname, intn *faccess, intn *attach)
     *attach  = file_rec->attach;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hfidinquire */
 
@@ -622,6 +836,8 @@ Hstartread(int32 file_id, uint16 tag, uint16 ref)
     int32 ret; /* AID to return */
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -632,6 +848,7 @@ Hstartread(int32 file_id, uint16 tag, uint16 ref)
     ret_value = ret;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hstartread() */
 
@@ -667,6 +884,8 @@ Hnextread(int32 access_id, uint16 tag, uint16 ref, intn origin)
     int32      new_off, new_len;         /* offset & length of new tag & ref */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of the access id */
     HEclear();
     access_rec = HAatom_object(access_id);
@@ -765,6 +984,7 @@ Hnextread(int32 access_id, uint16 tag, uint16 ref, intn origin)
     access_rec->posn    = 0;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hnextread() */
 
@@ -793,6 +1013,8 @@ Hstartwrite(int32 file_id, uint16 tag, uint16 ref, int32 length)
     int32     ret;        /* AID to return */
     int32     ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -811,6 +1033,7 @@ Hstartwrite(int32 file_id, uint16 tag, uint16 ref, int32 length)
     ret_value = ret;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hstartwrite */
 
@@ -842,6 +1065,8 @@ Hstartaccess(int32 file_id, uint16 tag, uint16 ref, uint32 flags)
     int32      new_off, new_len;         /* offset & length of new tag & ref */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
 
@@ -854,7 +1079,7 @@ Hstartaccess(int32 file_id, uint16 tag, uint16 ref, uint32 flags)
         HGOTO_ERROR(DFE_DENIED, FAIL);
 
     /* get empty slot in access records */
-    access_rec = HIget_access_rec();
+    access_rec = HIget_access_rec(file_rec);
     if (access_rec == NULL)
         HGOTO_ERROR(DFE_TOOMANY, FAIL);
 
@@ -956,6 +1181,7 @@ done:
             HIrelease_accrec_node(access_rec);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hstartaccess */
 
@@ -982,6 +1208,8 @@ Hsetlength(int32 aid, int32 length)
     int32      offset;     /* offset of this data element in file */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
 
@@ -996,8 +1224,13 @@ Hsetlength(int32 aid, int32 length)
     if (BADFREC(file_rec))
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
-    /* place the data element at the end of the file and record its offset */
-    if ((offset = HPgetdiskblock(file_rec, length, FALSE)) == FAIL)
+    /* place the data element in free space, or at the end of the file if
+       it is to grow, and record its offset */
+    if (access_rec->appendable)
+        offset = HIappend_diskblock(file_rec, length);
+    else
+        offset = HPgetdiskblock(file_rec, length);
+    if (offset == FAIL)
         HGOTO_ERROR(DFE_SEEKERROR, FAIL);
 
     /* fill in dd record updating the offset and length of the element */
@@ -1008,6 +1241,7 @@ Hsetlength(int32 aid, int32 length)
     access_rec->new_elem = FALSE;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hsetlength */
 
@@ -1032,6 +1266,8 @@ Happendable(int32 aid)
     accrec_t *access_rec; /* access record */
     intn      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
     if ((access_rec = HAatom_object(aid)) == NULL) /* get the access_rec pointer */
@@ -1042,6 +1278,7 @@ Happendable(int32 aid)
     access_rec->appendable = TRUE;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Happendable */
 
@@ -1123,6 +1360,8 @@ Hseek(int32 access_id, int32 offset, intn origin)
     int32      data_off;            /* offset of the data we are checking */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of this access id */
     HEclear();
 
@@ -1183,6 +1422,7 @@ Hseek(int32 access_id, int32 offset, intn origin)
     access_rec->posn = offset;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hseek() */
 
@@ -1206,6 +1446,8 @@ Htell(int32 access_id)
     accrec_t *access_rec; /* access record */
     int32     ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of this access id */
     HEclear();
 
@@ -1217,6 +1459,7 @@ Htell(int32 access_id)
     ret_value = (int32)access_rec->posn;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Htell() */
 
@@ -1246,6 +1489,8 @@ Hread(int32 access_id, int32 length, void *data)
     int32      data_off;   /* offset of the data we are checking */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of access id */
     HEclear();
     access_rec = HAatom_object(access_id);
@@ -1275,17 +1520,13 @@ Hread(int32 access_id, int32 length, void *data)
     if (HTPinquire(access_rec->ddid, NULL, NULL, &data_off, &data_len) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
-    /* seek to position to start reading and read in data */
-    if (HPseek(file_rec, access_rec->posn + data_off) == FAIL)
-        HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-
     /* length == 0 means to read to end of element, */
     /* if read length exceeds length of elt, read till end of elt */
     if (length == 0 || length + access_rec->posn > data_len)
         length = data_len - access_rec->posn;
 
     /* read in data */
-    if (HP_read(file_rec, data, length) == FAIL)
+    if (HP_read(file_rec, data, length, access_rec->posn + data_off) == FAIL)
         HGOTO_ERROR(DFE_READERROR, FAIL);
 
     /* move the position of the access record */
@@ -1294,9 +1535,366 @@ Hread(int32 access_id, int32 length, void *data)
     ret_value = length;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hread */
 
+/*--------------------------------------------------------------------------
+NAME
+   Hreadptr -- get a pointer to the next segment of a data element
+USAGE
+   int32 Hreadptr(access_id, length, data)
+   int32 access_id;        IN: id of READ access element
+   int32 length;           IN: length of segment to read in
+   const void **data;      OUT: pointer to the data in the file
+RETURNS
+   returns length of segment the pointer covers if successful and FAIL
+   (-1) otherwise
+DESCRIPTION
+   Like Hread(), but instead of copying the next segment of the data
+   element into a user buffer, a pointer to the segment in the file's
+   own image is returned.  This is only possible when the file's driver
+   keeps the file contents in memory (the mmap and memory drivers) and
+   for elements stored contiguously, i.e. not special elements; FAIL is
+   returned otherwise and the caller should fall back to Hread().
+
+   The data is read-only, in the file's byte order, and stays valid
+   until the file is closed or written to.
+
+--------------------------------------------------------------------------*/
+int32
+Hreadptr(int32 access_id, int32 length, const void **data)
+{
+    filerec_t  *file_rec;   /* file record */
+    accrec_t   *access_rec; /* access record */
+    int32       data_len;   /* length of the data we are checking */
+    int32       data_off;   /* offset of the data we are checking */
+    const void *ptr;        /* pointer into the file image */
+    int32       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    /* clear error stack and check validity of access id */
+    HEclear();
+    access_rec = HAatom_object(access_id);
+    if (access_rec == (accrec_t *)NULL || data == NULL || length < 0)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    /* Don't allow reading of "new" elements */
+    if (access_rec->new_elem == TRUE)
+        HGOTO_ERROR(DFE_READERROR, FAIL);
+
+    /* special elements are not stored as one piece in the file */
+    if (access_rec->special)
+        HGOTO_ERROR(DFE_UNSUPPORTED, FAIL);
+
+    /* check validity of file record */
+    file_rec = HAatom_object(access_rec->file_id);
+    if (BADFREC(file_rec))
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+    if (file_rec->driver->map == NULL)
+        HGOTO_ERROR(DFE_UNSUPPORTED, FAIL);
+
+    /* Get the data's offset & length */
+    if (HTPinquire(access_rec->ddid, NULL, NULL, &data_off, &data_len) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+
+    /* length == 0 means to read to end of element, */
+    /* if read length exceeds length of elt, read till end of elt */
+    if (length == 0 || length + access_rec->posn > data_len)
+        length = data_len - access_rec->posn;
+
+    if ((ptr = file_rec->driver->map(file_rec, access_rec->posn + data_off, length)) == NULL)
+        HGOTO_ERROR(DFE_READERROR, FAIL);
+    *data = ptr;
+    file_rec->stats.reads++;
+    file_rec->stats.bytes_read += (uint64_t)length;
+
+    /* move the position of the access record */
+    access_rec->posn += length;
+
+    ret_value = length;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hreadptr */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hreadv -- read segments of many data elements in one call
+USAGE
+   intn Hreadv(reqs, count)
+   hdf_readreq_t *reqs;    IN/OUT: array of read requests
+   intn count;             IN: # of requests in the array
+RETURNS
+   SUCCEED if all requests were satisfied, FAIL otherwise
+DESCRIPTION
+   Reads 'length' bytes from 'offset' in each data element given by the
+   file_id/tag/ref of a request into the request's buffer, and sets the
+   request's 'nread' to the number of bytes read, or FAIL if that request
+   could not be satisfied.  As with Hread(), a length of zero or one which
+   runs past the end of the element reads up to the end of the element.
+
+   This is the same as a Hstartread()/Hseek()/Hread()/Hendaccess() for
+   each request, but no access record is set up for elements which are
+   stored contiguously; the requests are sorted by their position in the
+   file, and requests which are close together are merged into a single
+   vectored read.  All the reads on a file are handed to its driver at
+   once, so drivers which can have many reads in flight (the posix driver
+   with io_uring) don't wait for each in turn.  Special elements (compressed,
+   chunked, linked blocks, ...) are read through an access record as
+   usual.  The requests may refer to different files and to the same
+   element more than once.
+
+   A failed request does not keep the other requests from being read.
+
+--------------------------------------------------------------------------*/
+intn
+Hreadv(hdf_readreq_t *reqs, intn count)
+{
+    hreadv_seg_t  *segs    = NULL; /* requests on non-special elements */
+    hfile_rdreq_t *groups  = NULL; /* the merged reads */
+    intn          *first   = NULL; /* first entry in segs of each merged read */
+    void         **bufs    = NULL; /* buffers of the merged reads */
+    int32         *sizes   = NULL; /* sizes of the buffers of the merged reads */
+    uint8         *scratch = NULL; /* buffer for the gaps in the merged reads */
+    intn           nsegs   = 0;    /* # of entries in segs */
+    intn           ngroups = 0;    /* # of entries in groups */
+    intn           nbufs   = 0;    /* # of entries in bufs and sizes */
+    intn           i, j, k;
+    intn           ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+    if (count < 0 || (count > 0 && reqs == NULL))
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+    if (count == 0)
+        HGOTO_DONE(SUCCEED);
+
+    if ((segs = (hreadv_seg_t *)malloc((size_t)count * sizeof(hreadv_seg_t))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
+    /* Find where in the file each request is, special elements are read
+       right away */
+    for (i = 0; i < count; i++) {
+        reqs[i].nread = FAIL;
+        if (HIreadv_locate(&reqs[i], &segs[nsegs]) == FAIL)
+            continue;
+        if (segs[nsegs].req == NULL)
+            continue; /* nothing left to read */
+        nsegs++;
+    }
+
+    if (nsegs > 0) {
+        /* each read can have a gap before it */
+        if ((bufs = (void **)malloc((size_t)(2 * nsegs) * sizeof(void *))) == NULL ||
+            (sizes = (int32 *)malloc((size_t)(2 * nsegs) * sizeof(int32))) == NULL ||
+            (groups = (hfile_rdreq_t *)malloc((size_t)nsegs * sizeof(hfile_rdreq_t))) == NULL ||
+            (first = (intn *)malloc((size_t)(nsegs + 1) * sizeof(intn))) == NULL ||
+            (scratch = (uint8 *)malloc(HREADV_MAXGAP)) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
+        qsort(segs, (size_t)nsegs, sizeof(hreadv_seg_t), HIreadv_compare);
+
+        /* Merge the reads in the same file, as long as they don't
+           overlap and are close enough */
+        for (i = 0; i < nsegs; i = j) {
+            int32 end = segs[i].offset + segs[i].length; /* end of the merged read */
+
+            first[ngroups]         = i;
+            groups[ngroups].bufs   = bufs + nbufs;
+            groups[ngroups].sizes  = sizes + nbufs;
+            groups[ngroups].offset = segs[i].offset;
+            bufs[nbufs]            = segs[i].req->buf;
+            sizes[nbufs++]         = segs[i].length;
+            for (j = i + 1; j < nsegs; j++) {
+                if (segs[j].file_rec != segs[i].file_rec || segs[j].offset < end ||
+                    segs[j].offset - end > HREADV_MAXGAP)
+                    break;
+                if (segs[j].offset > end) {
+                    bufs[nbufs]    = scratch;
+                    sizes[nbufs++] = segs[j].offset - end;
+                }
+                bufs[nbufs]    = segs[j].req->buf;
+                sizes[nbufs++] = segs[j].length;
+                end            = segs[j].offset + segs[j].length;
+            }
+            groups[ngroups].count = (intn)(bufs + nbufs - groups[ngroups].bufs);
+            ngroups++;
+        }
+        first[ngroups] = nsegs;
+
+        /* Hand each file its reads in one batch */
+        for (i = 0; i < ngroups; i = j) {
+            filerec_t *file_rec = segs[first[i]].file_rec;
+
+            for (j = i + 1; j < ngroups && segs[first[j]].file_rec == file_rec; j++)
+                ;
+            HP_read_batch(file_rec, j - i, groups + i);
+        }
+
+        for (i = 0; i < ngroups; i++) {
+            if (groups[i].status == SUCCEED) {
+                for (k = first[i]; k < first[i + 1]; k++)
+                    segs[k].req->nread = segs[k].length;
+            }
+            else {
+                /* Read them one at a time, so one bad request doesn't
+                   fail its neighbors */
+                for (k = first[i]; k < first[i + 1]; k++)
+                    if (HP_read(segs[k].file_rec, segs[k].req->buf, segs[k].length, segs[k].offset) == SUCCEED)
+                        segs[k].req->nread = segs[k].length;
+            }
+        }
+    }
+
+    for (i = 0; i < count; i++)
+        if (reqs[i].nread == FAIL)
+            HGOTO_ERROR(DFE_READERROR, FAIL);
+
+done:
+    free(segs);
+    free(groups);
+    free(first);
+    free(bufs);
+    free(sizes);
+    free(scratch);
+
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hreadv */
+
+/*--------------------------------------------------------------------------
+NAME
+   HIreadv_locate -- find the part of the file a Hreadv request reads
+USAGE
+   intn HIreadv_locate(req, seg)
+   hdf_readreq_t *req;     IN/OUT: the request
+   hreadv_seg_t *seg;      OUT: the range of the file to read
+RETURNS
+   SUCCEED/FAIL
+DESCRIPTION
+   Looks up the data element of a request without setting up an access
+   record.  For elements stored contiguously 'seg' is set to the range
+   of the file to read; requests on special elements, or which read no
+   bytes at all, are completed right away and the 'req' field of 'seg'
+   is set to NULL.
+
+--------------------------------------------------------------------------*/
+static intn
+HIreadv_locate(hdf_readreq_t *req, hreadv_seg_t *seg)
+{
+    filerec_t *file_rec; /* file record */
+    atom_t     ddid;     /* DD of the element */
+    int32      data_off; /* offset of the element in the file */
+    int32      data_len; /* length of the element */
+    intn       special;  /* whether the element is special */
+    intn       ret_value = SUCCEED;
+
+    seg->req = NULL;
+
+    file_rec = HAatom_object(req->file_id);
+    if (BADFREC(file_rec) || req->buf == NULL || req->offset < 0 || req->length < 0)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    if ((ddid = HTPselect(file_rec, req->tag, req->ref)) == FAIL)
+        HGOTO_ERROR(DFE_NOMATCH, FAIL);
+    special = HTPis_special(ddid);
+    if (HTPinquire(ddid, NULL, NULL, &data_off, &data_len) == FAIL) {
+        HTPendaccess(ddid);
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+    }
+    if (HTPendaccess(ddid) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+
+    if (special) {
+        if ((req->nread = HIreadv_special(req)) == FAIL)
+            HGOTO_DONE(FAIL);
+        HGOTO_DONE(SUCCEED);
+    }
+
+    /* Don't allow reading of "new" elements */
+    if (data_off == INVALID_OFFSET)
+        HGOTO_ERROR(DFE_READERROR, FAIL);
+    if (req->offset > data_len)
+        HGOTO_ERROR(DFE_BADSEEK, FAIL);
+
+    /* length == 0 means to read to end of element, */
+    /* if read length exceeds length of elt, read till end of elt */
+    seg->length = req->length;
+    if (seg->length == 0 || seg->length > data_len - req->offset)
+        seg->length = data_len - req->offset;
+    if (seg->length == 0) {
+        req->nread = 0;
+        HGOTO_DONE(SUCCEED);
+    }
+
+    seg->file_rec = file_rec;
+    seg->offset   = data_off + req->offset;
+    seg->req      = req;
+
+done:
+    return ret_value;
+} /* HIreadv_locate */
+
+/*--------------------------------------------------------------------------
+NAME
+   HIreadv_special -- service a Hreadv request on a special element
+USAGE
+   int32 HIreadv_special(req)
+   hdf_readreq_t *req;     IN: the request
+RETURNS
+   # of bytes read, FAIL otherwise
+DESCRIPTION
+   Special elements are read through an access record and their special
+   functions, as Hread() would.
+
+--------------------------------------------------------------------------*/
+static int32
+HIreadv_special(hdf_readreq_t *req)
+{
+    int32 aid;       /* access id for the element */
+    int32 ret_value; /* # of bytes read */
+
+    if ((aid = Hstartread(req->file_id, req->tag, req->ref)) == FAIL)
+        return FAIL;
+    if (req->offset > 0 && Hseek(aid, req->offset, DF_START) == FAIL)
+        ret_value = FAIL;
+    else
+        ret_value = Hread(aid, req->length, req->buf);
+    if (Hendaccess(aid) == FAIL)
+        ret_value = FAIL;
+
+    return ret_value;
+} /* HIreadv_special */
+
+/*--------------------------------------------------------------------------
+NAME
+   HIreadv_compare -- order Hreadv requests by file and offset
+USAGE
+   int HIreadv_compare(a, b)
+   const void *a, *b;      IN: the hreadv_seg_t's to compare
+RETURNS
+   <0, 0 or >0, as for qsort()
+DESCRIPTION
+   Sorts the requests on each file together, by their offset in the file.
+
+--------------------------------------------------------------------------*/
+static int
+HIreadv_compare(const void *a, const void *b)
+{
+    const hreadv_seg_t *sa = (const hreadv_seg_t *)a;
+    const hreadv_seg_t *sb = (const hreadv_seg_t *)b;
+
+    if (sa->req->file_id != sb->req->file_id)
+        return sa->req->file_id < sb->req->file_id ? -1 : 1;
+    if (sa->offset != sb->offset)
+        return sa->offset < sb->offset ? -1 : 1;
+    return 0;
+} /* HIreadv_compare */
+
 /*--------------------------------------------------------------------------
 NAME
    Hwrite -- write next data segment to data element
@@ -1326,6 +1924,8 @@ Hwrite(int32 access_id, int32 length, const void *data)
     int32      data_off;   /* offset of the data we are checking */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of access id */
     HEclear();
     access_rec = HAatom_object(access_id);
@@ -1346,8 +1946,8 @@ Hwrite(int32 access_id, int32 length, const void *data)
     /* check for a "new" element and make it appendable if so.
        Does this mean every element is by default appendable? */
     if (access_rec->new_elem == TRUE) {
-        Hsetlength(access_id, length); /* make the initial chunk of data */
         access_rec->appendable = TRUE; /* make it appendable */
+        Hsetlength(access_id, length); /* make the initial chunk of data */
     }                                  /* end if */
 
     /* get the offset and length of the element. This should have
@@ -1385,16 +1985,13 @@ Hwrite(int32 access_id, int32 length, const void *data)
             HGOTO_ERROR(DFE_INTERNAL, FAIL);
     } /* end if */
 
-    /* seek and write data */
-    if (HPseek(file_rec, access_rec->posn + data_off) == FAIL)
-        HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-
-    if (HP_write(file_rec, data, length) == FAIL)
+    /* write data */
+    if (HP_write(file_rec, data, length, access_rec->posn + data_off) == FAIL)
         HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
     /* update end of file pointer? */
-    if (file_rec->f_cur_off > file_rec->f_end_off)
-        file_rec->f_end_off = file_rec->f_cur_off;
+    if (access_rec->posn + data_off + length > file_rec->f_end_off)
+        file_rec->f_end_off = access_rec->posn + data_off + length;
 
     /* update position of access in elt */
     access_rec->posn += length;
@@ -1402,6 +1999,7 @@ Hwrite(int32 access_id, int32 length, const void *data)
     ret_value = length;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hwrite */
 
@@ -1426,12 +2024,15 @@ HDgetc(int32 access_id)
     uint8 c         = (uint8)FAIL; /* character read in */
     intn  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (Hread(access_id, 1, &c) == FAIL)
         HGOTO_ERROR(DFE_READERROR, FAIL);
 
     ret_value = (intn)c;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* HDgetc */
 
@@ -1456,12 +2057,15 @@ HDputc(uint8 c, int32 access_id)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (Hwrite(access_id, 1, &c) == FAIL)
         HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
     ret_value = (intn)c;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* HDputc */
 
@@ -1489,6 +2093,8 @@ Hendaccess(int32 access_id)
     accrec_t  *access_rec = NULL; /* access record */
     intn       ret_value  = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of access id */
     HEclear();
     if ((access_rec = HAremove_atom(access_id)) == NULL)
@@ -1518,6 +2124,7 @@ done:
             HIrelease_accrec_node(access_rec);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hendaccess */
 
@@ -1546,6 +2153,8 @@ Hgetelement(int32 file_id, uint16 tag, uint16 ref, uint8 *data)
     int32 length;           /* length of this elt */
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1568,6 +2177,7 @@ done:
             Hendaccess(access_id);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hgetelement() */
 
@@ -1595,6 +2205,8 @@ Hputelement(int32 file_id, uint16 tag, uint16 ref, const uint8 *data, int32 leng
     int32 access_id = FAIL; /* access record id */
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1614,6 +2226,7 @@ done:
             Hendaccess(access_id);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hputelement() */
 
@@ -1643,6 +2256,8 @@ Hlength(int32 file_id, uint16 tag, uint16 ref)
     int32 length    = FAIL; /* length of elt inquired */
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1661,6 +2276,7 @@ Hlength(int32 file_id, uint16 tag, uint16 ref)
     ret_value = length;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hlength */
 
@@ -1693,6 +2309,8 @@ Hoffset(int32 file_id, uint16 tag, uint16 ref)
     int32 offset    = FAIL; /* offset of elt inquired */
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1710,6 +2328,7 @@ Hoffset(int32 file_id, uint16 tag, uint16 ref)
     ret_value = offset;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hoffset */
 
@@ -1731,25 +2350,34 @@ DESCRIPTION
 intn
 Hishdf(const char *filename)
 {
-    intn       ret;
-    hdf_file_t fp;
-    intn       ret_value = TRUE;
+    filerec_t file_rec;
+    intn      ret_value = TRUE;
+
+    H4_API_LOCK;
 
     /* Search for a matching slot in the already open files. */
     if (HAsearch_atom(FIDGROUP, HPcompare_filerec_path, filename) != NULL)
         HGOTO_DONE(TRUE);
 
-    fp = (hdf_file_t)HI_OPEN(filename, DFACC_READ);
-    if (OPENERR(fp)) {
+    /* Only the magic number is needed, so plain stdio will do, unless
+       the file is a memory image */
+    memset(&file_rec, 0, sizeof(filerec_t));
+    if ((file_rec.path = strdup(filename)) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FALSE);
+    file_rec.driver = HFPget_driver(filename);
+    if (file_rec.driver->type != HDF_DRIVER_IMAGE)
+        file_rec.driver = HFPfind_driver(HDF_DRIVER_STDIO);
+    if (file_rec.driver->open(&file_rec, DFACC_READ) == FAIL) {
         ret_value = FALSE;
     }
     else {
-        ret = HIvalid_magic(fp);
-        HI_CLOSE(fp);
-        ret_value = (int)ret;
+        ret_value = HIvalid_magic(&file_rec);
+        file_rec.driver->close(&file_rec);
     }
+    free(file_rec.path);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hishdf */
 
@@ -1775,6 +2403,8 @@ Htrunc(int32 aid, int32 trunc_len)
     int32     data_off;   /* offset of the data we are checking */
     int32     ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of access id */
     HEclear();
     access_rec = HAatom_object(aid);
@@ -1809,6 +2439,7 @@ Htrunc(int32 aid, int32 trunc_len)
         HGOTO_ERROR(DFE_BADLEN, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Htrunc() */
 
@@ -1861,6 +2492,8 @@ DESCRIPTION
    the same.  Thus there is no real use for Hsync().  In the future,
    things may be buffered before being written out at which time
    Hsync() will be useful to sync up the on-disk representation.
+   Hsync() does nothing for a file after Hdefersync(), the changed DD
+   blocks are then only written out by Hclose().
 NOTE
    First tests of caching DD's until close.
 
@@ -1871,16 +2504,23 @@ Hsync(int32 file_id)
     filerec_t *file_rec; /* file record */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check validity of file record and get dd ptr */
     file_rec = HAatom_object(file_id);
     if (BADFREC(file_rec))
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
+    /* leave it to Hclose if asked to */
+    if (file_rec->defer_sync)
+        HGOTO_DONE(SUCCEED);
+
     /* check whether to flush the file info */
     if (HIsync(file_rec) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hsync */
 
@@ -1904,6 +2544,8 @@ Hcache(int32 file_id, intn cache_on)
     filerec_t *file_rec; /* file record */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (file_id == CACHE_ALL_FILES) /* check whether to modify the default cache */
     {                               /* set the default caching for all further files Hopen'ed */
         default_cache = (cache_on != 0 ? TRUE : FALSE);
@@ -1923,9 +2565,446 @@ Hcache(int32 file_id, intn cache_on)
     } /* end else */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hcache */
 
+/*--------------------------------------------------------------------------
+NAME
+   Hdefersync -- leave flushing the DD list of a file to Hclose
+USAGE
+   intn Hdefersync(file_id,defer)
+           int32 file_id;            IN: id of file
+           intn defer;               IN: whether to defer the flushing or not
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   When set, Hsync() does nothing for the file and the changed DD blocks
+   are only written out when the file is closed.  This saves the cost of
+   flushing the DD list for programs which call Hsync often, at the price
+   of a file which is not up to date on disk until it is closed.
+   Deferring turns on the caching of the DD list for the file (see
+   Hcache), which stays on when deferring is turned off again.  Turning
+   caching off with Hcache afterwards flushes the DD list, and DDs are
+   then written as they change again.
+   If file_id is set to CACHE_ALL_FILES, then the value of defer is used
+   as the default for all the files opened afterwards.
+--------------------------------------------------------------------------*/
+intn
+Hdefersync(int32 file_id, intn defer)
+{
+    filerec_t *file_rec; /* file record */
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    if (file_id == CACHE_ALL_FILES) /* check whether to modify the default */
+        default_defer_sync = (defer != 0 ? TRUE : FALSE);
+    else {
+        /* check validity of file record */
+        file_rec = HAatom_object(file_id);
+        if (BADFREC(file_rec))
+            HGOTO_ERROR(DFE_ARGS, FAIL);
+        file_rec->defer_sync = (defer != 0 ? TRUE : FALSE);
+        if (file_rec->defer_sync)
+            file_rec->cache = TRUE;
+    } /* end else */
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hdefersync */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hreadahead -- set the size of the readahead window for a file
+USAGE
+   intn Hreadahead(file_id,size)
+           int32 file_id;            IN: id of file
+           int32 size;               IN: # of bytes to read ahead, 0 for none
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   When a file opened read-only is read sequentially, the data which comes
+   next is read into a window of 'size' bytes by a background thread, so
+   the I/O overlaps with the processing of the data already read.  A size
+   of 0 turns this off for the file.
+   If file_id is set to CACHE_ALL_FILES, then 'size' is used as the default
+   for all further files Hopen'ed, which is HDF_READAHEAD_SIZE initially.
+   Does nothing when the library is built without readahead support.
+--------------------------------------------------------------------------*/
+intn
+Hreadahead(int32 file_id, int32 size)
+{
+    filerec_t *file_rec; /* file record */
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+
+    if (size < 0)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    if (file_id == CACHE_ALL_FILES)
+        default_readahead = size;
+    else {
+        file_rec = HAatom_object(file_id);
+        if (BADFREC(file_rec))
+            HGOTO_ERROR(DFE_ARGS, FAIL);
+
+        /* A new window size takes effect when the readahead starts over */
+        if (size != file_rec->ra_size)
+            HRAPstop(file_rec);
+        file_rec->ra_size = size;
+    }
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hreadahead */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hsetchunkcache -- size the chunk cache shared by the chunked elements of a file
+USAGE
+   intn Hsetchunkcache(file_id,size,policy)
+           int32 file_id;            IN: id of file
+           int32 size;               IN: # of bytes of chunks to cache, 0 for none
+           intn  policy;             IN: HDF_CHUNK_CACHE_LRU, _CLOCK or _ARC
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   The chunks of all the chunked elements (SDSs, GR images...) of a file
+   are kept in one cache of 'size' bytes, rather than each element keeping
+   its own number of chunks (see HMCsetMaxcache); when the cache is full,
+   'policy' picks the chunk to give up, from any of the elements.  A size
+   of 0 goes back to a cache per element.
+   A smaller size evicts chunks (writing the modified ones out) until the
+   cache fits; a new policy, or a size set when there was none, takes
+   effect for the elements accessed afterwards.
+   If file_id is set to CACHE_ALL_FILES, then 'size' and 'policy' are used
+   as the default for all further files Hopen'ed, which is 0 initially.
+--------------------------------------------------------------------------*/
+intn
+Hsetchunkcache(int32 file_id, int32 size, intn policy)
+{
+    filerec_t *file_rec; /* file record */
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+
+    if (size < 0 || policy < HDF_CHUNK_CACHE_LRU || policy > HDF_CHUNK_CACHE_ARC)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    if (file_id == CACHE_ALL_FILES) {
+        default_chunk_cache_size   = size;
+        default_chunk_cache_policy = policy;
+    }
+    else {
+        file_rec = HAatom_object(file_id);
+        if (BADFREC(file_rec))
+            HGOTO_ERROR(DFE_ARGS, FAIL);
+
+        /* The elements using the cache keep it until they are done with
+           it, unless only its size changes */
+        if (file_rec->chk_pool != NULL) {
+            if (size > 0 && policy == file_rec->chk_cache_policy) {
+                if (mcache_pool_set_size(file_rec->chk_pool, (size_t)size) == FAIL)
+                    HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+            }
+            else {
+                mcache_pool_release(file_rec->chk_pool);
+                file_rec->chk_pool = NULL;
+            }
+        }
+        file_rec->chk_cache_size   = size;
+        file_rec->chk_cache_policy = policy;
+    }
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hsetchunkcache */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hgetchunkcache -- get the size and use of the chunk cache of a file
+USAGE
+   intn Hgetchunkcache(file_id,size,policy,used)
+           int32 file_id;            IN: id of file
+           int32 *size;              OUT: # of bytes of chunks to cache
+           intn  *policy;            OUT: eviction policy
+           int32 *used;              OUT: # of bytes of chunks cached now
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   Gets the settings of the chunk cache shared by the chunked elements of
+   a file (see Hsetchunkcache), and how many bytes of chunks it holds.
+   Any of the OUT arguments may be NULL.
+--------------------------------------------------------------------------*/
+intn
+Hgetchunkcache(int32 file_id, int32 *size, intn *policy, int32 *used)
+{
+    filerec_t *file_rec; /* file record */
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+
+    file_rec = HAatom_object(file_id);
+    if (BADFREC(file_rec))
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    if (size != NULL)
+        *size = file_rec->chk_cache_size;
+    if (policy != NULL)
+        *policy = file_rec->chk_cache_policy;
+    if (used != NULL)
+        *used = (int32)mcache_pool_get_used(file_rec->chk_pool);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hgetchunkcache */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hsetchunkthreads -- set the # of threads (de)coding the chunks of a file
+USAGE
+   intn Hsetchunkthreads(file_id,nthreads)
+           int32 file_id;            IN: id of file
+           intn  nthreads;           IN: # of threads, 0 or 1 for none
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   When a read of a chunked element (SDreaddata, GRreadimage...) needs
+   many compressed chunks which are not in the chunk cache, their data is
+   read in one batch and decompressed on up to 'nthreads' threads at the
+   same time, the calling one included, before being copied to the
+   caller's buffer.  Likewise, the new chunks which the chunk cache pages
+   out are kept until there are enough of them to be compressed on the
+   threads at the same time, then written out in the order they were
+   paged out.  Only chunks compressed with gzip 'deflate' are
+   (de)compressed this way; the others are (de)compressed one after the
+   other by the calling thread as before.  The threads are started the
+   first time they are needed and kept until the library shuts down.
+   If file_id is set to CACHE_ALL_FILES, then 'nthreads' is used as the
+   default for all further files Hopen'ed, which is 0 initially.  It has
+   no effect if the library was built without worker threads.
+--------------------------------------------------------------------------*/
+intn
+Hsetchunkthreads(int32 file_id, intn nthreads)
+{
+    filerec_t *file_rec; /* file record */
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+
+    if (nthreads < 0 || nthreads > HWP_MAX_THREADS + 1)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    if (file_id == CACHE_ALL_FILES)
+        default_chunk_threads = nthreads;
+    else {
+        file_rec = HAatom_object(file_id);
+        if (BADFREC(file_rec))
+            HGOTO_ERROR(DFE_ARGS, FAIL);
+        file_rec->chk_threads = nthreads;
+    }
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hsetchunkthreads */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hgetiostats -- get the I/O statistics of a file
+USAGE
+   intn Hgetiostats(file_id,stats)
+           int32 file_id;            IN: id of file
+           hdf_iostats_t *stats;     OUT: the statistics
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   Gets the counts of the raw I/O done on a file since it was opened, or
+   since the last Hresetiostats: the reads, writes and batches of reads
+   handed to the file driver and the bytes they moved, the seeks the
+   driver did or skipped, the bytes served from the readahead window, the
+   DD blocks read and the time spent waiting for all of this.  All opens
+   of the same file share the statistics.
+--------------------------------------------------------------------------*/
+intn
+Hgetiostats(int32 file_id, hdf_iostats_t *stats)
+{
+    filerec_t *file_rec; /* file record */
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+
+    if (stats == NULL)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    file_rec = HAatom_object(file_id);
+    if (BADFREC(file_rec))
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    *stats = file_rec->stats;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hgetiostats */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hresetiostats -- reset the I/O statistics of a file
+USAGE
+   intn Hresetiostats(file_id)
+           int32 file_id;            IN: id of file
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   Sets all the I/O statistics of a file (see Hgetiostats) back to 0.
+--------------------------------------------------------------------------*/
+intn
+Hresetiostats(int32 file_id)
+{
+    filerec_t *file_rec; /* file record */
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+
+    file_rec = HAatom_object(file_id);
+    if (BADFREC(file_rec))
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    memset(&file_rec->stats, 0, sizeof(hdf_iostats_t));
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hresetiostats */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hsetdriver -- set the low-level file driver
+USAGE
+   intn Hsetdriver(driver)
+           intn driver;              IN: HDF_DRIVER_xxx code of the driver
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   Sets the low-level driver used for the raw I/O of all files opened or
+   created from now on.  Files which are already open keep the driver they
+   were opened with.  The available drivers are:
+      HDF_DRIVER_STDIO  - C buffered I/O (the default)
+      HDF_DRIVER_POSIX  - unbuffered POSIX I/O, with pread/pwrite
+      HDF_DRIVER_MEMORY - the whole file is kept in memory and written
+                          back when the file is flushed or closed
+      HDF_DRIVER_MMAP   - files opened read-only are memory-mapped; other
+                          files are accessed as with HDF_DRIVER_POSIX
+                          (not available on all platforms)
+   With the memory and mmap drivers, Hreadptr can return pointers to the
+   data instead of copying it.
+   If Hsetdriver is never called, the HDF4_DRIVER environment variable
+   ("stdio", "posix", "memory" or "mmap") selects the default driver.
+--------------------------------------------------------------------------*/
+intn
+Hsetdriver(intn driver)
+{
+    intn ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+
+    if (HFPset_default_driver(driver) == FAIL)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hsetdriver */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hsetmetaindex -- keep metadata index sidecars for files
+USAGE
+   intn Hsetmetaindex(enable)
+           intn enable;              IN: TRUE to use the index, FALSE not to
+RETURNS
+   returns SUCCEED (0)
+DESCRIPTION
+   With the metadata index on, a file opened read-only from now on gets a
+   sidecar file (named after the file with ".hdx" appended) holding a copy
+   of its DD blocks and metadata elements: vgroups, vdata headers, scientific
+   dataset descriptions, annotations and the like.  The sidecar is written
+   when the file is closed, and later opens of the file read it in one go
+   instead of reading each of these from the file, which makes opening
+   large files with many objects much faster.
+
+   A sidecar is only used while the file is unchanged: files which were
+   modified since (their size, modification time or first DD block differ)
+   get a new one.  Files opened for write, and files read with the memory
+   or mmap drivers, never use the index.
+   If Hsetmetaindex is never called, the index is used when the
+   HDF4_METAINDEX environment variable is set to anything other than "0".
+--------------------------------------------------------------------------*/
+intn
+Hsetmetaindex(intn enable)
+{
+    H4_API_LOCK;
+
+    HEclear();
+
+    HIXPset(enable);
+
+    H4_API_UNLOCK;
+    return SUCCEED;
+} /* Hsetmetaindex */
+
+/*--------------------------------------------------------------------------
+NAME
+   Hgetdriver -- get the low-level file driver of a file
+USAGE
+   intn Hgetdriver(file_id)
+           int32 file_id;            IN: id of file
+RETURNS
+   returns the HDF_DRIVER_xxx code of the driver used by the file if
+   successful, FAIL (-1) otherwise
+--------------------------------------------------------------------------*/
+intn
+Hgetdriver(int32 file_id)
+{
+    filerec_t *file_rec; /* file record */
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+
+    file_rec = HAatom_object(file_id);
+    if (BADFREC(file_rec))
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    ret_value = file_rec->driver->type;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* Hgetdriver */
+
 /*--------------------------------------------------------------------------
 NAME
    HDvalidfid -- check if a file ID is valid
@@ -1984,6 +3063,8 @@ Hsetaccesstype(int32 access_id, uintn accesstype)
     accrec_t *access_rec; /* access record */
     intn      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of this access id */
     HEclear();
 
@@ -2007,6 +3088,7 @@ Hsetaccesstype(int32 access_id, uintn accesstype)
         ret_value = HXPsetaccesstype(access_rec);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hsetacceesstype() */
 
@@ -2188,6 +3270,8 @@ HPend(void)
 
     HPbitshutdown();
     HXPshutdown();
+    HFPshutdown();
+    HWPshutdown();
     Hshutdown();
     HEshutdown();
     HAshutdown();
@@ -2213,9 +3297,7 @@ HIextend_file(filerec_t *file_rec)
     uint8 temp      = 0;
     intn  ret_value = SUCCEED;
 
-    if (HPseek(file_rec, file_rec->f_end_off) == FAIL)
-        HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-    if (HP_write(file_rec, &temp, 1) == FAIL)
+    if (HP_write(file_rec, &temp, 1, file_rec->f_end_off) == FAIL)
         HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
 done:
@@ -2252,9 +3334,7 @@ HIget_function_table(accrec_t *access_rec)
     if (HTPinquire(access_rec->ddid, NULL, NULL, &data_off, NULL) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, NULL);
 
-    if (HPseek(file_rec, data_off) == FAIL)
-        HGOTO_ERROR(DFE_SEEKERROR, NULL);
-    if (HP_read(file_rec, lbuf, (int)2) == FAIL)
+    if (HP_read(file_rec, lbuf, (int)2, data_off) == FAIL)
         HGOTO_ERROR(DFE_READERROR, NULL);
 
     /* using special code, look up function table in associative table */
@@ -2481,6 +3561,8 @@ Hgetfileversion(int32 file_id, uint32 *majorv, uint32 *minorv, uint32 *release,
     filerec_t *file_rec;
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     file_rec = HAatom_object(file_id);
@@ -2497,6 +3579,7 @@ Hgetfileversion(int32 file_id, uint32 *majorv, uint32 *minorv, uint32 *release,
         HIstrncpy(string, file_rec->version.string, LIBVSTR_LEN + 1);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hgetfileversion */
 
@@ -2583,6 +3666,10 @@ HIget_filerec_node(const char *path)
         if ((ret_value->path = (char *)strdup(path)) == NULL)
             HGOTO_ERROR(DFE_NOSPACE, NULL);
 
+        /* The metadata of the file is kept in an arena of its own */
+        if ((ret_value->arena = ARcreate_arena(0)) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, NULL);
+
         /* Initialize annotation stuff */
         ret_value->an_tree[AN_DATA_LABEL] = NULL;
         ret_value->an_tree[AN_DATA_DESC]  = NULL;
@@ -2592,6 +3679,10 @@ HIget_filerec_node(const char *path)
         ret_value->an_num[AN_DATA_DESC]   = -1;
         ret_value->an_num[AN_FILE_LABEL]  = -1;
         ret_value->an_num[AN_FILE_DESC]   = -1;
+
+#ifdef H4_HAVE_THREADSAFE
+        pthread_mutex_init(&ret_value->lock, NULL);
+#endif
     } /* end if */
 
 done:
@@ -2614,10 +3705,19 @@ static intn
 HIrelease_filerec_node(filerec_t *file_rec)
 {
     /* Close file if it's opened */
-    if (file_rec->file != NULL)
-        HI_CLOSE(file_rec->file);
+    HRAPstop(file_rec);
+    HIXPfree(file_rec);
+    HFSPdestroy(file_rec);
+    mcache_pool_release(file_rec->chk_pool);
+    if (file_rec->drv_info != NULL)
+        file_rec->driver->close(file_rec);
 
     /* Free all the components of the file record */
+#ifdef H4_HAVE_THREADSAFE
+    pthread_mutex_destroy(&file_rec->lock);
+#endif
+    if (file_rec->arena != NULL)
+        ARdestroy_arena(file_rec->arena);
     free(file_rec->path);
     free(file_rec);
 
@@ -2731,27 +3831,23 @@ done:
  NAME
        HIvalid_magic -- verify the magic number in a file
  USAGE
-       int32 HIvalid_magic(path)
-       hdf_file_t file;             IN: FILE pointer
+       int32 HIvalid_magic(file_rec)
+       filerec_t *file_rec;         IN: file record of an opened file
  RETURNS
        TRUE if valid magic number else FALSE
  DESCRIPTION
-       Given an open file pointer, see if the first four bytes of the
+       Given an opened file, see if the first four bytes of the
        file are the HDF "magic number" HDFMAGIC
 
 --------------------------------------------------------------------------*/
 static intn
-HIvalid_magic(hdf_file_t file)
+HIvalid_magic(filerec_t *file_rec)
 {
     char b[MAGICLEN];       /* Temporary buffer */
     intn ret_value = FALSE; /* FAIL */
 
-    /* Seek to beginning of the file. */
-    if (HI_SEEK(file, 0) == FAIL)
-        HGOTO_ERROR(DFE_SEEKERROR, FALSE);
-
-    /* Read in magic cookie and compare. */
-    if (HI_READ(file, b, MAGICLEN) == FAIL)
+    /* Read in magic cookie from the beginning of the file and compare. */
+    if (HP_read(file_rec, b, MAGICLEN, 0) == FAIL)
         HGOTO_ERROR(DFE_READERROR, FALSE);
 
     if (NSTREQ(b, HDFMAGIC, MAGICLEN))
@@ -2765,32 +3861,26 @@ done:
  NAME
     HIget_access_rec -- allocate a new access record
  USAGE
-    int HIget_access_rec(void)
+    int HIget_access_rec(file_rec)
+    filerec_t *file_rec;    IN: file the record is for
  RETURNS
     returns access_record pointer or NULL if failed.
  DESCRIPTION
-        Return an pointer to a new access_rec to use for a new AID.
+        Return an pointer to a new access_rec to use for a new AID.  The
+        record is taken from the arena of the file, where the records of
+        the AIDs ended before are reused.
 
 --------------------------------------------------------------------------*/
 accrec_t *
-HIget_access_rec(void)
+HIget_access_rec(filerec_t *file_rec)
 {
     accrec_t *ret_value = NULL;
 
     HEclear();
 
-    /* Grab from free list if possible */
-    if (accrec_free_list != NULL) {
-        ret_value        = accrec_free_list;
-        accrec_free_list = accrec_free_list->next;
-    } /* end if */
-    else {
-        if ((ret_value = (accrec_t *)malloc(sizeof(accrec_t))) == NULL)
-            HGOTO_ERROR(DFE_NOSPACE, NULL);
-    } /* end else */
-
-    /* Initialize to zeros */
-    memset(ret_value, 0, sizeof(accrec_t));
+    if ((ret_value = (accrec_t *)ARcalloc(file_rec->arena, sizeof(accrec_t))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, NULL);
+    ret_value->arena = file_rec->arena;
 
 done:
     return ret_value;
@@ -2801,7 +3891,7 @@ done:
      HIrelease_accrec_node - Releases an atom node
 
  DESCRIPTION
-    Puts an accrec node into the free list
+    Gives an accrec node back to the arena of its file
 
  RETURNS
     No return value
@@ -2810,9 +3900,7 @@ done:
 void
 HIrelease_accrec_node(accrec_t *acc)
 {
-    /* Insert the atom at the beginning of the free list */
-    acc->next        = accrec_free_list;
-    accrec_free_list = acc;
+    ARfree(acc->arena, acc, sizeof(accrec_t));
 } /* end HIrelease_accrec_node() */
 
 /*--------------------------------------------------------------------------
@@ -2933,28 +4021,56 @@ USAGE
    int32 HPgetdiskblock(file_rec, block_size)
    filerec_t *file_rec;     IN: ptr to the file record
    int32 block_size;        IN: size of the block needed
-   intn moveto;             IN: whether to move the file position
-                                to the allocated position or leave
-                                it undefined.
 RETURNS
    returns offset of block in the file if successful, FAIL (-1) if failed.
 DESCRIPTION
-   Used to "allocate" space in the file.  Currently, it just appends
-   blocks to the end of the file willy-nilly.  At some point in the
-   future, this could be changed to use a "real" free-list of empty
-   blocks in the file and dole those out.
+   Used to "allocate" space in the file.  Space given back with
+   HPfreediskblock is used first (see hfilespace.c), else the block is
+   appended to the end of the file.
 
 -------------------------------------------------------------------------*/
 int32
-HPgetdiskblock(filerec_t *file_rec, int32 block_size, intn moveto)
+HPgetdiskblock(filerec_t *file_rec, int32 block_size)
 {
-    uint8 temp;
     int32 ret_value = SUCCEED;
 
     /* check for valid arguments */
     if (file_rec == NULL || block_size < 0)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
+#ifndef DISKBLOCK_DEBUG
+    /* reuse free space if there is a large enough block of it */
+    if (block_size > 0 && (ret_value = HFSPalloc(file_rec, block_size)) != FAIL)
+        HGOTO_DONE(ret_value);
+#endif /* DISKBLOCK_DEBUG */
+
+    if ((ret_value = HIappend_diskblock(file_rec, block_size)) == FAIL)
+        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+
+done:
+    return ret_value;
+} /* HPgetdiskblock() */
+
+/*-----------------------------------------------------------------------
+NAME
+   HIappend_diskblock --- Get a block at the end of the file.
+USAGE
+   int32 HIappend_diskblock(file_rec, block_size)
+   filerec_t *file_rec;     IN: ptr to the file record
+   int32 block_size;        IN: size of the block needed
+RETURNS
+   returns offset of block in the file if successful, FAIL (-1) if failed.
+DESCRIPTION
+   Appends a block to the end of the file, for HPgetdiskblock and for
+   elements which are to grow and so have to stay at the end.
+
+-------------------------------------------------------------------------*/
+static int32
+HIappend_diskblock(filerec_t *file_rec, int32 block_size)
+{
+    uint8 temp      = 0;
+    int32 ret_value = SUCCEED;
+
 #ifdef DISKBLOCK_DEBUG
     block_size += (DISKBLOCK_HSIZE + DISKBLOCK_TSIZE);
     /* get the offset of the allocated block */
@@ -2971,38 +4087,28 @@ HPgetdiskblock(filerec_t *file_rec, int32 block_size, intn moveto)
             file_rec->dirty |= FILE_END_DIRTY;
         else {
             /* Write the debugging head & tail to the file block allocated */
-            if (HPseek(file_rec, file_rec->f_end_off) == FAIL)
-                HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-            if (HP_write(file_rec, diskblock_header, DISKBLOCK_HSIZE) == FAIL)
+            if (HP_write(file_rec, diskblock_header, DISKBLOCK_HSIZE, file_rec->f_end_off) == FAIL)
                 HGOTO_ERROR(DFE_WRITEERROR, FAIL);
-            if (HPseek(file_rec, file_rec->f_end_off + block_size - DISKBLOCK_TSIZE) == FAIL)
-                HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-            if (HP_write(file_rec, diskblock_tail, DISKBLOCK_TSIZE) == FAIL)
+            if (HP_write(file_rec, diskblock_tail, DISKBLOCK_TSIZE,
+                         file_rec->f_end_off + block_size - DISKBLOCK_TSIZE) == FAIL)
                 HGOTO_ERROR(DFE_WRITEERROR, FAIL);
         }               /* end else */
 #else                   /* DISKBLOCK_DEBUG */
         if (file_rec->cache)
             file_rec->dirty |= FILE_END_DIRTY;
         else {
-            if (HPseek(file_rec, ret_value + block_size - 1) == FAIL)
-                HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-            if (HP_write(file_rec, &temp, 1) == FAIL)
+            if (HP_write(file_rec, &temp, 1, ret_value + block_size - 1) == FAIL)
                 HGOTO_ERROR(DFE_WRITEERROR, FAIL);
         } /* end else */
-#endif                  /* DISKBLOCK_DEBUG */
-    }                   /* end if */
-    if (moveto == TRUE) /* move back to the beginning of the element */
-    {
-        if (HPseek(file_rec, ret_value) == FAIL)
-            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-    } /* end if */
+#endif    /* DISKBLOCK_DEBUG */
+    }     /* end if */
 
     /* incr. offset of end of file */
     file_rec->f_end_off += block_size;
 
 done:
     return ret_value;
-} /* HPgetdiskblock() */
+} /* HIappend_diskblock() */
 
 /*-----------------------------------------------------------------------
 NAME
@@ -3015,9 +4121,8 @@ USAGE
 RETURNS
    returns SUCCEED (0) if successful, FAIL (-1) if failed.
 DESCRIPTION
-   Used to "release" space in the file.  Currently, it does nothing.
-   At some point in the future, this could be changed to add the block
-   to a "real" free-list of empty blocks in the file and manage those.
+   Used to "release" space in the file, for HPgetdiskblock to hand out
+   again.  The caller must make sure no other element uses the space.
 
 -------------------------------------------------------------------------*/
 intn
@@ -3025,10 +4130,19 @@ HPfreediskblock(filerec_t *file_rec, int32 block_off, int32 block_size)
 {
     intn ret_value = SUCCEED;
 
-    (void)file_rec;
+    /* check for valid arguments */
+    if (file_rec == NULL)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+#ifndef DISKBLOCK_DEBUG
+    if (block_off != INVALID_OFFSET && block_size > 0)
+        HFSPfree(file_rec, block_off, block_size);
+#else  /* DISKBLOCK_DEBUG */
     (void)block_off;
     (void)block_size;
+#endif /* DISKBLOCK_DEBUG */
 
+done:
     return ret_value;
 } /* HPfreediskblock() */
 
@@ -3129,52 +4243,50 @@ done:
 intn
 Hshutdown(void)
 {
-    accrec_t *curr;
-
-    /* Release the free-list if it exists */
-    if (accrec_free_list != NULL) {
-        while (accrec_free_list != NULL && accrec_free_list != accrec_free_list->next) {
-            curr             = accrec_free_list;
-            accrec_free_list = accrec_free_list->next;
-            curr->next       = NULL;
-            free(curr);
-        }
-    }
-
+    /* Nothing left: the access records are kept in the arenas of the files */
     return SUCCEED;
 } /* end Hshutdown() */
 
-/* #define HFILE_SEEKINFO */
-#ifdef HFILE_SEEKINFO
-static uint32 seek_taken       = 0;
-static uint32 seek_avoided     = 0;
-static uint32 write_force_seek = 0;
-static uint32 read_force_seek  = 0;
-
-void
-Hdumpseek(void)
+/* The time in seconds from some fixed point, for the I/O statistics */
+static float64
+HIiotime(void)
 {
-    printf("Seeks taken=%lu\n", (unsigned long)seek_taken);
-    printf("Seeks avoided=%lu\n", (unsigned long)seek_avoided);
-    printf("# of times write forced a seek=%lu\n", (unsigned long)write_force_seek);
-    printf("# of times read forced a seek=%lu\n", (unsigned long)read_force_seek);
-} /* Hdumpseek() */
-#endif /* HFILE_SEEKINFO */
+#if defined(H4_HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0.0;
+    return (float64)ts.tv_sec + (float64)ts.tv_nsec * 1.0e-9;
+#elif defined(H4_HAVE_SYS_TIME_H)
+    struct timeval tv;
+
+    if (gettimeofday(&tv, NULL) != 0)
+        return 0.0;
+    return (float64)tv.tv_sec + (float64)tv.tv_usec * 1.0e-6;
+#else
+    return 0.0;
+#endif
+} /* end HIiotime() */
 
 /*--------------------------------------------------------------------------
  NAME
     HP_read
  PURPOSE
-    Alias for HI_READ on HDF files.
+    Read from an HDF file through its driver.
  USAGE
-    intn HP_read(file_rec,buf,bytes)
+    intn HP_read(file_rec,buf,bytes,offset)
         filerec_t * file_rec;   IN: Pointer to the HDF file record
-        void * buf;              IN: Pointer to the buffer to read data into
+        void * buf;             IN: Pointer to the buffer to read data into
         int32 bytes;            IN: # of bytes to read
+        int32 offset;           IN: offset in the file to read from
  RETURNS
     Returns SUCCEED/FAIL
  DESCRIPTION
-    Function to wrap around HI_READ
+    Function to wrap around the driver's pread callback.  All I/O on an
+    HDF file is positional, so there is no file position shared between
+    callers to keep track of.  Whatever part of the read is already in
+    the readahead window of the file (see hfilera.c) is copied from there
+    instead.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
     Should only be called by HDF low-level routines
@@ -3182,41 +4294,48 @@ Hdumpseek(void)
  REVISION LOG
 --------------------------------------------------------------------------*/
 intn
-HP_read(filerec_t *file_rec, void *buf, int32 bytes)
+HP_read(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
 {
-    intn ret_value = SUCCEED;
+    float64 start = HIiotime();
+    int32   done;
+    intn    ret_value = SUCCEED;
 
-    /* Check for switching file access operations */
-    if (file_rec->last_op == H4_OP_WRITE || file_rec->last_op == H4_OP_UNKNOWN) {
-#ifdef HFILE_SEEKINFO
-        read_force_seek++;
-#endif /* HFILE_SEEKINFO */
-        file_rec->last_op = H4_OP_UNKNOWN;
-        if (HPseek(file_rec, file_rec->f_cur_off) == FAIL)
-            HGOTO_ERROR(DFE_INTERNAL, FAIL);
-    } /* end if */
+    if (file_rec->idx != NULL && HIXPread(file_rec, buf, bytes, offset)) {
+        file_rec->stats.idx_bytes += (uint64_t)bytes;
+        HGOTO_DONE(SUCCEED);
+    }
 
-    if (HI_READ(file_rec->file, buf, bytes) == FAIL)
+    done = HRAPread(file_rec, buf, bytes, offset);
+    file_rec->stats.ra_bytes += (uint64_t)done;
+    if (done == bytes)
+        HGOTO_DONE(SUCCEED);
+
+    file_rec->stats.reads++;
+    if (file_rec->driver->pread(file_rec, (uint8 *)buf + done, bytes - done, offset + done) == FAIL)
         HGOTO_ERROR(DFE_READERROR, FAIL);
-    file_rec->f_cur_off += bytes;
-    file_rec->last_op = H4_OP_READ;
+    file_rec->stats.bytes_read += (uint64_t)(bytes - done);
+
 done:
+    file_rec->stats.io_time += HIiotime() - start;
     return ret_value;
 } /* end HP_read() */
 
 /*--------------------------------------------------------------------------
  NAME
-    HPseek
+    HP_write
  PURPOSE
-    Alias for HI_SEEK on HDF files.
+    Write to an HDF file through its driver.
  USAGE
-    intn HPseek(file_rec,offset)
+    intn HP_write(file_rec,buf,bytes,offset)
         filerec_t * file_rec;   IN: Pointer to the HDF file record
-        int32 offset;           IN: offset in the file to go to
+        void * buf;             IN: Pointer to the buffer to write
+        int32 bytes;            IN: # of bytes to write
+        int32 offset;           IN: offset in the file to write to
  RETURNS
     Returns SUCCEED/FAIL
  DESCRIPTION
-    Function to wrap around HI_SEEK
+    Function to wrap around the driver's pwrite callback.  Any readahead
+    of the file is stopped first.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
     Should only be called by HDF low-level routines
@@ -3224,49 +4343,45 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 intn
-HPseek(filerec_t *file_rec, int32 offset)
+HP_write(filerec_t *file_rec, const void *buf, int32 bytes, int32 offset)
 {
-    intn ret_value = SUCCEED;
-
-#ifdef HFILE_SEEKINFO
-    printf("%s: file_rec=%p, last_offset=%ld, offset=%ld, last_op=%d", __func__, file_rec,
-           (long)file_rec->f_cur_off, (long)offset, (int)file_rec->last_op);
-#endif /* HFILE_SEEKINFO */
-    if (file_rec->f_cur_off != offset || file_rec->last_op == H4_OP_UNKNOWN) {
-#ifdef HFILE_SEEKINFO
-        seek_taken++;
-        printf(" taken: %d\n", (int)seek_taken);
-#endif /* HFILE_SEEKINFO */
-        if (HI_SEEK(file_rec->file, offset) == FAIL)
-            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-        file_rec->f_cur_off = offset;
-        file_rec->last_op   = H4_OP_SEEK;
-    } /* end if */
-#ifdef HFILE_SEEKINFO
-    else {
-        seek_avoided++;
-        printf(" avoided: %d\n", (int)seek_avoided);
-    }
-#endif /* HFILE_SEEKINFO */
+    float64 start     = HIiotime();
+    intn    ret_value = SUCCEED;
+
+    /* The readahead thread can't see the writes, don't let it go on */
+    if (file_rec->ra != NULL)
+        HRAPstop(file_rec);
+    /* Nor is the metadata index a copy of the file any more */
+    if (file_rec->idx != NULL || file_rec->idx_save)
+        HIXPfree(file_rec);
+
+    file_rec->stats.writes++;
+    if (file_rec->driver->pwrite(file_rec, buf, bytes, offset) == FAIL)
+        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+    file_rec->stats.bytes_written += (uint64_t)bytes;
 
 done:
+    file_rec->stats.io_time += HIiotime() - start;
     return ret_value;
-} /* end HPseek() */
+} /* end HP_write() */
 
 /*--------------------------------------------------------------------------
  NAME
-    HP_write
+    HP_readv
  PURPOSE
-    Alias for HI_WRITE on HDF files.
+    Read consecutive bytes of an HDF file into several buffers.
  USAGE
-    intn HP_write(file_rec,buf,bytes)
+    intn HP_readv(file_rec,count,bufs,sizes,offset)
         filerec_t * file_rec;   IN: Pointer to the HDF file record
-        void * buf;              IN: Pointer to the buffer to write
-        int32 bytes;            IN: # of bytes to write
+        intn count;             IN: # of buffers
+        void *const * bufs;     IN: Buffers to read data into
+        const int32 * sizes;    IN: # of bytes to read into each buffer
+        int32 offset;           IN: offset in the file to read from
  RETURNS
     Returns SUCCEED/FAIL
  DESCRIPTION
-    Function to wrap around HI_WRITE
+    Function to wrap around the driver's preadv callback.  Drivers which
+    don't have one get one HP_read() per buffer.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
     Should only be called by HDF low-level routines
@@ -3274,28 +4389,87 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 intn
-HP_write(filerec_t *file_rec, const void *buf, int32 bytes)
+HP_readv(filerec_t *file_rec, intn count, void *const *bufs, const int32 *sizes, int32 offset)
 {
-    intn ret_value = SUCCEED;
+    float64 start = HIiotime();
+    intn    i;
+    intn    ret_value = SUCCEED;
+
+    if (file_rec->driver->preadv != NULL) {
+        file_rec->stats.reads++;
+        if (file_rec->driver->preadv(file_rec, count, bufs, sizes, offset) == FAIL)
+            HGOTO_ERROR(DFE_READERROR, FAIL);
+        for (i = 0; i < count; i++)
+            file_rec->stats.bytes_read += (uint64_t)sizes[i];
+        HGOTO_DONE(SUCCEED);
+    }
 
-    /* Check for switching file access operations */
-    if (file_rec->last_op == H4_OP_READ || file_rec->last_op == H4_OP_UNKNOWN) {
-#ifdef HFILE_SEEKINFO
-        write_force_seek++;
-#endif /* HFILE_SEEKINFO */
-        file_rec->last_op = H4_OP_UNKNOWN;
-        if (HPseek(file_rec, file_rec->f_cur_off) == FAIL)
-            HGOTO_ERROR(DFE_INTERNAL, FAIL);
-    } /* end if */
+    for (i = 0; i < count; i++) {
+        file_rec->stats.reads++;
+        if (file_rec->driver->pread(file_rec, bufs[i], sizes[i], offset) == FAIL)
+            HGOTO_ERROR(DFE_READERROR, FAIL);
+        file_rec->stats.bytes_read += (uint64_t)sizes[i];
+        offset += sizes[i];
+    }
 
-    if (HI_WRITE(file_rec->file, buf, bytes) == FAIL)
-        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
-    file_rec->f_cur_off += bytes;
-    file_rec->last_op = H4_OP_WRITE;
+done:
+    file_rec->stats.io_time += HIiotime() - start;
+    return ret_value;
+} /* end HP_readv() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HP_read_batch
+ PURPOSE
+    Perform a batch of independent vectored reads on an HDF file.
+ USAGE
+    intn HP_read_batch(file_rec,count,reqs)
+        filerec_t * file_rec;   IN: Pointer to the HDF file record
+        intn count;             IN: # of reads
+        hfile_rdreq_t * reqs;   IN/OUT: the reads to do
+ RETURNS
+    Returns SUCCEED if all reads succeeded, FAIL otherwise
+ DESCRIPTION
+    Function to wrap around the driver's pread_batch callback, which may
+    keep all the reads in flight at once.  Drivers which don't have one
+    get one HP_readv() per read.  The 'status' of each read tells whether
+    it succeeded.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Should only be called by HDF low-level routines
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+intn
+HP_read_batch(filerec_t *file_rec, intn count, hfile_rdreq_t *reqs)
+{
+    float64 start;
+    intn    i, j;
+    intn    ret_value = SUCCEED;
+
+    file_rec->stats.batches++;
+    if (file_rec->driver->pread_batch != NULL) {
+        start = HIiotime();
+        file_rec->stats.reads += (uint64_t)count;
+        ret_value = file_rec->driver->pread_batch(file_rec, count, reqs);
+        file_rec->stats.io_time += HIiotime() - start;
+        if (ret_value == FAIL)
+            HGOTO_ERROR(DFE_READERROR, FAIL);
+        for (i = 0; i < count; i++)
+            if (reqs[i].status == SUCCEED)
+                for (j = 0; j < reqs[i].count; j++)
+                    file_rec->stats.bytes_read += (uint64_t)reqs[i].sizes[j];
+        HGOTO_DONE(SUCCEED);
+    }
+
+    for (i = 0; i < count; i++)
+        if ((reqs[i].status = HP_readv(file_rec, reqs[i].count, reqs[i].bufs, reqs[i].sizes, reqs[i].offset)) ==
+            FAIL)
+            ret_value = FAIL;
 
 done:
     return ret_value;
-} /* end HP_write() */
+} /* end HP_read_batch() */
 
 /*--------------------------------------------------------------------------
  NAME
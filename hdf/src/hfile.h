@@ -20,12 +20,17 @@
 
 #include "hdfi.h"
 
+#include "arena.h"
 #include "tbbt.h"
 #include "bitvect.h"
 #include "atom.h"
 #include "linklist.h"
 #include "dynarray.h"
 
+#ifdef H4_HAVE_THREADSAFE
+#include <pthread.h>
+#endif
+
 /* Magic cookie for HDF data files */
 #define MAGICLEN 4                  /* length */
 #define HDFMAGIC "\016\003\023\001" /* ^N^C^S^A */
@@ -104,6 +109,66 @@ typedef int hdf_file_t;
 #define OPENERR(f)        (f < 0)
 #endif /* FILELIB == UNIXUNBUFIO */
 
+/* ------------------------- Low-level File Drivers ------------------------ */
+/* Raw I/O on an HDF file goes through the driver attached to its file
+   record (see hfiledrv.c), so the I/O backend can be chosen at run-time
+   with Hsetdriver().  The HI_* macros above are still used for files
+   which are not HDF files, e.g. external element files.
+
+   All callbacks return SUCCEED/FAIL.  'open' and 'create' use the path
+   in the file record and store the driver's state in its 'drv_info'
+   field; 'close' releases that state and resets 'drv_info' to NULL.
+   'pread' and 'pwrite' transfer exactly 'bytes' bytes at the explicit
+   offset given; there is no notion of a current file position, so the
+   driver state never depends on the order of I/O calls.  'map' is optional
+   (NULL): it returns a pointer to 'bytes' bytes of the file contents at
+   'offset', valid until the file is closed, or NULL if the driver cannot
+   provide one for that range.  'preadv' is optional (NULL) too: it fills
+   the 'count' buffers in 'bufs' of 'sizes' bytes each from consecutive
+   bytes of the file starting at 'offset', with as few system calls as
+   the driver can manage.  'pread_batch' is optional (NULL) as well: it
+   performs a list of such vectored reads, which are independent of each
+   other and may be in flight at the same time, sets the 'status' of each
+   and returns FAIL if any of them failed.  'size' returns the current size
+   of the file in bytes, or FAIL. */
+struct filerec_t;
+
+/* One vectored read of a batch, see 'pread_batch' */
+typedef struct hfile_rdreq_t {
+    intn         count;  /* # of buffers */
+    void *const *bufs;   /* buffers to fill */
+    const int32 *sizes;  /* # of bytes to read into each buffer */
+    int32        offset; /* offset in the file of the first byte */
+    intn         status; /* OUT: SUCCEED/FAIL */
+} hfile_rdreq_t;
+
+/* Readahead state of a file, private to hfilera.c */
+typedef struct hfile_ra_t hfile_ra_t;
+
+/* Metadata index of a file, private to hfileidx.c */
+typedef struct hfile_idx_t hfile_idx_t;
+
+/* Free space of a file, private to hfilespace.c */
+typedef struct hfile_space_t hfile_space_t;
+
+/* size of the buffer for the path name of a memory image */
+#define HFILE_IMAGE_NAMELEN 32
+
+typedef struct hfile_driver_t {
+    intn        type; /* HDF_DRIVER_xxx code for this driver */
+    const char *name; /* name of the driver, as used by HDF4_DRIVER */
+    intn (*open)(struct filerec_t *file_rec, intn acc_mode);
+    intn (*create)(struct filerec_t *file_rec);
+    intn (*close)(struct filerec_t *file_rec);
+    intn (*flush)(struct filerec_t *file_rec);
+    intn (*pread)(struct filerec_t *file_rec, void *buf, int32 bytes, int32 offset);
+    intn (*pwrite)(struct filerec_t *file_rec, const void *buf, int32 bytes, int32 offset);
+    const void *(*map)(struct filerec_t *file_rec, int32 offset, int32 bytes);
+    intn (*preadv)(struct filerec_t *file_rec, intn count, void *const *bufs, const int32 *sizes, int32 offset);
+    intn (*pread_batch)(struct filerec_t *file_rec, intn count, hfile_rdreq_t *reqs);
+    int32 (*size)(struct filerec_t *file_rec);
+} hfile_driver_t;
+
 /* ----------------------- Internal Data Structures ----------------------- */
 /* The internal structure used to keep track of the files opened: an
    array of filerec_t structures, each has a linked list of ddblock_t.
@@ -214,6 +279,7 @@ typedef struct ddblock_t {
     int32             myoffset;   /* offset of this DD block in the file */
     int16             ndds;       /* number of dd's in this block */
     int32             nextoffset; /* offset to the next ddblock in the file */
+    int32             seq;        /* position of this block in the DD list */
     struct filerec_t *frec;       /* Pointer to the filerec this block is in */
     struct ddblock_t *next;       /* pointer to the next ddblock in memory */
     struct ddblock_t *prev;       /* Pointer to previous ddblock. */
@@ -226,35 +292,56 @@ typedef struct tag_info_str {
     /* Needs to be first in this structure */
     bv_ptr   b; /* bit-vector to keep track of which refs are used */
     dynarr_p d; /* dynarray of the refs for this tag */
+    /* DDs of this tag sorted by their position in the DD list, for searches
+       with a wildcard ref; built on the first such search */
+    dd_t **order;
+    intn   norder;      /* number of DDs in 'order' */
+    intn   order_alloc; /* number of slots allocated for 'order' */
 } tag_info;
 
-/* For determining what the last file operation was */
-typedef enum {
-    H4_OP_UNKNOWN = 0, /* Don't know what the last operation was (after fopen frex) */
-    H4_OP_SEEK,        /* Last operation was a seek */
-    H4_OP_WRITE,       /* Last operation was a write */
-    H4_OP_READ         /* Last operation was a read */
-} fileop_t;
-
 /* File record structure */
 typedef struct filerec_t {
-    char      *path;        /* name of file */
-    hdf_file_t file;        /* either file descriptor or pointer */
-    uint16     maxref;      /* highest ref in this file */
-    intn       access;      /* access mode */
-    intn       refcount;    /* reference count / times opened */
-    intn       attach;      /* number of access elts attached */
-    intn       version_set; /* version tag stuff */
-    version_t  version;     /* file version info */
-
-    /* Seek caching info */
-    int32    f_cur_off; /* Current location in the file */
-    fileop_t last_op;   /* the last file operation performed */
+    char                 *path;        /* name of file */
+    const hfile_driver_t *driver;      /* low-level driver doing the file I/O */
+    void                 *drv_info;    /* driver state, NULL if file not open */
+    uint16                maxref;      /* highest ref in this file */
+    intn                  access;      /* access mode */
+    intn                  refcount;    /* reference count / times opened */
+    intn                  attach;      /* number of access elts attached */
+    intn                  version_set; /* version tag stuff */
+    version_t             version;     /* file version info */
 
     /* DD block caching info */
-    intn  cache;     /* boolean: whether caching is on */
-    intn  dirty;     /* boolean: if dd list needs to be flushed */
-    int32 f_end_off; /* offset of the end of the file */
+    intn  cache;      /* boolean: whether caching is on */
+    intn  dirty;      /* boolean: if dd list needs to be flushed */
+    intn  defer_sync; /* boolean: if only Hclose flushes the dd list */
+    int32 f_end_off;  /* offset of the end of the file */
+
+    /* Readahead of sequential reads, see hfilera.c */
+    int32       ra_size; /* size of the readahead window, 0 for none */
+    int32       ra_next; /* offset just past the last read */
+    int32       ra_run;  /* # of bytes read in a row up to ra_next */
+    hfile_ra_t *ra;      /* readahead state, NULL if not reading ahead */
+
+    /* Metadata index sidecar, see hfileidx.c */
+    hfile_idx_t *idx;      /* the loaded index, NULL if none */
+    intn         idx_save; /* write a new sidecar when the file is closed */
+
+    /* Free space in the file, see hfilespace.c */
+    hfile_space_t *space; /* the free blocks, NULL until space is needed */
+
+    /* I/O statistics, see Hgetiostats */
+    hdf_iostats_t stats;
+
+    /* Chunk cache shared by the chunked elements of the file, see Hsetchunkcache */
+    int32               chk_cache_size;   /* budget of bytes, 0 for a cache per element */
+    intn                chk_cache_policy; /* eviction policy, HDF_CHUNK_CACHE_xxx */
+    struct MCACHE_POOL *chk_pool;         /* the pool of the cache, NULL until an element uses it */
+    intn                chk_threads;      /* # of threads decoding chunks, see Hsetchunkthreads */
+
+    /* Arena of the DD list, the tag tree, the free space tree and the
+       access records, all released at once when the file is closed */
+    arena_p arena;
 
     /* DD list pointers */
     struct ddblock_t *ddhead; /* head of ddblock list */
@@ -273,6 +360,11 @@ typedef struct filerec_t {
                             * i.e. file/data labels and descriptions.
                             * This is done for faster searching of annotations
                             * of a particular type. */
+
+#ifdef H4_HAVE_THREADSAFE
+    /* Serializes the API calls on the file, see hthread.c */
+    pthread_mutex_t lock;
+#endif
 } filerec_t;
 
 /* bits for filerec_t 'dirty' flag */
@@ -297,7 +389,7 @@ typedef struct accrec_t {
     int32              posn;         /* seek position with respect to start of element */
     void              *special_info; /* special element info? */
     struct funclist_t *special_func; /* ptr to special function? */
-    struct accrec_t   *next;         /* for free-list linking */
+    arena_p            arena;        /* arena of the file the record comes from */
 } accrec_t;
 
 /* this type is returned to applications programs or other special
@@ -422,7 +514,7 @@ HDFLIBAPI const uint8 diskblock_tail[4];
 
 #endif /* DISKBLOCK_DEBUG */
 
-HDFLIBAPI accrec_t *HIget_access_rec(void);
+HDFLIBAPI accrec_t *HIget_access_rec(filerec_t *file_rec);
 
 HDFLIBAPI void HIrelease_accrec_node(accrec_t *acc);
 
@@ -432,7 +524,7 @@ HDFLIBAPI intn HPcompare_filerec_path(const void *obj, const void *key);
 
 HDFLIBAPI intn HPcompare_accrec_tagref(const void *rec1, const void *rec2);
 
-HDFLIBAPI int32 HPgetdiskblock(filerec_t *file_rec, int32 block_size, intn moveto);
+HDFLIBAPI int32 HPgetdiskblock(filerec_t *file_rec, int32 block_size);
 
 HDFLIBAPI intn HPfreediskblock(filerec_t *file_rec, int32 block_offset, int32 block_size);
 
@@ -444,11 +536,13 @@ HDFLIBAPI int32 HDget_special_info(int32 access_id, sp_info_block_t *info_block)
 
 HDFLIBAPI int32 HDset_special_info(int32 access_id, sp_info_block_t *info_block);
 
-HDFLIBAPI intn HP_read(filerec_t *file_rec, void *buf, int32 bytes);
+HDFLIBAPI intn HP_read(filerec_t *file_rec, void *buf, int32 bytes, int32 offset);
 
-HDFLIBAPI intn HPseek(filerec_t *file_rec, int32 offset);
+HDFLIBAPI intn HP_write(filerec_t *file_rec, const void *buf, int32 bytes, int32 offset);
 
-HDFLIBAPI intn HP_write(filerec_t *file_rec, const void *buf, int32 bytes);
+HDFLIBAPI intn HP_readv(filerec_t *file_rec, intn count, void *const *bufs, const int32 *sizes, int32 offset);
+
+HDFLIBAPI intn HP_read_batch(filerec_t *file_rec, intn count, hfile_rdreq_t *reqs);
 
 HDFLIBAPI int32 HPread_drec(int32 file_id, atom_t data_id, uint8 **drec_buf);
 
@@ -456,6 +550,70 @@ HDFLIBAPI intn tagcompare(void *k1, void *k2, intn cmparg);
 
 HDFLIBAPI void tagdestroynode(void *n);
 
+/*
+ ** from hfiledrv.c
+ */
+HDFLIBAPI const hfile_driver_t *HFPfind_driver(intn type);
+
+HDFLIBAPI const hfile_driver_t *HFPget_default_driver(void);
+
+HDFLIBAPI intn HFPset_default_driver(intn type);
+
+HDFLIBAPI const hfile_driver_t *HFPget_driver(const char *path);
+
+HDFLIBAPI intn HFPimage_register(const void *image, int32 size, char *name);
+
+HDFLIBAPI intn HFPimage_release(const char *name, void **image, int32 *size);
+
+HDFLIBAPI intn HFPshutdown(void);
+
+HDFLIBAPI char *HFPtmpfile_create(const char *path);
+
+HDFLIBAPI intn HFPtmpfile_commit(const char *tmpname, const char *path);
+
+/*
+ ** from hfilera.c
+ */
+HDFLIBAPI int32 HRAPread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset);
+
+HDFLIBAPI void HRAPstop(filerec_t *file_rec);
+
+/*
+ ** from hfileidx.c
+ */
+HDFLIBAPI void HIXPset(intn enable);
+
+HDFLIBAPI intn HIXPenabled(void);
+
+HDFLIBAPI intn HIXPload(filerec_t *file_rec);
+
+HDFLIBAPI int32 HIXPavail(filerec_t *file_rec, int32 offset, const uint8 **data);
+
+HDFLIBAPI intn HIXPread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset);
+
+HDFLIBAPI intn HIXPsave(filerec_t *file_rec);
+
+HDFLIBAPI void HIXPdrop(filerec_t *file_rec);
+
+HDFLIBAPI void HIXPfree(filerec_t *file_rec);
+
+HDFLIBAPI intn HIXPis_meta(const dd_t *dd);
+
+/*
+ ** from hfilespace.c
+ */
+HDFLIBAPI int32 HFSPalloc(filerec_t *file_rec, int32 length);
+
+HDFLIBAPI void HFSPfree(filerec_t *file_rec, int32 offset, int32 length);
+
+HDFLIBAPI intn HFSPshare(filerec_t *file_rec, int32 offset, int32 length);
+
+HDFLIBAPI intn HFSPunshare(filerec_t *file_rec, int32 offset, int32 length);
+
+HDFLIBAPI intn HFSPactive(filerec_t *file_rec);
+
+HDFLIBAPI void HFSPdestroy(filerec_t *file_rec);
+
 /*
  ** from hblocks.c
  */
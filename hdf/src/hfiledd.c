@@ -31,6 +31,9 @@ DESIGN
     node of the tag_tree has a link to a bit-vector for keeping track of the
     refs used for that tag and a link to a dynamic array pointers into the
     DD list for each ref # used.
+    The DD blocks, their DDs, the tag nodes and the tag_tree itself are
+    allocated from the arena of the file (see arena.c), so closing the file
+    only has to free what the tag nodes point to.
 
 BUGS/LIMITATIONS
 
@@ -42,6 +45,7 @@ EXPORTED ROUTINES
     Htagnewref  - Returns a ref that is unique in the file for a given tag
     Hfind       - Locate the next object of a search in an HDF file
     Hdeldd      - Delete a data descriptor
+    Hcompact    - Rewrite a file with its DD list and metadata at the head
 
   Developer-level routines
     HDcheck_tagref - Checks to see if tag/ref is in DD list i.e. created already
@@ -63,11 +67,21 @@ EXPORTED ROUTINES
     HTPend      - Close the DD list to disk (synchronizes with disk too)
 LOCAL ROUTINES
     HTIfind_dd      - find a specific DD in the file
+    HTIfind_tag_dd  - find the next DD with a tag, through the tag tree
+    HTIfind_ref_dd  - find the next DD with a ref, through the tag tree
     HTInew_dd_block - create a new (empty) DD block
     HTIupdate_dd    - update a DD on disk
     HTIcount_dd     - counts the dd's of a certain type in file
+    HTIread_span    - read a piece of the file for HTPstart
     HTIregister_tag_ref     - insert a ref into the tag tree for a file
+    HTIget_tag_info         - find or add a tag in the tag tree for a file
+    HTIadd_ref              - mark a ref as used for a tag
     HTIunregister_tag_ref   - remove a ref from the tag tree for a file
+    HTIbuild_order          - sort the DDs of a tag by position in the DD list
+    HTIorder_index          - find the position of a DD in the sorted DDs of a tag
+    HTIcmp_extent           - sort pieces of data by offset, for Hcompact
+    HTIcmp_block            - sort DD blocks by offset, for HTPsync
+    HTIfree_data            - give the space of the data of a DD back
 
 OLD ROUTINES
     HIlookup_dd             - find the dd record for an element
@@ -86,10 +100,15 @@ OLD ROUTINES
 
 #include "hdfi.h"
 #include "hfile.h"
+#include "hthread.h"
 
 /* Private routines */
 static intn HTIfind_dd(filerec_t *file_rec, uint16 look_tag, uint16 look_ref, dd_t **pdd, intn direction);
 
+static intn HTIfind_tag_dd(filerec_t *file_rec, uint16 look_tag, dd_t **pdd, intn direction);
+
+static intn HTIfind_ref_dd(filerec_t *file_rec, uint16 look_ref, dd_t **pdd, intn direction);
+
 static intn HTInew_dd_block(filerec_t *file_rec);
 
 static intn HTIupdate_dd(filerec_t *file_rec, dd_t *dd);
@@ -98,8 +117,22 @@ static intn HTIcount_dd(filerec_t *file_rec, uint16 cnt_tag, uint16 cnt_ref, uin
 
 static intn HTIregister_tag_ref(filerec_t *file_rec, dd_t *dd);
 
+static tag_info *HTIget_tag_info(filerec_t *file_rec, uint16 base_tag);
+
+static intn HTIadd_ref(tag_info *tinfo, dd_t *dd_ptr);
+
 static intn HTIunregister_tag_ref(filerec_t *file_rec, dd_t *dd_ptr);
 
+static intn HTIbuild_order(tag_info *tinfo);
+
+static intn HTIorder_index(const tag_info *tinfo, const dd_t *dd_ptr);
+
+static int HTIcmp_extent(const void *a, const void *b);
+
+static int HTIcmp_block(const void *a, const void *b);
+
+static intn HTIfree_data(filerec_t *file_rec, const dd_t *dd_ptr);
+
 /* Local definitions */
 /* The initial size of a ref dynarray */
 #define REF_DYNARRAY_START 64
@@ -121,6 +154,116 @@ static intn HTIunregister_tag_ref(filerec_t *file_rec, dd_t *dd_ptr);
         INT32DECODE(p, length);                                                                              \
     }
 
+/* Most bytes read at once when loading the DD blocks of a file */
+#define DD_SPAN_SIZE 65536
+
+/* A piece of the file read in by HTPstart */
+typedef struct {
+    uint8 *buf;   /* the bytes read */
+    int32  alloc; /* size of 'buf' */
+    int32  off;   /* offset in the file of the bytes */
+    int32  len;   /* # of bytes in 'buf' */
+    int32  fsize; /* size of the file, FAIL if not known */
+} dd_span_t;
+
+/* # of bytes a DD block takes in the file */
+#define HTIblock_size(block) (NDDS_SZ + OFFSET_SZ + (int32)(block)->ndds * DD_SZ)
+
+/* Most bytes of DD blocks HTPsync writes at once */
+#define SYNC_BUF_SIZE 65536
+
+/* Most DDs in a DD block, as the count is 16 bits in the file */
+#define MAX_BLOCK_NDDS 32767
+
+/* Size of the buffer Hcompact copies data through */
+#define COMPACT_BUF_SIZE (1024 * 1024)
+
+/* A piece of the data of a file, as moved by Hcompact */
+typedef struct {
+    int32 offset;  /* offset of the data in the old file */
+    int32 length;  /* # of bytes of data */
+    int32 new_off; /* offset in the new file, or the piece the data is in */
+    intn  index;   /* DD the data belongs to */
+    intn  meta;    /* whether the data is metadata */
+} compact_ext_t;
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTIread_span -- make sure some bytes of the file are in the span
+ USAGE
+    intn HTIread_span(file_rec, span, offset, len, hint)
+        filerec_t *file_rec;    IN: file record of the file
+        dd_span_t *span;        IN/OUT: the span
+        int32 offset;           IN: offset of the bytes needed
+        int32 len;              IN: # of bytes needed
+        int32 hint;             IN: # of bytes likely to be needed from 'offset'
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    Does nothing if the bytes are in the span already.  Otherwise the span
+    is read again from 'offset'.  If that is near the end of the span, the
+    DD blocks are packed together and as much as DD_SPAN_SIZE bytes are
+    read so the next blocks come in with the same read; otherwise only the
+    'hint' bytes, so files whose DD blocks are far apart don't pay for
+    reading the data in between.
+--------------------------------------------------------------------------*/
+static intn
+HTIread_span(filerec_t *file_rec, dd_span_t *span, int32 offset, int32 len, int32 hint)
+{
+    int32 want;
+    intn  ret_value = SUCCEED;
+
+    if (offset >= span->off && offset + len <= span->off + span->len)
+        HGOTO_DONE(SUCCEED);
+
+    /* DD blocks held in the metadata index are copied from there */
+    if (file_rec->idx != NULL) {
+        const uint8 *data;
+
+        if ((want = HIXPavail(file_rec, offset, &data)) >= len) {
+            if (want > span->alloc) {
+                uint8 *new_buf;
+
+                if ((new_buf = (uint8 *)realloc(span->buf, (size_t)want)) == NULL)
+                    HGOTO_ERROR(DFE_NOSPACE, FAIL);
+                span->buf   = new_buf;
+                span->alloc = want;
+            }
+            memcpy(span->buf, data, (size_t)want);
+            file_rec->stats.idx_bytes += (uint64_t)want;
+            span->off = offset;
+            span->len = want;
+            HGOTO_DONE(SUCCEED);
+        }
+    }
+
+    want = MAX(len, hint);
+    if (span->len > 0 && offset >= span->off && offset - (span->off + span->len) < DD_SPAN_SIZE)
+        want = MAX(want, DD_SPAN_SIZE);
+
+    /* Don't read past the end of the file, unless the caller needs it */
+    if (span->fsize != FAIL && want > span->fsize - offset)
+        want = MAX(len, span->fsize - offset);
+
+    if (want > span->alloc) {
+        uint8 *new_buf;
+
+        if ((new_buf = (uint8 *)realloc(span->buf, (size_t)want)) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, FAIL);
+        span->buf   = new_buf;
+        span->alloc = want;
+    }
+
+    span->len = 0;
+    if (HP_read(file_rec, span->buf, want, offset) == FAIL)
+        HGOTO_ERROR(DFE_READERROR, FAIL);
+    span->off = offset;
+    span->len = want;
+
+done:
+    return ret_value;
+} /* end HTIread_span() */
+
 /******************************************************************************
  NAME
      HTPstart - Initialize the DD list in memory
@@ -129,7 +272,9 @@ static intn HTIunregister_tag_ref(filerec_t *file_rec, dd_t *dd_ptr);
     Reads the DD blocks from disk and creates the in-memory structures for
     handling them.  This routine should only be called once for a given
     file and HTPend should be called when finished with the DD list (i.e.
-    when the file is being closed).
+    when the file is being closed).  DD blocks close to each other in the
+    file are read in with a single read, and the tag of each DD is only
+    looked up in the tag tree when it differs from the one before.
 
  RETURNS
     Returns SUCCEED if successful and FAIL otherwise
@@ -139,14 +284,18 @@ intn
 HTPstart(filerec_t *file_rec /* IN:  File record to store info in */
 )
 {
-    uint8 *tbuf      = NULL; /* temporary buffer */
-    uintn  tbuf_size = 0;    /* temporary buffer size */
-    int32  end_off   = 0;    /* offset of the end of the file */
-    intn   ret_value = SUCCEED;
+    dd_span_t span;             /* the span of the file last read */
+    tag_info *tinfo   = NULL;   /* info for the tag of the last DD registered */
+    int32     end_off = 0;      /* offset of the end of the file */
+    intn      ndds    = DEF_NDDS; /* number of DDs in a block */
+    intn      ret_value = SUCCEED;
 
     HEclear();
+    memset(&span, 0, sizeof(span));
+    span.fsize = file_rec->driver->size(file_rec);
+
     /* Alloc start of linked list of ddblocks. */
-    file_rec->ddhead = (ddblock_t *)malloc(sizeof(ddblock_t));
+    file_rec->ddhead = (ddblock_t *)ARalloc(file_rec->arena, sizeof(ddblock_t));
     if (file_rec->ddhead == (ddblock_t *)NULL)
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
@@ -157,6 +306,7 @@ HTPstart(filerec_t *file_rec /* IN:  File record to store info in */
     file_rec->ddlast       = file_rec->ddhead;
     file_rec->ddlast->next = (ddblock_t *)NULL;
     file_rec->ddlast->prev = (ddblock_t *)NULL;
+    file_rec->ddlast->seq  = 0;
 
     /* The first ddblock always starts after the magic number.
     Set it up so that we start reading from there. */
@@ -164,38 +314,35 @@ HTPstart(filerec_t *file_rec /* IN:  File record to store info in */
     file_rec->ddlast->dirty    = 0;        /* block does not need to be flushed */
 
     /* Initialize the tag tree */
-    file_rec->tag_tree = tbbtdmake(tagcompare, sizeof(uint16), TBBT_FAST_UINT16_COMPARE);
+    file_rec->tag_tree =
+        tbbtdmake_arena(file_rec->arena, tagcompare, sizeof(uint16), TBBT_FAST_UINT16_COMPARE);
 
     /* Initialize the DD atom group (trying 256 hash currently, feel free to change */
     if (HAinit_group(DDGROUP, 256) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
-    /* Read in the dd's one at a time and determine the max ref in the file
-             at the same time. */
+    /* Read in the dd's one block at a time and determine the max ref in the
+       file at the same time. */
     file_rec->maxref = 0;
     for (;;) {
-        ddblock_t *ddcurr;                      /* ptr to the current DD block */
-        dd_t      *curr_dd_ptr;                 /* pointer to the current DD being read in */
-        uint8      ddhead[NDDS_SZ + OFFSET_SZ]; /* storage for the DD header */
-        uint8     *p;                           /* Temporary buffer pointer. */
-        intn       ndds;                        /* number of DDs in a block */
-        intn       i;                           /* Temporary integer */
+        ddblock_t *ddcurr;      /* ptr to the current DD block */
+        dd_t      *curr_dd_ptr; /* pointer to the current DD being read in */
+        uint8     *p;           /* Temporary buffer pointer. */
+        intn       i;           /* Temporary integer */
 
         /* Get a short-cut for the current DD block being read-in */
         ddcurr = file_rec->ddlast;
+        file_rec->stats.dd_blocks++;
 
-        /* Go to the beginning of the DD block */
-        if (HPseek(file_rec, ddcurr->myoffset) == FAIL)
-            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-
-        /* Read in the start of this dd block.
-           Read data consists of ndds (number of dd's in this block) and
-           offset (offset to the next ddblock). */
-        if (HP_read(file_rec, ddhead, NDDS_SZ + OFFSET_SZ) == FAIL)
+        /* Get the start of this dd block, and the DDs too if the block is
+           the size of the last one.  Data consists of ndds (number of dd's
+           in this block) and offset (offset to the next ddblock). */
+        if (HTIread_span(file_rec, &span, ddcurr->myoffset, NDDS_SZ + OFFSET_SZ,
+                         NDDS_SZ + OFFSET_SZ + ndds * DD_SZ) == FAIL)
             HGOTO_ERROR(DFE_READERROR, FAIL);
 
         /* Decode the numbers. */
-        p = &ddhead[0];
+        p = span.buf + (ddcurr->myoffset - span.off);
         INT16DECODE(p, ddcurr->ndds);
         ndds = (intn)ddcurr->ndds;
         if (ndds <= 0) /* validity check */
@@ -209,29 +356,23 @@ HTPstart(filerec_t *file_rec /* IN:  File record to store info in */
 
         /* Now that we know how many dd's are in this block,
            alloc memory for the records. */
-        ddcurr->ddlist = (dd_t *)malloc((uint32)ndds * sizeof(dd_t));
+        ddcurr->ddlist = (dd_t *)ARalloc(file_rec->arena, (size_t)ndds * sizeof(dd_t));
         if (ddcurr->ddlist == (dd_t *)NULL)
             HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
-        /* Allocate memory for the temporary buffer also */
-        if (tbuf == NULL || ((uintn)ndds * DD_SZ) > tbuf_size) {
-            free(tbuf);
-            tbuf_size = (uintn)ndds * DD_SZ;
-            tbuf      = (uint8 *)malloc(tbuf_size);
-            if (tbuf == (uint8 *)NULL)
-                HGOTO_ERROR(DFE_NOSPACE, FAIL);
-        } /* end if */
-
         /* Index of current dd in ddlist of this ddblock is 0. */
         curr_dd_ptr = ddcurr->ddlist;
 
-        /* Read in a chunk of dd's from the file. */
-        if (HP_read(file_rec, tbuf, ndds * DD_SZ) == FAIL)
+        /* Get the dd's, usually already read in with the header */
+        if (HTIread_span(file_rec, &span, ddcurr->myoffset + NDDS_SZ + OFFSET_SZ, ndds * DD_SZ, ndds * DD_SZ) ==
+            FAIL)
             HGOTO_ERROR(DFE_READERROR, FAIL);
 
         /* decode the dd's */
-        p = tbuf;
+        p = span.buf + (ddcurr->myoffset + NDDS_SZ + OFFSET_SZ - span.off);
         for (i = 0; i < ndds; i++, curr_dd_ptr++) {
+            uint16 base_tag;
+
             DDDECODE(p, curr_dd_ptr->tag, curr_dd_ptr->ref, curr_dd_ptr->offset, curr_dd_ptr->length);
             curr_dd_ptr->blk = ddcurr;
 
@@ -243,22 +384,29 @@ HTPstart(filerec_t *file_rec /* IN:  File record to store info in */
             if ((curr_dd_ptr->offset + curr_dd_ptr->length) > end_off)
                 end_off = curr_dd_ptr->offset + curr_dd_ptr->length;
 
-            /* Add to the tag info tree */
-            if (curr_dd_ptr->tag != DFTAG_NULL)
-                if (HTIregister_tag_ref(file_rec, curr_dd_ptr) == FAIL)
+            /* Add to the tag info tree; runs of DDs with the same tag are
+               common, so only look the tag up when it changes */
+            if (curr_dd_ptr->tag == DFTAG_NULL)
+                continue;
+            base_tag = BASETAG(curr_dd_ptr->tag);
+            if (tinfo == NULL || tinfo->tag != base_tag)
+                if ((tinfo = HTIget_tag_info(file_rec, base_tag)) == NULL)
                     HGOTO_ERROR(DFE_INTERNAL, FAIL);
+            if (HTIadd_ref(tinfo, curr_dd_ptr) == FAIL)
+                HGOTO_ERROR(DFE_INTERNAL, FAIL);
         }
 
         if (ddcurr->nextoffset != 0) { /* More ddblocks in the file */
             ddblock_t *ddnew;          /* ptr to the new DD block */
 
             /* extend the linked list */
-            ddcurr->next = ddnew = (ddblock_t *)malloc((uint32)sizeof(ddblock_t));
+            ddcurr->next = ddnew = (ddblock_t *)ARalloc(file_rec->arena, sizeof(ddblock_t));
             if (ddnew == (ddblock_t *)NULL)
                 HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
             ddnew->prev      = ddcurr;
             ddnew->next      = (ddblock_t *)NULL;
+            ddnew->seq       = ddcurr->seq + 1;
             ddnew->ddlist    = (dd_t *)NULL;
             ddnew->myoffset  = ddcurr->nextoffset;
             ddnew->dirty     = FALSE;
@@ -279,7 +427,7 @@ HTPstart(filerec_t *file_rec /* IN:  File record to store info in */
     file_rec->f_end_off = end_off;
 
 done:
-    free(tbuf);
+    free(span.buf);
 
     return ret_value;
 } /* end HTPstart() */
@@ -320,7 +468,7 @@ HTPinit(filerec_t *file_rec, /* IN: File record to store info in */
         ndds = MIN_NDDS;
 
     /* allocate the dd block in memory and initialize it */
-    file_rec->ddhead = (ddblock_t *)malloc(sizeof(ddblock_t));
+    file_rec->ddhead = (ddblock_t *)ARalloc(file_rec->arena, sizeof(ddblock_t));
     if (file_rec->ddhead == (ddblock_t *)NULL)
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
     block = file_rec->ddlast = file_rec->ddhead;
@@ -328,6 +476,7 @@ HTPinit(filerec_t *file_rec, /* IN: File record to store info in */
     block->ndds              = ndds;
     block->next              = (ddblock_t *)NULL;
     block->nextoffset        = 0;
+    block->seq               = 0;
     block->myoffset          = MAGICLEN;
     block->dirty             = FALSE;
 
@@ -338,11 +487,11 @@ HTPinit(filerec_t *file_rec, /* IN: File record to store info in */
     p = &ddhead[0];
     INT16ENCODE(p, block->ndds);
     INT32ENCODE(p, (int32)0);
-    if (HP_write(file_rec, ddhead, NDDS_SZ + OFFSET_SZ) == FAIL)
+    if (HP_write(file_rec, ddhead, NDDS_SZ + OFFSET_SZ, block->myoffset) == FAIL)
         HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
     /* allocate and initialize dd list */
-    list = block->ddlist = (dd_t *)malloc((uint32)ndds * sizeof(dd_t));
+    list = block->ddlist = (dd_t *)ARalloc(file_rec->arena, (size_t)ndds * sizeof(dd_t));
     if (list == (dd_t *)NULL)
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
@@ -364,7 +513,7 @@ HTPinit(filerec_t *file_rec, /* IN: File record to store info in */
     HDmemfill(p, tbuf, DD_SZ, (uint32)(ndds - 1));
 
     /* Write the NIL dd's out into the DD block on disk */
-    if (HP_write(file_rec, tbuf, ndds * DD_SZ) == FAIL)
+    if (HP_write(file_rec, tbuf, ndds * DD_SZ, block->myoffset + NDDS_SZ + OFFSET_SZ) == FAIL)
         HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
     /* Update the DFTAG_NULL pointers */
@@ -378,7 +527,8 @@ HTPinit(filerec_t *file_rec, /* IN: File record to store info in */
     file_rec->maxref = 0;
 
     /* Initialize the tag tree */
-    file_rec->tag_tree = tbbtdmake(tagcompare, sizeof(uint16), TBBT_FAST_UINT16_COMPARE);
+    file_rec->tag_tree =
+        tbbtdmake_arena(file_rec->arena, tagcompare, sizeof(uint16), TBBT_FAST_UINT16_COMPARE);
 
     /* Initialize the DD atom group (trying 256 hash currently, feel free to change */
     if (HAinit_group(DDGROUP, 256) == FAIL)
@@ -396,7 +546,10 @@ done:
 
  DESCRIPTION
     Synchronizes the in-memory copy of the DD list with the copy on disk by
-    writing out the DD blocks which have changed to disk.
+    writing out the DD blocks which have changed to disk.  The changed blocks
+    are written in the order of their offsets in the file, and blocks which
+    follow each other in the file are written together, so a file whose DD
+    blocks are contiguous is flushed with a single write.
 
  RETURNS
     Returns SUCCEED if successful and FAIL otherwise
@@ -406,59 +559,74 @@ intn
 HTPsync(filerec_t *file_rec /* IN:  File record to store info in */
 )
 {
-    ddblock_t *block;                       /* dd block to initialize */
-    uint8      ddhead[NDDS_SZ + OFFSET_SZ]; /* storage for the DD header */
-    uint8     *tbuf      = NULL;            /* temporary buffer */
-    uintn      tbuf_size = 0;               /* temporary buffer size */
-    uint8     *p;                           /* temp buffer ptr */
-    dd_t      *list;                        /* list of dd */
-    int16      ndds;                        /* # of DDs per block */
-    intn       i;                           /* temp ints */
-    intn       ret_value = SUCCEED;
+    ddblock_t  *block;            /* dd block to initialize */
+    ddblock_t **dirty     = NULL; /* the blocks to flush, sorted by offset */
+    intn        ndirty    = 0;    /* # of blocks to flush */
+    uint8      *tbuf      = NULL; /* temporary buffer */
+    size_t      tbuf_size = 0;    /* temporary buffer size */
+    uint8      *p;                /* temp buffer ptr */
+    dd_t       *list;             /* list of dd */
+    int32       size;             /* # of bytes to write at once */
+    intn        i, j, k, n;       /* temp ints */
+    intn        ret_value = SUCCEED;
 
     HEclear();
     block = file_rec->ddhead;
     if (block == NULL) /* check for DD list */
         HGOTO_ERROR(DFE_BADDDLIST, FAIL);
 
-    while (block != NULL) {         /* check all the blocks for flushing */
-        if (block->dirty == TRUE) { /* flush this block? */
-            if (HPseek(file_rec, block->myoffset) == FAIL)
-                HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-
-            /* write dd block header to file */
-            p = ddhead;
-            INT16ENCODE(p, block->ndds);
-            INT32ENCODE(p, block->nextoffset);
-            if (HP_write(file_rec, ddhead, NDDS_SZ + OFFSET_SZ) == FAIL)
-                HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+    /* Gather the blocks to flush */
+    for (; block != NULL; block = block->next)
+        if (block->dirty == TRUE)
+            ndirty++;
+    if (ndirty == 0)
+        HGOTO_DONE(SUCCEED);
+    if ((dirty = (ddblock_t **)malloc((size_t)ndirty * sizeof(ddblock_t *))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    for (i = 0, block = file_rec->ddhead; block != NULL; block = block->next)
+        if (block->dirty == TRUE)
+            dirty[i++] = block;
+    if (ndirty > 1)
+        qsort(dirty, (size_t)ndirty, sizeof(ddblock_t *), HTIcmp_block);
+
+    for (i = 0; i < ndirty; i = j) {
+        /* Take the blocks right after this one in the file along */
+        size = HTIblock_size(dirty[i]);
+        for (j = i + 1; j < ndirty; j++) {
+            if (dirty[j]->myoffset != dirty[i]->myoffset + size ||
+                size + HTIblock_size(dirty[j]) > SYNC_BUF_SIZE)
+                break;
+            size += HTIblock_size(dirty[j]);
+        } /* end for */
 
-            /* n is the maximum number of dd's in tbuf */
-            ndds = block->ndds;
-            /* Allocate memory for the temporary buffer also */
-            if (tbuf == NULL || ((uintn)ndds * DD_SZ) > tbuf_size) {
-                free(tbuf);
-                tbuf_size = (uintn)ndds * DD_SZ;
-                tbuf      = (uint8 *)malloc(tbuf_size);
-                if (tbuf == (uint8 *)NULL)
-                    HGOTO_ERROR(DFE_NOSPACE, FAIL);
-            } /* end if */
+        /* Allocate memory for the temporary buffer also */
+        if (tbuf == NULL || (size_t)size > tbuf_size) {
+            free(tbuf);
+            tbuf_size = (size_t)size;
+            tbuf      = (uint8 *)malloc(tbuf_size);
+            if (tbuf == (uint8 *)NULL)
+                HGOTO_ERROR(DFE_NOSPACE, FAIL);
+        } /* end if */
 
-            /* write dd list to file */
-            list = &block->ddlist[0]; /* start at the first DD, go from there */
-            p    = tbuf;
-            for (i = 0; i < ndds; i++, list++)
+        /* encode the dd block headers and dd lists */
+        p = tbuf;
+        for (k = i; k < j; k++) {
+            INT16ENCODE(p, dirty[k]->ndds);
+            INT32ENCODE(p, dirty[k]->nextoffset);
+            list = &dirty[k]->ddlist[0]; /* start at the first DD, go from there */
+            for (n = 0; n < dirty[k]->ndds; n++, list++)
                 DDENCODE(p, list->tag, list->ref, list->offset, list->length);
+        } /* end for */
 
-            if (HP_write(file_rec, tbuf, ndds * DD_SZ) == FAIL)
-                HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+        if (HP_write(file_rec, tbuf, size, dirty[i]->myoffset) == FAIL)
+            HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
-            block->dirty = FALSE; /* block has been flushed */
-        }                         /* end if */
-        block = block->next;      /* advance to next block for file */
-    }                             /* end while */
+        for (k = i; k < j; k++)
+            dirty[k]->dirty = FALSE; /* block has been flushed */
+    }                                /* end for */
 
 done:
+    free(dirty);
     free(tbuf);
 
     return ret_value;
@@ -482,22 +650,17 @@ intn
 HTPend(filerec_t *file_rec /* IN:  File record to store info in */
 )
 {
-    ddblock_t *bl, *next; /* current ddblock and next ddblock pointers.
-                             for freeing ddblock linked list */
     intn ret_value = SUCCEED;
 
     HEclear();
     if (HTPsync(file_rec) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
-    for (bl = file_rec->ddhead; bl != NULL; bl = next) {
-        next = bl->next;
-        free(bl->ddlist);
-        free(bl);
-    }
-
-    /* Chuck the tag info tree too */
+    /* The DD blocks, the tag nodes and the tree itself are in the arena of
+       the file, which goes away with the file record; only what the tag
+       nodes point to needs to be freed */
     tbbtdfree(file_rec->tag_tree, tagdestroynode, NULL);
+    file_rec->tag_tree = NULL;
 
     /* Shutdown the DD atom group */
     if (HAdestroy_group(DDGROUP) == FAIL)
@@ -673,7 +836,7 @@ HTPdelete(atom_t ddid /* IN: DD id to delete */
     file_rec->ddnull     = NULL;
     file_rec->ddnull_idx = (-1);
 
-    if (HPfreediskblock(file_rec, dd_ptr->offset, dd_ptr->length) == FAIL)
+    if (HTIfree_data(file_rec, dd_ptr) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
     /* Update the disk, etc. */
@@ -840,6 +1003,8 @@ Hdupdd(int32  file_id, /* IN: File ID the tag/refs are in */
     int32      old_off;  /* The offset of the old DD */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
     file_rec = HAatom_object(file_id);
@@ -861,6 +1026,8 @@ Hdupdd(int32  file_id, /* IN: File ID the tag/refs are in */
     /* Set the new DD's offset & length to the same as the old DD */
     if (HTPupdate(new_dd, old_off, old_len) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
+    if (HFSPshare(file_rec, old_off, old_len) == FAIL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
     /* End access to the old & new DDs */
     if (HTPendaccess(old_dd) == FAIL)
@@ -869,6 +1036,7 @@ Hdupdd(int32  file_id, /* IN: File ID the tag/refs are in */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hdupdd() */
 
@@ -897,6 +1065,8 @@ Hnumber(int32  file_id, /* IN: File ID the tag/refs are in */
     filerec_t *file_rec; /* file record */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* convert file id to file record */
     file_rec = HAatom_object(file_id);
 
@@ -911,6 +1081,7 @@ Hnumber(int32  file_id, /* IN: File ID the tag/refs are in */
     ret_value = (int32)real_cnt;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hnumber() */
 
@@ -931,10 +1102,13 @@ done:
 uint16
 Hnewref(int32 file_id /* IN: File ID the tag/refs are in */)
 {
-    filerec_t *file_rec; /* file record */
-    uint16     ref;      /* the new ref */
+    filerec_t *file_rec;    /* file record */
+    bv_ptr     used = NULL; /* refs used by any tag */
+    void     **t;           /* node of the tag tree */
+    int32      ref;         /* the new ref */
     uint16     ret_value = DFREF_NONE;
-    uint32     i_ref; /* index for FOR loop */
+
+    H4_API_LOCK;
 
     /* clear error stack and check validity of file record id */
     HEclear();
@@ -946,20 +1120,26 @@ Hnewref(int32 file_id /* IN: File ID the tag/refs are in */)
      just return next number */
     if (file_rec->maxref < MAX_REF)
         ret_value = ++(file_rec->maxref);
-    else { /* otherwise, search for an empty ref */
-        /* incredibly slow but unlikely situation */
-        /* This could possibly get replaced with some sort of bit-vector manipulation -QAK */
-        for (i_ref = 1; i_ref <= (uint32)MAX_REF; i_ref++) {
-            dd_t *dd_ptr = NULL;
-            ref          = (uint16)i_ref;
-            if (HTIfind_dd(file_rec, (uint16)DFTAG_WILDCARD, ref, &dd_ptr, DF_FORWARD) == FAIL) {
-                ret_value = ref; /* set return value to ref found */
-                break;           /* break out of loop */
-            }                    /* end if */
-        }                        /* end for */
-    }                            /* end else */
+    else { /* otherwise, search for a ref no tag uses */
+        /* merge the ref bit-vectors of all the tags, then find a zero */
+        if ((used = bv_new((int32)MAX_REF + 1)) == NULL)
+            HGOTO_ERROR(DFE_BVNEW, 0);
+        if (bv_set(used, 0, BV_TRUE) == FAIL) /* ref 0 is never handed out */
+            HGOTO_ERROR(DFE_BVSET, 0);
+        for (t = (void **)tbbtfirst(file_rec->tag_tree->root); t != NULL; t = (void **)tbbtnext((TBBT_NODE *)t))
+            if (bv_union(used, ((tag_info *)*t)->b) == FAIL)
+                HGOTO_ERROR(DFE_BVSET, 0);
+        if ((ref = bv_find_next_zero(used)) == FAIL)
+            HGOTO_ERROR(DFE_BVFIND, 0);
+        if (ref <= (int32)MAX_REF)
+            ret_value = (uint16)ref;
+    } /* end else */
 
 done:
+    if (used != NULL)
+        bv_delete(used);
+
+    H4_API_UNLOCK;
     return ret_value;
 } /* Hnewref() */
 
@@ -987,6 +1167,8 @@ Htagnewref(int32  file_id, /* IN: File ID the tag/refs are in */
     uint16     base_tag  = BASETAG(tag); /* corresponding base tag (if the tag is special) */
     uint16     ret_value = DFREF_NONE;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file record id */
     HEclear();
     file_rec = HAatom_object(file_id);
@@ -1002,6 +1184,7 @@ Htagnewref(int32  file_id, /* IN: File ID the tag/refs are in */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Htagnewref() */
 
@@ -1041,6 +1224,8 @@ Hfind(int32   file_id,    /* IN: file ID to search in */
     dd_t      *dd_ptr;   /* ptr to current ddlist searched */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of the access id */
     HEclear();
     if (file_id == FAIL || /* search_ref > MAX_REF || */ find_tag == NULL || find_ref == NULL ||
@@ -1068,6 +1253,7 @@ Hfind(int32   file_id,    /* IN: file ID to search in */
     *find_length = dd_ptr->length;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hfind() */
 
@@ -1097,6 +1283,8 @@ HDcheck_tagref(int32  file_id, /* IN: id of file */
     uint16     base_tag;         /* corresponding base tag (if the tag is special) */
     intn       ret_value = 1;    /* default tag/ref exists  */
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1119,6 +1307,7 @@ HDcheck_tagref(int32  file_id, /* IN: id of file */
     ret_value = 1;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* HDcheck_tagref() */
 
@@ -1153,6 +1342,8 @@ HDreuse_tagref(int32  file_id, /* IN: id of file */
     atom_t     ddid;            /* ID for the DD */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file record id */
     HEclear();
 
@@ -1164,10 +1355,9 @@ HDreuse_tagref(int32  file_id, /* IN: id of file */
     if ((ddid = HTPselect(file_rec, tag, ref)) == FAIL)
         HGOTO_ERROR(DFE_NOMATCH, FAIL);
 
-    /* could reuse space in file by calling HPfreediskblock() routine
-       but it does nothing for now. For later. */
-    /* if (HPfreediskblock(file_rec,dd_ptr->offset,dd_ptr->length) == FAIL)
-        HGOTO_ERROR(DFE_INTERNAL, FAIL); */
+    /* give the space of the old data back, the element is to be rewritten */
+    if (HTIfree_data(file_rec, (dd_t *)HAatom_object(ddid)) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
     /* reuse the dd by setting the offset and length to
        INVALID_OFFSET and INVALID_LENGTH*/
@@ -1185,6 +1375,7 @@ HDreuse_tagref(int32  file_id, /* IN: id of file */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end HDreuse_tagref */
 
@@ -1213,6 +1404,8 @@ Hdeldd(int32 file_id, uint16 tag, uint16 ref)
     atom_t     ddid;     /* ID for the DD */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file record id */
     HEclear();
     file_rec = HAatom_object(file_id);
@@ -1228,9 +1421,227 @@ Hdeldd(int32 file_id, uint16 tag, uint16 ref)
         HGOTO_ERROR(DFE_CANTDELDD, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end Hdeldd */
 
+/*--------------------------------------------------------------------------
+NAME
+   Hcompact -- rewrite a file with its DD list and metadata at the head
+USAGE
+   intn Hcompact(path)
+   const char *path;         IN: name of the file
+RETURNS
+   returns SUCCEED (0) if successful, FAIL (-1) otherwise
+DESCRIPTION
+   Rewrites a file so that all of its DDs are in one DD block right after
+   the magic number (or in as few blocks as the 16-bit DD count of a block
+   allows, one after the other), followed by the metadata elements
+   (Vgroups, vdata headers, small vdatas, descriptions of special
+   elements, ...) and then by the rest of the data, in file order.  Files
+   which grew a DD block at a time have their DD blocks scattered all over
+   the file; once compacted, Hopen reads the DD list in one go and the
+   metadata it leads to is next to it.
+
+   The DDs keep their order and DDs sharing data keep sharing it.  Free
+   DDs and space not used by any element are dropped, but a few free DDs
+   are left in the DD block for new elements; empty elements get an offset
+   of 0.  The new file is written under a unique name next to the old one,
+   synced and renamed over it, so the old file is left as it was if
+   anything fails.
+
+   The file must not be open.  Memory images can't be compacted.
+
+--------------------------------------------------------------------------*/
+intn
+Hcompact(const char *path)
+{
+    filerec_t      out;              /* file record of the new file */
+    filerec_t     *file_rec;         /* file record of the old file */
+    ddblock_t     *block;            /* DD block of the old file */
+    dd_t          *dds  = NULL;      /* DDs in use, in order */
+    compact_ext_t *ents = NULL;      /* data of each DD which has some */
+    compact_ext_t *exts = NULL;      /* the data, with the shared pieces merged */
+    uint8         *buf  = NULL;      /* for the DD blocks, then the data */
+    uint8         *p;
+    char          *tmpname = NULL;   /* name the new file is written under */
+    int32          fid     = FAIL;   /* ID of the old file */
+    intn           out_open = FALSE; /* whether the new file is open */
+    intn           created  = FALSE; /* whether the new file exists */
+    intn           ndds = 0, nents = 0, nexts = 0, nslots, meta, i, j;
+    int32          file_size, data_off, off, len, n;
+    intn           ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    HEclear();
+    if (path == NULL)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+    if (HAsearch_atom(FIDGROUP, HPcompare_filerec_path, path) != NULL)
+        HGOTO_ERROR(DFE_ALROPEN, FAIL);
+    if (HFPget_driver(path)->type == HDF_DRIVER_IMAGE)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    if ((fid = Hopen(path, DFACC_READ, 0)) == FAIL)
+        HGOTO_ERROR(DFE_BADOPEN, FAIL);
+    file_rec = HAatom_object(fid);
+
+    /* No metadata index is to be written for the old file, nor kept */
+    HIXPfree(file_rec);
+    HIXPdrop(file_rec);
+
+    if ((file_size = file_rec->driver->size(file_rec)) == FAIL)
+        HGOTO_ERROR(DFE_READERROR, FAIL);
+
+    /* Collect the DDs in use, and the data of those which have some */
+    for (block = file_rec->ddhead; block != NULL; block = block->next)
+        ndds += block->ndds;
+    if ((dds = (dd_t *)malloc((size_t)(ndds + 1) * sizeof(dd_t))) == NULL ||
+        (ents = (compact_ext_t *)malloc((size_t)(ndds + 1) * sizeof(compact_ext_t))) == NULL ||
+        (exts = (compact_ext_t *)malloc((size_t)(ndds + 1) * sizeof(compact_ext_t))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    ndds = 0;
+    for (block = file_rec->ddhead; block != NULL; block = block->next)
+        for (i = 0; i < block->ndds; i++) {
+            const dd_t *dd = &block->ddlist[i];
+
+            if (dd->tag == DFTAG_NULL)
+                continue;
+            if (dd->offset != INVALID_OFFSET && dd->length > 0) {
+                if (dd->offset < 0 || dd->offset > file_size - dd->length)
+                    HGOTO_ERROR(DFE_BADOFFSET, FAIL);
+                ents[nents].offset = dd->offset;
+                ents[nents].length = dd->length;
+                ents[nents].meta   = HIXPis_meta(dd);
+                ents[nents].index  = ndds;
+                nents++;
+            }
+            dds[ndds] = *dd;
+            /* Empty elements have no place in the old layout to point to */
+            if (dd->offset != INVALID_OFFSET && dd->length == 0)
+                dds[ndds].offset = 0;
+            ndds++;
+        }
+
+    /* Merge the pieces of data which overlap, as when DDs share data; a
+       piece is metadata only if all of the data in it is */
+    qsort(ents, (size_t)nents, sizeof(compact_ext_t), HTIcmp_extent);
+    for (i = 0; i < nents; i++) {
+        if (nexts > 0 && ents[i].offset < exts[nexts - 1].offset + exts[nexts - 1].length) {
+            compact_ext_t *ext = &exts[nexts - 1];
+
+            if (ents[i].offset + ents[i].length > ext->offset + ext->length)
+                ext->length = ents[i].offset + ents[i].length - ext->offset;
+            ext->meta = ext->meta && ents[i].meta;
+        }
+        else
+            exts[nexts++] = ents[i];
+        ents[i].new_off = nexts - 1; /* the piece the data went in */
+    }
+
+    /* Lay out the new file: the DD blocks, the metadata, then the rest */
+    nslots   = ndds + DEF_NDDS;
+    data_off = MAGICLEN;
+    for (i = 0; i < nslots; i += MAX_BLOCK_NDDS)
+        data_off += NDDS_SZ + OFFSET_SZ + MIN(nslots - i, MAX_BLOCK_NDDS) * DD_SZ;
+    off = data_off;
+    for (meta = TRUE; meta >= FALSE; meta--)
+        for (j = 0; j < nexts; j++)
+            if (exts[j].meta == meta) {
+                if (off > INT32_MAX - exts[j].length)
+                    HGOTO_ERROR(DFE_BADOFFSET, FAIL);
+                exts[j].new_off = off;
+                off += exts[j].length;
+            }
+    for (i = 0; i < nents; i++) {
+        const compact_ext_t *ext = &exts[ents[i].new_off];
+
+        dds[ents[i].index].offset = ext->new_off + (ents[i].offset - ext->offset);
+    }
+
+    /* Create the new file, next to the old one */
+    if ((tmpname = HFPtmpfile_create(path)) == NULL)
+        HGOTO_ERROR(DFE_BADOPEN, FAIL);
+    created = TRUE;
+    memset(&out, 0, sizeof(filerec_t));
+    out.path   = tmpname;
+    out.driver = HFPget_driver(tmpname);
+    if (out.driver->create(&out) == FAIL)
+        HGOTO_ERROR(DFE_BADOPEN, FAIL);
+    out_open = TRUE;
+
+    /* Write the magic number and the DD blocks */
+    if ((buf = (uint8 *)malloc((size_t)MAX(data_off, COMPACT_BUF_SIZE))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    memcpy(buf, HDFMAGIC, MAGICLEN);
+    p = buf + MAGICLEN;
+    for (i = 0, j = 0; i < nslots; i += MAX_BLOCK_NDDS) {
+        intn bndds = MIN(nslots - i, MAX_BLOCK_NDDS);
+        intn k;
+
+        INT16ENCODE(p, bndds);
+        off = (int32)(p - buf) + OFFSET_SZ + bndds * DD_SZ;
+        INT32ENCODE(p, (i + bndds < nslots) ? off : 0);
+        for (k = 0; k < bndds; k++, j++) {
+            if (j < ndds) {
+                DDENCODE(p, dds[j].tag, dds[j].ref, dds[j].offset, dds[j].length);
+            }
+            else {
+                DDENCODE(p, (uint16)DFTAG_NULL, (uint16)DFREF_NONE, (int32)INVALID_OFFSET,
+                         (int32)INVALID_LENGTH);
+            }
+        }
+    }
+    if (out.driver->pwrite(&out, buf, data_off, 0) == FAIL)
+        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+
+    /* Copy the data over */
+    for (j = 0; j < nexts; j++)
+        for (n = 0; n < exts[j].length; n += len) {
+            len = MIN(exts[j].length - n, COMPACT_BUF_SIZE);
+            if (HP_read(file_rec, buf, len, exts[j].offset + n) == FAIL)
+                HGOTO_ERROR(DFE_READERROR, FAIL);
+            if (out.driver->pwrite(&out, buf, len, exts[j].new_off + n) == FAIL)
+                HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+        }
+
+    if (out.driver->flush(&out) == FAIL)
+        HGOTO_ERROR(DFE_CANTFLUSH, FAIL);
+    out_open = FALSE;
+    if (out.driver->close(&out) == FAIL)
+        HGOTO_ERROR(DFE_CANTCLOSE, FAIL);
+    if (Hclose(fid) == FAIL) {
+        fid = FAIL;
+        HGOTO_ERROR(DFE_CANTCLOSE, FAIL);
+    }
+    fid = FAIL;
+
+    /* Move the new file into place; the old file stays until then */
+    created = FALSE; /* removed by HFPtmpfile_commit if it fails */
+    if (HFPtmpfile_commit(tmpname, path) == FAIL)
+        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+
+done:
+    if (ret_value == FAIL) { /* Error condition cleanup */
+        if (out_open)
+            out.driver->close(&out);
+        if (created)
+            remove(tmpname);
+        if (fid != FAIL)
+            Hclose(fid);
+    } /* end if */
+
+    /* Normal function cleanup */
+    free(dds);
+    free(ents);
+    free(exts);
+    free(buf);
+    free(tmpname);
+
+    H4_API_UNLOCK;
+    return ret_value;
+} /* end Hcompact */
+
 #ifdef DD_DEBUG
 /*--------------------------------------------------------------------------
  NAME
@@ -1367,7 +1778,7 @@ HTInew_dd_block(filerec_t *file_rec)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
     /* allocate new dd block record and fill in data */
-    if ((block = (ddblock_t *)malloc(sizeof(ddblock_t))) == NULL)
+    if ((block = (ddblock_t *)ARalloc(file_rec->arena, sizeof(ddblock_t))) == NULL)
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
     block->ndds       = (int16)(ndds = (intn)file_rec->ddhead->ndds); /* snarf from first block */
     block->next       = (ddblock_t *)NULL;
@@ -1377,7 +1788,7 @@ HTInew_dd_block(filerec_t *file_rec)
     block->frec = file_rec;
 
     /* get room for the new DD block in the file */
-    if ((nextoffset = HPgetdiskblock(file_rec, NDDS_SZ + OFFSET_SZ + (ndds * DD_SZ), TRUE)) == FAIL)
+    if ((nextoffset = HPgetdiskblock(file_rec, NDDS_SZ + OFFSET_SZ + (ndds * DD_SZ))) == FAIL)
         HGOTO_ERROR(DFE_SEEKERROR, FAIL);
     block->myoffset = nextoffset;             /* set offset of new block */
     block->dirty    = (uintn)file_rec->cache; /* if we're caching, wait to write DD block */
@@ -1388,13 +1799,13 @@ HTInew_dd_block(filerec_t *file_rec)
         p = ddhead;
         INT16ENCODE(p, block->ndds);
         INT32ENCODE(p, (int32)0);
-        if (HP_write(file_rec, ddhead, NDDS_SZ + OFFSET_SZ) == FAIL)
+        if (HP_write(file_rec, ddhead, NDDS_SZ + OFFSET_SZ, nextoffset) == FAIL)
             HGOTO_ERROR(DFE_WRITEERROR, FAIL);
     } /* end else */
 
     /* set up the dd list of this dd block and put it in the file
      after the dd block header */
-    list = block->ddlist = (dd_t *)malloc((uint32)ndds * sizeof(dd_t));
+    list = block->ddlist = (dd_t *)ARalloc(file_rec->arena, (size_t)ndds * sizeof(dd_t));
     if (list == (dd_t *)NULL)
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
@@ -1417,7 +1828,7 @@ HTInew_dd_block(filerec_t *file_rec)
         DDENCODE(p, (uint16)DFTAG_NULL, (uint16)DFREF_NONE, (int32)INVALID_LENGTH, (int32)INVALID_OFFSET);
         HDmemfill(p, tbuf, DD_SZ, (uint32)(ndds - 1));
 
-        if (HP_write(file_rec, tbuf, ndds * DD_SZ) == FAIL)
+        if (HP_write(file_rec, tbuf, ndds * DD_SZ, nextoffset + NDDS_SZ + OFFSET_SZ) == FAIL)
             HGOTO_ERROR(DFE_WRITEERROR, FAIL);
 
         free(tbuf);
@@ -1426,6 +1837,7 @@ HTInew_dd_block(filerec_t *file_rec)
     /* update previously last ddblock to point to this new dd block */
     file_rec->ddlast->nextoffset = nextoffset;
     block->prev                  = file_rec->ddlast;
+    block->seq                   = file_rec->ddlast->seq + 1;
     file_rec->ddlast->next       = block;
     if (file_rec->cache) {               /* if we are caching, wait to update previous DD block */
         file_rec->dirty |= DDLIST_DIRTY; /* indicate file needs to be flushed */
@@ -1438,9 +1850,7 @@ HTInew_dd_block(filerec_t *file_rec)
             offset = file_rec->ddlast->prev->nextoffset + NDDS_SZ;
         p = ddhead;
         INT32ENCODE(p, nextoffset);
-        if (HPseek(file_rec, offset) == FAIL)
-            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-        if (HP_write(file_rec, ddhead, OFFSET_SZ) == FAIL)
+        if (HP_write(file_rec, ddhead, OFFSET_SZ, offset) == FAIL)
             HGOTO_ERROR(DFE_WRITEERROR, FAIL);
     } /* end else */
 
@@ -1470,6 +1880,9 @@ done:
  DESCRIPTION
     Find the dd with tag and ref, by returning the block where the dd resides
     and the index of the dd in the ddblock ddlist.
+    Searches with either the tag or the ref wildcarded are answered from the
+    tag tree (see HTIfind_tag_dd and HTIfind_ref_dd) rather than by scanning
+    the DD list.
 
 --------------------------------------------------------------------------*/
 static intn
@@ -1502,7 +1915,11 @@ HTIfind_dd(filerec_t *file_rec, uint16 look_tag, uint16 look_ref, dd_t **pdd, in
 
         *pdd = dd_ptr;
         HGOTO_DONE(SUCCEED);
-    }                                  /* end if */
+    } /* end if */
+    else if (look_tag != DFTAG_WILDCARD && look_tag != DFTAG_NULL) /* ref is wildcard */
+        HGOTO_DONE(HTIfind_tag_dd(file_rec, look_tag, pdd, direction));
+    else if (look_tag == DFTAG_WILDCARD && look_ref != DFREF_WILDCARD) /* tag is wildcard */
+        HGOTO_DONE(HTIfind_ref_dd(file_rec, look_ref, pdd, direction));
     else {                             /* handle wildcards, etc. */
         if (direction == DF_FORWARD) { /* search forward through the DD list */
             if (*pdd == NULL) {
@@ -1561,66 +1978,6 @@ HTIfind_dd(filerec_t *file_rec, uint16 look_tag, uint16 look_ref, dd_t **pdd, in
                     idx = 0;
                 }                                  /* end for */
             }                                      /* end if */
-            else if (look_tag == DFTAG_WILDCARD) { /* tag is wildcard */
-                for (; block; block = block->next) {
-                    list = &block->ddlist[idx];
-                    for (; idx < block->ndds; idx++, list++) {
-                        /* skip the empty dd's */
-                        if (list->tag == DFTAG_NULL)
-                            continue;
-
-                        if (list->ref == look_ref) {
-                            /* we have a match !! */
-                            *pdd = list;
-                            HGOTO_DONE(SUCCEED);
-                        } /* end if */
-                    }     /* end for */
-
-                    /* start from beginning of the next dd list */
-                    idx = 0;
-                }                                  /* end for */
-            }                                      /* end if */
-            else if (look_ref == DFREF_WILDCARD) { /* ref is wildcard */
-                if (special_tag == DFTAG_NULL) {
-                    /* Change this to lookup the next used ref # in the bitvector or dynarray -QAK */
-                    for (; block; block = block->next) {
-                        list = &block->ddlist[idx];
-                        for (; idx < block->ndds; idx++, list++) {
-                            /* skip the empty dd's */
-                            if (list->tag == DFTAG_NULL && look_tag != DFTAG_NULL)
-                                continue;
-
-                            if (list->tag == look_tag) {
-                                /* we have a match !! */
-                                *pdd = list;
-                                HGOTO_DONE(SUCCEED);
-                            } /* end if */
-                        }     /* end for */
-
-                        /* start from beginning of the next dd list */
-                        idx = 0;
-                    } /* end for */
-                }     /* end if */
-                else {
-                    for (; block; block = block->next) {
-                        list = &block->ddlist[idx];
-                        for (; idx < block->ndds; idx++, list++) {
-                            /* skip the empty dd's */
-                            if (list->tag == DFTAG_NULL && look_tag != DFTAG_NULL)
-                                continue;
-
-                            if (list->tag == look_tag || list->tag == special_tag) {
-                                /* we have a match !! */
-                                *pdd = list;
-                                HGOTO_DONE(SUCCEED);
-                            } /* end if */
-                        }     /* end for */
-
-                        /* start from beginning of the next dd list */
-                        idx = 0;
-                    } /* end for */
-                }     /* end else */
-            }         /* end if */
             else {    /* Both tag & ref are not wildcards */
                 for (; block; block = block->next) {
                     list = &block->ddlist[idx];
@@ -1684,6 +2041,135 @@ done:
     return ret_value;
 } /* HTIfind_dd */
 
+/* Compare the positions of two DDs in the DD list of their file */
+static int
+HTIcmp_dd_pos(const dd_t *a, const dd_t *b)
+{
+    if (a->blk != b->blk)
+        return a->blk->seq < b->blk->seq ? -1 : 1;
+    return a < b ? -1 : (a > b ? 1 : 0);
+} /* HTIcmp_dd_pos */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTIfind_tag_dd -- find the next DD with a given tag
+ USAGE
+    intn HTIfind_tag_dd(file_rec, tag, pdd, direction)
+        filerec_t *file_rec;        IN: file record to search
+        uint16 tag;                 IN: tag of element to find
+        dd_t **pdd;                 IN: DD to start after, NULL to start at
+                                        the beginning (or end) of the DD list
+                                    OUT: pointer to the DD found
+        intn direction;             IN: direction to search
+                                        (DF_FORWARD / DF_BACKWARD)
+ RETURNS
+    returns SUCCEED (0) if successful and FAIL (-1) if failed.
+ DESCRIPTION
+    Searches for a tag with a wildcard ref, matching the special version of
+    the tag also.  Rather than scanning the DD list, the DDs of the tag are
+    looked up in the tag tree and kept sorted by their position in the DD
+    list, so finding the next one is a binary search.
+--------------------------------------------------------------------------*/
+static intn
+HTIfind_tag_dd(filerec_t *file_rec, uint16 look_tag, dd_t **pdd, intn direction)
+{
+    tag_info **tip_ptr;                         /* ptr to the ptr to the info for a tag */
+    tag_info  *tinfo_ptr;                       /* pointer to the info for a tag */
+    uint16     base_tag    = BASETAG(look_tag); /* corresponding base tag */
+    uint16     special_tag = MKSPECIALTAG(look_tag);
+    intn       idx;
+    intn       ret_value = FAIL;
+
+    if ((tip_ptr = (tag_info **)tbbtdfind(file_rec->tag_tree, (void *)&base_tag, NULL)) == NULL)
+        HGOTO_DONE(FAIL); /* Not an error, we just didn't find the object */
+    tinfo_ptr = *tip_ptr;
+
+    if (tinfo_ptr->order == NULL && HTIbuild_order(tinfo_ptr) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+
+    if (direction == DF_FORWARD) {
+        if (*pdd == NULL)
+            idx = 0;
+        else {
+            idx = HTIorder_index(tinfo_ptr, *pdd);
+            if (idx < tinfo_ptr->norder && tinfo_ptr->order[idx] == *pdd)
+                idx++;
+        }
+        for (; idx < tinfo_ptr->norder; idx++) {
+            dd_t *dd_ptr = tinfo_ptr->order[idx];
+
+            if (dd_ptr->tag == look_tag || (special_tag != DFTAG_NULL && dd_ptr->tag == special_tag)) {
+                *pdd = dd_ptr;
+                HGOTO_DONE(SUCCEED);
+            }
+        }
+    }
+    else {
+        idx = (*pdd == NULL) ? tinfo_ptr->norder : HTIorder_index(tinfo_ptr, *pdd);
+        for (idx--; idx >= 0; idx--) {
+            dd_t *dd_ptr = tinfo_ptr->order[idx];
+
+            if (dd_ptr->tag == look_tag || (special_tag != DFTAG_NULL && dd_ptr->tag == special_tag)) {
+                *pdd = dd_ptr;
+                HGOTO_DONE(SUCCEED);
+            }
+        }
+    }
+
+done:
+    return ret_value;
+} /* HTIfind_tag_dd */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTIfind_ref_dd -- find the next DD with a given ref
+ USAGE
+    intn HTIfind_ref_dd(file_rec, ref, pdd, direction)
+        filerec_t *file_rec;        IN: file record to search
+        uint16 ref;                 IN: ref of element to find
+        dd_t **pdd;                 IN: DD to start after, NULL to start at
+                                        the beginning (or end) of the DD list
+                                    OUT: pointer to the DD found
+        intn direction;             IN: direction to search
+                                        (DF_FORWARD / DF_BACKWARD)
+ RETURNS
+    returns SUCCEED (0) if successful and FAIL (-1) if failed.
+ DESCRIPTION
+    Searches for a ref with a wildcard tag.  Each tag in the tag tree holds
+    at most one DD with the ref, so the nearest of those in the direction of
+    the search is the next match.
+--------------------------------------------------------------------------*/
+static intn
+HTIfind_ref_dd(filerec_t *file_rec, uint16 look_ref, dd_t **pdd, intn direction)
+{
+    void **t;           /* node of the tag tree */
+    dd_t  *best = NULL; /* nearest matching DD so far */
+
+    for (t = (void **)tbbtfirst(file_rec->tag_tree->root); t != NULL;
+         t = (void **)tbbtnext((TBBT_NODE *)t)) {
+        tag_info *tinfo_ptr = (tag_info *)*t;
+        dd_t     *dd_ptr;
+
+        if ((dd_ptr = DAget_elem(tinfo_ptr->d, (intn)look_ref)) == NULL)
+            continue;
+        if (direction == DF_FORWARD) {
+            if ((*pdd == NULL || HTIcmp_dd_pos(dd_ptr, *pdd) > 0) &&
+                (best == NULL || HTIcmp_dd_pos(dd_ptr, best) < 0))
+                best = dd_ptr;
+        }
+        else {
+            if ((*pdd == NULL || HTIcmp_dd_pos(dd_ptr, *pdd) < 0) &&
+                (best == NULL || HTIcmp_dd_pos(dd_ptr, best) > 0))
+                best = dd_ptr;
+        }
+    }
+
+    if (best == NULL)
+        return FAIL;
+    *pdd = best;
+    return SUCCEED;
+} /* HTIfind_ref_dd */
+
 /*--------------------------------------------------------------------------
  NAME
     HTIupdate_dd -- update a DD on disk
@@ -1720,12 +2206,9 @@ HTIupdate_dd(filerec_t *file_rec, dd_t *dd_ptr)
         offset = block->myoffset + (NDDS_SZ + OFFSET_SZ) + (idx * DD_SZ);
 
         /* write in the updated dd */
-        if (HPseek(file_rec, offset) == FAIL)
-            HGOTO_ERROR(DFE_SEEKERROR, FAIL);
-
         p = tbuf;
         DDENCODE(p, dd_ptr->tag, dd_ptr->ref, dd_ptr->offset, dd_ptr->length);
-        if (HP_write(file_rec, tbuf, DD_SZ) == FAIL)
+        if (HP_write(file_rec, tbuf, DD_SZ, offset) == FAIL)
             HGOTO_ERROR(DFE_WRITEERROR, FAIL);
     } /* end else */
 
@@ -1886,61 +2369,256 @@ HTIcount_dd(filerec_t *file_rec, uint16 cnt_tag, uint16 cnt_ref, uintn *all_cnt,
 static intn
 HTIregister_tag_ref(filerec_t *file_rec, dd_t *dd_ptr)
 {
-    tag_info  *tinfo_ptr;                        /* pointer to the info for a tag */
-    tag_info **tip_ptr;                          /* ptr to the ptr to the info for a tag */
-    uint16     base_tag  = BASETAG(dd_ptr->tag); /* the base tag for the tag tree */
-    int        ret_value = SUCCEED;
+    tag_info *tinfo_ptr; /* pointer to the info for a tag */
+    int       ret_value = SUCCEED;
 
     HEclear();
-    /* Add to the tag info tree */
-    if ((tip_ptr = (tag_info **)tbbtdfind(file_rec->tag_tree, (void *)&base_tag, NULL)) ==
-        NULL) { /* a new tag was found */
-        if ((tinfo_ptr = (tag_info *)calloc(1, sizeof(tag_info))) == NULL)
-            HGOTO_ERROR(DFE_NOSPACE, FAIL);
-        tinfo_ptr->tag = base_tag;
+    if ((tinfo_ptr = HTIget_tag_info(file_rec, BASETAG(dd_ptr->tag))) == NULL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+    if (HTIadd_ref(tinfo_ptr, dd_ptr) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
-        /* Insert the tag node into the tree */
-        tbbtdins(file_rec->tag_tree, (void *)tinfo_ptr, NULL);
+done:
+    return ret_value;
+} /* HTIregister_tag_ref */
 
-        /* Take care of the bit-vector */
-        if ((tinfo_ptr->b = bv_new(-1)) == NULL)
-            HGOTO_ERROR(DFE_BVNEW, FAIL);
-        /* Set the 0'th bit in the bit-vector (cannot be stored in HDF files) */
-        /* Yes, this is a kludge due to ref # zero not being used -QAK */
-        if (bv_set(tinfo_ptr->b, 0, BV_TRUE) == FAIL)
-            HGOTO_ERROR(DFE_BVSET, FAIL);
+/*--------------------------------------------------------------------------
+ NAME
+    HTIget_tag_info -- get the node of a tag in the tag tree of a file
+ USAGE
+    tag_info *HTIget_tag_info(file_rec, base_tag)
+        filerec_t *file_rec;    IN: file record of the file
+        uint16 base_tag;        IN: base tag to look up
+ RETURNS
+    The tag's node, which is created if the tag is not in the tree yet;
+    NULL on failure
+--------------------------------------------------------------------------*/
+static tag_info *
+HTIget_tag_info(filerec_t *file_rec, uint16 base_tag)
+{
+    tag_info  *tinfo_ptr = NULL; /* pointer to the info for a tag */
+    tag_info **tip_ptr;          /* ptr to the ptr to the info for a tag */
+    tag_info  *ret_value = NULL;
 
-        /* Take care of the dynarray */
-        if ((tinfo_ptr->d = DAcreate_array(REF_DYNARRAY_START, REF_DYNARRAY_INCR)) == NULL)
-            HGOTO_ERROR(DFE_INTERNAL, FAIL);
-    }                 /* end if */
-    else {            /* found an existing tag */
-        intn ref_bit; /* bit of the ref # in the tag info */
+    if ((tip_ptr = (tag_info **)tbbtdfind(file_rec->tag_tree, (void *)&base_tag, NULL)) != NULL)
+        HGOTO_DONE(*tip_ptr);
 
-        tinfo_ptr = *tip_ptr; /* get the pointer to the tag info */
-        if ((ref_bit = bv_get(tinfo_ptr->b, (intn)dd_ptr->ref)) == FAIL)
-            HGOTO_ERROR(DFE_BVGET, FAIL);
-        if (ref_bit == BV_TRUE)
-            HGOTO_ERROR(DFE_DUPDD, FAIL);
-    } /* end else */
+    /* a new tag was found */
+    if ((tinfo_ptr = (tag_info *)ARcalloc(file_rec->arena, sizeof(tag_info))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, NULL);
+    tinfo_ptr->tag = base_tag;
+
+    /* Take care of the bit-vector */
+    if ((tinfo_ptr->b = bv_new(-1)) == NULL)
+        HGOTO_ERROR(DFE_BVNEW, NULL);
+    /* Set the 0'th bit in the bit-vector (cannot be stored in HDF files) */
+    /* Yes, this is a kludge due to ref # zero not being used -QAK */
+    if (bv_set(tinfo_ptr->b, 0, BV_TRUE) == FAIL)
+        HGOTO_ERROR(DFE_BVSET, NULL);
+
+    /* Take care of the dynarray */
+    if ((tinfo_ptr->d = DAcreate_array(REF_DYNARRAY_START, REF_DYNARRAY_INCR)) == NULL)
+        HGOTO_ERROR(DFE_INTERNAL, NULL);
+
+    /* Insert the tag node into the tree */
+    tbbtdins(file_rec->tag_tree, (void *)tinfo_ptr, NULL);
+    ret_value = tinfo_ptr;
+
+done:
+    if (ret_value == NULL && tinfo_ptr != NULL) { /* Error condition cleanup */
+        if (tinfo_ptr->b != NULL)
+            bv_delete(tinfo_ptr->b);
+        ARfree(file_rec->arena, tinfo_ptr, sizeof(tag_info));
+    }
+
+    return ret_value;
+} /* HTIget_tag_info */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTIadd_ref -- mark the ref of a DD as used for its tag
+ USAGE
+    intn HTIadd_ref(tinfo, dd_ptr)
+        tag_info *tinfo;        IN: the node of the DD's tag in the tag tree
+        dd_t *dd_ptr;           IN: the DD
+ RETURNS
+    SUCCEED/FAIL; it is an error for the ref to be in use already
+--------------------------------------------------------------------------*/
+static intn
+HTIadd_ref(tag_info *tinfo, dd_t *dd_ptr)
+{
+    intn ref_bit; /* bit of the ref # in the tag info */
+    intn ret_value = SUCCEED;
+
+    if ((ref_bit = bv_get(tinfo->b, (intn)dd_ptr->ref)) == FAIL)
+        HGOTO_ERROR(DFE_BVGET, FAIL);
+    if (ref_bit == BV_TRUE)
+        HGOTO_ERROR(DFE_DUPDD, FAIL);
 
     /* Set the bit in the bit-vector */
-    if (bv_set(tinfo_ptr->b, (intn)dd_ptr->ref, BV_TRUE) == FAIL)
+    if (bv_set(tinfo->b, (intn)dd_ptr->ref, BV_TRUE) == FAIL)
         HGOTO_ERROR(DFE_BVSET, FAIL);
 
     /* Insert the DD info into the dynarray for later use */
-    if (DAset_elem(tinfo_ptr->d, (intn)dd_ptr->ref, (void *)dd_ptr) == FAIL)
+    if (DAset_elem(tinfo->d, (intn)dd_ptr->ref, (void *)dd_ptr) == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
+    /* Keep the sorted DDs of the tag up to date, once they have been built */
+    if (tinfo->order != NULL) {
+        intn idx = HTIorder_index(tinfo, dd_ptr);
+
+        if (tinfo->norder == tinfo->order_alloc) {
+            intn   new_alloc = tinfo->order_alloc * 2;
+            dd_t **new_order;
+
+            if ((new_order = (dd_t **)realloc(tinfo->order, (size_t)new_alloc * sizeof(dd_t *))) == NULL)
+                HGOTO_ERROR(DFE_NOSPACE, FAIL);
+            tinfo->order       = new_order;
+            tinfo->order_alloc = new_alloc;
+        }
+        memmove(&tinfo->order[idx + 1], &tinfo->order[idx], (size_t)(tinfo->norder - idx) * sizeof(dd_t *));
+        tinfo->order[idx] = dd_ptr;
+        tinfo->norder++;
+    }
+
 done:
-    if (ret_value == FAIL) { /* Error condition cleanup */
+    return ret_value;
+} /* HTIadd_ref */
+
+/* Sort DDs by their position in the DD list, for qsort() */
+static int
+HTIcmp_order(const void *a, const void *b)
+{
+    return HTIcmp_dd_pos(*(dd_t *const *)a, *(dd_t *const *)b);
+} /* HTIcmp_order */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTIbuild_order -- sort the DDs of a tag by position in the DD list
+ USAGE
+    intn HTIbuild_order(tinfo)
+        tag_info *tinfo;        IN: the node of the tag in the tag tree
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    Collects the DDs in the dynarray of refs for the tag into an array sorted
+    by their position in the DD list, which is kept up to date afterwards by
+    HTIadd_ref and HTIunregister_tag_ref.  This is only done for tags which
+    are searched with a wildcard ref, so opening a file doesn't pay for it.
+--------------------------------------------------------------------------*/
+static intn
+HTIbuild_order(tag_info *tinfo)
+{
+    intn size;  /* # of elements in the dynarray */
+    intn n = 0; /* # of DDs found */
+    intn alloc; /* # of slots to allocate */
+    intn i;
+    intn ret_value = SUCCEED;
 
-        if ((tinfo_ptr != NULL) && (tinfo_ptr->d != NULL))
-            DAdestroy_array(tinfo_ptr->d, 0);
+    if ((size = DAsize_array(tinfo->d)) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+    alloc = (size > REF_DYNARRAY_START) ? size : REF_DYNARRAY_START;
+    if ((tinfo->order = (dd_t **)malloc((size_t)alloc * sizeof(dd_t *))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    for (i = 0; i < size; i++) {
+        dd_t *dd_ptr = DAget_elem(tinfo->d, i);
+
+        if (dd_ptr != NULL)
+            tinfo->order[n++] = dd_ptr;
     }
+    qsort(tinfo->order, (size_t)n, sizeof(dd_t *), HTIcmp_order);
+    tinfo->norder      = n;
+    tinfo->order_alloc = alloc;
 
+done:
     return ret_value;
-} /* HTIregister_tag_ref */
+} /* HTIbuild_order */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTIorder_index -- find the position of a DD in the sorted DDs of a tag
+ USAGE
+    intn HTIorder_index(tinfo, dd_ptr)
+        const tag_info *tinfo;  IN: the node of the tag in the tag tree
+        const dd_t *dd_ptr;     IN: the DD to look for
+ RETURNS
+    The index of the first DD in tinfo->order which is not before dd_ptr
+    in the DD list, i.e. the index of dd_ptr if it is present or the index
+    it would be inserted at otherwise.
+--------------------------------------------------------------------------*/
+static intn
+HTIorder_index(const tag_info *tinfo, const dd_t *dd_ptr)
+{
+    intn lo = 0, hi = tinfo->norder;
+
+    while (lo < hi) {
+        intn mid = lo + (hi - lo) / 2;
+
+        if (HTIcmp_dd_pos(tinfo->order[mid], dd_ptr) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+} /* HTIorder_index */
+
+/* Sort pieces of data by offset, the longest first, for qsort() */
+static int
+HTIcmp_extent(const void *a, const void *b)
+{
+    const compact_ext_t *ea = (const compact_ext_t *)a;
+    const compact_ext_t *eb = (const compact_ext_t *)b;
+
+    if (ea->offset != eb->offset)
+        return (ea->offset < eb->offset) ? -1 : 1;
+    if (ea->length != eb->length)
+        return (ea->length > eb->length) ? -1 : 1;
+    return (ea->index < eb->index) ? -1 : (ea->index > eb->index);
+} /* HTIcmp_extent */
+
+/* Sort DD blocks by offset in the file, for qsort() */
+static int
+HTIcmp_block(const void *a, const void *b)
+{
+    const ddblock_t *ba = *(ddblock_t *const *)a;
+    const ddblock_t *bb = *(ddblock_t *const *)b;
+
+    return (ba->myoffset < bb->myoffset) ? -1 : (ba->myoffset > bb->myoffset);
+} /* HTIcmp_block */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTIfree_data -- give the space of the data of a DD back
+ USAGE
+    intn HTIfree_data(file_rec, dd_ptr)
+        filerec_t *file_rec;    IN: file record
+        const dd_t *dd_ptr;     IN: DD whose data is going away
+ RETURNS
+    returns SUCCEED (0) if successful and FAIL (-1) if failed.
+ DESCRIPTION
+    Passes the space of the data of a DD about to be deleted or rewritten
+    to HPfreediskblock, unless another DD shares some of it (see Hdupdd).
+    This is only checked once the free space of the file is being
+    tracked; until then the space is found from the DD list when needed.
+
+--------------------------------------------------------------------------*/
+static intn
+HTIfree_data(filerec_t *file_rec, const dd_t *dd_ptr)
+{
+    intn ret_value = SUCCEED;
+
+    if (dd_ptr == NULL || dd_ptr->offset == INVALID_OFFSET || dd_ptr->length <= 0 || !HFSPactive(file_rec))
+        HGOTO_DONE(SUCCEED);
+
+    if (HFSPunshare(file_rec, dd_ptr->offset, dd_ptr->length))
+        HGOTO_DONE(SUCCEED);
+
+    if (HPfreediskblock(file_rec, dd_ptr->offset, dd_ptr->length) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+
+done:
+    return ret_value;
+} /* HTIfree_data */
 
 /*--------------------------------------------------------------------------
  NAME
@@ -1982,6 +2660,15 @@ HTIunregister_tag_ref(filerec_t *file_rec, dd_t *dd_ptr)
         /* Delete the DD info from the tag tree */
         if (DAdel_elem(tinfo_ptr->d, (intn)dd_ptr->ref) == NULL)
             HGOTO_ERROR(DFE_INTERNAL, FAIL);
+        if (tinfo_ptr->order != NULL) {
+            intn idx = HTIorder_index(tinfo_ptr, dd_ptr);
+
+            if (idx < tinfo_ptr->norder && tinfo_ptr->order[idx] == dd_ptr) {
+                tinfo_ptr->norder--;
+                memmove(&tinfo_ptr->order[idx], &tinfo_ptr->order[idx + 1],
+                        (size_t)(tinfo_ptr->norder - idx) * sizeof(dd_t *));
+            }
+        }
 
         /* Delete the tag/ref from the file */
         dd_ptr->tag = DFTAG_NULL;
@@ -2011,7 +2698,8 @@ tagcompare(void *k1, void *k2, intn cmparg)
 
 /* ---------------------------- tagdestroynode ------------------------- */
 /*
-   Frees tag B-Tree nodes
+   Frees what tag B-Tree nodes point to; the nodes themselves are in the
+   arena of the file
 
    *** Only called by B-tree routines, should _not_ be called externally ***
  */
@@ -2024,5 +2712,5 @@ tagdestroynode(void *n)
         bv_delete(t->b);
     if (t->d != NULL)
         DAdestroy_array(t->d, 0);
-    free(n);
+    free(t->order);
 } /* tagdestroynode */
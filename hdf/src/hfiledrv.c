@@ -0,0 +1,1509 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+FILE
+    hfiledrv.c - Low-level file drivers for HDF files.
+
+REMARKS
+    Every open HDF file has a driver attached to its file record which
+    performs the raw I/O on the file.  The H-layer only ever talks to the
+    file through HP_read and HP_write (and the open/close/flush calls in
+    hfile.c), which dispatch through the driver table.  This allows the
+    I/O backend to be chosen at run-time, per file, instead of at build
+    time through FILELIB.
+
+    All transfers are positional: every read and write carries the offset
+    in the file it applies to, so no file position is shared between the
+    callers of HP_read/HP_write.
+
+DESIGN
+    A driver is a table of functions (see hfile_driver_t in hfile.h), in
+    the same spirit as the function tables for special elements.  The
+    driver keeps whatever state it needs in the 'drv_info' field of the
+    file record.  The following drivers are provided:
+
+    stdio  - C buffered I/O (fopen/fread/fwrite), the historical default.
+             The stream position is tracked to skip redundant fseek()s.
+    posix  - Unbuffered POSIX I/O.  Every transfer is a single pread or
+             pwrite, so there are no seeks at all.  Vectored reads (see
+             Hreadv) are done with preadv where available, and batches of
+             them are submitted at once through io_uring on Linux, so the
+             device sees them all instead of one at a time.
+    memory - The whole file is held in memory.  An existing file is read
+             in at open time and the image is written back to the file at
+             flush/close time if it was modified.  It is written to a new
+             file with a unique name, synced and renamed over the file, so
+             a failed flush leaves the file as it was.
+    mmap   - Files opened read-only are memory-mapped, so reads are plain
+             memory copies.  Files opened for write are not mapped and
+             behave as with the posix driver.
+
+    Drivers which keep the file contents addressable (memory and mmap)
+    provide a 'map' callback, which Hreadptr uses to hand out pointers
+    into the file instead of copying the data.
+
+    There is also an image driver for files which only exist in memory,
+    see Hopen_image().  It cannot be selected as the default driver;
+    instead each image is registered under a made-up path name and the
+    driver is picked by HFPget_driver() for files opened with such a
+    name, so an image can be opened through any interface which takes a
+    file name (e.g. SDstart).  Images given by the user are used in place
+    until the file is opened for write, at which point the image is
+    copied into a buffer owned by the library, which grows as needed and
+    is handed back to the user when the image is released.
+
+    The default driver for newly opened files can be set with Hsetdriver()
+    or through the HDF4_DRIVER environment variable ("stdio", "posix",
+    "memory" or "mmap").  The image driver cannot be the default.
+
+BUGS/LIMITATIONS
+    The positional calls of the stdio driver are emulated with a seek
+    followed by a read or write, so the stdio driver is the only one whose
+    state depends on the order of the transfers.
+
+    io_uring is optional (HDF4_ENABLE_IO_URING/--enable-io-uring) and is
+    set up for a file the first time it reads a batch; when the kernel
+    does not allow it the batch is read one preadv at a time instead.
+
+EXPORTED ROUTINES
+    HFPfind_driver        - Look up a driver from its HDF_DRIVER_xxx code
+    HFPget_default_driver - Get the driver to use for newly opened files
+    HFPset_default_driver - Set the driver to use for newly opened files
+    HFPget_driver         - Get the driver to use for opening a path
+    HFPimage_register     - Register a memory image under a path name
+    HFPimage_release      - Unregister a memory image and hand it back
+    HFPshutdown           - Free the memory images never released
+    HFPtmpfile_create     - Create a temporary file to replace a file with
+    HFPtmpfile_commit     - Replace a file with a temporary file
+
+LOCAL ROUTINES
+    HFIstdio_*  - stdio driver callbacks
+    HFIposix_*  - posix driver callbacks
+    HFIuring_*  - io_uring helpers for the posix driver
+    HFImem_*    - memory driver callbacks
+    HFImmap_*   - mmap driver callbacks
+    HFIimage_*  - image driver callbacks
+*/
+
+#include <errno.h>
+
+#include "hdfi.h"
+#include "hfile.h"
+
+#if defined(H4_HAVE_MMAP) && defined(H4_HAVE_SYS_MMAN_H)
+#define HFILE_MMAP
+#include <sys/mman.h>
+#endif
+
+#if defined(H4_HAVE_PREADV) && defined(H4_HAVE_SYS_UIO_H)
+#define HFILE_PREADV
+#include <limits.h>
+#include <sys/uio.h>
+#endif
+
+#if defined(H4_HAVE_IO_URING) && defined(HFILE_PREADV) && defined(__linux__)
+#define HFILE_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+/* Most buffers handed to a single preadv() call */
+#if defined(IOV_MAX) && IOV_MAX < 128
+#define HFILE_MAXIOV IOV_MAX
+#else
+#define HFILE_MAXIOV 128
+#endif
+
+/* Most reads an io_uring keeps in flight */
+#define HFILE_URING_DEPTH 64
+
+/* The driver used for newly opened files, NULL until it is first needed */
+static const hfile_driver_t *default_driver = NULL;
+
+/*--------------------------------------------------------------------------
+                                stdio driver
+ --------------------------------------------------------------------------*/
+
+/* state of a file opened with the stdio driver.  The stream has a file
+   position of its own, which is tracked here so that sequential transfers
+   don't pay for an fseek() each; C requires one between a read and a
+   write though. */
+typedef struct {
+    FILE *fp;      /* the stream */
+    int32 pos;     /* position of the stream, if last_op is not unknown */
+    intn  last_op; /* STDIO_OP_xxx: the last operation on the stream */
+} hfile_stdio_t;
+
+#define STDIO_OP_UNKNOWN 0
+#define STDIO_OP_READ    1
+#define STDIO_OP_WRITE   2
+
+static intn
+HFIstdio_attach(filerec_t *file_rec, FILE *fp)
+{
+    hfile_stdio_t *info;
+
+    if (fp == NULL)
+        return FAIL;
+    if ((info = (hfile_stdio_t *)calloc(1, sizeof(hfile_stdio_t))) == NULL) {
+        fclose(fp);
+        HRETURN_ERROR(DFE_NOSPACE, FAIL);
+    }
+    info->fp           = fp;
+    info->last_op      = STDIO_OP_UNKNOWN;
+    file_rec->drv_info = info;
+    return SUCCEED;
+} /* end HFIstdio_attach() */
+
+static intn
+HFIstdio_open(filerec_t *file_rec, intn acc_mode)
+{
+    return HFIstdio_attach(file_rec, (acc_mode & DFACC_WRITE) ? fopen(file_rec->path, "rb+")
+                                                              : fopen(file_rec->path, "rb"));
+} /* end HFIstdio_open() */
+
+static intn
+HFIstdio_create(filerec_t *file_rec)
+{
+    return HFIstdio_attach(file_rec, fopen(file_rec->path, "wb+"));
+} /* end HFIstdio_create() */
+
+static intn
+HFIstdio_close(filerec_t *file_rec)
+{
+    hfile_stdio_t *info = (hfile_stdio_t *)file_rec->drv_info;
+    intn           ret_value;
+
+    ret_value = fclose(info->fp) == 0 ? SUCCEED : FAIL;
+    free(info);
+    file_rec->drv_info = NULL;
+    return ret_value;
+} /* end HFIstdio_close() */
+
+static intn
+HFIstdio_flush(filerec_t *file_rec)
+{
+    return fflush(((hfile_stdio_t *)file_rec->drv_info)->fp) == 0 ? SUCCEED : FAIL;
+} /* end HFIstdio_flush() */
+
+/* Position the stream at 'offset' for an operation of kind 'op' */
+static intn
+HFIstdio_seek(filerec_t *file_rec, int32 offset, intn op)
+{
+    hfile_stdio_t *info = (hfile_stdio_t *)file_rec->drv_info;
+
+    if (info->last_op != op || info->pos != offset) {
+        file_rec->stats.seeks++;
+        info->last_op = STDIO_OP_UNKNOWN;
+        if (fseek(info->fp, (long)offset, SEEK_SET) != 0)
+            return FAIL;
+    }
+    else
+        file_rec->stats.seeks_avoided++;
+    return SUCCEED;
+} /* end HFIstdio_seek() */
+
+static intn
+HFIstdio_pread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
+{
+    hfile_stdio_t *info = (hfile_stdio_t *)file_rec->drv_info;
+
+    if (HFIstdio_seek(file_rec, offset, STDIO_OP_READ) == FAIL)
+        return FAIL;
+    if ((size_t)bytes != fread(buf, 1, (size_t)bytes, info->fp)) {
+        info->last_op = STDIO_OP_UNKNOWN;
+        return FAIL;
+    }
+    info->pos     = offset + bytes;
+    info->last_op = STDIO_OP_READ;
+    return SUCCEED;
+} /* end HFIstdio_pread() */
+
+static intn
+HFIstdio_pwrite(filerec_t *file_rec, const void *buf, int32 bytes, int32 offset)
+{
+    hfile_stdio_t *info = (hfile_stdio_t *)file_rec->drv_info;
+
+    if (HFIstdio_seek(file_rec, offset, STDIO_OP_WRITE) == FAIL)
+        return FAIL;
+    if ((size_t)bytes != fwrite(buf, 1, (size_t)bytes, info->fp)) {
+        info->last_op = STDIO_OP_UNKNOWN;
+        return FAIL;
+    }
+    info->pos     = offset + bytes;
+    info->last_op = STDIO_OP_WRITE;
+    return SUCCEED;
+} /* end HFIstdio_pwrite() */
+
+static int32
+HFIstdio_size(filerec_t *file_rec)
+{
+    hfile_stdio_t *info = (hfile_stdio_t *)file_rec->drv_info;
+    long           size;
+
+    info->last_op = STDIO_OP_UNKNOWN;
+    if (fseek(info->fp, 0L, SEEK_END) != 0 || (size = ftell(info->fp)) < 0)
+        return FAIL;
+    return size > (long)INT32_MAX ? INT32_MAX : (int32)size;
+} /* end HFIstdio_size() */
+
+static const hfile_driver_t stdio_driver = {
+    HDF_DRIVER_STDIO,
+    "stdio",
+    HFIstdio_open,
+    HFIstdio_create,
+    HFIstdio_close,
+    HFIstdio_flush,
+    HFIstdio_pread,
+    HFIstdio_pwrite,
+    NULL,
+    NULL,
+    NULL,
+    HFIstdio_size,
+};
+
+/*--------------------------------------------------------------------------
+                                posix driver
+ --------------------------------------------------------------------------*/
+
+#ifdef HFILE_URING
+/* An io_uring and the mappings of its queues */
+typedef struct {
+    int                  fd;        /* the ring's descriptor */
+    unsigned             entries;   /* # of submission queue entries */
+    unsigned            *sq_head;   /* submission queue */
+    unsigned            *sq_tail;
+    unsigned            *sq_mask;
+    unsigned            *sq_array;
+    struct io_uring_sqe *sqes;
+    unsigned            *cq_head;   /* completion queue */
+    unsigned            *cq_tail;
+    unsigned            *cq_mask;
+    struct io_uring_cqe *cqes;
+    void                *sq_ring;   /* mapping of the submission queue */
+    size_t               sq_size;
+    void                *cq_ring;   /* mapping of the completion queue */
+    size_t               cq_size;
+    size_t               sqes_size; /* size of the mapping of 'sqes' */
+} hfile_uring_t;
+#endif /* HFILE_URING */
+
+/* state of a file opened with the posix driver */
+typedef struct {
+    int fd; /* file descriptor */
+#ifdef HFILE_URING
+    hfile_uring_t *ring;   /* ring for batched reads, NULL until needed */
+    intn           noring; /* TRUE if the ring could not be set up */
+#endif
+} hfile_posix_t;
+
+#ifdef HFILE_URING
+static void
+HFIuring_free(hfile_uring_t *ring)
+{
+    if (ring->sqes != NULL)
+        munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != NULL && ring->cq_ring != ring->sq_ring)
+        munmap(ring->cq_ring, ring->cq_size);
+    if (ring->sq_ring != NULL)
+        munmap(ring->sq_ring, ring->sq_size);
+    close(ring->fd);
+    free(ring);
+} /* end HFIuring_free() */
+
+/* Map one of the queues of a ring, NULL on failure */
+static void *
+HFIuring_map(hfile_uring_t *ring, size_t size, off_t what)
+{
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, what);
+
+    return map == MAP_FAILED ? NULL : map;
+} /* end HFIuring_map() */
+
+/* Set up a ring, or return NULL if the kernel won't let us */
+static hfile_uring_t *
+HFIuring_new(void)
+{
+    struct io_uring_params p;
+    hfile_uring_t         *ring;
+    uint8                 *sq, *cq;
+
+    if ((ring = (hfile_uring_t *)calloc(1, sizeof(hfile_uring_t))) == NULL)
+        return NULL;
+    memset(&p, 0, sizeof(p));
+    if ((ring->fd = (int)syscall(__NR_io_uring_setup, HFILE_URING_DEPTH, &p)) < 0) {
+        free(ring);
+        return NULL;
+    }
+
+    /* Map the queues; newer kernels put both rings in one mapping */
+    ring->entries   = p.sq_entries;
+    ring->sq_size   = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ring->cq_size   = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    if ((p.features & IORING_FEAT_SINGLE_MMAP) && ring->cq_size > ring->sq_size)
+        ring->sq_size = ring->cq_size;
+    if ((ring->sq_ring = HFIuring_map(ring, ring->sq_size, IORING_OFF_SQ_RING)) == NULL)
+        goto error;
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ring = ring->sq_ring;
+    else if ((ring->cq_ring = HFIuring_map(ring, ring->cq_size, IORING_OFF_CQ_RING)) == NULL)
+        goto error;
+    if ((ring->sqes = (struct io_uring_sqe *)HFIuring_map(ring, ring->sqes_size, IORING_OFF_SQES)) == NULL)
+        goto error;
+
+    sq             = (uint8 *)ring->sq_ring;
+    cq             = (uint8 *)ring->cq_ring;
+    ring->sq_head  = (unsigned *)(void *)(sq + p.sq_off.head);
+    ring->sq_tail  = (unsigned *)(void *)(sq + p.sq_off.tail);
+    ring->sq_mask  = (unsigned *)(void *)(sq + p.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)(void *)(sq + p.sq_off.array);
+    ring->cq_head  = (unsigned *)(void *)(cq + p.cq_off.head);
+    ring->cq_tail  = (unsigned *)(void *)(cq + p.cq_off.tail);
+    ring->cq_mask  = (unsigned *)(void *)(cq + p.cq_off.ring_mask);
+    ring->cqes     = (struct io_uring_cqe *)(void *)(cq + p.cq_off.cqes);
+    return ring;
+
+error:
+    HFIuring_free(ring);
+    return NULL;
+} /* end HFIuring_new() */
+#endif /* HFILE_URING */
+
+/* Attach a newly opened descriptor to the file record.  'size' is the size
+   of the driver's state, which starts with an hfile_posix_t. */
+static intn
+HFIposix_attach(filerec_t *file_rec, int fd, size_t size)
+{
+    hfile_posix_t *info;
+
+    if (fd < 0)
+        return FAIL;
+    if ((info = (hfile_posix_t *)calloc(1, size)) == NULL) {
+        close(fd);
+        HRETURN_ERROR(DFE_NOSPACE, FAIL);
+    }
+    info->fd           = fd;
+    file_rec->drv_info = info;
+    return SUCCEED;
+} /* end HFIposix_attach() */
+
+static intn
+HFIposix_open(filerec_t *file_rec, intn acc_mode)
+{
+    int flags = ((acc_mode & DFACC_WRITE) ? O_RDWR : O_RDONLY) | O_BINARY;
+
+    return HFIposix_attach(file_rec, open(file_rec->path, flags), sizeof(hfile_posix_t));
+} /* end HFIposix_open() */
+
+static intn
+HFIposix_create(filerec_t *file_rec)
+{
+    return HFIposix_attach(file_rec, open(file_rec->path, O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0666),
+                           sizeof(hfile_posix_t));
+} /* end HFIposix_create() */
+
+static intn
+HFIposix_close(filerec_t *file_rec)
+{
+    hfile_posix_t *info = (hfile_posix_t *)file_rec->drv_info;
+    intn           ret_value;
+
+#ifdef HFILE_URING
+    if (info->ring != NULL)
+        HFIuring_free(info->ring);
+#endif
+    ret_value = close(info->fd) == 0 ? SUCCEED : FAIL;
+    free(info);
+    file_rec->drv_info = NULL;
+    return ret_value;
+} /* end HFIposix_close() */
+
+static intn
+HFIposix_flush(filerec_t *file_rec)
+{
+    (void)file_rec;
+    return SUCCEED; /* nothing is buffered */
+} /* end HFIposix_flush() */
+
+static intn
+HFIposix_pread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
+{
+    int    fd = ((hfile_posix_t *)file_rec->drv_info)->fd;
+    uint8 *p  = (uint8 *)buf;
+
+    /* Short reads are legal, keep going until everything is in */
+    while (bytes > 0) {
+#ifdef H4_HAVE_PREAD
+        ssize_t n = pread(fd, p, (size_t)bytes, (off_t)offset);
+#else
+        ssize_t n;
+
+        file_rec->stats.seeks++;
+        if (lseek(fd, (off_t)offset, SEEK_SET) < 0)
+            return FAIL;
+        n = read(fd, p, (size_t)bytes);
+#endif
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FAIL; /* error or premature end of file */
+        p += n;
+        offset += (int32)n;
+        bytes -= (int32)n;
+    }
+    return SUCCEED;
+} /* end HFIposix_pread() */
+
+static intn
+HFIposix_pwrite(filerec_t *file_rec, const void *buf, int32 bytes, int32 offset)
+{
+    int          fd = ((hfile_posix_t *)file_rec->drv_info)->fd;
+    const uint8 *p  = (const uint8 *)buf;
+
+    while (bytes > 0) {
+#ifdef H4_HAVE_PWRITE
+        ssize_t n = pwrite(fd, p, (size_t)bytes, (off_t)offset);
+#else
+        ssize_t n;
+
+        file_rec->stats.seeks++;
+        if (lseek(fd, (off_t)offset, SEEK_SET) < 0)
+            return FAIL;
+        n = write(fd, p, (size_t)bytes);
+#endif
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FAIL;
+        p += n;
+        offset += (int32)n;
+        bytes -= (int32)n;
+    }
+    return SUCCEED;
+} /* end HFIposix_pwrite() */
+
+static int32
+HFIposix_size(filerec_t *file_rec)
+{
+    off_t size = lseek(((hfile_posix_t *)file_rec->drv_info)->fd, (off_t)0, SEEK_END);
+
+    if (size < 0)
+        return FAIL;
+    return size > (off_t)INT32_MAX ? INT32_MAX : (int32)size;
+} /* end HFIposix_size() */
+
+static intn
+HFIposix_preadv(filerec_t *file_rec, intn count, void *const *bufs, const int32 *sizes, int32 offset)
+{
+#ifdef HFILE_PREADV
+    int          fd   = ((hfile_posix_t *)file_rec->drv_info)->fd;
+    struct iovec iov[HFILE_MAXIOV];
+    intn         i    = 0; /* first buffer not filled yet */
+    int32        done = 0; /* # of bytes already in buffer i */
+
+    while (i < count) {
+        intn    niov;
+        ssize_t n;
+
+        if (done == sizes[i]) {
+            i++;
+            done = 0;
+            continue;
+        }
+
+        /* The first buffer may already be partly filled by a short read */
+        iov[0].iov_base = (uint8 *)bufs[i] + done;
+        iov[0].iov_len  = (size_t)(sizes[i] - done);
+        for (niov = 1; niov < HFILE_MAXIOV && i + niov < count; niov++) {
+            iov[niov].iov_base = bufs[i + niov];
+            iov[niov].iov_len  = (size_t)sizes[i + niov];
+        }
+
+        n = preadv(fd, iov, (int)niov, (off_t)offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FAIL; /* error or premature end of file */
+        offset += (int32)n;
+
+        /* Step over the buffers filled */
+        while (n > 0) {
+            if (n < (ssize_t)(sizes[i] - done)) {
+                done += (int32)n;
+                break;
+            }
+            n -= sizes[i] - done;
+            i++;
+            done = 0;
+        }
+    }
+#else
+    intn i;
+
+    for (i = 0; i < count; i++) {
+        if (HFIposix_pread(file_rec, bufs[i], sizes[i], offset) == FAIL)
+            return FAIL;
+        offset += sizes[i];
+    }
+#endif
+    return SUCCEED;
+} /* end HFIposix_preadv() */
+
+#ifdef HFILE_URING
+/* Read a batch through the file's ring, keeping up to a ring's worth of
+   reads in flight.  Reads which come back short or failed are done again
+   with preadv, which knows how to deal with them.  The status of reads
+   not done is left alone.  Returns FAIL if the ring itself failed. */
+static intn
+HFIuring_read(filerec_t *file_rec, hfile_uring_t *ring, intn count, hfile_rdreq_t *reqs)
+{
+    int           fd       = ((hfile_posix_t *)file_rec->drv_info)->fd;
+    struct iovec *iovs     = NULL; /* iovecs of all the reads */
+    size_t        niovs    = 0;    /* # of iovecs set up / queued */
+    unsigned      inflight = 0;    /* # of reads queued and not completed */
+    intn          next     = 0;    /* next read to queue */
+    intn          i, j;
+    intn          ret_value = SUCCEED;
+
+    for (i = 0; i < count; i++)
+        niovs += (size_t)reqs[i].count;
+    if ((iovs = (struct iovec *)malloc(niovs * sizeof(struct iovec))) == NULL)
+        return SUCCEED; /* the ring is fine, the reads will be done without it */
+    for (i = 0, niovs = 0; i < count; i++) {
+        for (j = 0; j < reqs[i].count; j++, niovs++) {
+            iovs[niovs].iov_base = reqs[i].bufs[j];
+            iovs[niovs].iov_len  = (size_t)reqs[i].sizes[j];
+        }
+    }
+
+    niovs = 0;
+    while (next < count || inflight > 0) {
+        unsigned tail = *ring->sq_tail;
+        unsigned head;
+
+        /* Queue as many reads as the ring has room for */
+        while (next < count && inflight < ring->entries) {
+            unsigned             idx = tail & *ring->sq_mask;
+            struct io_uring_sqe *sqe = &ring->sqes[idx];
+
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode         = IORING_OP_READV;
+            sqe->fd             = fd;
+            sqe->off            = (__u64)reqs[next].offset;
+            sqe->addr           = (__u64)(uintptr_t)(iovs + niovs);
+            sqe->len            = (__u32)reqs[next].count;
+            sqe->user_data      = (__u64)next;
+            ring->sq_array[idx] = idx;
+            niovs += (size_t)reqs[next].count;
+            tail++;
+            next++;
+            inflight++;
+        }
+        __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+
+        /* Submit what the kernel hasn't picked up yet and wait for at
+           least one read to complete */
+        if (syscall(__NR_io_uring_enter, ring->fd, tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE), 1,
+                    IORING_ENTER_GETEVENTS, NULL, 0) < 0 &&
+            errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            ret_value = FAIL;
+            break;
+        }
+
+        for (head = *ring->cq_head; head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE); head++) {
+            struct io_uring_cqe *cqe   = &ring->cqes[head & *ring->cq_mask];
+            hfile_rdreq_t       *req   = &reqs[cqe->user_data];
+            int64_t              total = 0;
+
+            for (j = 0; j < req->count; j++)
+                total += req->sizes[j];
+            if (cqe->res == total)
+                req->status = SUCCEED;
+            else
+                req->status = HFIposix_preadv(file_rec, req->count, req->bufs, req->sizes, req->offset);
+            inflight--;
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    free(iovs);
+    return ret_value;
+} /* end HFIuring_read() */
+#endif /* HFILE_URING */
+
+static intn
+HFIposix_pread_batch(filerec_t *file_rec, intn count, hfile_rdreq_t *reqs)
+{
+    intn i;
+    intn ret_value = SUCCEED;
+
+    for (i = 0; i < count; i++)
+        reqs[i].status = FAIL;
+
+#ifdef HFILE_URING
+    {
+        hfile_posix_t *info   = (hfile_posix_t *)file_rec->drv_info;
+        intn           usable = count > 1; /* a single read gains nothing */
+
+        for (i = 0; i < count; i++)
+            if (reqs[i].count > HFILE_MAXIOV)
+                usable = FALSE; /* more buffers than a readv takes */
+        if (usable && info->ring == NULL && !info->noring)
+            if ((info->ring = HFIuring_new()) == NULL)
+                info->noring = TRUE;
+
+        /* If the ring is broken, don't use it again */
+        if (usable && info->ring != NULL && HFIuring_read(file_rec, info->ring, count, reqs) == FAIL) {
+            HFIuring_free(info->ring);
+            info->ring   = NULL;
+            info->noring = TRUE;
+        }
+    }
+#endif
+
+    /* Whatever the ring didn't do is read one at a time */
+    for (i = 0; i < count; i++) {
+        if (reqs[i].status == FAIL)
+            reqs[i].status =
+                HFIposix_preadv(file_rec, reqs[i].count, reqs[i].bufs, reqs[i].sizes, reqs[i].offset);
+        if (reqs[i].status == FAIL)
+            ret_value = FAIL;
+    }
+    return ret_value;
+} /* end HFIposix_pread_batch() */
+
+static const hfile_driver_t posix_driver = {
+    HDF_DRIVER_POSIX,
+    "posix",
+    HFIposix_open,
+    HFIposix_create,
+    HFIposix_close,
+    HFIposix_flush,
+    HFIposix_pread,
+    HFIposix_pwrite,
+    NULL,
+    HFIposix_preadv,
+    HFIposix_pread_batch,
+    HFIposix_size,
+};
+
+/*--------------------------------------------------------------------------
+                                mmap driver
+ --------------------------------------------------------------------------*/
+
+#ifdef HFILE_MMAP
+/* state of a file opened with the mmap driver */
+typedef struct {
+    hfile_posix_t posix; /* the posix driver's state; must be first */
+    uint8        *map;   /* read-only mapping of the file, or NULL */
+    size_t        size;  /* # of bytes mapped */
+} hfile_mmap_t;
+
+static intn
+HFImmap_open(filerec_t *file_rec, intn acc_mode)
+{
+    hfile_mmap_t *info;
+    struct stat   sb;
+    void         *map;
+
+    /* Files opened for write are not mapped; they behave as posix files */
+    if (HFIposix_attach(file_rec, open(file_rec->path, ((acc_mode & DFACC_WRITE) ? O_RDWR : O_RDONLY) | O_BINARY),
+                        sizeof(hfile_mmap_t)) == FAIL)
+        return FAIL;
+    if (acc_mode & DFACC_WRITE)
+        return SUCCEED;
+
+    info = (hfile_mmap_t *)file_rec->drv_info;
+    if (fstat(info->posix.fd, &sb) != 0 || sb.st_size <= 0 || sb.st_size > INT32_MAX)
+        return SUCCEED; /* leave it to pread */
+    map = mmap(NULL, (size_t)sb.st_size, PROT_READ, MAP_SHARED, info->posix.fd, (off_t)0);
+    if (map != MAP_FAILED) {
+        info->map  = (uint8 *)map;
+        info->size = (size_t)sb.st_size;
+    }
+    return SUCCEED;
+} /* end HFImmap_open() */
+
+static intn
+HFImmap_create(filerec_t *file_rec)
+{
+    return HFIposix_attach(file_rec, open(file_rec->path, O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0666),
+                           sizeof(hfile_mmap_t));
+} /* end HFImmap_create() */
+
+static intn
+HFImmap_close(filerec_t *file_rec)
+{
+    hfile_mmap_t *info = (hfile_mmap_t *)file_rec->drv_info;
+
+    if (info->map != NULL)
+        munmap(info->map, info->size);
+    return HFIposix_close(file_rec);
+} /* end HFImmap_close() */
+
+static intn
+HFImmap_pread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
+{
+    hfile_mmap_t *info = (hfile_mmap_t *)file_rec->drv_info;
+
+    if (info->map == NULL)
+        return HFIposix_pread(file_rec, buf, bytes, offset);
+    if (offset < 0 || bytes < 0 || (size_t)offset + (size_t)bytes > info->size)
+        return FAIL;
+    memcpy(buf, info->map + offset, (size_t)bytes);
+    return SUCCEED;
+} /* end HFImmap_pread() */
+
+static const void *
+HFImmap_map(filerec_t *file_rec, int32 offset, int32 bytes)
+{
+    hfile_mmap_t *info = (hfile_mmap_t *)file_rec->drv_info;
+
+    if (info->map == NULL || offset < 0 || bytes < 0 || (size_t)offset + (size_t)bytes > info->size)
+        return NULL;
+    return info->map + offset;
+} /* end HFImmap_map() */
+
+static intn
+HFImmap_preadv(filerec_t *file_rec, intn count, void *const *bufs, const int32 *sizes, int32 offset)
+{
+    hfile_mmap_t *info = (hfile_mmap_t *)file_rec->drv_info;
+    intn          i;
+
+    if (info->map == NULL)
+        return HFIposix_preadv(file_rec, count, bufs, sizes, offset);
+    for (i = 0; i < count; i++) {
+        if (HFImmap_pread(file_rec, bufs[i], sizes[i], offset) == FAIL)
+            return FAIL;
+        offset += sizes[i];
+    }
+    return SUCCEED;
+} /* end HFImmap_preadv() */
+
+static intn
+HFImmap_pread_batch(filerec_t *file_rec, intn count, hfile_rdreq_t *reqs)
+{
+    hfile_mmap_t *info = (hfile_mmap_t *)file_rec->drv_info;
+    intn          i;
+    intn          ret_value = SUCCEED;
+
+    if (info->map == NULL)
+        return HFIposix_pread_batch(file_rec, count, reqs);
+    for (i = 0; i < count; i++) {
+        reqs[i].status = HFImmap_preadv(file_rec, reqs[i].count, reqs[i].bufs, reqs[i].sizes, reqs[i].offset);
+        if (reqs[i].status == FAIL)
+            ret_value = FAIL;
+    }
+    return ret_value;
+} /* end HFImmap_pread_batch() */
+
+static int32
+HFImmap_size(filerec_t *file_rec)
+{
+    hfile_mmap_t *info = (hfile_mmap_t *)file_rec->drv_info;
+
+    if (info->map == NULL)
+        return HFIposix_size(file_rec);
+    return (int32)info->size;
+} /* end HFImmap_size() */
+
+static const hfile_driver_t mmap_driver = {
+    HDF_DRIVER_MMAP,
+    "mmap",
+    HFImmap_open,
+    HFImmap_create,
+    HFImmap_close,
+    HFIposix_flush,
+    HFImmap_pread,
+    HFIposix_pwrite,
+    HFImmap_map,
+    HFImmap_preadv,
+    HFImmap_pread_batch,
+    HFImmap_size,
+};
+#endif /* HFILE_MMAP */
+
+/*--------------------------------------------------------------------------
+                                memory driver
+ --------------------------------------------------------------------------*/
+
+/* The minimum allocation for a memory file image */
+#define MEM_IMAGE_MIN 4096
+
+/* state of a file opened with the memory driver */
+typedef struct {
+    uint8 *image;     /* the file image */
+    int32  eof;       /* logical size of the file image */
+    size_t alloc;     /* # of bytes allocated for the image */
+    intn   writeable; /* whether the image may be written back to the file */
+    intn   dirty;     /* whether the image differs from the file on disk */
+} hfile_mem_t;
+
+static hfile_mem_t *
+HFImem_new(intn writeable)
+{
+    hfile_mem_t *info;
+
+    if ((info = (hfile_mem_t *)calloc(1, sizeof(hfile_mem_t))) == NULL)
+        HRETURN_ERROR(DFE_NOSPACE, NULL);
+    info->writeable = writeable;
+    return info;
+} /* end HFImem_new() */
+
+/* Make sure the image has room for at least 'size' bytes */
+static intn
+HFImem_reserve(hfile_mem_t *info, size_t size)
+{
+    size_t new_alloc;
+    uint8 *new_image;
+
+    if (size <= info->alloc)
+        return SUCCEED;
+
+    new_alloc = info->alloc < MEM_IMAGE_MIN ? MEM_IMAGE_MIN : info->alloc;
+    while (new_alloc < size)
+        new_alloc *= 2;
+    if ((new_image = (uint8 *)realloc(info->image, new_alloc)) == NULL)
+        HRETURN_ERROR(DFE_NOSPACE, FAIL);
+    info->image = new_image;
+    info->alloc = new_alloc;
+    return SUCCEED;
+} /* end HFImem_reserve() */
+
+static intn
+HFImem_open(filerec_t *file_rec, intn acc_mode)
+{
+    hfile_mem_t *info = NULL;
+    FILE        *fp;
+    long         size;
+    intn         ret_value = SUCCEED;
+
+    /* Opening for write checks that the file may be written back later */
+    fp = (acc_mode & DFACC_WRITE) ? fopen(file_rec->path, "rb+") : fopen(file_rec->path, "rb");
+    if (fp == NULL)
+        return FAIL;
+
+    if ((info = HFImem_new(acc_mode & DFACC_WRITE)) == NULL)
+        HGOTO_DONE(FAIL);
+    if (fseek(fp, 0L, SEEK_END) != 0 || (size = ftell(fp)) < 0 || fseek(fp, 0L, SEEK_SET) != 0)
+        HGOTO_DONE(FAIL);
+    if (size > INT32_MAX)
+        HGOTO_DONE(FAIL);
+    if (HFImem_reserve(info, (size_t)size) == FAIL)
+        HGOTO_DONE(FAIL);
+    if (size > 0 && fread(info->image, 1, (size_t)size, fp) != (size_t)size)
+        HGOTO_DONE(FAIL);
+    info->eof          = (int32)size;
+    file_rec->drv_info = info;
+
+done:
+    fclose(fp);
+    if (ret_value == FAIL && info != NULL) {
+        free(info->image);
+        free(info);
+    }
+    return ret_value;
+} /* end HFImem_open() */
+
+static intn
+HFImem_create(filerec_t *file_rec)
+{
+    hfile_mem_t *info;
+    FILE        *fp;
+
+    /* Create (or truncate) the file now, so errors are reported by Hopen */
+    if ((fp = fopen(file_rec->path, "wb")) == NULL)
+        return FAIL;
+    fclose(fp);
+
+    if ((info = HFImem_new(TRUE)) == NULL)
+        return FAIL;
+    file_rec->drv_info = info;
+    return SUCCEED;
+} /* end HFImem_create() */
+
+static intn
+HFImem_flush(filerec_t *file_rec)
+{
+    hfile_mem_t *info = (hfile_mem_t *)file_rec->drv_info;
+    FILE        *fp;
+    char        *tmpname;
+    intn         ret_value = SUCCEED;
+
+    if (!info->writeable || !info->dirty)
+        return SUCCEED;
+
+    /* Write the image under a temporary name, then move it into place */
+    if ((tmpname = HFPtmpfile_create(file_rec->path)) == NULL)
+        return FAIL;
+    if ((fp = fopen(tmpname, "wb")) == NULL)
+        ret_value = FAIL;
+    else {
+        if (info->eof > 0 && fwrite(info->image, 1, (size_t)info->eof, fp) != (size_t)info->eof)
+            ret_value = FAIL;
+        if (fclose(fp) != 0)
+            ret_value = FAIL;
+    }
+    if (ret_value == FAIL)
+        remove(tmpname);
+    else if (HFPtmpfile_commit(tmpname, file_rec->path) == FAIL)
+        ret_value = FAIL;
+    else
+        info->dirty = FALSE;
+
+    free(tmpname);
+    return ret_value;
+} /* end HFImem_flush() */
+
+static intn
+HFImem_close(filerec_t *file_rec)
+{
+    hfile_mem_t *info = (hfile_mem_t *)file_rec->drv_info;
+    intn         ret_value;
+
+    ret_value = HFImem_flush(file_rec);
+    free(info->image);
+    free(info);
+    file_rec->drv_info = NULL;
+    return ret_value;
+} /* end HFImem_close() */
+
+static intn
+HFImem_pread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
+{
+    hfile_mem_t *info = (hfile_mem_t *)file_rec->drv_info;
+
+    if (offset < 0 || bytes < 0 || (int64_t)offset + bytes > info->eof)
+        return FAIL;
+    memcpy(buf, info->image + offset, (size_t)bytes);
+    return SUCCEED;
+} /* end HFImem_pread() */
+
+static intn
+HFImem_pwrite(filerec_t *file_rec, const void *buf, int32 bytes, int32 offset)
+{
+    hfile_mem_t *info = (hfile_mem_t *)file_rec->drv_info;
+    int64_t      end  = (int64_t)offset + bytes;
+
+    if (offset < 0 || bytes < 0 || end > INT32_MAX)
+        return FAIL;
+    if (HFImem_reserve(info, (size_t)end) == FAIL)
+        return FAIL;
+
+    /* Writing past the end of the image leaves a zero-filled hole */
+    if (offset > info->eof)
+        memset(info->image + info->eof, 0, (size_t)(offset - info->eof));
+    memcpy(info->image + offset, buf, (size_t)bytes);
+    if (end > info->eof)
+        info->eof = (int32)end;
+    info->dirty = TRUE;
+    return SUCCEED;
+} /* end HFImem_pwrite() */
+
+static const void *
+HFImem_map(filerec_t *file_rec, int32 offset, int32 bytes)
+{
+    hfile_mem_t *info = (hfile_mem_t *)file_rec->drv_info;
+
+    if (offset < 0 || bytes < 0 || (int64_t)offset + bytes > info->eof)
+        return NULL;
+    return info->image + offset;
+} /* end HFImem_map() */
+
+static int32
+HFImem_size(filerec_t *file_rec)
+{
+    return ((hfile_mem_t *)file_rec->drv_info)->eof;
+} /* end HFImem_size() */
+
+static const hfile_driver_t mem_driver = {
+    HDF_DRIVER_MEMORY,
+    "memory",
+    HFImem_open,
+    HFImem_create,
+    HFImem_close,
+    HFImem_flush,
+    HFImem_pread,
+    HFImem_pwrite,
+    HFImem_map,
+    NULL,
+    NULL,
+    HFImem_size,
+};
+
+/*--------------------------------------------------------------------------
+                                image driver
+ --------------------------------------------------------------------------*/
+
+/* A memory image registered with HFPimage_register.  The caller's image
+   is only read, in place, until the image is first opened for write; it is
+   then copied into a memory driver state owned by the library, whose
+   'writeable' flag is set, so the memory driver's callbacks can be used on
+   it. */
+typedef struct hfile_image_t {
+    hfile_mem_t           mem;                       /* the library's image; must be first */
+    const uint8          *user_image;                /* the caller's read-only image */
+    char                  name[HFILE_IMAGE_NAMELEN]; /* path name of the image */
+    intn                  nopen;                     /* # of driver states using it */
+    struct hfile_image_t *next;                      /* next registered image */
+} hfile_image_t;
+
+/* The list of registered images, and a counter to name them */
+static hfile_image_t *image_list  = NULL;
+static uint32         image_count = 0;
+
+static hfile_image_t *
+HFIimage_find(const char *path)
+{
+    hfile_image_t *img;
+
+    for (img = image_list; img != NULL; img = img->next)
+        if (STREQ(path, img->name))
+            return img;
+    return NULL;
+} /* end HFIimage_find() */
+
+/* The current contents of an image */
+static const uint8 *
+HFIimage_data(const hfile_image_t *img)
+{
+    return img->mem.writeable ? img->mem.image : img->user_image;
+} /* end HFIimage_data() */
+
+/* Copy the user's image into a buffer owned by the library */
+static intn
+HFIimage_own(hfile_image_t *img)
+{
+    if (img->mem.writeable)
+        return SUCCEED;
+
+    if (HFImem_reserve(&img->mem, (size_t)img->mem.eof) == FAIL)
+        return FAIL;
+    if (img->mem.eof > 0)
+        memcpy(img->mem.image, img->user_image, (size_t)img->mem.eof);
+    img->mem.writeable = TRUE;
+    return SUCCEED;
+} /* end HFIimage_own() */
+
+static intn
+HFIimage_open(filerec_t *file_rec, intn acc_mode)
+{
+    hfile_image_t *img;
+
+    if ((img = HFIimage_find(file_rec->path)) == NULL)
+        return FAIL;
+    if ((acc_mode & DFACC_WRITE) && HFIimage_own(img) == FAIL)
+        return FAIL;
+
+    img->nopen++;
+    file_rec->drv_info = img;
+    return SUCCEED;
+} /* end HFIimage_open() */
+
+static intn
+HFIimage_create(filerec_t *file_rec)
+{
+    hfile_image_t *img;
+
+    if ((img = HFIimage_find(file_rec->path)) == NULL)
+        return FAIL;
+
+    /* Start over with an empty image, keeping any buffer we own */
+    img->mem.writeable = TRUE;
+    img->mem.eof       = 0;
+
+    img->nopen++;
+    file_rec->drv_info = img;
+    return SUCCEED;
+} /* end HFIimage_create() */
+
+static intn
+HFIimage_close(filerec_t *file_rec)
+{
+    hfile_image_t *img = (hfile_image_t *)file_rec->drv_info;
+
+    /* The image itself stays registered until HFPimage_release */
+    img->nopen--;
+    file_rec->drv_info = NULL;
+    return SUCCEED;
+} /* end HFIimage_close() */
+
+static intn
+HFIimage_flush(filerec_t *file_rec)
+{
+    (void)file_rec;
+    return SUCCEED;
+} /* end HFIimage_flush() */
+
+static intn
+HFIimage_pread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
+{
+    hfile_image_t *img = (hfile_image_t *)file_rec->drv_info;
+
+    if (offset < 0 || bytes < 0 || (int64_t)offset + bytes > img->mem.eof)
+        return FAIL;
+    memcpy(buf, HFIimage_data(img) + offset, (size_t)bytes);
+    return SUCCEED;
+} /* end HFIimage_pread() */
+
+static intn
+HFIimage_pwrite(filerec_t *file_rec, const void *buf, int32 bytes, int32 offset)
+{
+    hfile_image_t *img = (hfile_image_t *)file_rec->drv_info;
+
+    /* Never write to the user's image */
+    if (!img->mem.writeable)
+        return FAIL;
+    return HFImem_pwrite(file_rec, buf, bytes, offset);
+} /* end HFIimage_pwrite() */
+
+static const void *
+HFIimage_map(filerec_t *file_rec, int32 offset, int32 bytes)
+{
+    hfile_image_t *img = (hfile_image_t *)file_rec->drv_info;
+
+    if (offset < 0 || bytes < 0 || (int64_t)offset + bytes > img->mem.eof)
+        return NULL;
+    return HFIimage_data(img) + offset;
+} /* end HFIimage_map() */
+
+static const hfile_driver_t image_driver = {
+    HDF_DRIVER_IMAGE,
+    "image",
+    HFIimage_open,
+    HFIimage_create,
+    HFIimage_close,
+    HFIimage_flush,
+    HFIimage_pread,
+    HFIimage_pwrite,
+    HFIimage_map,
+    NULL,
+    NULL,
+    HFImem_size,
+};
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPimage_register -- register a memory image as a file
+ USAGE
+    intn HFPimage_register(image, size, name)
+        const void *image;  IN: the file image, or NULL for an empty image
+        int32 size;         IN: # of bytes in the image
+        char *name;         OUT: buffer of HFILE_IMAGE_NAMELEN bytes for
+                                 the path name to open the image with
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    The image is not copied; it must stay valid and unchanged until the
+    image is released or first opened for write.
+--------------------------------------------------------------------------*/
+intn
+HFPimage_register(const void *image, int32 size, char *name)
+{
+    hfile_image_t *img;
+
+    if (name == NULL || size < 0 || (image == NULL && size > 0))
+        HRETURN_ERROR(DFE_ARGS, FAIL);
+    if ((img = (hfile_image_t *)calloc(1, sizeof(hfile_image_t))) == NULL)
+        HRETURN_ERROR(DFE_NOSPACE, FAIL);
+
+    img->user_image = (const uint8 *)image;
+    img->mem.eof    = size;
+    snprintf(img->name, sizeof(img->name), "(HDF memory image %u)", (unsigned)++image_count);
+    img->next  = image_list;
+    image_list = img;
+
+    strcpy(name, img->name);
+    return SUCCEED;
+} /* end HFPimage_register() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPimage_release -- unregister a memory image
+ USAGE
+    intn HFPimage_release(name, image, size)
+        const char *name;   IN: path name of the image
+        void **image;       OUT: the final image (may be NULL)
+        int32 *size;        OUT: # of bytes in the final image (may be NULL)
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    Fails if the image is still open.  If the image was never opened for
+    write, the image returned is the one given to HFPimage_register;
+    otherwise it is a buffer which the caller must free with free().
+    If 'image' is NULL, a buffer owned by the library is freed.
+--------------------------------------------------------------------------*/
+intn
+HFPimage_release(const char *name, void **image, int32 *size)
+{
+    hfile_image_t **pimg;
+    hfile_image_t  *img;
+
+    for (pimg = &image_list; *pimg != NULL; pimg = &(*pimg)->next)
+        if (STREQ(name, (*pimg)->name))
+            break;
+    if ((img = *pimg) == NULL)
+        HRETURN_ERROR(DFE_ARGS, FAIL);
+    if (img->nopen > 0)
+        HRETURN_ERROR(DFE_OPENAID, FAIL);
+
+    *pimg = img->next;
+    if (image == NULL)
+        free(img->mem.image);
+    else if (img->mem.writeable)
+        *image = img->mem.image;
+    else /* hand the caller's own image back to it, as it was given */
+        *image = (void *)(uintptr_t)img->user_image;
+    if (size != NULL)
+        *size = img->mem.eof;
+    free(img);
+    return SUCCEED;
+} /* end HFPimage_release() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPshutdown -- free the images which were never released
+ USAGE
+    intn HFPshutdown()
+ RETURNS
+    SUCCEED
+ COMMENTS, BUGS, ASSUMPTIONS
+    Should only ever be called by the "atexit" function HDFend
+--------------------------------------------------------------------------*/
+intn
+HFPshutdown(void)
+{
+    hfile_image_t *img;
+
+    while ((img = image_list) != NULL) {
+        image_list = img->next;
+        free(img->mem.image);
+        free(img);
+    }
+    return SUCCEED;
+} /* end HFPshutdown() */
+
+/*--------------------------------------------------------------------------
+                              replacing files
+ --------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPtmpfile_create -- create a temporary file to replace a file with
+ USAGE
+    char *HFPtmpfile_create(path)
+        const char *path;   IN: path name of the file to be replaced
+ RETURNS
+    The name of the new, empty file (to be freed with free()), or NULL
+ DESCRIPTION
+    The name is 'path' with a unique suffix, so the file is in the same
+    directory as 'path' and can be renamed over it by HFPtmpfile_commit.
+    An existing file is never overwritten.
+--------------------------------------------------------------------------*/
+char *
+HFPtmpfile_create(const char *path)
+{
+    char *tmpname;
+    int   fd;
+
+    if (path == NULL)
+        HRETURN_ERROR(DFE_ARGS, NULL);
+    if ((tmpname = (char *)malloc(strlen(path) + 8)) == NULL)
+        HRETURN_ERROR(DFE_NOSPACE, NULL);
+#ifdef H4_HAVE_MKSTEMP
+    sprintf(tmpname, "%s.XXXXXX", path);
+    fd = mkstemp(tmpname);
+#else
+    {
+        unsigned n;
+
+        fd = -1;
+        for (n = 0; fd < 0 && n < 1000000; n++) {
+            sprintf(tmpname, "%s.%06u", path, n);
+            if ((fd = open(tmpname, O_WRONLY | O_CREAT | O_EXCL | O_BINARY, 0666)) < 0 && errno != EEXIST)
+                break;
+        }
+    }
+#endif
+    if (fd < 0) {
+        free(tmpname);
+        HRETURN_ERROR(DFE_BADOPEN, NULL);
+    }
+    close(fd);
+    return tmpname;
+} /* end HFPtmpfile_create() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPtmpfile_commit -- replace a file with a temporary file
+ USAGE
+    intn HFPtmpfile_commit(tmpname, path)
+        const char *tmpname; IN: name of the file from HFPtmpfile_create
+        const char *path;    IN: path name of the file to be replaced
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    The temporary file is synced to disk, given the permissions of the
+    file it replaces and renamed over it, so 'path' always names either
+    the old or the new file, in full.  If anything fails, the temporary
+    file is removed and 'path' is left as it was.
+--------------------------------------------------------------------------*/
+intn
+HFPtmpfile_commit(const char *tmpname, const char *path)
+{
+    intn ret_value = SUCCEED;
+
+#ifdef H4_HAVE_FSYNC
+    {
+        int fd;
+
+        if ((fd = open(tmpname, O_RDWR | O_BINARY)) < 0)
+            HGOTO_ERROR(DFE_BADOPEN, FAIL);
+        if (fsync(fd) != 0) {
+            close(fd);
+            HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+        }
+        if (close(fd) != 0)
+            HGOTO_ERROR(DFE_CANTCLOSE, FAIL);
+    }
+#endif
+#ifdef H4_HAVE_MKSTEMP
+    {
+        struct stat sb;
+
+        /* mkstemp() makes the file private to its owner */
+        if (stat(path, &sb) == 0 && chmod(tmpname, sb.st_mode & 07777) != 0)
+            HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+    }
+#endif
+
+#ifdef H4_HAVE_WIN32_API
+    if (!MoveFileExA(tmpname, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+#else
+    if (rename(tmpname, path) != 0)
+        HGOTO_ERROR(DFE_WRITEERROR, FAIL);
+#endif
+
+done:
+    if (ret_value == FAIL)
+        remove(tmpname);
+    return ret_value;
+} /* end HFPtmpfile_commit() */
+
+/*--------------------------------------------------------------------------
+                              driver registry
+ --------------------------------------------------------------------------*/
+
+/* Table of the available drivers, terminated with a NULL entry */
+static const hfile_driver_t *const driver_table[] = {&stdio_driver, &posix_driver, &mem_driver,
+#ifdef HFILE_MMAP
+                                                     &mmap_driver,
+#endif
+                                                     NULL};
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPfind_driver -- look up a file driver
+ USAGE
+    const hfile_driver_t *HFPfind_driver(type)
+        intn type;          IN: HDF_DRIVER_xxx code of the driver
+ RETURNS
+    Pointer to the driver table, or NULL if there is no such driver
+--------------------------------------------------------------------------*/
+const hfile_driver_t *
+HFPfind_driver(intn type)
+{
+    intn i;
+
+    for (i = 0; driver_table[i] != NULL; i++)
+        if (driver_table[i]->type == type)
+            return driver_table[i];
+    return NULL;
+} /* end HFPfind_driver() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPget_default_driver -- get the driver for newly opened files
+ USAGE
+    const hfile_driver_t *HFPget_default_driver()
+ RETURNS
+    Pointer to the driver table
+ DESCRIPTION
+    Returns the driver set by HFPset_default_driver.  If none was set,
+    the HDF4_DRIVER environment variable is consulted the first time
+    through, falling back to the stdio driver.
+--------------------------------------------------------------------------*/
+const hfile_driver_t *
+HFPget_default_driver(void)
+{
+    if (default_driver == NULL) {
+        const char *env = getenv("HDF4_DRIVER");
+        intn        i;
+
+        default_driver = &stdio_driver;
+        if (env != NULL)
+            for (i = 0; driver_table[i] != NULL; i++)
+                if (STREQ(env, driver_table[i]->name))
+                    default_driver = driver_table[i];
+    } /* end if */
+
+    return default_driver;
+} /* end HFPget_default_driver() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPset_default_driver -- set the driver for newly opened files
+ USAGE
+    intn HFPset_default_driver(type)
+        intn type;          IN: HDF_DRIVER_xxx code of the driver
+ RETURNS
+    SUCCEED/FAIL
+--------------------------------------------------------------------------*/
+intn
+HFPset_default_driver(intn type)
+{
+    const hfile_driver_t *drv;
+
+    if ((drv = HFPfind_driver(type)) == NULL)
+        HRETURN_ERROR(DFE_ARGS, FAIL);
+    default_driver = drv;
+    return SUCCEED;
+} /* end HFPset_default_driver() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFPget_driver -- get the driver to open a file with
+ USAGE
+    const hfile_driver_t *HFPget_driver(path)
+        const char *path;   IN: path name of the file
+ RETURNS
+    Pointer to the driver table
+ DESCRIPTION
+    Memory images registered with HFPimage_register are opened with the
+    image driver, all other files with the default driver.
+--------------------------------------------------------------------------*/
+const hfile_driver_t *
+HFPget_driver(const char *path)
+{
+    if (image_list != NULL && HFIimage_find(path) != NULL)
+        return &image_driver;
+    return HFPget_default_driver();
+} /* end HFPget_driver() */
@@ -0,0 +1,713 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+FILE
+    hfileidx.c - Metadata index files kept next to HDF files.
+
+REMARKS
+    Opening a large file reads all of its DD blocks, and the interfaces
+    then read every vgroup, vdata header and dataset description with a
+    small read of its own (Vinitialize, SDstart, ...).  When the same files
+    are opened over and over, these reads make up most of the open time.
+    With the metadata index on (see Hsetmetaindex), the bytes of the DD
+    blocks and of the metadata elements of a file opened read-only are
+    saved in a sidecar file, named after the file with HIX_SUFFIX appended,
+    when the file is closed.  The next opens load the sidecar with a single
+    read and serve every read it covers from memory.
+
+DESIGN
+    The sidecar is a header, a table of the ranges of the file it holds
+    (sorted by offset, not overlapping) and the bytes of those ranges:
+
+        magic[8] version size mtime_hi mtime_lo mtime_ns nranges checksum
+        { offset length } * nranges
+        bytes of the ranges
+
+    with all numbers 32-bit big-endian.  The ranges are the magic number,
+    all DD blocks, and the elements whose tags hold metadata (see
+    HIXPis_meta), up to HIX_MAX_BYTES bytes in all.
+
+    A sidecar is only used if the size and modification time of the file
+    are those recorded, the checksum of its contents is right, and the
+    first DD block of the file still matches the copy in the sidecar.
+    Otherwise it is ignored, and written again when the file is closed.
+    Since the index is a copy of the file it is dropped as soon as the file
+    is written to, and it is only loaded for files opened read-only with
+    drivers which don't hold the file in memory anyway (no 'map' callback).
+
+    Writing a sidecar is best effort: any failure just leaves the file
+    without one.  It is written under a temporary name (see
+    HFPtmpfile_create) and renamed into place, so readers never see a
+    partial sidecar.  Opening a file for writing removes its sidecar, but
+    only if that file really starts with the header of a sidecar.
+
+BUGS/LIMITATIONS
+    The index holds the raw bytes of the metadata, not the structures the
+    interfaces decode from them, so SDstart and Vstart still do the
+    decoding; they no longer wait for the disk to do it.  The modification
+    time is compared to the nanosecond where struct stat has st_mtim, and
+    only to the second elsewhere.
+
+EXPORTED ROUTINES
+    HIXPset     - Turn the index of files opened from now on on or off
+    HIXPenabled - Whether files opened now are indexed
+    HIXPload    - Load the sidecar of a file being opened
+    HIXPavail   - Get the bytes of the file the index holds from an offset
+    HIXPread    - Serve a read from the index
+    HIXPsave    - Write the sidecar of a file being closed
+    HIXPdrop    - Remove the sidecar of a file opened for writing
+    HIXPfree    - Drop the index of a file
+    HIXPis_meta - Whether an element is metadata to keep in the index
+
+LOCAL ROUTINES
+    HIXIsidecar  - Build the name of the sidecar of a file
+    HIXIstamp    - Get the size and modification time of a file
+    HIXIchecksum - Checksum the contents of a sidecar
+    HIXIfind     - Find the range holding an offset
+*/
+
+#include "hdfi.h"
+#include "hfile.h"
+
+/* Appended to the name of a file to get the name of its sidecar */
+#define HIX_SUFFIX ".hdx"
+
+/* Magic number and version of the sidecar format */
+#define HIX_MAGIC     "HDF4MIDX"
+#define HIX_MAGIC_LEN 8
+#define HIX_VERSION   2
+
+/* Size of the sidecar header, and of one entry of its range table */
+#define HIX_HDR_SIZE   (HIX_MAGIC_LEN + 7 * 4)
+#define HIX_RANGE_SIZE 8
+
+/* Largest metadata element kept, and most bytes kept for a file */
+#define HIX_MAX_ELEM  65536
+#define HIX_MAX_BYTES (16 * 1024 * 1024)
+
+/* Largest vdata kept: attribute values and dimension records */
+#define HIX_MAX_VS 1024
+
+/* One range of the file held in the index */
+typedef struct hix_range_t {
+    int32        offset; /* offset of the range in the file */
+    int32        length; /* # of bytes in the range */
+    const uint8 *data;   /* the bytes, in the image of the sidecar */
+} hix_range_t;
+
+struct hfile_idx_t {
+    uint8       *image;   /* the sidecar, as read */
+    intn         nranges; /* # of ranges */
+    hix_range_t *ranges;  /* the ranges, sorted by offset */
+};
+
+/* Stamp of a file a sidecar is valid for */
+typedef struct hix_stamp_t {
+    int32  size;     /* size of the file */
+    uint32 mtime_hi; /* modification time of the file, high and low words */
+    uint32 mtime_lo;
+    uint32 mtime_ns; /* nanoseconds of the modification time, 0 if unknown */
+} hix_stamp_t;
+
+/* Whether two stamps are those of the same version of a file */
+#define HIX_SAME_STAMP(a, b)                                                                             \
+    ((a).size == (b).size && (a).mtime_hi == (b).mtime_hi && (a).mtime_lo == (b).mtime_lo &&             \
+     (a).mtime_ns == (b).mtime_ns)
+
+/* -1 until decided from the HDF4_METAINDEX environment variable */
+static intn index_files = -1;
+
+/* Build the name of the sidecar of a file, NULL on failure; free() it */
+static char *
+HIXIsidecar(const char *path)
+{
+    size_t len = strlen(path);
+    char  *name;
+
+    if ((name = (char *)malloc(len + strlen(HIX_SUFFIX) + 1)) == NULL)
+        return NULL;
+    memcpy(name, path, len);
+    strcpy(name + len, HIX_SUFFIX);
+    return name;
+} /* end HIXIsidecar() */
+
+/* Get the stamp of the file of a file record */
+static intn
+HIXIstamp(filerec_t *file_rec, hix_stamp_t *stamp)
+{
+#ifdef H4_HAVE_SYS_STAT_H
+    struct stat sb;
+    uint64_t    mtime;
+
+    if (stat(file_rec->path, &sb) != 0)
+        return FAIL;
+    if ((stamp->size = file_rec->driver->size(file_rec)) == FAIL)
+        return FAIL;
+    mtime           = (uint64_t)sb.st_mtime;
+    stamp->mtime_hi = (uint32)(mtime >> 32);
+    stamp->mtime_lo = (uint32)mtime;
+#ifdef H4_HAVE_STRUCT_STAT_ST_MTIM
+    stamp->mtime_ns = (uint32)sb.st_mtim.tv_nsec;
+#else
+    stamp->mtime_ns = 0;
+#endif
+    return SUCCEED;
+#else
+    (void)file_rec;
+    (void)stamp;
+    return FAIL;
+#endif
+} /* end HIXIstamp() */
+
+/* Adler-32 of 'len' bytes */
+static uint32
+HIXIchecksum(const uint8 *p, size_t len)
+{
+    uint32 a = 1, b = 0;
+
+    while (len > 0) {
+        /* 5552 bytes is as many as can be summed before the sums overflow */
+        size_t n = MIN(len, 5552);
+
+        len -= n;
+        while (n-- > 0) {
+            a += *p++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+} /* end HIXIchecksum() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPis_meta -- whether an element is metadata to keep in the index
+ USAGE
+    intn HIXPis_meta(dd)
+        const dd_t *dd;     IN: DD of the element
+ RETURNS
+    TRUE for the small elements the interfaces read to find their way
+    around a file (Vgroups, vdata headers, small vdatas, descriptions of
+    special elements, ...), FALSE for the rest.  Hcompact also uses this
+    to put the metadata of a file together.
+--------------------------------------------------------------------------*/
+intn
+HIXPis_meta(const dd_t *dd)
+{
+    if (dd->offset == INVALID_OFFSET || dd->length <= 0 || dd->length > HIX_MAX_ELEM)
+        return FALSE;
+
+    /* The descriptions of special elements */
+    if (SPECIALTAG(dd->tag))
+        return TRUE;
+
+    switch (dd->tag) {
+        case DFTAG_VERSION:
+        case DFTAG_FID:
+        case DFTAG_FD:
+        case DFTAG_DIL:
+        case DFTAG_DIA:
+        case DFTAG_NT:
+        case DFTAG_MT:
+        case DFTAG_ID8:
+        case DFTAG_ID:
+        case DFTAG_RIG:
+        case DFTAG_LD:
+        case DFTAG_MD:
+        case DFTAG_SDG:
+        case DFTAG_SDD:
+        case DFTAG_SDL:
+        case DFTAG_SDU:
+        case DFTAG_SDF:
+        case DFTAG_SDM:
+        case DFTAG_SDC:
+        case DFTAG_SDT:
+        case DFTAG_SDLNK:
+        case DFTAG_NDG:
+        case DFTAG_CAL:
+        case DFTAG_FV:
+        case DFTAG_VG:
+        case DFTAG_VH:
+            return TRUE;
+
+        case DFTAG_VS:
+            return dd->length <= HIX_MAX_VS;
+
+        default:
+            return FALSE;
+    }
+} /* end HIXPis_meta() */
+
+/* Sort ranges by offset, for qsort() */
+static int
+HIXIcmp_range(const void *a, const void *b)
+{
+    const hix_range_t *ra = (const hix_range_t *)a;
+    const hix_range_t *rb = (const hix_range_t *)b;
+
+    return (ra->offset > rb->offset) - (ra->offset < rb->offset);
+} /* end HIXIcmp_range() */
+
+/* Find the range of the index holding 'offset', NULL if none */
+static const hix_range_t *
+HIXIfind(const hfile_idx_t *idx, int32 offset)
+{
+    intn lo = 0, hi = idx->nranges;
+
+    /* Find the last range starting at or before 'offset' */
+    while (lo < hi) {
+        intn mid = lo + (hi - lo) / 2;
+
+        if (idx->ranges[mid].offset <= offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == 0)
+        return NULL;
+    if (offset - idx->ranges[lo - 1].offset >= idx->ranges[lo - 1].length)
+        return NULL;
+    return &idx->ranges[lo - 1];
+} /* end HIXIfind() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPset -- turn the metadata index on or off
+ USAGE
+    void HIXPset(enable)
+        intn enable;        IN: whether files opened from now on are indexed
+--------------------------------------------------------------------------*/
+void
+HIXPset(intn enable)
+{
+    index_files = enable ? TRUE : FALSE;
+} /* end HIXPset() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPenabled -- whether files opened now are indexed
+ USAGE
+    intn HIXPenabled()
+ RETURNS
+    TRUE/FALSE
+ DESCRIPTION
+    Returns the setting of HIXPset.  If it was never called, the
+    HDF4_METAINDEX environment variable turns the index on when set to
+    anything other than "0".
+--------------------------------------------------------------------------*/
+intn
+HIXPenabled(void)
+{
+    if (index_files == -1) {
+        const char *env = getenv("HDF4_METAINDEX");
+
+        index_files = (env != NULL && *env != '\0' && strcmp(env, "0") != 0) ? TRUE : FALSE;
+    }
+    return index_files;
+} /* end HIXPenabled() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPload -- load the sidecar of a file being opened
+ USAGE
+    intn HIXPload(file_rec)
+        filerec_t *file_rec;    IN: file record of a file just opened
+ RETURNS
+    SUCCEED if the index of the file was loaded, FAIL otherwise
+ DESCRIPTION
+    Reads the sidecar of the file and checks that it is valid for the
+    file.  If it is, the file record gets the index; otherwise the file
+    record is marked so that HIXPsave writes a new sidecar when the file is
+    closed.  Must be called before the DD list of the file is read, for
+    that to come from the index.  No error is pushed when the sidecar is
+    missing or stale.
+--------------------------------------------------------------------------*/
+intn
+HIXPload(filerec_t *file_rec)
+{
+    hfile_idx_t *idx   = NULL;
+    FILE        *fp    = NULL;
+    char        *name  = NULL;
+    uint8       *block = NULL;
+    hix_stamp_t  stamp, saved;
+    const uint8 *p;
+    long         fsize;
+    int32        nranges, total;
+    uint32       version, checksum;
+    intn         i;
+    intn         ret_value = FAIL;
+
+    file_rec->idx_save = FALSE;
+    if (!HIXPenabled() || (file_rec->access & DFACC_WRITE) || file_rec->driver->map != NULL)
+        return FAIL;
+    file_rec->idx_save = TRUE;
+
+    if (HIXIstamp(file_rec, &stamp) == FAIL)
+        goto done;
+    if ((name = HIXIsidecar(file_rec->path)) == NULL)
+        goto done;
+    if ((fp = fopen(name, "rb")) == NULL)
+        goto done;
+    if (fseek(fp, 0, SEEK_END) != 0 || (fsize = ftell(fp)) < HIX_HDR_SIZE || fsize > INT32_MAX)
+        goto done;
+    if (fseek(fp, 0, SEEK_SET) != 0)
+        goto done;
+
+    if ((idx = (hfile_idx_t *)calloc(1, sizeof(hfile_idx_t))) == NULL)
+        goto done;
+    if ((idx->image = (uint8 *)malloc((size_t)fsize)) == NULL)
+        goto done;
+    if (fread(idx->image, 1, (size_t)fsize, fp) != (size_t)fsize)
+        goto done;
+
+    /* Check the header against the file */
+    p = idx->image;
+    if (memcmp(p, HIX_MAGIC, HIX_MAGIC_LEN) != 0)
+        goto done;
+    p += HIX_MAGIC_LEN;
+    UINT32DECODE(p, version);
+    INT32DECODE(p, saved.size);
+    UINT32DECODE(p, saved.mtime_hi);
+    UINT32DECODE(p, saved.mtime_lo);
+    UINT32DECODE(p, saved.mtime_ns);
+    INT32DECODE(p, nranges);
+    UINT32DECODE(p, checksum);
+    if (version != HIX_VERSION || !HIX_SAME_STAMP(saved, stamp))
+        goto done;
+    if (nranges <= 0 || nranges > (fsize - HIX_HDR_SIZE) / HIX_RANGE_SIZE)
+        goto done;
+    if (checksum != HIXIchecksum(idx->image + HIX_HDR_SIZE, (size_t)(fsize - HIX_HDR_SIZE)))
+        goto done;
+
+    /* Decode the range table, checking that it matches the bytes there are */
+    if ((idx->ranges = (hix_range_t *)malloc((size_t)nranges * sizeof(hix_range_t))) == NULL)
+        goto done;
+    total = HIX_HDR_SIZE + nranges * HIX_RANGE_SIZE;
+    for (i = 0; i < nranges; i++) {
+        hix_range_t *r = &idx->ranges[i];
+
+        INT32DECODE(p, r->offset);
+        INT32DECODE(p, r->length);
+        if (r->offset < 0 || r->length <= 0 || r->length > fsize - total || r->offset > stamp.size - r->length)
+            goto done;
+        if (i > 0 && r->offset < idx->ranges[i - 1].offset + idx->ranges[i - 1].length)
+            goto done;
+        r->data = idx->image + total;
+        total += r->length;
+    }
+    if (total != fsize)
+        goto done;
+    idx->nranges = nranges;
+
+    /* The first DD block of the file must still be the one in the index */
+    {
+        const hix_range_t *first = HIXIfind(idx, MAGICLEN);
+
+        if (first == NULL || first->offset != MAGICLEN)
+            goto done;
+        if ((block = (uint8 *)malloc((size_t)first->length)) == NULL)
+            goto done;
+        if (HP_read(file_rec, block, first->length, MAGICLEN) == FAIL)
+            goto done;
+        if (memcmp(block, first->data, (size_t)first->length) != 0)
+            goto done;
+    }
+
+    file_rec->idx      = idx;
+    file_rec->idx_save = FALSE;
+    ret_value          = SUCCEED;
+
+done:
+    if (ret_value == FAIL && idx != NULL) {
+        free(idx->image);
+        free(idx->ranges);
+        free(idx);
+    }
+    if (fp != NULL)
+        fclose(fp);
+    free(block);
+    free(name);
+    HEclear(); /* a missing or stale sidecar is not an error */
+
+    return ret_value;
+} /* end HIXPload() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPavail -- get the bytes of the file the index holds from an offset
+ USAGE
+    int32 HIXPavail(file_rec, offset, data)
+        filerec_t *file_rec;    IN: file record of the file
+        int32 offset;           IN: offset in the file
+        const uint8 **data;     OUT: the bytes of the file from 'offset'
+ RETURNS
+    The # of bytes of the file from 'offset' on held in the index, which
+    may be 0.
+--------------------------------------------------------------------------*/
+int32
+HIXPavail(filerec_t *file_rec, int32 offset, const uint8 **data)
+{
+    const hix_range_t *r;
+
+    if (file_rec->idx == NULL || (r = HIXIfind(file_rec->idx, offset)) == NULL)
+        return 0;
+    *data = r->data + (offset - r->offset);
+    return r->length - (offset - r->offset);
+} /* end HIXPavail() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPread -- serve a read from the index
+ USAGE
+    intn HIXPread(file_rec, buf, bytes, offset)
+        filerec_t *file_rec;    IN: file record of the file
+        void *buf;              OUT: buffer to read into
+        int32 bytes;            IN: # of bytes to read
+        int32 offset;           IN: offset in the file to read from
+ RETURNS
+    TRUE if the index held all of the bytes and they were copied into
+    'buf', FALSE otherwise
+--------------------------------------------------------------------------*/
+intn
+HIXPread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
+{
+    const uint8 *data;
+
+    if (HIXPavail(file_rec, offset, &data) < bytes)
+        return FALSE;
+    memcpy(buf, data, (size_t)bytes);
+    return TRUE;
+} /* end HIXPread() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPsave -- write the sidecar of a file being closed
+ USAGE
+    intn HIXPsave(file_rec)
+        filerec_t *file_rec;    IN: file record of the file, still open
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    Writes a new sidecar for a file whose index HIXPload could not load,
+    reading the DD blocks and metadata elements from the file with one
+    batch of reads.  Does nothing for other files.
+--------------------------------------------------------------------------*/
+intn
+HIXPsave(filerec_t *file_rec)
+{
+    hix_range_t   *ranges = NULL;
+    hfile_rdreq_t *reqs   = NULL;
+    void         **bufs   = NULL;
+    uint8         *image  = NULL;
+    char          *name = NULL, *tmpname = NULL;
+    FILE          *fp   = NULL;
+    hix_stamp_t    stamp;
+    ddblock_t     *block;
+    uint8         *p;
+    intn           nranges = 0, nalloc = 0, n, i;
+    int32          total = 0;
+    intn           ret_value = FAIL;
+
+    if (!file_rec->idx_save)
+        return SUCCEED;
+    file_rec->idx_save = FALSE;
+
+    if (HIXIstamp(file_rec, &stamp) == FAIL)
+        goto done;
+
+    /* Collect the ranges: the magic number, the DD blocks, then metadata */
+    for (block = file_rec->ddhead; block != NULL; block = block->next)
+        nalloc += 1 + block->ndds;
+    nalloc++;
+    if ((ranges = (hix_range_t *)malloc((size_t)nalloc * sizeof(hix_range_t))) == NULL)
+        goto done;
+    ranges[nranges].offset = 0;
+    ranges[nranges].length = MAGICLEN;
+    nranges++;
+    for (block = file_rec->ddhead; block != NULL; block = block->next) {
+        ranges[nranges].offset = block->myoffset;
+        ranges[nranges].length = NDDS_SZ + OFFSET_SZ + block->ndds * DD_SZ;
+        total += ranges[nranges].length;
+        nranges++;
+    }
+    for (block = file_rec->ddhead; block != NULL && total < HIX_MAX_BYTES; block = block->next)
+        for (i = 0; i < block->ndds && total < HIX_MAX_BYTES; i++) {
+            const dd_t *dd = &block->ddlist[i];
+
+            if (dd->tag != DFTAG_NULL && HIXPis_meta(dd) && dd->offset <= stamp.size - dd->length) {
+                ranges[nranges].offset = dd->offset;
+                ranges[nranges].length = dd->length;
+                total += dd->length;
+                nranges++;
+            }
+        }
+
+    /* Sort them, dropping those which overlap others (only in bad files) */
+    qsort(ranges, (size_t)nranges, sizeof(hix_range_t), HIXIcmp_range);
+    for (i = 1, n = 1; i < nranges; i++)
+        if (ranges[i].offset >= ranges[n - 1].offset + ranges[n - 1].length)
+            ranges[n++] = ranges[i];
+    nranges = n;
+
+    /* Lay out the sidecar, then read the ranges right into it */
+    total = HIX_HDR_SIZE + nranges * HIX_RANGE_SIZE;
+    for (i = 0; i < nranges; i++)
+        total += ranges[i].length;
+    if ((image = (uint8 *)malloc((size_t)total)) == NULL)
+        goto done;
+    if ((reqs = (hfile_rdreq_t *)malloc((size_t)nranges * sizeof(hfile_rdreq_t))) == NULL)
+        goto done;
+    if ((bufs = (void **)malloc((size_t)nranges * sizeof(void *))) == NULL)
+        goto done;
+
+    p = image + HIX_HDR_SIZE;
+    for (i = 0; i < nranges; i++) {
+        INT32ENCODE(p, ranges[i].offset);
+        INT32ENCODE(p, ranges[i].length);
+    }
+    for (i = 0; i < nranges; i++) {
+        bufs[i]        = p;
+        reqs[i].count  = 1;
+        reqs[i].bufs   = &bufs[i];
+        reqs[i].sizes  = &ranges[i].length;
+        reqs[i].offset = ranges[i].offset;
+        p += ranges[i].length;
+    }
+    if (HP_read_batch(file_rec, nranges, reqs) == FAIL)
+        goto done;
+
+    /* Don't save what another process may have changed under us */
+    {
+        hix_stamp_t after;
+
+        if (HIXIstamp(file_rec, &after) == FAIL || !HIX_SAME_STAMP(after, stamp))
+            goto done;
+    }
+
+    p = image;
+    memcpy(p, HIX_MAGIC, HIX_MAGIC_LEN);
+    p += HIX_MAGIC_LEN;
+    UINT32ENCODE(p, (uint32)HIX_VERSION);
+    INT32ENCODE(p, stamp.size);
+    UINT32ENCODE(p, stamp.mtime_hi);
+    UINT32ENCODE(p, stamp.mtime_lo);
+    UINT32ENCODE(p, stamp.mtime_ns);
+    INT32ENCODE(p, (int32)nranges);
+    UINT32ENCODE(p, HIXIchecksum(image + HIX_HDR_SIZE, (size_t)(total - HIX_HDR_SIZE)));
+
+    /* Write it under a temporary name, then move it into place */
+    if ((name = HIXIsidecar(file_rec->path)) == NULL || (tmpname = HFPtmpfile_create(name)) == NULL)
+        goto done;
+    if ((fp = fopen(tmpname, "wb")) == NULL) {
+        remove(tmpname);
+        goto done;
+    }
+    if (fwrite(image, 1, (size_t)total, fp) != (size_t)total) {
+        fclose(fp);
+        remove(tmpname);
+        goto done;
+    }
+    if (fclose(fp) != 0) {
+        remove(tmpname);
+        goto done;
+    }
+    if (HFPtmpfile_commit(tmpname, name) == FAIL)
+        goto done;
+    ret_value = SUCCEED;
+
+done:
+    if (ret_value == FAIL)
+        HEclear(); /* the sidecar is only a cache */
+    free(ranges);
+    free(reqs);
+    free(bufs);
+    free(image);
+    free(name);
+    free(tmpname);
+
+    return ret_value;
+} /* end HIXPsave() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPdrop -- remove the sidecar of a file opened for writing
+ USAGE
+    void HIXPdrop(file_rec)
+        filerec_t *file_rec;    IN: file record of the file
+ DESCRIPTION
+    Removes the sidecar of the file, if there is one, whether or not the
+    index is on: where the stamp only records the modification time to
+    the second, a file rewritten within the second it was indexed could
+    otherwise match a sidecar it no longer agrees with.  A file by that
+    name is only removed if it starts with the header of a sidecar whose
+    range table fits in it.  Errors are ignored.
+--------------------------------------------------------------------------*/
+void
+HIXPdrop(filerec_t *file_rec)
+{
+    uint8        hdr[HIX_HDR_SIZE];
+    const uint8 *p;
+    char        *name;
+    FILE        *fp;
+    long         fsize = 0;
+    size_t       nread = 0;
+    uint32       version;
+    int32        nranges;
+
+    if ((name = HIXIsidecar(file_rec->path)) == NULL)
+        return;
+    if ((fp = fopen(name, "rb")) != NULL) {
+        nread = fread(hdr, 1, sizeof(hdr), fp);
+        if (fseek(fp, 0, SEEK_END) == 0)
+            fsize = ftell(fp);
+        fclose(fp);
+    }
+
+    /* Leave alone whatever else has the name */
+    if (nread == sizeof(hdr) && memcmp(hdr, HIX_MAGIC, HIX_MAGIC_LEN) == 0) {
+        p = hdr + HIX_MAGIC_LEN;
+        UINT32DECODE(p, version);
+        p += 4 * 4; /* size and modification time of the file */
+        INT32DECODE(p, nranges);
+        if (version == HIX_VERSION && nranges > 0 && nranges <= (fsize - HIX_HDR_SIZE) / HIX_RANGE_SIZE)
+            remove(name);
+    }
+    free(name);
+} /* end HIXPdrop() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HIXPfree -- drop the index of a file
+ USAGE
+    void HIXPfree(file_rec)
+        filerec_t *file_rec;    IN: file record of the file
+ DESCRIPTION
+    Frees the index of the file, if it has one, and makes sure no sidecar
+    is written for it.  Called when the file is closed and before it is
+    first written to.
+--------------------------------------------------------------------------*/
+void
+HIXPfree(filerec_t *file_rec)
+{
+    hfile_idx_t *idx = file_rec->idx;
+
+    file_rec->idx_save = FALSE;
+    if (idx == NULL)
+        return;
+    file_rec->idx = NULL;
+    free(idx->image);
+    free(idx->ranges);
+    free(idx);
+} /* end HIXPfree() */
@@ -0,0 +1,359 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+FILE
+    hfilera.c - Readahead of sequentially read files.
+
+REMARKS
+    When a file is read front to back in small pieces (Hread on a large
+    element, SDreaddata walking a dataset in row order, ...), every HP_read
+    waits for the disk before the caller can go on with the data.  This
+    module notices such a pattern in the reads of a file and starts a
+    background thread which reads the data that comes next into a bounded
+    window of memory, so the I/O overlaps with the caller's processing.
+
+DESIGN
+    HP_read hands each read to HRAPread before going to the driver.  A file
+    is considered read sequentially once a run of reads, each starting
+    where the previous one ended, has covered a block of the window; short
+    runs such as reading a DD block don't pay for the thread.  The first
+    time that happens a thread is started for the file, with a descriptor
+    of its own, and the window (the readahead size of the file, see
+    Hreadahead) is split into HRA_NBLOCKS blocks which the thread fills in
+    file order.  Reads are
+    served from the blocks which hold their data, waiting for a block still
+    being read if need be, and whatever part of a read is not in the window
+    is read through the driver as usual.  Blocks behind the last read are
+    queued again for the data after the end of the window, so the window
+    slides along with the reads; a read outside of the window moves it.
+
+    The thread reads the file with a descriptor of its own and so never
+    touches the state of the driver.  This is only safe while nothing
+    writes to the file, so readahead is only done for files opened
+    read-only, and is stopped for good (HRAPstop) by the first write to the
+    file.  Drivers which hold the file in memory (those with a 'map'
+    callback) don't need it and are skipped.
+
+BUGS/LIMITATIONS
+    Readahead needs POSIX threads and pread; without them (or when built
+    with HDF4_ENABLE_READAHEAD/--enable-readahead off) HRAPread never
+    serves anything and files are read as before.
+
+EXPORTED ROUTINES
+    HRAPread    - Serve a read from the window, starting readahead if needed
+    HRAPstop    - Stop the readahead of a file and free its window
+
+LOCAL ROUTINES
+    HRAIstart   - Start the readahead thread of a file
+    HRAIfill    - Queue the blocks of the window which are not needed anymore
+    HRAIworker  - Body of the readahead thread
+*/
+
+#include <errno.h>
+
+#include "hdfi.h"
+#include "hfile.h"
+
+#if defined(H4_HAVE_READAHEAD) && defined(H4_HAVE_PREAD)
+#define HFILE_READAHEAD
+#include <pthread.h>
+#endif
+
+#ifdef HFILE_READAHEAD
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+/* # of blocks the window is split into */
+#define HRA_NBLOCKS 4
+
+/* state of a block of the window */
+#define HRA_FREE    0 /* not in use */
+#define HRA_QUEUED  1 /* waiting for the thread */
+#define HRA_READING 2 /* being read by the thread */
+#define HRA_READY   3 /* holds 'length' bytes of the file at 'offset' */
+#define HRA_FAILED  4 /* the read failed */
+
+/* A block of the window */
+typedef struct {
+    intn   state;  /* HRA_xxx */
+    int32  offset; /* offset in the file of the block */
+    int32  length; /* # of bytes read, only less than the block size at EOF */
+    uint8 *data;   /* the data */
+} hra_block_t;
+
+/* The readahead state of a file */
+struct hfile_ra_t {
+    pthread_t       thread; /* the thread reading ahead */
+    pthread_mutex_t lock;   /* protects everything below */
+    pthread_cond_t  cond;   /* signalled when a block changes state */
+    intn            stop;   /* TRUE when the thread must exit */
+    int             fd;     /* descriptor the thread reads with */
+    int32           bsize;  /* size of a block */
+    int32           start;  /* offset the window was last filled from */
+    int32           next;   /* offset just past the end of the window */
+    int32           eof;    /* size of the file */
+    hra_block_t     blocks[HRA_NBLOCKS];
+};
+
+/* Queue the blocks which are behind 'pos' (or not in use) for the data at
+   the end of the window.  Called with the lock held. */
+static void
+HRAIfill(hfile_ra_t *ra, int32 pos)
+{
+    intn i;
+
+    /* The reads went somewhere else; move the window */
+    if (pos < ra->start || pos > ra->next)
+        ra->next = pos;
+    ra->start = pos;
+
+    for (i = 0; i < HRA_NBLOCKS; i++) {
+        hra_block_t *b = &ra->blocks[i];
+
+        /* The block is being read into, or still ahead of the reads */
+        if (b->state == HRA_READING)
+            continue;
+        if (b->state != HRA_FREE && b->offset + ra->bsize > pos && b->offset < ra->next)
+            continue;
+
+        if (ra->next >= ra->eof)
+            b->state = HRA_FREE;
+        else {
+            b->state  = HRA_QUEUED;
+            b->offset = ra->next;
+            ra->next += ra->bsize;
+        }
+    }
+    pthread_cond_broadcast(&ra->cond);
+} /* end HRAIfill() */
+
+static void *
+HRAIworker(void *arg)
+{
+    hfile_ra_t *ra = (hfile_ra_t *)arg;
+
+    pthread_mutex_lock(&ra->lock);
+    while (!ra->stop) {
+        hra_block_t *b = NULL;
+        int32        done, want;
+        intn         i;
+
+        /* Read the queued block which comes first in the file */
+        for (i = 0; i < HRA_NBLOCKS; i++)
+            if (ra->blocks[i].state == HRA_QUEUED && (b == NULL || ra->blocks[i].offset < b->offset))
+                b = &ra->blocks[i];
+        if (b == NULL) {
+            pthread_cond_wait(&ra->cond, &ra->lock);
+            continue;
+        }
+        b->state = HRA_READING;
+        want     = MIN(ra->bsize, ra->eof - b->offset);
+        pthread_mutex_unlock(&ra->lock);
+
+        for (done = 0; done < want;) {
+            ssize_t n = pread(ra->fd, b->data + done, (size_t)(want - done), (off_t)(b->offset + done));
+
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                break;
+            done += (int32)n;
+        }
+
+        pthread_mutex_lock(&ra->lock);
+        b->length = done;
+        b->state  = done > 0 ? HRA_READY : HRA_FAILED;
+        pthread_cond_broadcast(&ra->cond);
+    }
+    pthread_mutex_unlock(&ra->lock);
+    return NULL;
+} /* end HRAIworker() */
+
+/* Start reading ahead a file, returns NULL if it can't be done */
+static hfile_ra_t *
+HRAIstart(filerec_t *file_rec)
+{
+    hfile_ra_t *ra;
+    off_t       eof;
+    intn        i;
+
+    if ((ra = (hfile_ra_t *)calloc(1, sizeof(hfile_ra_t))) == NULL)
+        return NULL;
+    ra->bsize = MAX(file_rec->ra_size / HRA_NBLOCKS, 1);
+    for (i = 0; i < HRA_NBLOCKS; i++)
+        if ((ra->blocks[i].data = (uint8 *)malloc((size_t)ra->bsize)) == NULL)
+            goto error;
+
+    if ((ra->fd = open(file_rec->path, O_RDONLY | O_BINARY)) < 0)
+        goto error;
+    if ((eof = lseek(ra->fd, 0, SEEK_END)) < 0)
+        goto error_fd;
+    ra->eof = eof > (off_t)INT32_MAX ? INT32_MAX : (int32)eof;
+
+    if (pthread_mutex_init(&ra->lock, NULL) != 0)
+        goto error_fd;
+    if (pthread_cond_init(&ra->cond, NULL) != 0)
+        goto error_lock;
+    if (pthread_create(&ra->thread, NULL, HRAIworker, ra) != 0)
+        goto error_cond;
+    return ra;
+
+error_cond:
+    pthread_cond_destroy(&ra->cond);
+error_lock:
+    pthread_mutex_destroy(&ra->lock);
+error_fd:
+    close(ra->fd);
+error:
+    for (i = 0; i < HRA_NBLOCKS; i++)
+        free(ra->blocks[i].data);
+    free(ra);
+    return NULL;
+} /* end HRAIstart() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HRAPread -- serve a read from the readahead window
+ USAGE
+    int32 HRAPread(file_rec, buf, bytes, offset)
+        filerec_t *file_rec;    IN: file record of the file read
+        void *buf;              OUT: buffer to read into
+        int32 bytes;            IN: # of bytes to read
+        int32 offset;           IN: offset in the file to read from
+ RETURNS
+    The # of bytes at the start of the read which were copied into 'buf'
+    from the window, which may be 0.  The rest must be read through the
+    driver.
+ DESCRIPTION
+    Keeps track of whether the file is read sequentially, and starts or
+    moves the window accordingly.  Never fails: if the readahead can't be
+    done the file is simply read without it.
+--------------------------------------------------------------------------*/
+int32
+HRAPread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
+{
+    hfile_ra_t *ra  = file_rec->ra;
+    uint8      *p   = (uint8 *)buf;
+    int32       pos = offset; /* where the part not served yet starts */
+    intn        seq;          /* TRUE if the read picks up where the last one stopped */
+
+    seq               = (offset == file_rec->ra_next && file_rec->ra_run > 0);
+    file_rec->ra_run  = seq ? file_rec->ra_run + bytes : bytes;
+    file_rec->ra_next = offset + bytes;
+
+    if (ra == NULL) {
+        if (!seq || file_rec->ra_size <= 0 || file_rec->ra_run < file_rec->ra_size / HRA_NBLOCKS ||
+            (file_rec->access & DFACC_WRITE) || file_rec->driver->map != NULL)
+            return 0;
+        if ((ra = HRAIstart(file_rec)) == NULL) {
+            file_rec->ra_size = 0; /* don't try again */
+            return 0;
+        }
+        file_rec->ra = ra;
+    }
+
+    pthread_mutex_lock(&ra->lock);
+
+    /* Copy whatever the window holds from the start of the read */
+    while (pos < offset + bytes) {
+        hra_block_t *b = NULL;
+        int32        n;
+        intn         i;
+
+        for (i = 0; i < HRA_NBLOCKS; i++) {
+            hra_block_t *t = &ra->blocks[i];
+
+            if (t->state != HRA_FREE && t->offset <= pos && pos < t->offset + ra->bsize) {
+                b = t;
+                break;
+            }
+        }
+        if (b == NULL)
+            break;
+        while (b->state == HRA_QUEUED || b->state == HRA_READING)
+            pthread_cond_wait(&ra->cond, &ra->lock);
+        if (b->state != HRA_READY || pos >= b->offset + b->length)
+            break;
+
+        n = MIN(b->offset + b->length - pos, offset + bytes - pos);
+        memcpy(p, b->data + (pos - b->offset), (size_t)n);
+        p += n;
+        pos += n;
+    }
+
+    /* Keep the window ahead of the reads */
+    if (seq)
+        HRAIfill(ra, offset + bytes);
+
+    pthread_mutex_unlock(&ra->lock);
+    return pos - offset;
+} /* end HRAPread() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HRAPstop -- stop the readahead of a file
+ USAGE
+    void HRAPstop(file_rec)
+        filerec_t *file_rec;    IN: file record of the file
+ DESCRIPTION
+    Waits for the thread to finish the block it is reading, if any, and
+    frees the window.  Readahead starts over if the file is read
+    sequentially again (and is still read-only).
+--------------------------------------------------------------------------*/
+void
+HRAPstop(filerec_t *file_rec)
+{
+    hfile_ra_t *ra = file_rec->ra;
+    intn        i;
+
+    file_rec->ra_run = 0;
+    if (ra == NULL)
+        return;
+
+    pthread_mutex_lock(&ra->lock);
+    ra->stop = TRUE;
+    pthread_cond_broadcast(&ra->cond);
+    pthread_mutex_unlock(&ra->lock);
+    pthread_join(ra->thread, NULL);
+
+    pthread_cond_destroy(&ra->cond);
+    pthread_mutex_destroy(&ra->lock);
+    close(ra->fd);
+    for (i = 0; i < HRA_NBLOCKS; i++)
+        free(ra->blocks[i].data);
+    free(ra);
+    file_rec->ra = NULL;
+} /* end HRAPstop() */
+
+#else /* HFILE_READAHEAD */
+
+int32
+HRAPread(filerec_t *file_rec, void *buf, int32 bytes, int32 offset)
+{
+    (void)file_rec;
+    (void)buf;
+    (void)bytes;
+    (void)offset;
+    return 0;
+} /* end HRAPread() */
+
+void
+HRAPstop(filerec_t *file_rec)
+{
+    (void)file_rec;
+} /* end HRAPstop() */
+
+#endif /* HFILE_READAHEAD */
@@ -0,0 +1,546 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+FILE
+    hfilespace.c - Free space management for files opened for writing.
+
+REMARKS
+    Space in a file is handed out by HPgetdiskblock and given back by
+    HPfreediskblock, when an element is deleted or rewritten somewhere else
+    (Hdeldd, HDreuse_tagref, promotion to a special element, ...).  This
+    module keeps track of the space given back, so that it is used again
+    instead of the file growing at the end every time.
+
+DESIGN
+    Nothing about free space is stored in the file: the free blocks are
+    the holes between the magic number, the DD blocks and the data of the
+    DDs, up to the end of the file.  They are found from the DD list the
+    first time a block is needed for a file, so files which are only read,
+    or written without ever asking for space, don't pay for it.
+
+    Free blocks are kept in a tree sorted by offset, where a block given
+    back is merged with the free blocks right before and after it, and in
+    size classes (one per power of two) for allocation.  A request is
+    served from the first block of its own class which is large enough,
+    or else from any block of a larger class, which is always large
+    enough; the rest of the block stays free.
+
+    Data shared by several DDs (see Hdupdd) must only be given back once
+    the last of them goes away.  The pieces of data used by more than one
+    DD are kept in a second tree sorted by offset, each with the # of DDs
+    using it; they are found along with the free blocks and added to by
+    Hdupdd.  A DD being deleted or rewritten is then checked against that
+    tree rather than against the whole DD list.
+
+    The blocks and the trees are allocated from the arena of the file, so
+    they are released along with it when the file is closed.
+
+BUGS/LIMITATIONS
+    Space at the end of the file is not given back to the file system, and
+    blocks smaller than HFS_MIN_BLOCK are not kept.  Once the DDs sharing
+    a piece of data partly overlap, the parts only used by the DDs which
+    went first are not given back.
+
+EXPORTED ROUTINES
+    HFSPalloc   - Get a free block of the file, if there is one
+    HFSPfree    - Give a block of the file back
+    HFSPshare   - Record that one more DD uses the data of a DD
+    HFSPunshare - Drop a DD from the DDs sharing its data
+    HFSPactive  - Whether the free space of a file is being tracked
+    HFSPdestroy - Free the free space information of a file
+
+LOCAL ROUTINES
+    HFSIclass   - Get the size class of a block
+    HFSIlink    - Put a block in the list of its size class
+    HFSIunlink  - Take a block out of the list of its size class
+    HFSIinsert  - Add a free block, merging it with its neighbors
+    HFSIremove  - Drop a free block
+    HFSIshared  - Find the shared piece of data a DD is part of
+    HFSIbuild   - Find the free blocks of a file from its DD list
+*/
+
+#include "hdfi.h"
+#include "hfile.h"
+#include "tbbt.h"
+
+/* # of size classes, one for each power of two a length can have */
+#define HFS_NCLASSES 31
+
+/* Smallest free block kept */
+#define HFS_MIN_BLOCK 16
+
+/* A free block of a file */
+typedef struct hfs_block_t {
+    int32               offset; /* offset of the block, also the key in the tree */
+    int32               length; /* # of bytes in the block */
+    struct hfs_block_t *prev;   /* previous block of the same size class */
+    struct hfs_block_t *next;   /* next block of the same size class */
+} hfs_block_t;
+
+/* A piece of data used by more than one DD */
+typedef struct hfs_shared_t {
+    int32 offset; /* offset of the data, also the key in the tree */
+    int32 length; /* # of bytes used by any of the DDs */
+    intn  ndds;   /* # of DDs using some of it */
+} hfs_shared_t;
+
+struct hfile_space_t {
+    arena_p      arena;                 /* arena of the file, where all this is */
+    TBBT_TREE   *tree;                  /* the free blocks, by offset */
+    hfs_block_t *classes[HFS_NCLASSES]; /* the free blocks, by size class */
+    TBBT_TREE   *shared;                /* the data shared by several DDs, by offset */
+};
+
+/* A piece of a file in use, for HFSIbuild */
+typedef struct hfs_used_t {
+    int32 offset;
+    int32 length;
+    intn  data; /* whether it is the data of a DD */
+} hfs_used_t;
+
+/* Compare the offsets of two blocks, for the tree */
+static intn
+HFSIcompare(void *k1, void *k2, intn cmparg)
+{
+    int32 o1 = *(int32 *)k1, o2 = *(int32 *)k2;
+
+    (void)cmparg;
+    return (o1 < o2) ? -1 : (o1 > o2);
+} /* end HFSIcompare() */
+
+/* Sort the pieces of a file in use by offset, for qsort() */
+static int
+HFSIcmp_used(const void *a, const void *b)
+{
+    const hfs_used_t *ua = (const hfs_used_t *)a;
+    const hfs_used_t *ub = (const hfs_used_t *)b;
+
+    return (ua->offset < ub->offset) ? -1 : (ua->offset > ub->offset);
+} /* end HFSIcmp_used() */
+
+/* Get the size class of a block: the # of the highest bit set in its length */
+static intn
+HFSIclass(int32 length)
+{
+    intn c = 0;
+
+    while (length > 1 && c < HFS_NCLASSES - 1) {
+        length >>= 1;
+        c++;
+    }
+    return c;
+} /* end HFSIclass() */
+
+static void
+HFSIlink(hfile_space_t *space, hfs_block_t *block)
+{
+    intn c = HFSIclass(block->length);
+
+    block->prev = NULL;
+    block->next = space->classes[c];
+    if (block->next != NULL)
+        block->next->prev = block;
+    space->classes[c] = block;
+} /* end HFSIlink() */
+
+static void
+HFSIunlink(hfile_space_t *space, hfs_block_t *block)
+{
+    if (block->prev != NULL)
+        block->prev->next = block->next;
+    else
+        space->classes[HFSIclass(block->length)] = block->next;
+    if (block->next != NULL)
+        block->next->prev = block->prev;
+} /* end HFSIunlink() */
+
+/* Drop a free block, as found in the tree */
+static void
+HFSIremove(hfile_space_t *space, TBBT_NODE *node)
+{
+    hfs_block_t *block = (hfs_block_t *)node->data;
+
+    HFSIunlink(space, block);
+    tbbtrem(&space->tree->root, node, NULL);
+    ARfree(space->arena, block, sizeof(hfs_block_t));
+} /* end HFSIremove() */
+
+/* Add a free block, merging it with the free blocks it touches */
+static intn
+HFSIinsert(hfile_space_t *space, int32 offset, int32 length)
+{
+    hfs_block_t *block, *other;
+    TBBT_NODE   *node;
+    int32        end = offset + length;
+
+    if (tbbtdfind(space->tree, &offset, NULL) != NULL)
+        return FAIL; /* already free */
+    if ((block = (hfs_block_t *)ARalloc(space->arena, sizeof(hfs_block_t))) == NULL)
+        return FAIL;
+
+    /* Merge with the blocks on either side before putting the block in the
+       tree, since the keys of the nodes of the tree must not change.
+       Removing a node from the tree can move the others, so the neighbours
+       are looked up again every time */
+    while ((node = tbbtdless(space->tree, &offset, NULL)) != NULL) {
+        other = (hfs_block_t *)node->data;
+        if (other->offset + other->length < offset)
+            break;
+        offset = other->offset;
+        if (other->offset + other->length > end)
+            end = other->offset + other->length;
+        HFSIremove(space, node);
+    }
+    for (;;) {
+        node = tbbtdless(space->tree, &offset, NULL);
+        if ((node = (node != NULL ? tbbtnext(node) : tbbtfirst(space->tree->root))) == NULL)
+            break;
+        other = (hfs_block_t *)node->data;
+        if (other->offset > end)
+            break;
+        if (other->offset + other->length > end)
+            end = other->offset + other->length;
+        HFSIremove(space, node);
+    }
+
+    block->offset = offset;
+    block->length = end - offset;
+    if (tbbtdins(space->tree, block, &block->offset) == NULL) {
+        ARfree(space->arena, block, sizeof(hfs_block_t));
+        return FAIL;
+    }
+    HFSIlink(space, block);
+    return SUCCEED;
+} /* end HFSIinsert() */
+
+/* Find the shared piece of data which some of [offset, offset+length) is
+   part of, if any.  Every DD is part of at most one of them. */
+static TBBT_NODE *
+HFSIshared(hfile_space_t *space, int32 offset, int32 length)
+{
+    TBBT_NODE    *node;
+    hfs_shared_t *sh;
+    int32         last = offset + length - 1;
+
+    if ((node = tbbtdless(space->shared, &last, NULL)) == NULL)
+        return NULL;
+    sh = (hfs_shared_t *)node->data;
+    return (sh->offset + sh->length > offset) ? node : NULL;
+} /* end HFSIshared() */
+
+/* Record a piece of data used by 'ndds' DDs */
+static intn
+HFSIadd_shared(hfile_space_t *space, int32 offset, int32 length, intn ndds)
+{
+    hfs_shared_t *sh;
+
+    if ((sh = (hfs_shared_t *)ARalloc(space->arena, sizeof(hfs_shared_t))) == NULL)
+        return FAIL;
+    sh->offset = offset;
+    sh->length = length;
+    sh->ndds   = ndds;
+    if (tbbtdins(space->shared, sh, &sh->offset) == NULL) {
+        ARfree(space->arena, sh, sizeof(hfs_shared_t));
+        return FAIL;
+    }
+    return SUCCEED;
+} /* end HFSIadd_shared() */
+
+/* Find the free blocks of a file from the space its DD list uses */
+static intn
+HFSIbuild(filerec_t *file_rec)
+{
+    hfile_space_t *space = NULL;
+    hfs_used_t    *used  = NULL;
+    ddblock_t     *block;
+    intn           nused = 0, i;
+    int32          end;
+    int32          data_off = 0, data_end = 0; /* the data overlapping so far */
+    intn           data_ndds = 0;              /* # of DDs using it */
+    intn           ret_value = SUCCEED;
+
+    if ((space = (hfile_space_t *)ARcalloc(file_rec->arena, sizeof(hfile_space_t))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    space->arena = file_rec->arena;
+    if ((space->tree = tbbtdmake_arena(space->arena, HFSIcompare, sizeof(int32), TBBT_FAST_INT32_COMPARE)) ==
+        NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    if ((space->shared = tbbtdmake_arena(space->arena, HFSIcompare, sizeof(int32), TBBT_FAST_INT32_COMPARE)) ==
+        NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
+    /* The magic number, the DD blocks and the data of the DDs */
+    for (block = file_rec->ddhead; block != NULL; block = block->next)
+        nused += 1 + block->ndds;
+    if ((used = (hfs_used_t *)malloc((size_t)(nused + 1) * sizeof(hfs_used_t))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    nused              = 0;
+    used[nused].offset = 0;
+    used[nused].length = MAGICLEN;
+    used[nused].data   = FALSE;
+    nused++;
+    for (block = file_rec->ddhead; block != NULL; block = block->next) {
+        used[nused].offset = block->myoffset;
+        used[nused].length = NDDS_SZ + OFFSET_SZ + block->ndds * DD_SZ;
+        used[nused].data   = FALSE;
+        nused++;
+        for (i = 0; i < block->ndds; i++) {
+            const dd_t *dd = &block->ddlist[i];
+
+            if (dd->tag != DFTAG_NULL && dd->offset != INVALID_OFFSET && dd->length > 0) {
+                used[nused].offset = dd->offset;
+                used[nused].length = dd->length;
+                used[nused].data   = TRUE;
+                nused++;
+            }
+        }
+    }
+    qsort(used, (size_t)nused, sizeof(hfs_used_t), HFSIcmp_used);
+
+    /* Whatever is between them is free */
+    for (i = 0, end = 0; i < nused; i++) {
+        if (used[i].offset - end >= HFS_MIN_BLOCK && used[i].offset <= file_rec->f_end_off)
+            if (HFSIinsert(space, end, used[i].offset - end) == FAIL)
+                HGOTO_ERROR(DFE_NOSPACE, FAIL);
+        if (used[i].offset + used[i].length > end)
+            end = used[i].offset + used[i].length;
+
+        /* Data overlapping the data before it is shared */
+        if (!used[i].data)
+            continue;
+        if (data_ndds > 0 && used[i].offset < data_end) {
+            data_ndds++;
+            if (used[i].offset + used[i].length > data_end)
+                data_end = used[i].offset + used[i].length;
+            continue;
+        }
+        if (data_ndds > 1 && HFSIadd_shared(space, data_off, data_end - data_off, data_ndds) == FAIL)
+            HGOTO_ERROR(DFE_NOSPACE, FAIL);
+        data_off  = used[i].offset;
+        data_end  = used[i].offset + used[i].length;
+        data_ndds = 1;
+    }
+    if (data_ndds > 1 && HFSIadd_shared(space, data_off, data_end - data_off, data_ndds) == FAIL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    if (file_rec->f_end_off - end >= HFS_MIN_BLOCK)
+        if (HFSIinsert(space, end, file_rec->f_end_off - end) == FAIL)
+            HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
+    file_rec->space = space;
+
+done:
+    if (ret_value == FAIL) { /* Error condition cleanup */
+        if (space != NULL) {
+            file_rec->space = space;
+            HFSPdestroy(file_rec);
+        }
+    } /* end if */
+
+    /* Normal function cleanup */
+    free(used);
+
+    return ret_value;
+} /* end HFSIbuild() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFSPalloc -- get a free block of a file, if there is one
+ USAGE
+    int32 HFSPalloc(file_rec, length)
+        filerec_t *file_rec;    IN: file record of the file
+        int32 length;           IN: # of bytes needed
+ RETURNS
+    The offset of a free block of at least 'length' bytes, now in use, or
+    FAIL if there is none (or the free space can't be tracked).
+ DESCRIPTION
+    Finds the free blocks of the file from its DD list the first time it
+    is called for the file.
+--------------------------------------------------------------------------*/
+int32
+HFSPalloc(filerec_t *file_rec, int32 length)
+{
+    hfile_space_t *space;
+    hfs_block_t   *block = NULL, *b;
+    int32          offset;
+    intn           c;
+
+    if (length <= 0)
+        return FAIL;
+    if (file_rec->space == NULL && HFSIbuild(file_rec) == FAIL) {
+        HEclear();
+        return FAIL;
+    }
+    space = file_rec->space;
+
+    /* First fit in the class of the length, else any larger block */
+    c = HFSIclass(length);
+    for (b = space->classes[c]; b != NULL; b = b->next)
+        if (b->length >= length) {
+            block = b;
+            break;
+        }
+    for (c++; block == NULL && c < HFS_NCLASSES; c++)
+        block = space->classes[c];
+    if (block == NULL)
+        return FAIL;
+
+    /* Take the start of the block, the rest stays free */
+    offset = block->offset;
+    if (block->length - length < HFS_MIN_BLOCK)
+        HFSIremove(space, tbbtdfind(space->tree, &block->offset, NULL));
+    else { /* the key changes, so the block goes back in the tree */
+        HFSIunlink(space, block);
+        tbbtrem(&space->tree->root, tbbtdfind(space->tree, &block->offset, NULL), NULL);
+        block->offset += length;
+        block->length -= length;
+        if (tbbtdins(space->tree, block, &block->offset) != NULL)
+            HFSIlink(space, block);
+        else
+            ARfree(space->arena, block, sizeof(hfs_block_t));
+    }
+    return offset;
+} /* end HFSPalloc() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFSPfree -- give a block of a file back
+ USAGE
+    void HFSPfree(file_rec, offset, length)
+        filerec_t *file_rec;    IN: file record of the file
+        int32 offset;           IN: offset of the block
+        int32 length;           IN: # of bytes in the block
+ DESCRIPTION
+    Makes the block free for HFSPalloc.  Nothing needs to be done until
+    the free space of the file is tracked, as the block is found from the
+    DD list then; the caller must make sure no other DD uses the block
+    (see HFSPunshare).
+--------------------------------------------------------------------------*/
+void
+HFSPfree(filerec_t *file_rec, int32 offset, int32 length)
+{
+    if (file_rec->space == NULL || offset < MAGICLEN || length < HFS_MIN_BLOCK ||
+        offset > file_rec->f_end_off - length)
+        return;
+    HFSIinsert(file_rec->space, offset, length);
+} /* end HFSPfree() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFSPshare -- record that one more DD uses the data of a DD
+ USAGE
+    intn HFSPshare(file_rec, offset, length)
+        filerec_t *file_rec;    IN: file record of the file
+        int32 offset;           IN: offset of the data
+        int32 length;           IN: # of bytes of data
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    Called by Hdupdd for the data the new DD points to.  Nothing needs to
+    be done until the free space of the file is tracked, as shared data is
+    found from the DD list then.
+--------------------------------------------------------------------------*/
+intn
+HFSPshare(filerec_t *file_rec, int32 offset, int32 length)
+{
+    hfile_space_t *space = file_rec->space;
+    TBBT_NODE     *node;
+    hfs_shared_t  *sh;
+
+    if (space == NULL || offset == INVALID_OFFSET || length <= 0)
+        return SUCCEED;
+
+    /* Data of a single DD becomes shared by two of them */
+    if ((node = HFSIshared(space, offset, length)) == NULL)
+        return HFSIadd_shared(space, offset, length, 2);
+
+    /* The key doesn't change, so the piece stays where it is in the tree */
+    sh = (hfs_shared_t *)node->data;
+    sh->ndds++;
+    if (offset + length > sh->offset + sh->length)
+        sh->length = offset + length - sh->offset;
+    return SUCCEED;
+} /* end HFSPshare() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFSPunshare -- drop a DD from the DDs sharing its data
+ USAGE
+    intn HFSPunshare(file_rec, offset, length)
+        filerec_t *file_rec;    IN: file record of the file
+        int32 offset;           IN: offset of the data of the DD
+        int32 length;           IN: # of bytes of data of the DD
+ RETURNS
+    TRUE if another DD still uses some of the data of the DD, which must
+    then not be given back, and FALSE otherwise.
+ DESCRIPTION
+    Called for a DD about to be deleted or rewritten, once the free space
+    of the file is tracked.
+--------------------------------------------------------------------------*/
+intn
+HFSPunshare(filerec_t *file_rec, int32 offset, int32 length)
+{
+    hfile_space_t *space = file_rec->space;
+    TBBT_NODE     *node;
+    hfs_shared_t  *sh;
+
+    if (space == NULL || (node = HFSIshared(space, offset, length)) == NULL)
+        return FALSE;
+
+    /* The last DD left will give the data back when it goes */
+    sh = (hfs_shared_t *)node->data;
+    if (--sh->ndds <= 1) {
+        tbbtrem(&space->shared->root, node, NULL);
+        ARfree(space->arena, sh, sizeof(hfs_shared_t));
+    }
+    return TRUE;
+} /* end HFSPunshare() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFSPactive -- whether the free space of a file is being tracked
+ USAGE
+    intn HFSPactive(file_rec)
+        filerec_t *file_rec;    IN: file record of the file
+ RETURNS
+    TRUE once HFSPalloc has looked for the free blocks of the file, i.e.
+    when blocks given back need to be checked and passed to HFSPfree.
+--------------------------------------------------------------------------*/
+intn
+HFSPactive(filerec_t *file_rec)
+{
+    return file_rec->space != NULL;
+} /* end HFSPactive() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HFSPdestroy -- free the free space information of a file
+ USAGE
+    void HFSPdestroy(file_rec)
+        filerec_t *file_rec;    IN: file record of the file
+--------------------------------------------------------------------------*/
+void
+HFSPdestroy(filerec_t *file_rec)
+{
+    hfile_space_t *space = file_rec->space;
+
+    if (space == NULL)
+        return;
+    file_rec->space = NULL;
+    /* The blocks are left to the arena, without visiting them */
+    if (space->tree != NULL)
+        tbbtdfree(space->tree, NULL, NULL);
+    if (space->shared != NULL)
+        tbbtdfree(space->shared, NULL, NULL);
+    ARfree(space->arena, space, sizeof(hfile_space_t));
+} /* end HFSPdestroy() */
@@ -13,6 +13,7 @@
 
 #include "hdfi.h"
 #include "hkit.h"
+#include "hthread.h"
 
 /*
 LOCAL ROUTINES
@@ -146,14 +147,19 @@ intn
 HDflush(int32 file_id)
 {
     filerec_t *file_rec;
+    intn       ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     file_rec = HAatom_object(file_id);
     if (BADFREC(file_rec))
-        HRETURN_ERROR(DFE_ARGS, FAIL);
+        HGOTO_ERROR(DFE_ARGS, FAIL);
 
-    HI_FLUSH(file_rec->file);
+    file_rec->driver->flush(file_rec);
 
-    return SUCCEED;
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* HDflush */
 
 /* ----------------------------- HDgettagdesc ----------------------------- */
@@ -317,10 +323,17 @@ DESCRIPTION
 const char *
 HDfidtoname(int32 file_id)
 {
-    filerec_t *file_rec;
+    filerec_t  *file_rec;
+    const char *ret_value = NULL;
+
+    H4_API_LOCK;
 
     if ((file_rec = HAatom_object(file_id)) == NULL)
-        HRETURN_ERROR(DFE_ARGS, NULL);
+        HGOTO_ERROR(DFE_ARGS, NULL);
+
+    ret_value = file_rec->path;
 
-    return file_rec->path;
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* HDfidtoname */
@@ -60,6 +60,10 @@ HDFLIBAPI int32 Hopen(const char *path, intn acc_mode, int16 ndds);
 
 HDFLIBAPI intn Hclose(int32 file_id);
 
+HDFLIBAPI int32 Hopen_image(const void *image, int32 size, intn acc_mode, int16 ndds);
+
+HDFLIBAPI intn Hclose_image(int32 file_id, void **image, int32 *size);
+
 HDFLIBAPI int32 Hstartread(int32 file_id, uint16 tag, uint16 ref);
 
 HDFLIBAPI intn Hnextread(int32 access_id, uint16 tag, uint16 ref, intn origin);
@@ -87,6 +91,10 @@ HDFLIBAPI int32 Htell(int32 access_id);
 
 HDFLIBAPI int32 Hread(int32 access_id, int32 length, void *data);
 
+HDFLIBAPI int32 Hreadptr(int32 access_id, int32 length, const void **data);
+
+HDFLIBAPI intn Hreadv(hdf_readreq_t *reqs, intn count);
+
 HDFLIBAPI int32 Hwrite(int32 access_id, int32 length, const void *data);
 
 HDFLIBAPI int32 Htrunc(int32 access_id, int32 trunc_len);
@@ -109,6 +117,26 @@ HDFLIBAPI intn Hsync(int32 file_id);
 
 HDFLIBAPI intn Hcache(int32 file_id, intn cache_on);
 
+HDFLIBAPI intn Hdefersync(int32 file_id, intn defer);
+
+HDFLIBAPI intn Hreadahead(int32 file_id, int32 size);
+
+HDFLIBAPI intn Hsetchunkcache(int32 file_id, int32 size, intn policy);
+
+HDFLIBAPI intn Hgetchunkcache(int32 file_id, int32 *size, intn *policy, int32 *used);
+
+HDFLIBAPI intn Hsetchunkthreads(int32 file_id, intn nthreads);
+
+HDFLIBAPI intn Hgetiostats(int32 file_id, hdf_iostats_t *stats);
+
+HDFLIBAPI intn Hresetiostats(int32 file_id);
+
+HDFLIBAPI intn Hsetmetaindex(intn enable);
+
+HDFLIBAPI intn Hsetdriver(intn driver);
+
+HDFLIBAPI intn Hgetdriver(int32 file_id);
+
 HDFLIBAPI intn Hgetlibversion(uint32 *majorv, uint32 *minorv, uint32 *releasev, char *string);
 
 HDFLIBAPI intn Hgetfileversion(int32 file_id, uint32 *majorv, uint32 *minorv, uint32 *release, char *string);
@@ -317,6 +345,22 @@ HDFLIBAPI intn Hdeldd(int32  file_id, /* IN: File ID the tag/refs are in */
                       uint16 ref      /* IN: Ref of tag/ref to delete */
 );
 
+/******************************************************************************
+ NAME
+     Hcompact - Rewrite a file with its DD list and metadata at the head
+
+ DESCRIPTION
+    Rewrites a file (which must not be open) so that its DDs are in one
+    DD block after the magic number, followed by the metadata elements
+    and then by the rest of the data, so that opening it reads the DD
+    list sequentially from the head of the file.
+
+ RETURNS
+    returns SUCCEED (0) if successful, FAIL (-1) otherwise
+
+*******************************************************************************/
+HDFLIBAPI intn Hcompact(const char *path /* IN: name of the file */);
+
 /*
  ** from hdfalloc.c
  */
@@ -376,6 +420,19 @@ HDFLIBAPI intn HCPgetcomptype(int32 file_id, uint16 data_tag, uint16 data_ref, c
 HDFLIBAPI intn HCPgetdatasize(int32 file_id, uint16 data_tag, uint16 data_ref, int32 *comp_size,
                               int32 *orig_size);
 
+HDFLIBAPI intn HCPgetencoded(int32 file_id, uint16 data_tag, uint16 data_ref, comp_coder_t *coder_type,
+                             int32 *orig_size, uint16 *comp_ref, int32 *comp_size);
+
+HDFLIBAPI int32 HCPdecode_buffer(comp_coder_t coder_type, uint8 *src, int32 src_len, uint8 *dst,
+                                 int32 dst_len);
+
+HDFLIBAPI int32 HCPencode_buffer(comp_coder_t coder_type, comp_info *c_info, uint8 *src, int32 src_len,
+                                 uint8 *dst, int32 dst_len);
+
+HDFLIBAPI intn HCPwrite_encoded(int32 file_id, uint16 tag, uint16 ref, comp_model_t model_type,
+                               model_info *m_info, comp_coder_t coder_type, comp_info *c_info,
+                               int32 orig_len, const uint8 *data, int32 data_len);
+
 HDFPUBLIC intn HCget_config_info(comp_coder_t coder_type, uint32 *compression_config_info);
 
 HDFLIBAPI int32 HCPquery_encode_header(comp_model_t model_type, model_info *m_info, comp_coder_t coder_type,
@@ -1439,6 +1496,8 @@ HDFLIBAPI intn Vdeletetagref(int32 vkey, /* IN: vgroup key */
 
 HDFLIBAPI intn VPshutdown(void);
 
+HDFLIBAPI intn VPbuf_shutdown(void);
+
 /*
  ** from vparse.c
  */
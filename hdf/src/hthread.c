@@ -0,0 +1,347 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+FILE
+    hthread.c - Thread-safety of the library.
+
+REMARKS
+    Most of the library keeps its state in global variables: the atom
+    groups, the open files, the free lists of the trees, the conversion
+    buffers and so on.  A threadsafe build (HDF4_ENABLE_THREADSAFE/
+    --enable-threadsafe) protects them with a library lock, like the
+    threadsafe build of HDF5, but lets calls on different files run at the
+    same time.
+
+DESIGN
+    The library lock is a readers/writer lock.  Every API routine of the
+    H, V/VS, GR, AN and DF* interfaces, and those of the SD interface which
+    open or close files or change the settings of the library, take it
+    for themselves (H4_API_LOCK, see hthread.h): nothing else runs in the
+    library meanwhile.  The SD routines working on an object of an open
+    file take it shared (HTSPlock_shared), then take the lock of that file,
+    a mutex kept in its filerec_t (HTSPlock_file).  Calls on different
+    files then only meet on the few structures they all use:
+      - the atom groups, each of which has its own mutex (atom.c);
+      - the scratch buffers, the free lists and the conversion settings,
+        which are kept per thread (H4_THREAD_LOCAL), and freed when the
+        thread exits through the destructor of a thread-specific key, as
+        the error stack is;
+      - the error stack, which is kept per thread as well (herr.c), so
+        that a thread sees the errors of its own calls.
+    Only the outermost API routine of a thread takes the locks; the nested
+    ones just count levels, so the routines may call each other.  A thread
+    waiting for the lock for itself keeps new shared holders out, so that
+    files still get opened while the other threads are busy reading.
+
+BUGS/LIMITATIONS
+    All the interfaces may be used from several threads at once, but only
+    the SD routines run side by side, and only on different files; the
+    other interfaces are serialized, with each other and with SD.  The
+    worker threads of the library (hwpool.c, hfilera.c) only run the
+    coders and the file drivers, which take no lock.
+    Calls on the same file are serialized.
+    Closing the library only releases the buffers of the calling thread;
+    those of the other threads are released as they exit.  A thread only
+    has its buffers released once it has called an API routine which
+    takes the lock.
+
+EXPORTED ROUTINES
+    HTSPlock        - Take the library lock for this thread alone
+    HTSPlock_shared - Take the library lock along with other threads
+    HTSPlock_file   - Take the lock of a file
+    HTSPunlock      - Release the library lock
+    HTSPregister_thread_func - Register a routine freeing the buffers of a thread
+
+LOCAL ROUTINES
+    HTSIfree_thread - Free the buffers of a thread which is exiting
+    HTSIinit_key    - Create the key whose destructor is HTSIfree_thread
+    HTSIenter       - Make sure the buffers of a thread get freed
+*/
+
+#include "hdfi.h"
+#include "hfile.h"
+#include "hthread.h"
+#include "linklist.h"
+#include "tbbt.h"
+
+#ifdef H4_HAVE_THREADSAFE
+#include <pthread.h>
+
+/* The library lock: a readers/writer lock which lets a waiting writer in
+   before new readers */
+static pthread_mutex_t api_mutex      = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  api_cond       = PTHREAD_COND_INITIALIZER;
+static intn            api_readers    = 0;     /* # of threads holding the lock shared */
+static intn            api_writer     = FALSE; /* whether a thread holds it for itself */
+static intn            api_writers_in = 0;     /* # of threads waiting to hold it for themselves */
+
+/* The lock of the objects which are not in an HDF file */
+static pthread_mutex_t other_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* What the calling thread holds */
+typedef struct {
+    intn             depth;     /* # of nested API routines */
+    intn             exclusive; /* whether the library lock is held for this thread alone */
+    pthread_mutex_t *file_lock; /* lock of the file taken by the outermost routine */
+} lock_state_t;
+
+static H4_THREAD_LOCAL lock_state_t lock_state = {0, FALSE, NULL};
+
+/* Most routines of other libraries (the SD interface) freeing the buffers
+   of a thread */
+#define HTS_MAX_THREAD_FUNCS 8
+
+/* The key whose destructor frees the buffers of an exiting thread, and the
+   routines it calls besides those of this library */
+static pthread_key_t   thread_key;
+static pthread_once_t  thread_key_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t thread_mutex    = PTHREAD_MUTEX_INITIALIZER;
+static hdf_termfunc_t  thread_funcs[HTS_MAX_THREAD_FUNCS];
+static intn            nthread_funcs = 0;
+
+/* Whether the destructor is set for the calling thread */
+static H4_THREAD_LOCAL intn thread_entered = FALSE;
+
+/* Free the buffers and free lists of a thread which is exiting */
+static void
+HTSIfree_thread(void *arg)
+{
+    intn n, i;
+
+    (void)arg;
+    pthread_mutex_lock(&thread_mutex);
+    n = nthread_funcs;
+    pthread_mutex_unlock(&thread_mutex);
+    for (i = 0; i < n; i++)
+        (*thread_funcs[i])();
+
+    VSPshutdown();
+    VPbuf_shutdown();
+    HULshutdown();
+    tbbt_shutdown();
+} /* end HTSIfree_thread() */
+
+/* Create the key freeing the buffers of the threads, through pthread_once() */
+static void
+HTSIinit_key(void)
+{
+    if (pthread_key_create(&thread_key, HTSIfree_thread) != 0) {
+        puts("HTSPlock cannot allocate space.  Unable to continue!!");
+        exit(8);
+    }
+} /* end HTSIinit_key() */
+
+/* Make sure the buffers of the calling thread are freed when it exits.  The
+   value of the key only needs to be non-NULL for the destructor to run. */
+static void
+HTSIenter(void)
+{
+    if (thread_entered)
+        return;
+    pthread_once(&thread_key_once, HTSIinit_key);
+    if (pthread_setspecific(thread_key, &thread_entered) == 0)
+        thread_entered = TRUE;
+} /* end HTSIenter() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTSPregister_thread_func -- register a routine freeing the buffers of a thread
+ USAGE
+    intn HTSPregister_thread_func(func)
+        hdf_termfunc_t func;    IN: routine freeing the buffers of the calling thread
+ RETURNS
+    SUCCEED/FAIL
+ DESCRIPTION
+    Adds a routine to those called when a thread which used the library
+    exits, for the buffers kept per thread outside of this library.  The
+    buffers of this library are freed without being registered.  A routine
+    registered twice is only called once.
+--------------------------------------------------------------------------*/
+intn
+HTSPregister_thread_func(hdf_termfunc_t func)
+{
+    intn i;
+    intn ret_value = SUCCEED;
+
+    pthread_mutex_lock(&thread_mutex);
+    for (i = 0; i < nthread_funcs; i++)
+        if (thread_funcs[i] == func)
+            break;
+    if (i == nthread_funcs) {
+        if (nthread_funcs < HTS_MAX_THREAD_FUNCS)
+            thread_funcs[nthread_funcs++] = func;
+        else
+            ret_value = FAIL;
+    }
+    pthread_mutex_unlock(&thread_mutex);
+
+    if (ret_value == FAIL)
+        HRETURN_ERROR(DFE_TOOMANY, FAIL);
+    return ret_value;
+} /* end HTSPregister_thread_func() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTSPlock -- take the library lock for this thread alone
+ USAGE
+    void HTSPlock()
+ RETURNS
+    No return value
+ DESCRIPTION
+    Waits until no other thread holds the library lock and takes it.  A
+    thread which already holds the lock just counts one more level.
+--------------------------------------------------------------------------*/
+void
+HTSPlock(void)
+{
+    if (lock_state.depth++ > 0)
+        return;
+    HTSIenter();
+
+    pthread_mutex_lock(&api_mutex);
+    api_writers_in++;
+    while (api_writer || api_readers > 0)
+        pthread_cond_wait(&api_cond, &api_mutex);
+    api_writers_in--;
+    api_writer = TRUE;
+    pthread_mutex_unlock(&api_mutex);
+
+    lock_state.exclusive = TRUE;
+    lock_state.file_lock = NULL;
+} /* end HTSPlock() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTSPlock_shared -- take the library lock along with other threads
+ USAGE
+    void HTSPlock_shared()
+ RETURNS
+    No return value
+ DESCRIPTION
+    Waits until no thread holds, or waits for, the library lock for itself
+    and takes it shared.  A thread which already holds the lock just counts
+    one more level.
+--------------------------------------------------------------------------*/
+void
+HTSPlock_shared(void)
+{
+    if (lock_state.depth++ > 0)
+        return;
+    HTSIenter();
+
+    pthread_mutex_lock(&api_mutex);
+    while (api_writer || api_writers_in > 0)
+        pthread_cond_wait(&api_cond, &api_mutex);
+    api_readers++;
+    pthread_mutex_unlock(&api_mutex);
+
+    lock_state.exclusive = FALSE;
+    lock_state.file_lock = NULL;
+} /* end HTSPlock_shared() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTSPlock_file -- take the lock of a file
+ USAGE
+    void HTSPlock_file(file_id)
+        int32 file_id;          IN: the file, or FAIL
+ RETURNS
+    No return value
+ DESCRIPTION
+    Takes the lock of the file, or the lock shared by all the objects which
+    are not in an HDF file, when called by the outermost API routine with
+    the library lock held shared.  Nested routines, and routines holding
+    the library lock for themselves, need no other lock.
+--------------------------------------------------------------------------*/
+void
+HTSPlock_file(int32 file_id)
+{
+    filerec_t       *file_rec = NULL;
+    pthread_mutex_t *lock;
+
+    if (lock_state.depth != 1 || lock_state.exclusive || lock_state.file_lock != NULL)
+        return;
+
+    /* The open files only change under the library lock held alone */
+    if (file_id != FAIL && HAatom_group(file_id) == FIDGROUP)
+        file_rec = HAatom_object(file_id);
+    lock = (file_rec != NULL) ? &file_rec->lock : &other_lock;
+
+    pthread_mutex_lock(lock);
+    lock_state.file_lock = lock;
+} /* end HTSPlock_file() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    HTSPunlock -- release the library lock
+ USAGE
+    void HTSPunlock()
+ RETURNS
+    No return value
+ DESCRIPTION
+    Releases one level of the library lock, and with the last level the
+    lock of the file and the library lock itself.
+--------------------------------------------------------------------------*/
+void
+HTSPunlock(void)
+{
+    if (--lock_state.depth > 0)
+        return;
+
+    if (lock_state.file_lock != NULL) {
+        pthread_mutex_unlock(lock_state.file_lock);
+        lock_state.file_lock = NULL;
+    }
+
+    pthread_mutex_lock(&api_mutex);
+    if (lock_state.exclusive)
+        api_writer = FALSE;
+    else
+        api_readers--;
+    if (!api_writer && api_readers == 0)
+        pthread_cond_broadcast(&api_cond);
+    pthread_mutex_unlock(&api_mutex);
+} /* end HTSPunlock() */
+
+#else /* H4_HAVE_THREADSAFE */
+
+void
+HTSPlock(void)
+{
+} /* end HTSPlock() */
+
+void
+HTSPlock_shared(void)
+{
+} /* end HTSPlock_shared() */
+
+void
+HTSPlock_file(int32 file_id)
+{
+    (void)file_id;
+} /* end HTSPlock_file() */
+
+void
+HTSPunlock(void)
+{
+} /* end HTSPunlock() */
+
+intn
+HTSPregister_thread_func(hdf_termfunc_t func)
+{
+    (void)func;
+    return SUCCEED;
+} /* end HTSPregister_thread_func() */
+
+#endif /* H4_HAVE_THREADSAFE */
@@ -0,0 +1,140 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-----------------------------------------------------------------------------
+ * File:    hthread.h
+ * Purpose: header file for the thread-safety of the library
+ * Dependencies:
+ * Invokes:
+ * Contents:
+ *      H4_API_LOCK     - take the library lock on entry to an API routine
+ *      H4_API_UNLOCK   - release it just before returning
+ *      H4_THREAD_LOCAL - storage class of the variables kept per thread
+ *      HTSPregister_thread_func - register a routine freeing them
+ * Structure definitions:
+ * Constant definitions:
+ *---------------------------------------------------------------------------*/
+
+#ifndef H4_HTHREAD_H
+#define H4_HTHREAD_H
+
+#include "hdfi.h"
+
+/* In a threadsafe build, the API routines which open or close files take
+   the library lock for themselves (H4_API_LOCK); the routines working on
+   an open file share the library lock and take the lock of that file (see
+   HTSPlock_shared and HTSPlock_file).  The locks are only taken by the
+   outermost routine, so the routines may call each other.  Every lock
+   must be matched by an H4_API_UNLOCK on the way out of the routine.
+   Scratch buffers and free lists which the routines working on different
+   files share are H4_THREAD_LOCAL instead, and are freed when a thread
+   exits (see HTSPregister_thread_func). */
+#ifdef H4_HAVE_THREADSAFE
+#define H4_API_LOCK     HTSPlock()
+#define H4_API_UNLOCK   HTSPunlock()
+#define H4_THREAD_LOCAL __thread
+#else
+#define H4_API_LOCK   ((void)0)
+#define H4_API_UNLOCK ((void)0)
+#define H4_THREAD_LOCAL
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ NAME
+     HTSPlock - Take the library lock for this thread alone
+
+ DESCRIPTION
+    Waits until no other thread holds the library lock and takes it.  A
+    thread which already holds the lock just counts one more level.  Does
+    nothing unless the library was built threadsafe.
+
+ RETURNS
+    No return value
+
+*******************************************************************************/
+HDFLIBAPI void HTSPlock(void);
+
+/******************************************************************************
+ NAME
+     HTSPlock_shared - Take the library lock along with other threads
+
+ DESCRIPTION
+    Waits until no thread holds the library lock for itself alone and
+    takes it, shared with the other threads doing the same.  Must be
+    followed by HTSPlock_file.  A thread which already holds the lock just
+    counts one more level.  Does nothing unless the library was built
+    threadsafe.
+
+ RETURNS
+    No return value
+
+*******************************************************************************/
+HDFLIBAPI void HTSPlock_shared(void);
+
+/******************************************************************************
+ NAME
+     HTSPlock_file - Take the lock of a file
+
+ DESCRIPTION
+    Takes the lock of the file, after the library lock has been taken
+    shared by the outermost API routine.  Calls on objects which are not
+    in an HDF file (file_id is FAIL or not a file ID) share one lock.  The
+    lock is released with the library lock.  Does nothing unless the
+    library was built threadsafe.
+
+ RETURNS
+    No return value
+
+*******************************************************************************/
+HDFLIBAPI void HTSPlock_file(int32 file_id);
+
+/******************************************************************************
+ NAME
+     HTSPunlock - Release the library lock
+
+ DESCRIPTION
+    Releases one level of the library lock, as taken by HTSPlock or
+    HTSPlock_shared, and the lock of the file along with the last level.
+
+ RETURNS
+    No return value
+
+*******************************************************************************/
+HDFLIBAPI void HTSPunlock(void);
+
+/******************************************************************************
+ NAME
+     HTSPregister_thread_func - Register a routine freeing the buffers of a thread
+
+ DESCRIPTION
+    Adds a routine, freeing the H4_THREAD_LOCAL buffers and free lists of
+    the calling thread, to those called when a thread which took the
+    library lock exits.  Only needed outside of the HDF library itself,
+    whose buffers are freed without it.  Does nothing unless the library
+    was built threadsafe.
+
+ RETURNS
+    SUCCEED/FAIL
+
+*******************************************************************************/
+HDFLIBAPI intn HTSPregister_thread_func(hdf_termfunc_t func);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H4_HTHREAD_H */
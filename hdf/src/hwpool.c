@@ -0,0 +1,246 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+FILE
+    hwpool.c - Pool of worker threads for CPU-bound work
+
+REMARKS
+    (De)compressing the chunks of a large read or write one after the
+    other keeps a single core busy while the others wait.  This module runs such work,
+    cut into independent tasks, on a pool of worker threads along with the
+    calling thread.
+
+DESIGN
+    A job is an array of tasks and the routine to run on each of them; the
+    caller posts it in the list of jobs, wakes the workers up and takes
+    tasks of its own job too, then waits until the last task is done.  The
+    workers take the next task of the first job in the list which has tasks
+    left and fewer threads on it than it asked for, so several threads
+    of a threadsafe build may each have a job running at the same time.
+    The threads are started the first time a job needs them, up to
+    HWP_MAX_THREADS, and then wait for the next jobs until the library
+    shuts down (HWPshutdown).
+
+    The routine of a job runs outside of the library's locks, so it may
+    only work on the memory of its task (see hwp_func_t); whatever it needs
+    from the file is read beforehand by the caller.
+
+BUGS/LIMITATIONS
+    Needs POSIX threads; without them (or when built with
+    HDF4_ENABLE_WORKER_THREADS/--enable-worker-threads off) the tasks are
+    run one after the other by the caller.
+
+EXPORTED ROUTINES
+    HWPrun      - Run a routine on each of an array of tasks, in parallel
+    HWPshutdown - Stop the worker threads
+
+LOCAL ROUTINES
+    HWPIfind_job - Find a job with tasks to take
+    HWPIrun_task - Run the next task of a job
+    HWPIworker   - Body of the worker threads
+    HWPIstart    - Start worker threads
+*/
+
+#include "hdfi.h"
+#include "hwpool.h"
+
+#ifdef H4_HAVE_WORKER_THREADS
+#include <pthread.h>
+
+/* A job being run */
+typedef struct hwp_job_t {
+    hwp_func_t        func;      /* routine to run on the tasks */
+    uint8            *tasks;     /* the tasks */
+    size_t            task_size; /* size of a task */
+    intn              ntasks;    /* # of tasks */
+    intn              next;      /* next task to take */
+    intn              ndone;     /* # of tasks done */
+    intn              nfailed;   /* # of tasks 'func' failed on */
+    intn              nthreads;  /* most threads to run tasks at once, the caller's included */
+    intn              nbusy;     /* # of threads running a task now */
+    struct hwp_job_t *next_job;  /* next job in the list */
+} hwp_job_t;
+
+static pthread_mutex_t hwp_lock = PTHREAD_MUTEX_INITIALIZER; /* protects everything below */
+static pthread_cond_t  hwp_work = PTHREAD_COND_INITIALIZER;  /* signalled when there are tasks to take */
+static pthread_cond_t  hwp_done = PTHREAD_COND_INITIALIZER;  /* signalled when a job is done */
+static pthread_t       hwp_threads[HWP_MAX_THREADS];         /* the worker threads */
+static intn            hwp_nthreads = 0;                     /* # of worker threads running */
+static intn            hwp_stop     = FALSE;                 /* TRUE when the workers must exit */
+static hwp_job_t      *hwp_jobs     = NULL;                  /* the jobs with tasks left */
+
+/* Finds a job a worker may take a task of.  Called with the lock held. */
+static hwp_job_t *
+HWPIfind_job(void)
+{
+    hwp_job_t *job;
+
+    for (job = hwp_jobs; job != NULL; job = job->next_job)
+        if (job->next < job->ntasks && job->nbusy < job->nthreads)
+            break;
+    return job;
+} /* end HWPIfind_job() */
+
+/* Runs the next task of a job, and counts it done.  Called with the lock
+   held, which is released while the task runs. */
+static void
+HWPIrun_task(hwp_job_t *job)
+{
+    intn  task = job->next++;
+    intn  status;
+    void *arg = job->tasks + (size_t)task * job->task_size;
+
+    job->nbusy++;
+    pthread_mutex_unlock(&hwp_lock);
+    status = (*job->func)(arg);
+    pthread_mutex_lock(&hwp_lock);
+    job->nbusy--;
+
+    if (status == FAIL)
+        job->nfailed++;
+    if (++job->ndone == job->ntasks)
+        pthread_cond_broadcast(&hwp_done);
+} /* end HWPIrun_task() */
+
+/* Body of the worker threads */
+static void *
+HWPIworker(void *arg)
+{
+    hwp_job_t *job;
+
+    (void)arg;
+
+    pthread_mutex_lock(&hwp_lock);
+    while (!hwp_stop) {
+        if ((job = HWPIfind_job()) != NULL)
+            HWPIrun_task(job);
+        else
+            pthread_cond_wait(&hwp_work, &hwp_lock);
+    }
+    pthread_mutex_unlock(&hwp_lock);
+
+    return NULL;
+} /* end HWPIworker() */
+
+/* Starts worker threads until there are 'nthreads' of them, or as many as
+   can be started.  Called with the lock held. */
+static void
+HWPIstart(intn nthreads)
+{
+    if (nthreads > HWP_MAX_THREADS)
+        nthreads = HWP_MAX_THREADS;
+    while (hwp_nthreads < nthreads) {
+        if (pthread_create(&hwp_threads[hwp_nthreads], NULL, HWPIworker, NULL) != 0)
+            break;
+        hwp_nthreads++;
+    }
+} /* end HWPIstart() */
+
+#endif /* H4_HAVE_WORKER_THREADS */
+
+/******************************************************************************
+ NAME
+     HWPrun - Run a routine on each of an array of tasks, in parallel
+
+ DESCRIPTION
+    Runs 'func' on each of the 'ntasks' tasks of 'task_size' bytes in
+    'tasks', on up to 'nthreads' threads at the same time, the calling one
+    included, and waits for all of them to be done.
+
+ RETURNS
+    Returns SUCCEED if 'func' succeeded on all the tasks and FAIL otherwise
+
+*******************************************************************************/
+intn
+HWPrun(intn nthreads, intn ntasks, hwp_func_t func, void *tasks, size_t task_size)
+{
+    intn ret_value = SUCCEED;
+
+#ifdef H4_HAVE_WORKER_THREADS
+    if (nthreads > 1 && ntasks > 1) {
+        hwp_job_t   job;
+        hwp_job_t **pjob;
+
+        job.func      = func;
+        job.tasks     = (uint8 *)tasks;
+        job.task_size = task_size;
+        job.ntasks    = ntasks;
+        job.next      = 0;
+        job.ndone     = 0;
+        job.nfailed   = 0;
+        job.nthreads  = MIN(nthreads, ntasks);
+        job.nbusy     = 0;
+
+        pthread_mutex_lock(&hwp_lock);
+        HWPIstart(job.nthreads - 1);
+        job.next_job = hwp_jobs;
+        hwp_jobs     = &job;
+        pthread_cond_broadcast(&hwp_work);
+
+        /* Take tasks along with the workers, then wait for theirs */
+        while (job.next < job.ntasks)
+            HWPIrun_task(&job);
+        while (job.ndone < job.ntasks)
+            pthread_cond_wait(&hwp_done, &hwp_lock);
+
+        for (pjob = &hwp_jobs; *pjob != &job; pjob = &(*pjob)->next_job)
+            ;
+        *pjob = job.next_job;
+        pthread_mutex_unlock(&hwp_lock);
+
+        return job.nfailed > 0 ? FAIL : SUCCEED;
+    }
+#else
+    (void)nthreads;
+#endif /* H4_HAVE_WORKER_THREADS */
+
+    for (intn i = 0; i < ntasks; i++)
+        if ((*func)((uint8 *)tasks + (size_t)i * task_size) == FAIL)
+            ret_value = FAIL;
+
+    return ret_value;
+} /* end HWPrun() */
+
+/******************************************************************************
+ NAME
+     HWPshutdown - Stop the worker threads
+
+ DESCRIPTION
+    Stops the worker threads of the pool and waits for them to exit.
+
+ RETURNS
+    No return value
+
+*******************************************************************************/
+void
+HWPshutdown(void)
+{
+#ifdef H4_HAVE_WORKER_THREADS
+    intn nthreads;
+
+    pthread_mutex_lock(&hwp_lock);
+    hwp_stop = TRUE;
+    pthread_cond_broadcast(&hwp_work);
+    nthreads = hwp_nthreads;
+    pthread_mutex_unlock(&hwp_lock);
+
+    for (intn i = 0; i < nthreads; i++)
+        pthread_join(hwp_threads[i], NULL);
+
+    pthread_mutex_lock(&hwp_lock);
+    hwp_nthreads = 0;
+    hwp_stop     = FALSE;
+    pthread_mutex_unlock(&hwp_lock);
+#endif /* H4_HAVE_WORKER_THREADS */
+} /* end HWPshutdown() */
@@ -0,0 +1,79 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-----------------------------------------------------------------------------
+ * File:    hwpool.h
+ * Purpose: header file for the pool of worker threads of the library
+ * Dependencies:
+ * Invokes:
+ * Contents:
+ *      hwp_func_t  - the routine run on each task of a job
+ * Structure definitions:
+ * Constant definitions:
+ *      HWP_MAX_THREADS - most worker threads the pool starts
+ *---------------------------------------------------------------------------*/
+
+#ifndef H4_HWPOOL_H
+#define H4_HWPOOL_H
+
+#include "hdfi.h"
+
+/* Most worker threads the pool starts, for all the jobs together */
+#define HWP_MAX_THREADS 64
+
+/* The routine run on each task of a job.  It runs on a worker thread, so
+   it may only work on the memory of its task: no I/O through the library,
+   no atoms, no error stack.  Returns SUCCEED or FAIL. */
+typedef intn (*hwp_func_t)(void *task);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ NAME
+     HWPrun - Run a routine on each of an array of tasks, in parallel
+
+ DESCRIPTION
+    Runs 'func' on each of the 'ntasks' tasks of 'task_size' bytes in
+    'tasks', on up to 'nthreads' threads at the same time, the calling one
+    included, and waits for all of them to be done.  The worker threads are
+    started the first time they are needed, and kept for the next jobs.
+    With fewer than 2 threads, or when the library is built without worker
+    threads, the tasks are run one after the other by the caller.
+
+ RETURNS
+    Returns SUCCEED if 'func' succeeded on all the tasks and FAIL otherwise
+
+*******************************************************************************/
+HDFLIBAPI intn HWPrun(intn nthreads, intn ntasks, hwp_func_t func, void *tasks, size_t task_size);
+
+/******************************************************************************
+ NAME
+     HWPshutdown - Stop the worker threads
+
+ DESCRIPTION
+    Stops the worker threads of the pool and waits for them to exit.  No
+    job may be running.  Called when the library shuts down.
+
+ RETURNS
+    No return value
+
+*******************************************************************************/
+HDFLIBAPI void HWPshutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H4_HWPOOL_H */
@@ -46,9 +46,10 @@ EXPORTED ROUTINES
 
 #include "hdfi.h"
 #include "linklist.h"
+#include "hthread.h"
 
 /* Pointer to the list node free list */
-static node_info_t *node_free_list = NULL;
+static H4_THREAD_LOCAL node_info_t *node_free_list = NULL;
 
 /* Private function prototypes */
 static node_info_t *HULIget_list_node(void);
@@ -53,10 +53,364 @@
 #include "hqueue.h"
 #include "mcache.h"
 
+/* Eviction policy of a pool: where it puts a page brought into the pool
+   (whose element is 'lp'), what it does when a page is used again, which
+   page it gives up to make room for the page of 'lp', and what it does
+   when a page leaves the pool ('evicted' is FALSE when the page goes
+   because its cache is closed) */
+typedef struct mcache_policy_t {
+    void (*insert)(MCACHE_POOL *pool, BKT *bp, L_ELEM *lp);
+    void (*touch)(MCACHE_POOL *pool, BKT *bp);
+    BKT *(*victim)(MCACHE_POOL *pool, const L_ELEM *lp);
+    void (*remove)(MCACHE_POOL *pool, BKT *bp, intn evicted);
+} mcache_policy_t;
+
+/* Size of a page of a pool */
+#define PAGE_BYTES(bp) ((size_t)(bp)->owner->pagesize)
+
 /* Private routines */
-static BKT *mcache_bkt(MCACHE *mp);
-static BKT *mcache_look(MCACHE *mp, int32 pgno);
-static intn mcache_write(MCACHE *mp, BKT *bkt);
+static BKT    *mcache_bkt(MCACHE *mp, const L_ELEM *lp);
+static BKT    *mcache_look(MCACHE *mp, int32 pgno);
+static L_ELEM *mcache_elem(MCACHE *mp, int32 pgno);
+static intn    mcache_write(MCACHE *mp, BKT *bkt);
+static void    mcache_add(MCACHE *mp, BKT *bp, L_ELEM *lp);
+static void    mcache_drop(MCACHE_POOL *pool, BKT *bp, intn evicted);
+static intn    mcache_evict(MCACHE_POOL *pool, BKT *bp);
+static void    mcache_unghost(MCACHE_POOL *pool, L_ELEM *lp);
+
+/* The first page of a queue which is not pinned, NULL if none */
+static BKT *
+mcache_first_unpinned(struct _pqh *head)
+{
+    BKT *bp;
+
+    for (bp = head->cqh_first; bp != (void *)head; bp = bp->pq.cqe_next)
+        if (!(bp->flags & MCACHE_PINNED))
+            return bp;
+    return NULL;
+} /* mcache_first_unpinned */
+
+/*
+ * LRU: the pages are kept on queue 0, least recently used first.
+ */
+static void
+lru_insert(MCACHE_POOL *pool, BKT *bp, L_ELEM *lp)
+{
+    (void)lp;
+    H4_CIRCLEQ_INSERT_TAIL(&pool->pqh[0], bp, pq);
+} /* lru_insert */
+
+static void
+lru_touch(MCACHE_POOL *pool, BKT *bp)
+{
+    H4_CIRCLEQ_REMOVE(&pool->pqh[0], bp, pq);
+    H4_CIRCLEQ_INSERT_TAIL(&pool->pqh[0], bp, pq);
+} /* lru_touch */
+
+static BKT *
+lru_victim(MCACHE_POOL *pool, const L_ELEM *lp)
+{
+    (void)lp;
+    return mcache_first_unpinned(&pool->pqh[0]);
+} /* lru_victim */
+
+static void
+lru_remove(MCACHE_POOL *pool, BKT *bp, intn evicted)
+{
+    (void)evicted;
+    H4_CIRCLEQ_REMOVE(&pool->pqh[0], bp, pq);
+} /* lru_remove */
+
+/*
+ * CLOCK: the pages are kept on queue 0 as a ring, which the hand goes
+ * round clearing the reference bits of the pages, and taking the first
+ * page it finds whose bit is clear.  Using a page only sets its bit, so
+ * no queue is touched when a page is found in the pool.
+ */
+static BKT *
+clock_next(MCACHE_POOL *pool, BKT *bp)
+{
+    bp = bp->pq.cqe_next;
+    if (bp == (void *)&pool->pqh[0])
+        bp = pool->pqh[0].cqh_first;
+    return bp;
+} /* clock_next */
+
+static void
+clock_insert(MCACHE_POOL *pool, BKT *bp, L_ELEM *lp)
+{
+    (void)lp;
+    /* Just behind the hand, which gets to the new page last */
+    if (pool->hand == NULL) {
+        H4_CIRCLEQ_INSERT_TAIL(&pool->pqh[0], bp, pq);
+    }
+    else {
+        H4_CIRCLEQ_INSERT_BEFORE(&pool->pqh[0], pool->hand, bp, pq);
+    }
+} /* clock_insert */
+
+static void
+clock_touch(MCACHE_POOL *pool, BKT *bp)
+{
+    (void)pool;
+    bp->flags |= MCACHE_REF;
+} /* clock_touch */
+
+static BKT *
+clock_victim(MCACHE_POOL *pool, const L_ELEM *lp)
+{
+    BKT  *bp;
+    int32 n;
+
+    (void)lp;
+    if (pool->npages == 0)
+        return NULL;
+
+    /* Two turns of the hand find a page, unless all of them are pinned */
+    bp = (pool->hand != NULL) ? pool->hand : pool->pqh[0].cqh_first;
+    for (n = 2 * pool->npages; n > 0; n--, bp = clock_next(pool, bp)) {
+        if (bp->flags & MCACHE_PINNED)
+            continue;
+        if (!(bp->flags & MCACHE_REF)) {
+            pool->hand = clock_next(pool, bp);
+            return bp;
+        }
+        bp->flags &= (uint8)~MCACHE_REF;
+    }
+    pool->hand = bp;
+    return NULL;
+} /* clock_victim */
+
+static void
+clock_remove(MCACHE_POOL *pool, BKT *bp, intn evicted)
+{
+    (void)evicted;
+    if (pool->hand == bp) {
+        pool->hand = clock_next(pool, bp);
+        if (pool->hand == bp)
+            pool->hand = NULL;
+    }
+    H4_CIRCLEQ_REMOVE(&pool->pqh[0], bp, pq);
+} /* clock_remove */
+
+/*
+ * ARC: the pages used once lately are kept on queue 0 and the pages used
+ * more than once on queue 1, both least recently used first.  The pages
+ * evicted from each queue are remembered as ghosts for a while; when a
+ * ghost page is wanted again, the target size of queue 0 is moved towards
+ * the queue which would have kept it, and the page goes on queue 1.  A
+ * page is taken from queue 0 while it is above its target, and from
+ * queue 1 otherwise.
+ */
+static void
+arc_insert(MCACHE_POOL *pool, BKT *bp, L_ELEM *lp)
+{
+    GHOST *gp   = (lp != NULL) ? lp->ghost : NULL;
+    size_t size = PAGE_BYTES(bp);
+    size_t delta;
+
+    if (gp == NULL) { /* not seen lately */
+        H4_CIRCLEQ_INSERT_TAIL(&pool->pqh[0], bp, pq);
+        pool->qbytes[0] += size;
+        return;
+    }
+
+    /* The fewer ghosts on the queue of this one, the larger the step */
+    if (gp->list == 0) {
+        delta        = size * MAX(pool->gbytes[1] / pool->gbytes[0], 1);
+        pool->target = MIN(pool->target + delta, pool->maxbytes);
+    }
+    else {
+        delta        = size * MAX(pool->gbytes[0] / pool->gbytes[1], 1);
+        pool->target = (pool->target > delta) ? pool->target - delta : 0;
+    }
+    mcache_unghost(pool, lp);
+
+    bp->flags |= MCACHE_FREQ;
+    H4_CIRCLEQ_INSERT_TAIL(&pool->pqh[1], bp, pq);
+    pool->qbytes[1] += size;
+} /* arc_insert */
+
+static void
+arc_touch(MCACHE_POOL *pool, BKT *bp)
+{
+    if (bp->flags & MCACHE_FREQ) {
+        H4_CIRCLEQ_REMOVE(&pool->pqh[1], bp, pq);
+    }
+    else {
+        H4_CIRCLEQ_REMOVE(&pool->pqh[0], bp, pq);
+        pool->qbytes[0] -= PAGE_BYTES(bp);
+        pool->qbytes[1] += PAGE_BYTES(bp);
+        bp->flags |= MCACHE_FREQ;
+    }
+    H4_CIRCLEQ_INSERT_TAIL(&pool->pqh[1], bp, pq);
+} /* arc_touch */
+
+static BKT *
+arc_victim(MCACHE_POOL *pool, const L_ELEM *lp)
+{
+    BKT *bp;
+    intn list = 1;
+
+    if (pool->qbytes[0] > 0 &&
+        (pool->qbytes[0] > pool->target ||
+         (pool->qbytes[0] == pool->target && lp != NULL && lp->ghost != NULL && lp->ghost->list == 1)))
+        list = 0;
+
+    if ((bp = mcache_first_unpinned(&pool->pqh[list])) == NULL)
+        bp = mcache_first_unpinned(&pool->pqh[1 - list]);
+    return bp;
+} /* arc_victim */
+
+static void
+arc_remove(MCACHE_POOL *pool, BKT *bp, intn evicted)
+{
+    L_ELEM *lp;
+    GHOST  *gp;
+    intn    list = (bp->flags & MCACHE_FREQ) ? 1 : 0;
+
+    H4_CIRCLEQ_REMOVE(&pool->pqh[list], bp, pq);
+    pool->qbytes[list] -= PAGE_BYTES(bp);
+    bp->flags &= (uint8)~MCACHE_FREQ;
+
+    /* Remember an evicted page; a ghost is only a hint, so none is kept
+       if there is no memory for it */
+    if (!evicted || pool->maxbytes == 0 || (lp = mcache_elem(bp->owner, bp->pgno)) == NULL ||
+        lp->ghost != NULL || (gp = (GHOST *)malloc(sizeof(GHOST))) == NULL)
+        return;
+    gp->elem  = lp;
+    gp->size  = bp->owner->pagesize;
+    gp->list  = list;
+    lp->ghost = gp;
+    H4_CIRCLEQ_INSERT_TAIL(&pool->gqh[list], gp, gq);
+    pool->gbytes[list] += PAGE_BYTES(bp);
+
+    /* Keep no more than the budget in queue 0 and its ghosts, and no
+       more than twice the budget in all */
+    while (pool->qbytes[0] + pool->gbytes[0] > pool->maxbytes && pool->gbytes[0] > 0)
+        mcache_unghost(pool, pool->gqh[0].cqh_first->elem);
+    while (pool->qbytes[0] + pool->qbytes[1] + pool->gbytes[0] + pool->gbytes[1] > 2 * pool->maxbytes &&
+           pool->gbytes[1] > 0)
+        mcache_unghost(pool, pool->gqh[1].cqh_first->elem);
+} /* arc_remove */
+
+/* The policies, by HDF_CHUNK_CACHE_xxx value */
+static const mcache_policy_t mcache_policies[] = {
+    {lru_insert, lru_touch, lru_victim, lru_remove},         /* HDF_CHUNK_CACHE_LRU */
+    {clock_insert, clock_touch, clock_victim, clock_remove}, /* HDF_CHUNK_CACHE_CLOCK */
+    {arc_insert, arc_touch, arc_victim, arc_remove}          /* HDF_CHUNK_CACHE_ARC */
+};
+
+#define NPOLICIES ((intn)(sizeof(mcache_policies) / sizeof(mcache_policies[0])))
+
+/******************************************************************************
+NAME
+   mcache_pool_create -- Create a pool of pages shared by caches
+
+DESCRIPTION
+   Create a pool the pages of several caches can be kept in, all together
+   held to 'maxbytes' bytes, and evicted by the policy 'policy'
+   (HDF_CHUNK_CACHE_LRU, HDF_CHUNK_CACHE_CLOCK or HDF_CHUNK_CACHE_ARC).
+   A 'maxbytes' of 0 holds each cache to its own 'maxcache' pages instead.
+   The pool holds one reference for the caller, see mcache_pool_release().
+
+RETURNS
+   The pool if successful and NULL otherwise
+******************************************************************************/
+MCACHE_POOL *
+mcache_pool_create(size_t maxbytes, /* IN: budget of bytes for the pages */
+                   intn   policy /* IN: eviction policy, HDF_CHUNK_CACHE_xxx */)
+{
+    MCACHE_POOL *pool      = NULL;
+    MCACHE_POOL *ret_value = NULL;
+    intn         i;
+
+    if (policy < 0 || policy >= NPOLICIES)
+        HGOTO_ERROR(DFE_ARGS, NULL);
+
+    if ((pool = (MCACHE_POOL *)calloc(1, sizeof(MCACHE_POOL))) == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, NULL);
+    for (i = 0; i < 2; i++) {
+        H4_CIRCLEQ_INIT(&pool->pqh[i]);
+        H4_CIRCLEQ_INIT(&pool->gqh[i]);
+    }
+    pool->policy   = &mcache_policies[policy];
+    pool->maxbytes = maxbytes;
+    pool->nrefs    = 1;
+
+    ret_value = pool;
+
+done:
+    return ret_value;
+} /* mcache_pool_create */
+
+/******************************************************************************
+NAME
+   mcache_pool_set_size -- Change the budget of a pool
+
+DESCRIPTION
+   Sets the budget of bytes of a pool to 'maxbytes', evicting pages (and
+   writing the dirty ones out) until the pool fits in it, or only pinned
+   pages are left.
+
+RETURNS
+   RET_SUCCESS if successful and RET_ERROR otherwise
+******************************************************************************/
+intn
+mcache_pool_set_size(MCACHE_POOL *pool, /* IN: pool */
+                     size_t       maxbytes /* IN: new budget of bytes */)
+{
+    BKT *bp        = NULL;
+    intn ret_value = RET_SUCCESS;
+
+    if (pool == NULL || maxbytes == 0 || pool->maxbytes == 0)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    pool->maxbytes = maxbytes;
+    pool->target   = MIN(pool->target, maxbytes);
+    while (pool->curbytes > pool->maxbytes && (bp = pool->policy->victim(pool, NULL)) != NULL) {
+        if (mcache_evict(pool, bp) == RET_ERROR)
+            HE_REPORT_GOTO("unable to flush a dirty page", FAIL);
+        free(bp);
+    }
+
+done:
+    return ret_value;
+} /* mcache_pool_set_size */
+
+/******************************************************************************
+NAME
+   mcache_pool_get_used -- Bytes of the pages in a pool
+
+RETURNS
+   The number of bytes of the pages currently in the pool
+******************************************************************************/
+size_t
+mcache_pool_get_used(MCACHE_POOL *pool /* IN: pool */)
+{
+    if (pool != NULL)
+        return pool->curbytes;
+    else
+        return 0;
+} /* mcache_pool_get_used */
+
+/******************************************************************************
+NAME
+   mcache_pool_release -- Give up a reference to a pool
+
+DESCRIPTION
+   Gives up the reference of the caller to a pool, which is freed when the
+   last of the caches kept in it is closed as well.
+
+RETURNS
+   Nothing
+******************************************************************************/
+void
+mcache_pool_release(MCACHE_POOL *pool /* IN: pool */)
+{
+    if (pool != NULL && --pool->nrefs == 0)
+        free(pool);
+} /* mcache_pool_release */
 
 /******************************************************************************
 NAME
@@ -146,39 +500,66 @@ mcache_get_pagesize(MCACHE *mp /* IN: MCACHE cookie */)
         return 0;
 } /* mcache_get_pagesize */
 
+/******************************************************************************
+NAME
+    mcache_incore - is a page in the cache?
+
+DESCRIPTION
+    Checks whether a page is in the cache, i.e. whether getting it
+    will not need reading it in.  Does not count as a reference to
+    the page.
+
+RETURNS
+    Returns TRUE if the page is in the cache and FALSE otherwise.
+******************************************************************************/
+intn
+mcache_incore(MCACHE *mp, /* IN: MCACHE cookie */
+              int32   pgno /* IN: page number */)
+{
+    struct _hqh *head = NULL; /* head of hash chain */
+    BKT         *bp   = NULL; /* bucket element */
+
+    if (mp == NULL || pgno < 1 || pgno > mp->npages)
+        return FALSE;
+
+    head = &mp->hqh[HASHKEY(mp, pgno)];
+    for (bp = head->cqh_first; bp != (void *)head; bp = bp->hq.cqe_next)
+        if (bp->pgno == pgno)
+            return TRUE;
+    return FALSE;
+} /* mcache_incore */
+
 /******************************************************************************
 NAME
    mcache_open -- Open a memory pool on the given object
 
 DESCRIPTION
    Initialize a memory pool for object using the given pagesize
-   and size of object.
+   and size of object.  The pages are kept in 'pool', shared with
+   the other caches opened on it, or in a pool of the cache's own,
+   holding it to 'maxcache' pages, if 'pool' is NULL.
 
    Note for 'flags' input only '0' should be used for now.
 
 RETURNS
    A memory pool cookie if successful else NULL
-
-NOTE:
-      The key string byte for sharing buffers is not implemented.
 ******************************************************************************/
 MCACHE *
-mcache_open(void *key,       /* IN: byte string used as handle to share buffers */
-            int32 object_id, /* IN: object handle */
-            int32 pagesize,  /* IN: chunk size in bytes  */
-            int32 maxcache,  /* IN: maximum number of pages to cache at any time */
-            int32 npages,    /* IN: number of chunks currently in object */
-            int32 flags /* IN: 0= object exists, 1= does not exist  */)
+mcache_open(MCACHE_POOL *pool,      /* IN: pool to share pages in, NULL for none */
+            int32        object_id, /* IN: object handle */
+            int32        pagesize,  /* IN: chunk size in bytes  */
+            int32        maxcache,  /* IN: maximum number of pages to cache at any time */
+            int32        npages,    /* IN: number of chunks currently in object */
+            int32        flags /* IN: 0= object exists, 1= does not exist  */)
 {
     struct _lhqh *lhead     = NULL; /* head of an entry in list hash chain */
     MCACHE       *mp        = NULL; /* MCACHE cookie */
     L_ELEM       *lp        = NULL;
     intn          ret_value = RET_SUCCESS;
-    intn          entry; /* index into hash table */
+    uint32        nhash;
+    uint32        entry; /* index into hash table */
     int32         pageno;
 
-    (void)key;
-
     /* Set the pagesize and max # of pages to cache */
     if (pagesize == 0)
         pagesize = (int32)DEF_PAGESIZE;
@@ -189,12 +570,30 @@ mcache_open(void *key,       /* IN: byte string used as handle to share buffers
     if ((mp = (MCACHE *)calloc(1, sizeof(MCACHE))) == NULL)
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
+    /* The hash tables have a bucket for every other page of the object */
+    for (nhash = HASHSIZE; nhash < (uint32)npages / 2; nhash <<= 1)
+        ;
+    mp->hashmask = nhash - 1;
+    mp->hqh      = (struct _hqh *)malloc(nhash * sizeof(struct _hqh));
+    mp->lhqh     = (struct _lhqh *)malloc(nhash * sizeof(struct _lhqh));
+    if (mp->hqh == NULL || mp->lhqh == NULL)
+        HGOTO_ERROR(DFE_NOSPACE, FAIL);
+
     H4_CIRCLEQ_INIT(&mp->lqh);
-    for (entry = 0; entry < HASHSIZE; ++entry) {
+    for (entry = 0; entry < nhash; ++entry) {
         H4_CIRCLEQ_INIT(&mp->hqh[entry]);
         H4_CIRCLEQ_INIT(&mp->lhqh[entry]);
     }
 
+    /* Keep the pages in the pool given, or in one of our own */
+    if (pool == NULL) {
+        if ((pool = mcache_pool_create(0, HDF_CHUNK_CACHE_LRU)) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    }
+    else
+        pool->nrefs++;
+    mp->pool = pool;
+
     /* Initialize max # of pages to cache and number of pages in object */
     mp->maxcache = (int32)maxcache;
     mp->npages   = npages;
@@ -206,10 +605,11 @@ mcache_open(void *key,       /* IN: byte string used as handle to share buffers
 
     /* Initialize list hash chain */
     for (pageno = 1; pageno <= mp->npages; ++pageno) {
-        lhead = &mp->lhqh[HASHKEY(pageno)];
+        lhead = &mp->lhqh[HASHKEY(mp, pageno)];
         if ((lp = (L_ELEM *)malloc(sizeof(L_ELEM))) == NULL)
             HGOTO_ERROR(DFE_NOSPACE, FAIL);
-        lp->pgno = (int32)pageno; /* set page number */
+        lp->pgno  = (int32)pageno; /* set page number */
+        lp->ghost = NULL;
 
         /* check if object exists already
            The usefulness of this flag is yet to be
@@ -244,14 +644,20 @@ mcache_open(void *key,       /* IN: byte string used as handle to share buffers
 
 done:
     if (ret_value == RET_ERROR) { /* error cleanup */
-        free(mp);
-        /* free up list elements */
-        for (entry = 0; entry < HASHSIZE; ++entry) {
-            while ((lp = mp->lhqh[entry].cqh_first) != (void *)&mp->lhqh[entry]) {
-                H4_CIRCLEQ_REMOVE(&mp->lhqh[entry], mp->lhqh[entry].cqh_first, hl);
-                free(lp);
-            }
-        } /* end for entry */
+        if (mp != NULL) {
+            /* free up list elements */
+            if (mp->hqh != NULL && mp->lhqh != NULL)
+                for (entry = 0; entry <= mp->hashmask; ++entry) {
+                    while ((lp = mp->lhqh[entry].cqh_first) != (void *)&mp->lhqh[entry]) {
+                        H4_CIRCLEQ_REMOVE(&mp->lhqh[entry], mp->lhqh[entry].cqh_first, hl);
+                        free(lp);
+                    }
+                } /* end for entry */
+            mcache_pool_release(mp->pool);
+            free(mp->hqh);
+            free(mp->lhqh);
+            free(mp);
+        }
 
         mp = NULL; /* return value */
     }
@@ -303,12 +709,12 @@ mcache_get(MCACHE *mp,   /* IN: MCACHE cookie */
            int32   pgno, /* IN: page number */
            int32   flags /* IN: XXX not used? */)
 {
-    struct _hqh  *head      = NULL; /* head of lru queue */
+    struct _hqh  *head      = NULL; /* head of hash chain */
     struct _lhqh *lhead     = NULL; /* head of an entry in list hash chain */
     BKT          *bp        = NULL; /* bucket element */
     L_ELEM       *lp        = NULL;
+    intn          new_elem  = FALSE; /* whether lp was allocated here */
     intn          ret_value = RET_SUCCESS;
-    intn          list_hit; /* hit flag */
 
     (void)flags;
 
@@ -329,67 +735,61 @@ mcache_get(MCACHE *mp,   /* IN: MCACHE cookie */
     if ((bp = mcache_look(mp, pgno)) != NULL) {
         /*
          * Move the page to the head of the hash chain and the tail
-         * of the lru chain.
+         * of the queue of the cache, and let the pool know it was used.
          */
-        head = &mp->hqh[HASHKEY(bp->pgno)];
+        head = &mp->hqh[HASHKEY(mp, bp->pgno)];
         H4_CIRCLEQ_REMOVE(head, bp, hq);
         H4_CIRCLEQ_INSERT_HEAD(head, bp, hq);
         H4_CIRCLEQ_REMOVE(&mp->lqh, bp, q);
         H4_CIRCLEQ_INSERT_TAIL(&mp->lqh, bp, q);
+        mp->pool->policy->touch(mp->pool, bp);
         /* Return a pinned page. */
         bp->flags |= MCACHE_PINNED;
 
-        /* update this page reference */
-        lhead = &mp->lhqh[HASHKEY(bp->pgno)];
-        for (lp = lhead->cqh_first; lp != (void *)lhead; lp = lp->hl.cqe_next)
-            if (lp->pgno == bp->pgno) { /* hit */
 #ifdef STATISTICS
-                ++mp->listhit;
-                ++lp->elemhit;
+        /* update this page reference */
+        if ((lp = mcache_elem(mp, bp->pgno)) != NULL) {
+            ++mp->listhit;
+            ++lp->elemhit;
+        }
 #endif
-                break;
-            } /* end if lp->pgno */
 
         /* we are done */
         ret_value = RET_SUCCESS;
         goto done;
     } /* end if bp */
 
-    /* Page not cached so
-     * Get a page from the cache to use or create one. */
-    if ((bp = mcache_bkt(mp)) == NULL)
-        HE_REPORT_GOTO("unable to get a new page from bucket", FAIL);
-
-    /* Check to see if this page has ever been referenced */
-    list_hit = 0;
-    lhead    = &mp->lhqh[HASHKEY(pgno)];
-    for (lp = lhead->cqh_first; lp != (void *)lhead; lp = lp->hl.cqe_next)
-        if (lp->pgno == pgno && lp->eflags != 0) { /* hit */
-#ifdef STATISTICS
-            ++mp->listhit;
-            ++lp->elemhit;
-#endif
-            list_hit = 1;
-            break;
-        } /* end if lp->pgno */
-
-    /* If there is no hit then we allocate a new element
-     *  and insert into hash table */
-    if (!list_hit) { /* NO hit, new list element
-                      * no need to read this page from disk */
+    /* Check to see if this page has ever been referenced.
+     * If not we allocate a new element and insert it into the hash table */
+    if ((lp = mcache_elem(mp, pgno)) == NULL) {
         if ((lp = (L_ELEM *)malloc(sizeof(L_ELEM))) == NULL)
             HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
         lp->pgno   = pgno;
+        lp->ghost  = NULL;
         lp->eflags = 0;
 #ifdef STATISTICS
         ++mp->listalloc;
         lp->elemhit = 1;
 #endif
+        lhead = &mp->lhqh[HASHKEY(mp, pgno)];
         H4_CIRCLEQ_INSERT_HEAD(lhead, lp, hl); /* add to list */
-    }                                          /*end if !list_hit */
-    else {                                     /* list hit, need to read page */
-        lp->eflags = ELEM_READ;                /* Indicate we are reading this page */
+        new_elem = TRUE;
+    } /* end if lp */
+#ifdef STATISTICS
+    else {
+        ++mp->listhit;
+        ++lp->elemhit;
+    }
+#endif
+
+    /* Page not cached so
+     * Get a page from the cache to use or create one. */
+    if ((bp = mcache_bkt(mp, lp)) == NULL)
+        HE_REPORT_GOTO("unable to get a new page from bucket", FAIL);
+
+    if (lp->eflags != 0) {      /* page exists, need to read it */
+        lp->eflags = ELEM_READ; /* Indicate we are reading this page */
 
 #ifdef STATISTICS
         ++mp->pageread;
@@ -401,34 +801,31 @@ mcache_get(MCACHE *mp,   /* IN: MCACHE cookie */
         if (mp->pgin != NULL) { /* Note page numbers in HMCPxxx are 0 based not 1 based */
             if (((mp->pgin)(mp->pgcookie, pgno - 1, bp->page)) == FAIL) {
                 HEreport("mcache_get: error reading chunk=%d\n", (intn)pgno - 1);
-                lp        = NULL; /* don't clobber the cache! */
                 ret_value = RET_ERROR;
                 goto done;
             }
         }
         else {
             HEreport("mcache_get: reading fcn not set,chunk=%d\n", (intn)pgno - 1);
-            lp        = NULL;
             ret_value = RET_ERROR;
             goto done;
         }
-    } /* end else list hit */
+    } /* end if lp->eflags */
 
-    /* Set the page number, pin the page. */
+    /* Set the page number, pin the page, and put it in the cache
+     * and its pool. */
     bp->pgno  = pgno;
     bp->flags = MCACHE_PINNED;
-
-    /*
-     * Add the page to the head of the hash chain and the tail
-     * of the lru chain.
-     */
-    head = &mp->hqh[HASHKEY(bp->pgno)];
-    H4_CIRCLEQ_INSERT_HEAD(head, bp, hq);
-    H4_CIRCLEQ_INSERT_TAIL(&mp->lqh, bp, q);
+    mcache_add(mp, bp, lp);
 
 done:
     if (ret_value == RET_ERROR) { /* error cleanup */
-        free(lp);
+        /* the page did not make it into the cache */
+        free(bp);
+        if (new_elem) {
+            H4_CIRCLEQ_REMOVE(&mp->lhqh[HASHKEY(mp, pgno)], lp, hl);
+            free(lp);
+        }
         return NULL;
     }
     return bp->page;
@@ -450,10 +847,9 @@ mcache_put(MCACHE *mp,   /* IN: MCACHE cookie */
            void   *page, /* IN: page to put */
            int32   flags /* IN: flags = 0, MCACHE_DIRTY */)
 {
-    struct _lhqh *lhead     = NULL; /* head of an entry in list hash chain */
-    L_ELEM       *lp        = NULL;
-    BKT          *bp        = NULL; /* bucket element ptr */
-    intn          ret_value = RET_SUCCESS;
+    L_ELEM *lp        = NULL;
+    BKT    *bp        = NULL; /* bucket element ptr */
+    intn    ret_value = RET_SUCCESS;
 
     /* check inputs */
     if (mp == NULL || page == NULL)
@@ -470,16 +866,13 @@ mcache_put(MCACHE *mp,   /* IN: MCACHE cookie */
     bp->flags |= flags & MCACHE_DIRTY;
 
     if (bp->flags & MCACHE_DIRTY) { /* update this page reference */
-        lhead = &mp->lhqh[HASHKEY(bp->pgno)];
-        for (lp = lhead->cqh_first; lp != (void *)lhead; lp = lp->hl.cqe_next)
-            if (lp->pgno == bp->pgno) { /* hit */
+        if ((lp = mcache_elem(mp, bp->pgno)) != NULL) {
 #ifdef STATISTICS
-                ++mp->listhit;
-                ++lp->elemhit;
+            ++mp->listhit;
+            ++lp->elemhit;
 #endif
-                lp->eflags = ELEM_WRITTEN;
-                break;
-            } /* end if lp->pgno */
+            lp->eflags = ELEM_WRITTEN;
+        } /* end if lp */
     }
 
 done:
@@ -491,7 +884,8 @@ NAME
    mcache_close - close the memory buffer pool
 
 DESCRIPTION
-   Close the buffer pool.  Frees the buffer pool.
+   Close the buffer pool.  Frees the buffer pool, taking its pages
+   out of the pool they are kept in.
    Does not sync the buffer pool.
 
 RETURNS
@@ -502,26 +896,25 @@ mcache_close(MCACHE *mp /* IN: MCACHE cookie */)
 {
     L_ELEM *lp        = NULL;
     BKT    *bp        = NULL; /* bucket element */
-    intn    nelem     = 0;
     intn    ret_value = RET_SUCCESS;
-    intn    entry; /* index into hash table */
+    uint32  entry; /* index into hash table */
 
     /* check inputs */
     if (mp == NULL)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
-    /* Free up any space allocated to the lru pages. */
+    /* Free up any space allocated to the pages. */
     while ((bp = mp->lqh.cqh_first) != (void *)&mp->lqh) {
-        H4_CIRCLEQ_REMOVE(&mp->lqh, mp->lqh.cqh_first, q);
+        mcache_drop(mp->pool, bp, FALSE);
         free(bp);
     }
 
-    /* free up list elements */
-    for (entry = 0; entry < HASHSIZE; ++entry) {
+    /* free up list elements, and the ghosts of their pages */
+    for (entry = 0; entry <= mp->hashmask; ++entry) {
         while ((lp = mp->lhqh[entry].cqh_first) != (void *)&mp->lhqh[entry]) {
             H4_CIRCLEQ_REMOVE(&mp->lhqh[entry], mp->lhqh[entry].cqh_first, hl);
+            mcache_unghost(mp->pool, lp);
             free(lp);
-            nelem++;
         }
     } /* end for entry */
 
@@ -531,6 +924,9 @@ done:
     }
 
     /* Free the MCACHE cookie. */
+    mcache_pool_release(mp->pool);
+    free(mp->hqh);
+    free(mp->lhqh);
     free(mp);
 
     return ret_value;
@@ -575,7 +971,9 @@ NAME
    mcache_bkt - Get a page from the cache (or create one).
 
 DESCRIPTION
-   Private routine. Get a page from the cache (or create one).
+   Private routine. Get a page from the cache (or create one), for
+   the page of the element 'lp'.  The page is not in the cache yet,
+   see mcache_add().
 
 RETURNS
    A page if successful and NULL otherwise.
@@ -587,63 +985,168 @@ NOTE: Note that the size of the page allocated is equal to
       information by writing out of the page size bounds.
 ******************************************************************************/
 static BKT *
-mcache_bkt(MCACHE *mp /* IN: MCACHE cookie */)
+mcache_bkt(MCACHE       *mp, /* IN: MCACHE cookie */
+           const L_ELEM *lp /* IN: element of the page wanted */)
 {
-    struct _hqh *head      = NULL; /* head of hash chain */
+    MCACHE_POOL *pool      = NULL; /* pool of the cache */
     BKT         *bp        = NULL; /* bucket element */
+    BKT         *reuse     = NULL; /* evicted page to reuse */
+    size_t       size;
     intn         ret_value = RET_SUCCESS;
 
     /* check inputs */
     if (mp == NULL)
         HGOTO_ERROR(DFE_ARGS, FAIL);
-
-    /* If under the max cached, always create a new page. */
-    if ((int32)mp->curcache < (int32)mp->maxcache)
-        goto new;
+    pool = mp->pool;
 
     /*
-     * If the cache is max'd out, walk the lru list for a buffer we
-     * can flush.  If we find one, write it (if necessary) and take it
-     * off any lists.  If we don't find anything we grow the cache anyway.
-     * The cache never shrinks.
+     * While the cache is max'd out (its pool is over its budget of bytes,
+     * or the cache has 'maxcache' pages in a pool of its own), have the
+     * policy of the pool pick a buffer we can flush, write it (if
+     * necessary) and take it off all the lists; a page of the same size
+     * is reused.  If we don't find anything we grow the cache anyway.
      */
-    for (bp = mp->lqh.cqh_first; bp != (void *)&mp->lqh; bp = bp->q.cqe_next)
-        if (!(bp->flags & MCACHE_PINNED)) { /* Flush if dirty. */
-            if (bp->flags & MCACHE_DIRTY && mcache_write(mp, bp) == RET_ERROR)
-                HE_REPORT_GOTO("unable to flush a dirty page", FAIL);
+    while (pool->maxbytes > 0 ? pool->curbytes + (size_t)mp->pagesize > pool->maxbytes
+                              : mp->curcache >= mp->maxcache) {
+        if ((bp = pool->policy->victim(pool, lp)) == NULL)
+            break;
+        size = PAGE_BYTES(bp);
+        if (mcache_evict(pool, bp) == RET_ERROR)
+            HE_REPORT_GOTO("unable to flush a dirty page", FAIL);
 #ifdef STATISTICS
-            ++mp->pageflush;
+        ++mp->pageflush;
 #endif
-            /* Remove from the hash and lru queues. */
-            head = &mp->hqh[HASHKEY(bp->pgno)];
-            H4_CIRCLEQ_REMOVE(head, bp, hq);
-            H4_CIRCLEQ_REMOVE(&mp->lqh, bp, q);
-
-            /* done */
-            ret_value = RET_SUCCESS;
-            goto done;
-        } /* end if bp->flags */
+        if (reuse == NULL && size == (size_t)mp->pagesize)
+            reuse = bp;
+        else
+            free(bp);
+    } /* end while */
 
     /* create a new page */
-    new : if ((bp = (BKT *)malloc(sizeof(BKT) + (uintn)mp->pagesize)) == NULL) HGOTO_ERROR(DFE_NOSPACE, FAIL);
+    if ((bp = reuse) == NULL) {
+        if ((bp = (BKT *)malloc(sizeof(BKT) + (size_t)mp->pagesize)) == NULL)
+            HGOTO_ERROR(DFE_NOSPACE, FAIL);
 
 #ifdef STATISTICS
-    ++mp->pagealloc;
+        ++mp->pagealloc;
 #endif
 
-    /* set page ptr past bucket element section */
-    bp->page = (char *)bp + sizeof(BKT);
-    ++mp->curcache; /* increase number of cached pages */
+        /* set page ptr past bucket element section */
+        bp->page = (char *)bp + sizeof(BKT);
+    }
+    bp->owner = mp;
 
 done:
     if (ret_value == RET_ERROR) { /* error cleanup */
-        free(bp);
+        free(reuse);
         return NULL;
     }
 
     return bp; /* return only the pagesize fragment */
 } /* mcache_bkt() */
 
+/******************************************************************************
+NAME
+   mcache_add - put a page in the cache.
+
+DESCRIPTION
+   Private routine. Put a page got from mcache_bkt() in the hash chain
+   and the queue of its cache, and in the pool of the cache.
+
+RETURNS
+   Nothing
+******************************************************************************/
+static void
+mcache_add(MCACHE *mp, /* IN: MCACHE cookie */
+           BKT    *bp, /* IN: bucket element */
+           L_ELEM *lp /* IN: element of the page */)
+{
+    MCACHE_POOL *pool = mp->pool;
+    struct _hqh *head = &mp->hqh[HASHKEY(mp, bp->pgno)];
+
+    H4_CIRCLEQ_INSERT_HEAD(head, bp, hq);
+    H4_CIRCLEQ_INSERT_TAIL(&mp->lqh, bp, q);
+    ++mp->curcache; /* increase number of cached pages */
+    ++pool->npages;
+    pool->curbytes += (size_t)mp->pagesize;
+    pool->policy->insert(pool, bp, lp);
+} /* mcache_add() */
+
+/******************************************************************************
+NAME
+   mcache_drop - take a page out of its cache.
+
+DESCRIPTION
+   Private routine. Take a page off the lists of its cache and out of
+   the pool, without writing it.  'evicted' tells the policy of the pool
+   whether the page was evicted, or its cache is going away.
+
+RETURNS
+   Nothing
+******************************************************************************/
+static void
+mcache_drop(MCACHE_POOL *pool, /* IN: pool of the page */
+            BKT         *bp,   /* IN: bucket element */
+            intn         evicted /* IN: whether the page is evicted */)
+{
+    MCACHE *mp = bp->owner;
+
+    pool->policy->remove(pool, bp, evicted);
+    H4_CIRCLEQ_REMOVE(&mp->hqh[HASHKEY(mp, bp->pgno)], bp, hq);
+    H4_CIRCLEQ_REMOVE(&mp->lqh, bp, q);
+    --mp->curcache;
+    --pool->npages;
+    pool->curbytes -= (size_t)mp->pagesize;
+} /* mcache_drop() */
+
+/******************************************************************************
+NAME
+   mcache_evict - evict a page from a pool.
+
+DESCRIPTION
+   Private routine. Write a page out through its own cache if it is
+   dirty, and take it out of the pool.  The page may belong to any of
+   the caches of the pool.
+
+RETURNS
+   RET_SUCCESS if successful and RET_ERROR otherwise, with the page
+   still in the pool
+******************************************************************************/
+static intn
+mcache_evict(MCACHE_POOL *pool, /* IN: pool of the page */
+             BKT         *bp /* IN: bucket element */)
+{
+    if (bp->flags & MCACHE_DIRTY && mcache_write(bp->owner, bp) == RET_ERROR)
+        return RET_ERROR;
+    mcache_drop(pool, bp, TRUE);
+    return RET_SUCCESS;
+} /* mcache_evict() */
+
+/******************************************************************************
+NAME
+   mcache_unghost - forget the ghost of a page.
+
+DESCRIPTION
+   Private routine. Take the ghost of the page of an element, if it has
+   one, off the ghost queue of the pool and free it.
+
+RETURNS
+   Nothing
+******************************************************************************/
+static void
+mcache_unghost(MCACHE_POOL *pool, /* IN: pool of the page */
+               L_ELEM      *lp /* IN: element of the page */)
+{
+    GHOST *gp = lp->ghost;
+
+    if (gp == NULL)
+        return;
+    H4_CIRCLEQ_REMOVE(&pool->gqh[gp->list], gp, gq);
+    pool->gbytes[gp->list] -= (size_t)gp->size;
+    lp->ghost = NULL;
+    free(gp);
+} /* mcache_unghost() */
+
 /******************************************************************************
 NAME
    mcache_write - write a page to disk given it's bucket handle.
@@ -658,9 +1161,8 @@ static int
 mcache_write(MCACHE *mp, /* IN: MCACHE cookie */
              BKT    *bp /* IN: bucket element */)
 {
-    struct _lhqh *lhead     = NULL; /* head of an entry in list hash chain */
-    L_ELEM       *lp        = NULL;
-    intn          ret_value = RET_SUCCESS;
+    L_ELEM *lp        = NULL;
+    intn    ret_value = RET_SUCCESS;
 
     /* check inputs */
     if (mp == NULL || bp == NULL)
@@ -671,16 +1173,13 @@ mcache_write(MCACHE *mp, /* IN: MCACHE cookie */
 #endif
 
     /* update this page reference */
-    lhead = &mp->lhqh[HASHKEY(bp->pgno)];
-    for (lp = lhead->cqh_first; lp != (void *)lhead; lp = lp->hl.cqe_next)
-        if (lp->pgno == bp->pgno) { /* hit */
+    if ((lp = mcache_elem(mp, bp->pgno)) != NULL) { /* hit */
 #ifdef STATISTICS
-            ++mp->listhit;
-            ++lp->elemhit;
+        ++mp->listhit;
+        ++lp->elemhit;
 #endif
-            lp->eflags = ELEM_SYNC;
-            break;
-        }
+        lp->eflags = ELEM_SYNC;
+    }
 
     /* Run page through the user's filter.
        we use this to write the data chunk/page out.
@@ -739,7 +1238,7 @@ mcache_look(MCACHE *mp, /* IN: MCACHE cookie */
     }
 
     /* search through hash chain */
-    head = &mp->hqh[HASHKEY(pgno)];
+    head = &mp->hqh[HASHKEY(mp, pgno)];
     for (bp = head->cqh_first; bp != (void *)head; bp = bp->hq.cqe_next)
         if (bp->pgno == pgno) { /* hit....found page in cache */
 #ifdef STATISTICS
@@ -760,6 +1259,29 @@ done:
     return bp;
 } /* mcache_look() */
 
+/******************************************************************************
+NAME
+   mcache_elem - lookup the element of a page.
+
+DESCRIPTION
+   Private routine. Lookup the element of a page in the list hash chain.
+
+RETURNS
+   The element if the page was ever referenced and NULL otherwise.
+******************************************************************************/
+static L_ELEM *
+mcache_elem(MCACHE *mp, /* IN: MCACHE cookie */
+            int32   pgno /* IN: page to look up */)
+{
+    struct _lhqh *lhead = &mp->lhqh[HASHKEY(mp, pgno)]; /* head of list hash chain */
+    L_ELEM       *lp;
+
+    for (lp = lhead->cqh_first; lp != (void *)lhead; lp = lp->hl.cqe_next)
+        if (lp->pgno == pgno)
+            return lp;
+    return NULL;
+} /* mcache_elem() */
+
 #ifdef STATISTICS
 #ifdef H4_HAVE_GETRUSAGE
 
@@ -854,7 +1376,7 @@ mcache_stat(MCACHE *mp /* IN: MCACHE cookie */)
         sep    = "";
         cnt    = 0;
         hitcnt = 0;
-        for (entry = 0; entry < HASHSIZE; ++entry) {
+        for (entry = 0; entry <= (intn)mp->hashmask; ++entry) {
             lhead = &mp->lhqh[entry];
             for (lp = lhead->cqh_first; lp != (void *)lhead; lp = lp->hl.cqe_next) {
                 cnt++;
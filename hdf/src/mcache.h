@@ -63,16 +63,24 @@
 
 /*
  * The memory pool scheme is a simple one.  Each in-memory page is referenced
- * by a bucket which is threaded in up to two (three?) ways.  All active pages
- * are threaded on a hash chain (hashed by page number) and an lru chain.
- * (Inactive pages are threaded on a free chain?).  Each reference to a memory
- * pool is handed an opaque MPOOL cookie which stores all of this information.
+ * by a bucket which is threaded in three ways.  All active pages are threaded
+ * on a hash chain (hashed by page number), on the list of the pages of their
+ * cache, and on the queue(s) the eviction policy of their pool keeps them in.
+ * Each reference to a memory pool is handed an opaque MCACHE cookie which
+ * stores all of this information.
+ *
+ * The pages of several caches may be kept in one pool (MCACHE_POOL), which
+ * then holds them to a budget of bytes for all of them together, evicting
+ * the pages of any of its caches as its policy (LRU, CLOCK or ARC) sees fit.
+ * A cache opened without a pool gets one of its own, which holds it to
+ * 'maxcache' pages in LRU order.
  */
 
-/* Current Hash table size. Page numbers start with 1
+/* Minimum hash table size, the tables of a cache are grown with the number
+ * of pages in its object. Page numbers start with 1
  * (i.e 0 will denote invalid page number) */
-#define HASHSIZE      128
-#define HASHKEY(pgno) ((pgno - 1) % HASHSIZE)
+#define HASHSIZE          128
+#define HASHKEY(mp, pgno) ((uint32)((pgno)-1) & (mp)->hashmask)
 
 /* Default pagesize and max # of pages to cache */
 #define DEF_PAGESIZE 8192
@@ -83,18 +91,32 @@
 /* The BKT structures are the elements of the queues. */
 typedef struct _bkt {
     H4_CIRCLEQ_ENTRY(_bkt) hq; /* hash queue */
-    H4_CIRCLEQ_ENTRY(_bkt) q;  /* lru queue */
-    void *page;                /* page */
-    int32 pgno;                /* page number */
+    H4_CIRCLEQ_ENTRY(_bkt) q;  /* queue of the pages of the cache */
+    H4_CIRCLEQ_ENTRY(_bkt) pq; /* eviction queue of the pool */
+    struct MCACHE *owner;      /* cache the page belongs to */
+    void          *page;       /* page */
+    int32          pgno;       /* page number */
 #define MCACHE_DIRTY  0x01     /* page needs to be written */
 #define MCACHE_PINNED 0x02     /* page is pinned into memory */
+#define MCACHE_REF    0x04     /* page was used since the clock hand passed it */
+#define MCACHE_FREQ   0x08     /* page was used more than once (ARC) */
     uint8 flags;               /* flags */
 } BKT;
 
+/* A page evicted from an ARC pool, remembered to adapt the policy if the
+ * page is wanted again soon */
+typedef struct _ghost {
+    H4_CIRCLEQ_ENTRY(_ghost) gq; /* ghost queue */
+    struct _lelem *elem;         /* element of the page */
+    int32          size;         /* size of the page */
+    intn           list;         /* queue it is on, 0 or 1 */
+} GHOST;
+
 /* The element structure for every page referenced(read/written) in object */
 typedef struct _lelem {
     H4_CIRCLEQ_ENTRY(_lelem) hl; /* hash list */
-    int32 pgno;                  /* page number */
+    GHOST *ghost;                /* ghost of the page, if it was evicted (ARC) */
+    int32  pgno;                 /* page number */
 #ifdef STATISTICS
     int32 elemhit; /* # of hits on page */
 #endif
@@ -108,13 +130,31 @@ typedef struct _lelem {
     0x10 /* increase number of pages                                                                         \
         i.e extend object */
 
+/* Pool of pages shared by caches */
+typedef struct MCACHE_POOL {
+    H4_CIRCLEQ_HEAD(_pqh, _bkt) pqh[2];      /* eviction queues of the pages */
+    H4_CIRCLEQ_HEAD(_gqh, _ghost) gqh[2];    /* queues of the ghosts (ARC) */
+    const struct mcache_policy_t *policy;    /* eviction policy */
+    BKT                          *hand;      /* clock hand (CLOCK) */
+    size_t                        maxbytes;  /* budget of bytes, 0 for 'maxcache' pages per cache */
+    size_t                        curbytes;  /* bytes of the pages in the pool */
+    size_t                        qbytes[2]; /* bytes of the pages on each queue (ARC) */
+    size_t                        gbytes[2]; /* bytes of the ghosts on each queue (ARC) */
+    size_t                        target;    /* target bytes of queue 0 (ARC) */
+    int32                         npages;    /* number of pages in the pool */
+    intn                          nrefs;     /* number of references to the pool */
+} MCACHE_POOL;
+
 /* Memory pool cache */
 typedef struct MCACHE {
-    H4_CIRCLEQ_HEAD(_lqh, _bkt) lqh;                            /* lru queue head */
-    H4_CIRCLEQ_HEAD(_hqh, _bkt) hqh[HASHSIZE];                  /* hash queue array */
-    H4_CIRCLEQ_HEAD(_lhqh, _lelem) lhqh[HASHSIZE];              /* hash of all elements */
+    H4_CIRCLEQ_HEAD(_lqh, _bkt) lqh;                            /* queue of the pages of the cache */
+    H4_CIRCLEQ_HEAD(_hqh, _bkt) * hqh;                          /* hash queue array */
+    H4_CIRCLEQ_HEAD(_lhqh, _lelem) * lhqh;                      /* hash of all elements */
+    uint32       hashmask;                                      /* size of the hash tables - 1 */
+    MCACHE_POOL *pool;                                          /* pool the pages are kept in */
     int32 curcache;                                             /* current num of cached pages */
-    int32 maxcache;                                             /* max number of cached pages */
+    int32 maxcache;                                             /* max number of cached pages,
+                                                                   unless the pool has a budget */
     int32 npages;                                               /* number of pages in the object */
     int32 pagesize;                                             /* cache page size */
     int32 object_id;                                            /* access ID of object this cache is for */
@@ -142,12 +182,22 @@ typedef struct MCACHE {
 extern "C" {
 #endif
 
-HDFLIBAPI MCACHE *mcache_open(void *key,       /* IN:byte string used as handle to share buffers */
-                              int32 object_id, /* IN: object handle */
-                              int32 pagesize,  /* IN: chunk size in bytes */
-                              int32 maxcache,  /* IN: maximum number of pages to cache at any time */
-                              int32 npages,    /* IN: number of chunks currently in object */
-                              int32 flags /* IN: 0= object exists, 1= does not exist */);
+HDFLIBAPI MCACHE_POOL *mcache_pool_create(size_t maxbytes, /* IN: budget of bytes for the pages */
+                                          intn   policy /* IN: eviction policy, HDF_CHUNK_CACHE_xxx */);
+
+HDFLIBAPI intn mcache_pool_set_size(MCACHE_POOL *pool, /* IN: pool */
+                                    size_t       maxbytes /* IN: new budget of bytes */);
+
+HDFLIBAPI size_t mcache_pool_get_used(MCACHE_POOL *pool /* IN: pool */);
+
+HDFLIBAPI void mcache_pool_release(MCACHE_POOL *pool /* IN: pool */);
+
+HDFLIBAPI MCACHE *mcache_open(MCACHE_POOL *pool,      /* IN: pool to share pages in, NULL for none */
+                              int32        object_id, /* IN: object handle */
+                              int32        pagesize,  /* IN: chunk size in bytes */
+                              int32        maxcache,  /* IN: maximum number of pages to cache at any time */
+                              int32        npages,    /* IN: number of chunks currently in object */
+                              int32        flags /* IN: 0= object exists, 1= does not exist */);
 
 HDFLIBAPI void mcache_filter(MCACHE *mp,                                          /* IN: MCACHE cookie */
                              int32 (*pgin)(void *cookie, int32 pgno, void *page), /* IN: page in filter */
@@ -167,6 +217,9 @@ HDFLIBAPI intn mcache_put(MCACHE *mp,   /* IN: MCACHE cookie */
                           void   *page, /* IN: page to put */
                           int32   flags /* IN: flags = 0, MCACHE_DIRTY */);
 
+HDFLIBAPI intn mcache_incore(MCACHE *mp, /* IN: MCACHE cookie */
+                             int32   pgno /* IN: page number */);
+
 HDFLIBAPI intn mcache_sync(MCACHE *mp /* IN: MCACHE cookie */);
 
 HDFLIBAPI intn mcache_close(MCACHE *mp /* IN: MCACHE cookie */);
@@ -84,6 +84,7 @@
 #include "mfan.h"
 #include "atom.h"
 #include "hfile.h" /* needed for filerec_t */
+#include "hthread.h"
 
 /* Whether we've installed the library termination function yet for this
    interface */
@@ -1206,6 +1207,8 @@ ANstart(int32 file_id /* IN: file to start annotation access on*/)
     filerec_t *file_rec  = NULL; /* file record pointer */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -1221,6 +1224,7 @@ ANstart(int32 file_id /* IN: file to start annotation access on*/)
     ret_value = file_id;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANstart() */
 
@@ -1251,6 +1255,8 @@ ANfileinfo(int32  an_id,        /* IN:  annotation interface id */
     filerec_t *file_rec  = NULL; /* file record pointer */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -1292,6 +1298,7 @@ ANfileinfo(int32  an_id,        /* IN:  annotation interface id */
         *n_obj_desc = file_rec->an_num[AN_DATA_DESC];
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANfileinfo() */
 
@@ -1314,6 +1321,8 @@ ANend(int32 an_id /* IN: Annotation ID of file to close */)
     ANnode    *ann_node  = NULL;
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -1408,6 +1417,7 @@ ANend(int32 an_id /* IN: Annotation ID of file to close */)
     file_rec->an_num[AN_FILE_DESC]   = -1;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANend() */
 
@@ -1435,8 +1445,11 @@ ANcreate(int32    an_id,    /* IN: annotation interface ID */
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = (ANIcreate(an_id, elem_tag, elem_ref, type));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANcreate() */
 
@@ -1464,6 +1477,8 @@ ANcreatef(int32    an_id,/* IN: annotation interface ID */
     uint16 ann_ref;
     int32  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* deal with type */
     switch ((ann_type)type) {
         case AN_FILE_LABEL:
@@ -1483,6 +1498,7 @@ ANcreatef(int32    an_id,/* IN: annotation interface ID */
     ret_value = ANIcreate(an_id, ann_tag, ann_ref, type);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANcreateann() */
 
@@ -1513,6 +1529,8 @@ ANselect(int32    an_id, /* IN: annotation interface ID */
     ANentry   *ann_entry = NULL;
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -1543,6 +1561,7 @@ ANselect(int32    an_id, /* IN: annotation interface ID */
     ret_value = ann_entry->ann_id;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANselect() */
 
@@ -1574,6 +1593,8 @@ ANnumann(int32    an_id,  /* IN: annotation interface id */
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* deal with invalid types */
     if (type == AN_FILE_LABEL || type == AN_FILE_DESC)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -1581,6 +1602,7 @@ ANnumann(int32    an_id,  /* IN: annotation interface id */
     ret_value = ANInumann(an_id, type, elem_tag, elem_ref);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANnumann() */
 
@@ -1613,6 +1635,8 @@ ANannlist(int32    an_id,  /* IN: annotation interface id */
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* deal with invalid types */
     if (type == AN_FILE_LABEL || type == AN_FILE_DESC)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -1620,6 +1644,7 @@ ANannlist(int32    an_id,  /* IN: annotation interface id */
     ret_value = ANIannlist(an_id, type, elem_tag, elem_ref, ann_list);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANannlist() */
 
@@ -1642,7 +1667,10 @@ ANannlen(int32 ann_id /* IN: annotation id */)
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = ANIannlen(ann_id);
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANannlen() */
 
@@ -1668,7 +1696,10 @@ ANwriteann(int32       ann_id, /* IN: annotation id */
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = ANIwriteann(ann_id, ann, annlen);
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANwriteann() */
 
@@ -1694,7 +1725,10 @@ ANreadann(int32 ann_id, /* IN: annotation id (handle) */
 {
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = ANIreadann(ann_id, ann, maxlen);
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANreadann() */
 
@@ -1717,8 +1751,11 @@ ANendaccess(int32 ann_id /* IN: annotation id */)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     (void)ann_id;
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANendaccess() */
 
@@ -1753,6 +1790,8 @@ ANget_tagref(int32    an_id, /* IN: annotation interface ID */
     ANentry   *ann_entry = NULL;
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -1801,6 +1840,7 @@ ANget_tagref(int32    an_id, /* IN: annotation interface ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANget_tagref() */
 
@@ -1830,6 +1870,8 @@ ANid2tagref(int32   ann_id, /* IN: annotation id */
     uint16  ann_ref;
     int32   ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -1869,6 +1911,7 @@ ANid2tagref(int32   ann_id, /* IN: annotation id */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANid2tagref */
 
@@ -1899,6 +1942,8 @@ ANtagref2id(int32  an_id,   /* IN  Annotation interface id */
     ann_type   type;
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -1948,6 +1993,7 @@ ANtagref2id(int32  an_id,   /* IN  Annotation interface id */
     ret_value = ann_entry->ann_id;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* ANtagref2id */
 
@@ -1970,6 +2016,8 @@ ANatype2tag(ann_type atype /* IN: Annotation type */)
 { /* Switch on annotation type "atype" */
     uint16 ann_tag;
 
+    H4_API_LOCK;
+
     switch ((ann_type)atype) {
         case AN_FILE_LABEL:
             ann_tag = DFTAG_FID;
@@ -1986,6 +2034,7 @@ ANatype2tag(ann_type atype /* IN: Annotation type */)
         default:
             ann_tag = DFTAG_NULL; /*changed from 5 to DFTAG_NULL -BMR*/
     }                             /* switch */
+    H4_API_UNLOCK;
     return ann_tag;
 } /* ANatype2tag */
 
@@ -2008,6 +2057,8 @@ ANtag2atype(uint16 atag /* IN: annotation tag */)
 { /* Switch on annotation tag */
     ann_type atype;
 
+    H4_API_LOCK;
+
     switch ((uint16)atag) {
         case DFTAG_FID:
             atype = AN_FILE_LABEL;
@@ -2025,5 +2076,6 @@ ANtag2atype(uint16 atag /* IN: annotation tag */)
         default:
             atype = AN_UNDEF;
     } /* switch */
+    H4_API_UNLOCK;
     return atype;
 } /* ANtag2atype */
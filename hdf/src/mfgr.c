@@ -157,6 +157,7 @@ intn GRIil_convert(const void * inbuf,gr_interlace_t inil,void * outbuf,
 #include "hdfi.h"
 #include "hlimits.h"
 #include "mfgri.h"
+#include "hthread.h"
 
 #ifdef H4_HAVE_LIBSZ /* we have the library */
 #include "szlib.h"
@@ -1463,6 +1464,8 @@ GRstart(int32 hdf_file_id)
     gr_info_t *gr_ptr; /* ptr to the new GR information for a file */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
 
@@ -1521,6 +1524,7 @@ GRstart(int32 hdf_file_id)
     ret_value = HAregister_atom(GRIDGROUP, gr_ptr);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRstart() */
 
@@ -1551,6 +1555,8 @@ GRfileinfo(int32 grid, int32 *n_datasets, int32 *n_attrs)
     gr_info_t *gr_ptr; /* ptr to the GR information for a file */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
 
@@ -1569,6 +1575,7 @@ GRfileinfo(int32 grid, int32 *n_datasets, int32 *n_attrs)
         *n_attrs = gr_ptr->gattr_count;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRfileinfo() */
 
@@ -1951,6 +1958,8 @@ GRend(int32 grid)
     int32      temp_ref; /* used to hold the returned value from a function
                                  that may return a ref or a FAIL - BMR */
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
 
@@ -2137,6 +2146,7 @@ GRend(int32 grid)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRend() */
 
@@ -2170,6 +2180,8 @@ GRselect(int32 grid, int32 index)
     void     **t;      /* temp. ptr to the image found */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
 
@@ -2194,6 +2206,7 @@ GRselect(int32 grid, int32 index)
     ret_value = HAregister_atom(RIIDGROUP, ri_ptr);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRselect() */
 
@@ -2236,6 +2249,8 @@ GRcreate(int32 grid, const char *name, int32 ncomp, int32 nt, int32 il, int32 di
     int32      temp_ref; /* used to hold the returned value from a function
                                  that may return a ref or a FAIL - BMR */
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2315,6 +2330,7 @@ GRcreate(int32 grid, const char *name, int32 ncomp, int32 nt, int32 il, int32 di
     ret_value = HAregister_atom(RIIDGROUP, ri_ptr);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRcreate() */
 
@@ -2347,6 +2363,8 @@ GRnametoindex(int32 grid, const char *name)
     void     **t;      /* temp. ptr to the image found */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of file id */
     HEclear();
 
@@ -2369,6 +2387,7 @@ GRnametoindex(int32 grid, const char *name)
     ret_value = (FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRnametoindex() */
 
@@ -2408,6 +2427,8 @@ GRgetiminfo(int32 riid, char *name, int32 *ncomp, int32 *nt, int32 *il, int32 di
     ri_info_t *ri_ptr; /* ptr to the image to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -2440,6 +2461,7 @@ GRgetiminfo(int32 riid, char *name, int32 *ncomp, int32 *nt, int32 *il, int32 di
         *n_attr = ri_ptr->lattr_count;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRgetiminfo() */
 
@@ -2473,6 +2495,8 @@ GRgetnluts(int32 riid)
     ri_info_t *ri_ptr; /* ptr to the image to work with */
     intn       ret_value = FAIL;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -2490,6 +2514,7 @@ GRgetnluts(int32 riid)
         ret_value = 1;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRgetnluts() */
 
@@ -2551,6 +2576,8 @@ GRwriteimage(int32 riid, int32 start[2], int32 in_stride[2], int32 count[2], voi
     intn         switch_interlace = FALSE; /* whether the memory interlace needs to be switched around */
     intn         ret_value        = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -2910,6 +2937,7 @@ GRwriteimage(int32 riid, int32 start[2], int32 in_stride[2], int32 count[2], voi
     gr_ptr->gr_modified   = TRUE;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRwriteimage() */
 
@@ -2970,6 +2998,8 @@ GRreadimage(int32 riid, int32 start[2], int32 in_stride[2], int32 count[2], void
     intn         status    = FAIL;
     intn         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3178,6 +3208,7 @@ GRreadimage(int32 riid, int32 start[2], int32 in_stride[2], int32 count[2], void
     } /* end if */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRreadimage() */
 
@@ -3210,6 +3241,8 @@ GRendaccess(int32 riid)
     ri_info_t *ri_ptr; /* ptr to the image to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3251,6 +3284,7 @@ GRendaccess(int32 riid)
         HGOTO_ERROR(DFE_RINOTFOUND, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRendaccess() */
 
@@ -3282,6 +3316,8 @@ GRidtoref(int32 riid)
     ri_info_t *ri_ptr;        /* ptr to the image to work with */
     uint16     ret_value = 0; /* FAIL? */
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3307,6 +3343,7 @@ GRidtoref(int32 riid)
     } /* end else */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRidtoref() */
 
@@ -3341,6 +3378,8 @@ GRreftoindex(int32 grid, uint16 ref)
     void     **t;      /* temp. ptr to the image found */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3364,6 +3403,7 @@ GRreftoindex(int32 grid, uint16 ref)
     ret_value = (FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRreftoindex() */
 
@@ -3400,6 +3440,8 @@ GRreqlutil(int32 riid, intn il)
     ri_info_t *ri_ptr; /* ptr to the image to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3416,6 +3458,7 @@ GRreqlutil(int32 riid, intn il)
     ri_ptr->lut_il = (gr_interlace_t)il;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRreqlutil() */
 
@@ -3452,6 +3495,8 @@ GRreqimageil(int32 riid, intn il)
     ri_info_t *ri_ptr; /* ptr to the image to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3468,6 +3513,7 @@ GRreqimageil(int32 riid, intn il)
     ri_ptr->im_il = (gr_interlace_t)il;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRreqimageil() */
 
@@ -3501,6 +3547,8 @@ GRgetlutid(int32 riid, int32 lut_index)
 {
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3511,6 +3559,7 @@ GRgetlutid(int32 riid, int32 lut_index)
     ret_value = (riid);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRgetlutid() */
 
@@ -3544,6 +3593,8 @@ GRluttoref(int32 lutid)
     ri_info_t *ri_ptr; /* ptr to the image to work with */
     uint16     ret_value = 0;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3558,6 +3609,7 @@ GRluttoref(int32 lutid)
     ret_value = ri_ptr->lut_ref;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRluttoref() */
 
@@ -3593,6 +3645,8 @@ GRgetlutinfo(int32 lutid, int32 *ncomp, int32 *nt, int32 *il, int32 *nentries)
     ri_info_t *ri_ptr; /* ptr to the image to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3627,6 +3681,7 @@ GRgetlutinfo(int32 lutid, int32 *ncomp, int32 *nt, int32 *il, int32 *nentries)
     } /* end else */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRgetlutinfo() */
 
@@ -3664,6 +3719,8 @@ GRwritelut(int32 lutid, int32 ncomps, int32 nt, int32 il, int32 nentries, void *
     ri_info_t *ri_ptr;      /* ptr to the image to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3713,6 +3770,7 @@ GRwritelut(int32 lutid, int32 ncomps, int32 nt, int32 il, int32 nentries, void *
     } /* end else */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRwritelut() */
 
@@ -3746,6 +3804,8 @@ GRreadlut(int32 lutid, void *data)
     ri_info_t *ri_ptr;      /* ptr to the image to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3787,6 +3847,7 @@ GRreadlut(int32 lutid, void *data)
     } /* end if */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRreadlut() */
 
@@ -3821,6 +3882,8 @@ GRsetexternalfile(int32 riid, const char *filename, int32 offset)
     int32      tmp_aid; /* AID returned from HXcreate() */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3861,6 +3924,7 @@ GRsetexternalfile(int32 riid, const char *filename, int32 offset)
         HGOTO_ERROR(DFE_CANTENDACCESS, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRsetexternalfile() */
 
@@ -3896,6 +3960,8 @@ GRsetaccesstype(int32 riid, uintn accesstype)
     ri_info_t *ri_ptr; /* ptr to the image to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -3913,6 +3979,7 @@ GRsetaccesstype(int32 riid, uintn accesstype)
     ri_ptr->acc_type = accesstype;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRsetaccesstype() */
 
@@ -3989,6 +4056,8 @@ GRsetcompress(int32 riid, comp_coder_t comp_type, comp_info *cinfo)
     uint32     comp_config;
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -4062,6 +4131,7 @@ GRsetcompress(int32 riid, comp_coder_t comp_type, comp_info *cinfo)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRsetcompress() */
 
@@ -4099,11 +4169,14 @@ GRgetcompress(int32 riid, comp_coder_t *comp_type, comp_info *cinfo)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     ret_value = GRgetcompinfo(riid, comp_type, cinfo);
     if (ret_value == FAIL)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRgetcompress() */
 
@@ -4171,6 +4244,8 @@ GRgetcomptype(int32 riid, comp_coder_t *comp_type)
     uint16     scheme; /* compression scheme used for old images */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error */
     HEclear();
 
@@ -4208,6 +4283,7 @@ GRgetcomptype(int32 riid, comp_coder_t *comp_type)
         *comp_type = temp_comp_type;
     }
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRgetcomptype() */
 
@@ -4248,6 +4324,8 @@ GRgetcompinfo(int32 riid, comp_coder_t *comp_type, comp_info *cinfo)
     uint16     scheme; /* compression scheme used for JPEG images */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -4295,6 +4373,7 @@ GRgetcompinfo(int32 riid, comp_coder_t *comp_type, comp_info *cinfo)
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRgetcompinfo() */
 
@@ -4342,6 +4421,8 @@ GRsetattr(int32 id, const char *name, int32 attr_nt, int32 count, const void *da
     intn       is_riid   = FALSE; /* whether we had a RIID */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -4498,6 +4579,7 @@ GRsetattr(int32 id, const char *name, int32 attr_nt, int32 count, const void *da
     } /* end if */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRsetattr() */
 
@@ -4537,6 +4619,8 @@ GRattrinfo(int32 id, int32 index, char *name, int32 *attr_nt, int32 *count)
     at_info_t *at_ptr;      /* ptr to the attribute to work with */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -4578,6 +4662,7 @@ GRattrinfo(int32 id, int32 index, char *name, int32 *attr_nt, int32 *count)
         *count = at_ptr->len;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRattrinfo() */
 
@@ -4617,6 +4702,8 @@ GRgetattr(int32 id, int32 index, void *data)
     int32      at_size;     /* size in bytes of the attribute data */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -4686,6 +4773,7 @@ GRgetattr(int32 id, int32 index, void *data)
         HDfreenclear(at_ptr->data);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRgetattr() */
 
@@ -4722,6 +4810,8 @@ GRfindattr(int32 id, const char *name)
     at_info_t *at_ptr;      /* ptr to the attribute to work with */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -4757,6 +4847,7 @@ GRfindattr(int32 id, const char *name)
     ret_value = (FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end GRfindattr() */
 
@@ -5064,6 +5155,8 @@ GRsetchunk(int32         riid,      /* IN: raster access id */
     gr_info_t     *gr_ptr;              /* ptr to the file GR information for this image */
     intn           ret_value = SUCCEED; /* return value */
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -5261,6 +5354,7 @@ done:
     /* free chunk dims */
     free(chunk[0].pdims);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* GRsetchunk */
 
@@ -5304,6 +5398,8 @@ GRgetchunkinfo(int32          riid,      /* IN: sds access id */
     intn            i;                   /* loop variable */
     intn            ret_value = SUCCEED; /* return value */
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -5366,6 +5462,7 @@ GRgetchunkinfo(int32          riid,      /* IN: sds access id */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* GRgetchunkinfo() */
 
@@ -5418,6 +5515,8 @@ GRwritechunk(int32       riid,   /* IN: access aid to GR */
     intn            switch_interlace = FALSE; /* whether the memory interlace needs to be switched around */
     intn            ret_value        = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -5559,6 +5658,7 @@ done:
     /* free conversion buffers if we created them */
     free(img_data);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* GRwritechunk() */
 
@@ -5610,6 +5710,8 @@ GRreadchunk(int32  riid,   /* IN: access aid to GR */
     intn            status    = FAIL;
     intn            ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -5752,6 +5854,7 @@ done:
     /* free conversion buffers if any */
     free(img_data);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* GRreadchunk() */
 
@@ -5814,6 +5917,8 @@ GRsetchunkcache(int32 riid,     /* IN: access aid to mess with */
     int16      special;       /* Special code */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack and check validity of args */
     HEclear();
 
@@ -5855,6 +5960,7 @@ GRsetchunkcache(int32 riid,     /* IN: access aid to mess with */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* GRsetchunkcache() */
 
@@ -5903,6 +6009,8 @@ GR2bmapped(int32 riid, intn *tobe_mapped, intn *name_generated)
     int32      file_id;            /* shortcut file id */
     intn       ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -5959,6 +6067,7 @@ GR2bmapped(int32 riid, intn *tobe_mapped, intn *name_generated)
     *name_generated = ri_ptr->name_generated;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* GR2bmapped */
 /*
@@ -11,29 +11,25 @@
  * help@hdfgroup.org.                                                        *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-/* "tbbt.c" -- Routines for using threaded, balanced, binary trees. */
-/* Extended from (added threads to) Knuth 6.2.3, Algorithm A (AVL trees) */
-/* Basic tree structure by Adel'son-Vel'skii and Landis */
+/* "tbbt.c" -- Routines for using balanced trees of sorted items. */
+/* The trees used to be threaded AVL trees (Knuth 6.2.3, Algorithm A); they
+ * are now B+trees (Knuth 6.2.4), which keep many nodes side by side in each
+ * block of the tree.  A search touches a few blocks instead of one node per
+ * level of a binary tree, which matters for the tag, vgroup, vdata and
+ * annotation trees of files with many objects.
+ *
+ * The nodes handed out by these routines are kept in arrays in the leaf
+ * blocks, in key order, and each leaf is linked to its neighbours so that
+ * walking the tree is walking the arrays.  The inner blocks hold, for each
+ * of their children, the smallest key below it, and every block knows how
+ * many nodes are below it, for tbbtindx().  For trees made with a "fast
+ * compare", the blocks also keep the values of the keys next to each other,
+ * so that searching a block does not have to follow the key pointers.
+ */
 
 #include "hdfi.h"
 #include "tbbt.h"
-
-#define PARENT 0
-#define LEFT   1
-#define RIGHT  2
-
-/* Quick hack to implement PIMPL pattern for TBBT nodes
- *
- * Simple copy-n-paste, so not as robust as a function-like macro (but
- * simpler to read and looks more like the original code)
- */
-#define Flags  priv->flags
-#define Link   priv->link
-#define Rcnt   priv->rcnt
-#define Lcnt   priv->lcnt
-#define Parent Link[PARENT]
-#define Lchild Link[LEFT]
-#define Rchild Link[RIGHT]
+#include "hthread.h"
 
 /* Quick hack to implement PIMPL pattern for TBBT trees
  *
@@ -45,58 +41,68 @@
 #define Compar       priv->compar
 #define Cmparg       priv->cmparg
 
-#define TBBT_FLAG unsigned long
-#define TBBT_LEAF unsigned long
-
-/* TBBT flag values */
-#define TBBT_HEAVY(s) s /* If the `s' sub-tree is deeper than the other */
-#define TBBT_DOUBLE   4 /* If "heavy" sub-tree is two levels deeper */
-#define TBBT_INTERN   8 /* If node is internal (has two children) */
-#define TBBT_UNBAL    (TBBT_HEAVY(LEFT) | TBBT_HEAVY(RIGHT))
-#define TBBT_FLAGS    (TBBT_UNBAL | TBBT_INTERN | TBBT_DOUBLE)
-#define TBBT_CHILD(s) (TBBT_INTERN | TBBT_HEAVY(s))
-
-#define LeftCnt(node)  ((node)->Lcnt) /* Left descendants */
-#define RightCnt(node) ((node)->Rcnt) /* Left descendants */
-#define Cnt(node, s)   (LEFT == (s) ? LeftCnt(node) : RightCnt(node))
-#define HasChild(n, s) (Cnt(n, s) > 0)
-#define Heavy(n, s)    ((s) & (LeftCnt(n) > RightCnt(n) ? LEFT : LeftCnt(n) == RightCnt(n) ? 0 : RIGHT))
-#define Intern(n)      (LeftCnt(n) && RightCnt(n))
-#define UnBal(n)       (LeftCnt(n) > RightCnt(n) ? LEFT : LeftCnt(n) == RightCnt(n) ? 0 : RIGHT)
-#define Double(n)      (TBBT_DOUBLE & (n)->Flags)
-#define Other(side)    (LEFT + RIGHT - (side))
-#define Delta(n, s)    ((Heavy(n, s) ? 1 : -1) * (Double(n) ? 2 : UnBal(n) ? 1 : 0))
-
-#define SetFlags(n, s, b, i)                                                                                 \
-    ((-2 < (b) && (b) < 2 ? 0 : TBBT_DOUBLE) |                                                               \
-     (0 > (b)   ? TBBT_HEAVY(s)                                                                              \
-      : (b) > 0 ? TBBT_HEAVY(Other(s))                                                                       \
-                : 0) |                                                                                       \
-     ((i) ? TBBT_INTERN : 0))
-
-/* Return maximum of two scalar values */
-#define Max(a, b) ((a) > (b) ? (a) : (b))
-
-/* Private TBBT information */
+/* Arena a tree and its blocks come from */
+#define Arena priv->arena
+
+/* Most nodes in a leaf, or children of an inner block.  A block stays under
+   the largest size an arena keeps free lists for */
+#define TBBT_FANOUT 32
+
+/* A block with no more than TBBT_MERGE entries left is merged with a
+   neighbour when both fit in TBBT_MERGE_MAX entries; leaving some room in
+   the merged block keeps a few inserts from splitting it right away */
+#define TBBT_MERGE     (TBBT_FANOUT / 2)
+#define TBBT_MERGE_MAX ((TBBT_FANOUT * 3) / 4)
+
+/* Block of a tree; the nodes given to the users are in the leaves */
 typedef struct tbbt_node_private {
-    TBBT_NODE *link[3]; /* Pointers to parent, left child, and right child */
-    TBBT_FLAG  flags;   /* TBBT flags: (see above) */
-    TBBT_LEAF  lcnt;    /* Count of left children */
-    TBBT_LEAF  rcnt;    /* Count of right children */
-} TBBT_NODE_PRIV;
+    struct tbbt_node_private *parent; /* Inner block above, NULL for the top block */
+    struct tbbt_node_private *prev;   /* Leaves: leaf with the smaller keys */
+    struct tbbt_node_private *next;   /* Leaves: leaf with the larger keys */
+    struct tbbt_tree_private *tree;   /* Tree the block belongs to */
+    unsigned long             count;  /* Number of nodes in and below the block */
+    intn                      nitems; /* Number of nodes (leaf) or children (inner) */
+    intn                      leaf;   /* Whether the block is a leaf */
+    int32                     fkey[TBBT_FANOUT]; /* Values of the keys, for the fast compares */
+    union {
+        TBBT_NODE item[TBBT_FANOUT]; /* Leaves: the nodes, in key order */
+        struct {
+            void                     *key[TBBT_FANOUT];   /* Smallest key below each child */
+            struct tbbt_node_private *child[TBBT_FANOUT]; /* Children, in key order */
+        } inner;
+    } u;
+} TBBT_BLOCK;
 
 typedef struct tbbt_tree_private {
     unsigned long count;        /* The number of nodes in the tree currently */
     unsigned      fast_compare; /* Use a faster in-line compare (with casts) instead of function call */
     int (*compar)(void *k1, void *k2, int cmparg);
-    int cmparg;
+    int         cmparg;
+    arena_p     arena; /* Arena the tree and its blocks come from (NULL if malloc'd) */
+    TBBT_BLOCK *top;   /* Top block, NULL when the tree is empty */
+    TBBT_BLOCK *first; /* Leaf with the smallest keys */
+    TBBT_BLOCK *last;  /* Leaf with the largest keys */
+    TBBT_NODE **rootp; /* Where the first node of the tree is kept for the users */
+    intn        bare;  /* Made by tbbtins() for a tree without tbbtdmake(), goes with its last node */
 } TBBT_TREE_PRIV;
 
-/* Pointer to the tbbt node free list */
-static TBBT_NODE *tbbt_free_list = NULL;
+/* A tree allocated from an arena, in one piece */
+typedef struct {
+    TBBT_TREE      tree;
+    TBBT_TREE_PRIV priv;
+} TBBT_ARENA_TREE;
+
+/* A key being looked for */
+typedef struct {
+    void    *key;          /* The key itself */
+    int32    fast_key;     /* Its value, for the fast compares */
+    unsigned fast_compare; /* Which fast compare to use, 0 for `compar' */
+    int (*compar)(void *k1, void *k2, int cmparg);
+    int cmparg;
+} TBBT_KEY;
 
-#define KEYcmp(k1, k2, a)                                                                                    \
-    ((NULL != compar) ? (*compar)(k1, k2, a) : memcmp(k1, k2, 0 < (a) ? (a) : (int)strlen(k1)))
+/* Pointer to the tbbt block free list */
+static H4_THREAD_LOCAL TBBT_BLOCK *tbbt_free_list = NULL;
 
 void tbbt1dump(TBBT_NODE *node, int method);
 
@@ -105,189 +111,251 @@ extern void tbbt_printNode(TBBT_NODE *node, void (*key_dump)(void *, void *));
 extern void tbbt_dumpNode(TBBT_NODE *node, void (*key_dump)(void *, void *), int method);
 extern void tbbt_dump(TBBT_TREE *ptree, void (*key_dump)(void *, void *), int method);
 
-static TBBT_NODE *tbbt_get_node(void);
-static void       tbbt_release_node(TBBT_NODE *nod);
+static TBBT_BLOCK *tbbt_get_block(TBBT_TREE_PRIV *tree);
+static void        tbbt_release_block(TBBT_BLOCK *blk);
+static TBBT_BLOCK *tbbt_split(TBBT_TREE_PRIV *tree, TBBT_BLOCK *blk, TBBT_BLOCK **spare);
 
-/* Returns pointer to end-most (to LEFT or RIGHT) node of tree: */
-static TBBT_NODE *
-tbbt_end(TBBT_NODE *root, int side)
+/* Returns the value of a key for the fast compares (0 if there are none) */
+static int32
+tbbt_fast_key(unsigned fast_compare, void *key)
 {
-    if (root == NULL)
-        return NULL;
-    while (HasChild(root, side)) {
-        root = root->Link[side];
+    switch (fast_compare) {
+        case TBBT_FAST_UINT16_COMPARE:
+            return (int32) * (uint16 *)key;
+
+        case TBBT_FAST_INT32_COMPARE:
+            return *(int32 *)key;
+
+        default:
+            return 0;
+    } /* end switch */
+}
+
+/* Sets up a key to look for */
+static void
+tbbt_make_key(TBBT_KEY *k, void *key, unsigned fast_compare, int (*compar)(void *, void *, int), int arg)
+{
+    k->key          = key;
+    k->fast_key     = tbbt_fast_key(fast_compare, key);
+    k->fast_compare = fast_compare;
+    k->compar       = compar;
+    k->cmparg       = arg;
+}
+
+/* Compares a key with the i'th key of a block */
+static int
+tbbt_cmp(const TBBT_KEY *k, const TBBT_BLOCK *blk, intn i)
+{
+    void *key2;
+
+    if (k->fast_compare)
+        return (k->fast_key > blk->fkey[i]) - (k->fast_key < blk->fkey[i]);
+
+    key2 = blk->leaf ? blk->u.item[i].key : blk->u.inner.key[i];
+    if (NULL != k->compar)
+        return (*k->compar)(k->key, key2, k->cmparg);
+    return memcmp(k->key, key2, 0 < k->cmparg ? (size_t)k->cmparg : strlen((char *)k->key));
+}
+
+/* Returns the position of the first key of a block which is not less than
+ * `k', and sets `*cmp' to how `k' compares with it (or to -1 if all the keys
+ * of the block are less than `k') */
+static intn
+tbbt_search(const TBBT_KEY *k, const TBBT_BLOCK *blk, int *cmp)
+{
+    intn lo = 0, hi = blk->nitems;
+    int  c;
+
+    *cmp = -1;
+    while (lo < hi) {
+        intn mid = (lo + hi) / 2;
+
+        if ((c = tbbt_cmp(k, blk, mid)) > 0)
+            lo = mid + 1;
+        else {
+            hi   = mid;
+            *cmp = c;
+        }
     }
-    return root;
+    return lo;
 }
 
-TBBT_NODE *
-tbbtfirst(TBBT_NODE *root)
+/* Returns the leaf where the key `k' is, or would go */
+static TBBT_BLOCK *
+tbbt_descend(const TBBT_KEY *k, TBBT_BLOCK *blk)
 {
-    return tbbt_end(root, LEFT);
+    intn pos;
+    int  cmp;
+
+    while (!blk->leaf) {
+        pos = tbbt_search(k, blk, &cmp);
+        if (cmp != 0 && pos > 0)
+            pos--; /* the child whose smallest key is just less than `k' */
+        blk = blk->u.inner.child[pos];
+    }
+    return blk;
 }
 
-TBBT_NODE *
-tbbtlast(TBBT_NODE *root)
+/* Returns the position of a block among the children of its parent */
+static intn
+tbbt_child_index(const TBBT_BLOCK *parent, const TBBT_BLOCK *blk)
 {
-    return tbbt_end(root, RIGHT);
+    intn i;
+
+    for (i = 0; parent->u.inner.child[i] != blk; i++)
+        ;
+    return i;
 }
 
-/* Returns pointer to neighboring node (to LEFT or RIGHT): */
-static TBBT_NODE *
-tbbt_nbr(TBBT_NODE *ptr, int side)
+/* Copies the smallest key below the i'th child of an inner block into it */
+static void
+tbbt_set_min(TBBT_BLOCK *blk, intn i)
+{
+    TBBT_BLOCK *child = blk->u.inner.child[i];
+
+    blk->u.inner.key[i] = child->leaf ? child->u.item[0].key : child->u.inner.key[0];
+    blk->fkey[i]        = child->fkey[0];
+}
+
+/* Passes a change of the smallest key of a block up the tree */
+static void
+tbbt_fix_min(TBBT_BLOCK *blk)
 {
-    /* return( *tbbt_anbr(ptr,side) ); */
+    TBBT_BLOCK *parent;
+    intn        i;
 
-    if (!HasChild(ptr, side))
-        return ptr->Link[side];
-    /*        return NULL; */
-    ptr = ptr->Link[side];
-    if (ptr == NULL)
+    while (NULL != (parent = blk->parent)) {
+        i = tbbt_child_index(parent, blk);
+        tbbt_set_min(parent, i);
+        if (i != 0)
+            break;
+        blk = parent;
+    }
+}
+
+/* Points the users' root of a tree at its first node */
+static void
+tbbt_set_root(TBBT_TREE_PRIV *tree)
+{
+    *tree->rootp = (NULL != tree->first) ? &tree->first->u.item[0] : NULL;
+}
+
+/* Returns pointer to the node with the smallest key of the tree holding
+ * `root' (or NULL): */
+TBBT_NODE *
+tbbtfirst(TBBT_NODE *root)
+{
+    if (root == NULL)
         return NULL;
-    while (HasChild(ptr, Other(side)))
-        ptr = ptr->Link[Other(side)];
-    return ptr;
+    return &root->priv->tree->first->u.item[0];
 }
 
-/* Returns pointer to node with previous key value: */
+/* Returns pointer to the node with the largest key of the tree holding
+ * `root' (or NULL): */
 TBBT_NODE *
-tbbtnext(TBBT_NODE *node)
+tbbtlast(TBBT_NODE *root)
 {
-    return tbbt_nbr(node, RIGHT);
+    TBBT_BLOCK *last;
+
+    if (root == NULL)
+        return NULL;
+    last = root->priv->tree->last;
+    return &last->u.item[last->nitems - 1];
 }
 
 /* Returns pointer to node with next key value: */
 TBBT_NODE *
-tbbtprev(TBBT_NODE *node)
+tbbtnext(TBBT_NODE *node)
 {
-    return tbbt_nbr(node, LEFT);
+    TBBT_BLOCK *leaf = node->priv;
+
+    if (node < &leaf->u.item[leaf->nitems - 1])
+        return node + 1;
+    return (NULL != leaf->next) ? &leaf->next->u.item[0] : NULL;
 }
 
-/* tbbtfind -- Look up a node in a tree based on a key value */
-/* tbbtffind is based on this routine - fix bugs in both places! */
-/* Returns a pointer to the found node (or NULL) */
+/* Returns pointer to node with previous key value: */
 TBBT_NODE *
-tbbtfind(TBBT_NODE *root, void *key, int (*compar)(void *, void *, int), int arg, TBBT_NODE **pp)
+tbbtprev(TBBT_NODE *node)
 {
-    TBBT_NODE *ptr    = root;
-    TBBT_NODE *parent = NULL;
-    int        cmp    = 1;
+    TBBT_BLOCK *leaf = node->priv;
 
-    if (ptr) {
-        int side;
-
-        while (0 != (cmp = KEYcmp(key, ptr->key, arg))) {
-            parent = ptr;
-            side   = (cmp < 0) ? LEFT : RIGHT;
-            if (!HasChild(ptr, side))
-                break;
-            ptr = ptr->Link[side];
-        }
-    }
-    if (NULL != pp)
-        *pp = parent;
-    return (0 == cmp) ? ptr : NULL;
+    if (node > &leaf->u.item[0])
+        return node - 1;
+    return (NULL != leaf->prev) ? &leaf->prev->u.item[leaf->prev->nitems - 1] : NULL;
 }
 
-/* tbbtffind -- Look up a node in a tree based on a key value */
-/* This routine is based on tbbtfind (fix bugs in both places!) */
-/* Returns a pointer to the found node (or NULL) */
+/* tbbt_lookup -- Look up a node in a tree based on a key value */
+/* Returns a pointer to the found node (or NULL).  If `before' is not NULL,
+ * it is set to the node with the largest key less than `k' (or NULL) */
 static TBBT_NODE *
-tbbtffind(TBBT_NODE *root, void *key, unsigned fast_compare, TBBT_NODE **pp)
+tbbt_lookup(TBBT_TREE_PRIV *tree, const TBBT_KEY *k, TBBT_NODE **before)
 {
-    TBBT_NODE *ptr    = root;
-    TBBT_NODE *parent = NULL;
-    int        cmp    = 1;
+    TBBT_BLOCK *leaf;
+    intn        pos;
+    int         cmp;
 
-    switch (fast_compare) {
-        case TBBT_FAST_UINT16_COMPARE:
-            if (ptr) {
-                int side;
-
-                while (0 != (cmp = (*(uint16 *)key - *(uint16 *)ptr->key))) {
-                    parent = ptr;
-                    side   = (cmp < 0) ? LEFT : RIGHT;
-                    if (!HasChild(ptr, side))
-                        break;
-                    ptr = ptr->Link[side];
-                }
-            }
-            if (NULL != pp)
-                *pp = parent;
-            return (0 == cmp) ? ptr : NULL;
+    if (NULL != before)
+        *before = NULL;
+    if (tree == NULL || tree->top == NULL)
+        return NULL;
 
-        case TBBT_FAST_INT32_COMPARE:
-            if (ptr) {
-                int side;
-
-                while (0 != (cmp = (*(int32 *)key - *(int32 *)ptr->key))) {
-                    parent = ptr;
-                    side   = (cmp < 0) ? LEFT : RIGHT;
-                    if (!HasChild(ptr, side))
-                        break;
-                    ptr = ptr->Link[side];
-                }
-            }
-            if (NULL != pp)
-                *pp = parent;
-            return (0 == cmp) ? ptr : NULL;
+    leaf = tbbt_descend(k, tree->top);
+    pos  = tbbt_search(k, leaf, &cmp);
+    if (NULL != before)
+        *before = (pos > 0) ? &leaf->u.item[pos - 1] : tbbtprev(&leaf->u.item[0]);
+    return (0 == cmp) ? &leaf->u.item[pos] : NULL;
+}
 
-        default:
-            return NULL;
-    } /* end switch */
-} /* tbbtffind() */
+/* tbbtfind -- Look up a node in a tree based on a key value */
+/* Returns a pointer to the found node (or NULL) */
+TBBT_NODE *
+tbbtfind(TBBT_NODE *root, void *key, int (*compar)(void *, void *, int), int arg, TBBT_NODE **pp)
+{
+    TBBT_KEY k;
+
+    if (root == NULL) {
+        if (NULL != pp)
+            *pp = NULL;
+        return NULL;
+    }
+    tbbt_make_key(&k, key, 0, compar, arg);
+    return tbbt_lookup(root->priv->tree, &k, pp);
+}
 
 /* tbbtdfind -- Look up a node in a "described" tree based on a key value */
 /* Returns a pointer to the found node (or NULL) */
 TBBT_NODE *
 tbbtdfind(TBBT_TREE *tree, void *key, TBBT_NODE **pp)
 {
+    TBBT_KEY k;
+
     if (tree == NULL)
         return NULL;
-    if (tree->Fast_compare != 0)
-        return tbbtffind(tree->root, key, tree->Fast_compare, pp);
-    else
-        return tbbtfind(tree->root, key, tree->Compar, tree->Cmparg, pp);
+    tbbt_make_key(&k, key, tree->Fast_compare, tree->Compar, tree->Cmparg);
+    return tbbt_lookup(tree->priv, &k, pp);
 }
 
-/* tbbtless -- Find a node in a tree which is less than a key, */
-/*  based on a key value */
+/* tbbtless -- Find the node of a tree with the largest key which is less
+ *  than or equal to a key value */
 /* Returns a pointer to the found node (or NULL) */
 TBBT_NODE *
 tbbtless(TBBT_NODE *root, void *key, int (*compar)(void *, void *, int), int arg, TBBT_NODE **pp)
 {
-    TBBT_NODE *ptr    = root;
-    TBBT_NODE *parent = NULL;
-    int        cmp    = 1;
+    TBBT_KEY   k;
+    TBBT_NODE *before, *ptr;
 
-    if (ptr) {
-        int side;
-
-        while (0 != (cmp = KEYcmp(key, ptr->key, arg))) {
-            parent = ptr;
-            side   = (cmp < 0) ? LEFT : RIGHT;
-            if (!HasChild(ptr, side))
-                break;
-            ptr = ptr->Link[side];
-        }
+    if (root == NULL) {
+        if (NULL != pp)
+            *pp = NULL;
+        return NULL;
     }
-    if (cmp != 0)
-    /* didn't find an exact match, search back up the tree until a node */
-    /* is found with a key less than the key searched for */
-    {
-        while ((ptr = ptr->Parent) != NULL) {
-            cmp = KEYcmp(key, ptr->key, arg);
-            if (cmp < 0) /* found a node which is less than the search for one */
-                break;
-        }                /* end while */
-        if (ptr == NULL) /* didn't find a node in the tree which was less */
-            cmp = 1;
-        else /* reset this for cmp test below */
-            cmp = 0;
-    } /* end if */
+    tbbt_make_key(&k, key, 0, compar, arg);
+    if (NULL == (ptr = tbbt_lookup(root->priv->tree, &k, &before)))
+        ptr = before;
     if (NULL != pp)
-        *pp = parent;
-    return (0 == cmp) ? ptr : NULL;
+        *pp = before;
+    return ptr;
 }
 
 /* tbbtdless -- Find a node less than a key in a "described" tree */
@@ -295,9 +363,17 @@ tbbtless(TBBT_NODE *root, void *key, int (*compar)(void *, void *, int), int arg
 TBBT_NODE *
 tbbtdless(TBBT_TREE *tree, void *key, TBBT_NODE **pp)
 {
+    TBBT_KEY   k;
+    TBBT_NODE *before, *ptr;
+
     if (tree == NULL)
         return NULL;
-    return tbbtless(tree->root, key, tree->Compar, tree->Cmparg, pp);
+    tbbt_make_key(&k, key, tree->Fast_compare, tree->Compar, tree->Cmparg);
+    if (NULL == (ptr = tbbt_lookup(tree->priv, &k, &before)))
+        ptr = before;
+    if (NULL != pp)
+        *pp = before;
+    return ptr;
 }
 
 /* tbbtindx -- Look up the Nth node (in key order) */
@@ -305,262 +381,219 @@ tbbtdless(TBBT_TREE *tree, void *key, TBBT_NODE **pp)
 TBBT_NODE *
 tbbtindx(TBBT_NODE *root, int32 indx)
 {
-    TBBT_NODE *ptr = root;
+    TBBT_TREE_PRIV *tree;
+    TBBT_BLOCK     *blk;
+    unsigned long   left;
+    intn            i;
 
-    /* I believe indx is 1 based */
-    if (NULL == ptr || indx < 1)
+    /* indx is 1 based */
+    if (NULL == root || indx < 1)
         return NULL;
-    /* Termination condition is if the index equals the number of children on
-       out left plus the current node */
-    while (ptr != NULL && indx != ((int32)LeftCnt(ptr)) + 1) {
-        if (indx <= (int32)LeftCnt(ptr)) {
-            ptr = ptr->Lchild;
-        }
-        else if (HasChild(ptr, RIGHT)) { /* subtract children count from leftchild plus current node when
-                                            we descend into a right branch */
-            indx -= (int32)(LeftCnt(ptr) + 1);
-            ptr = ptr->Rchild;
-        }
-        else
-            return NULL; /* Only `indx' or fewer nodes in tree */
-    }
-    return ptr;
+    tree = root->priv->tree;
+    if ((unsigned long)indx > tree->count)
+        return NULL; /* Only `indx' or fewer nodes in tree */
+
+    /* Go down the children holding the node, counting off the nodes of the
+       children before them */
+    left = (unsigned long)indx - 1;
+    for (blk = tree->top; !blk->leaf; blk = blk->u.inner.child[i])
+        for (i = 0; left >= blk->u.inner.child[i]->count; i++)
+            left -= blk->u.inner.child[i]->count;
+    return &blk->u.item[left];
 }
 
-/* swapkid -- Often referred to as "rotating" nodes.  ptr and ptr's `side'
- * child, kid, are swapped so ptr becomes kid's `Other(side)' child.
- * Here is how a single swap (rotate) works:
- *
- *           |           --side-->         |
- *         (ptr)                         (kid)
- *        /     \                       /     \
- *    +-A-+    (kid)                 (ptr)    +-C-+
- *    |   |   /     \               /     \   |   |
- *    |...| +-B-+  +-C-+         +-A-+  +-B-+ |...|
- *          |   |  |   |         |   |  |   |
- *          |...|  |...|         |...|  |...|
- * `deep' contains the relative depths of the subtrees so, since we set
- * `deep[1]' (the relative depth of subtree [B]) to 0, `deep[2]' is the depth
- * of [C] minus the depth of [B] (-1, 0, or 1 since `kid' is never too out of
- * balance) and `deep[0]' is the depth of [A] minus the depth of [B].  These
- * values are used to compute the balance levels after the rotation.  Note that
- * [A], [B], or [C] can have depth 0 so `link[]' contains threads rather than
- * pointers to children.
- */
-static TBBT_NODE *
-swapkid(TBBT_NODE **root, TBBT_NODE *ptr, int side)
-{
-    TBBT_NODE *kid = ptr->Link[side]; /* Sibling to be swapped with parent */
-    int        deep[3];               /* Relative depths of three sub-trees involved. */
-    /* 0:ptr->Link[Other(side)], 1:kid->Link[Other(side)], 2:kid->Link[side] */
-    TBBT_FLAG ptrflg;       /* New value for ptr->Flags (ptr->Flags used after set) */
-    TBBT_LEAF plcnt, prcnt, /* current values of the ptr's and kid's leaf count */
-        klcnt, krcnt;
-
-    deep[2]     = (deep[1] = 0) + Delta(kid, side);
-    deep[0]     = Max(0, deep[2]) + 1 - Delta(ptr, side);
-    kid->Parent = ptr->Parent;
-    ptrflg =
-        (TBBT_FLAG)SetFlags(ptr, side, deep[0], HasChild(ptr, Other(side)) && HasChild(kid, Other(side)));
-    plcnt = LeftCnt(ptr);
-    prcnt = RightCnt(ptr);
-    klcnt = LeftCnt(kid);
-    krcnt = RightCnt(kid);
-    if (HasChild(kid, Other(side))) {
-        ptr->Link[side]         = kid->Link[Other(side)]; /* Real child */
-        ptr->Link[side]->Parent = ptr;
-    }
-    else {
-        ptr->Link[side] = kid; /* Thread */
-    }
-    /* Update grand parent's pointer: */
-    if (NULL == ptr->Parent) {
-        *root = kid;
-    }
-    else if (ptr /*->Lchild*/ == ptr->Parent->Lchild) {
-        ptr->Parent->Lchild = kid;
-    }
-    else {
-        ptr->Parent->Rchild = kid;
-    }
-    ptr->Parent            = kid;
-    kid->Link[Other(side)] = ptr;
-    kid->Flags = (TBBT_FLAG)SetFlags(kid, Other(side), deep[2] - 1 - Max(deep[0], 0), HasChild(kid, side));
-
-    /* update leaf counts */
-    if (side == LEFT) {                /* kid's left count doesn't change, nor ptr's r-count */
-        kid->Rcnt = prcnt + krcnt + 1; /* kid's leafs+former parent's leafs+parent */
-        ptr->Lcnt = krcnt;
-    }                                  /* end if */
-    else {                             /* kid's right count doesn't change, nor ptr's l-count */
-        kid->Lcnt = plcnt + klcnt + 1; /* kid's leafs+former parent's leafs+parent */
-        ptr->Rcnt = klcnt;
+/* tbbt_add_child -- Put `right', just split off from `blk', next to it in
+ * the parent of `blk', splitting the parent too if it is full; the blocks
+ * needed are taken from `spare' */
+static void
+tbbt_add_child(TBBT_TREE_PRIV *tree, TBBT_BLOCK *blk, TBBT_BLOCK *right, TBBT_BLOCK **spare)
+{
+    TBBT_BLOCK *parent = blk->parent;
+    TBBT_BLOCK *other;
+    intn        i;
+    size_t      n;
+
+    if (parent == NULL) { /* `blk' was the top block; grow the tree */
+        parent                   = *spare;
+        *spare                   = parent->parent;
+        parent->parent           = NULL;
+        parent->leaf             = FALSE;
+        parent->nitems           = 2;
+        parent->count            = blk->count + right->count;
+        parent->u.inner.child[0] = blk;
+        parent->u.inner.child[1] = right;
+        blk->parent              = parent;
+        right->parent            = parent;
+        tbbt_set_min(parent, 0);
+        tbbt_set_min(parent, 1);
+        tree->top = parent;
+        return;
     } /* end if */
-    ptr->Flags = ptrflg;
-    return kid;
+
+    i = tbbt_child_index(parent, blk) + 1;
+    if (parent->nitems == TBBT_FANOUT) {
+        other = tbbt_split(tree, parent, spare);
+        if (i > parent->nitems) { /* the nodes of `right' move to the new block */
+            i -= parent->nitems;
+            parent->count -= right->count;
+            other->count += right->count;
+            parent = other;
+        } /* end if */
+    }     /* end if */
+
+    n = (size_t)(parent->nitems - i);
+    memmove(&parent->u.inner.child[i + 1], &parent->u.inner.child[i], n * sizeof(TBBT_BLOCK *));
+    memmove(&parent->u.inner.key[i + 1], &parent->u.inner.key[i], n * sizeof(void *));
+    memmove(&parent->fkey[i + 1], &parent->fkey[i], n * sizeof(int32));
+    parent->u.inner.child[i] = right;
+    right->parent            = parent;
+    parent->nitems++;
+    tbbt_set_min(parent, i);
 }
 
-/* balance -- Move up tree, incrimenting number of left children when needed
- * and looking for unbalanced ancestors.  Adjust all balance factors and re-
- * balance through "rotation"s when needed.
- */
-static void
-balance(TBBT_NODE **root, TBBT_NODE *ptr, int side, int added)
-{
-    int deeper = added; /* 1 if sub-tree got longer; -1 if got shorter */
-    int odelta;
-    int obal;
-
-    while (NULL != ptr) {
-        odelta = Delta(ptr, side); /* delta before the node was added */
-        obal   = UnBal(ptr);
-        if (LEFT == side) /* One more/fewer left child: */
-            if (0 < added)
-                ptr->Lcnt++; /* LeftCnt(ptr)++ */
-            else
-                ptr->Lcnt--; /* LeftCnt(ptr)-- */
-        else if (0 < added)
-            ptr->Rcnt++; /* RightCnt(ptr)++ */
+/* tbbt_split -- Move the upper half of a full block into a new block, taken
+ * from `spare', and put it next to the block */
+/* Returns the new block */
+static TBBT_BLOCK *
+tbbt_split(TBBT_TREE_PRIV *tree, TBBT_BLOCK *blk, TBBT_BLOCK **spare)
+{
+    TBBT_BLOCK *right = *spare;
+    intn        half  = TBBT_FANOUT / 2;
+    intn        n     = TBBT_FANOUT - half;
+    intn        i;
+
+    *spare        = right->parent;
+    right->parent = NULL;
+    right->leaf   = blk->leaf;
+    right->nitems = n;
+    memcpy(right->fkey, &blk->fkey[half], (size_t)n * sizeof(int32));
+    if (blk->leaf) {
+        memcpy(right->u.item, &blk->u.item[half], (size_t)n * sizeof(TBBT_NODE));
+        for (i = 0; i < n; i++)
+            right->u.item[i].priv = right;
+        right->count = (unsigned long)n;
+
+        right->prev = blk;
+        right->next = blk->next;
+        if (NULL != blk->next)
+            blk->next->prev = right;
         else
-            ptr->Rcnt--;   /* RightCnt(ptr)-- */
-        if (0 != deeper) { /* One leg got longer or shorter: */
-            if ((deeper < 0 && odelta < 0) || (deeper > 0 && odelta > 0)) { /* Became too unbalanced: */
-                TBBT_NODE *kid;
-
-                ptr->Flags |= TBBT_DOUBLE; /* Mark node too unbalanced */
-                if (deeper < 0)            /* Just removed a node: */
-                    side = Other(side);    /* Swap with child from other side. */
-                else
-                    /* Just inserted a node: */ if (ptr->Parent && UnBal(ptr->Parent)) {
-                        deeper = 0; /* Fix will re-shorten sub-tree. */
-                    }
-                kid = ptr->Link[side];
-                if (Heavy(kid, Other(side))) { /* Double rotate needed: */
-                    kid = swapkid(root, kid, Other(side));
-                    ptr = swapkid(root, ptr, side);
-                }
-                else {                       /* Just rotate parent and kid: */
-                    if (HasChild(kid, side)) /* In this case, sub-tree gets */
-                        if (ptr->Parent && UnBal(ptr->Parent)) {
-                            deeper = 0; /* re-lengthened after a node removed. */
-                        }
-                    ptr = swapkid(root, ptr, side);
-                }
-            }
-            else if (obal) { /* Just became balanced: */
-                ptr->Flags &= ~TBBT_UNBAL;
-                if (0 < deeper) {              /* Shorter of legs lengthened */
-                    ptr->Flags |= TBBT_INTERN; /* Mark as internal node now */
-                    deeper = 0;                /* so max length unchanged */
-                }                              /* end if */
-            }
-            else if (deeper < 0) { /* Just became unbalanced: */
-                if (ptr->Link[Other(side)] != NULL && ptr->Link[Other(side)]->Parent == ptr) {
-                    ptr->Flags |= (TBBT_FLAG)TBBT_HEAVY(Other(side)); /* Other side longer */
-                    if (ptr->Parent)
-                        if (ptr->Parent->Rchild == ptr) { /* we're the right child */
-                            if (Heavy(ptr->Parent, RIGHT) && LeftCnt(ptr->Parent) == 1)
-                                deeper = 0;
-                            else
-                                /* we're the left child */ if (Heavy(ptr->Parent, LEFT))
-                                    if (ptr->Parent->Rchild && !UnBal(ptr->Parent->Rchild))
-                                        deeper = 0;
-                        }
+            tree->last = right;
+        blk->next = right;
+    } /* end if */
+    else {
+        memcpy(right->u.inner.key, &blk->u.inner.key[half], (size_t)n * sizeof(void *));
+        memcpy(right->u.inner.child, &blk->u.inner.child[half], (size_t)n * sizeof(TBBT_BLOCK *));
+        right->count = 0;
+        for (i = 0; i < n; i++) {
+            right->u.inner.child[i]->parent = right;
+            right->count += right->u.inner.child[i]->count;
+        } /* end for */
+    }     /* end else */
+    blk->nitems = half;
+    blk->count -= right->count;
+
+    tbbt_add_child(tree, blk, right, spare);
+    return right;
+}
+
+/* tbbt_insert -- Insert a node into a tree */
+/* Returns pointer to inserted node (or NULL) */
+static TBBT_NODE *
+tbbt_insert(TBBT_TREE_PRIV *tree, void *item, void *key)
+{
+    TBBT_KEY    k;
+    TBBT_BLOCK *leaf, *blk;
+    TBBT_BLOCK *spare = NULL; /* Blocks for the splits, linked through `parent' */
+    TBBT_NODE  *node;
+    intn        pos = 0;
+    intn        nspare;
+    int         cmp;
+
+    if (key == NULL)
+        key = item;
+    tbbt_make_key(&k, key, tree->fast_compare, tree->compar, tree->cmparg);
+
+    if (tree->top == NULL) {
+        if (NULL == (leaf = tbbt_get_block(tree)))
+            return NULL;
+        leaf->leaf = TRUE;
+        tree->top = tree->first = tree->last = leaf;
+    } /* end if */
+    else {
+        leaf = tbbt_descend(&k, tree->top);
+        pos  = tbbt_search(&k, leaf, &cmp);
+        if (0 == cmp)
+            return NULL; /* `key' is already in the tree */
+    }                    /* end else */
+
+    if (leaf->nitems == TBBT_FANOUT) {
+        /* Get all the blocks the splits need first, so that running out of
+           memory leaves the tree as it was: one for each full block on the
+           way up, and one more if the top block is full */
+        for (blk = leaf, nspare = 0; blk != NULL && blk->nitems == TBBT_FANOUT; blk = blk->parent)
+            nspare++;
+        if (blk == NULL)
+            nspare++;
+        for (; nspare > 0; nspare--) {
+            if (NULL == (blk = tbbt_get_block(tree))) {
+                while (NULL != (blk = spare)) {
+                    spare = blk->parent;
+                    tbbt_release_block(blk);
                 }
-            }
-            else {                                         /* Just became unbalanced: */
-                ptr->Flags |= (TBBT_FLAG)TBBT_HEAVY(side); /* 0<deeper: Our side longer */
-            }                                              /* end else */
-        }
-        if (ptr->Parent) {
-            if (ptr == (ptr->Parent->Rchild))
-                side = RIGHT;
-            else
-                side = LEFT;
-        }                  /* end if */
-        ptr = ptr->Parent; /* Move up the tree */
-    }
-    /* total tree depth += deeper; */
-}
-/* Here is how rotatation rebalances a tree:
- * Either the deletion of a node shortened the sub-tree [A] (to length `h')
- * while [B] or [C] or both are length `h+1'  or  the addition of a node
- * lengthened [B] or [C] to length `h+1' while the other and [A] are both
- * length `h'.  Each case changes `ptr' from being "right heavy" to being
- * overly unbalanced.
- * This           |                      Becomes:      |
- * sub-tree:    (ptr)                                (kid)
- *             /     \          --side-->           /     \
- *         +-A-+    (kid)                        (ptr)   +-C-+
- *         |   |   /     \                      /     \  |   |
- *         | h | +-B-+  +-C-+               +-A-+  +-B-+ | h |
- *         |   | |   |  |   |               |   |  |   | |   |
- *         +---+ | h |  | h |               | h |  | h | +---+
- *         : - : |   |  |   |               |   |  |   | : 1 :
- *         `- -' +---+  +---+               +---+  +---+ + - +
- *               : 1 :  : 1 :                      : 1 :
- *               + - +  + - +                      + - +
- *
- * However, if [B] is long (h+1) while [C] is short (h), a double rotate is
- * required to rebalance.  In this case, [A] was shortened or [X] or [Y] was
- * lengthened so [A] is length `h' and one of [X] and [Y] is length `h' while
- * the other is length `h-1'.  Swap `kid' with `babe' then `ptr' with `babe'.
- * This          |                         Becomes:     |
- * sub-tree:   (ptr)                                  (babe)
- *            /     \             --side-->          /      \
- *       +-A-+       (kid)                      (ptr)       (kid)
- *       |   |      /     \                    /     \     /     \
- *       | h |    (babe)   +-C-+             +-A-+ +-X-+ +-Y-+ +-C-+
- *       |   |   /      \  |   |             |   | |h-1| |h-1| |   |
- *       +---+ +-X-+ +-Y-+ | h |             | h | +---+ +---+ | h |
- *       : - : |h-1| |h-1| |   |             |   | : 1 : : 1 : |   |
- *       `- -' +---+ +---+ +---+             +---+ + - + + - + +---+
- *             : 1 : : 1 :
- *             + - + + - +
- *
- * Note that in the node insertion cases total sub-tree length always increases
- * by one then decreases again so after the rotation(s) no more rebalancing is
- * required.  In the node removal cases, the single rotation reduces total sub-
- * tree length unless [B] is length `h+1' (`ptr' ends of "right heavy") while
- * the double rotation ALWAYS reduces total sub-tree length.  Thus removing a
- * single node can require log(N) rotations for rebalancing.  On average, only
- * are usually required.
- */
+                return NULL;
+            } /* end if */
+            blk->parent = spare;
+            spare       = blk;
+        } /* end for */
+
+        blk = tbbt_split(tree, leaf, &spare);
+        if (pos > leaf->nitems) {
+            pos -= leaf->nitems;
+            leaf = blk;
+        } /* end if */
+    }     /* end if */
+
+    memmove(&leaf->u.item[pos + 1], &leaf->u.item[pos], (size_t)(leaf->nitems - pos) * sizeof(TBBT_NODE));
+    memmove(&leaf->fkey[pos + 1], &leaf->fkey[pos], (size_t)(leaf->nitems - pos) * sizeof(int32));
+    node            = &leaf->u.item[pos];
+    node->data      = item;
+    node->key       = key;
+    node->priv      = leaf;
+    leaf->fkey[pos] = k.fast_key;
+    leaf->nitems++;
+
+    for (blk = leaf; blk != NULL; blk = blk->parent)
+        blk->count++;
+    tree->count++;
+    if (pos == 0)
+        tbbt_fix_min(leaf);
+    tbbt_set_root(tree);
+    return node;
+}
 
+/* tbbtins -- Insert an item into a tree not made by tbbtdmake() */
 /* Returns pointer to inserted node (or NULL) */
 TBBT_NODE *
 tbbtins(TBBT_NODE **root, void *item, void *key,
         int (*compar)(void * /* k1 */, void * /* k2 */, int /* arg */), int arg)
 {
-    int        cmp;
-    TBBT_NODE *ptr, *parent;
+    TBBT_TREE_PRIV *tree;
+    TBBT_NODE      *ret_value;
+
+    if (NULL != *root)
+        return tbbt_insert((*root)->priv->tree, item, key);
 
-    if (NULL != tbbtfind(*root, (key ? key : item), compar, arg, &parent) || NULL == (ptr = tbbt_get_node()))
+    /* The first node of the tree brings the private part of the tree */
+    if (NULL == (tree = (TBBT_TREE_PRIV *)calloc(1, sizeof(TBBT_TREE_PRIV))))
         return NULL;
-    ptr->data   = item;
-    ptr->key    = key ? key : item;
-    ptr->Parent = parent;
-    ptr->Flags  = 0L; /* No children on either side */
-    ptr->Lcnt   = 0;
-    ptr->Rcnt   = 0;
-    if (NULL == parent) { /* Adding first node to tree: */
-        *root       = ptr;
-        ptr->Lchild = ptr->Rchild = NULL;
-        return ptr;
-    }
-    cmp = KEYcmp(ptr->key, parent->key, arg);
-    if (cmp < 0) {
-        ptr->Lchild    = parent->Lchild; /* Parent's thread now new node's */
-        ptr->Rchild    = parent;         /* New nodes right thread is parent */
-        parent->Lchild = ptr;            /* Parent now has a left child */
-    }
-    else {
-        ptr->Rchild    = parent->Rchild;
-        ptr->Lchild    = parent;
-        parent->Rchild = ptr;
-    }
-    balance(root, parent, (cmp < 0) ? LEFT : RIGHT, 1);
-    return ptr;
+    tree->compar = compar;
+    tree->cmparg = arg;
+    tree->rootp  = root;
+    tree->bare   = TRUE;
+    if (NULL == (ret_value = tbbt_insert(tree, item, key)))
+        free(tree);
+    return ret_value;
 }
 
 /* tbbtdins -- Insert a node into a "described" tree */
@@ -568,14 +601,110 @@ tbbtins(TBBT_NODE **root, void *item, void *key,
 TBBT_NODE *
 tbbtdins(TBBT_TREE *tree, void *item, void *key)
 {
-    TBBT_NODE *ret_node; /* the node to return */
-
     if (tree == NULL)
         return NULL;
-    ret_node = tbbtins(&(tree->root), item, key, tree->Compar, tree->Cmparg);
-    if (ret_node != NULL)
-        tree->Count++;
-    return ret_node;
+    return tbbt_insert(tree->priv, item, key);
+}
+
+/* tbbt_remove_child -- Take the i'th child out of an inner block */
+static void
+tbbt_remove_child(TBBT_BLOCK *blk, intn i)
+{
+    size_t n = (size_t)(blk->nitems - i - 1);
+
+    memmove(&blk->u.inner.child[i], &blk->u.inner.child[i + 1], n * sizeof(TBBT_BLOCK *));
+    memmove(&blk->u.inner.key[i], &blk->u.inner.key[i + 1], n * sizeof(void *));
+    memmove(&blk->fkey[i], &blk->fkey[i + 1], n * sizeof(int32));
+    blk->nitems--;
+}
+
+/* tbbt_merge -- Merge a block which has few entries left with a neighbour
+ * under the same parent, when they fit in one block, and carry on with the
+ * parent */
+static void
+tbbt_merge(TBBT_TREE_PRIV *tree, TBBT_BLOCK *blk)
+{
+    TBBT_BLOCK *parent = blk->parent;
+    TBBT_BLOCK *left, *right;
+    intn        i, j;
+
+    if (parent == NULL || blk->nitems > TBBT_MERGE)
+        return;
+
+    i = tbbt_child_index(parent, blk);
+    if (i + 1 < parent->nitems && blk->nitems + parent->u.inner.child[i + 1]->nitems <= TBBT_MERGE_MAX)
+        left = blk;
+    else if (i > 0 && parent->u.inner.child[i - 1]->nitems + blk->nitems <= TBBT_MERGE_MAX)
+        left = parent->u.inner.child[--i];
+    else
+        return;
+    right = parent->u.inner.child[i + 1];
+
+    /* Move the entries of the right block to the end of the left one */
+    memcpy(&left->fkey[left->nitems], right->fkey, (size_t)right->nitems * sizeof(int32));
+    if (left->leaf) {
+        memcpy(&left->u.item[left->nitems], right->u.item, (size_t)right->nitems * sizeof(TBBT_NODE));
+        for (j = 0; j < right->nitems; j++)
+            left->u.item[left->nitems + j].priv = left;
+
+        left->next = right->next;
+        if (NULL != right->next)
+            right->next->prev = left;
+        else
+            tree->last = left;
+    } /* end if */
+    else {
+        memcpy(&left->u.inner.key[left->nitems], right->u.inner.key, (size_t)right->nitems * sizeof(void *));
+        memcpy(&left->u.inner.child[left->nitems], right->u.inner.child,
+               (size_t)right->nitems * sizeof(TBBT_BLOCK *));
+        for (j = 0; j < right->nitems; j++)
+            right->u.inner.child[j]->parent = left;
+    } /* end else */
+    left->nitems += right->nitems;
+    left->count += right->count;
+    tbbt_release_block(right);
+
+    /* Take the right block out of the parent */
+    tbbt_remove_child(parent, i + 1);
+
+    tbbt_merge(tree, parent);
+}
+
+/* tbbt_drop -- Take a block with no entries left out of the tree */
+static void
+tbbt_drop(TBBT_TREE_PRIV *tree, TBBT_BLOCK *blk)
+{
+    TBBT_BLOCK *parent = blk->parent;
+    intn        i;
+
+    if (blk->leaf) {
+        if (NULL != blk->prev)
+            blk->prev->next = blk->next;
+        else
+            tree->first = blk->next;
+        if (NULL != blk->next)
+            blk->next->prev = blk->prev;
+        else
+            tree->last = blk->prev;
+    } /* end if */
+
+    if (parent == NULL) {
+        tree->top = NULL;
+        tbbt_release_block(blk);
+        return;
+    } /* end if */
+
+    i = tbbt_child_index(parent, blk);
+    tbbt_release_block(blk);
+    tbbt_remove_child(parent, i);
+
+    if (parent->nitems == 0)
+        tbbt_drop(tree, parent);
+    else {
+        if (i == 0)
+            tbbt_fix_min(parent);
+        tbbt_merge(tree, parent);
+    } /* end else */
 }
 
 /* tbbtrem -- Remove a node from a tree.  You pass in the address of the
@@ -592,110 +721,45 @@ tbbtdins(TBBT_TREE *tree, void *item, void *key)
 void *
 tbbtrem(TBBT_NODE **root, TBBT_NODE *node, void **kp)
 {
-    TBBT_NODE *leaf; /* Node with one or zero children */
-    TBBT_NODE *par;  /* Parent of `leaf' */
-    TBBT_NODE *next; /* Next/prev node near `leaf' (`leaf's `side' thread) */
-    int        side; /* `leaf' is `side' child of `par' */
-    void      *data; /* Saved pointer to data item of deleted node */
+    TBBT_TREE_PRIV *tree;
+    TBBT_BLOCK     *leaf, *blk;
+    intn            pos;
+    void           *data;
 
     if (NULL == root || NULL == node)
-        return NULL;   /* Argument couldn't find node to delete */
-    data = node->data; /* Save pointer to data item to be returned at end */
+        return NULL;
+    leaf = node->priv;
+    tree = leaf->tree;
+    pos  = (intn)(node - leaf->u.item);
+    data = node->data;
     if (NULL != kp)
         *kp = node->key;
-    /* If the node to be removed is "internal" (children on both sides), we
-     * replace it with it's previous (or next) node in the tree and delete that
-     * previous (next) node (which has one or no children) instead. */
-    if (Intern(node)) {           /* Replace with a non-internal node: */
-        if (Heavy(node, RIGHT)) { /* Pick "near-leaf" node from the */
-            side = LEFT;          /* heavier of the sub-trees. */
-        }
-        else if (Heavy(node, LEFT)) {
-            side = RIGHT;
-        }
-        else { /* If no sub-tree heavier, pick at "random" for "better */
-            side = (0x10 & *(short *)&node) ? LEFT : RIGHT; /* balance" */
-        }
-        leaf = tbbt_nbr(next = node, Other(side));
-        if (NULL == leaf)
-            return NULL; /* Badness */
-        par = leaf->Parent;
-        if (par == next) {      /* Case 2x: `node' had exactly 2 descendants */
-            side = Other(side); /* Transform this to Case 2 */
-            next = leaf->Link[side];
-        }
-        node->data = leaf->data;
-        node->key  = leaf->key;
-    }
-    else {           /* Node has one or zero children: */
-        leaf = node; /* Simply remove THIS node */
-        par  = leaf->Parent;
-        if (NULL == par) {           /* Case 3: Remove root (of 1- or 2-node tree) */
-            side = (int)UnBal(node); /* Which side root has a child on */
-            if (side) {              /* Case 3a: Remove root of 2-node tree: */
-                *root = leaf = node->Link[side];
-                leaf->Parent = leaf->Link[Other(side)] = NULL;
-                leaf->Flags                            = 0; /* No left children, balanced, not internal */
-            }
-            else { /* Case 3b: Remove last node of tree: */
-                *root = NULL;
-            } /* end else */
-            tbbt_release_node(node);
-            return data;
-        }
-        side = (par->Rchild == leaf) ? RIGHT : LEFT;
-        next = leaf->Link[side];
-    }
-    /* Now the deletion has been reduced to the following cases (and Case 3 has
-     * been handled completely above and Case 2x has been transformed into
-     * Case 2).  `leaf' is a node with one or zero children that we are going
-     * to remove.  `next' points where the `side' thread of `leaf' points.
-     * `par' is the parent of `leaf'.  The only possibilities (not counting
-     * left/right reversals) are shown below:
-     *       [Case 1]                  [Case 2]              [Case 2x]
-     *            (next)                 (next)         ^         (next & par)
-     *           /  ^   \               /  ^   \        |        /  ^         \
-     *     . . .    |             . . .    |            |  (leaf)   /
-     *   /          |           /          |            \_/      \_/
-     * (par)        |         (par)        |             ^threads^
-     *      \       |              \       |
-     *     (leaf)   /             (leaf)   /            [Case 3a]    [Case 3b]
-     *    /  ^   \_/<thread             \_/<thread       (root)
-     * (n)   /                                                 \       (root)
-     *    \_/<thread        --"side"-->                         (n)
-     * Note that in Cases 1 and 2, `leaf's `side' thread can be NULL making
-     * `next' NULL as well.  If you remove a node from a 2-node tree, removing
-     * the root falls into Case 3a while removing the only leaf falls into
-     * Case 2 (with `next' NULL and `par' the root node). */
-    if (!UnBal(leaf)) { /* Case 2: `leaf' has no children: */
-        par->Link[side] = leaf->Link[side];
-        par->Flags &= (TBBT_FLAG)(~(TBBT_INTERN | TBBT_HEAVY(side)));
-    }
-    else { /* Case 1: `leaf' has one child: */
-        TBBT_NODE *n;
-
-        if (HasChild(leaf, side)) { /* two-in-a-row cases */
-            n               = leaf->Link[side];
-            par->Link[side] = n;
-            n->Parent       = par;
-            if (HasChild(n, Other(side)))
-                while (HasChild(n, Other(side)))
-                    n = n->Link[Other(side)];
-            n->Link[Other(side)] = par;
-        }      /* end if */
-        else { /* zig-zag cases */
-            n               = leaf->Link[Other(side)];
-            par->Link[side] = n;
-            n->Parent       = par;
-            if (HasChild(n, side))
-                while (HasChild(n, side))
-                    n = n->Link[side];
-            n->Link[side] = next;
-        } /* end else */
-    }
-    tbbt_release_node(leaf);
-    balance(root, par, side, -1);
-    ((TBBT_TREE *)root)->Count--;
+
+    leaf->nitems--;
+    memmove(&leaf->u.item[pos], &leaf->u.item[pos + 1], (size_t)(leaf->nitems - pos) * sizeof(TBBT_NODE));
+    memmove(&leaf->fkey[pos], &leaf->fkey[pos + 1], (size_t)(leaf->nitems - pos) * sizeof(int32));
+    for (blk = leaf; blk != NULL; blk = blk->parent)
+        blk->count--;
+    tree->count--;
+
+    if (leaf->nitems == 0)
+        tbbt_drop(tree, leaf);
+    else {
+        if (pos == 0)
+            tbbt_fix_min(leaf);
+        tbbt_merge(tree, leaf);
+    } /* end else */
+
+    /* Lower the tree while its top block has a single child */
+    while (NULL != (blk = tree->top) && !blk->leaf && blk->nitems == 1) {
+        tree->top         = blk->u.inner.child[0];
+        tree->top->parent = NULL;
+        tbbt_release_block(blk);
+    } /* end while */
+
+    tbbt_set_root(tree);
+    if (tree->bare && tree->count == 0)
+        free(tree);
     return data;
 }
 
@@ -716,6 +780,7 @@ tbbtdmake(int (*cmp)(void * /* k1 */, void * /* k2 */, int /* arg */), int arg,
     tree->Fast_compare = fast_compare;
     tree->Compar       = cmp;
     tree->Cmparg       = arg;
+    tree->priv->rootp  = &tree->root;
 
     return tree;
 error:
@@ -725,43 +790,68 @@ error:
     return NULL;
 }
 
+/* tbbtdmake_arena - Allocate a new tree description record for an empty tree
+ * whose blocks come from an arena */
+/* Returns a pointer to the description record */
+TBBT_TREE *
+tbbtdmake_arena(arena_p arena, int (*cmp)(void * /* k1 */, void * /* k2 */, int /* arg */), int arg,
+                unsigned fast_compare)
+{
+    TBBT_ARENA_TREE *atree;
+    TBBT_TREE       *tree;
+
+    if (NULL == (atree = (TBBT_ARENA_TREE *)ARcalloc(arena, sizeof(TBBT_ARENA_TREE))))
+        return NULL;
+    tree       = &atree->tree;
+    tree->priv = &atree->priv;
+
+    tree->root         = NULL;
+    tree->Count        = 0;
+    tree->Fast_compare = fast_compare;
+    tree->Compar       = cmp;
+    tree->Cmparg       = arg;
+    tree->Arena        = arena;
+    tree->priv->rootp  = &tree->root;
+
+    return tree;
+}
+
+/* Calls the free routines for the nodes below a block, and frees the blocks */
+static void
+tbbt_free_block(TBBT_BLOCK *blk, void (*fd)(void * /* item */), void (*fk)(void * /* key */))
+{
+    intn i;
+
+    for (i = 0; i < blk->nitems; i++)
+        if (!blk->leaf)
+            tbbt_free_block(blk->u.inner.child[i], fd, fk);
+        else {
+            if (NULL != fd)
+                (*fd)(blk->u.item[i].data);
+            if (NULL != fk)
+                (*fk)(blk->u.item[i].key);
+        } /* end else */
+    tbbt_release_block(blk);
+}
+
 /* tbbtfree() - Free an entire tree not allocated with tbbtdmake(). */
 void
 tbbtfree(TBBT_NODE **root, void (*fd)(void * /* item */), void (*fk)(void * /* key */))
 {
-    TBBT_NODE *par, *node = *root;
-
-    while (NULL != *root) { /* While nodes left to be free()d */
-        /* First time at this node (just moved down a new leg of tree) */
-        if (!HasChild(node, LEFT))
-            node->Lchild = NULL;
-        if (!HasChild(node, RIGHT))
-            node->Rchild = NULL;
-        do {
-            par = NULL; /* Assume we aren't ready to move up tree yet */
-            if (NULL != node->Lchild)
-                node = node->Lchild; /* Move down this leg next */
-            else if (NULL != node->Rchild)
-                node = node->Rchild; /* Move down this leg next */
-            else {                   /* No children; free node an move up: */
-                par = node->Parent;  /* Move up tree (stay in loop) */
-                if (NULL != fd)
-                    (*fd)(node->data);
-                if (NULL != fk)
-                    (*fk)(node->key);
-                if (NULL == par)  /* Just free()d last node */
-                    *root = NULL; /* NULL=par & NULL=*root gets fully out */
-                else if (node == par->Lchild)
-                    par->Lchild = NULL; /* Now no longer has this child */
-                else
-                    par->Rchild = NULL; /* Ditto */
-
-                tbbt_release_node(node);
-
-                node = par; /* Move up tree; remember which node to do next */
-            }
-        } while (NULL != par); /* While moving back up tree */
-    }
+    TBBT_TREE_PRIV *tree;
+
+    if (NULL == *root)
+        return;
+    tree = (*root)->priv->tree;
+
+    tbbt_free_block(tree->top, fd, fk);
+    tree->top   = NULL;
+    tree->first = NULL;
+    tree->last  = NULL;
+    tree->count = 0;
+    *root       = NULL;
+    if (tree->bare)
+        free(tree);
 }
 
 void
@@ -769,46 +859,45 @@ tbbtprint(TBBT_NODE *node)
 {
     if (node == NULL)
         return;
-    printf("node=%p, key=%p, data=%p, flags=%x\n", (void *)node, node->key, node->data,
-           (unsigned)node->Flags);
-    printf("Lcnt=%d, Rcnt=%d\n", (int)node->Lcnt, (int)node->Rcnt);
+    printf("node=%p, key=%p, data=%p\n", (void *)node, node->key, node->data);
     printf("*key=%d\n", (int)*(int32 *)(node->key));
-    printf("Lchild=%p, Rchild=%p, Parent=%p\n", (void *)node->Lchild, (void *)node->Rchild,
-           (void *)node->Parent);
+    printf("block=%p, position=%d\n", (void *)node->priv, (int)(node - node->priv->u.item));
 } /* end tbbtprint() */
 
+/* Prints a block */
+static void
+tbbt_print_block(TBBT_BLOCK *blk)
+{
+    printf("block=%p, %s, nitems=%d, count=%lu, parent=%p\n", (void *)blk, blk->leaf ? "leaf" : "inner",
+           (int)blk->nitems, blk->count, (void *)blk->parent);
+} /* end tbbt_print_block() */
+
+/* Prints the blocks below a block and their nodes, with tbbt_printNode()
+ * and `key_dump' if `plain' is FALSE, or with tbbtprint() */
+static void
+tbbt_dump_block(TBBT_BLOCK *blk, void (*key_dump)(void *, void *), int method, intn plain)
+{
+    intn i;
+
+    if (method == -1) /* Pre-Order Traversal */
+        tbbt_print_block(blk);
+    for (i = 0; i < blk->nitems; i++)
+        if (!blk->leaf)
+            tbbt_dump_block(blk->u.inner.child[i], key_dump, method, plain);
+        else if (plain)
+            tbbtprint(&blk->u.item[i]);
+        else
+            tbbt_printNode(&blk->u.item[i], key_dump);
+    if (method == 1) /* Post-Order Traversal */
+        tbbt_print_block(blk);
+} /* end tbbt_dump_block() */
+
 void
 tbbt1dump(TBBT_NODE *node, int method)
 {
     if (node == NULL)
         return;
-    switch (method) {
-        case -1: /* Pre-Order Traversal */
-            tbbtprint(node);
-            if (HasChild(node, LEFT))
-                tbbt1dump(node->Lchild, method);
-            if (HasChild(node, RIGHT))
-                tbbt1dump(node->Rchild, method);
-            break;
-
-        case 1: /* Post-Order Traversal */
-            if (HasChild(node, LEFT))
-                tbbt1dump(node->Lchild, method);
-            if (HasChild(node, RIGHT))
-                tbbt1dump(node->Rchild, method);
-            tbbtprint(node);
-            break;
-
-        case 0: /* In-Order Traversal */
-        default:
-            if (HasChild(node, LEFT))
-                tbbt1dump(node->Lchild, method);
-            tbbtprint(node);
-            if (HasChild(node, RIGHT))
-                tbbt1dump(node->Rchild, method);
-            break;
-
-    } /* end switch() */
+    tbbt_dump_block(node->priv->tree->top, NULL, method, TRUE);
 } /* end tbbt1dump() */
 
 void
@@ -830,10 +919,8 @@ tbbt_printNode(TBBT_NODE *node, void (*key_dump)(void *, void *))
         printf("ERROR:  null node pointer\n");
         return;
     }
-    printf("node=%p, flags=%x, Lcnt=%ld, Rcnt=%ld\n", (void *)node, (unsigned)node->Flags, (long)node->Lcnt,
-           (long)node->Rcnt);
-    printf("Lchild=%p, Rchild=%p, Parent=%p\n", (void *)node->Lchild, (void *)node->Rchild,
-           (void *)node->Parent);
+    printf("node=%p, block=%p, position=%d\n", (void *)node, (void *)node->priv,
+           (int)(node - node->priv->u.item));
     if (key_dump != NULL) {
         (*key_dump)(node->key, node->data);
     }
@@ -845,33 +932,7 @@ tbbt_dumpNode(TBBT_NODE *node, void (*key_dump)(void *, void *), int method)
 {
     if (node == NULL)
         return;
-    switch (method) {
-        case -1: /* Pre-Order Traversal */
-            tbbt_printNode(node, key_dump);
-            if (HasChild(node, LEFT))
-                tbbt_dumpNode(node->Lchild, key_dump, method);
-            if (HasChild(node, RIGHT))
-                tbbt_dumpNode(node->Rchild, key_dump, method);
-            break;
-
-        case 1: /* Post-Order Traversal */
-            if (HasChild(node, LEFT))
-                tbbt_dumpNode(node->Lchild, key_dump, method);
-            if (HasChild(node, RIGHT))
-                tbbt_dumpNode(node->Rchild, key_dump, method);
-            tbbt_printNode(node, key_dump);
-            break;
-
-        case 0: /* In-Order Traversal */
-        default:
-            if (HasChild(node, LEFT))
-                tbbt_dumpNode(node->Lchild, key_dump, method);
-            tbbt_printNode(node, key_dump);
-            if (HasChild(node, RIGHT))
-                tbbt_dumpNode(node->Rchild, key_dump, method);
-            break;
-
-    } /* end switch() */
+    tbbt_dump_block(node->priv->tree->top, key_dump, method, FALSE);
 } /* end tbbt_dumpNode() */
 
 void
@@ -893,6 +954,14 @@ tbbtdfree(TBBT_TREE *tree, void (*fd)(void * /* item */), void (*fk)(void * /* k
     if (tree == NULL)
         return NULL;
 
+    /* Blocks from an arena only need to be visited for the routines */
+    if (tree->Arena != NULL) {
+        if (NULL != fd || NULL != fk)
+            tbbtfree(&tree->root, fd, fk);
+        ARfree(tree->Arena, tree, sizeof(TBBT_ARENA_TREE));
+        return NULL;
+    }
+
     tbbtfree(&tree->root, fd, fk);
     free(tree->priv);
     free(tree);
@@ -911,58 +980,68 @@ tbbtcount(TBBT_TREE *tree)
 
 /******************************************************************************
  NAME
-     tbbt_get_node - Gets a tbbt node
+     tbbt_get_block - Gets a tbbt block
 
  DESCRIPTION
-    Either gets a tbbt node from the free list (if there is one available)
-    or allocates a node.
+    Gets a tbbt block from the arena of the tree if it has one, else either
+    gets a block from the free list (if there is one available) or
+    allocates a block.  The block is empty, and not linked to any other.
 
  RETURNS
-    Returns tbbt ptr if successful and NULL otherwise
+    Returns block ptr if successful and NULL otherwise
 
 *******************************************************************************/
-static TBBT_NODE *
-tbbt_get_node(void)
+static TBBT_BLOCK *
+tbbt_get_block(TBBT_TREE_PRIV *tree)
 {
-    TBBT_NODE *ret_value = NULL;
+    TBBT_BLOCK *ret_value = NULL;
 
-    if (tbbt_free_list != NULL) {
+    if (tree->arena != NULL)
+        ret_value = (TBBT_BLOCK *)ARalloc(tree->arena, sizeof(TBBT_BLOCK));
+    else if (tbbt_free_list != NULL) {
         ret_value      = tbbt_free_list;
-        tbbt_free_list = tbbt_free_list->Lchild;
-    }
-    else {
-        if (NULL == (ret_value = (TBBT_NODE *)calloc(1, sizeof(TBBT_NODE))))
-            goto error;
-        if (NULL == (ret_value->priv = (TBBT_NODE_PRIV *)calloc(1, sizeof(TBBT_NODE_PRIV))))
-            goto error;
+        tbbt_free_list = tbbt_free_list->parent;
     }
+    else
+        ret_value = (TBBT_BLOCK *)malloc(sizeof(TBBT_BLOCK));
+
+    if (ret_value != NULL) {
+        ret_value->parent = NULL;
+        ret_value->prev   = NULL;
+        ret_value->next   = NULL;
+        ret_value->tree   = tree;
+        ret_value->count  = 0;
+        ret_value->nitems = 0;
+        ret_value->leaf   = FALSE;
+    } /* end if */
 
     return ret_value;
-error:
-    if (ret_value)
-        free(ret_value->priv);
-    free(ret_value);
-    return NULL;
-} /* end tbbt_get_node() */
+} /* end tbbt_get_block() */
 
 /******************************************************************************
  NAME
-     tbbt_release_node - Releases a tbbt node
+     tbbt_release_block - Releases a tbbt block
 
  DESCRIPTION
-    Puts a tbbt node into the free list
+    Gives a tbbt block back to the arena of its tree, or puts it into the
+    free list
 
  RETURNS
     No return value
 
 *******************************************************************************/
 static void
-tbbt_release_node(TBBT_NODE *nod)
+tbbt_release_block(TBBT_BLOCK *blk)
 {
-    /* Insert the atom at the beginning of the free list */
-    nod->Lchild    = tbbt_free_list;
-    tbbt_free_list = nod;
-} /* end tbbt_release_node() */
+    if (blk->tree->arena != NULL) {
+        ARfree(blk->tree->arena, blk, sizeof(TBBT_BLOCK));
+        return;
+    }
+
+    /* Insert the block at the beginning of the free list */
+    blk->parent    = tbbt_free_list;
+    tbbt_free_list = blk;
+} /* end tbbt_release_block() */
 
 /*--------------------------------------------------------------------------
  NAME
@@ -984,16 +1063,13 @@ tbbt_release_node(TBBT_NODE *nod)
 int
 tbbt_shutdown(void)
 {
-    TBBT_NODE *curr;
+    TBBT_BLOCK *curr;
 
     /* Release the free-list if it exists */
-    if (tbbt_free_list != NULL) {
-        while (tbbt_free_list != NULL) {
-            curr           = tbbt_free_list;
-            tbbt_free_list = tbbt_free_list->Lchild;
-            free(curr->priv);
-            free(curr);
-        }
+    while (tbbt_free_list != NULL) {
+        curr           = tbbt_free_list;
+        tbbt_free_list = tbbt_free_list->parent;
+        free(curr);
     }
     return SUCCEED;
 } /* end tbbt_shutdown() */
@@ -11,13 +11,15 @@
  * help@hdfgroup.org.                                                        *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-/* "tbbt.h" -- Data types/routines for threaded, balanced, binary trees. */
-/* Extended from Knuth 6.2.3, Algorithm A */
+/* "tbbt.h" -- Data types/routines for balanced trees of sorted items. */
+/* Once threaded, balanced, binary trees (Knuth 6.2.3, Algorithm A), now
+ * B+trees (Knuth 6.2.4) behind the same routines */
 
 #ifndef H4_TBBT_H
 #define H4_TBBT_H
 
 #include "hdfi.h"
+#include "arena.h"
 
 /* Define the "fast compare" values */
 #define TBBT_FAST_UINT16_COMPARE 1
@@ -29,7 +31,7 @@ struct tbbt_node_private;
 /* Private TBBT node information (defined in tbbt.c) */
 struct tbbt_tree_private;
 
-/* Threaded node structure */
+/* Node structure; the nodes are kept in the blocks of the tree */
 typedef struct tbbt_node {
     void *data; /* Pointer to user data to be associated with node */
     void *key;  /* Field to sort nodes on */
@@ -37,7 +39,7 @@ typedef struct tbbt_node {
     struct tbbt_node_private *priv; /* Private information about the TBBT node */
 } TBBT_NODE;
 
-/* Threaded tree structure */
+/* Tree structure */
 typedef struct tbbt_tree {
     TBBT_NODE *root;
 
@@ -62,8 +64,13 @@ typedef struct tbbt_tree {
  * number of items in the list (except for list creation which requires
  * constant time and list destruction which requires Order(N) time if the user-
  * supplied free-data-item or free-key-value routines require constant time).
- * Each of the above operations (except create and destroy) can be performed
- * on a subtree.
+ *
+ * The nodes of a tree are kept side by side in the blocks of the tree, and
+ * move around when nodes are added to or removed from it.  A pointer to a
+ * node is only good until the next insertion or removal in the same tree
+ * (look the node up again after that), and the key value of a node must not
+ * change while it is in a tree: remove the node and insert it again with
+ * its new key instead.
  *
  * Each node of a tree has associated with it a generic pointer (void *) which
  * is set to point to one such "item" and a generic pointer to point to that
@@ -98,7 +105,7 @@ extern "C" {
 #endif
 
 HDFLIBAPI TBBT_TREE *tbbtdmake(int (*compar)(void *, void *, int), int arg, unsigned fast_compare);
-/* Allocates and initializes an empty threaded, balanced, binary tree and
+/* Allocates and initializes an empty balanced tree and
  * returns a pointer to the control structure for it.  You can also create
  * empty trees without this function as long as you never use tbbtd* routines
  * (tbbtdfind, tbbtdins, tbbtdfree) on them.
@@ -125,9 +132,9 @@ HDFLIBAPI TBBT_TREE *tbbtdmake(int (*compar)(void *, void *, int), int arg, unsi
  * kind of assumption).  You can also use a key comparison routine that expects
  * pointers to data items rather than key values.
  *  The "fast compare" option is for keys of simple numeric types (currently
- *      uint16 and int32) and avoids the function call for faster searches in
- *      some cases.  The key comparison routine is still required for some
- *      insertion routines which use it.
+ *      uint16 and int32) and avoids the function call for faster searches:
+ *      the values of the keys are kept in the blocks of the tree.  The key
+ *      comparison routine is still required for tbbtfind() and tbbtless().
  *
  * Most of the other routines expect a pointer to a root node of a tree, not
  * a pointer to the tree's control structure (only tbbtdfind(), tbbtdins(),
@@ -143,7 +150,6 @@ HDFLIBAPI TBBT_TREE *tbbtdmake(int (*compar)(void *, void *, int), int arg, unsi
  *     node= tbbtdless( tree1, key, NULL );
  *     node= tbbtless( *tree1, key, compar, arg, NULL );
  *     node= tbbtdins( tree1, item, key );
- *     node= tbbtins( tree1, item, key, compar, arg );
  *     item= tbbtrem( tree1, tbbtdfind(tree1,key,NULL), NULL );
  *     item= tbbtrem( tree1, tbbtfind(*tree1,key,compar,arg,NULL), NULL );
  *     tree1= tbbtdfree( tree1, free, NULL );       (* or whatever *)
@@ -154,8 +160,17 @@ HDFLIBAPI TBBT_TREE *tbbtdmake(int (*compar)(void *, void *, int), int arg, unsi
  *     node= tbbtins( &root, item, key );
  *     node= tbbtrem( &root, tbbtfind(root,key), NULL );
  *     tbbtfree( &root, free, NULL );               (* or whatever *)
- * Never use tbbtfree() on a tree allocated with tbbtdmake() or on a sub-tree
- * of ANY tree.  Never use tbbtdfree() except on a tbbtdmake()d tree.
+ * Never use tbbtins() or tbbtfree() on a tree allocated with tbbtdmake().
+ * Never use tbbtdfree() except on a tbbtdmake()d tree.
+ */
+
+HDFLIBAPI TBBT_TREE *tbbtdmake_arena(arena_p arena, int (*compar)(void *, void *, int), int arg,
+                                     unsigned fast_compare);
+/* Like tbbtdmake(), but the tree and all of its blocks are allocated from
+ * `arena' (see arena.h) instead of malloc().  The blocks go back to the arena
+ * when they are removed, and tbbtdfree() of such a tree without `fd' and `fk'
+ * routines does not need to visit them.  The tree must be freed before the
+ * arena is destroyed, unless it is simply dropped along with the arena.
  */
 
 HDFLIBAPI TBBT_NODE *tbbtdfind(TBBT_TREE *tree, void *key, TBBT_NODE **pp);
@@ -167,22 +182,21 @@ HDFLIBAPI TBBT_NODE *tbbtless(TBBT_NODE *root, void *key, int (*cmp)(void *, voi
 /* Locate a node based on the key given.  A pointer to the node in the tree
  * with a key value matching `key' is returned.  If no such node exists, NULL
  * is returned.  Whether a node is found or not, if `pp' is not NULL, `*pp'
- * will be set to point to the parent of the node we are looking for (or that
- * node that would be the parent if the node is not found).  tbbtdfind() is
- * used on trees created using tbbtdmake() (so that `cmp' and `arg' don't have
- * to be passed).  tbbtfind() can be used on the root or any subtree of a tree
- * create using tbbtdmake() and is used on any tree (or subtree) created with-
- * out using tbbtdmake().  tbbtless() & tbbtdless() work exactly like tbbtfind()
- * and tbbtdfind() except that they find the node with a key which is less than
- * or equal to the key given to them.
+ * will be set to point to the node with the largest key value less than `key'
+ * (or NULL if there is none).  tbbtdfind() is used on trees created using
+ * tbbtdmake() (so that `cmp' and `arg' don't have to be passed).  tbbtfind()
+ * can be given any node of a tree created using tbbtdmake() and is used on
+ * any tree created without using tbbtdmake().  tbbtless() & tbbtdless() work
+ * exactly like tbbtfind() and tbbtdfind() except that they find the node with
+ * the largest key which is less than or equal to the key given to them.
  */
 
 HDFLIBAPI TBBT_NODE *tbbtindx(TBBT_NODE *root, int32 indx);
-/* Locate the node that has `indx' nodes with lesser key values.  This is like
- * an array lookup with the first item in the list having index 0.  For large
- * values of `indx', this call is much faster than tbbtfirst() followed by
- * `indx' tbbtnext()s.  Thus `tbbtindx(&root,0L)' is equivalent to (and almost
- * as fast as) `tbbtfirst(root)'.
+/* Locate the node that has `indx'-1 nodes with lesser key values.  This is
+ * like an array lookup with the first item in the list having index 1.  For
+ * large values of `indx', this call is much faster than tbbtfirst() followed
+ * by `indx'-1 tbbtnext()s.  Thus `tbbtindx(root,1)' is equivalent to (and
+ * almost as fast as) `tbbtfirst(root)'.
  */
 
 HDFLIBAPI TBBT_NODE *tbbtdins(TBBT_TREE *tree, void *item, void *key);
@@ -207,11 +221,11 @@ HDFLIBAPI void *tbbtrem(TBBT_NODE **root, TBBT_NODE *node, void **kp);
 HDFLIBAPI TBBT_NODE *tbbtfirst(TBBT_NODE *root);
 HDFLIBAPI TBBT_NODE *tbbtlast(TBBT_NODE *root);
 /* Returns a pointer to node from the tree with the lowest(first)/highest(last)
- * key value.  If the tree is empty NULL is returned.  Examples:
+ * key value.  If the tree is empty NULL is returned.  Any node of the tree
+ * can be given in place of its root.  Examples:
  *     node= tbbtfirst(*tree);
  *     node= tbbtfirst(root);
  *     node= tbbtlast(tree->root);
- *     node= tbbtlast(node);        (* Last node in a sub-tree *)
  */
 
 HDFLIBAPI TBBT_NODE *tbbtnext(TBBT_NODE *node);
@@ -232,7 +246,9 @@ HDFLIBAPI void       tbbtfree(TBBT_NODE **root, void (*fd)(void *), void (*fk)(v
  * is NULL, no action is done for the key values (they were allocated on the
  * stack, as a part of each data item, or together with one malloc() call, for
  * example) and likewise for `fd'.  tbbtdfree() always returns NULL and
- * tbbtfree() always sets `root' to be NULL.
+ * tbbtfree() always sets `root' to be NULL.  When a tree made by
+ * tbbtdmake_arena() is freed with neither routine, its blocks are left to
+ * the arena instead of being visited one by one.
  */
 
 HDFLIBAPI void tbbtprint(TBBT_NODE *node);
@@ -241,9 +257,9 @@ HDFLIBAPI void tbbtprint(TBBT_NODE *node);
 HDFLIBAPI void tbbtdump(TBBT_TREE *tree, int method);
 /* Prints an entire tree.  The method variable determines which sort of
  * traversal is used:
- *      -1 : Pre-Order Traversal
- *       1 : Post-Order Traversal
- *       0 : In-Order Traversal
+ *      -1 : Pre-Order Traversal (each block before what is below it)
+ *       1 : Post-Order Traversal (each block after what is below it)
+ *       0 : In-Order Traversal (the nodes only)
  */
 
 HDFLIBAPI long tbbtcount(TBBT_TREE *tree);
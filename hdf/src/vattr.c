@@ -13,6 +13,7 @@
 
 #include "hdfi.h"
 #include "vgint.h"
+#include "hthread.h"
 
 /**************************************************************
 *
@@ -211,6 +212,8 @@ VSfindex(int32 vsid, const char *fieldname, int32 *findex)
     int32           ret_value = SUCCEED;
     intn            i, found = 0;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vsid) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -239,6 +242,7 @@ VSfindex(int32 vsid, const char *fieldname, int32 *findex)
     if (!found)
         HGOTO_ERROR(DFE_BADFIELDS, FAIL);
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSfindex */
 
@@ -279,6 +283,8 @@ VSsetattr(int32 vsid, int32 findex, const char *attrname, int32 datatype, int32
     int32           nattrs, ret_value = SUCCEED;
     int32           attr_vs_ref, fid, attr_vsid;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* check if id is valid vdata */
@@ -362,6 +368,7 @@ VSsetattr(int32 vsid, int32 findex, const char *attrname, int32 datatype, int32
     vs->marked   = 1;
     vs->new_h_sz = 1;
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsetattr */
 
@@ -386,6 +393,8 @@ VSnattrs(int32 vsid)
     VDATA        *vs;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vsid) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -397,6 +406,7 @@ VSnattrs(int32 vsid)
         HGOTO_ERROR(DFE_NOVS, FAIL);
     ret_value = vs->nattrs;
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSnattrs */
 
@@ -425,6 +435,8 @@ VSfnattrs(int32 vsid, int32 findex)
     vs_attr_t    *vs_alist;
     intn          i, nattrs, t_attrs;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vsid) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -447,6 +459,7 @@ VSfnattrs(int32 vsid, int32 findex)
     }
     ret_value = nattrs;
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSfattrs */
 
@@ -475,6 +488,8 @@ VSfindattr(int32 vsid, int32 findex, const char *attrname)
     int32         ret_value = FAIL;
     intn          i, nattrs, a_index, found;
 
+    H4_API_LOCK;
+
     HEclear();
     /* check if id is valid vdata */
     if (HAatom_group(vsid) != VSIDGROUP)
@@ -530,6 +545,7 @@ VSfindattr(int32 vsid, int32 findex, const char *attrname)
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSfindattr */
 
@@ -564,6 +580,8 @@ VSattrinfo(int32 vsid, int32 findex, intn attrindex, char *name, int32 *datatype
     DYN_VWRITELIST *w;
     char           *fldname;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vsid) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -620,6 +638,7 @@ VSattrinfo(int32 vsid, int32 findex, intn attrindex, char *name, int32 *datatype
     if (FAIL == VSdetach(attr_vsid))
         HGOTO_ERROR(DFE_CANTDETACH, FAIL);
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSattrinfo */
 
@@ -650,6 +669,8 @@ VSgetattr(int32 vsid, int32 findex, intn attrindex, void *values)
     int32         n_recs, il;
     char          fields[FIELDNAMELENMAX + 1];
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vsid) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -705,6 +726,7 @@ VSgetattr(int32 vsid, int32 findex, intn attrindex, void *values)
         HGOTO_ERROR(DFE_CANTDETACH, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetattr */
 
@@ -728,6 +750,8 @@ VSisattr(int32 vsid)
     VDATA        *vs;
     int32         ret_value = FALSE;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vsid) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FALSE);
@@ -739,6 +763,7 @@ VSisattr(int32 vsid)
     if (strcmp(vs->vsclass, _HDF_ATTRIBUTE) == 0)
         ret_value = TRUE;
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSisattr */
 
@@ -776,6 +801,8 @@ Vsetattr(int32 vgid, const char *attrname, int32 datatype, int32 count, const vo
     int32           attr_vs_ref, fid, vsid;
     intn            i;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* check if id is valid vgroup */
@@ -856,6 +883,7 @@ Vsetattr(int32 vgid, const char *attrname, int32 datatype, int32 count, const vo
     vg->old_alist = NULL;
     vg->noldattrs = 0;
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vsetattr */
 
@@ -883,6 +911,8 @@ Vgetversion(int32 vgid)
     int16         vg_version;
     int32         ret_value = FAIL;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vgid) != VGIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -898,6 +928,7 @@ Vgetversion(int32 vgid)
     ret_value  = (int32)vg_version;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetversion */
 
@@ -919,6 +950,8 @@ Vnattrs(int32 vgid)
     vginstance_t *v;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vgid) != VGIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -934,6 +967,7 @@ Vnattrs(int32 vgid)
     ret_value = vg->nattrs;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vnattrs */
 
@@ -989,6 +1023,8 @@ Vnoldattrs(int32 vgid)
     uint16       *areflist  = NULL;
     int32         ret_value = 0;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vgid) != VGIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -1056,6 +1092,7 @@ Vnoldattrs(int32 vgid)
 
 done:
     free(areflist);
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vnoldattrs */
 
@@ -1087,6 +1124,8 @@ Vnattrs2(int32 vgid)
     intn  n_new_attrs = 0, n_old_attrs = 0;
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* Get number of new-style attributes */
@@ -1103,6 +1142,7 @@ Vnattrs2(int32 vgid)
     ret_value = n_old_attrs + n_new_attrs;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vnattrs2 */
 
@@ -1128,6 +1168,8 @@ Vfindattr(int32 vgid, const char *attrname)
     int32         ret_value = FAIL;
     intn          i, found;
 
+    H4_API_LOCK;
+
     HEclear();
 
     /* check if id is valid vgroup */
@@ -1169,6 +1211,7 @@ Vfindattr(int32 vgid, const char *attrname)
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vfindattr */
 
@@ -1205,6 +1248,8 @@ Vattrinfo(int32 vgid, intn attrindex, char *name, int32 *datatype, int32 *count,
     int32         fid, vsid;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vgid) != VGIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -1248,6 +1293,7 @@ Vattrinfo(int32 vgid, intn attrindex, char *name, int32 *datatype, int32 *count,
     if (FAIL == VSdetach(vsid))
         HGOTO_ERROR(DFE_CANTDETACH, FAIL);
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vattrinfo */
 
@@ -1399,6 +1445,8 @@ Vgetattr(int32 vgid, intn attrindex, void *values)
     int32         n_recs, il;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     HEclear();
     if (HAatom_group(vgid) != VGIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -1438,6 +1486,7 @@ Vgetattr(int32 vgid, intn attrindex, void *values)
         HGOTO_ERROR(DFE_CANTDETACH, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetattr */
 
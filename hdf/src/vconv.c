@@ -30,6 +30,7 @@
 #include "hdfi.h"
 #include "hfile.h"
 #include "vgint.h"
+#include "hthread.h"
 
 /*
  ** ==================================================================
@@ -112,6 +113,9 @@ vicheckcompat(HFILEID f)
 {
     int16 foundold, foundnew;
     int32 aid;
+    int32 ret_value = 1;
+
+    H4_API_LOCK;
 
     foundold = 0;
     foundnew = 0;
@@ -145,12 +149,16 @@ vicheckcompat(HFILEID f)
 
     HEclear();         /* clear the stack to remove faux failures - bug #655 */
     if (foundold == 0) /* has no old vset elements */
-        return 1;      /* just assume compatible */
+        HGOTO_DONE(1); /* just assume compatible */
 
     if (foundnew > 0)
-        return 1; /* file is already compatible */
+        ret_value = 1; /* file is already compatible */
     else
-        return 0; /* file is not compatible */
+        ret_value = 0; /* file is not compatible */
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* vicheckcompat */
 
 /* ------------------------------------------------------------------ */
@@ -178,13 +186,16 @@ vimakecompat(HFILEID f)
     int32   ret;
     uintn   u;
     uint16  tag = DFTAG_NULL, ref = DFTAG_NULL;
+    int32   ret_value = 1;
+
+    H4_API_LOCK;
 
     /* =============================================  */
     /* --- read all vgs and convert each --- */
 
     /* allocate space for vg */
     if (NULL == (vg = VIget_vgroup_node()))
-        HRETURN_ERROR(DFE_NOSPACE, 0);
+        HGOTO_ERROR(DFE_NOSPACE, 0);
     ret = aid = Hstartread(f, (uint16)OLD_VGDESCTAG, DFREF_WILDCARD);
     while (ret != FAIL) {
         HQuerytagref(aid, &tag, &ref);
@@ -192,13 +203,13 @@ vimakecompat(HFILEID f)
         if (buf == NULL || bsize > old_bsize) {
             free(buf);
             if ((buf = (uint8 *)malloc(bsize)) == NULL)
-                HRETURN_ERROR(DFE_NOSPACE, 0);
+                HGOTO_ERROR(DFE_NOSPACE, 0);
             old_bsize = bsize;
         }
         ret = Hgetelement(f, (uint16)OLD_VGDESCTAG, ref, (uint8 *)buf);
         if (ret == FAIL) {
             free(buf);
-            HRETURN_ERROR(DFE_READERROR, 0);
+            HGOTO_ERROR(DFE_READERROR, 0);
         }
 
         oldunpackvg(vg, buf, &bsize);
@@ -222,7 +233,7 @@ vimakecompat(HFILEID f)
         ret = Hputelement(f, VGDESCTAG, ref, (uint8 *)buf, bsize);
         free(buf);
         if (ret == FAIL)
-            HRETURN_ERROR(DFE_WRITEERROR, 0);
+            HGOTO_ERROR(DFE_WRITEERROR, 0);
 
         ret = Hnextread(aid, (uint16)OLD_VGDESCTAG, DFREF_WILDCARD, DF_CURRENT);
     } /* while */
@@ -236,7 +247,7 @@ vimakecompat(HFILEID f)
     old_bsize = 0; /* reset state variables */
     buf       = NULL;
     if ((vs = VSIget_vdata_node()) == NULL)
-        HRETURN_ERROR(DFE_NOSPACE, 0);
+        HGOTO_ERROR(DFE_NOSPACE, 0);
     ret = aid = Hstartread(f, (uint16)OLD_VSDESCTAG, DFREF_WILDCARD);
     while (ret != FAIL) {
 
@@ -245,13 +256,13 @@ vimakecompat(HFILEID f)
         if (buf == NULL || bsize > old_bsize) {
             free(buf);
             if ((buf = (uint8 *)malloc(bsize)) == NULL)
-                HRETURN_ERROR(DFE_NOSPACE, 0);
+                HGOTO_ERROR(DFE_NOSPACE, 0);
             old_bsize = bsize;
         }
         ret = Hgetelement(f, tag, ref, (uint8 *)buf);
         if (ret == FAIL) {
             free(buf);
-            HRETURN_ERROR(DFE_READERROR, 0);
+            HGOTO_ERROR(DFE_READERROR, 0);
         }
 
         oldunpackvs(vs, buf, &bsize);
@@ -267,21 +278,23 @@ vimakecompat(HFILEID f)
         ret = Hputelement(f, VSDESCTAG, ref, (uint8 *)buf, bsize);
         if (ret == FAIL) {
             free(buf);
-            HRETURN_ERROR(DFE_WRITEERROR, 0);
+            HGOTO_ERROR(DFE_WRITEERROR, 0);
         }
 
         /* duplicate a tag to point to vdata data */
         ret = Hdupdd(f, NEW_VSDATATAG, ref, (uint16)OLD_VSDATATAG, ref);
         free(buf);
         if (ret == FAIL)
-            HRETURN_ERROR(DFE_DUPDD, 0);
+            HGOTO_ERROR(DFE_DUPDD, 0);
         ret = Hnextread(aid, (uint16)OLD_VSDESCTAG, DFREF_WILDCARD, DF_CURRENT);
     } /* while */
 
     Hendaccess(aid);
     VSIrelease_vdata_node(vs);
 
-    return 1;
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 
 } /* vimakecompat */
 
@@ -305,14 +318,21 @@ vcheckcompat(char *fs)
 
     HFILEID f;
     int32   ret;
+    int32   ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     f = Hopen(fs, DFACC_ALL, 0);
     if (f == FAIL)
-        HRETURN_ERROR(DFE_BADOPEN, FAIL);
+        HGOTO_ERROR(DFE_BADOPEN, FAIL);
     ret = vicheckcompat(f);
     Hclose(f);
 
-    return ret;
+    ret_value = ret;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* vcheckcompat */
 
 /* ================================================================== */
@@ -332,13 +352,20 @@ vmakecompat(char *fs)
 {
     HFILEID f;
     int32   ret;
+    int32   ret_value = SUCCEED;
+
+    H4_API_LOCK;
 
     f = Hopen(fs, DFACC_ALL, 0);
     if (f == FAIL)
-        HRETURN_ERROR(DFE_BADOPEN, FAIL);
+        HGOTO_ERROR(DFE_BADOPEN, FAIL);
     ret = vimakecompat(f);
     Hclose(f);
-    return ret;
+    ret_value = ret;
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
 } /* vmakecompat */
 
 /* ==================================================================== */
@@ -63,6 +63,7 @@ PRIVATE data structures in here pertain to vdata in vsdir only.
 
 #include "hdfi.h"
 #include "vgint.h"
+#include "hthread.h"
 
 /* These are used to determine whether a vdata had been created by the
    library internally, that is, not created by user's application */
@@ -127,6 +128,8 @@ VSelts(int32 vkey /* IN: vdata key */)
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* make sure vdata key is part of vdata group */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -144,6 +147,7 @@ VSelts(int32 vkey /* IN: vdata key */)
     ret_value = (vs->nvertices);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSelts */
 
@@ -165,6 +169,8 @@ VSgetinterlace(int32 vkey /* IN: vdata key */)
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -182,6 +188,7 @@ VSgetinterlace(int32 vkey /* IN: vdata key */)
     ret_value = ((int32)(vs->interlace));
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetinterlace */
 
@@ -204,6 +211,8 @@ VSsetinterlace(int32 vkey, /* IN: vdata key */
     VDATA        *vs        = NULL;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -235,6 +244,7 @@ VSsetinterlace(int32 vkey, /* IN: vdata key */
         ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsetinterlace */
 
@@ -259,6 +269,8 @@ VSgetfields(int32 vkey, /* IN: vdata key */
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check if a NULL field list is passed in, then return with
        error (found while fixing bug #554) - BMR 4/30/01 */
     if (fields == NULL)
@@ -294,6 +306,7 @@ VSgetfields(int32 vkey, /* IN: vdata key */
     ret_value = ((int32)vs->wlist.n);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetfields */
 
@@ -323,6 +336,8 @@ VSfexist(int32 vkey, /* IN: vdata key */
     int32           found;
     intn            ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -371,6 +386,7 @@ VSfexist(int32 vkey, /* IN: vdata key */
     ret_value = TRUE;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSfexist */
 
@@ -398,6 +414,8 @@ VSsizeof(int32 vkey, /* IN vdata key */
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -446,6 +464,7 @@ VSsizeof(int32 vkey, /* IN vdata key */
     ret_value = totalsize;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsizeof */
 
@@ -462,7 +481,10 @@ RETURNS
 void
 VSdump(int32 vkey /* IN: vdata key */)
 {
+    H4_API_LOCK;
+
     (void)vkey;
+    H4_API_UNLOCK;
 } /* VSdump */
 
 /*-------------------------------------------------------
@@ -488,6 +510,8 @@ VSsetname(int32       vkey, /* IN: Vdata key */
     int32         slen;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -522,6 +546,7 @@ VSsetname(int32       vkey, /* IN: Vdata key */
         vs->new_h_sz = TRUE; /* mark vdata header size being changed */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsetname */
 
@@ -548,6 +573,8 @@ VSsetclass(int32       vkey, /* IN: vdata key */
     int32         slen;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -582,6 +609,7 @@ VSsetclass(int32       vkey, /* IN: vdata key */
         vs->new_h_sz = TRUE; /* mark vdata header size being changed */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsetclass */
 
@@ -604,6 +632,8 @@ VSgetname(int32 vkey, /* IN: vdata key */
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -625,6 +655,7 @@ VSgetname(int32 vkey, /* IN: vdata key */
     strcpy(vsname, vs->vsname);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetname */
 
@@ -647,6 +678,8 @@ VSgetclass(int32 vkey, /* IN: vdata key */
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -668,6 +701,7 @@ VSgetclass(int32 vkey, /* IN: vdata key */
     strcpy(vsclass, vs->vsclass);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetclass */
 
@@ -694,6 +728,8 @@ VSinquire(int32  vkey,      /* IN: vdata key */
     intn ret_value = SUCCEED;
     intn status;
 
+    H4_API_LOCK;
+
     /* check key is valid vdata */
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -722,6 +758,7 @@ VSinquire(int32  vkey,      /* IN: vdata key */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value; /* ok */
 
 } /* VSinquire */
@@ -752,6 +789,8 @@ VSlone(HFILEID f,       /* IN: file id */
     int32  nlone;            /* total number of lone vdatas */
     int32  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* -- allocate local space for vdata refs, init to zeros -- */
     if (NULL == (lonevdata = (uint8 *)calloc(MAX_REF, sizeof(uint8))))
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
@@ -790,6 +829,7 @@ VSlone(HFILEID f,       /* IN: file id */
     ret_value = nlone; /* return the TOTAL # of lone vdatas */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSlone */
 
@@ -819,6 +859,8 @@ Vlone(HFILEID f,       /* IN: file id */
     int32  nlone;         /* total number of lone vgroups */
     int32  ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* -- allocate space for vgroup refs, init to zeroes -- */
     if (NULL == (lonevg = (uint8 *)calloc(MAX_REF, sizeof(uint8))))
         HGOTO_ERROR(DFE_NOSPACE, FAIL);
@@ -858,6 +900,7 @@ Vlone(HFILEID f,       /* IN: file id */
     ret_value = nlone; /* return the TOTAL # of lone vgroups */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vlone */
 
@@ -883,6 +926,8 @@ Vfind(HFILEID     f, /* IN: file id */
     VGROUP       *vg        = NULL;
     int32         ret_value = 0;
 
+    H4_API_LOCK;
+
     /* check for null vgroup name */
     if (vgname == NULL)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -904,6 +949,7 @@ Vfind(HFILEID     f, /* IN: file id */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vfind */
 
@@ -929,6 +975,8 @@ VSfind(HFILEID     f, /* IN: file id */
     VDATA        *vs        = NULL;
     int32         ret_value = 0;
 
+    H4_API_LOCK;
+
     /* check for null vdata name */
     if (vsname == NULL)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -949,6 +997,7 @@ VSfind(HFILEID     f, /* IN: file id */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSfind */
 
@@ -974,6 +1023,8 @@ Vfindclass(HFILEID     f, /* IN: file id */
     VGROUP       *vg        = NULL;
     int32         ret_value = 0;
 
+    H4_API_LOCK;
+
     /* check for null vgroup class */
     if (vgclass == NULL)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -997,6 +1048,7 @@ Vfindclass(HFILEID     f, /* IN: file id */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vfindclass */
 
@@ -1022,6 +1074,8 @@ VSfindclass(HFILEID     f, /* IN: file id */
     VDATA        *vs        = NULL;
     int32         ret_value = 0;
 
+    H4_API_LOCK;
+
     /* check for null vdata class */
     if (vsclass == NULL)
         HGOTO_ERROR(DFE_ARGS, FAIL);
@@ -1042,6 +1096,7 @@ VSfindclass(HFILEID     f, /* IN: file id */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSfindclass */
 
@@ -1071,6 +1126,8 @@ VSsetblocksize(int32 vkey,       /* IN: vdata key */
     VDATA        *vs        = NULL;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1092,6 +1149,7 @@ VSsetblocksize(int32 vkey,       /* IN: vdata key */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsetblocksize */
 
@@ -1121,6 +1179,8 @@ VSsetnumblocks(int32 vkey,       /* IN: vdata key */
     VDATA        *vs        = NULL;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1142,6 +1202,7 @@ VSsetnumblocks(int32 vkey,       /* IN: vdata key */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsetnumblocks */
 
@@ -1171,6 +1232,8 @@ VSgetblockinfo(int32  vkey,       /* IN: vdata id */
     VDATA        *vs        = NULL;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1192,6 +1255,7 @@ VSgetblockinfo(int32  vkey,       /* IN: vdata id */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetblockinfo */
 
@@ -1210,6 +1274,8 @@ VSisinternal(const char *classname)
     int  i;
     intn ret_value = FALSE;
 
+    H4_API_LOCK;
+
     /* Check if this class name is one of the internal class name and return
         TRUE, otherwise, return FALSE */
     for (i = 0; i < HDF_NUM_INTERNAL_VDS; i++) {
@@ -1218,6 +1284,7 @@ VSisinternal(const char *classname)
             break;
         }
     }
+    H4_API_UNLOCK;
     return ret_value;
 }
 
@@ -1267,6 +1334,8 @@ VSofclass(int32       id,       /* IN: file id or vgroup id */
 {
     intn ret_value = 0;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1277,6 +1346,7 @@ VSofclass(int32       id,       /* IN: file id or vgroup id */
     ret_value = VSIgetvdatas(id, vsclass, start_vd, n_vds, refarray);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSofclass */
 
@@ -1573,6 +1643,8 @@ VSgetvdatas(int32       id,       /* IN: file id or vgroup id */
 {
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1583,6 +1655,7 @@ VSgetvdatas(int32       id,       /* IN: file id or vgroup id */
     /* Passing NULL in to VSIgetvdatas to get user-created vdatas */
     ret_value = VSIgetvdatas(id, NULL, start_vd, n_vds, refarray);
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetvdatas */
 
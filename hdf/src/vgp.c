@@ -33,6 +33,7 @@ LOCAL ROUTINES
  VPgetinfo  --  Read in the "header" information about the Vgroup.
  VIstart    --  V-level initialization routine
  VPshutdown  --  Terminate various static buffers.
+ VPbuf_shutdown  --  Free the buffers of the calling thread.
 
 EXPORTED ROUTINES
 =================
@@ -103,6 +104,7 @@ EXPORTED ROUTINES
 
 #include "hdfi.h"
 #include "vgint.h"
+#include "hthread.h"
 
 /* These are used to determine whether a vgroup had been created by the
    library internally, that is, not created by user's application */
@@ -139,12 +141,12 @@ TBBT_TREE *vtree = NULL;
 static intn library_terminate = FALSE;
 
 /* Temporary buffer for I/O */
-static uint32 Vgbufsize = 0;
-static uint8 *Vgbuf     = NULL;
+static H4_THREAD_LOCAL uint32 Vgbufsize = 0;
+static H4_THREAD_LOCAL uint8 *Vgbuf     = NULL;
 
 /* Pointers to the VGROUP & vginstance node free lists */
-static VGROUP       *vgroup_free_list     = NULL;
-static vginstance_t *vginstance_free_list = NULL;
+static H4_THREAD_LOCAL VGROUP       *vgroup_free_list     = NULL;
+static H4_THREAD_LOCAL vginstance_t *vginstance_free_list = NULL;
 
 /*******************************************************************************
  NAME
@@ -642,6 +644,8 @@ Vinitialize(HFILEID f /* IN: file handle */)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -660,6 +664,7 @@ Vinitialize(HFILEID f /* IN: file handle */)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vinitialize() */
 
@@ -679,6 +684,8 @@ Vfinish(HFILEID f /* IN: file handle */)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -687,6 +694,7 @@ Vfinish(HFILEID f /* IN: file handle */)
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vfinish() */
 
@@ -1075,6 +1083,8 @@ Vattach(HFILEID     f,    /* IN: file handle */
     int16         acc_mode;
     atom_t        ret_value = FAIL;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1185,6 +1195,7 @@ Vattach(HFILEID     f,    /* IN: file handle */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vattach */
 
@@ -1216,6 +1227,8 @@ Vdetach(int32 vkey /* IN: vgroup key */)
     int32         vgpacksize;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1297,6 +1310,7 @@ Vdetach(int32 vkey /* IN: vgroup key */)
     v->nattach--;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vdetach */
 
@@ -1328,6 +1342,8 @@ Vinsert(int32 vkey, /* IN: vgroup key */
     uintn         u;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1398,6 +1414,7 @@ Vinsert(int32 vkey, /* IN: vgroup key */
     ret_value = (vg->nvelt - 1);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vinsert */
 
@@ -1423,6 +1440,8 @@ Vflocate(int32 vkey, /* IN: vdata key */
     int32         vskey;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1461,6 +1480,7 @@ Vflocate(int32 vkey, /* IN: vdata key */
     ret_value = (FAIL); /* field not found */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vflocate */
 
@@ -1488,6 +1508,8 @@ Vinqtagref(int32 vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     intn          ret_value = FALSE;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1513,6 +1535,7 @@ Vinqtagref(int32 vkey, /* IN: vgroup key */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vinqtagref */
 
@@ -1543,6 +1566,8 @@ Vdeletetagref(int32 vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL; /* in-memory vgroup struct */
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* NOTE: Move the following comments to the DESCRIPTION of the
              fcn when the issue with duplicate tag/refs is decided.
 
@@ -1610,6 +1635,7 @@ Vdeletetagref(int32 vkey, /* IN: vgroup key */
     ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vdeletetagref */
 
@@ -1631,6 +1657,8 @@ Vntagrefs(int32 vkey /* IN: vgroup key */)
     VGROUP       *vg        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1650,6 +1678,7 @@ Vntagrefs(int32 vkey /* IN: vgroup key */)
     ret_value = ((vg->otag == DFTAG_VG) ? (int32)vg->nvelt : FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vntagrefs */
 
@@ -1675,6 +1704,8 @@ Vnrefs(int32 vkey, /* IN: vgroup key */
     uintn         u;                  /* local counting variable */
     int32         ret_value = 0;      /* zero refs to start */
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1697,6 +1728,7 @@ Vnrefs(int32 vkey, /* IN: vgroup key */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vnrefs */
 
@@ -1726,6 +1758,8 @@ Vgettagrefs(int32 vkey,       /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1753,6 +1787,7 @@ Vgettagrefs(int32 vkey,       /* IN: vgroup key */
     ret_value = (n);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgettagrefs */
 
@@ -1781,6 +1816,8 @@ Vgettagref(int32  vkey,  /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1804,6 +1841,7 @@ Vgettagref(int32  vkey,  /* IN: vgroup key */
     *ref = (int32)vg->ref[which];
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgettagref */
 
@@ -1825,6 +1863,8 @@ VQuerytag(int32 vkey /* IN: vgroup key */)
     VGROUP       *vg        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1844,6 +1884,7 @@ VQuerytag(int32 vkey /* IN: vgroup key */)
     ret_value = ((int32)vg->otag);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VQuerytag */
 
@@ -1864,6 +1905,8 @@ VQueryref(int32 vkey /* IN: vgroup id */)
     VGROUP       *vg        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1883,6 +1926,7 @@ VQueryref(int32 vkey /* IN: vgroup id */)
     ret_value = ((int32)vg->oref);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VQueryref */
 
@@ -1915,6 +1959,8 @@ Vaddtagref(int32 vkey, /* IN: vgroup key */
 #endif /* NO_DUPLICATES */
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1943,6 +1989,7 @@ Vaddtagref(int32 vkey, /* IN: vgroup key */
     ret_value = vinsertpair(vg, (uint16)tag, (uint16)ref);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vaddtagref */
 
@@ -2010,6 +2057,8 @@ Ventries(HFILEID f, /* IN: file handle */
     vginstance_t *v         = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2026,6 +2075,7 @@ Ventries(HFILEID f, /* IN: file handle */
         ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Ventries */
 
@@ -2049,6 +2099,8 @@ Vsetname(int32       vkey, /* IN: vgroup key */
     size_t        name_len;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2085,6 +2137,7 @@ Vsetname(int32       vkey, /* IN: vgroup key */
     vg->marked = TRUE;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vsetname */
 
@@ -2111,6 +2164,8 @@ Vsetclass(int32       vkey, /* IN: vgroup key */
     size_t        classname_len;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2153,6 +2208,7 @@ Vsetclass(int32       vkey, /* IN: vgroup key */
     vg->marked = TRUE;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vsetclass */
 
@@ -2178,6 +2234,8 @@ Visvg(int32 vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     intn          ret_value = FALSE; /* initialize to FALSE */
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2205,6 +2263,7 @@ Visvg(int32 vkey, /* IN: vgroup key */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Visvg */
 
@@ -2229,6 +2288,8 @@ Visvs(int32 vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     intn          ret_value = FALSE; /* initialize to false */
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2252,6 +2313,7 @@ Visvs(int32 vkey, /* IN: vgroup key */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Visvs */
 
@@ -2280,6 +2342,8 @@ Vgetid(HFILEID f, /* IN: file handle */
     int32         key;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2321,6 +2385,7 @@ Vgetid(HFILEID f, /* IN: file handle */
         }                                   /* end else */
     }
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetid */
 
@@ -2353,6 +2418,8 @@ Vgetnext(int32 vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     int32         ret_value = FAIL;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2400,6 +2467,7 @@ Vgetnext(int32 vkey, /* IN: vgroup key */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetnext  */
 
@@ -2423,6 +2491,8 @@ Vgetnamelen(int32   vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2458,6 +2528,7 @@ Vgetnamelen(int32   vkey, /* IN: vgroup key */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetnamelen */
 
@@ -2481,6 +2552,8 @@ Vgetclassnamelen(int32   vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2512,6 +2585,7 @@ Vgetclassnamelen(int32   vkey, /* IN: vgroup key */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetclassnamelen */
 
@@ -2536,6 +2610,8 @@ Vgetname(int32 vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2559,6 +2635,7 @@ Vgetname(int32 vkey, /* IN: vgroup key */
         vgname[0] = '\0';
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetname */
 
@@ -2583,6 +2660,8 @@ Vgetclass(int32 vkey, /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2606,6 +2685,7 @@ Vgetclass(int32 vkey, /* IN: vgroup key */
         vgclass[0] = '\0';
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetclass */
 
@@ -2633,6 +2713,8 @@ Vinquire(int32  vkey,     /* IN: vgroup key */
     VGROUP       *vg        = NULL;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2662,6 +2744,7 @@ Vinquire(int32  vkey,     /* IN: vgroup key */
         *nentries = (int32)vg->nvelt;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vinquire */
 
@@ -2694,6 +2777,8 @@ Vopen(char *path,     /* IN: file name */
 {
     HFILEID ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2706,6 +2791,7 @@ Vopen(char *path,     /* IN: file name */
         HGOTO_ERROR(DFE_CANTINIT, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vopen() */
 
@@ -2731,11 +2817,14 @@ Vclose(HFILEID f /* IN: file handle */)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (Vfinish(f) == FAIL)
         ret_value = FAIL;
     else
         ret_value = (Hclose(f));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vclose() */
 
@@ -2766,6 +2855,8 @@ Vdelete(int32 f, /* IN: file handle */
     filerec_t *file_rec  = NULL; /* file record */
     int32      ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2800,6 +2891,7 @@ Vdelete(int32 f, /* IN: file handle */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vdelete */
 
@@ -2836,21 +2928,21 @@ done:
 
 /*******************************************************************************
  NAME
-    VPshutdown  --  Terminate various static buffers.
+    VPbuf_shutdown  --  Free the buffers of the calling thread.
 
  DESCRIPTION
-    Free various buffers allocated in the V routines.
+    Free the free-lists and the buffer of the Vgroup routines, which are
+    kept per thread in a threadsafe build.
 
  RETURNS
-    Returns SUCCEED/FAIL
+    Returns SUCCEED
 
 *******************************************************************************/
 intn
-VPshutdown(void)
+VPbuf_shutdown(void)
 {
-    VGROUP       *v         = NULL;
-    vginstance_t *vg        = NULL;
-    intn          ret_value = SUCCEED;
+    VGROUP       *v  = NULL;
+    vginstance_t *vg = NULL;
 
     /* Release the vdata free-list if it exists */
     if (vgroup_free_list != NULL) {
@@ -2872,6 +2964,33 @@ VPshutdown(void)
         }
     }
 
+    if (Vgbuf != NULL) {
+        free(Vgbuf);
+        Vgbuf     = NULL;
+        Vgbufsize = 0;
+    }
+
+    return SUCCEED;
+} /* end VPbuf_shutdown() */
+
+/*******************************************************************************
+ NAME
+    VPshutdown  --  Terminate various static buffers.
+
+ DESCRIPTION
+    Free various buffers allocated in the V routines.
+
+ RETURNS
+    Returns SUCCEED/FAIL
+
+*******************************************************************************/
+intn
+VPshutdown(void)
+{
+    intn ret_value = SUCCEED;
+
+    VPbuf_shutdown();
+
     if (vtree != NULL) {
         /* Free the vfile tree */
         tbbtdfree(vtree, vfdestroynode, NULL);
@@ -2886,12 +3005,6 @@ VPshutdown(void)
         vtree = NULL;
     }
 
-    if (Vgbuf != NULL) {
-        free(Vgbuf);
-        Vgbuf     = NULL;
-        Vgbufsize = 0;
-    }
-
 done:
     return ret_value;
 } /* end VPshutdown() */
@@ -2921,6 +3034,8 @@ Vgisinternal(int32 vkey /* vgroup's identifier */)
     intn          is_internal = FALSE;
     intn          ret_value   = FALSE;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -2964,6 +3079,7 @@ Vgisinternal(int32 vkey /* vgroup's identifier */)
     ret_value = is_internal;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgisinternal */
 
@@ -3038,6 +3154,8 @@ Vgetvgroups(int32   id,       /* IN: file id or vgroup id */
     VGROUP       *vg        = NULL;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* Clear error stack */
     HEclear();
 
@@ -3181,5 +3299,6 @@ Vgetvgroups(int32   id,       /* IN: file id or vgroup id */
         HGOTO_ERROR(DFE_ARGS, FAIL);
     }
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* Vgetvgroups */
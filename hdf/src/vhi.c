@@ -24,6 +24,7 @@
 
 #include "hdfi.h"
 #include "vgint.h"
+#include "hthread.h"
 
 /* ------------------------ VHstoredata -------------------------------
    NAME
@@ -55,8 +56,11 @@ VHstoredata(HFILEID f, const char *field, const uint8 *buf, int32 n, int32 datat
     int32 order = 1;
     int32 ret_value;
 
+    H4_API_LOCK;
+
     ret_value = ((int32)VHstoredatam(f, field, buf, n, datatype, vsname, vsclass, order));
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* end VHstoredata */
 
@@ -92,6 +96,8 @@ VHstoredatam(HFILEID f, const char *field, const uint8 *buf, int32 n, int32 data
     int32 vs;
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if ((vs = VSattach(f, -1, "w")) == FAIL)
         HGOTO_ERROR(DFE_CANTATTACH, FAIL);
 
@@ -117,6 +123,7 @@ VHstoredatam(HFILEID f, const char *field, const uint8 *buf, int32 n, int32 data
     ret_value = ((int32)ref);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VHstoredatam */
 
@@ -154,6 +161,8 @@ VHmakegroup(HFILEID f, int32 tagarray[], int32 refarray[], int32 n, const char *
     int32 vg;
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if ((vg = Vattach(f, -1, "w")) == FAIL)
         HGOTO_ERROR(DFE_CANTATTACH, FAIL);
 
@@ -177,6 +186,7 @@ VHmakegroup(HFILEID f, int32 tagarray[], int32 refarray[], int32 n, const char *
     ret_value = (ref);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VHmakegroup */
 
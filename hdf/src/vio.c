@@ -60,17 +60,18 @@ EXPORTED ROUTINES
 
 #include "hdfi.h"
 #include "vgint.h"
+#include "hthread.h"
 
 /* Private Function Prototypes */
 static intn vunpackvs(VDATA *vs, uint8 buf[], int32 len);
 
 /* Temporary buffer for I/O */
-static uint32 Vhbufsize = 0;
-static uint8 *Vhbuf     = NULL;
+static H4_THREAD_LOCAL uint32 Vhbufsize = 0;
+static H4_THREAD_LOCAL uint8 *Vhbuf     = NULL;
 
 /* Pointers to the VDATA & vsinstance node free lists */
-static VDATA        *vdata_free_list      = NULL;
-static vsinstance_t *vsinstance_free_list = NULL;
+static H4_THREAD_LOCAL VDATA        *vdata_free_list      = NULL;
+static H4_THREAD_LOCAL vsinstance_t *vsinstance_free_list = NULL;
 
 /* vpackvs is prototyped in vg.h since vconv.c needs to call it */
 
@@ -804,6 +805,8 @@ VSattach(HFILEID     f,    /* IN: file handle */
     int32         acc_mode;
     int32         ret_value = FAIL;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -945,6 +948,7 @@ VSattach(HFILEID     f,    /* IN: file handle */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSattach */
 
@@ -982,6 +986,8 @@ VSdetach(int32 vkey /* IN: vdata key? */)
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1087,6 +1093,7 @@ VSdetach(int32 vkey /* IN: vdata key? */)
     } /* end of 'write' case */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSdetach */
 
@@ -1108,6 +1115,8 @@ VSappendable(int32 vkey, /* IN: vdata key */
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     (void)blk;
 
     /* clear error stack */
@@ -1132,6 +1141,7 @@ VSappendable(int32 vkey, /* IN: vdata key */
         ret_value = Happendable(vs->aid);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSappendable */
 
@@ -1158,6 +1168,8 @@ VSgetid(HFILEID f, /* IN: file handle */
     int32         key;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1198,6 +1210,7 @@ VSgetid(HFILEID f, /* IN: file handle */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetid */
 
@@ -1220,6 +1233,8 @@ VSQuerytag(int32 vkey /* IN: vdata key */)
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1240,6 +1255,7 @@ VSQuerytag(int32 vkey /* IN: vdata key */)
     ret_value = ((int32)vs->otag);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSQuerytag */
 
@@ -1262,6 +1278,8 @@ VSQueryref(int32 vkey /* IN: vdata key */)
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1282,6 +1300,7 @@ VSQueryref(int32 vkey /* IN: vdata key */)
     ret_value = ((int32)vs->oref);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSQueryref */
 
@@ -1344,6 +1363,8 @@ VSgetversion(int32 vkey /* IN: vdata key */)
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1364,6 +1385,7 @@ VSgetversion(int32 vkey /* IN: vdata key */)
     ret_value = (int32)vs->version;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* end VSgetversion() */
 
@@ -1392,6 +1414,8 @@ VSdelete(int32 f, /* IN: file handle */
     int32    key;
     int32    ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -1423,5 +1447,6 @@ VSdelete(int32 f, /* IN: file handle */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSdelete */
@@ -24,16 +24,17 @@
 
 #include "hdfi.h"
 #include "vgint.h"
+#include "hthread.h"
 
 #define ISCOMMA(c) ((c == ',') ? 1 : 0)
 
-static char *symptr[VSFIELDMAX];                   /* array of ptrs to tokens  ? */
-static char  sym[VSFIELDMAX][FIELDNAMELENMAX + 1]; /* array of tokens ? */
-static intn  nsym;                                 /* token index ? */
+static H4_THREAD_LOCAL char *symptr[VSFIELDMAX];                   /* array of ptrs to tokens  ? */
+static H4_THREAD_LOCAL char  sym[VSFIELDMAX][FIELDNAMELENMAX + 1]; /* array of tokens ? */
+static H4_THREAD_LOCAL intn  nsym;                                 /* token index ? */
 
 /* Temporary buffer for I/O */
-static uint32 Vpbufsize = 0;
-static uint8 *Vpbuf     = NULL;
+static H4_THREAD_LOCAL uint32 Vpbufsize = 0;
+static H4_THREAD_LOCAL uint8 *Vpbuf     = NULL;
 
 /*******************************************************************************
  NAME
@@ -36,13 +36,14 @@ EXPORTED ROUTINES
 
 #include "hdfi.h"
 #include "vgint.h"
+#include "hthread.h"
 
 #ifndef MIN
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif /* MIN */
 
-static uint32 Vtbufsize = 0;
-static uint8 *Vtbuf     = NULL;
+static H4_THREAD_LOCAL uint32 Vtbufsize = 0;
+static H4_THREAD_LOCAL uint8 *Vtbuf     = NULL;
 
 /*******************************************************************************
  NAME
@@ -101,6 +102,8 @@ VSseek(int32 vkey, /* IN: vdata key */
     VDATA        *vs        = NULL;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -131,6 +134,7 @@ VSseek(int32 vkey, /* IN: vdata key */
     ret_value = (eltpos);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSseek */
 
@@ -176,6 +180,8 @@ VSread(int32 vkey,  /* IN: vdata key */
     VDATA          *vs        = NULL;
     int32           ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -421,6 +427,7 @@ VSread(int32 vkey,  /* IN: vdata key */
     ret_value = (nelt);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSread */
 
@@ -470,6 +477,8 @@ VSwrite(int32       vkey,  /* IN: vdata key */
     int32           done; /* number of records to do / done */
     int32           ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -725,5 +734,6 @@ VSwrite(int32       vkey,  /* IN: vdata key */
     ret_value = (nelt);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSwrite */
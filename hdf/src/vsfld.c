@@ -40,6 +40,7 @@ EXPORTED ROUTINES
 
 #include "hdfi.h"
 #include "vgint.h"
+#include "hthread.h"
 
 /*
  ** ==================================================================
@@ -82,6 +83,8 @@ VSsetfields(int32 vkey, const char *fields)
     VDATA          *vs;
     intn            ret_value = FAIL;
 
+    H4_API_LOCK;
+
     /* check if a NULL field list is passed in, then return with
        error (bug #554) - BMR 4/30/01 */
     if (fields == NULL)
@@ -242,6 +245,7 @@ VSsetfields(int32 vkey, const char *fields)
     } /* setting read list */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsetfields */
 
@@ -263,6 +267,8 @@ VSfdefine(int32 vkey, const char *field, int32 localtype, int32 order)
     VDATA        *vs;
     intn          ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -327,6 +333,7 @@ VSfdefine(int32 vkey, const char *field, int32 localtype, int32 order)
         vs->nusym++;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSfdefine */
 
@@ -342,6 +349,8 @@ VFnfields(int32 vkey)
     VDATA        *vs;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -356,6 +365,7 @@ VFnfields(int32 vkey)
     ret_value = ((int32)vs->wlist.n);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VFnfields */
 
@@ -374,6 +384,8 @@ VFfieldname(int32 vkey, int32 index)
     VDATA        *vs;
     char         *ret_value = NULL; /* FAIL */
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, NULL);
 
@@ -391,6 +403,7 @@ VFfieldname(int32 vkey, int32 index)
     ret_value = ((char *)vs->wlist.name[index]);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VFfieldname */
 
@@ -407,6 +420,8 @@ VFfieldtype(int32 vkey, int32 index)
     VDATA        *vs;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -424,6 +439,7 @@ VFfieldtype(int32 vkey, int32 index)
     ret_value = ((int32)vs->wlist.type[index]);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VFfieldtype */
 
@@ -441,6 +457,8 @@ VFfieldisize(int32 vkey, int32 index)
     VDATA        *vs;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -458,6 +476,7 @@ VFfieldisize(int32 vkey, int32 index)
     ret_value = ((int32)vs->wlist.isize[index]);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VFfieldisize */
 
@@ -475,6 +494,8 @@ VFfieldesize(int32 vkey, int32 index)
     VDATA        *vs;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -492,6 +513,7 @@ VFfieldesize(int32 vkey, int32 index)
     ret_value = ((int32)vs->wlist.esize[index]);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VFfieldesize */
 
@@ -508,6 +530,8 @@ VFfieldorder(int32 vkey, int32 index)
     VDATA        *vs;
     int32         ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -525,6 +549,7 @@ VFfieldorder(int32 vkey, int32 index)
     ret_value = ((int32)vs->wlist.order[index]);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VFfieldorder */
 
@@ -564,6 +589,8 @@ VSsetexternalfile(int32 vkey, const char *filename, int32 offset)
     VDATA        *vs;
     intn          status;
 
+    H4_API_LOCK;
+
     if (!filename || offset < 0)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -597,6 +624,7 @@ VSsetexternalfile(int32 vkey, const char *filename, int32 offset)
         ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSsetexternalfile */
 
@@ -632,6 +660,8 @@ VSgetexternalfile(int32 vkey, uintn buf_size, char *ext_filename, int32 *offset)
     intn            actual_len = 0;
     intn            ret_value  = SUCCEED;
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -686,6 +716,7 @@ VSgetexternalfile(int32 vkey, uintn buf_size, char *ext_filename, int32 *offset)
             ret_value = FAIL;
     }
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetexternalfile */
 
@@ -733,6 +764,8 @@ VSgetexternalinfo(int32 vkey, uintn buf_size, char *ext_filename, int32 *offset,
     intn          actual_fname_len = 0;
     intn          ret_value        = SUCCEED;
 
+    H4_API_LOCK;
+
     if (HAatom_group(vkey) != VSIDGROUP)
         HGOTO_ERROR(DFE_ARGS, FAIL);
 
@@ -807,6 +840,7 @@ VSgetexternalinfo(int32 vkey, uintn buf_size, char *ext_filename, int32 *offset,
             ret_value = 0; /* no external file name */
     }
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSgetexternalinfo */
 
@@ -862,6 +896,9 @@ VSfpack(int32 vsid, intn packtype, const char *fields_in_buf, void *buf, intn bu
     vsinstance_t   *wi;
     VDATA          *vs;
     DYN_VWRITELIST *w;
+
+    H4_API_LOCK;
+
     struct blist_t { /* contains info about fields in buf */
         intn   n;    /* number of fields in buf     */
         int32 *idx;  /* index of buf fields in vdata */
@@ -1012,6 +1049,7 @@ done:
     free(foffs);
     free(fbufps);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* VSfpack */
 /*--------------------------------------------------------- */
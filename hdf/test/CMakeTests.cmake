@@ -81,6 +81,11 @@ set (HDF4_TESTHDF_FILES
     tcomp.hdf
     tdf24.hdf
     tdfan.hdf
+    tfiledrv.hdf
+    tfind.hdf
+    tcompact.hdf
+    tspace.hdf
+    tsync.hdf
     temp.hdf
     thf.hdf
     tjpeg.hdf
@@ -90,6 +95,7 @@ set (HDF4_TESTHDF_FILES
     tmgratt.hdf
     tmgrchk.hdf
     tnbit.hdf
+    tnewref.hdf
     tref.hdf
     tuservds.hdf
     tuservgs.hdf
@@ -198,3 +204,42 @@ if (NOT WIN32)
   endif ()
   set (last_test "HDF_TEST-buffer")
 endif ()
+
+#-- Adding test for openbench
+if (NOT WIN32)
+  add_test (NAME HDF_TEST-openbench COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:openbench>)
+  set_tests_properties (HDF_TEST-openbench PROPERTIES
+      WORKING_DIRECTORY ${PROJECT_BINARY_DIR}/TEST
+      LABELS ${PROJECT_NAME}
+  )
+  if (NOT "${last_test}" STREQUAL "")
+    set_tests_properties (HDF_TEST-openbench PROPERTIES DEPENDS ${last_test})
+  endif ()
+  set (last_test "HDF_TEST-openbench")
+endif ()
+
+#-- Adding test for atombench
+if (NOT WIN32)
+  add_test (NAME HDF_TEST-atombench COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:atombench>)
+  set_tests_properties (HDF_TEST-atombench PROPERTIES
+      WORKING_DIRECTORY ${PROJECT_BINARY_DIR}/TEST
+      LABELS ${PROJECT_NAME}
+  )
+  if (NOT "${last_test}" STREQUAL "")
+    set_tests_properties (HDF_TEST-atombench PROPERTIES DEPENDS ${last_test})
+  endif ()
+  set (last_test "HDF_TEST-atombench")
+endif ()
+
+#-- Adding test for treebench
+if (NOT WIN32)
+  add_test (NAME HDF_TEST-treebench COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:treebench>)
+  set_tests_properties (HDF_TEST-treebench PROPERTIES
+      WORKING_DIRECTORY ${PROJECT_BINARY_DIR}/TEST
+      LABELS ${PROJECT_NAME}
+  )
+  if (NOT "${last_test}" STREQUAL "")
+    set_tests_properties (HDF_TEST-treebench PROPERTIES DEPENDS ${last_test})
+  endif ()
+  set (last_test "HDF_TEST-treebench")
+endif ()
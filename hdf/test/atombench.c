@@ -0,0 +1,244 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+    FILE - atombench.c
+        Benchmark the cost of looking up the IDs handed out by the library
+
+    DESIGN
+        - Create a file with many vdatas, one small record each.
+        - Attach all of them at once, so that as many vdata and access IDs
+            are alive at the same time.
+        - Call VSelts() and VSsizeof() on every vdata, over and over, and
+            report the average time per call.  Both calls do little more than
+            look up the objects behind the vdata ID.
+        - Report the time taken to attach and detach all the vdatas too.
+ */
+
+#define TESTMASTER
+
+#include "hdfi.h"
+#include "tutils.h"
+
+#define TESTFILE_NAME "tatombench.hdf"
+
+/* Default number of vdatas to create */
+#define NUM_VDATAS 10000
+
+/* Default number of passes over all the vdatas */
+#define NUM_PASSES 100
+
+/* Name of the field of the vdatas */
+#define FIELD_NAME "Value"
+
+/* Factor for converting seconds to microseconds */
+#define FACTOR 1000000
+
+/* local function prototypes */
+static void  usage(void);
+static char *fixname(const char *base_name, char *fullname, size_t size);
+static long  elapsed(const struct timeval *start_time);
+
+static void
+usage(void)
+{
+    printf("\nUsage: atombench [nvdatas [npasses]] \n\n");
+    printf("where nvdatas is the number of vdatas to create and attach (default: %d)\n", NUM_VDATAS);
+    printf("  and npasses is the number of calls made on each vdata (default: %d)\n", NUM_PASSES);
+    printf("\n");
+} /* end usage() */
+
+/*
+   Creates a file name from a file base name like 'test' and return it through
+   the FULLNAME (at most SIZE characters counting the null terminator). The
+   full name is created by prepending the contents of HDF4_TESTPREFIX
+   (separated from the base name by a slash). Returns NULL if BASENAME or
+   FULLNAME is the null pointer or if FULLNAME isn't large enough for the
+   result.
+*/
+static char *
+fixname(const char *base_name, char *fullname, size_t size)
+{
+    const char *prefix = NULL;
+    char       *ptr, last = '\0';
+    size_t      i, j;
+
+    if (!base_name || !fullname || size < 1)
+        return NULL;
+
+    memset(fullname, 0, size);
+
+    /* First use the environment variable, then try the constant */
+    prefix = getenv("HDF4_TESTPREFIX");
+
+#ifdef HDF4_TESTPREFIX
+    if (!prefix)
+        prefix = HDF4_TESTPREFIX;
+#endif
+
+    /* Prepend the prefix value to the base name */
+    if (prefix && *prefix) {
+        if (snprintf(fullname, size, "%s/%s", prefix, base_name) == (int)size)
+            /* Buffer is too small */
+            return NULL;
+    }
+    else {
+        if (strlen(base_name) >= size)
+            /* Buffer is too small */
+            return NULL;
+        else
+            strcpy(fullname, base_name);
+    }
+
+    /* Remove any double slashes in the filename */
+    for (ptr = fullname, i = j = 0; ptr && i < size; i++, ptr++) {
+        if (*ptr != '/' || last != '/')
+            fullname[j++] = *ptr;
+        last = *ptr;
+    }
+    return fullname;
+
+} /* end fixname() */
+
+/* Microseconds elapsed since START_TIME */
+static long
+elapsed(const struct timeval *start_time)
+{
+    struct timeval end_time;
+
+    gettimeofday(&end_time, NULL);
+    return (end_time.tv_sec - start_time->tv_sec) * FACTOR + (end_time.tv_usec - start_time->tv_usec);
+} /* end elapsed() */
+
+int
+main(int argc, char *argv[])
+{
+    struct timeval start_time;
+    int32          fid;      /* file ID of HDF file for testing */
+    int32          nvdatas;  /* number of vdatas to create */
+    int32          npasses;  /* number of calls on each vdata */
+    int32         *vsids;    /* IDs of the attached vdatas */
+    uint16        *refs;     /* refs of the vdatas */
+    int32          value;
+    long           attach_time, call_time, detach_time;
+    int32          sum = 0;
+    intn           ret;
+    char           hfilename[32];
+    uint32         lmajor, lminor, lrelease;
+    char           lstring[81];
+
+    /* Un-buffer stdout */
+    setbuf(stdout, NULL);
+
+    if (argc > 3) {
+        usage();
+        exit(1);
+    }
+    nvdatas = (argc >= 2) ? (int32)atol(argv[1]) : (int32)NUM_VDATAS;
+    npasses = (argc >= 3) ? (int32)atol(argv[2]) : (int32)NUM_PASSES;
+    if (nvdatas <= 0 || nvdatas > 65535 || npasses <= 0) {
+        usage();
+        exit(1);
+    }
+
+    Verbosity = 4; /* Default Verbosity is Low */
+
+    Hgetlibversion(&lmajor, &lminor, &lrelease, lstring);
+
+    printf("Built with HDF Library Version: %u.%u.%u, %s\n\n", (unsigned)lmajor, (unsigned)lminor,
+           (unsigned)lrelease, lstring);
+
+    MESSAGE(6, printf("Starting atom benchmark (nvdatas=%d, npasses=%d)\n", nvdatas, npasses);)
+
+    vsids = (int32 *)malloc((size_t)nvdatas * sizeof(int32));
+    refs  = (uint16 *)malloc((size_t)nvdatas * sizeof(uint16));
+    if (vsids == NULL || refs == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+
+    fixname(TESTFILE_NAME, hfilename, sizeof hfilename);
+
+    /* Create the file with one small vdata per data set */
+    fid = Hopen(hfilename, DFACC_CREATE, 0);
+    CHECK(fid, FAIL, "Hopen");
+    ret = Vstart(fid);
+    CHECK(ret, FAIL, "Vstart");
+    for (int32 i = 0; i < nvdatas; i++) {
+        int32 vsid = VSattach(fid, -1, "w");
+
+        if (vsid == FAIL) {
+            CHECK(vsid, FAIL, "VSattach");
+            nvdatas = i;
+            break;
+        }
+        ret = VSfdefine(vsid, FIELD_NAME, DFNT_INT32, 1);
+        CHECK(ret, FAIL, "VSfdefine");
+        ret = VSsetfields(vsid, FIELD_NAME);
+        CHECK(ret, FAIL, "VSsetfields");
+        value = i;
+        ret   = VSwrite(vsid, (uint8 *)&value, 1, FULL_INTERLACE);
+        VERIFY(ret, 1, "VSwrite");
+        refs[i] = (uint16)VSQueryref(vsid);
+        ret     = VSdetach(vsid);
+        CHECK(ret, FAIL, "VSdetach");
+    }
+    ret = Vend(fid);
+    CHECK(ret, FAIL, "Vend");
+    ret = Hclose(fid);
+    CHECK(ret, FAIL, "Hclose");
+
+    /* Attach all the vdatas at once */
+    fid = Hopen(hfilename, DFACC_READ, 0);
+    CHECK(fid, FAIL, "Hopen");
+    ret = Vstart(fid);
+    CHECK(ret, FAIL, "Vstart");
+    gettimeofday(&start_time, NULL);
+    for (int32 i = 0; i < nvdatas; i++) {
+        vsids[i] = VSattach(fid, (int32)refs[i], "r");
+        CHECK(vsids[i], FAIL, "VSattach");
+    }
+    attach_time = elapsed(&start_time);
+
+    /* Time the calls, going through all the vdatas each pass */
+    gettimeofday(&start_time, NULL);
+    for (int32 n = 0; n < npasses; n++)
+        for (int32 i = 0; i < nvdatas; i++)
+            sum += VSelts(vsids[i]) + VSsizeof(vsids[i], FIELD_NAME);
+    call_time = elapsed(&start_time);
+    VERIFY(sum, npasses * nvdatas * (1 + (int32)sizeof(int32)), "VSelts/VSsizeof");
+
+    gettimeofday(&start_time, NULL);
+    for (int32 i = 0; i < nvdatas; i++) {
+        ret = VSdetach(vsids[i]);
+        CHECK(ret, FAIL, "VSdetach");
+    }
+    detach_time = elapsed(&start_time);
+
+    ret = Vend(fid);
+    CHECK(ret, FAIL, "Vend");
+    ret = Hclose(fid);
+    CHECK(ret, FAIL, "Hclose");
+
+    printf("Vdatas attached:      %d\n", (int)nvdatas);
+    printf("Average attach time:  %f microseconds\n", (double)attach_time / nvdatas);
+    printf("Average call time:    %f microseconds\n", (double)call_time / (2.0 * npasses * nvdatas));
+    printf("Average detach time:  %f microseconds\n", (double)detach_time / nvdatas);
+
+    free(vsids);
+    free(refs);
+    remove(hfilename);
+
+    MESSAGE(6, printf("Finished atom benchmark\n");)
+    return num_errs;
+} /* end main() */
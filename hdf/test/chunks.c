@@ -90,6 +90,23 @@
  *       where each chunk is 1x1x4= 4 bytes , total data size 24 bytes
  *       The element is compressed using RLE scheme.
  *
+ *    13. Create elements with thousands of chunks, one 2-D with the chunks
+ *       written out of order, one 1-D with dense chunks then chunks spread
+ *       out over a million chunk numbers, written backwards.  Reopen the
+ *       file and read all of the chunks back, then add one more chunk.
+ *
+ *    14. Share a chunk cache of a few chunks between 3 elements of the
+ *       file, with each eviction policy: write chunks of all of them in
+ *       turn, so that the dirty chunks of one are written out to make
+ *       room for another's, and read them back.  Check the cache stays
+ *       within its budget, that a chunk in it is not read again, and
+ *       that ARC keeps chunks used twice through a scan where LRU does not.
+ *
+ *    15. Create a 2-D element of 10x100 chunks compressed with deflate,
+ *       writing all but the last row of chunks.  Read it all back with
+ *       the chunks decompressed on 4 threads, in several batches, and
+ *       verify; the chunks not written are filled.
+ *
  *  For all the tests the data is read back in and verified.
  *
  *  Routines tested using User level H-level calls:
@@ -119,6 +136,45 @@
 static uint8 *outbuf = NULL;
 static uint8 *inbuf  = NULL;
 
+/* Test 13: the 2-D element has NROW_CHUNKS chunks of 1x2, the 1-D one has
+   NSPARSE_CHUNKS chunks of 1 spread out over SPARSE_DIM chunk numbers */
+#define NROW_CHUNKS    3000
+#define NSPARSE_CHUNKS 500
+#define SPARSE_DIM     1000000
+#define SPARSE_CHUNK(i) (SPARSE_DIM - 1 - 397 * (i))
+
+/* Test 14: NCACHE_ELEMS elements of NCACHE_CHUNKS chunks of CACHE_CHUNK
+   bytes, sharing a cache of CACHE_SLOTS chunks */
+#define NCACHE_ELEMS  3
+#define NCACHE_CHUNKS 10
+#define CACHE_CHUNK   100
+#define CACHE_SLOTS   4
+
+/* Test 15: an element of THREAD_ROWS x THREAD_COLS bytes in chunks of
+   THREAD_CHUNK x THREAD_CHUNK, the last row of chunks not written */
+#define THREAD_ROWS    60
+#define THREAD_COLS    600
+#define THREAD_CHUNK   6
+#define THREAD_WRITTEN (THREAD_ROWS - THREAD_CHUNK)
+#define THREAD_DATA(r, c) ((uint8)(((r) * 7 + (c) * 3 + (r) / THREAD_CHUNK) % 251 + 1))
+
+/* Test 16: the same element, its chunks compressed on several threads */
+#define ENCODE_DATA(r, c) ((uint8)(((r) / 2 + (c) / 5) % 13 + 1))
+
+/* Test 17: elements of WHOLE_ROWS x WHOLE_COLS bytes in chunks of
+   WHOLE_CHUNK rows, as wide as the element or WHOLE_NARROW wide */
+#define WHOLE_ROWS   200
+#define WHOLE_COLS   30
+#define WHOLE_CHUNK  4
+#define WHOLE_NARROW 7
+#define WHOLE_DATA(r, c) ((uint8)(((r) * 31 + (c)) % 253))
+
+static void test_chunk_table(void);
+static void test_chunk_cache(void);
+static void test_chunk_threads(void);
+static void test_chunk_encode_threads(void);
+static void test_chunk_read_whole(void);
+
 /* used to verify data in Test 2. */
 static uint8 outbuf_2[16] = {0, 0, 2, 3, 0, 0, 6, 7, 8, 9, 0, 0, 12, 13, 0, 0};
 
@@ -157,6 +213,570 @@ static uint16 u16_data[2][3][4] = {{{0, 1, 2, 3}, {10, 11, 12, 13}, {20, 21, 22,
 static uint8 u8_data[2][3][4] = {{{0, 1, 2, 3}, {10, 11, 12, 13}, {20, 21, 22, 23}},
                                  {{100, 101, 102, 103}, {110, 111, 112, 113}, {120, 121, 122, 123}}};
 
+/* Test 13: elements with many chunks, dense and sparse */
+static void
+test_chunk_table(void)
+{
+    HCHUNK_DEF chunk[1];
+    DIM_DEF    pdims[2];
+    int32      fid, aid1, aid2;
+    int32      origin[2];
+    int32      i, ret;
+    uint8      fill_val = 0xEE;
+    uint8      buf[2];
+
+    MESSAGE(5, printf("Test 13. Create elements with many chunks, dense and sparse\n"););
+
+    fid = Hopen(TESTFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    memset(chunk, 0, sizeof(chunk));
+    chunk[0].pdims      = pdims;
+    chunk[0].nt_size    = 1;
+    chunk[0].comp_type  = COMP_CODE_NONE;
+    chunk[0].model_type = COMP_MODEL_STDIO;
+
+    /* 2-D, NROW_CHUNKS chunks of 1x2, written out of order */
+    chunk[0].num_dims              = 2;
+    chunk[0].chunk_size            = 2;
+    chunk[0].pdims[0].dim_length   = NROW_CHUNKS;
+    chunk[0].pdims[0].chunk_length = 1;
+    chunk[0].pdims[0].distrib_type = 1;
+    chunk[0].pdims[1].dim_length   = 2;
+    chunk[0].pdims[1].chunk_length = 2;
+    chunk[0].pdims[1].distrib_type = 1;
+    aid1 = HMCcreate(fid, 1020, 30, 1, 1, &fill_val, chunk);
+    CHECK_VOID(aid1, FAIL, "HMCcreate");
+    for (i = 0; i < NROW_CHUNKS; i++) {
+        origin[0] = (7 * i) % NROW_CHUNKS;
+        origin[1] = 0;
+        buf[0]    = (uint8)origin[0];
+        buf[1]    = (uint8)(origin[0] >> 8);
+        ret       = HMCwriteChunk(aid1, origin, buf);
+        VERIFY_VOID(ret, 2, "HMCwriteChunk");
+    }
+    ret = Hendaccess(aid1);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    /* 1-D, first dense chunks, then spread out chunks written backwards */
+    chunk[0].num_dims              = 1;
+    chunk[0].chunk_size            = 1;
+    chunk[0].pdims[0].dim_length   = SPARSE_DIM;
+    chunk[0].pdims[0].chunk_length = 1;
+    aid2 = HMCcreate(fid, 1020, 31, 1, 1, &fill_val, chunk);
+    CHECK_VOID(aid2, FAIL, "HMCcreate");
+    for (i = 0; i < 100; i++) {
+        origin[0] = i;
+        buf[0]    = (uint8)i;
+        ret       = HMCwriteChunk(aid2, origin, buf);
+        VERIFY_VOID(ret, 1, "HMCwriteChunk");
+    }
+    for (i = 0; i < NSPARSE_CHUNKS; i++) {
+        origin[0] = SPARSE_CHUNK(i);
+        buf[0]    = (uint8)(i + 1);
+        ret       = HMCwriteChunk(aid2, origin, buf);
+        VERIFY_VOID(ret, 1, "HMCwriteChunk");
+    }
+    ret = Hendaccess(aid2);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    /* Read them all back from the chunk tables */
+    fid = Hopen(TESTFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    aid1 = Hstartread(fid, 1020, 30);
+    CHECK_VOID(aid1, FAIL, "Hstartread");
+    for (i = 0; i < NROW_CHUNKS; i++) {
+        origin[0] = i;
+        origin[1] = 0;
+        ret       = HMCreadChunk(aid1, origin, buf);
+        VERIFY_VOID(ret, 2, "HMCreadChunk");
+        if (buf[0] != (uint8)i || buf[1] != (uint8)(i >> 8)) {
+            printf("Wrong data in chunk %d\n", (int)i);
+            num_errs++;
+            break;
+        }
+    }
+    ret = Hendaccess(aid1);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    aid2 = Hstartwrite(fid, 1020, 31, SPARSE_DIM);
+    CHECK_VOID(aid2, FAIL, "Hstartwrite");
+    for (i = 0; i < NSPARSE_CHUNKS; i++) {
+        origin[0] = SPARSE_CHUNK(i);
+        ret       = HMCreadChunk(aid2, origin, buf);
+        VERIFY_VOID(ret, 1, "HMCreadChunk");
+        VERIFY_VOID(buf[0], (uint8)(i + 1), "HMCreadChunk");
+
+        origin[0]--; /* never written */
+        ret = HMCreadChunk(aid2, origin, buf);
+        VERIFY_VOID(ret, 1, "HMCreadChunk");
+        VERIFY_VOID(buf[0], fill_val, "HMCreadChunk");
+    }
+    origin[0] = 99;
+    ret       = HMCreadChunk(aid2, origin, buf);
+    VERIFY_VOID(buf[0], 99, "HMCreadChunk");
+
+    /* One more chunk, in the middle of the others */
+    origin[0] = SPARSE_DIM / 2;
+    buf[0]    = 0x55;
+    ret       = HMCwriteChunk(aid2, origin, buf);
+    VERIFY_VOID(ret, 1, "HMCwriteChunk");
+    ret = Hendaccess(aid2);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    aid2 = Hstartread(fid, 1020, 31);
+    CHECK_VOID(aid2, FAIL, "Hstartread");
+    origin[0] = SPARSE_DIM / 2;
+    ret       = HMCreadChunk(aid2, origin, buf);
+    VERIFY_VOID(buf[0], 0x55, "HMCreadChunk");
+    origin[0] = SPARSE_CHUNK(NSPARSE_CHUNKS - 1);
+    ret       = HMCreadChunk(aid2, origin, buf);
+    VERIFY_VOID(buf[0], (uint8)NSPARSE_CHUNKS, "HMCreadChunk");
+    ret = Hendaccess(aid2);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+} /* test_chunk_table() */
+
+/* Reads chunk 'c' of the element 'aid' of Test 14 and checks its data */
+static void
+check_cache_chunk(int32 aid, intn elem, int32 c)
+{
+    uint8 buf[CACHE_CHUNK];
+    int32 ret;
+
+    ret = HMCreadChunk(aid, &c, buf);
+    VERIFY_VOID(ret, CACHE_CHUNK, "HMCreadChunk");
+    if (buf[0] != (uint8)(elem * NCACHE_CHUNKS + c) || buf[CACHE_CHUNK - 1] != (uint8)c) {
+        printf("Wrong data in chunk %d of element %d\n", (int)c, (int)elem);
+        num_errs++;
+    }
+} /* check_cache_chunk() */
+
+/* Test 14: a chunk cache shared by the elements of a file */
+static void
+test_chunk_cache(void)
+{
+    HCHUNK_DEF    chunk[1];
+    DIM_DEF       pdims[1];
+    hdf_iostats_t stats;
+    int32         fid, aid[NCACHE_ELEMS];
+    int32         size, used, ret;
+    int32         c;
+    intn          policy, rpolicy, e;
+    uint8         fill_val = 0;
+    uint8         buf[CACHE_CHUNK];
+
+    MESSAGE(5, printf("Test 14. Share a chunk cache between the elements of a file\n"););
+
+    fid = Hopen(TESTFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    /* Bad arguments */
+    ret = Hsetchunkcache(fid, -1, HDF_CHUNK_CACHE_LRU);
+    VERIFY_VOID(ret, FAIL, "Hsetchunkcache");
+    ret = Hsetchunkcache(fid, CACHE_SLOTS * CACHE_CHUNK, HDF_CHUNK_CACHE_ARC + 1);
+    VERIFY_VOID(ret, FAIL, "Hsetchunkcache");
+
+    memset(chunk, 0, sizeof(chunk));
+    chunk[0].pdims                 = pdims;
+    chunk[0].nt_size               = 1;
+    chunk[0].num_dims              = 1;
+    chunk[0].chunk_size            = CACHE_CHUNK;
+    chunk[0].comp_type             = COMP_CODE_NONE;
+    chunk[0].model_type            = COMP_MODEL_STDIO;
+    chunk[0].pdims[0].dim_length   = NCACHE_CHUNKS * CACHE_CHUNK;
+    chunk[0].pdims[0].chunk_length = CACHE_CHUNK;
+    chunk[0].pdims[0].distrib_type = 1;
+
+    for (policy = HDF_CHUNK_CACHE_LRU; policy <= HDF_CHUNK_CACHE_ARC; policy++) {
+        ret = Hsetchunkcache(fid, CACHE_SLOTS * CACHE_CHUNK, policy);
+        CHECK_VOID(ret, FAIL, "Hsetchunkcache");
+        ret = Hgetchunkcache(fid, &size, &rpolicy, &used);
+        CHECK_VOID(ret, FAIL, "Hgetchunkcache");
+        VERIFY_VOID(size, CACHE_SLOTS * CACHE_CHUNK, "Hgetchunkcache");
+        VERIFY_VOID(rpolicy, policy, "Hgetchunkcache");
+        VERIFY_VOID(used, 0, "Hgetchunkcache");
+
+        /* Write the chunks of all the elements in turn */
+        for (e = 0; e < NCACHE_ELEMS; e++) {
+            aid[e] = HMCcreate(fid, 1020, (uint16)(40 + 4 * policy + e), 1, 1, &fill_val, chunk);
+            CHECK_VOID(aid[e], FAIL, "HMCcreate");
+        }
+        for (c = 0; c < NCACHE_CHUNKS; c++)
+            for (e = 0; e < NCACHE_ELEMS; e++) {
+                memset(buf, c, CACHE_CHUNK);
+                buf[0] = (uint8)(e * NCACHE_CHUNKS + c);
+                ret    = HMCwriteChunk(aid[e], &c, buf);
+                VERIFY_VOID(ret, CACHE_CHUNK, "HMCwriteChunk");
+            }
+        ret = Hgetchunkcache(fid, NULL, NULL, &used);
+        CHECK_VOID(ret, FAIL, "Hgetchunkcache");
+        VERIFY_VOID(used, CACHE_SLOTS * CACHE_CHUNK, "Hgetchunkcache");
+        for (e = 0; e < NCACHE_ELEMS; e++) {
+            ret = Hendaccess(aid[e]);
+            CHECK_VOID(ret, FAIL, "Hendaccess");
+        }
+        ret = Hgetchunkcache(fid, NULL, NULL, &used);
+        VERIFY_VOID(used, 0, "Hgetchunkcache");
+
+        /* Read them all back, the other way round */
+        for (e = 0; e < NCACHE_ELEMS; e++) {
+            aid[e] = Hstartread(fid, 1020, (uint16)(40 + 4 * policy + e));
+            CHECK_VOID(aid[e], FAIL, "Hstartread");
+        }
+        for (e = 0; e < NCACHE_ELEMS; e++)
+            for (c = NCACHE_CHUNKS - 1; c >= 0; c--)
+                check_cache_chunk(aid[e], e, c);
+        ret = Hgetchunkcache(fid, NULL, NULL, &used);
+        VERIFY_VOID(used, CACHE_SLOTS * CACHE_CHUNK, "Hgetchunkcache");
+
+        /* Chunks 0 and 1 of the first element are used twice, then 8
+           others once; the chunks still in the cache are not read again */
+        for (c = 0; c < 2 * NCACHE_CHUNKS; c++)
+            check_cache_chunk(aid[0], 0, c % 2);
+        for (c = 2; c < NCACHE_CHUNKS; c++)
+            check_cache_chunk(aid[1], 1, c);
+        ret = Hresetiostats(fid);
+        CHECK_VOID(ret, FAIL, "Hresetiostats");
+        check_cache_chunk(aid[1], 1, NCACHE_CHUNKS - 1);
+        check_cache_chunk(aid[0], 0, 0);
+        check_cache_chunk(aid[0], 0, 1);
+        ret = Hgetiostats(fid, &stats);
+        CHECK_VOID(ret, FAIL, "Hgetiostats");
+        if (policy == HDF_CHUNK_CACHE_ARC)
+            VERIFY_VOID(stats.reads, 0, "Hgetiostats");
+        else if (policy == HDF_CHUNK_CACHE_LRU)
+            VERIFY_VOID(stats.reads, 2, "Hgetiostats");
+
+        /* A smaller cache gives chunks up at once, one smaller than a
+           chunk still holds one */
+        ret = Hsetchunkcache(fid, CACHE_CHUNK / 2, policy);
+        CHECK_VOID(ret, FAIL, "Hsetchunkcache");
+        ret = Hgetchunkcache(fid, NULL, NULL, &used);
+        VERIFY_VOID(used, 0, "Hgetchunkcache");
+        for (e = 0; e < NCACHE_ELEMS; e++)
+            check_cache_chunk(aid[e], e, e);
+        ret = Hgetchunkcache(fid, NULL, NULL, &used);
+        VERIFY_VOID(used, CACHE_CHUNK, "Hgetchunkcache");
+
+        /* Without a shared cache, the elements opened afterwards keep
+           their own */
+        ret = Hsetchunkcache(fid, 0, policy);
+        CHECK_VOID(ret, FAIL, "Hsetchunkcache");
+        ret = Hgetchunkcache(fid, NULL, NULL, &used);
+        VERIFY_VOID(used, 0, "Hgetchunkcache");
+        for (e = 0; e < NCACHE_ELEMS; e++) {
+            check_cache_chunk(aid[e], e, NCACHE_CHUNKS - 1);
+            ret = Hendaccess(aid[e]);
+            CHECK_VOID(ret, FAIL, "Hendaccess");
+        }
+        aid[0] = Hstartread(fid, 1020, (uint16)(40 + 4 * policy));
+        CHECK_VOID(aid[0], FAIL, "Hstartread");
+        check_cache_chunk(aid[0], 0, 3);
+        ret = Hgetchunkcache(fid, NULL, NULL, &used);
+        VERIFY_VOID(used, 0, "Hgetchunkcache");
+        ret = Hendaccess(aid[0]);
+        CHECK_VOID(ret, FAIL, "Hendaccess");
+    }
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+} /* test_chunk_cache() */
+
+/* Test 15: compressed chunks decoded on several threads */
+static void
+test_chunk_threads(void)
+{
+    HCHUNK_DEF chunk[1];
+    DIM_DEF    pdims[2];
+    comp_info  cinfo;
+    model_info minfo;
+    int32      fid, aid, ret;
+    intn       r, c, nerrors = 0;
+    uint8      fill_val = 0;
+    uint8     *data;
+
+    MESSAGE(5, printf("Test 15. Decompress the chunks of an element on several threads\n"););
+
+    data = (uint8 *)malloc(THREAD_ROWS * THREAD_COLS);
+    CHECK_ALLOC(data, "data", "test_chunk_threads");
+
+    fid = Hopen(TESTFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    /* Bad arguments */
+    ret = Hsetchunkthreads(fid, -1);
+    VERIFY_VOID(ret, FAIL, "Hsetchunkthreads");
+
+    memset(chunk, 0, sizeof(chunk));
+    memset(&cinfo, 0, sizeof(cinfo));
+    cinfo.deflate.level            = 6;
+    chunk[0].pdims                 = pdims;
+    chunk[0].nt_size               = 1;
+    chunk[0].num_dims              = 2;
+    chunk[0].chunk_size            = THREAD_CHUNK * THREAD_CHUNK;
+    chunk[0].chunk_flag            = SPECIAL_COMP;
+    chunk[0].comp_type             = COMP_CODE_DEFLATE;
+    chunk[0].model_type            = COMP_MODEL_STDIO;
+    chunk[0].cinfo                 = &cinfo;
+    chunk[0].minfo                 = &minfo;
+    chunk[0].pdims[0].dim_length   = THREAD_ROWS;
+    chunk[0].pdims[0].chunk_length = THREAD_CHUNK;
+    chunk[0].pdims[0].distrib_type = 1;
+    chunk[0].pdims[1].dim_length   = THREAD_COLS;
+    chunk[0].pdims[1].chunk_length = THREAD_CHUNK;
+    chunk[0].pdims[1].distrib_type = 1;
+
+    for (r = 0; r < THREAD_WRITTEN; r++)
+        for (c = 0; c < THREAD_COLS; c++)
+            data[r * THREAD_COLS + c] = THREAD_DATA(r, c);
+    aid = HMCcreate(fid, 1020, 60, 1, 1, &fill_val, chunk);
+    CHECK_VOID(aid, FAIL, "HMCcreate");
+    ret = Hwrite(aid, THREAD_WRITTEN * THREAD_COLS, data);
+    VERIFY_VOID(ret, THREAD_WRITTEN * THREAD_COLS, "Hwrite");
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    ret = Hsetchunkthreads(fid, 4);
+    CHECK_VOID(ret, FAIL, "Hsetchunkthreads");
+
+    memset(data, 0xff, THREAD_ROWS * THREAD_COLS);
+    aid = Hstartread(fid, 1020, 60);
+    CHECK_VOID(aid, FAIL, "Hstartread");
+    ret = Hread(aid, THREAD_ROWS * THREAD_COLS, data);
+    VERIFY_VOID(ret, THREAD_ROWS * THREAD_COLS, "Hread");
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    for (r = 0; r < THREAD_ROWS && nerrors < 10; r++)
+        for (c = 0; c < THREAD_COLS && nerrors < 10; c++)
+            if (data[r * THREAD_COLS + c] != (r < THREAD_WRITTEN ? THREAD_DATA(r, c) : fill_val)) {
+                printf("Wrong data at [%d][%d] of the element decompressed on threads\n", (int)r, (int)c);
+                nerrors++;
+            }
+    num_errs += nerrors;
+
+    ret = Hsetchunkthreads(fid, 0);
+    CHECK_VOID(ret, FAIL, "Hsetchunkthreads");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    free(data);
+} /* test_chunk_threads() */
+
+/* Checks the data of the element of Test 16 */
+static void
+check_encoded(int32 aid, uint8 *data, const char *where)
+{
+    int32 ret;
+    intn  r, c, nerrors = 0;
+
+    memset(data, 0xff, THREAD_ROWS * THREAD_COLS);
+    ret = Hseek(aid, 0, DF_START);
+    CHECK_VOID(ret, FAIL, "Hseek");
+    ret = Hread(aid, THREAD_ROWS * THREAD_COLS, data);
+    VERIFY_VOID(ret, THREAD_ROWS * THREAD_COLS, "Hread");
+
+    for (r = 0; r < THREAD_ROWS && nerrors < 10; r++)
+        for (c = 0; c < THREAD_COLS && nerrors < 10; c++)
+            if (data[r * THREAD_COLS + c] != (r < THREAD_WRITTEN ? ENCODE_DATA(r, c) : 0)) {
+                printf("Wrong data at [%d][%d] of the element compressed on threads, %s\n", (int)r, (int)c,
+                       where);
+                nerrors++;
+            }
+    num_errs += nerrors;
+} /* check_encoded() */
+
+/* Test 16: compressed chunks encoded on several threads */
+static void
+test_chunk_encode_threads(void)
+{
+    HCHUNK_DEF chunk[1];
+    DIM_DEF    pdims[2];
+    comp_info  cinfo;
+    model_info minfo;
+    int32      fid, aid, ret;
+    int32      comp_size = 0, orig_size = 0;
+    intn       r, c;
+    uint8      fill_val = 0;
+    uint8     *data;
+
+    MESSAGE(5, printf("Test 16. Compress the chunks of an element on several threads\n"););
+
+    data = (uint8 *)malloc(THREAD_ROWS * THREAD_COLS);
+    CHECK_ALLOC(data, "data", "test_chunk_encode_threads");
+
+    fid = Hopen(TESTFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hsetchunkthreads(fid, 4);
+    CHECK_VOID(ret, FAIL, "Hsetchunkthreads");
+
+    memset(chunk, 0, sizeof(chunk));
+    memset(&cinfo, 0, sizeof(cinfo));
+    cinfo.deflate.level            = 6;
+    chunk[0].pdims                 = pdims;
+    chunk[0].nt_size               = 1;
+    chunk[0].num_dims              = 2;
+    chunk[0].chunk_size            = THREAD_CHUNK * THREAD_CHUNK;
+    chunk[0].chunk_flag            = SPECIAL_COMP;
+    chunk[0].comp_type             = COMP_CODE_DEFLATE;
+    chunk[0].model_type            = COMP_MODEL_STDIO;
+    chunk[0].cinfo                 = &cinfo;
+    chunk[0].minfo                 = &minfo;
+    chunk[0].pdims[0].dim_length   = THREAD_ROWS;
+    chunk[0].pdims[0].chunk_length = THREAD_CHUNK;
+    chunk[0].pdims[0].distrib_type = 1;
+    chunk[0].pdims[1].dim_length   = THREAD_COLS;
+    chunk[0].pdims[1].chunk_length = THREAD_CHUNK;
+    chunk[0].pdims[1].distrib_type = 1;
+
+    /* Write more chunks than are compressed at once, then read them back
+       from the cache, the chunks waiting to be compressed and the file */
+    for (r = 0; r < THREAD_WRITTEN; r++)
+        for (c = 0; c < THREAD_COLS; c++)
+            data[r * THREAD_COLS + c] = ENCODE_DATA(r, c);
+    aid = HMCcreate(fid, 1020, 61, 1, 1, &fill_val, chunk);
+    CHECK_VOID(aid, FAIL, "HMCcreate");
+    ret = Hwrite(aid, THREAD_WRITTEN * THREAD_COLS, data);
+    VERIFY_VOID(ret, THREAD_WRITTEN * THREAD_COLS, "Hwrite");
+    check_encoded(aid, data, "before closing");
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    /* The chunks must be compressed, and read back as usual */
+    ret = Hsetchunkthreads(fid, 0);
+    CHECK_VOID(ret, FAIL, "Hsetchunkthreads");
+    ret = HCPgetdatasize(fid, 1020, 61, &comp_size, &orig_size);
+    CHECK_VOID(ret, FAIL, "HCPgetdatasize");
+    if (comp_size <= 0 || comp_size >= THREAD_WRITTEN * THREAD_COLS) {
+        printf("The chunks compressed on threads take %d bytes\n", (int)comp_size);
+        num_errs++;
+    }
+    aid = Hstartread(fid, 1020, 61);
+    CHECK_VOID(aid, FAIL, "Hstartread");
+    check_encoded(aid, data, "read back");
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    free(data);
+} /* test_chunk_encode_threads() */
+
+/* Reads 'length' bytes of an element of Test 17 from 'posn' and checks
+   them; the byte at 'changed', if any, is 0 */
+static void
+check_whole(int32 aid, uint8 *data, int32 posn, int32 length, int32 changed, const char *where)
+{
+    int32 ret;
+    intn  i, nerrors = 0;
+
+    memset(data, 0xff, WHOLE_ROWS * WHOLE_COLS);
+    ret = Hseek(aid, posn, DF_START);
+    CHECK_VOID(ret, FAIL, "Hseek");
+    ret = Hread(aid, length, data);
+    VERIFY_VOID(ret, length, "Hread");
+
+    for (i = 0; i < length && nerrors < 10; i++) {
+        int32 k = posn + i;
+
+        if (data[i] != (k == changed ? 0 : WHOLE_DATA(k / WHOLE_COLS, k % WHOLE_COLS))) {
+            printf("Wrong data at byte %d of the element, %s\n", (int)k, where);
+            nerrors++;
+        }
+    }
+    num_errs += nerrors;
+} /* check_whole() */
+
+/* Test 17: chunks covered whole by a read copied at once, out of the cache */
+static void
+test_chunk_read_whole(void)
+{
+    HCHUNK_DEF chunk[1];
+    DIM_DEF    pdims[2];
+    comp_info  cinfo;
+    model_info minfo;
+    int32      fid, aid, ret;
+    int32      changed = 17 * WHOLE_COLS + 3; /* a byte rewritten while the element is open */
+    intn       r, c, e;
+    uint8      fill_val = 0;
+    uint8     *data;
+
+    MESSAGE(5, printf("Test 17. Read the chunks covered whole by a read at once\n"););
+
+    data = (uint8 *)malloc(WHOLE_ROWS * WHOLE_COLS);
+    CHECK_ALLOC(data, "data", "test_chunk_read_whole");
+
+    fid = Hopen(TESTFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    /* A plain element whose chunks are laid out as in the caller's buffer,
+       and a compressed one whose chunks are not */
+    for (e = 0; e < 2; e++) {
+        memset(chunk, 0, sizeof(chunk));
+        memset(&cinfo, 0, sizeof(cinfo));
+        cinfo.deflate.level            = 6;
+        chunk[0].pdims                 = pdims;
+        chunk[0].nt_size               = 1;
+        chunk[0].num_dims              = 2;
+        chunk[0].chunk_size            = WHOLE_CHUNK * (e == 0 ? WHOLE_COLS : WHOLE_NARROW);
+        chunk[0].chunk_flag            = (e == 0 ? 0 : SPECIAL_COMP);
+        chunk[0].comp_type             = (e == 0 ? COMP_CODE_NONE : COMP_CODE_DEFLATE);
+        chunk[0].model_type            = COMP_MODEL_STDIO;
+        chunk[0].cinfo                 = &cinfo;
+        chunk[0].minfo                 = &minfo;
+        chunk[0].pdims[0].dim_length   = WHOLE_ROWS;
+        chunk[0].pdims[0].chunk_length = WHOLE_CHUNK;
+        chunk[0].pdims[0].distrib_type = 1;
+        chunk[0].pdims[1].dim_length   = WHOLE_COLS;
+        chunk[0].pdims[1].chunk_length = (e == 0 ? WHOLE_COLS : WHOLE_NARROW);
+        chunk[0].pdims[1].distrib_type = 1;
+
+        for (r = 0; r < WHOLE_ROWS; r++)
+            for (c = 0; c < WHOLE_COLS; c++)
+                data[r * WHOLE_COLS + c] = WHOLE_DATA(r, c);
+        aid = HMCcreate(fid, 1020, (uint16)(62 + e), 1, 1, &fill_val, chunk);
+        CHECK_VOID(aid, FAIL, "HMCcreate");
+        ret = Hwrite(aid, WHOLE_ROWS * WHOLE_COLS, data);
+        VERIFY_VOID(ret, WHOLE_ROWS * WHOLE_COLS, "Hwrite");
+        ret = Hendaccess(aid);
+        CHECK_VOID(ret, FAIL, "Hendaccess");
+
+        /* With a small cache, the chunks covered whole by a read are kept
+           out of it */
+        aid = Hstartwrite(fid, 1020, (uint16)(62 + e), WHOLE_ROWS * WHOLE_COLS);
+        CHECK_VOID(aid, FAIL, "Hstartwrite");
+        ret = HMCsetMaxcache(aid, 2, 0);
+        VERIFY_VOID(ret, 2, "HMCsetMaxcache");
+        check_whole(aid, data, 0, WHOLE_ROWS * WHOLE_COLS, -1, "read whole");
+        check_whole(aid, data, 5 * WHOLE_COLS + 11, 150 * WHOLE_COLS, -1, "read in part");
+
+        /* A chunk changed in the cache is read from there */
+        ret = Hseek(aid, changed, DF_START);
+        CHECK_VOID(ret, FAIL, "Hseek");
+        ret = Hwrite(aid, 1, &fill_val);
+        VERIFY_VOID(ret, 1, "Hwrite");
+        check_whole(aid, data, 0, WHOLE_ROWS * WHOLE_COLS, changed, "changed");
+        ret = Hendaccess(aid);
+        CHECK_VOID(ret, FAIL, "Hendaccess");
+
+        aid = Hstartread(fid, 1020, (uint16)(62 + e));
+        CHECK_VOID(aid, FAIL, "Hstartread");
+        check_whole(aid, data, 0, WHOLE_ROWS * WHOLE_COLS, changed, "read back");
+        ret = Hendaccess(aid);
+        CHECK_VOID(ret, FAIL, "Hendaccess");
+    }
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    free(data);
+} /* test_chunk_read_whole() */
+
 /*
  * main entry point to tests the Special Chunking layer...
  */
@@ -380,6 +1000,40 @@ test_chunks(void)
     ret = Hclose(fid);
     CHECK_VOID(ret, FAIL, "Hclose");
 
+    MESSAGE(5, printf("Read 2-D, uint8 chunked element again with the POSIX driver \n"););
+    /* The POSIX driver reads the chunks of a request in one batch */
+    ret = Hsetdriver(HDF_DRIVER_POSIX);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+
+    fid = Hopen(TESTFILE_NAME, DFACC_RDONLY, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    aid1 = Hstartread(fid, 1020, 2);
+    CHECK_VOID(aid1, FAIL, "Hstartread");
+
+    memset(inbuf, 0, 16);
+    ret = Hread(aid1, 16, inbuf);
+    VERIFY_VOID(ret, 16, "Hread");
+
+    for (i = 0; i < 16; i++) {
+        if (inbuf[i] != outbuf[i]) {
+            printf("Wrong data at %d, out %d in %d\n", i, outbuf[i], inbuf[i]);
+            errors++;
+        }
+    }
+
+    ret = Hendaccess(aid1);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    /* Go back to the default driver for the other tests */
+    ret = Hsetdriver(HDF_DRIVER_STDIO);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+    if (errors)
+        goto done;
+
     /*
        2. Now create a new chunked 2-D element with same parameters
        before but write to 2 chunks of element using whole chunks.
@@ -2201,4 +2855,10 @@ done:
     free(inbuf);
 
     num_errs += errors; /* increment global error count */
+
+    test_chunk_table();
+    test_chunk_cache();
+    test_chunk_threads();
+    test_chunk_encode_threads();
+    test_chunk_read_whole();
 } /* test_chunks() */
@@ -40,16 +40,545 @@
    ** With illegal tag/ref.
    ** With wildcard.
    ** Open more access elements than there is space.
+   ** A closed access id stays invalid after many more Hstartread/Hendaccess.
+
+   * Hfind
+   ** Wildcard ref and wildcard tag searches, forwards and backwards, across
+      several DD blocks and after deleting and reusing DDs.
+
+   * Free space
+   ** Space of deleted elements is reused and the file doesn't grow.
+   ** Data shared with Hdupdd is kept when one of the DDs is deleted.
+   ** Data shared with Hdupdd is reused once all of the DDs are deleted.
+   ** Space of elements rewritten with HDreuse_tagref is reused.
+
+   * Hsync
+   ** Changed DD blocks next to each other are written at once.
+   ** Hsync doesn't write anything after Hdefersync, Hclose does.
+   ** Hdefersync caches the DDs of a file not caching them.
+
+   * Hcompact
+   ** Compact a file with many DD blocks, shared data and deleted elements.
+   ** Compact an open file.
 
  */
 
 #include "tproto.h"
+#include "atom.h"
 #define TESTFILE_NAME "t.hdf"
 #define BUF_SIZE      4096
 
+#define STALE_NCYCLES 1000 /* # of Hstartread/Hendaccess after the first access id is closed */
+
+#define FINDFILE_NAME "tfind.hdf"
+#define FIND_NELEMS   300 /* number of elements in the Hfind test file */
+#define FIND_NDDS     16  /* DDs per DD block, so the DDs span many blocks */
+
+#define SPACEFILE_NAME "tspace.hdf"
+#define SPACE_NELEMS   100 /* number of elements in the free space test file */
+#define SPACE_TAG      1100
+
+#define SYNCFILE_NAME "tsync.hdf"
+#define SYNC_NDDS     16  /* # of DDs per DD block in the Hsync test file */
+#define SYNC_NELEMS   160 /* # of DDs to add before the first Hsync */
+#define SYNC_NMORE    40  /* # of DDs to add after Hdefersync */
+#define SYNC_TAG      1200
+
+#define CMPFILE_NAME "tcompact.hdf"
+#define CMP_NELEMS   200 /* number of data elements in the Hcompact test file */
+#define CMP_NDDS     8   /* DDs per DD block before the file is compacted */
+#define CMP_TAG      1000
+#define CMP_DUPTAG   1001
+#define CMP_EMPTYTAG 1002
+#define CMPTMP_NAME  "tcompact.hdf.tmp" /* a user file Hcompact must leave alone */
+#define CMPTMP_TEXT  "not a temporary file\n"
+
 static uint8 *outbuf = NULL;
 static uint8 *inbuf  = NULL;
 
+static void check_find(int32 fid, uint16 search_tag, uint16 search_ref, intn direction, const uint16 *tags,
+                       const uint16 *refs, intn ndds);
+static void test_staleaid(int32 fid);
+static void test_hfind(void);
+static void test_hspace(void);
+static void test_hsync(void);
+static void test_hcompact(void);
+
+/* Keep reading the same element, as SDreaddata does, and check that the
+   first access id never comes back to life */
+static void
+test_staleaid(int32 fid)
+{
+    int32 aid, stale_aid, live_aid;
+    intn  ret;
+    int   i;
+
+    MESSAGE(5, printf("Checking that closed access ids stay invalid\n"););
+
+    live_aid = Hstartread(fid, (uint16)100, 1);
+    CHECK_VOID(live_aid, FAIL, "Hstartread");
+    stale_aid = Hstartread(fid, (uint16)100, 4);
+    CHECK_VOID(stale_aid, FAIL, "Hstartread");
+    ret = Hendaccess(stale_aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    for (i = 0; i < STALE_NCYCLES; i++) {
+        aid = Hstartread(fid, (uint16)100, 4);
+        CHECK_VOID(aid, FAIL, "Hstartread");
+        if (aid == stale_aid || HAatom_object(stale_aid) != NULL) {
+            fprintf(stderr, "Closed access id is valid again after %d Hstartread\n", i + 1);
+            num_errs++;
+            Hendaccess(aid);
+            break;
+        }
+        ret = Hendaccess(aid);
+        CHECK_VOID(ret, FAIL, "Hendaccess");
+    }
+
+    ret = Hendaccess(live_aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+} /* end test_staleaid() */
+
+/* Walk through all the matches of a search with Hfind and compare them with
+   the matching DDs of the full DD list in tags/refs */
+static void
+check_find(int32 fid, uint16 search_tag, uint16 search_ref, intn direction, const uint16 *tags,
+           const uint16 *refs, intn ndds)
+{
+    uint16 find_tag = 0, find_ref = 0;
+    int32  find_off, find_len;
+    intn   i = (direction == DF_FORWARD) ? 0 : ndds - 1;
+
+    for (;;) {
+        intn found;
+
+        /* Next expected match */
+        for (; i >= 0 && i < ndds; i += (direction == DF_FORWARD) ? 1 : -1)
+            if ((search_tag == DFTAG_WILDCARD || tags[i] == search_tag) &&
+                (search_ref == DFREF_WILDCARD || refs[i] == search_ref))
+                break;
+
+        found = Hfind(fid, search_tag, search_ref, &find_tag, &find_ref, &find_off, &find_len, direction);
+        if (i < 0 || i >= ndds) {
+            if (found != FAIL) {
+                fprintf(stderr, "ERROR: Hfind(%u,%u) found extra element %u/%u\n", (unsigned)search_tag,
+                        (unsigned)search_ref, (unsigned)find_tag, (unsigned)find_ref);
+                num_errs++;
+            }
+            break;
+        }
+        if (found == FAIL || find_tag != tags[i] || find_ref != refs[i]) {
+            fprintf(stderr, "ERROR: Hfind(%u,%u) returned %u/%u, should be %u/%u\n", (unsigned)search_tag,
+                    (unsigned)search_ref, (unsigned)find_tag, (unsigned)find_ref, (unsigned)tags[i],
+                    (unsigned)refs[i]);
+            num_errs++;
+            break;
+        }
+        i += (direction == DF_FORWARD) ? 1 : -1;
+    }
+} /* end check_find() */
+
+static void
+test_hfind(void)
+{
+    uint16 tags[FIND_NELEMS * 2], refs[FIND_NELEMS * 2];
+    uint16 find_tag = 0, find_ref = 0;
+    int32  find_off, find_len;
+    int32  fid;
+    intn   ndds = 0;
+    intn   ret;
+    int    i;
+
+    MESSAGE(5, printf("Testing wildcard searches with Hfind\n"););
+
+    fid = Hopen(FINDFILE_NAME, DFACC_CREATE, FIND_NDDS);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    /* Three tags interleaved, and a fourth sharing refs with them */
+    for (i = 0; i < FIND_NELEMS; i++) {
+        ret = Hputelement(fid, (uint16)(100 + i % 3), (uint16)(i + 1), outbuf, 4);
+        CHECK_VOID(ret, FAIL, "Hputelement");
+        if (i % 5 == 0) {
+            ret = Hputelement(fid, 200, (uint16)(i + 1), outbuf, 4);
+            CHECK_VOID(ret, FAIL, "Hputelement");
+        }
+    }
+
+    /* Search once, so the DDs of tag 100 are indexed before they change */
+    ret = Hfind(fid, 100, DFREF_WILDCARD, &find_tag, &find_ref, &find_off, &find_len, DF_FORWARD);
+    CHECK_VOID(ret, FAIL, "Hfind");
+
+    /* Delete some elements and reuse the freed DDs for new ones */
+    for (i = 0; i < FIND_NELEMS; i += 21) {
+        ret = Hdeldd(fid, (uint16)(100 + i % 3), (uint16)(i + 1));
+        CHECK_VOID(ret, FAIL, "Hdeldd");
+    }
+    for (i = 0; i < 5; i++) {
+        ret = Hputelement(fid, 100, (uint16)(1000 + i), outbuf, 4);
+        CHECK_VOID(ret, FAIL, "Hputelement");
+    }
+
+    /* Get the whole DD list, in order */
+    find_tag = find_ref = 0;
+    while (ndds < FIND_NELEMS * 2 && Hfind(fid, DFTAG_WILDCARD, DFREF_WILDCARD, &find_tag, &find_ref, &find_off,
+                                          &find_len, DF_FORWARD) != FAIL) {
+        tags[ndds] = find_tag;
+        refs[ndds] = find_ref;
+        ndds++;
+    }
+
+    for (i = 0; i < 2; i++) {
+        intn direction = (i == 0) ? DF_FORWARD : DF_BACKWARD;
+
+        check_find(fid, 100, DFREF_WILDCARD, direction, tags, refs, ndds);
+        check_find(fid, 102, DFREF_WILDCARD, direction, tags, refs, ndds);
+        check_find(fid, 200, DFREF_WILDCARD, direction, tags, refs, ndds);
+        check_find(fid, 300, DFREF_WILDCARD, direction, tags, refs, ndds);
+        check_find(fid, DFTAG_WILDCARD, 6, direction, tags, refs, ndds);
+        check_find(fid, DFTAG_WILDCARD, 22, direction, tags, refs, ndds);
+        check_find(fid, DFTAG_WILDCARD, 1002, direction, tags, refs, ndds);
+        check_find(fid, DFTAG_WILDCARD, 5000, direction, tags, refs, ndds);
+    }
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+} /* end test_hfind() */
+
+/* Get the size of a file, -1 if it can't be found */
+static long
+file_size(const char *name)
+{
+    FILE *fp;
+    long  size = -1;
+
+    if ((fp = fopen(name, "rb")) != NULL) {
+        if (fseek(fp, 0L, SEEK_END) == 0)
+            size = ftell(fp);
+        fclose(fp);
+    }
+    return size;
+} /* end file_size() */
+
+static void
+test_hspace(void)
+{
+    int32 fid;
+    int32 offset;
+    long  size, new_size;
+    intn  ret;
+    int   i, j;
+
+    MESSAGE(5, printf("Testing reuse of free space\n"););
+
+    fid = Hopen(SPACEFILE_NAME, DFACC_CREATE, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    for (i = 0; i < SPACE_NELEMS; i++) {
+        memset(outbuf, i, 1000);
+        ret = Hputelement(fid, SPACE_TAG, (uint16)(i + 1), outbuf, 1000);
+        CHECK_VOID(ret, FAIL, "Hputelement");
+    }
+    ret = Hdupdd(fid, SPACE_TAG + 1, 1, SPACE_TAG, 4);
+    CHECK_VOID(ret, FAIL, "Hdupdd");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    size = file_size(SPACEFILE_NAME);
+
+    /* Delete every other element, and the one whose data is shared, then
+       write new ones a bit smaller in place of the unshared ones */
+    fid = Hopen(SPACEFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hdeldd(fid, SPACE_TAG, 4);
+    CHECK_VOID(ret, FAIL, "Hdeldd");
+    for (i = 0; i < SPACE_NELEMS; i += 2) {
+        ret = Hdeldd(fid, SPACE_TAG, (uint16)(i + 1));
+        CHECK_VOID(ret, FAIL, "Hdeldd");
+    }
+    for (i = 0; i < SPACE_NELEMS; i += 2) {
+        memset(outbuf, 0xff - i, 900);
+        ret = Hputelement(fid, SPACE_TAG + 2, (uint16)(i + 1), outbuf, 900);
+        CHECK_VOID(ret, FAIL, "Hputelement");
+    }
+
+    /* Rewrite some elements in place of their old data */
+    for (i = 1; i < SPACE_NELEMS; i += 10) {
+        ret = HDreuse_tagref(fid, SPACE_TAG, (uint16)(i + 1));
+        CHECK_VOID(ret, FAIL, "HDreuse_tagref");
+        memset(outbuf, 0x80 + i, 1000);
+        ret = Hputelement(fid, SPACE_TAG, (uint16)(i + 1), outbuf, 1000);
+        CHECK_VOID(ret, FAIL, "Hputelement");
+    }
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    new_size = file_size(SPACEFILE_NAME);
+    if (size <= 0 || new_size != size) {
+        fprintf(stderr, "file is %ld bytes after reusing space, was %ld\n", new_size, size);
+        num_errs++;
+    }
+
+    /* Nothing was overwritten */
+    fid = Hopen(SPACEFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = (intn)Hgetelement(fid, SPACE_TAG + 1, 1, inbuf);
+    VERIFY_VOID(ret, 1000, "Hgetelement");
+    for (j = 0; j < 1000; j++)
+        if (inbuf[j] != 3) {
+            fprintf(stderr, "shared data overwritten at byte %d\n", j);
+            num_errs++;
+            break;
+        }
+    for (i = 0; i < SPACE_NELEMS; i++) {
+        uint16 tag  = (uint16)((i % 2 == 0) ? SPACE_TAG + 2 : SPACE_TAG);
+        int32  len  = (i % 2 == 0) ? 900 : 1000;
+        uint8  byte = (uint8)((i % 2 == 0) ? 0xff - i : (i % 10 == 1) ? 0x80 + i : i);
+
+        if (i == 3)
+            continue;
+        ret = (intn)Hgetelement(fid, tag, (uint16)(i + 1), inbuf);
+        VERIFY_VOID(ret, len, "Hgetelement");
+        for (j = 0; j < len; j++)
+            if (inbuf[j] != byte) {
+                fprintf(stderr, "element %u/%d differs at byte %d\n", (unsigned)tag, i + 1, j);
+                num_errs++;
+                break;
+            }
+    }
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    /* Share the data of an element while the free space is tracked, then
+       delete the DDs one at a time */
+    fid = Hopen(SPACEFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    memset(outbuf, 0x55, 1000);
+    ret = Hputelement(fid, SPACE_TAG + 3, 1, outbuf, 1000);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hdupdd(fid, SPACE_TAG + 3, 2, SPACE_TAG + 3, 1);
+    CHECK_VOID(ret, FAIL, "Hdupdd");
+    offset = Hoffset(fid, SPACE_TAG + 3, 1);
+    CHECK_VOID(offset, FAIL, "Hoffset");
+    ret = Hdeldd(fid, SPACE_TAG + 3, 1);
+    CHECK_VOID(ret, FAIL, "Hdeldd");
+    memset(outbuf, 0x66, 1000);
+    ret = Hputelement(fid, SPACE_TAG + 3, 3, outbuf, 1000);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    if (Hoffset(fid, SPACE_TAG + 3, 3) == offset) {
+        fprintf(stderr, "shared data reused while still in use\n");
+        num_errs++;
+    }
+    ret = (intn)Hgetelement(fid, SPACE_TAG + 3, 2, inbuf);
+    VERIFY_VOID(ret, 1000, "Hgetelement");
+    VERIFY_VOID(inbuf[999], 0x55, "Hgetelement");
+    ret = Hdeldd(fid, SPACE_TAG + 3, 2);
+    CHECK_VOID(ret, FAIL, "Hdeldd");
+    ret = Hputelement(fid, SPACE_TAG + 3, 4, outbuf, 1000);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    VERIFY_VOID(Hoffset(fid, SPACE_TAG + 3, 4), offset, "Hoffset");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+} /* end test_hspace() */
+
+static void
+test_hsync(void)
+{
+    hdf_iostats_t stats;
+    int32         fid;
+    intn          ret;
+    int           i;
+
+    MESSAGE(5, printf("Testing flushing of the DD list\n"););
+
+    /* One element with many DDs pointing to it, so that all the DD blocks
+       but the first are next to each other in the file */
+    fid = Hopen(SYNCFILE_NAME, DFACC_CREATE, SYNC_NDDS);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hputelement(fid, SYNC_TAG, 1, outbuf, 16);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    for (i = 0; i < SYNC_NELEMS; i++) {
+        ret = Hdupdd(fid, SYNC_TAG + 1, (uint16)(i + 1), SYNC_TAG, 1);
+        CHECK_VOID(ret, FAIL, "Hdupdd");
+    }
+
+    /* The first block, the others and the end of the file */
+    ret = Hresetiostats(fid);
+    CHECK_VOID(ret, FAIL, "Hresetiostats");
+    ret = Hsync(fid);
+    CHECK_VOID(ret, FAIL, "Hsync");
+    ret = Hgetiostats(fid, &stats);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (stats.writes > 3) {
+        fprintf(stderr, "Hsync took %lu writes to flush %d DD blocks\n", (unsigned long)stats.writes,
+                SYNC_NELEMS / SYNC_NDDS + 1);
+        num_errs++;
+    }
+
+    /* Nothing is written until the file is closed, even without caching
+       but for the room of the new DD blocks */
+    ret = Hcache(fid, FALSE);
+    CHECK_VOID(ret, FAIL, "Hcache");
+    ret = Hdefersync(fid, TRUE);
+    CHECK_VOID(ret, FAIL, "Hdefersync");
+    ret = Hresetiostats(fid);
+    CHECK_VOID(ret, FAIL, "Hresetiostats");
+    for (i = SYNC_NELEMS; i < SYNC_NELEMS + SYNC_NMORE; i++) {
+        ret = Hdupdd(fid, SYNC_TAG + 1, (uint16)(i + 1), SYNC_TAG, 1);
+        CHECK_VOID(ret, FAIL, "Hdupdd");
+    }
+    ret = Hgetiostats(fid, &stats);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (stats.writes > SYNC_NMORE / SYNC_NDDS + 1) {
+        fprintf(stderr, "Hdupdd took %lu writes for %d DDs after Hdefersync\n", (unsigned long)stats.writes,
+                SYNC_NMORE);
+        num_errs++;
+    }
+    ret = Hresetiostats(fid);
+    CHECK_VOID(ret, FAIL, "Hresetiostats");
+    ret = Hsync(fid);
+    CHECK_VOID(ret, FAIL, "Hsync");
+    ret = Hgetiostats(fid, &stats);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    VERIFY_VOID((int)stats.writes, 0, "Hsync");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    fid = Hopen(SYNCFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hnumber(fid, SYNC_TAG + 1);
+    VERIFY_VOID(ret, SYNC_NELEMS + SYNC_NMORE, "Hnumber");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+} /* end test_hsync() */
+
+static void
+test_hcompact(void)
+{
+    hdf_iostats_t st;
+    FILE         *fp;
+    char          text[64];
+    int32         fid, aid;
+    int32         off, meta_end = 0, data_start = -1;
+    intn          ret;
+    int           i, j;
+
+    MESSAGE(5, printf("Testing Hcompact\n"););
+
+    /* Many DD blocks, interleaving data elements and Vgroup-like metadata */
+    fid = Hopen(CMPFILE_NAME, DFACC_CREATE, CMP_NDDS);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    for (i = 0; i < CMP_NELEMS; i++) {
+        for (j = 0; j < 64; j++)
+            outbuf[j] = (uint8)(i + j);
+        ret = Hputelement(fid, CMP_TAG, (uint16)(i + 1), outbuf, 64);
+        CHECK_VOID(ret, FAIL, "Hputelement");
+        if (i % 4 == 0) {
+            ret = Hputelement(fid, DFTAG_VG, (uint16)(i + 1), outbuf, 16);
+            CHECK_VOID(ret, FAIL, "Hputelement");
+        }
+    }
+    ret = Hdupdd(fid, CMP_DUPTAG, 1, CMP_TAG, 2);
+    CHECK_VOID(ret, FAIL, "Hdupdd");
+    aid = Hstartwrite(fid, CMP_EMPTYTAG, 1, 0);
+    CHECK_VOID(aid, FAIL, "Hstartwrite");
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+    for (i = 0; i < CMP_NELEMS; i += 10) {
+        ret = Hdeldd(fid, CMP_TAG, (uint16)(i + 1));
+        CHECK_VOID(ret, FAIL, "Hdeldd");
+    }
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    /* An open file can't be compacted */
+    fid = Hopen(CMPFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hgetiostats(fid, &st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (st.dd_blocks <= 1) {
+        fprintf(stderr, "test file has only %u DD block(s)\n", (unsigned)st.dd_blocks);
+        num_errs++;
+    }
+    ret = Hcompact(CMPFILE_NAME);
+    VERIFY_VOID(ret, FAIL, "Hcompact");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    if ((fp = fopen(CMPTMP_NAME, "w")) != NULL) {
+        fputs(CMPTMP_TEXT, fp);
+        fclose(fp);
+    }
+    ret = Hcompact(CMPFILE_NAME);
+    CHECK_VOID(ret, FAIL, "Hcompact");
+    text[0] = '\0';
+    if ((fp = fopen(CMPTMP_NAME, "r")) != NULL) {
+        if (fgets(text, (int)sizeof(text), fp) == NULL)
+            text[0] = '\0';
+        fclose(fp);
+    }
+    if (strcmp(text, CMPTMP_TEXT) != 0) {
+        fprintf(stderr, "Hcompact changed %s\n", CMPTMP_NAME);
+        num_errs++;
+    }
+    remove(CMPTMP_NAME);
+
+    /* One DD block now, the metadata before the data, and nothing lost */
+    fid = Hopen(CMPFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hgetiostats(fid, &st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    VERIFY_VOID(st.dd_blocks, 1, "Hgetiostats");
+    for (i = 0; i < CMP_NELEMS; i++) {
+        if (i % 10 == 0) {
+            VERIFY_VOID(Hexist(fid, CMP_TAG, (uint16)(i + 1)), FAIL, "Hexist");
+        }
+        else {
+            ret = (intn)Hgetelement(fid, CMP_TAG, (uint16)(i + 1), inbuf);
+            VERIFY_VOID(ret, 64, "Hgetelement");
+            for (j = 0; j < 64; j++)
+                if (inbuf[j] != (uint8)(i + j)) {
+                    fprintf(stderr, "element %d differs at byte %d after Hcompact\n", i + 1, j);
+                    num_errs++;
+                    break;
+                }
+            off = Hoffset(fid, CMP_TAG, (uint16)(i + 1));
+            if (data_start < 0 || off < data_start)
+                data_start = off;
+        }
+        if (i % 4 == 0) {
+            off = Hoffset(fid, DFTAG_VG, (uint16)(i + 1));
+            CHECK_VOID(off, FAIL, "Hoffset");
+            if (off + 16 > meta_end)
+                meta_end = off + 16;
+        }
+    }
+    if (meta_end > data_start) {
+        fprintf(stderr, "metadata ends at %d, after the data starts at %d\n", (int)meta_end, (int)data_start);
+        num_errs++;
+    }
+    VERIFY_VOID(Hoffset(fid, CMP_DUPTAG, 1), Hoffset(fid, CMP_TAG, 2), "Hoffset");
+    VERIFY_VOID(Hoffset(fid, CMP_EMPTYTAG, 1), 0, "Hoffset");
+    VERIFY_VOID(Hlength(fid, CMP_EMPTYTAG, 1), 0, "Hlength");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    /* The file can still grow */
+    fid = Hopen(CMPFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    for (i = 0; i < CMP_NELEMS; i += 10) {
+        ret = Hputelement(fid, CMP_TAG, (uint16)(i + 1), outbuf, 64);
+        CHECK_VOID(ret, FAIL, "Hputelement");
+    }
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    fid = Hopen(CMPFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = (intn)Hgetelement(fid, CMP_TAG, 2, inbuf);
+    VERIFY_VOID(ret, 64, "Hgetelement");
+    ret = (intn)Hgetelement(fid, CMP_TAG, 11, inbuf);
+    VERIFY_VOID(ret, 64, "Hgetelement");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+} /* end test_hcompact() */
+
 void
 test_hfile(void)
 {
@@ -194,6 +723,8 @@ test_hfile(void)
     ret = Hendaccess(aid2);
     CHECK_VOID(ret, FAIL, "Hendaccess");
 
+    test_staleaid(fid);
+
     MESSAGE(5, printf("Attempting to gain multiple access to file (is allowed)\n"););
     fid1 = Hopen(TESTFILE_NAME, DFACC_READ, 0);
     if (fid1 == FAIL) {
@@ -219,6 +750,11 @@ test_hfile(void)
     ret_bool = (intn)Hishdf("qqqqqqqq.qqq"); /* I sure hope it isn't there */
     CHECK_VOID(ret, TRUE, "Hishdf");
 
+    test_hfind();
+    test_hspace();
+    test_hsync();
+    test_hcompact();
+
     free(outbuf);
     free(inbuf);
 }
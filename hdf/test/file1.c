@@ -27,12 +27,14 @@
 
 #define TESTFILE_NAME  "thf"
 #define TESTREF_NAME   "tref.hdf"
+#define TESTNEW_NAME   "tnewref.hdf"
 #define MAX_REF_TESTED MAX_REF
 static int32 files[BIG];
 static int32 accs[BIG];
 
 static void test_file_limits(void);
 static void test_ref_limits(void);
+static void test_newref_reuse(void);
 
 static void
 test_file_limits(void)
@@ -225,9 +227,57 @@ test_ref_limits(void)
     }     /* end if */
 } /* end test_ref_limits() */
 
+/* Hnewref hands out the refs no tag uses once the highest ref is taken */
+static void
+test_newref_reuse(void)
+{
+    int32  fid;  /* file ID */
+    int32  data; /* element data */
+    int32  ret;
+    uint16 ref;
+
+    MESSAGE(6, printf("Testing reuse of reference #s\n"););
+    fid = Hopen(TESTNEW_NAME, DFACC_CREATE, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    /* refs 1-3 and 40 are taken by one tag or the other */
+    data = 0;
+    ret  = Hputelement(fid, TAG1, 1, (uint8 *)&data, sizeof(int32));
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hputelement(fid, TAG2, 2, (uint8 *)&data, sizeof(int32));
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hputelement(fid, TAG1, 3, (uint8 *)&data, sizeof(int32));
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hputelement(fid, TAG2, 40, (uint8 *)&data, sizeof(int32));
+    CHECK_VOID(ret, FAIL, "Hputelement");
+
+    /* Use up the refs above the highest one in the file */
+    while ((ref = Hnewref(fid)) < MAX_REF && ref != DFREF_NONE)
+        ;
+    VERIFY_VOID(ref, MAX_REF, "Hnewref");
+
+    /* Only the refs in use are skipped now */
+    ref = Hnewref(fid);
+    VERIFY_VOID(ref, 4, "Hnewref");
+    ret = Hputelement(fid, TAG1, ref, (uint8 *)&data, sizeof(int32));
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ref = Hnewref(fid);
+    VERIFY_VOID(ref, 5, "Hnewref");
+
+    /* A deleted element gives its ref back */
+    ret = Hdeldd(fid, TAG2, 2);
+    CHECK_VOID(ret, FAIL, "Hdeldd");
+    ref = Hnewref(fid);
+    VERIFY_VOID(ref, 2, "Hnewref");
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+} /* end test_newref_reuse() */
+
 void
 test_hfile1(void)
 {
     test_file_limits();
     test_ref_limits();
+    test_newref_reuse();
 }
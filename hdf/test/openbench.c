@@ -0,0 +1,202 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+    FILE - openbench.c
+        Benchmark the time taken by Hopen to load the DD list of a file
+
+    DESIGN
+        - Create a file with small DD blocks and write many tiny data
+            elements to it, so that the DD list is spread over many blocks.
+        - Open and close the file repeatedly, timing each Hopen.
+        - Report the average open time along with the number of reads and
+            bytes Hopen needed, as counted by Hgetiostats().
+ */
+
+#define TESTMASTER
+
+#include "hdfi.h"
+#include "tutils.h"
+#include "hfile.h"
+
+#define TESTFILE_NAME "topenbench.hdf"
+
+/* Default number of data elements to create */
+#define NUM_ELEMS 4000
+
+/* Default number of times to open the file */
+#define NUM_OPENS 20
+
+/* Number of DDs per DD block in the test file */
+#define BLOCK_DDS 16
+
+/* Tag to use for creating the test elements */
+#define OPEN_TAG 1000
+
+/* Factor for converting seconds to microseconds */
+#define FACTOR 1000000
+
+/* local function prototypes */
+static void  usage(void);
+static char *fixname(const char *base_name, char *fullname, size_t size);
+
+static void
+usage(void)
+{
+    printf("\nUsage: openbench [nelems [nopens]] \n\n");
+    printf("where nelems is the number of data elements to create (default: %d)\n", NUM_ELEMS);
+    printf("  and nopens is the number of times to open the file (default: %d)\n", NUM_OPENS);
+    printf("\n");
+} /* end usage() */
+
+/*
+   Creates a file name from a file base name like 'test' and return it through
+   the FULLNAME (at most SIZE characters counting the null terminator). The
+   full name is created by prepending the contents of HDF4_TESTPREFIX
+   (separated from the base name by a slash). Returns NULL if BASENAME or
+   FULLNAME is the null pointer or if FULLNAME isn't large enough for the
+   result.
+*/
+static char *
+fixname(const char *base_name, char *fullname, size_t size)
+{
+    const char *prefix = NULL;
+    char       *ptr, last = '\0';
+    size_t      i, j;
+
+    if (!base_name || !fullname || size < 1)
+        return NULL;
+
+    memset(fullname, 0, size);
+
+    /* First use the environment variable, then try the constant */
+    prefix = getenv("HDF4_TESTPREFIX");
+
+#ifdef HDF4_TESTPREFIX
+    if (!prefix)
+        prefix = HDF4_TESTPREFIX;
+#endif
+
+    /* Prepend the prefix value to the base name */
+    if (prefix && *prefix) {
+        if (snprintf(fullname, size, "%s/%s", prefix, base_name) == (int)size)
+            /* Buffer is too small */
+            return NULL;
+    }
+    else {
+        if (strlen(base_name) >= size)
+            /* Buffer is too small */
+            return NULL;
+        else
+            strcpy(fullname, base_name);
+    }
+
+    /* Remove any double slashes in the filename */
+    for (ptr = fullname, i = j = 0; ptr && i < size; i++, ptr++) {
+        if (*ptr != '/' || last != '/')
+            fullname[j++] = *ptr;
+        last = *ptr;
+    }
+    return fullname;
+
+} /* end fixname() */
+
+int
+main(int argc, char *argv[])
+{
+    struct timeval start_time, end_time;
+    hdf_iostats_t  stats;
+    int32          fid;      /* file ID of HDF file for testing */
+    int32          nelems;   /* number of data elements to create */
+    int32          nopens;   /* number of times to open the file */
+    long           open_time = 0;
+    uint64_t       reads = 0, bytes = 0, blocks = 0;
+    intn           ret;
+    char           hfilename[32];
+    uint32         lmajor, lminor, lrelease;
+    char           lstring[81];
+
+    /* Un-buffer stdout */
+    setbuf(stdout, NULL);
+
+    if (argc > 3) {
+        usage();
+        exit(1);
+    }
+    nelems = (argc >= 2) ? (int32)atol(argv[1]) : (int32)NUM_ELEMS;
+    nopens = (argc >= 3) ? (int32)atol(argv[2]) : (int32)NUM_OPENS;
+    if (nelems <= 0 || nelems > 65535 || nopens <= 0) {
+        usage();
+        exit(1);
+    }
+
+    Verbosity = 4; /* Default Verbosity is Low */
+
+    Hgetlibversion(&lmajor, &lminor, &lrelease, lstring);
+
+    printf("Built with HDF Library Version: %u.%u.%u, %s\n\n", (unsigned)lmajor, (unsigned)lminor,
+           (unsigned)lrelease, lstring);
+
+    MESSAGE(6, printf("Starting open benchmark (nelems=%d, nopens=%d)\n", nelems, nopens);)
+
+    fixname(TESTFILE_NAME, hfilename, sizeof hfilename);
+
+    /* Create the file with small DD blocks and fill it with tiny elements */
+    fid = Hopen(hfilename, DFACC_CREATE, BLOCK_DDS);
+    CHECK(fid, FAIL, "Hopen");
+    for (int32 i = 0; i < nelems; i++) {
+        uint8 data[4];
+
+        data[0] = (uint8)i;
+        data[1] = (uint8)(i >> 8);
+        data[2] = data[3] = 0;
+        ret = Hputelement(fid, OPEN_TAG, (uint16)(i + 1), data, (int32)sizeof(data));
+        if (ret == FAIL) {
+            CHECK(ret, FAIL, "Hputelement");
+            break;
+        }
+    }
+    ret = Hclose(fid);
+    CHECK(ret, FAIL, "Hclose");
+
+    /* Time opening the file, reading the DD list each time */
+    for (int32 i = 0; i < nopens; i++) {
+        gettimeofday(&start_time, NULL);
+        fid = Hopen(hfilename, DFACC_READ, 0);
+        gettimeofday(&end_time, NULL);
+        if (fid == FAIL) {
+            CHECK(fid, FAIL, "Hopen");
+            break;
+        }
+        open_time += (end_time.tv_sec - start_time.tv_sec) * FACTOR + (end_time.tv_usec - start_time.tv_usec);
+
+        ret = Hgetiostats(fid, &stats);
+        CHECK(ret, FAIL, "Hgetiostats");
+        reads += stats.reads;
+        bytes += stats.bytes_read;
+        blocks += stats.dd_blocks;
+
+        ret = Hclose(fid);
+        CHECK(ret, FAIL, "Hclose");
+    }
+
+    printf("DD blocks per open:   %.1f\n", (double)blocks / nopens);
+    printf("Reads per open:       %.1f\n", (double)reads / nopens);
+    printf("Bytes read per open:  %.1f\n", (double)bytes / nopens);
+    printf("Average open time:    %f seconds\n", ((double)open_time / nopens) / FACTOR);
+
+    remove(hfilename);
+
+    MESSAGE(6, printf("Finished open benchmark\n");)
+    return num_errs;
+} /* end main() */
@@ -24,6 +24,7 @@ static void test_1(void);
 static void test_2(void);
 static void test_3(void);
 static void test_4(void);
+static void test_5(void);
 
 /* Basic creation & deletion tests */
 static void
@@ -283,6 +284,78 @@ test_4(void)
     CHECK_VOID(ret, FAIL, "bv_delete");
 } /* end test_4 */
 
+/* Finding zeros across many words, and merging bit-vectors */
+static void
+test_5(void)
+{
+    bv_ptr b, b2;
+    int32  bit_num;
+    int32  i;
+    intn   ret;
+
+    MESSAGE(6, printf("Testing bit-vector finds across many words & unions\n"););
+
+    /* Hand out many bits in a row, as Htagnewref does */
+    b = bv_new(-1);
+    CHECK_VOID(b, NULL, "bv_new");
+    for (i = 0; i < 70000; i++) {
+        bit_num = bv_find_next_zero(b);
+        if (bit_num != i) {
+            VERIFY_VOID(bit_num, i, "bv_find_next_zero");
+            break;
+        }
+        ret = bv_set(b, bit_num, BV_TRUE);
+        CHECK_VOID(ret, FAIL, "bv_set");
+    }
+    VERIFY_VOID(bv_size(b), 70000, "bv_size");
+
+    /* Clear bits on both sides of a word boundary, the later one first */
+    ret = bv_set(b, 65536, BV_FALSE);
+    CHECK_VOID(ret, FAIL, "bv_set");
+    ret = bv_set(b, 31, BV_FALSE);
+    CHECK_VOID(ret, FAIL, "bv_set");
+    bit_num = bv_find_next_zero(b);
+    VERIFY_VOID(bit_num, 31, "bv_find_next_zero");
+    ret = bv_set(b, bit_num, BV_TRUE);
+    CHECK_VOID(ret, FAIL, "bv_set");
+    bit_num = bv_find_next_zero(b);
+    VERIFY_VOID(bit_num, 65536, "bv_find_next_zero");
+    ret = bv_set(b, bit_num, BV_TRUE);
+    CHECK_VOID(ret, FAIL, "bv_set");
+    bit_num = bv_find_next_zero(b);
+    VERIFY_VOID(bit_num, 70000, "bv_find_next_zero");
+
+    /* Merge a short vector into a long one, and a long one into a short one */
+    b2 = bv_new(40);
+    CHECK_VOID(b2, NULL, "bv_new");
+    ret = bv_set(b2, 0, BV_TRUE);
+    CHECK_VOID(ret, FAIL, "bv_set");
+    ret = bv_set(b2, 33, BV_TRUE);
+    CHECK_VOID(ret, FAIL, "bv_set");
+    ret = bv_set(b, 5, BV_FALSE);
+    CHECK_VOID(ret, FAIL, "bv_set");
+    ret = bv_union(b, b2);
+    CHECK_VOID(ret, FAIL, "bv_union");
+    VERIFY_VOID(bv_size(b), 70001, "bv_size");
+    VERIFY_VOID(bv_get(b, 5), BV_FALSE, "bv_get");
+    VERIFY_VOID(bv_get(b, 33), BV_TRUE, "bv_get");
+
+    ret = bv_union(b2, b);
+    CHECK_VOID(ret, FAIL, "bv_union");
+    VERIFY_VOID(bv_size(b2), 70001, "bv_size");
+    bit_num = bv_find_next_zero(b2);
+    VERIFY_VOID(bit_num, 5, "bv_find_next_zero");
+    VERIFY_VOID(bv_get(b2, 69999), BV_TRUE, "bv_get");
+
+    ret = bv_union(b2, NULL);
+    VERIFY_VOID(ret, FAIL, "bv_union");
+
+    ret = bv_delete(b2);
+    CHECK_VOID(ret, FAIL, "bv_delete");
+    ret = bv_delete(b);
+    CHECK_VOID(ret, FAIL, "bv_delete");
+} /* end test_5 */
+
 void
 test_bitvect(void)
 {
@@ -290,4 +363,5 @@ test_bitvect(void)
     test_2(); /* basic set & get testing */
     test_3(); /* advanced set & get testing */
     test_4(); /* pathological set & find testing */
+    test_5(); /* finds across many words & unions */
 }
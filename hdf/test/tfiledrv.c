@@ -0,0 +1,855 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+   * Hsetdriver/Hgetdriver
+   ** Reject an unknown driver.
+   ** For each driver:
+   *** Create a file and write elements to it.
+   *** Re-open it with every driver and verify the elements.
+   *** Re-open a read-only file for writing and append an element.
+   * Hreadv
+   ** Read many pieces of plain and linked-block elements in one call.
+   ** Fail only the bad requests of a batch.
+   * Hreadptr
+   ** Get pointers to element data with the memory and mmap drivers.
+   ** Fail with a driver which cannot map the file.
+   * Hgetiostats/Hresetiostats
+   ** Count the I/O of opening a file, reading it and appending to it.
+   ** Reset the counts.
+   * Hreadahead
+   ** Read a large element sequentially, and out of order, with a small
+      readahead window.
+   ** Write to the file while it is being read ahead.
+   * Hsetmetaindex
+   ** Write the sidecar of a file opened read-only, then open the file
+      again with the metadata read from the sidecar.
+   ** Ignore the sidecar once the file has changed, or if it is damaged.
+   ** Ignore the sidecar once the modification time of the file changes
+      within the second.
+   ** Remove the sidecar when opening the file for write, but not a file
+      by that name which is no sidecar.
+   * Hopen_image/Hclose_image
+   ** Create a file in memory and get its image.
+   ** Read the image back, in place.
+   ** Append to a copy of the image, leaving the original untouched.
+ */
+
+#include "tproto.h"
+
+#ifdef H4_HAVE_STRUCT_STAT_ST_MTIM
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+#define DRVFILE_NAME "tfiledrv.hdf"
+#define DRV_BUFSIZE  3000
+#define DRV_TAG      1000
+
+#define DRVTMP_NAME "tfiledrv.hdf.tmp" /* a user file the drivers must leave alone */
+#define DRVTMP_TEXT "not a temporary file\n"
+
+static const intn drivers[]       = {HDF_DRIVER_STDIO, HDF_DRIVER_POSIX, HDF_DRIVER_MEMORY, HDF_DRIVER_MMAP};
+static const char *driver_names[] = {"stdio", "posix", "memory", "mmap"};
+
+#define NDRIVERS (sizeof(drivers) / sizeof(drivers[0]))
+
+#define RA_BUFSIZE 300000 /* size of the element read ahead */
+#define RA_WINDOW  16384  /* size of the readahead window */
+#define RA_PIECE   1000   /* # of bytes read at a time */
+
+#define IDXFILE_NAME "tfiledrv.hdf.hdx" /* metadata index of DRVFILE_NAME */
+#define IDX_NVH      50                 /* # of vdata headers in the indexed file */
+#define IDX_TEXT     "not a metadata index\n"
+
+/* Write a file made of four elements, using driver 'drv' */
+static void
+write_drv_file(intn drv, const uint8 *outbuf)
+{
+    FILE *fp;
+    char  text[64];
+    int32 fid, aid;
+    int32 ret;
+
+    if ((fp = fopen(DRVTMP_NAME, "w")) != NULL) {
+        fputs(DRVTMP_TEXT, fp);
+        fclose(fp);
+    }
+
+    ret = Hsetdriver(drv);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+
+    fid = Hopen(DRVFILE_NAME, DFACC_CREATE, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    ret = Hgetdriver(fid);
+    VERIFY_VOID(ret, drv, "Hgetdriver");
+
+    ret = Hputelement(fid, DRV_TAG, 1, outbuf, DRV_BUFSIZE);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hputelement(fid, DRV_TAG, 2, outbuf + 1, DRV_BUFSIZE - 1);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hputelement(fid, DRV_TAG + 1, 1, (const uint8 *)"driver", 7);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+
+    /* a special element, for Hreadv */
+    aid = HLcreate(fid, DRV_TAG, 3, 100, 4);
+    CHECK_VOID(aid, FAIL, "HLcreate");
+    ret = Hwrite(aid, 1000, outbuf);
+    VERIFY_VOID(ret, 1000, "Hwrite");
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    /* The file is written back without touching its neighbours */
+    text[0] = '\0';
+    if ((fp = fopen(DRVTMP_NAME, "r")) != NULL) {
+        if (fgets(text, (int)sizeof(text), fp) == NULL)
+            text[0] = '\0';
+        fclose(fp);
+    }
+    if (strcmp(text, DRVTMP_TEXT) != 0) {
+        fprintf(stderr, "ERROR: %s was changed\n", DRVTMP_NAME);
+        num_errs++;
+    }
+    remove(DRVTMP_NAME);
+}
+
+/* Read back and verify the file, using driver 'drv' */
+static void
+verify_drv_file(intn drv, const uint8 *outbuf, uint8 *inbuf)
+{
+    int32 fid, fid2;
+    int32 ret;
+
+    ret = Hsetdriver(drv);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    ret = Hgetdriver(fid);
+    VERIFY_VOID(ret, drv, "Hgetdriver");
+
+    ret = Hgetelement(fid, DRV_TAG, 1, inbuf);
+    VERIFY_VOID(ret, DRV_BUFSIZE, "Hgetelement");
+    if (memcmp(inbuf, outbuf, DRV_BUFSIZE) != 0) {
+        fprintf(stderr, "ERROR: wrong data in element 1\n");
+        num_errs++;
+    }
+    ret = Hgetelement(fid, DRV_TAG, 2, inbuf);
+    VERIFY_VOID(ret, DRV_BUFSIZE - 1, "Hgetelement");
+    if (memcmp(inbuf, outbuf + 1, DRV_BUFSIZE - 1) != 0) {
+        fprintf(stderr, "ERROR: wrong data in element 2\n");
+        num_errs++;
+    }
+
+    /* Opening again for write replaces the driver's handle */
+    fid2 = Hopen(DRVFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid2, FAIL, "Hopen");
+    ret = Hputelement(fid2, DRV_TAG + 2, 1, (const uint8 *)"appended", 9);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hclose(fid2);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    ret = Hgetelement(fid, DRV_TAG + 1, 1, inbuf);
+    VERIFY_VOID(ret, 7, "Hgetelement");
+    if (strcmp((const char *)inbuf, "driver") != 0) {
+        fprintf(stderr, "ERROR: wrong data in element 3\n");
+        num_errs++;
+    }
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    /* The appended element must have made it to the file */
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hgetelement(fid, DRV_TAG + 2, 1, inbuf);
+    VERIFY_VOID(ret, 9, "Hgetelement");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+}
+
+/* Fill in one Hreadv request */
+static void
+set_readv(hdf_readreq_t *req, int32 fid, uint16 tag, uint16 ref, int32 offset, int32 length, uint8 *buf)
+{
+    req->file_id = fid;
+    req->tag     = tag;
+    req->ref     = ref;
+    req->offset  = offset;
+    req->length  = length;
+    req->buf     = buf;
+    req->nread   = 0;
+}
+
+/* Check the data read by one Hreadv request */
+static void
+check_readv(const hdf_readreq_t *req, int32 nread, const uint8 *expect)
+{
+    VERIFY_VOID(req->nread, nread, "Hreadv");
+    if (nread > 0 && memcmp(req->buf, expect, (size_t)nread) != 0) {
+        fprintf(stderr, "ERROR: wrong data from Hreadv for %d/%d at %d\n", (int)req->tag, (int)req->ref,
+                (int)req->offset);
+        num_errs++;
+    }
+}
+
+/* Read pieces of all the elements of the file in one Hreadv */
+static void
+test_readv(intn drv, const uint8 *outbuf, uint8 *inbuf)
+{
+    hdf_readreq_t reqs[8];
+    int32         fid;
+    int32         ret;
+
+    ret = Hsetdriver(drv);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    /* Out of order, overlapping, close together and with a special
+       element in between */
+    set_readv(&reqs[0], fid, DRV_TAG + 1, 1, 0, 0, inbuf);
+    set_readv(&reqs[1], fid, DRV_TAG, 2, 10, 20, inbuf + 10);
+    set_readv(&reqs[2], fid, DRV_TAG, 1, 100, 50, inbuf + 100);
+    set_readv(&reqs[3], fid, DRV_TAG, 1, 120, 10, inbuf + 200);
+    set_readv(&reqs[4], fid, DRV_TAG, 3, 150, 300, inbuf + 300);
+    set_readv(&reqs[5], fid, DRV_TAG, 2, DRV_BUFSIZE - 11, 100, inbuf + 700); /* runs past the end */
+    set_readv(&reqs[6], fid, DRV_TAG + 2, 1, 0, 0, inbuf + 800);
+    set_readv(&reqs[7], fid, DRV_TAG + 2, 1, 9, 0, inbuf + 900); /* nothing left to read */
+    ret = Hreadv(reqs, 8);
+    CHECK_VOID(ret, FAIL, "Hreadv");
+    check_readv(&reqs[0], 7, (const uint8 *)"driver");
+    check_readv(&reqs[1], 20, outbuf + 11);
+    check_readv(&reqs[2], 50, outbuf + 100);
+    check_readv(&reqs[3], 10, outbuf + 120);
+    check_readv(&reqs[4], 300, outbuf + 150);
+    check_readv(&reqs[5], 10, outbuf + DRV_BUFSIZE - 10);
+    check_readv(&reqs[6], 9, (const uint8 *)"appended");
+    check_readv(&reqs[7], 0, NULL);
+
+    /* A bad request fails alone */
+    set_readv(&reqs[0], fid, DRV_TAG, 1, 0, 16, inbuf);
+    set_readv(&reqs[1], fid, DRV_TAG, 99, 0, 16, inbuf + 100);
+    set_readv(&reqs[2], fid, DRV_TAG, 2, DRV_BUFSIZE, 16, inbuf + 200);
+    set_readv(&reqs[3], fid, DRV_TAG, 2, 0, 16, inbuf + 300);
+    ret = Hreadv(reqs, 4);
+    VERIFY_VOID(ret, FAIL, "Hreadv");
+    check_readv(&reqs[0], 16, outbuf);
+    check_readv(&reqs[1], FAIL, NULL);
+    check_readv(&reqs[2], FAIL, NULL);
+    check_readv(&reqs[3], 16, outbuf + 1);
+
+    ret = Hreadv(NULL, 1);
+    VERIFY_VOID(ret, FAIL, "Hreadv");
+    ret = Hreadv(reqs, 0);
+    VERIFY_VOID(ret, SUCCEED, "Hreadv");
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+}
+
+/* Check Hreadptr on the file, using driver 'drv' */
+static void
+test_readptr(intn drv, const uint8 *outbuf)
+{
+    const void *ptr = NULL;
+    int32       fid, aid;
+    int32       ret;
+
+    ret = Hsetdriver(drv);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    aid = Hstartread(fid, DRV_TAG, 1);
+    CHECK_VOID(aid, FAIL, "Hstartread");
+
+    if (drv == HDF_DRIVER_MEMORY || drv == HDF_DRIVER_MMAP) {
+        ret = Hreadptr(aid, 100, &ptr);
+        VERIFY_VOID(ret, 100, "Hreadptr");
+        if (ptr == NULL || memcmp(ptr, outbuf, 100) != 0) {
+            fprintf(stderr, "ERROR: wrong data from Hreadptr\n");
+            num_errs++;
+        }
+
+        /* a length of zero gets the rest of the element */
+        ret = Hreadptr(aid, 0, &ptr);
+        VERIFY_VOID(ret, DRV_BUFSIZE - 100, "Hreadptr");
+        if (ptr == NULL || memcmp(ptr, outbuf + 100, DRV_BUFSIZE - 100) != 0) {
+            fprintf(stderr, "ERROR: wrong data from Hreadptr\n");
+            num_errs++;
+        }
+    }
+    else {
+        ret = Hreadptr(aid, 100, &ptr);
+        VERIFY_VOID(ret, FAIL, "Hreadptr");
+    }
+
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+}
+
+/* Check files held in memory */
+static void
+test_image(const uint8 *outbuf, uint8 *inbuf)
+{
+    const void *ptr = NULL;
+    void       *image = NULL, *image2 = NULL;
+    uint8      *copy;
+    int32       size, size2;
+    int32       fid, aid;
+    int32       ret;
+
+    /* The image driver is only used through Hopen_image */
+    ret = Hsetdriver(HDF_DRIVER_IMAGE);
+    VERIFY_VOID(ret, FAIL, "Hsetdriver");
+
+    fid = Hopen_image(NULL, 0, DFACC_CREATE, 0);
+    CHECK_VOID(fid, FAIL, "Hopen_image");
+    ret = Hgetdriver(fid);
+    VERIFY_VOID(ret, HDF_DRIVER_IMAGE, "Hgetdriver");
+    ret = Hputelement(fid, DRV_TAG, 1, outbuf, DRV_BUFSIZE);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hclose_image(fid, &image, &size);
+    CHECK_VOID(ret, FAIL, "Hclose_image");
+    if (image == NULL || size < DRV_BUFSIZE) {
+        fprintf(stderr, "ERROR: no image from Hclose_image\n");
+        num_errs++;
+        return;
+    }
+
+    copy = (uint8 *)malloc((size_t)size);
+    CHECK_ALLOC(copy, "copy", "test_image");
+    memcpy(copy, image, (size_t)size);
+
+    /* Read-only files use the image in place */
+    fid = Hopen_image(image, size, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen_image");
+    aid = Hstartread(fid, DRV_TAG, 1);
+    CHECK_VOID(aid, FAIL, "Hstartread");
+    ret = Hreadptr(aid, 0, &ptr);
+    VERIFY_VOID(ret, DRV_BUFSIZE, "Hreadptr");
+    if (ptr == NULL || (const uint8 *)ptr < (const uint8 *)image ||
+        (const uint8 *)ptr + DRV_BUFSIZE > (const uint8 *)image + size ||
+        memcmp(ptr, outbuf, DRV_BUFSIZE) != 0) {
+        fprintf(stderr, "ERROR: wrong pointer from Hreadptr\n");
+        num_errs++;
+    }
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+    ret = Hclose_image(fid, &image2, &size2);
+    CHECK_VOID(ret, FAIL, "Hclose_image");
+    VERIFY_VOID((image2 == image), TRUE, "Hclose_image");
+    VERIFY_VOID(size2, size, "Hclose_image");
+
+    /* Files opened for write get their own copy of the image */
+    fid = Hopen_image(image, size, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen_image");
+    ret = Hputelement(fid, DRV_TAG, 2, (const uint8 *)"appended", 9);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+
+    /* Only the last close may take the image */
+    aid = Hopen_image(image, size, DFACC_READ, 0);
+    CHECK_VOID(aid, FAIL, "Hopen_image");
+    ret = Hclose(aid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    ret = Hclose_image(fid, &image2, &size2);
+    CHECK_VOID(ret, FAIL, "Hclose_image");
+    if (memcmp(copy, image, (size_t)size) != 0) {
+        fprintf(stderr, "ERROR: the original image was modified\n");
+        num_errs++;
+    }
+
+    fid = Hopen_image(image2, size2, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen_image");
+    ret = Hgetelement(fid, DRV_TAG, 1, inbuf);
+    VERIFY_VOID(ret, DRV_BUFSIZE, "Hgetelement");
+    ret = Hgetelement(fid, DRV_TAG, 2, inbuf);
+    VERIFY_VOID(ret, 9, "Hgetelement");
+    if (strcmp((const char *)inbuf, "appended") != 0) {
+        fprintf(stderr, "ERROR: wrong data in the new image\n");
+        num_errs++;
+    }
+    ret = Hclose_image(fid, NULL, NULL);
+    CHECK_VOID(ret, FAIL, "Hclose_image");
+
+    free(image);
+    free(image2);
+    free(copy);
+}
+
+/* Check the I/O statistics of the file written by write_drv_file, read
+   back with driver 'drv' */
+static void
+test_iostats(intn drv, uint8 *inbuf)
+{
+    hdf_iostats_t st;
+    hdf_readreq_t req[2];
+    int32         fid;
+    int32         ret;
+
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+
+    /* Opening the file reads the magic number and the DD blocks */
+    ret = Hgetiostats(fid, &st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (st.dd_blocks == 0 || st.reads < 2 || st.bytes_read == 0 || st.writes != 0) {
+        fprintf(stderr, "ERROR: wrong I/O statistics after opening the file\n");
+        num_errs++;
+    }
+
+    ret = Hresetiostats(fid);
+    CHECK_VOID(ret, FAIL, "Hresetiostats");
+    ret = Hgetiostats(fid, &st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (st.reads != 0 || st.bytes_read != 0 || st.dd_blocks != 0 || st.io_time != 0.0) {
+        fprintf(stderr, "ERROR: I/O statistics not reset\n");
+        num_errs++;
+    }
+
+    ret = Hgetelement(fid, DRV_TAG, 1, inbuf);
+    VERIFY_VOID(ret, DRV_BUFSIZE, "Hgetelement");
+    set_readv(&req[0], fid, DRV_TAG, 1, 0, 10, inbuf);
+    set_readv(&req[1], fid, DRV_TAG, 2, 0, 10, inbuf + 10);
+    ret = Hreadv(req, 2);
+    CHECK_VOID(ret, FAIL, "Hreadv");
+
+    ret = Hgetiostats(fid, &st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (st.reads < 2 || st.batches != 1 || st.bytes_read < DRV_BUFSIZE + 20 || st.writes != 0 ||
+        st.dd_blocks != 0 || st.io_time < 0.0) {
+        fprintf(stderr, "ERROR: wrong I/O statistics after reading the file\n");
+        num_errs++;
+    }
+    /* Every transfer of the stdio driver needs a seek, unless the stream is there already */
+    if (drv == HDF_DRIVER_STDIO && st.seeks + st.seeks_avoided != st.reads) {
+        fprintf(stderr, "ERROR: wrong seek statistics\n");
+        num_errs++;
+    }
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    ret = Hgetiostats(fid, &st);
+    VERIFY_VOID(ret, FAIL, "Hgetiostats");
+
+    fid = Hopen(DRVFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hgetiostats(fid, NULL);
+    VERIFY_VOID(ret, FAIL, "Hgetiostats");
+    ret = Hputelement(fid, DRV_TAG, 4, inbuf, 20);
+    CHECK_VOID(ret, FAIL, "Hputelement");
+    ret = Hgetiostats(fid, &st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (st.writes == 0 || st.bytes_written < 20) {
+        fprintf(stderr, "ERROR: wrong I/O statistics after writing the file\n");
+        num_errs++;
+    }
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+}
+
+/* Read 'count' pieces of the element of 'aid' from 'offset' and check them */
+static void
+check_readahead(int32 aid, int32 offset, intn count, const uint8 *expect, uint8 *inbuf)
+{
+    int32 ret;
+    intn  i;
+
+    ret = Hseek(aid, offset, DF_START);
+    CHECK_VOID(ret, FAIL, "Hseek");
+    for (i = 0; i < count && offset < RA_BUFSIZE; i++) {
+        int32 len = MIN(RA_PIECE, RA_BUFSIZE - offset);
+
+        memset(inbuf, 0, RA_PIECE);
+        ret = Hread(aid, len, inbuf);
+        VERIFY_VOID(ret, len, "Hread");
+        if (memcmp(inbuf, expect + offset, (size_t)len) != 0) {
+            fprintf(stderr, "ERROR: wrong data read ahead at offset %d\n", (int)offset);
+            num_errs++;
+            return;
+        }
+        offset += len;
+    }
+}
+
+/* Read an element sequentially with driver 'drv', with readahead */
+static void
+test_readahead(intn drv)
+{
+    uint8 *expect, *inbuf;
+    int32  fid, fid2, aid, aid2;
+    int32  ret;
+    intn   i;
+
+    expect = (uint8 *)malloc(RA_BUFSIZE);
+    inbuf  = (uint8 *)malloc(RA_PIECE);
+    CHECK_ALLOC(expect, "expect", "test_readahead");
+    CHECK_ALLOC(inbuf, "inbuf", "test_readahead");
+    for (i = 0; i < RA_BUFSIZE; i++)
+        expect[i] = (uint8)(i + (i >> 8));
+
+    ret = Hsetdriver(drv);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+    ret = Hreadahead(CACHE_ALL_FILES, RA_WINDOW);
+    CHECK_VOID(ret, FAIL, "Hreadahead");
+
+    fid = Hopen(DRVFILE_NAME, DFACC_CREATE, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hputelement(fid, DRV_TAG, 10, expect, RA_BUFSIZE);
+    VERIFY_VOID(ret, RA_BUFSIZE, "Hputelement");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hreadahead(fid, -1);
+    VERIFY_VOID(ret, FAIL, "Hreadahead");
+    aid = Hstartread(fid, DRV_TAG, 10);
+    CHECK_VOID(aid, FAIL, "Hstartread");
+
+    /* Front to back, then somewhere behind and somewhere ahead */
+    check_readahead(aid, 0, 150, expect, inbuf);
+    check_readahead(aid, 5000, 20, expect, inbuf);
+    check_readahead(aid, 200000, 20, expect, inbuf);
+
+    /* Write further on while the file is being read ahead */
+    fid2 = Hopen(DRVFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid2, FAIL, "Hopen");
+    aid2 = Hstartwrite(fid2, DRV_TAG, 10, RA_BUFSIZE);
+    CHECK_VOID(aid2, FAIL, "Hstartwrite");
+    ret = Hseek(aid2, 250000, DF_START);
+    CHECK_VOID(ret, FAIL, "Hseek");
+    memset(expect + 250000, 0xAA, RA_PIECE);
+    ret = Hwrite(aid2, RA_PIECE, expect + 250000);
+    VERIFY_VOID(ret, RA_PIECE, "Hwrite");
+    ret = Hendaccess(aid2);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+
+    check_readahead(aid, 220000, 80, expect, inbuf);
+
+    ret = Hreadahead(fid, 0);
+    CHECK_VOID(ret, FAIL, "Hreadahead");
+    check_readahead(aid, 0, 10, expect, inbuf);
+
+    ret = Hendaccess(aid);
+    CHECK_VOID(ret, FAIL, "Hendaccess");
+    ret = Hclose(fid2);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    ret = Hreadahead(CACHE_ALL_FILES, HDF_READAHEAD_SIZE);
+    CHECK_VOID(ret, FAIL, "Hreadahead");
+
+    free(expect);
+    free(inbuf);
+}
+
+/* Open the file of test_metaindex read-only, check its elements and get
+   the I/O statistics of the open */
+static void
+check_metaindex(const uint8 *outbuf, uint8 *inbuf, hdf_iostats_t *open_st, hdf_iostats_t *read_st)
+{
+    int32 fid;
+    int32 ret;
+    intn  i;
+
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hgetiostats(fid, open_st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    ret = Hresetiostats(fid);
+    CHECK_VOID(ret, FAIL, "Hresetiostats");
+
+    for (i = 0; i < IDX_NVH; i++) {
+        memset(inbuf, 0, 40);
+        ret = Hgetelement(fid, DFTAG_VH, (uint16)(i + 1), inbuf);
+        VERIFY_VOID(ret, 40, "Hgetelement");
+        if (memcmp(inbuf, outbuf + i, 40) != 0) {
+            fprintf(stderr, "ERROR: wrong metadata read back with the index\n");
+            num_errs++;
+            break;
+        }
+    }
+    ret = Hgetiostats(fid, read_st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+
+    memset(inbuf, 0, DRV_BUFSIZE);
+    ret = Hgetelement(fid, DRV_TAG, 1, inbuf);
+    VERIFY_VOID(ret, DRV_BUFSIZE, "Hgetelement");
+    if (memcmp(inbuf, outbuf, DRV_BUFSIZE) != 0) {
+        fprintf(stderr, "ERROR: wrong data read back with the index\n");
+        num_errs++;
+    }
+
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+}
+
+/* Open a file with many metadata elements over and over with driver
+   'drv', with the metadata index */
+static void
+test_metaindex(intn drv, const uint8 *outbuf, uint8 *inbuf)
+{
+    hdf_iostats_t open_st, read_st;
+    FILE         *fp;
+    int32         fid;
+    int32         ret;
+    intn          i;
+
+    ret = Hsetdriver(drv);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+
+    /* Vdata headers spread over many small DD blocks, and some data */
+    fid = Hopen(DRVFILE_NAME, DFACC_CREATE, 16);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    for (i = 0; i < IDX_NVH; i++) {
+        ret = Hputelement(fid, DFTAG_VH, (uint16)(i + 1), outbuf + i, 40);
+        VERIFY_VOID(ret, 40, "Hputelement");
+    }
+    ret = Hputelement(fid, DRV_TAG, 1, outbuf, DRV_BUFSIZE);
+    VERIFY_VOID(ret, DRV_BUFSIZE, "Hputelement");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    remove(IDXFILE_NAME);
+
+    ret = Hsetmetaindex(TRUE);
+    CHECK_VOID(ret, FAIL, "Hsetmetaindex");
+
+    /* The first open reads the file and writes the sidecar when closing */
+    check_metaindex(outbuf, inbuf, &open_st, &read_st);
+    if (open_st.idx_bytes != 0 || read_st.idx_bytes != 0 || (fp = fopen(IDXFILE_NAME, "rb")) == NULL) {
+        fprintf(stderr, "ERROR: no metadata index written\n");
+        num_errs++;
+        goto done;
+    }
+    fclose(fp);
+
+    /* The next one only reads the first DD block, to check the sidecar */
+    check_metaindex(outbuf, inbuf, &open_st, &read_st);
+    if (open_st.reads != 1 || open_st.idx_bytes == 0 || read_st.reads != 0 ||
+        read_st.idx_bytes != 40 * IDX_NVH) {
+        fprintf(stderr, "ERROR: metadata not read from the index\n");
+        num_errs++;
+    }
+
+    /* A file opened for write doesn't use the index */
+    fid = Hopen(DRVFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hgetiostats(fid, &open_st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (open_st.idx_bytes != 0) {
+        fprintf(stderr, "ERROR: metadata index used for a file opened for write\n");
+        num_errs++;
+    }
+
+    /* Change the file: the sidecar is stale and is written again */
+    ret = Hputelement(fid, DFTAG_VH, 1, outbuf + 1, 40);
+    VERIFY_VOID(ret, 40, "Hputelement");
+    ret = Hputelement(fid, DRV_TAG, 2, outbuf, 100);
+    VERIFY_VOID(ret, 100, "Hputelement");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hgetiostats(fid, &open_st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (open_st.idx_bytes != 0) {
+        fprintf(stderr, "ERROR: stale metadata index used\n");
+        num_errs++;
+    }
+    memset(inbuf, 0, 40);
+    ret = Hgetelement(fid, DFTAG_VH, 1, inbuf);
+    VERIFY_VOID(ret, 40, "Hgetelement");
+    if (memcmp(inbuf, outbuf + 1, 40) != 0) {
+        fprintf(stderr, "ERROR: wrong metadata read back after changing the file\n");
+        num_errs++;
+    }
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+    /* Damage the new sidecar: it is ignored */
+    if ((fp = fopen(IDXFILE_NAME, "r+b")) != NULL) {
+        fseek(fp, -10, SEEK_END);
+        fputc(fgetc(fp) ^ 0xFF, fp);
+        fclose(fp);
+    }
+    else {
+        fprintf(stderr, "ERROR: metadata index not written again\n");
+        num_errs++;
+    }
+    fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hgetiostats(fid, &open_st);
+    CHECK_VOID(ret, FAIL, "Hgetiostats");
+    if (open_st.idx_bytes != 0) {
+        fprintf(stderr, "ERROR: damaged metadata index used\n");
+        num_errs++;
+    }
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+
+#ifdef H4_HAVE_STRUCT_STAT_ST_MTIM
+    /* Change the modification time of the file within its second: the
+       sidecar written again above is stale */
+    {
+        struct stat     sb;
+        struct timespec times[2];
+        long            nsec = -1;
+
+        if (stat(DRVFILE_NAME, &sb) == 0) {
+            nsec             = sb.st_mtim.tv_nsec;
+            times[0]         = sb.st_atim;
+            times[1]         = sb.st_mtim;
+            times[1].tv_nsec = (nsec + 1) % 1000000000;
+            if (utimensat(AT_FDCWD, DRVFILE_NAME, times, 0) != 0 || stat(DRVFILE_NAME, &sb) != 0)
+                nsec = -1;
+        }
+        /* Some file systems don't keep the nanoseconds */
+        if (nsec != -1 && sb.st_mtim.tv_nsec != nsec) {
+            fid = Hopen(DRVFILE_NAME, DFACC_READ, 0);
+            CHECK_VOID(fid, FAIL, "Hopen");
+            ret = Hgetiostats(fid, &open_st);
+            CHECK_VOID(ret, FAIL, "Hgetiostats");
+            if (open_st.idx_bytes != 0) {
+                fprintf(stderr, "ERROR: metadata index used after the file changed within a second\n");
+                num_errs++;
+            }
+            ret = Hclose(fid);
+            CHECK_VOID(ret, FAIL, "Hclose");
+        }
+    }
+#endif
+
+    /* Opening the file for write removes its sidecar, index on or off */
+    ret = Hsetmetaindex(FALSE);
+    CHECK_VOID(ret, FAIL, "Hsetmetaindex");
+    fid = Hopen(DRVFILE_NAME, DFACC_RDWR, 0);
+    CHECK_VOID(fid, FAIL, "Hopen");
+    ret = Hclose(fid);
+    CHECK_VOID(ret, FAIL, "Hclose");
+    if ((fp = fopen(IDXFILE_NAME, "rb")) != NULL) {
+        fclose(fp);
+        fprintf(stderr, "ERROR: metadata index kept for a file opened for write\n");
+        num_errs++;
+    }
+
+    /* but not a file by that name which is no sidecar */
+    if ((fp = fopen(IDXFILE_NAME, "wb")) != NULL) {
+        char text[64];
+
+        fputs(IDX_TEXT, fp);
+        fclose(fp);
+        fid = Hopen(DRVFILE_NAME, DFACC_RDWR, 0);
+        CHECK_VOID(fid, FAIL, "Hopen");
+        ret = Hclose(fid);
+        CHECK_VOID(ret, FAIL, "Hclose");
+        memset(text, 0, sizeof(text));
+        if ((fp = fopen(IDXFILE_NAME, "rb")) != NULL) {
+            if (fread(text, 1, sizeof(text) - 1, fp) == 0)
+                text[0] = '\0';
+            fclose(fp);
+        }
+        if (strcmp(text, IDX_TEXT) != 0) {
+            fprintf(stderr, "ERROR: %s was removed or changed\n", IDXFILE_NAME);
+            num_errs++;
+        }
+    }
+
+done:
+    ret = Hsetmetaindex(FALSE);
+    CHECK_VOID(ret, FAIL, "Hsetmetaindex");
+    remove(IDXFILE_NAME);
+}
+
+void
+test_hfile_driver(void)
+{
+    uint8 *outbuf, *inbuf;
+    intn   ret;
+    size_t i, j;
+
+    outbuf = (uint8 *)malloc(DRV_BUFSIZE);
+    inbuf  = (uint8 *)malloc(DRV_BUFSIZE);
+    CHECK_ALLOC(outbuf, "outbuf", "test_hfile_driver");
+    CHECK_ALLOC(inbuf, "inbuf", "test_hfile_driver");
+
+    /* The I/O counts checked below assume no metadata index, whatever
+       HDF4_METAINDEX says */
+    Hsetmetaindex(FALSE);
+
+    for (i = 0; i < DRV_BUFSIZE; i++)
+        outbuf[i] = (uint8)(i * 7);
+
+    MESSAGE(5, printf("Testing an invalid driver\n"););
+    ret = Hsetdriver(-1);
+    VERIFY_VOID(ret, FAIL, "Hsetdriver");
+
+    for (i = 0; i < NDRIVERS; i++) {
+        /* the mmap driver is not available everywhere */
+        if (Hsetdriver(drivers[i]) == FAIL) {
+            MESSAGE(5, printf("Skipping the unavailable %s driver\n", driver_names[i]););
+            continue;
+        }
+
+        MESSAGE(5, printf("Writing a file with the %s driver\n", driver_names[i]););
+        write_drv_file(drivers[i], outbuf);
+
+        for (j = 0; j < NDRIVERS; j++) {
+            if (Hsetdriver(drivers[j]) == FAIL)
+                continue;
+            MESSAGE(5, printf("Reading it back with the %s driver\n", driver_names[j]););
+            verify_drv_file(drivers[j], outbuf, inbuf);
+            test_readv(drivers[j], outbuf, inbuf);
+            test_readptr(drivers[j], outbuf);
+        }
+
+        /* test_iostats adds an element, do it on a copy of the file */
+        for (j = 0; j < NDRIVERS; j++) {
+            if (Hsetdriver(drivers[j]) == FAIL)
+                continue;
+            MESSAGE(5, printf("Checking the I/O statistics with the %s driver\n", driver_names[j]););
+            write_drv_file(drivers[i], outbuf);
+            ret = Hsetdriver(drivers[j]);
+            CHECK_VOID(ret, FAIL, "Hsetdriver");
+            test_iostats(drivers[j], inbuf);
+        }
+    }
+
+    MESSAGE(5, printf("Testing readahead\n"););
+    test_readahead(HDF_DRIVER_STDIO);
+    test_readahead(HDF_DRIVER_POSIX);
+
+    MESSAGE(5, printf("Testing the metadata index\n"););
+    test_metaindex(HDF_DRIVER_STDIO, outbuf, inbuf);
+    test_metaindex(HDF_DRIVER_POSIX, outbuf, inbuf);
+
+    MESSAGE(5, printf("Testing files held in memory\n"););
+    test_image(outbuf, inbuf);
+
+    /* Go back to the default driver for the other tests */
+    ret = Hsetdriver(HDF_DRIVER_STDIO);
+    CHECK_VOID(ret, FAIL, "Hsetdriver");
+
+    free(outbuf);
+    free(inbuf);
+}
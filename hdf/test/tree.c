@@ -33,15 +33,21 @@
 
 #include <time.h>
 #include "tproto.h"
+#include "arena.h"
 #include "tbbt.h"
 
-#define MAX_TEST_SIZE 31  /* maximum number of elements to insert */
-#define NUM_TEST_RUNS 100 /* number of times to insert & remove each size */
+#define MAX_TEST_SIZE   31   /* maximum number of elements to insert */
+#define NUM_TEST_RUNS   100  /* number of times to insert & remove each size */
+#define ARENA_TEST_SIZE 2000 /* number of elements in the tree in an arena */
+#define ARENA_BIG_SIZE  5000 /* size of the large objects of the arena */
+#define LARGE_TEST_SIZE 10000 /* number of elements in a tree many levels deep */
 
 #define SEED(s)       (srand(s))
 #define RandInt(a, b) ((rand() % (((b) - (a)) + 1)) + (a))
 
 static void swap_arr(int32 *arr, intn a, intn b);
+static void test_arena_tree(void);
+static void test_large_tree(void);
 
 intn tcompare(void *k1, void *k2, intn cmparg);
 
@@ -64,6 +70,157 @@ tcompare(void *k1, void *k2, intn cmparg)
     return (intn)((*(int32 *)k1) - (*(int32 *)k2));
 }
 
+/* Test a tree whose nodes come from an arena, along with objects too large
+   for the free lists of the arena */
+static void
+test_arena_tree(void)
+{
+    static int32 vals[ARENA_TEST_SIZE];
+    int32        ins_arr[ARENA_TEST_SIZE];
+    arena_p      arena;
+    TBBT_TREE   *tree;
+    TBBT_NODE   *node;
+    void        *big;
+    intn         i, n, t;
+    intn         ret;
+
+    MESSAGE(7, printf("\nTesting a tree in an arena\n"););
+    arena = ARcreate_arena(0);
+    CHECK_VOID(arena, NULL, "ARcreate_arena");
+    tree = tbbtdmake_arena(arena, tcompare, sizeof(int32), 0);
+    CHECK_VOID(tree, NULL, "tbbtdmake_arena");
+
+    for (i = 0; i < ARENA_TEST_SIZE; i++) {
+        vals[i]    = i;
+        ins_arr[i] = i;
+    } /* end for */
+    for (i = 0; i < ARENA_TEST_SIZE; i++) {
+        t = RandInt(i, ARENA_TEST_SIZE - 1);
+        swap_arr(ins_arr, i, t);
+    } /* end for */
+
+    /* Enough nodes for several chunks, with large objects in between, some
+       of which are freed right away and some left to the arena */
+    for (i = 0; i < ARENA_TEST_SIZE; i++) {
+        node = tbbtdins(tree, (void *)&vals[ins_arr[i]], NULL);
+        CHECK_VOID(node, NULL, "tbbtdins");
+        if (i % 100 == 0) {
+            big = ARalloc(arena, ARENA_BIG_SIZE);
+            CHECK_VOID(big, NULL, "ARalloc");
+            memset(big, i, ARENA_BIG_SIZE);
+            if (i % 200 == 0)
+                ARfree(arena, big, ARENA_BIG_SIZE);
+        } /* end if */
+    }     /* end for */
+    VERIFY_VOID(tbbtcount(tree), ARENA_TEST_SIZE, "tbbtcount");
+
+    /* Remove the odd values and put them back, in the space just freed */
+    for (i = 1; i < ARENA_TEST_SIZE; i += 2) {
+        node = tbbtdfind(tree, (void *)&vals[i], NULL);
+        CHECK_VOID(node, NULL, "tbbtdfind");
+        tbbtrem((TBBT_NODE **)tree, node, NULL);
+    } /* end for */
+    VERIFY_VOID(tbbtcount(tree), ARENA_TEST_SIZE / 2, "tbbtcount");
+    for (i = 1; i < ARENA_TEST_SIZE; i += 2) {
+        node = tbbtdins(tree, (void *)&vals[i], NULL);
+        CHECK_VOID(node, NULL, "tbbtdins");
+    } /* end for */
+
+    /* All the values must be there, in order */
+    for (node = tbbtfirst(tree->root), n = 0; node != NULL; node = tbbtnext(node), n++)
+        VERIFY_VOID(*(int32 *)node->data, n, "tbbtnext");
+    VERIFY_VOID(n, ARENA_TEST_SIZE, "tbbtnext");
+
+    /* The nodes go away with the arena */
+    tbbtdfree(tree, NULL, NULL);
+    ret = ARdestroy_arena(arena);
+    CHECK_VOID(ret, FAIL, "ARdestroy_arena");
+} /* end test_arena_tree() */
+
+/* Test a tree large enough to have several levels of blocks, with the fast
+   compares, and the lookups by position and by nearest key */
+static void
+test_large_tree(void)
+{
+    static int32 vals[LARGE_TEST_SIZE];
+    static int32 ins_arr[LARGE_TEST_SIZE];
+    TBBT_TREE   *tree;
+    TBBT_NODE   *node;
+    TBBT_NODE   *root = NULL;
+    int32        key;
+    intn         i, n, t;
+
+    MESSAGE(7, printf("\nTesting a tree with %d elements\n", LARGE_TEST_SIZE););
+    tree = tbbtdmake(tcompare, sizeof(int32), TBBT_FAST_INT32_COMPARE);
+    CHECK_VOID(tree, NULL, "tbbtdmake");
+
+    /* Even values only, so that the odd ones fall between the nodes */
+    for (i = 0; i < LARGE_TEST_SIZE; i++) {
+        vals[i]    = 2 * i;
+        ins_arr[i] = i;
+    } /* end for */
+    for (i = 0; i < LARGE_TEST_SIZE; i++) {
+        t = RandInt(i, LARGE_TEST_SIZE - 1);
+        swap_arr(ins_arr, i, t);
+    } /* end for */
+    for (i = 0; i < LARGE_TEST_SIZE; i++) {
+        node = tbbtdins(tree, (void *)&vals[ins_arr[i]], NULL);
+        CHECK_VOID(node, NULL, "tbbtdins");
+    } /* end for */
+    VERIFY_VOID(tbbtcount(tree), LARGE_TEST_SIZE, "tbbtcount");
+    node = tbbtdins(tree, (void *)&vals[0], NULL);
+    VERIFY_VOID((node == NULL), TRUE, "tbbtdins");
+
+    for (i = 0; i < LARGE_TEST_SIZE; i++) {
+        node = tbbtindx(tree->root, i + 1);
+        CHECK_VOID(node, NULL, "tbbtindx");
+        if (node != NULL)
+            VERIFY_VOID(*(int32 *)node->data, vals[i], "tbbtindx");
+        key  = vals[i] + 1;
+        node = tbbtdfind(tree, &key, NULL);
+        VERIFY_VOID((node == NULL), TRUE, "tbbtdfind");
+        node = tbbtdless(tree, &key, NULL);
+        CHECK_VOID(node, NULL, "tbbtdless");
+        if (node != NULL)
+            VERIFY_VOID(*(int32 *)node->data, vals[i], "tbbtdless");
+    } /* end for */
+    VERIFY_VOID((tbbtindx(tree->root, LARGE_TEST_SIZE + 1) == NULL), TRUE, "tbbtindx");
+    key = -1;
+    VERIFY_VOID((tbbtdless(tree, &key, NULL) == NULL), TRUE, "tbbtdless");
+
+    /* Remove three quarters of the nodes, in the order they went in, and
+       walk the rest backwards */
+    for (i = 0; i < (3 * LARGE_TEST_SIZE) / 4; i++) {
+        node = tbbtdfind(tree, (void *)&vals[ins_arr[i]], NULL);
+        CHECK_VOID(node, NULL, "tbbtdfind");
+        tbbtrem((TBBT_NODE **)tree, node, NULL);
+    } /* end for */
+    VERIFY_VOID(tbbtcount(tree), LARGE_TEST_SIZE / 4, "tbbtcount");
+    for (node = tbbtlast(tree->root), n = 0, key = 2 * LARGE_TEST_SIZE; node != NULL;
+         node = tbbtprev(node), n++) {
+        VERIFY_VOID((*(int32 *)node->data < key), TRUE, "tbbtprev");
+        key = *(int32 *)node->data;
+    } /* end for */
+    VERIFY_VOID(n, LARGE_TEST_SIZE / 4, "tbbtprev");
+
+    /* Empty the tree from the front */
+    while (tree->root != NULL)
+        tbbtrem((TBBT_NODE **)tree, tbbtfirst(tree->root), NULL);
+    VERIFY_VOID(tbbtcount(tree), 0, "tbbtcount");
+    tbbtdfree(tree, NULL, NULL);
+
+    /* A tree without tbbtdmake() */
+    for (i = 0; i < LARGE_TEST_SIZE; i++) {
+        node = tbbtins(&root, (void *)&vals[ins_arr[i]], NULL, tcompare, sizeof(int32));
+        CHECK_VOID(node, NULL, "tbbtins");
+    } /* end for */
+    for (node = tbbtfirst(root), n = 0; node != NULL; node = tbbtnext(node), n++)
+        VERIFY_VOID(*(int32 *)node->data, vals[n], "tbbtnext");
+    VERIFY_VOID(n, LARGE_TEST_SIZE, "tbbtnext");
+    tbbtfree(&root, NULL, NULL);
+    VERIFY_VOID((root == NULL), TRUE, "tbbtfree");
+} /* end test_large_tree() */
+
 void
 test_tbbt(void)
 {
@@ -123,4 +280,7 @@ test_tbbt(void)
             tbbtdfree(tree, NULL, NULL);
         } /* end for */
     }     /* end for */
+
+    test_arena_tree();
+    test_large_tree();
 } /* end test_tbbt() */
@@ -0,0 +1,195 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+    FILE - treebench.c
+        Benchmark the trees (tbbt*() routines) the library keeps its tags,
+        vgroups, vdatas and annotations in
+
+    DESIGN
+        - Insert many int32 keys, in random order, into a tree using the
+            fast compares, like the vgroup and vdata trees.
+        - Look all the keys up, in another random order, over and over.
+        - Walk the tree in key order, and look nodes up by position.
+        - Remove all the keys, in random order.
+        - Report the average time of each operation.
+ */
+
+#define TESTMASTER
+
+#include "hdfi.h"
+#include "tbbt.h"
+#include "tutils.h"
+
+/* Default number of keys in the tree */
+#define NUM_KEYS 100000
+
+/* Default number of passes over all the keys */
+#define NUM_PASSES 10
+
+/* Factor for converting seconds to microseconds */
+#define FACTOR 1000000
+
+/* local function prototypes */
+static void usage(void);
+static long elapsed(const struct timeval *start_time);
+static void shuffle(int32 *arr, int32 n);
+static int  compare(void *k1, void *k2, int cmparg);
+
+static void
+usage(void)
+{
+    printf("\nUsage: treebench [nkeys [npasses]] \n\n");
+    printf("where nkeys is the number of keys to put in the tree (default: %d)\n", NUM_KEYS);
+    printf("  and npasses is the number of lookups of each key (default: %d)\n", NUM_PASSES);
+    printf("\n");
+} /* end usage() */
+
+/* Microseconds elapsed since START_TIME */
+static long
+elapsed(const struct timeval *start_time)
+{
+    struct timeval end_time;
+
+    gettimeofday(&end_time, NULL);
+    return (end_time.tv_sec - start_time->tv_sec) * FACTOR + (end_time.tv_usec - start_time->tv_usec);
+} /* end elapsed() */
+
+/* Puts the N values of ARR in random order */
+static void
+shuffle(int32 *arr, int32 n)
+{
+    for (int32 i = n - 1; i > 0; i--) {
+        int32 j = (int32)(rand() % (i + 1));
+        int32 t = arr[i];
+
+        arr[i] = arr[j];
+        arr[j] = t;
+    }
+} /* end shuffle() */
+
+/* Compares two int32 keys, like the library's trees */
+static int
+compare(void *k1, void *k2, int cmparg)
+{
+    (void)cmparg;
+    return (*(int32 *)k1 > *(int32 *)k2) - (*(int32 *)k1 < *(int32 *)k2);
+} /* end compare() */
+
+int
+main(int argc, char *argv[])
+{
+    struct timeval start_time;
+    int32          nkeys;   /* number of keys in the tree */
+    int32          npasses; /* number of lookups of each key */
+    int32         *keys;    /* the keys, also the data of the nodes */
+    int32         *order;   /* order the keys are used in */
+    TBBT_TREE     *tree;
+    TBBT_NODE     *node;
+    long           insert_time, find_time, walk_time, indx_time, remove_time;
+    int32          nfound = 0, nwalked = 0;
+    uint32         lmajor, lminor, lrelease;
+    char           lstring[81];
+
+    /* Un-buffer stdout */
+    setbuf(stdout, NULL);
+
+    if (argc > 3) {
+        usage();
+        exit(1);
+    }
+    nkeys   = (argc >= 2) ? (int32)atol(argv[1]) : (int32)NUM_KEYS;
+    npasses = (argc >= 3) ? (int32)atol(argv[2]) : (int32)NUM_PASSES;
+    if (nkeys <= 0 || npasses <= 0) {
+        usage();
+        exit(1);
+    }
+
+    Verbosity = 4; /* Default Verbosity is Low */
+
+    Hgetlibversion(&lmajor, &lminor, &lrelease, lstring);
+
+    printf("Built with HDF Library Version: %u.%u.%u, %s\n\n", (unsigned)lmajor, (unsigned)lminor,
+           (unsigned)lrelease, lstring);
+
+    MESSAGE(6, printf("Starting tree benchmark (nkeys=%d, npasses=%d)\n", nkeys, npasses);)
+
+    keys  = (int32 *)malloc((size_t)nkeys * sizeof(int32));
+    order = (int32 *)malloc((size_t)nkeys * sizeof(int32));
+    if (keys == NULL || order == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (int32 i = 0; i < nkeys; i++) {
+        keys[i]  = 2 * i; /* spread out, like the refs of a file */
+        order[i] = i;
+    }
+    srand(1);
+
+    tree = tbbtdmake(compare, sizeof(int32), TBBT_FAST_INT32_COMPARE);
+    CHECK(tree, NULL, "tbbtdmake");
+
+    shuffle(order, nkeys);
+    gettimeofday(&start_time, NULL);
+    for (int32 i = 0; i < nkeys; i++) {
+        node = tbbtdins(tree, &keys[order[i]], NULL);
+        CHECK(node, NULL, "tbbtdins");
+    }
+    insert_time = elapsed(&start_time);
+    VERIFY(tbbtcount(tree), nkeys, "tbbtcount");
+
+    shuffle(order, nkeys);
+    gettimeofday(&start_time, NULL);
+    for (int32 n = 0; n < npasses; n++)
+        for (int32 i = 0; i < nkeys; i++)
+            if (tbbtdfind(tree, &keys[order[i]], NULL) != NULL)
+                nfound++;
+    find_time = elapsed(&start_time);
+    VERIFY(nfound, npasses * nkeys, "tbbtdfind");
+
+    gettimeofday(&start_time, NULL);
+    for (int32 n = 0; n < npasses; n++)
+        for (node = tbbtfirst(tree->root); node != NULL; node = tbbtnext(node))
+            nwalked++;
+    walk_time = elapsed(&start_time);
+    VERIFY(nwalked, npasses * nkeys, "tbbtnext");
+
+    gettimeofday(&start_time, NULL);
+    for (int32 i = 0; i < nkeys; i++)
+        if (tbbtindx(tree->root, order[i] + 1) != NULL)
+            nfound++;
+    indx_time = elapsed(&start_time);
+    VERIFY(nfound, (npasses + 1) * nkeys, "tbbtindx");
+
+    shuffle(order, nkeys);
+    gettimeofday(&start_time, NULL);
+    for (int32 i = 0; i < nkeys; i++)
+        tbbtrem((TBBT_NODE **)tree, tbbtdfind(tree, &keys[order[i]], NULL), NULL);
+    remove_time = elapsed(&start_time);
+    VERIFY(tbbtcount(tree), 0, "tbbtcount");
+
+    tbbtdfree(tree, NULL, NULL);
+
+    printf("Keys in the tree:     %d\n", (int)nkeys);
+    printf("Average insert time:  %f microseconds\n", (double)insert_time / nkeys);
+    printf("Average find time:    %f microseconds\n", (double)find_time / ((double)npasses * nkeys));
+    printf("Average next time:    %f microseconds\n", (double)walk_time / ((double)npasses * nkeys));
+    printf("Average index time:   %f microseconds\n", (double)indx_time / nkeys);
+    printf("Average remove time:  %f microseconds\n", (double)remove_time / nkeys);
+
+    free(keys);
+    free(order);
+
+    MESSAGE(6, printf("Finished tree benchmark\n");)
+    return num_errs;
+} /* end main() */
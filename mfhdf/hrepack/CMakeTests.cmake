@@ -298,5 +298,12 @@ ADD_H4_TEST(HYPERSLAB "TEST" ${HREPACK_FILE2})
 #
 ADD_H4_TEST(VGROUP "TEST" ${HREPACK_FILE3})
 
+#-------------------------------------------------------------------------
+# test12:
+# repack a file with vgroups and compact the output
+#-------------------------------------------------------------------------
+#
+ADD_H4_TEST(COMPACT "TEST" ${HREPACK_FILE3} -k)
+
 #    if (vg_verifygrpdep(HREPACK_FILE3,HREPACK_FILE3_OUT) != 0 )
 #        goto out;
@@ -64,6 +64,16 @@ hrepack_main(const char *infile, const char *outfile, options_t *options)
     if (list_main(infile, outfile, options) < 0)
         return FAIL;
 
+    /* put the DD list and the metadata of the new file at its head */
+    if (options->compact) {
+        if (options->verbose)
+            printf("Compacting %s...\n", outfile);
+        if (Hcompact(outfile) == FAIL) {
+            printf("Error: Could not compact <%s>\n", outfile);
+            return FAIL;
+        }
+    }
+
     return SUCCEED;
 }
 
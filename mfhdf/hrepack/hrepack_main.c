@@ -95,6 +95,10 @@ main(int argc, char **argv)
                 goto out;
         }
 
+        else if (strcmp(argv[i], "-k") == 0) {
+            options.compact = 1;
+        }
+
         else if (argv[i][0] == '-') {
             goto out;
         }
@@ -139,7 +143,7 @@ usage(void)
 {
 
     printf("usage: hrepack -i input -o output [-V] [-h] [-v] [-t 'comp_info'] [-c 'chunk_info'] [-f cfile] "
-           "[-m size]\n");
+           "[-m size] [-k]\n");
     printf("  -i input          input HDF File\n");
     printf("  -o output         output HDF File\n");
     printf("  [-V]              prints version of the HDF4 library and exits\n");
@@ -173,6 +177,7 @@ usage(void)
     printf("\t\t        NONE, to unchunk a previous chunked object\n");
     printf("  [-f cfile]      file with compression information -t and -c\n");
     printf("  [-m size]       do not compress objects smaller than size (bytes)\n");
+    printf("  [-k]            compact the output: put its DD list and metadata at the head\n");
     printf("\n");
     printf("Examples:\n");
     printf("\n");
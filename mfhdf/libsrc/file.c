@@ -209,6 +209,15 @@ NC_check_id(int cdfid)
     return (handle);
 }
 
+/*
+ *  Return pointer to NC struct of a cdf handle, or NULL, without advising.
+ */
+NC *
+NC_find_id(int cdfid)
+{
+    return (HNDLE(cdfid));
+}
+
 /*
  *  Check to see if in define mode.
  * If 'iserr' arg is true, advise.
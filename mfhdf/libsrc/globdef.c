@@ -38,6 +38,6 @@ int ncopts = (NC_FATAL | NC_VERBOSE);
 
 /*
  *    Set to the the name of the current interface routine by the
- * interface routine.
+ * interface routine, for each thread in a threadsafe build.
  */
-const char *cdf_routine_name = "netcdf";
+H4_THREAD_LOCAL const char *cdf_routine_name = "netcdf";
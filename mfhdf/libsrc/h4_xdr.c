@@ -57,6 +57,7 @@
 #endif
 
 #include "h4_xdr.h"
+#include "hthread.h"
 
 /*
  * This is the number of bytes per unit of external data.
@@ -133,7 +134,7 @@ bool_t
 h4_xdr_opaque(XDR *xdrs, char *cp, unsigned cnt)
 {
     unsigned   rndup;
-    static int crud[BYTES_PER_XDR_UNIT];
+    static H4_THREAD_LOCAL int crud[BYTES_PER_XDR_UNIT];
 
     /*
      * if no data we are done
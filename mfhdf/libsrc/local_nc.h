@@ -54,6 +54,7 @@
 
 #include "vg.h"
 #include "hfile.h"
+#include "hthread.h"
 #include "mfhdfi.h"
 
 #define ATTR_TAG  DFTAG_VH
@@ -202,7 +203,7 @@ typedef struct {
 #define HDF_FILE    1
 #define CDF_FILE    2
 
-HDFLIBAPI const char *cdf_routine_name; /* defined in lerror.c */
+HDFLIBAPI H4_THREAD_LOCAL const char *cdf_routine_name; /* defined in globdef.c */
 
 #define MAGICOFFSET 0 /* Offset where format version number is written */
 
@@ -268,6 +269,7 @@ extern "C" {
 #define xdr_NC_var        HNAME(xdr_NC_var)
 #define NC_typelen        HNAME(NC_typelen)
 #define NC_check_id       HNAME(NC_check_id)
+#define NC_find_id        HNAME(NC_find_id)
 #define NC_dup_cdf        HNAME(NC_dup_cdf)
 #define NC_new_cdf        HNAME(NC_new_cdf)
 #define NC_new_array      HNAME(NC_new_array)
@@ -434,6 +436,7 @@ HDFLIBAPI bool_t xdr_NC_var(XDR *xdrs, NC_var **vpp);
 HDFLIBAPI size_t NC_typelen(nc_type type);
 
 HDFLIBAPI NC        *NC_check_id(int cdfid);
+HDFLIBAPI NC        *NC_find_id(int cdfid);
 HDFLIBAPI NC        *NC_dup_cdf(const char *name, int mode, NC *old);
 HDFLIBAPI NC        *NC_new_cdf(const char *name, int mode);
 HDFLIBAPI NC_array  *NC_new_array(nc_type type, unsigned count, const void *values);
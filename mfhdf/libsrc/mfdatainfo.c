@@ -47,6 +47,7 @@ LOCAL ROUTINES
 #define DATAINFO_MASTER
 #endif
 #include "mfhdf.h"
+#include "hthread.h"
 
 #ifdef H4_HAVE_LIBSZ /* we have the szip library */
 #include "szlib.h"
@@ -109,6 +110,8 @@ SDgetdatainfo(int32 sdsid, int32 *chk_coord, uintn start_block, uintn info_count
     intn    count     = FAIL; /* number of data blocks */
     intn    ret_value = 0;
 
+    SD_LOCK(sdsid);
+
     /* Clear error stack */
     HEclear();
 
@@ -157,6 +160,7 @@ SDgetdatainfo(int32 sdsid, int32 *chk_coord, uintn start_block, uintn info_count
     /* Returning number of data blocks */
     ret_value = count;
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetdatainfo */
 
@@ -213,6 +217,8 @@ SDgetattdatainfo(int32 id, int32 attrindex, int32 *offset, int32 *length)
         found,   /* TRUE when attribute is found */
         ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* Clear error stack */
     HEclear();
 
@@ -383,6 +389,7 @@ done:
                 HGOTO_ERROR(DFE_CANTDETACH, FAIL);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetattdatainfo */
 
@@ -500,6 +507,8 @@ SDgetoldattdatainfo(int32 dim_id, int32 sdsid, char *attr_name, int32 *offset, i
     intn    status, /* returned value */
         ret_value = 0;
 
+    SD_LOCK(dim_id);
+
     /* Clear error stack */
     HEclear();
 
@@ -656,6 +665,7 @@ done:
         free(lufbuf);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetoldattdatainfo */
 
@@ -705,6 +715,8 @@ SDgetanndatainfo(int32 sdsid, ann_type annot_type, uintn size, int32 *offsetarra
     intn   num_annots = -1,    /* number of annotation of requested type */
         ii, ret_value = 0;
 
+    SD_LOCK(sdsid);
+
     /* Clear error stack */
     HEclear();
 
@@ -851,5 +863,6 @@ done:
     if (file_id != FAIL)
         Hclose(file_id);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetanndatainfo */
@@ -60,6 +60,10 @@ HDFLIBAPI int32 SDstart(const char *name, int32 accs);
 
 HDFLIBAPI intn SDend(int32 fid);
 
+HDFLIBAPI int32 SDstart_image(const void *image, int32 size, int32 accs);
+
+HDFLIBAPI intn SDend_image(int32 fid, void **image, int32 *size);
+
 HDFLIBAPI intn SDfileinfo(int32 fid, int32 *datasets, int32 *attrs);
 
 HDFLIBAPI int32 SDselect(int32 fid, int32 idx);
@@ -414,6 +418,50 @@ HDFLIBAPI intn SDsetchunkcache(int32 sdsid,    /* IN: sds access id */
                                int32 maxcache, /* IN: max number of chunks to cache */
                                int32 flags /* IN: flags = 0, HDF_CACHEALL */);
 
+/******************************************************************************
+NAME
+     SDsetfilechunkcache -- size the chunk cache shared by the SDSs of a file
+
+DESCRIPTION
+     Keep the chunks of all the chunked SDSs of the file in one cache of
+     'size' bytes, instead of a cache of 'maxcache' chunks per SDS (see
+     SDsetchunkcache()).  When the cache is full, 'policy' picks the chunk
+     to give up, from whichever SDS: HDF_CHUNK_CACHE_LRU (least recently
+     used), HDF_CHUNK_CACHE_CLOCK (second chance) or HDF_CHUNK_CACHE_ARC
+     (adaptive replacement, which keeps the chunks used more than once
+     through long scans of other chunks).  A size of 0 goes back to a
+     cache per SDS.
+
+     The cache is used by the SDSs first read or written afterwards; a
+     smaller size of the same policy takes effect at once.  See
+     Hsetchunkcache().
+
+RETURNS
+     SUCCEED/FAIL
+******************************************************************************/
+HDFLIBAPI intn SDsetfilechunkcache(int32 fid,  /* IN: file id, returned from SDstart */
+                                   int32 size, /* IN: # of bytes of chunks to cache */
+                                   intn  policy /* IN: HDF_CHUNK_CACHE_xxx */);
+
+/******************************************************************************
+NAME
+     SDsetfilechunkthreads -- (de)compress the chunks of a file on several threads
+
+DESCRIPTION
+     Lets SDreaddata() decompress the chunks of the chunked SDSs of the
+     file on up to 'nthreads' threads at the same time, the calling one
+     included, when a read needs many chunks which are not in the chunk
+     cache, and SDwritedata() and SDwritechunk() compress the new chunks
+     they write on as many threads.  0 or 1 (de)compresses the chunks one
+     after the other, as by default.  Only chunks compressed with gzip
+     'deflate' are (de)compressed in parallel.  See Hsetchunkthreads().
+
+RETURNS
+     SUCCEED/FAIL
+******************************************************************************/
+HDFLIBAPI intn SDsetfilechunkthreads(int32 fid, /* IN: file id, returned from SDstart */
+                                     intn  nthreads /* IN: # of threads, 0 or 1 for none */);
+
 /*
  ** Public functions for getting raw data information - from mfdatainfo.c
  */
@@ -51,4 +51,14 @@ intn SDIapfromid(int32 id, NC **handlep, NC_array ***app);
 /* Check permission on the file */
 int SDI_can_clobber(const char *name);
 
+/* Take the locks for a call on an object, in a threadsafe build: SD_LOCK
+   on entry to the routines working on an object of an open file, matched
+   by H4_API_UNLOCK (see hthread.h) */
+#ifdef H4_HAVE_THREADSAFE
+void SDIlock(int32 id);
+#define SD_LOCK(id) SDIlock(id)
+#else
+#define SD_LOCK(id) ((void)0)
+#endif
+
 #endif /* MFH4_MFPRIVATE_H */
@@ -26,6 +26,9 @@ SD interface:
     --- open a file ---
 fid    = SDstart(file name, access);
 
+    --- open a file held in memory ---
+fid    = SDstart_image(image, size, access);
+
         --- get number of data sets and number of attributes in the file ---
 status = SDfileinfo(fid, *n_datasets, *n_attrs);
 
@@ -41,6 +44,9 @@ status = SDgetrange(sdsid, ...);
 
 status = SDend(fid);
 
+    --- close a file held in memory and get its final image ---
+status = SDend_image(fid, &image, &size);
+
 status = SDisdimval_bwcomp(dimid);
 
     --- check whether a data set is empty
@@ -87,6 +93,7 @@ NOTE: This file needs to have the comments cleaned up for most of the
 
 #include "mfhdf.h"
 #include "hfile.h"
+#include "hthread.h"
 
 #ifdef H4_HAVE_LIBSZ /* we have the szip library */
 #include "szlib.h"
@@ -214,6 +221,37 @@ SDIget_dim(NC   *handle, /* IN: the handle for this file */
 done:
     return ret_value;
 } /* SDIget_dim */
+
+#ifdef H4_HAVE_THREADSAFE
+/******************************************************************************
+ NAME
+    SDIlock -- take the locks for a call on an object
+
+ DESCRIPTION
+    Takes the library lock shared with the other threads, then the lock of
+    the HDF file the object (file, dataset or dimension) belongs to, so
+    that calls on objects of different files run at the same time.  The
+    objects of netCDF files, and the IDs which are not valid, share one
+    lock.  Released by H4_API_UNLOCK.
+
+ RETURNS
+    None
+
+******************************************************************************/
+void
+SDIlock(int32 id /* IN: an object (file, dim, dataset) ID */)
+{
+    NC *handle = NULL;
+
+    HTSPlock_shared();
+
+    /* the file is in the top 12 bits, whatever the type of the ID */
+    if (id != FAIL)
+        handle = NC_find_id((int)((id >> 20) & 0xfff));
+
+    HTSPlock_file((handle != NULL && handle->file_type == HDF_FILE) ? handle->hdf_file : FAIL);
+} /* SDIlock */
+#endif /* H4_HAVE_THREADSAFE */
 #endif /* MFSD_INTERNAL */
 
 /******************************************************************************
@@ -239,6 +277,10 @@ SDIstart(void)
     if (HPregister_term_func(&SDPfreebuf) != 0)
         HGOTO_ERROR(DFE_CANTINIT, FAIL);
 
+    /* Free the buffers of the threads as they exit, in a threadsafe build */
+    if (HTSPregister_thread_func(&SDPfreebuf) != 0)
+        HGOTO_ERROR(DFE_CANTINIT, FAIL);
+
 done:
     return (ret_value);
 } /* end SDIstart() */
@@ -308,6 +350,8 @@ SDstart(const char *name, /* IN: file name to open */
     NC   *handle    = NULL;
     int32 ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -356,6 +400,7 @@ SDstart(const char *name, /* IN: file name to open */
     ret_value = fid;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDstart */
 
@@ -377,6 +422,8 @@ SDend(int32 id /* IN: file ID of file to close */)
     NC  *handle    = NULL;
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -418,9 +465,106 @@ SDend(int32 id /* IN: file ID of file to close */)
     ret_value = ncclose(cdfid);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDend */
 
+/******************************************************************************
+ NAME
+    SDstart_image -- open a file held in memory
+
+ DESCRIPTION
+    Like SDstart(), but the file is the memory image of an HDF file (see
+    Hopen_image()).  With DFACC_CREATE, the image is ignored and a new
+    file is built in memory.  A file opened read-only uses the image in
+    place, so it must stay valid until the file is closed.  The file must
+    be closed with SDend_image().
+
+ RETURNS
+    A file ID or FAIL
+
+******************************************************************************/
+int32
+SDstart_image(const void *image, /* IN: the file image */
+              int32       size,  /* IN: # of bytes in the image */
+              int32       accs /* IN: access mode to open file with */)
+{
+    char  name[HFILE_IMAGE_NAMELEN];
+    int32 ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    /* clear error stack */
+    HEclear();
+
+    if (accs & DFACC_CREATE) {
+        image = NULL;
+        size  = 0;
+    }
+    else if (image == NULL || size <= 0)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    if (HFPimage_register(image, size, name) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+
+    if ((ret_value = SDstart(name, accs)) == FAIL)
+        HFPimage_release(name, NULL, NULL);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* SDstart_image */
+
+/******************************************************************************
+ NAME
+    SDend_image -- close a file held in memory and get its image
+
+ DESCRIPTION
+    Close a file opened with SDstart_image() and hand back its final
+    image.  No other interface may still have the file open.  If the
+    file was created or opened for write, the image is a buffer
+    allocated by the library which the caller must free with free();
+    otherwise it is the image given to SDstart_image().  If 'image' is
+    NULL, the image is discarded.
+
+ RETURNS
+    SUCCEED / FAIL
+
+******************************************************************************/
+intn
+SDend_image(int32  id,    /* IN: file ID of file to close */
+            void **image, /* OUT: the final image of the file */
+            int32 *size /* OUT: # of bytes in the image */)
+{
+    NC  *handle;
+    char name[HFILE_IMAGE_NAMELEN];
+    intn ret_value = SUCCEED;
+
+    H4_API_LOCK;
+
+    /* clear error stack */
+    HEclear();
+
+    /* get the handle */
+    handle = SDIhandle_from_id(id, CDFTYPE);
+    if (handle == NULL || handle->file_type != HDF_FILE)
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+    if (strlen(handle->path) >= sizeof(name))
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+
+    /* the handle goes away with the file */
+    strcpy(name, handle->path);
+    if (SDend(id) == FAIL)
+        HGOTO_ERROR(DFE_CANTCLOSE, FAIL);
+
+    if (HFPimage_release(name, image, size) == FAIL)
+        HGOTO_ERROR(DFE_INTERNAL, FAIL);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* SDend_image */
+
 /******************************************************************************
  NAME
     SDfileinfo -- get info about an open file
@@ -443,6 +587,8 @@ SDfileinfo(int32  fid,      /* IN:  file ID */
     NC  *handle    = NULL;
     intn ret_value = SUCCEED;
 
+    SD_LOCK(fid);
+
     /* clear error stack */
     HEclear();
 
@@ -457,6 +603,7 @@ SDfileinfo(int32  fid,      /* IN:  file ID */
     *(int32 *)attrs    = ((handle->attrs != NULL) ? handle->attrs->count : 0);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDfileinfo */
 
@@ -494,6 +641,8 @@ SDselect(int32 fid, /* IN: file ID */
     int32 sdsid; /* the id we're gonna build */
     int32 ret_value = FAIL;
 
+    SD_LOCK(fid);
+
     /* clear error stack */
     HEclear();
 
@@ -518,6 +667,7 @@ SDselect(int32 fid, /* IN: file ID */
     ret_value = sdsid;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDselect */
 
@@ -551,6 +701,8 @@ SDgetinfo(int32  sdsid,    /* IN:  dataset ID */
     NC_var *var       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -602,6 +754,7 @@ SDgetinfo(int32  sdsid,    /* IN:  dataset ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetinfo */
 
@@ -641,6 +794,8 @@ SDreaddata(int32  sdsid,  /* IN:  dataset ID */
 #endif
     intn ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* This decides how a dataset with unlimited dimension is read along the
        unlimited dimension; the behavior is different between SD and nc APIs */
     cdf_routine_name = "SDreaddata";
@@ -771,6 +926,7 @@ done:
         }
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDreaddata */
 
@@ -801,6 +957,8 @@ SDnametoindex(int32       fid, /* IN: file ID */
     NC_var **dp        = NULL;
     int32    ret_value = FAIL;
 
+    SD_LOCK(fid);
+
     /* check that fid is valid */
     handle = SDIhandle_from_id(fid, CDFTYPE);
     if (handle == NULL) {
@@ -822,6 +980,7 @@ SDnametoindex(int32       fid, /* IN: file ID */
     ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDnametoindex */
 
@@ -852,6 +1011,8 @@ SDgetnumvars_byname(int32       fid,  /* IN: file ID */
     NC_var **dp        = NULL;
     intn     ret_value = SUCCEED;
 
+    SD_LOCK(fid);
+
     /* clear error stack */
     HEclear();
 
@@ -874,6 +1035,7 @@ SDgetnumvars_byname(int32       fid,  /* IN: file ID */
     *n_vars = count;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetnumvars_byname */
 
@@ -909,6 +1071,8 @@ SDnametoindices(int32          fid,  /* IN: file ID */
     hdf_varlist_t *varlistp;
     int32          ret_value = SUCCEED;
 
+    SD_LOCK(fid);
+
     /* clear error stack */
     HEclear();
 
@@ -934,6 +1098,7 @@ SDnametoindices(int32          fid,  /* IN: file ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDnametoindices */
 
@@ -970,6 +1135,8 @@ SDgetrange(int32 sdsid, /* IN:  dataset ID */
     NC_array *array     = NULL;
     intn      ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -1007,6 +1174,7 @@ SDgetrange(int32 sdsid, /* IN:  dataset ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetrange */
 
@@ -1080,6 +1248,8 @@ SDcreate(int32       fid,  /* IN: file ID */
     intn    is_ragged;
     int32   ret_value = FAIL;
 
+    SD_LOCK(fid);
+
     /* clear error stack */
     HEclear();
 
@@ -1210,6 +1380,7 @@ SDcreate(int32       fid,  /* IN: file ID */
     ret_value = sdsid;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDcreate */
 
@@ -1245,6 +1416,8 @@ SDgetdimid(int32 sdsid, /* IN: dataset ID */
     int32   dimindex; /* index of dim in the file, ie. dims of all SDSs */
     int32   ret_value = FAIL;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -1281,6 +1454,7 @@ SDgetdimid(int32 sdsid, /* IN: dataset ID */
     ret_value = id;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetdimid */
 
@@ -1313,6 +1487,8 @@ SDsetdimname(int32       id, /* IN: dataset ID */
     unsigned   ii;
     intn       ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -1364,6 +1540,7 @@ SDsetdimname(int32       id, /* IN: dataset ID */
     handle->flags |= NC_HDIRTY;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetdimname */
 
@@ -1384,6 +1561,8 @@ SDendaccess(int32 id /* IN: dataset ID */)
     NC   *handle;
     int32 ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -1397,6 +1576,7 @@ SDendaccess(int32 id /* IN: dataset ID */)
     ret_value = SDIfreevarAID(handle, id & 0xffff);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDendaccess */
 
@@ -1506,6 +1686,8 @@ SDsetrange(int32 sdsid, /* IN: dataset ID */
     intn    sz;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -1541,6 +1723,7 @@ SDsetrange(int32 sdsid, /* IN: dataset ID */
     handle->flags |= NC_HDIRTY;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetrange */
 
@@ -1648,6 +1831,8 @@ SDsetattr(int32       id,    /* IN: object ID */
     intn       sz;
     intn       ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* Clear error stack */
     HEclear();
 
@@ -1696,6 +1881,7 @@ SDsetattr(int32       id,    /* IN: object ID */
     handle->flags |= NC_HDIRTY;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetattr */
 
@@ -1727,6 +1913,8 @@ SDattrinfo(int32  id,    /* IN:  object ID */
     NC        *handle    = NULL;
     intn       ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -1763,6 +1951,7 @@ SDattrinfo(int32  id,    /* IN:  object ID */
     *nt    = (*atp)->HDFtype;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDattrinfo */
 
@@ -1790,6 +1979,8 @@ SDreadattr(int32 id,    /* IN:  object ID */
     NC        *handle    = NULL;
     intn       ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -1820,6 +2011,7 @@ SDreadattr(int32 id,    /* IN:  object ID */
     memcpy(buf, (*atp)->data->values, (*atp)->data->count * (*atp)->data->szof);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDreadattr */
 
@@ -1863,6 +2055,8 @@ SDwritedata(int32  sdsid,  /* IN: dataset ID */
     intn ret_value  = SUCCEED;
     int  i;
 
+    SD_LOCK(sdsid);
+
     /* this decides how a dataset with unlimited dimension is written along the
        unlimited dimension; the behavior is different between SD and nc APIs */
     cdf_routine_name = "SDwritedata";
@@ -1992,6 +2186,7 @@ done:
         }
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDwritedata */
 
@@ -2020,6 +2215,8 @@ SDsetdatastrs(int32       sdsid, /* IN: dataset ID */
     NC_var *var       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -2066,6 +2263,7 @@ SDsetdatastrs(int32       sdsid, /* IN: dataset ID */
         handle->flags |= NC_HDIRTY;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetdatastrs */
 
@@ -2092,6 +2290,8 @@ SDsetcal(int32   sdsid, /* IN: dataset ID */
     NC_var *var       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -2133,6 +2333,7 @@ SDsetcal(int32   sdsid, /* IN: dataset ID */
     handle->flags |= NC_HDIRTY;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetcal */
 
@@ -2156,6 +2357,8 @@ SDsetfillvalue(int32 sdsid, /* IN: dataset ID */
     NC_var *var       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -2181,6 +2384,7 @@ SDsetfillvalue(int32 sdsid, /* IN: dataset ID */
     handle->flags |= NC_HDIRTY;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetfillvalue */
 
@@ -2206,6 +2410,8 @@ SDgetfillvalue(int32 sdsid, /* IN:  dataset ID */
     NC_attr **attr      = NULL;
     intn      ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -2235,6 +2441,7 @@ SDgetfillvalue(int32 sdsid, /* IN:  dataset ID */
     NC_copy_arrayvals((char *)val, (*attr)->data);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetfillvalue */
 
@@ -2265,6 +2472,8 @@ SDgetdatastrs(int32 sdsid, /* IN:  dataset ID */
     NC_attr **attr      = NULL;
     intn      ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -2339,6 +2548,7 @@ SDgetdatastrs(int32 sdsid, /* IN:  dataset ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetdatastrs */
 
@@ -2366,6 +2576,8 @@ SDgetcal(int32    sdsid, /* IN:  dataset ID */
     NC_attr **attr      = NULL;
     intn      ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -2414,6 +2626,7 @@ SDgetcal(int32    sdsid, /* IN:  dataset ID */
     NC_copy_arrayvals((char *)nt, (*attr)->data);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetcal */
 
@@ -2565,6 +2778,8 @@ SDsetdimstrs(int32       id, /* IN: dimension ID */
     NC_var *var       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -2615,6 +2830,7 @@ SDsetdimstrs(int32       id, /* IN: dimension ID */
     handle->flags |= NC_HDIRTY;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetdimstrs */
 
@@ -2690,6 +2906,8 @@ SDsetdimscale(int32 id,    /* IN: dimension ID */
     long    end[1];
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* this decides how a dataset with unlimited dimension is written along the
        unlimited dimension; the behavior is different between SD and nc APIs */
     cdf_routine_name = "SDsetdimscales";
@@ -2736,6 +2954,7 @@ done:
         handle->flags |= NC_HDIRTY;
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetdimscale */
 
@@ -2765,6 +2984,8 @@ SDgetdimscale(int32 id, /* IN:  dimension ID */
     long    end[1];
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* this decides how a dataset with unlimited dimension is read along the
        unlimited dimension; the behavior is different between SD and nc APIs */
     cdf_routine_name = "SDgetdimscale";
@@ -2826,6 +3047,7 @@ done:
         handle->flags |= NC_HDIRTY;
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetdimscale */
 
@@ -2858,6 +3080,8 @@ SDdiminfo(int32  id,   /* IN:  dimension ID */
     intn     len;
     int      ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -2930,6 +3154,7 @@ SDdiminfo(int32  id,   /* IN:  dimension ID */
         }
     }
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDdiminfo */
 
@@ -2963,6 +3188,8 @@ SDgetdimstrs(int32 id, /* IN:  dataset ID */
     int32     namelen;
     intn      ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -3066,6 +3293,7 @@ SDgetdimstrs(int32 id, /* IN:  dataset ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetdimstrs */
 
@@ -3110,6 +3338,8 @@ SDsetexternalfile(int32       id,       /* IN: dataset ID */
     intn    status;
     int     ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -3173,6 +3403,7 @@ SDsetexternalfile(int32       id,       /* IN: dataset ID */
         ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetexternalfile */
 
@@ -3223,6 +3454,8 @@ SDgetexternalinfo(int32  id,           /* IN: dataset ID */
     intn    actual_fname_len = 0;
     intn    ret_value        = SUCCEED;
 
+    SD_LOCK(id);
+
     /* Clear error stack */
     HEclear();
 
@@ -3315,6 +3548,7 @@ done:
             Hendaccess(aid);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetexternalinfo */
 
@@ -3363,6 +3597,8 @@ SDgetexternalfile(int32  id,           /* IN: dataset ID */
     intn    actual_len = 0;
     int     ret_value  = 0;
 
+    SD_LOCK(id);
+
     /* Clear error stack */
     HEclear();
 
@@ -3428,6 +3664,7 @@ SDgetexternalfile(int32  id,           /* IN: dataset ID */
             HGOTO_ERROR(DFE_CANTENDACCESS, FAIL);
     }
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetexternalfile (Deprecated) */
 
@@ -3478,6 +3715,8 @@ SDsetnbitdataset(int32 id,        /* IN: dataset ID */
     intn       status;
     intn       ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -3531,6 +3770,7 @@ SDsetnbitdataset(int32 id,        /* IN: dataset ID */
     ret_value = status;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetnbitdataset */
 
@@ -3623,6 +3863,8 @@ SDsetcompress(int32        id,        /* IN: dataset ID */
     intn       status    = FAIL;
     intn       ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -3737,6 +3979,7 @@ SDsetcompress(int32        id,        /* IN: dataset ID */
     ret_value = (status != FAIL ? SUCCEED : FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetcompress */
 
@@ -3765,6 +4008,8 @@ SDgetcompress(
     intn status    = FAIL;
     intn ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -3773,6 +4018,7 @@ SDgetcompress(
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetcompress */
 
@@ -3802,6 +4048,8 @@ SDgetcompinfo(int32         sdsid,     /* IN: dataset ID */
     intn    status    = FAIL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -3838,6 +4086,7 @@ SDgetcompinfo(int32         sdsid,     /* IN: dataset ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetcompinfo */
 
@@ -3868,6 +4117,8 @@ SDgetcomptype(int32         sdsid, /* IN: dataset ID */
     intn    status    = FAIL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -3899,6 +4150,7 @@ SDgetcomptype(int32         sdsid, /* IN: dataset ID */
         HGOTO_ERROR(DFE_INTERNAL, FAIL);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetcomptype */
 
@@ -3928,6 +4180,8 @@ SDgetdatasize(int32  sdsid,     /* IN: dataset ID */
     int32  *comp_size_tmp = NULL;
     int32  *orig_size_tmp = NULL;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -3983,6 +4237,7 @@ done:
         }
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetdatasize */
 
@@ -4011,6 +4266,8 @@ SDfindattr(int32       id, /* IN: object ID */
     size_t     len;
     int32      ret_value = FAIL;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -4040,6 +4297,7 @@ SDfindattr(int32       id, /* IN: object ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDfindattr */
 
@@ -4062,6 +4320,8 @@ SDidtoref(int32 id /* IN: dataset ID */)
     NC_var *var       = NULL;
     int32   ret_value = FAIL;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -4082,6 +4342,7 @@ SDidtoref(int32 id /* IN: dataset ID */)
     ret_value = (int32)var->ndg_ref;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDidtoref */
 
@@ -4105,6 +4366,8 @@ SDreftoindex(int32 fid, /* IN: file ID */
     intn     ii;
     int32    ret_value = FAIL;
 
+    SD_LOCK(fid);
+
     /* clear error stack */
     HEclear();
 
@@ -4127,6 +4390,7 @@ SDreftoindex(int32 fid, /* IN: file ID */
     ret_value = FAIL;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDreftoindex */
 
@@ -4149,6 +4413,8 @@ SDisrecord(int32 id /* IN: dataset ID */)
     NC_var *var       = NULL;
     int32   ret_value = TRUE;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -4177,6 +4443,7 @@ SDisrecord(int32 id /* IN: dataset ID */)
         ret_value = FALSE;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDisrecord */
 
@@ -4200,6 +4467,8 @@ SDiscoordvar(int32 id /* IN: dataset ID */)
     int32   dimindex;
     intn    ret_value = TRUE;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -4252,6 +4521,7 @@ SDiscoordvar(int32 id /* IN: dataset ID */)
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDiscoordvar */
 
@@ -4277,6 +4547,8 @@ SDsetaccesstype(int32 id, /* IN: dataset ID */
     NC_var *var       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -4311,6 +4583,7 @@ SDsetaccesstype(int32 id, /* IN: dataset ID */
         ret_value = (intn)Hsetaccesstype(var->aid, accesstype);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetaccesstype */
 
@@ -4336,6 +4609,8 @@ SDsetblocksize(int32 sdsid, /* IN: dataset ID */
     NC_var *var       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -4355,6 +4630,7 @@ SDsetblocksize(int32 sdsid, /* IN: dataset ID */
     var->block_size = block_size;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetblocksize */
 
@@ -4380,6 +4656,8 @@ SDgetblocksize(int32  sdsid, /* IN: dataset ID */
     int32   temp_aid     = -1;
     intn    ret_value    = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -4423,6 +4701,7 @@ done:
             Hendaccess(temp_aid);
     }
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetblocksize */
 
@@ -4447,6 +4726,8 @@ SDsetfillmode(int32 sd_id,  /* IN: HDF file ID, returned from SDstart */
     intn cdfid;
     intn ret_value = FAIL;
 
+    SD_LOCK(sd_id);
+
     /* clear error stack */
     HEclear();
 
@@ -4460,6 +4741,7 @@ SDsetfillmode(int32 sd_id,  /* IN: HDF file ID, returned from SDstart */
     ret_value = ncsetfill(cdfid, fillmode);
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetfillmode() */
 
@@ -4484,6 +4766,8 @@ SDsetdimval_comp(int32 dimid,    /* IN: dimension ID, returned from SDgetdimid *
     NC_dim *dim       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(dimid);
+
     /* clear error stack */
     HEclear();
 
@@ -4510,6 +4794,7 @@ SDsetdimval_comp(int32 dimid,    /* IN: dimension ID, returned from SDgetdimid *
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetdimval_comp */
 
@@ -4531,6 +4816,8 @@ SDisdimval_bwcomp(int32 dimid /* IN: dimension ID, returned from SDgetdimid */)
     NC_dim *dim       = NULL;
     intn    ret_value = FAIL;
 
+    SD_LOCK(dimid);
+
     /* clear error stack */
     HEclear();
 
@@ -4554,6 +4841,7 @@ SDisdimval_bwcomp(int32 dimid /* IN: dimension ID, returned from SDgetdimid */)
     ret_value = dim->dim00_compat;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDisdimval_bwcomp */
 
@@ -4695,6 +4983,8 @@ SDsetchunk(int32         sdsid,     /* IN: sds access id */
     intn           i;                   /* loop variable */
     intn           ret_value = SUCCEED; /* return value */
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -4977,6 +5267,7 @@ done:
     /* free chunk dims */
     free(chunk[0].pdims);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetchunk */
 
@@ -5022,6 +5313,8 @@ SDgetchunkinfo(int32          sdsid,     /* IN: sds access id */
     intn            i;                   /* loop variable */
     intn            ret_value = SUCCEED; /* return value */
 
+    SD_LOCK(sdsid);
+
     /* Clear error stack */
     HEclear();
 
@@ -5199,6 +5492,7 @@ done:
         }
     }
     /* Normal cleanup */
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetchunkinfo() */
 
@@ -5250,6 +5544,8 @@ SDwritechunk(int32       sdsid,  /* IN: access aid to SDS */
     void           *tBuf      = NULL; /* buffer used for conversion */
     intn            ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -5374,6 +5670,7 @@ done:
     free(info_block.cdims);
     free(tBuf);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDwritechunk() */
 
@@ -5425,6 +5722,8 @@ SDreadchunk(int32  sdsid,  /* IN: access aid to SDS */
     void           *tBuf      = NULL; /* buffer used for conversion */
     intn            ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -5574,6 +5873,7 @@ done:
     free(info_block.cdims);
     free(tBuf);
 
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDreadchunk() */
 
@@ -5637,6 +5937,8 @@ SDsetchunkcache(int32 sdsid,    /* IN: access aid to mess with */
     int16   special;       /* Special code */
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -5677,9 +5979,85 @@ SDsetchunkcache(int32 sdsid,    /* IN: access aid to mess with */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDsetchunkcache() */
 
+/******************************************************************************
+NAME
+     SDsetfilechunkcache - size the chunk cache shared by the SDSs of a file
+
+DESCRIPTION
+     Keep the chunks of all the chunked SDSs of the file in one cache of
+     'size' bytes, evicted by 'policy'.  Calls Hsetchunkcache() on the
+     HDF file.
+
+RETURNS
+     SUCCEED/FAIL
+******************************************************************************/
+intn
+SDsetfilechunkcache(int32 fid,  /* IN: file id, returned from SDstart */
+                    int32 size, /* IN: # of bytes of chunks to cache */
+                    intn  policy /* IN: HDF_CHUNK_CACHE_xxx */)
+{
+    NC  *handle    = NULL; /* file handle */
+    intn ret_value = SUCCEED;
+
+    SD_LOCK(fid);
+
+    /* clear error stack */
+    HEclear();
+
+    /* get file handle and verify it is an HDF file */
+    handle = SDIhandle_from_id(fid, CDFTYPE);
+    if (handle == NULL || handle->file_type != HDF_FILE) {
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+    }
+
+    ret_value = Hsetchunkcache(handle->hdf_file, size, policy);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* SDsetfilechunkcache() */
+
+/******************************************************************************
+NAME
+     SDsetfilechunkthreads - (de)compress the chunks of a file on several threads
+
+DESCRIPTION
+     Decompress the chunks which SDreaddata() needs, and compress the
+     chunks which SDwritedata() and SDwritechunk() write, on up to
+     'nthreads' threads.  Calls Hsetchunkthreads() on the HDF file.
+
+RETURNS
+     SUCCEED/FAIL
+******************************************************************************/
+intn
+SDsetfilechunkthreads(int32 fid, /* IN: file id, returned from SDstart */
+                      intn  nthreads /* IN: # of threads, 0 or 1 for none */)
+{
+    NC  *handle    = NULL; /* file handle */
+    intn ret_value = SUCCEED;
+
+    SD_LOCK(fid);
+
+    /* clear error stack */
+    HEclear();
+
+    /* get file handle and verify it is an HDF file */
+    handle = SDIhandle_from_id(fid, CDFTYPE);
+    if (handle == NULL || handle->file_type != HDF_FILE) {
+        HGOTO_ERROR(DFE_ARGS, FAIL);
+    }
+
+    ret_value = Hsetchunkthreads(handle->hdf_file, nthreads);
+
+done:
+    H4_API_UNLOCK;
+    return ret_value;
+} /* SDsetfilechunkthreads() */
+
 /******************************************************************************
  NAME
     SDcheckempty -- checks whether an SDS is empty
@@ -5700,6 +6078,8 @@ SDcheckempty(int32 sdsid, /* IN: dataset ID */
     NC_var *var       = NULL; /* variable record struct */
     int32   ret_value = SUCCEED;
 
+    SD_LOCK(sdsid);
+
     /* clear error stack */
     HEclear();
 
@@ -5743,6 +6123,7 @@ SDcheckempty(int32 sdsid, /* IN: dataset ID */
     } /* var->data_ref != 0 */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDcheckempty */
 
@@ -5765,6 +6146,8 @@ SDidtype(int32 an_id)
     NC          *handle    = NULL; /* file record struct */
     hdf_idtype_t ret_value = NOT_SDAPI_ID;
 
+    SD_LOCK(an_id);
+
     /* clear error stack */
     HEclear();
 
@@ -5793,6 +6176,7 @@ SDidtype(int32 an_id)
                 ret_value = NOT_SDAPI_ID;
         }
     }
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDidtype */
 
@@ -5816,6 +6200,8 @@ SDreset_maxopenfiles(intn req_max)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -5826,6 +6212,7 @@ SDreset_maxopenfiles(intn req_max)
         HGOTO_ERROR(DFE_INTERNAL, FAIL); /* should propagate error code */
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDreset_maxopenfiles */
 
@@ -5849,6 +6236,8 @@ SDget_maxopenfiles(intn *curr_max,  /* OUT: current # of open files allowed */
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
@@ -5865,6 +6254,7 @@ SDget_maxopenfiles(intn *curr_max,  /* OUT: current # of open files allowed */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDget_maxopenfiles */
 
@@ -5885,10 +6275,13 @@ SDget_numopenfiles(void)
 {
     intn ret_value = SUCCEED;
 
+    H4_API_LOCK;
+
     /* clear error stack */
     HEclear();
 
     ret_value = (intn)NC_get_numopencdfs();
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDget_numopenfiles */
 
@@ -5914,6 +6307,8 @@ SDgetfilename(int32 fid, /* IN:  file ID */
     intn len;
     intn ret_value = SUCCEED;
 
+    SD_LOCK(fid);
+
     /* clear error stack */
     HEclear();
 
@@ -5930,6 +6325,7 @@ SDgetfilename(int32 fid, /* IN:  file ID */
     ret_value = len;
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetfilename */
 
@@ -5954,6 +6350,8 @@ SDgetnamelen(int32   id, /* IN:  object ID */
     NC_dim *dim       = NULL;
     intn    ret_value = SUCCEED;
 
+    SD_LOCK(id);
+
     /* clear error stack */
     HEclear();
 
@@ -5992,5 +6390,6 @@ SDgetnamelen(int32   id, /* IN:  object ID */
     }
 
 done:
+    H4_API_UNLOCK;
     return ret_value;
 } /* SDgetnamelen */
@@ -16,6 +16,7 @@
 
 #include "local_nc.h"
 #include "hfile.h"
+#include "hthread.h"
 
 /* Local function prototypes */
 static bool_t nssdc_xdr_NCvdata(NC *handle, NC_var *vp, unsigned long where, nc_type type, uint32 count,
@@ -499,10 +500,11 @@ xdr_NCv1data(XDR *xdrs, unsigned long where, nc_type type, Void *values)
  *
  *****************************************************************************/
 
-static int32 tBuf_size    = 0;
-static int32 tValues_size = 0;
-static int8 *tBuf         = NULL;
-static int8 *tValues      = NULL;
+/* Conversion buffers, one set per thread in a threadsafe build */
+static H4_THREAD_LOCAL int32 tBuf_size    = 0;
+static H4_THREAD_LOCAL int32 tValues_size = 0;
+static H4_THREAD_LOCAL int8 *tBuf         = NULL;
+static H4_THREAD_LOCAL int8 *tValues      = NULL;
 
 /* ------------------------------ SDPfreebuf ------------------------------ */
 /*
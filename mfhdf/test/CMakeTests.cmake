@@ -37,6 +37,8 @@ set (HDF4_TESTMFHDF_FILES
     cdfout.new
     cdfout.new.err
     chkbit.hdf
+    chkcache.hdf
+    chkthrd.hdf
     chktst.hdf
     comptst1.hdf
     comptst2.hdf
@@ -86,7 +88,11 @@ set (HDF4_TESTMFHDF_FILES
     vars_samename.hdf
     tdfanndg.hdf
     tdfansdg.hdf
+    tthreads.hdf
 )
+foreach (n RANGE 15)
+  list (APPEND HDF4_TESTMFHDF_FILES tthreads${n}.hdf tthreadsvg${n}.hdf)
+endforeach ()
 add_test (
     NAME MFHDF_TEST-clearall-objects
     COMMAND ${CMAKE_COMMAND} -E remove ${HDF4_TESTMFHDF_FILES}
@@ -130,3 +136,14 @@ set_tests_properties (MFHDF_TEST-hdfnctest PROPERTIES
     DEPENDS MFHDF_TEST-cdftest
     LABELS ${PROJECT_NAME}
 )
+
+if (HDF4_ENABLE_THREADSAFE)
+  add_test (NAME MFHDF_TEST-tthreads COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:tthreads>)
+  set_tests_properties (MFHDF_TEST-tthreads PROPERTIES
+      PASS_REGULAR_EXPRESSION "HDF threadsafe test passes"
+      FIXTURES_REQUIRED clear_MFHDF_TEST
+      DEPENDS MFHDF_TEST-hdfnctest
+      WORKING_DIRECTORY ${PROJECT_BINARY_DIR}/TEST
+      LABELS ${PROJECT_NAME}
+  )
+endif ()
@@ -11,6 +11,7 @@
  * help@hdfgroup.org.                                                        *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "mfhdf.h"
@@ -19,6 +20,8 @@
 
 #define CHKFILE   "chktst.hdf"  /* Chunking test file */
 #define CNBITFILE "chknbit.hdf" /* Chunking w/ NBIT compression */
+#define CCACHEFILE "chkcache.hdf" /* Chunk cache shared by the SDSs */
+#define CTHRDFILE  "chkthrd.hdf"  /* Chunks decompressed on threads */
 
 /* Dimensions of slab */
 static int32 edge_dims[3]  = {2, 3, 4}; /* size of slab dims */
@@ -78,6 +81,282 @@ static uint16 u16_data[2][3][4] = {{{0, 1, 2, 3}, {10, 11, 12, 13}, {20, 21, 22,
 static uint8 u8_data[2][3][4] = {{{0, 1, 2, 3}, {10, 11, 12, 13}, {20, 21, 22, 23}},
                                  {{100, 101, 102, 103}, {110, 111, 112, 113}, {120, 121, 122, 123}}};
 
+/* Chunked SDSs sharing the chunk cache of their file: rows of all of them
+   are written in turn through a cache of a few chunks, so that partly
+   written chunks of one SDS are written out and read back in to make room
+   for the others', then they are read back by columns */
+#define NCACHE_SDS 3
+#define CACHE_ROWS 20
+#define CACHE_COLS 30
+
+static int
+test_file_chunk_cache(void)
+{
+    HDF_CHUNK_DEF chunk_def;                     /* Chunk definition set */
+    int32         fid;                           /* File handle */
+    int32         sds[NCACHE_SDS];               /* SDS ids */
+    int32         dims[2] = {CACHE_ROWS, CACHE_COLS};
+    int32         start[2], edges[2];
+    int32         row[CACHE_COLS], col[CACHE_ROWS];
+    char          name[16];
+    intn          status;
+    intn          i, j, k;
+    int           num_errs = 0; /* number of errors so far */
+
+    fid = SDstart(CCACHEFILE, DFACC_CREATE);
+    CHECK(fid, FAIL, "SDstart");
+
+    /* Room for 4 of the 5x5 chunks of int32 */
+    status = SDsetfilechunkcache(fid, 4 * 5 * 5 * 4, HDF_CHUNK_CACHE_ARC + 1);
+    VERIFY(status, FAIL, "SDsetfilechunkcache");
+    status = SDsetfilechunkcache(fid, 4 * 5 * 5 * 4, HDF_CHUNK_CACHE_ARC);
+    CHECK(status, FAIL, "SDsetfilechunkcache");
+
+    memset(&chunk_def, 0, sizeof(chunk_def));
+    chunk_def.chunk_lengths[0] = 5;
+    chunk_def.chunk_lengths[1] = 5;
+    for (k = 0; k < NCACHE_SDS; k++) {
+        sprintf(name, "SharedCache%d", k);
+        sds[k] = SDcreate(fid, name, DFNT_INT32, 2, dims);
+        CHECK(sds[k], FAIL, "SDcreate");
+        status = SDsetchunk(sds[k], chunk_def, HDF_CHUNK);
+        CHECK(status, FAIL, "SDsetchunk");
+    }
+
+    edges[0] = 1;
+    edges[1] = CACHE_COLS;
+    for (i = 0; i < CACHE_ROWS; i++)
+        for (k = 0; k < NCACHE_SDS; k++) {
+            for (j = 0; j < CACHE_COLS; j++)
+                row[j] = k * 1000 + i * CACHE_COLS + j;
+            start[0] = i;
+            start[1] = 0;
+            status   = SDwritedata(sds[k], start, NULL, edges, row);
+            CHECK(status, FAIL, "SDwritedata");
+        }
+
+    for (k = 0; k < NCACHE_SDS; k++) {
+        status = SDendaccess(sds[k]);
+        CHECK(status, FAIL, "SDendaccess");
+    }
+    status = SDend(fid);
+    CHECK(status, FAIL, "SDend");
+
+    /* Read them back by columns, through an LRU cache this time */
+    fid = SDstart(CCACHEFILE, DFACC_RDONLY);
+    CHECK(fid, FAIL, "SDstart");
+    status = SDsetfilechunkcache(fid, 4 * 5 * 5 * 4, HDF_CHUNK_CACHE_LRU);
+    CHECK(status, FAIL, "SDsetfilechunkcache");
+    for (k = 0; k < NCACHE_SDS; k++) {
+        sds[k] = SDselect(fid, k);
+        CHECK(sds[k], FAIL, "SDselect");
+    }
+
+    edges[0] = CACHE_ROWS;
+    edges[1] = 1;
+    for (j = 0; j < CACHE_COLS; j++)
+        for (k = 0; k < NCACHE_SDS; k++) {
+            start[0] = 0;
+            start[1] = j;
+            status   = SDreaddata(sds[k], start, NULL, edges, col);
+            CHECK(status, FAIL, "SDreaddata");
+            for (i = 0; i < CACHE_ROWS; i++)
+                if (col[i] != k * 1000 + i * CACHE_COLS + j) {
+                    fprintf(stderr, "Shared chunk cache: wrong value at [%d][%d] of SDS %d\n", i, j, k);
+                    num_errs++;
+                    break;
+                }
+        }
+
+    for (k = 0; k < NCACHE_SDS; k++) {
+        status = SDendaccess(sds[k]);
+        CHECK(status, FAIL, "SDendaccess");
+    }
+    status = SDend(fid);
+    CHECK(status, FAIL, "SDend");
+
+    return num_errs;
+} /* test_file_chunk_cache() */
+
+/* A deflated SDS of many chunks read back with the chunks decompressed
+   on several threads, as a whole then as a hyperslab */
+#define THRD_ROWS  100
+#define THRD_COLS  200
+#define THRD_CHUNK 10
+#define THRD_VALUE(r, c) ((r) * 1000 + (c) * 7)
+
+static int
+test_chunk_threads(void)
+{
+    HDF_CHUNK_DEF chunk_def; /* Chunk definition set */
+    int32         fid;       /* File handle */
+    int32         sds;       /* SDS id */
+    int32         dims[2] = {THRD_ROWS, THRD_COLS};
+    int32         start[2], edges[2];
+    int32        *data;
+    intn          status;
+    intn          i, j;
+    int           num_errs = 0; /* number of errors so far */
+
+    data = (int32 *)malloc(THRD_ROWS * THRD_COLS * sizeof(int32));
+    CHECK_ALLOC(data, "data", "test_chunk_threads");
+    for (i = 0; i < THRD_ROWS; i++)
+        for (j = 0; j < THRD_COLS; j++)
+            data[i * THRD_COLS + j] = THRD_VALUE(i, j);
+
+    fid = SDstart(CTHRDFILE, DFACC_CREATE);
+    CHECK(fid, FAIL, "SDstart");
+    sds = SDcreate(fid, "Deflated", DFNT_INT32, 2, dims);
+    CHECK(sds, FAIL, "SDcreate");
+    memset(&chunk_def, 0, sizeof(chunk_def));
+    chunk_def.comp.chunk_lengths[0]   = THRD_CHUNK;
+    chunk_def.comp.chunk_lengths[1]   = THRD_CHUNK;
+    chunk_def.comp.comp_type          = COMP_CODE_DEFLATE;
+    chunk_def.comp.cinfo.deflate.level = 6;
+    status = SDsetchunk(sds, chunk_def, HDF_CHUNK | HDF_COMP);
+    CHECK(status, FAIL, "SDsetchunk");
+    start[0] = start[1] = 0;
+    status   = SDwritedata(sds, start, NULL, dims, data);
+    CHECK(status, FAIL, "SDwritedata");
+    status = SDendaccess(sds);
+    CHECK(status, FAIL, "SDendaccess");
+    status = SDend(fid);
+    CHECK(status, FAIL, "SDend");
+
+    fid = SDstart(CTHRDFILE, DFACC_RDONLY);
+    CHECK(fid, FAIL, "SDstart");
+    status = SDsetfilechunkthreads(fid, -1);
+    VERIFY(status, FAIL, "SDsetfilechunkthreads");
+    status = SDsetfilechunkthreads(fid, 3);
+    CHECK(status, FAIL, "SDsetfilechunkthreads");
+    sds = SDselect(fid, 0);
+    CHECK(sds, FAIL, "SDselect");
+
+    memset(data, 0, THRD_ROWS * THRD_COLS * sizeof(int32));
+    status = SDreaddata(sds, start, NULL, dims, data);
+    CHECK(status, FAIL, "SDreaddata");
+    for (i = 0; i < THRD_ROWS * THRD_COLS; i++)
+        if (data[i] != THRD_VALUE(i / THRD_COLS, i % THRD_COLS)) {
+            fprintf(stderr, "Chunks decompressed on threads: wrong value at [%d][%d]\n", i / THRD_COLS,
+                    i % THRD_COLS);
+            num_errs++;
+            break;
+        }
+
+    start[0] = 5;
+    start[1] = 17;
+    edges[0] = THRD_ROWS - 10;
+    edges[1] = THRD_COLS - 34;
+    memset(data, 0, THRD_ROWS * THRD_COLS * sizeof(int32));
+    status = SDreaddata(sds, start, NULL, edges, data);
+    CHECK(status, FAIL, "SDreaddata");
+    for (i = 0; i < edges[0] * edges[1]; i++)
+        if (data[i] != THRD_VALUE(start[0] + i / edges[1], start[1] + i % edges[1])) {
+            fprintf(stderr, "Chunks decompressed on threads: wrong value at [%d][%d] of the hyperslab\n",
+                    (int)(i / edges[1]), (int)(i % edges[1]));
+            num_errs++;
+            break;
+        }
+
+    status = SDendaccess(sds);
+    CHECK(status, FAIL, "SDendaccess");
+    status = SDend(fid);
+    CHECK(status, FAIL, "SDend");
+    free(data);
+
+    return num_errs;
+} /* test_chunk_threads() */
+
+/* A deflated SDS of many chunks written with the chunks compressed on
+   several threads, with SDwritedata then SDwritechunk, and read back as
+   usual */
+#define CHUNK_VALUE(r, c) (-((r) * 10 + (c)))
+
+static int
+test_chunk_encode_threads(void)
+{
+    HDF_CHUNK_DEF chunk_def; /* Chunk definition set */
+    int32         fid;       /* File handle */
+    int32         sds;       /* SDS id */
+    int32         dims[2] = {THRD_ROWS, THRD_COLS};
+    int32         start[2];
+    int32         origin[2] = {3, 7}; /* the chunk written with SDwritechunk */
+    int32         chunk[THRD_CHUNK * THRD_CHUNK];
+    int32         comp_size = 0, uncomp_size = 0;
+    int32        *data;
+    intn          status;
+    intn          i, j;
+    int           num_errs = 0; /* number of errors so far */
+
+    data = (int32 *)malloc(THRD_ROWS * THRD_COLS * sizeof(int32));
+    CHECK_ALLOC(data, "data", "test_chunk_encode_threads");
+    for (i = 0; i < THRD_ROWS; i++)
+        for (j = 0; j < THRD_COLS; j++)
+            data[i * THRD_COLS + j] = THRD_VALUE(i, j);
+    for (i = 0; i < THRD_CHUNK; i++)
+        for (j = 0; j < THRD_CHUNK; j++)
+            chunk[i * THRD_CHUNK + j] = CHUNK_VALUE(i, j);
+
+    fid = SDstart(CTHRDFILE, DFACC_CREATE);
+    CHECK(fid, FAIL, "SDstart");
+    status = SDsetfilechunkthreads(fid, 3);
+    CHECK(status, FAIL, "SDsetfilechunkthreads");
+    sds = SDcreate(fid, "Deflated", DFNT_INT32, 2, dims);
+    CHECK(sds, FAIL, "SDcreate");
+    memset(&chunk_def, 0, sizeof(chunk_def));
+    chunk_def.comp.chunk_lengths[0]    = THRD_CHUNK;
+    chunk_def.comp.chunk_lengths[1]    = THRD_CHUNK;
+    chunk_def.comp.comp_type           = COMP_CODE_DEFLATE;
+    chunk_def.comp.cinfo.deflate.level = 6;
+    status                             = SDsetchunk(sds, chunk_def, HDF_CHUNK | HDF_COMP);
+    CHECK(status, FAIL, "SDsetchunk");
+    start[0] = start[1] = 0;
+    status              = SDwritedata(sds, start, NULL, dims, data);
+    CHECK(status, FAIL, "SDwritedata");
+    status = SDwritechunk(sds, origin, chunk);
+    CHECK(status, FAIL, "SDwritechunk");
+    status = SDendaccess(sds);
+    CHECK(status, FAIL, "SDendaccess");
+    status = SDend(fid);
+    CHECK(status, FAIL, "SDend");
+
+    fid = SDstart(CTHRDFILE, DFACC_RDONLY);
+    CHECK(fid, FAIL, "SDstart");
+    sds = SDselect(fid, 0);
+    CHECK(sds, FAIL, "SDselect");
+
+    status = SDgetdatasize(sds, &comp_size, &uncomp_size);
+    CHECK(status, FAIL, "SDgetdatasize");
+    if (comp_size <= 0 || comp_size >= uncomp_size) {
+        fprintf(stderr, "Chunks compressed on threads: %d bytes for %d of data\n", (int)comp_size,
+                (int)uncomp_size);
+        num_errs++;
+    }
+
+    memset(data, 0, THRD_ROWS * THRD_COLS * sizeof(int32));
+    status = SDreaddata(sds, start, NULL, dims, data);
+    CHECK(status, FAIL, "SDreaddata");
+    for (i = 0; i < THRD_ROWS * THRD_COLS; i++) {
+        int32 r = i / THRD_COLS, c = i % THRD_COLS;
+
+        if (data[i] != (r / THRD_CHUNK == origin[0] && c / THRD_CHUNK == origin[1]
+                            ? CHUNK_VALUE(r % THRD_CHUNK, c % THRD_CHUNK)
+                            : THRD_VALUE(r, c))) {
+            fprintf(stderr, "Chunks compressed on threads: wrong value at [%d][%d]\n", (int)r, (int)c);
+            num_errs++;
+            break;
+        }
+    }
+
+    status = SDendaccess(sds);
+    CHECK(status, FAIL, "SDendaccess");
+    status = SDend(fid);
+    CHECK(status, FAIL, "SDend");
+    free(data);
+
+    return num_errs;
+} /* test_chunk_encode_threads() */
+
 extern int
 test_chunk()
 {
@@ -1377,6 +1656,21 @@ test8:
     status = SDend(fchk);
     CHECK(status, FAIL, "Chunk Test 8. SDend");
 
+    /*
+     * Test 9. Chunked SDSs sharing the chunk cache of their file
+     */
+    num_errs += test_file_chunk_cache();
+
+    /*
+     * Test 10. Chunks decompressed on several threads
+     */
+    num_errs += test_chunk_threads();
+
+    /*
+     * Test 11. Chunks compressed on several threads
+     */
+    num_errs += test_chunk_encode_threads();
+
     if (num_errs == 0)
         PASSED();
 
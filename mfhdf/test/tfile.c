@@ -426,6 +426,111 @@ test_fileformat()
     return num_errs;
 }
 
+/********************************************************************
+   Name: test_file_image() - tests SDstart_image and SDend_image
+
+   Description:
+    The main contents include:
+    - create a file in memory with a dataset and get its image
+    - open the image read-only and read the dataset back
+    - open the image for write, add a dataset, and verify that the
+      new image has both datasets while the old one is unchanged
+
+   Return value:
+    The number of errors occurred in this routine.
+
+*********************************************************************/
+
+#define IMG_DIM0 20
+
+static intn
+test_file_image()
+{
+    int32  fid, sds_id;
+    int32  dims[1], start[1], edges[1];
+    int32  n_datasets, n_attrs, size, size2;
+    int16  outdata[IMG_DIM0], indata[IMG_DIM0];
+    void  *image = NULL, *image2 = NULL;
+    uint8 *copy  = NULL;
+    intn   status;
+    intn   i;
+    intn   num_errs = 0; /* number of errors so far */
+
+    for (i = 0; i < IMG_DIM0; i++)
+        outdata[i] = (int16)(i * 3);
+    dims[0]  = IMG_DIM0;
+    start[0] = 0;
+    edges[0] = IMG_DIM0;
+
+    /* Create a file in memory */
+    fid = SDstart_image(NULL, 0, DFACC_CREATE);
+    CHECK(fid, FAIL, "test_file_image: SDstart_image");
+    sds_id = SDcreate(fid, "data1", DFNT_INT16, 1, dims);
+    CHECK(sds_id, FAIL, "test_file_image: SDcreate");
+    status = SDwritedata(sds_id, start, NULL, edges, outdata);
+    CHECK(status, FAIL, "test_file_image: SDwritedata");
+    status = SDendaccess(sds_id);
+    CHECK(status, FAIL, "test_file_image: SDendaccess");
+    status = SDend_image(fid, &image, &size);
+    CHECK(status, FAIL, "test_file_image: SDend_image");
+    if (image == NULL || size <= 0) {
+        fprintf(stderr, "test_file_image: no image from SDend_image\n");
+        return num_errs + 1;
+    }
+
+    /* Keep a copy to check that the image is never modified */
+    copy = (uint8 *)malloc((size_t)size);
+    CHECK_ALLOC(copy, "copy", "test_file_image");
+    memcpy(copy, image, (size_t)size);
+
+    /* Read the dataset back from the image */
+    fid = SDstart_image(image, size, DFACC_READ);
+    CHECK(fid, FAIL, "test_file_image: SDstart_image");
+    sds_id = SDselect(fid, 0);
+    CHECK(sds_id, FAIL, "test_file_image: SDselect");
+    status = SDreaddata(sds_id, start, NULL, edges, indata);
+    CHECK(status, FAIL, "test_file_image: SDreaddata");
+    if (memcmp(indata, outdata, sizeof(outdata)) != 0) {
+        fprintf(stderr, "test_file_image: wrong data read from the image\n");
+        num_errs++;
+    }
+    status = SDendaccess(sds_id);
+    CHECK(status, FAIL, "test_file_image: SDendaccess");
+    status = SDend_image(fid, &image2, &size2);
+    CHECK(status, FAIL, "test_file_image: SDend_image");
+    VERIFY((image2 == image), TRUE, "test_file_image: SDend_image");
+
+    /* Add a dataset to a copy of the image */
+    fid = SDstart_image(image, size, DFACC_RDWR);
+    CHECK(fid, FAIL, "test_file_image: SDstart_image");
+    sds_id = SDcreate(fid, "data2", DFNT_INT16, 1, dims);
+    CHECK(sds_id, FAIL, "test_file_image: SDcreate");
+    status = SDwritedata(sds_id, start, NULL, edges, outdata);
+    CHECK(status, FAIL, "test_file_image: SDwritedata");
+    status = SDendaccess(sds_id);
+    CHECK(status, FAIL, "test_file_image: SDendaccess");
+    status = SDend_image(fid, &image2, &size2);
+    CHECK(status, FAIL, "test_file_image: SDend_image");
+    if (memcmp(copy, image, (size_t)size) != 0) {
+        fprintf(stderr, "test_file_image: the original image was modified\n");
+        num_errs++;
+    }
+
+    /* The new image has both datasets */
+    fid = SDstart_image(image2, size2, DFACC_READ);
+    CHECK(fid, FAIL, "test_file_image: SDstart_image");
+    status = SDfileinfo(fid, &n_datasets, &n_attrs);
+    CHECK(status, FAIL, "test_file_image: SDfileinfo");
+    VERIFY(n_datasets, 2, "test_file_image: SDfileinfo");
+    status = SDend_image(fid, NULL, NULL);
+    CHECK(status, FAIL, "test_file_image: SDend_image");
+
+    free(image);
+    free(image2);
+    free(copy);
+    return num_errs;
+}
+
 /* Test driver for testing miscellaneous file related APIs. */
 extern int
 test_files()
@@ -447,6 +552,9 @@ test_files()
     /* Test determining of file format */
     num_errs = num_errs + test_fileformat();
 
+    /* Test files held in memory */
+    num_errs = num_errs + test_file_image();
+
     if (num_errs == 0)
         PASSED();
     return num_errs;
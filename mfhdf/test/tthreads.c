@@ -0,0 +1,597 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF.  The full HDF copyright notice, including       *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF/releases/.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/****************************************************************************
+ * tthreads.c - tests the threadsafe build of the library.
+ * Structure of the file:
+ *    test_threads - test driver for threads sharing one file
+ *      make_file  - creates a file with plain, chunked and compressed SDSs
+ *      reader     - thread routine reading random hyperslabs of the SDSs,
+ *                   through its own SD id or one shared by all threads,
+ *                   and checking that failures show up in its own error
+ *                   stack
+ *    test_files   - test driver for threads reading files of their own
+ *      file_reader - thread routine opening its files over and over and
+ *                   reading all of their SDSs, while the other threads do
+ *                   the same with theirs
+ *    test_opens   - test driver for threads opening files with the H, V and
+ *                   GR interfaces while other threads read files with SD
+ *      file_opener - thread routine opening and closing its files over
+ *                   and over with Hopen, Vstart and GRstart
+ *    test_vsgr    - test driver for threads reading vdatas and images
+ *                   while other threads read files with SD
+ *      make_vsgr_file - creates a file with a vdata and a GR image
+ *      vsgr_reader - thread routine reading the vdata with VSread and the
+ *                   image with GRreadimage from its files over and over
+ *
+ * This test is only built when the library is threadsafe.
+ ****************************************************************************/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mfhdf.h"
+
+#include "hdftest.h"
+
+#define FILE_NAME "tthreads.hdf"
+#define FILE_FMT  "tthreads%d.hdf"
+#define VSGR_FMT  "tthreadsvg%d.hdf"
+#define VS_NAME   "values"
+#define VS_FIELD  "value"
+#define N_SDS     3
+#define DIM0      64
+#define DIM1      64
+#define N_THREADS 8
+#define N_LOOPS   200
+
+/* SD id shared by all the threads */
+static int32 shared_sd_id = FAIL;
+
+/* Value of the element [i][j] of the SDS number n */
+#define VALUE(n, i, j) ((int32)((n)*100000 + (i)*DIM1 + (j)))
+
+/* Creates a file with one plain SDS, one chunked and one chunked and
+   compressed, all holding the pattern given by VALUE() */
+static int
+make_file(const char *file_name)
+{
+    int32         sd_id, sds_id;
+    int32         dims[2] = {DIM0, DIM1}, start[2] = {0, 0};
+    int32         data[DIM0][DIM1];
+    HDF_CHUNK_DEF c_def;
+    char          name[16];
+    int           n, i, j;
+    intn          status;
+    int           num_errs = 0;
+
+    sd_id = SDstart(file_name, DFACC_CREATE);
+    CHECK(sd_id, FAIL, "SDstart");
+
+    for (n = 0; n < N_SDS; n++) {
+        snprintf(name, sizeof(name), "data%d", n);
+        sds_id = SDcreate(sd_id, name, DFNT_INT32, 2, dims);
+        CHECK(sds_id, FAIL, "SDcreate");
+
+        if (n > 0) {
+            memset(&c_def, 0, sizeof(c_def));
+            c_def.comp.chunk_lengths[0] = 16;
+            c_def.comp.chunk_lengths[1] = 16;
+            if (n == 1)
+                status = SDsetchunk(sds_id, c_def, HDF_CHUNK);
+            else {
+                c_def.comp.comp_type           = COMP_CODE_DEFLATE;
+                c_def.comp.cinfo.deflate.level = 6;
+                status                         = SDsetchunk(sds_id, c_def, HDF_CHUNK | HDF_COMP);
+            }
+            CHECK(status, FAIL, "SDsetchunk");
+        }
+
+        for (i = 0; i < DIM0; i++)
+            for (j = 0; j < DIM1; j++)
+                data[i][j] = VALUE(n, i, j);
+        status = SDwritedata(sds_id, start, NULL, dims, (void *)data);
+        CHECK(status, FAIL, "SDwritedata");
+
+        status = SDendaccess(sds_id);
+        CHECK(status, FAIL, "SDendaccess");
+    }
+
+    status = SDend(sd_id);
+    CHECK(status, FAIL, "SDend");
+
+    return num_errs;
+} /* make_file */
+
+/* Thread routine: reads random hyperslabs of the SDSs and checks them.
+   The number of errors is returned through the argument. */
+static void *
+reader(void *arg)
+{
+    int         *errs = (int *)arg;
+    unsigned int seed = (unsigned int)(*errs) + 1;
+    int32        start[2], edges[2];
+    int32       *buf = NULL;
+    int32        sd_id, sds_id;
+    int          loop, n, i, j;
+    intn         status;
+    int          num_errs = 0;
+
+    buf = (int32 *)malloc(DIM0 * DIM1 * sizeof(int32));
+    CHECK_ALLOC(buf, "buf", "reader");
+
+    for (loop = 0; loop < N_LOOPS; loop++) {
+        /* Every other loop goes through a file opened by this thread */
+        if (loop % 2 == 0) {
+            sd_id = SDstart(FILE_NAME, DFACC_READ);
+            CHECK(sd_id, FAIL, "SDstart");
+            if (sd_id == FAIL)
+                continue;
+        }
+        else
+            sd_id = shared_sd_id;
+
+        n      = (int)(rand_r(&seed) % N_SDS);
+        sds_id = SDselect(sd_id, n);
+        CHECK(sds_id, FAIL, "SDselect");
+
+        start[0] = (int32)(rand_r(&seed) % DIM0);
+        start[1] = (int32)(rand_r(&seed) % DIM1);
+        edges[0] = (int32)(rand_r(&seed) % (unsigned)(DIM0 - start[0])) + 1;
+        edges[1] = (int32)(rand_r(&seed) % (unsigned)(DIM1 - start[1])) + 1;
+
+        status = SDreaddata(sds_id, start, NULL, edges, (void *)buf);
+        CHECK(status, FAIL, "SDreaddata");
+        if (status != FAIL)
+            for (i = 0; i < edges[0]; i++)
+                for (j = 0; j < edges[1]; j++)
+                    if (buf[i * edges[1] + j] != VALUE(n, start[0] + i, start[1] + j)) {
+                        fprintf(stderr, "*** wrong value in data%d[%d][%d]\n", n, (int)(start[0] + i),
+                                (int)(start[1] + j));
+                        num_errs++;
+                        i = edges[0];
+                        break;
+                    }
+
+        status = SDendaccess(sds_id);
+        CHECK(status, FAIL, "SDendaccess");
+
+        /* A failed call must leave its error in this thread's stack, no
+           matter what the other threads clear or push meanwhile */
+        if (loop % 10 == 0) {
+            sds_id = SDselect(sd_id, N_SDS);
+            VERIFY(sds_id, FAIL, "SDselect");
+            VERIFY(HEvalue(1), DFE_ARGS, "HEvalue");
+        }
+
+        if (sd_id != shared_sd_id) {
+            status = SDend(sd_id);
+            CHECK(status, FAIL, "SDend");
+        }
+    }
+
+    free(buf);
+    *errs = num_errs;
+    return NULL;
+} /* reader */
+
+/* Test driver for the threadsafe build */
+static int
+test_threads(void)
+{
+    pthread_t threads[N_THREADS];
+    int       errs[N_THREADS];
+    int       created[N_THREADS];
+    int       t;
+    intn      status;
+    int       num_errs = 0;
+
+    /* Output message about test being performed */
+    TESTING("SDreaddata from many threads (tthreads.c)");
+
+    num_errs += make_file(FILE_NAME);
+    if (num_errs > 0) {
+        H4_FAILED();
+        return num_errs;
+    }
+
+    shared_sd_id = SDstart(FILE_NAME, DFACC_READ);
+    CHECK(shared_sd_id, FAIL, "SDstart");
+
+    for (t = 0; t < N_THREADS; t++) {
+        errs[t]    = t;
+        created[t] = (pthread_create(&threads[t], NULL, reader, &errs[t]) == 0);
+        if (!created[t]) {
+            fprintf(stderr, "*** cannot create thread %d\n", t);
+            num_errs++;
+        }
+    }
+    for (t = 0; t < N_THREADS; t++)
+        if (created[t]) {
+            pthread_join(threads[t], NULL);
+            num_errs += errs[t];
+        }
+
+    status = SDend(shared_sd_id);
+    CHECK(status, FAIL, "SDend");
+
+    if (num_errs == 0)
+        PASSED();
+    return num_errs;
+} /* test_threads */
+
+/* Thread routine: opens the files given by the argument over and over,
+   and reads all of their SDSs.  The number of errors is returned through
+   the argument. */
+static void *
+file_reader(void *arg)
+{
+    int   *errs       = (int *)arg;
+    int    first_file = *errs;
+    char   file_name[32];
+    int32  start[2] = {0, 0}, edges[2] = {DIM0, DIM1};
+    int32 *buf      = NULL;
+    int32  sd_id, sds_id;
+    int    loop, n, i;
+    intn   status;
+    int    num_errs = 0;
+
+    buf = (int32 *)malloc(DIM0 * DIM1 * sizeof(int32));
+    CHECK_ALLOC(buf, "buf", "file_reader");
+
+    for (loop = 0; loop < N_LOOPS / 4; loop++) {
+        /* Each thread has two files of its own */
+        snprintf(file_name, sizeof(file_name), FILE_FMT, 2 * first_file + loop % 2);
+        sd_id = SDstart(file_name, DFACC_READ);
+        CHECK(sd_id, FAIL, "SDstart");
+        if (sd_id == FAIL)
+            continue;
+
+        for (n = 0; n < N_SDS; n++) {
+            sds_id = SDselect(sd_id, n);
+            CHECK(sds_id, FAIL, "SDselect");
+
+            status = SDreaddata(sds_id, start, NULL, edges, (void *)buf);
+            CHECK(status, FAIL, "SDreaddata");
+            if (status != FAIL)
+                for (i = 0; i < DIM0 * DIM1; i++)
+                    if (buf[i] != VALUE(n, i / DIM1, i % DIM1)) {
+                        fprintf(stderr, "*** wrong value in %s data%d[%d][%d]\n", file_name, n, i / DIM1,
+                                i % DIM1);
+                        num_errs++;
+                        break;
+                    }
+
+            status = SDendaccess(sds_id);
+            CHECK(status, FAIL, "SDendaccess");
+        }
+
+        status = SDend(sd_id);
+        CHECK(status, FAIL, "SDend");
+    }
+
+    free(buf);
+    *errs = num_errs;
+    return NULL;
+} /* file_reader */
+
+/* Thread routine: opens and closes the files given by the argument over
+   and over with the H, V and GR interfaces.  The number of errors is
+   returned through the argument. */
+static void *
+file_opener(void *arg)
+{
+    int  *errs       = (int *)arg;
+    int   first_file = *errs;
+    char  file_name[32];
+    int32 file_id, gr_id;
+    int   loop;
+    intn  status;
+    int   num_errs = 0;
+
+    for (loop = 0; loop < N_LOOPS / 4; loop++) {
+        snprintf(file_name, sizeof(file_name), FILE_FMT, 2 * first_file + loop % 2);
+        status = Hishdf(file_name);
+        VERIFY(status, TRUE, "Hishdf");
+
+        file_id = Hopen(file_name, DFACC_READ, 0);
+        CHECK(file_id, FAIL, "Hopen");
+        if (file_id == FAIL)
+            continue;
+
+        status = Vstart(file_id);
+        CHECK(status, FAIL, "Vstart");
+        gr_id = GRstart(file_id);
+        CHECK(gr_id, FAIL, "GRstart");
+
+        status = GRend(gr_id);
+        CHECK(status, FAIL, "GRend");
+        status = Vend(file_id);
+        CHECK(status, FAIL, "Vend");
+        status = Hclose(file_id);
+        CHECK(status, FAIL, "Hclose");
+    }
+
+    *errs = num_errs;
+    return NULL;
+} /* file_opener */
+
+/* Test driver for threads reading files of their own */
+static int
+test_files(void)
+{
+    pthread_t threads[N_THREADS];
+    int       errs[N_THREADS];
+    int       created[N_THREADS];
+    char      file_name[32];
+    int       t;
+    int       num_errs = 0;
+
+    /* Output message about test being performed */
+    TESTING("SDreaddata on different files from many threads (tthreads.c)");
+
+    for (t = 0; t < 2 * N_THREADS; t++) {
+        snprintf(file_name, sizeof(file_name), FILE_FMT, t);
+        num_errs += make_file(file_name);
+    }
+    if (num_errs > 0) {
+        H4_FAILED();
+        return num_errs;
+    }
+
+    for (t = 0; t < N_THREADS; t++) {
+        errs[t]    = t;
+        created[t] = (pthread_create(&threads[t], NULL, file_reader, &errs[t]) == 0);
+        if (!created[t]) {
+            fprintf(stderr, "*** cannot create thread %d\n", t);
+            num_errs++;
+        }
+    }
+    for (t = 0; t < N_THREADS; t++)
+        if (created[t]) {
+            pthread_join(threads[t], NULL);
+            num_errs += errs[t];
+        }
+
+    if (num_errs == 0)
+        PASSED();
+    return num_errs;
+} /* test_files */
+
+/* Test driver for threads opening files with the H, V and GR interfaces
+   while other threads read files with SD; uses the files of test_files */
+static int
+test_opens(void)
+{
+    pthread_t threads[N_THREADS];
+    int       errs[N_THREADS];
+    int       created[N_THREADS];
+    int       t;
+    int       num_errs = 0;
+
+    /* Output message about test being performed */
+    TESTING("Hopen/Vstart/GRstart along with SD from many threads (tthreads.c)");
+
+    for (t = 0; t < N_THREADS; t++) {
+        errs[t]    = t;
+        created[t] = (pthread_create(&threads[t], NULL, (t % 2) ? file_opener : file_reader, &errs[t]) == 0);
+        if (!created[t]) {
+            fprintf(stderr, "*** cannot create thread %d\n", t);
+            num_errs++;
+        }
+    }
+    for (t = 0; t < N_THREADS; t++)
+        if (created[t]) {
+            pthread_join(threads[t], NULL);
+            num_errs += errs[t];
+        }
+
+    if (num_errs == 0)
+        PASSED();
+    return num_errs;
+} /* test_opens */
+
+/* Creates a file with a vdata of DIM0 * DIM1 records and a GR image of
+   DIM0 x DIM1 pixels, both holding the pattern given by VALUE() */
+static int
+make_vsgr_file(const char *file_name, int n)
+{
+    int32 file_id, gr_id, ri_id, vdata_id;
+    int32 dims[2] = {DIM0, DIM1}, start[2] = {0, 0};
+    int32 data[DIM0][DIM1];
+    int   i, j;
+    intn  status;
+    int   num_errs = 0;
+
+    for (i = 0; i < DIM0; i++)
+        for (j = 0; j < DIM1; j++)
+            data[i][j] = VALUE(n, i, j);
+
+    file_id = Hopen(file_name, DFACC_CREATE, 0);
+    CHECK(file_id, FAIL, "Hopen");
+    status = Vstart(file_id);
+    CHECK(status, FAIL, "Vstart");
+
+    vdata_id = VSattach(file_id, -1, "w");
+    CHECK(vdata_id, FAIL, "VSattach");
+    status = VSsetname(vdata_id, VS_NAME);
+    CHECK(status, FAIL, "VSsetname");
+    status = VSfdefine(vdata_id, VS_FIELD, DFNT_INT32, 1);
+    CHECK(status, FAIL, "VSfdefine");
+    status = VSsetfields(vdata_id, VS_FIELD);
+    CHECK(status, FAIL, "VSsetfields");
+    status = VSwrite(vdata_id, (uint8 *)data, DIM0 * DIM1, FULL_INTERLACE);
+    VERIFY(status, DIM0 * DIM1, "VSwrite");
+    status = VSdetach(vdata_id);
+    CHECK(status, FAIL, "VSdetach");
+
+    gr_id = GRstart(file_id);
+    CHECK(gr_id, FAIL, "GRstart");
+    ri_id = GRcreate(gr_id, "image", 1, DFNT_INT32, MFGR_INTERLACE_PIXEL, dims);
+    CHECK(ri_id, FAIL, "GRcreate");
+    status = GRwriteimage(ri_id, start, NULL, dims, (void *)data);
+    CHECK(status, FAIL, "GRwriteimage");
+    status = GRendaccess(ri_id);
+    CHECK(status, FAIL, "GRendaccess");
+    status = GRend(gr_id);
+    CHECK(status, FAIL, "GRend");
+
+    status = Vend(file_id);
+    CHECK(status, FAIL, "Vend");
+    status = Hclose(file_id);
+    CHECK(status, FAIL, "Hclose");
+
+    return num_errs;
+} /* make_vsgr_file */
+
+/* Thread routine: opens the files of make_vsgr_file given by the argument
+   over and over, and reads their vdata with VSread and their image with
+   GRreadimage.  The number of errors is returned through the argument. */
+static void *
+vsgr_reader(void *arg)
+{
+    int   *errs       = (int *)arg;
+    int    first_file = *errs;
+    char   file_name[32];
+    int32  start[2] = {0, 0}, edges[2] = {DIM0, DIM1};
+    int32 *buf      = NULL;
+    int32  file_id, gr_id, ri_id, vdata_id, vdata_ref;
+    int    loop, n, i;
+    intn   status;
+    int    num_errs = 0;
+
+    buf = (int32 *)malloc(DIM0 * DIM1 * sizeof(int32));
+    CHECK_ALLOC(buf, "buf", "vsgr_reader");
+
+    for (loop = 0; loop < N_LOOPS / 4; loop++) {
+        /* Each thread has two files of its own */
+        n = 2 * first_file + loop % 2;
+        snprintf(file_name, sizeof(file_name), VSGR_FMT, n);
+        file_id = Hopen(file_name, DFACC_READ, 0);
+        CHECK(file_id, FAIL, "Hopen");
+        if (file_id == FAIL)
+            continue;
+        status = Vstart(file_id);
+        CHECK(status, FAIL, "Vstart");
+
+        vdata_ref = VSfind(file_id, VS_NAME);
+        CHECK(vdata_ref, 0, "VSfind");
+        vdata_id = VSattach(file_id, vdata_ref, "r");
+        CHECK(vdata_id, FAIL, "VSattach");
+        status = VSsetfields(vdata_id, VS_FIELD);
+        CHECK(status, FAIL, "VSsetfields");
+        memset(buf, 0, DIM0 * DIM1 * sizeof(int32));
+        status = VSread(vdata_id, (uint8 *)buf, DIM0 * DIM1, FULL_INTERLACE);
+        VERIFY(status, DIM0 * DIM1, "VSread");
+        for (i = 0; i < DIM0 * DIM1; i++)
+            if (buf[i] != VALUE(n, i / DIM1, i % DIM1)) {
+                fprintf(stderr, "*** wrong value in %s record %d\n", file_name, i);
+                num_errs++;
+                break;
+            }
+        status = VSdetach(vdata_id);
+        CHECK(status, FAIL, "VSdetach");
+
+        gr_id = GRstart(file_id);
+        CHECK(gr_id, FAIL, "GRstart");
+        ri_id = GRselect(gr_id, 0);
+        CHECK(ri_id, FAIL, "GRselect");
+        memset(buf, 0, DIM0 * DIM1 * sizeof(int32));
+        status = GRreadimage(ri_id, start, NULL, edges, (void *)buf);
+        CHECK(status, FAIL, "GRreadimage");
+        if (status != FAIL)
+            for (i = 0; i < DIM0 * DIM1; i++)
+                if (buf[i] != VALUE(n, i / DIM1, i % DIM1)) {
+                    fprintf(stderr, "*** wrong value in %s image[%d][%d]\n", file_name, i / DIM1, i % DIM1);
+                    num_errs++;
+                    break;
+                }
+        status = GRendaccess(ri_id);
+        CHECK(status, FAIL, "GRendaccess");
+        status = GRend(gr_id);
+        CHECK(status, FAIL, "GRend");
+
+        status = Vend(file_id);
+        CHECK(status, FAIL, "Vend");
+        status = Hclose(file_id);
+        CHECK(status, FAIL, "Hclose");
+    }
+
+    free(buf);
+    *errs = num_errs;
+    return NULL;
+} /* vsgr_reader */
+
+/* Test driver for threads reading vdatas and images while other threads
+   read files with SD; uses the files of test_files for SD */
+static int
+test_vsgr(void)
+{
+    pthread_t threads[N_THREADS];
+    int       errs[N_THREADS];
+    int       created[N_THREADS];
+    char      file_name[32];
+    int       t;
+    int       num_errs = 0;
+
+    /* Output message about test being performed */
+    TESTING("VSread/GRreadimage along with SD from many threads (tthreads.c)");
+
+    for (t = 0; t < 2 * N_THREADS; t++) {
+        snprintf(file_name, sizeof(file_name), VSGR_FMT, t);
+        num_errs += make_vsgr_file(file_name, t);
+    }
+    if (num_errs > 0) {
+        H4_FAILED();
+        return num_errs;
+    }
+
+    for (t = 0; t < N_THREADS; t++) {
+        errs[t]    = t;
+        created[t] = (pthread_create(&threads[t], NULL, (t % 4) ? vsgr_reader : file_reader, &errs[t]) == 0);
+        if (!created[t]) {
+            fprintf(stderr, "*** cannot create thread %d\n", t);
+            num_errs++;
+        }
+    }
+    for (t = 0; t < N_THREADS; t++)
+        if (created[t]) {
+            pthread_join(threads[t], NULL);
+            num_errs += errs[t];
+        }
+
+    if (num_errs == 0)
+        PASSED();
+    return num_errs;
+} /* test_vsgr */
+
+int
+main(void)
+{
+    int num_errs = 0;
+
+    num_errs += test_threads();
+    num_errs += test_files();
+    num_errs += test_opens();
+    num_errs += test_vsgr();
+
+    if (num_errs == 0) {
+        printf("*** HDF threadsafe test passes ***\n");
+        return EXIT_SUCCESS;
+    }
+    else {
+        printf("*** HDF threadsafe test fails ***\n");
+        return EXIT_FAILURE;
+    }
+}